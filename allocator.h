@@ -88,8 +88,30 @@ ATTRIBUTE_RESTRICT_RETURN EXTERNAL void* allocator_allocate(Allocator* alloc, is
 EXTERNAL void                            allocator_deallocate(Allocator* alloc, void* old_ptr,isize old_size, isize align);
 EXTERNAL Allocator_Stats                 allocator_get_stats(Allocator* alloc);
 
-#define REALLOCATE(alloc, new_count, old_ptr, old_count, T) (T*) allocator_reallocate((alloc), (new_count)*sizeof(T), (old_ptr), (old_count)*sizeof(T), __alignof(T))
-#define ALLOCATE(alloc, new_count, T)                       (T*) allocator_allocate((alloc), (new_count)*sizeof(T), __alignof(T))
+//The static call site of an allocation. When ALLOCATOR_SITES is defined the file and line are set by the ALLOCATE and 
+// REALLOCATE macros just before the call and cleared once it returns. Otherwise the macros are plain calls and cost nothing extra. 
+// The label stays set until changed so that it covers all allocations of some subsystem including the ones done by containers. 
+// Allocators that care (Tracking_Allocator) attribute memory to it, others ignore it.
+typedef struct Allocator_Site {
+    const char* file;
+    const char* label;
+    int32_t line;
+    int32_t _;
+} Allocator_Site;
+
+extern ATTRIBUTE_THREAD_LOCAL Allocator_Site g_allocator_site;
+static inline Allocator_Site allocator_get_site() { return g_allocator_site; } //returns the site of the allocation currently being made by this thread
+static inline void           allocator_set_site(const char* file, int32_t line) { g_allocator_site.file = file; g_allocator_site.line = line; } //sets the file and line for the next allocation call of this thread
+EXTERNAL const char*         allocator_set_site_label(const char* label); //sets the label of this thread returning the previous one
+
+#ifdef ALLOCATOR_SITES
+    static inline void* _allocator_site_clear(void* ptr) { allocator_set_site(NULL, 0); return ptr; }
+    #define REALLOCATE(alloc, new_count, old_ptr, old_count, T) (allocator_set_site(__FILE__, __LINE__), (T*) _allocator_site_clear(allocator_reallocate((alloc), (new_count)*sizeof(T), (old_ptr), (old_count)*sizeof(T), __alignof(T))))
+    #define ALLOCATE(alloc, new_count, T)                       (allocator_set_site(__FILE__, __LINE__), (T*) _allocator_site_clear(allocator_allocate((alloc), (new_count)*sizeof(T), __alignof(T))))
+#else
+    #define REALLOCATE(alloc, new_count, old_ptr, old_count, T) (T*) allocator_reallocate((alloc), (new_count)*sizeof(T), (old_ptr), (old_count)*sizeof(T), __alignof(T))
+    #define ALLOCATE(alloc, new_count, T)                       (T*) allocator_allocate((alloc), (new_count)*sizeof(T), __alignof(T))
+#endif
 #define DEALLOCATE(alloc, old_ptr, old_count, T)                 allocator_deallocate((alloc), (old_ptr), (old_count)*sizeof(T), __alignof(T))
 
 EXTERNAL void allocator_panic(Allocator_Error error);
@@ -323,6 +345,15 @@ EXTERNAL void* align_backward(void* ptr, isize align_to);
     EXTERNAL Allocator* allocator_get_malloc()  { return &_malloc_alloc; }
     EXTERNAL Allocator_Set allocators_get()     { return g_allocators; }
 
+    ATTRIBUTE_THREAD_LOCAL Allocator_Site g_allocator_site = {0};
+
+    EXTERNAL const char* allocator_set_site_label(const char* label)
+    {
+        const char* prev = g_allocator_site.label;
+        g_allocator_site.label = label;
+        return prev;
+    }
+
     EXTERNAL Allocator_Set allocator_set_default(Allocator* new_default)
     {
         Allocator_Set prev = g_allocators;
@@ -26,19 +26,40 @@
 //  +-----------------------------------------------+       L 8 aligned              L aligned to user specified align
 //
 // (*) Dead zones might be larger then specified by options to account for overaligned allocations.
+//
+// The above is too slow for anything but tests. With do_header_tracking (DEBUG_ALLOC_CHEAP) the Debug_Allocation
+// is instead placed in front of the pre dead zone and found from the pointer in O(1). The pre dead zone has the 
+// same size for every allocation so small underflows hit it and not the header, larger ones break the header checksum. Small blocks come from
+// slabs owned by the allocator. Alive allocations are kept in a dense slots array with a free list for leak checks 
+// and printing so freeing never touches other blocks. Dead zones are validated only when the block is reallocated
+// or freed, the full walk over all allocations is done only once per full_check_every*alive_count calls and new
+// memory is not filled. Allocations of at least guard_page_min_size get their own pages ending in a protected page, 
+// so any write past them faults on the spot instead of being found later.
+//
+//   allocated block from parent allocator (or own pages when guarded)
+//  +-------------------------------------------------------------------+
+//  | call stack | padding | Debug_Allocation | dead zone | USER DATA | dead zone | (guard page)
+//  +-----------------------------------------------------------------------------+
 
 #include "platform.h"
 #include "assert.h"
 #include "log.h"
 #include "allocator.h"
+#include "hash.h"
 #include "defines.h"
 #include "profile.h"
 #include <string.h>
 #include <stdlib.h>
 
 typedef struct Debug_Allocation {
-    struct Debug_Allocation* next;
-    struct Debug_Allocation* prev;
+    union {
+        struct Debug_Allocation* next;
+        uint64_t checksum; //header tracked allocations are not chained. Hash of the rest of the header so that overwrites of it are caught.
+    };
+    union {
+        struct Debug_Allocation* prev;
+        isize slot; //header tracked allocations are kept in Debug_Allocator.slots instead of the hash
+    };
 
     void* ptr;
     isize size;
@@ -46,6 +67,9 @@ typedef struct Debug_Allocation {
     uint16_t pre_dead_zone;
     uint16_t post_dead_zone;
     uint16_t call_stack_count;
+    uint32_t magic;  //only for header tracked allocations. Identifies the owning allocator.
+    uint16_t flags;
+    uint16_t pre_padding; //only for header tracked allocations. Bytes between the call stack and the header left from aligning the user data.
     uint64_t time;
     uint64_t id;
 } Debug_Allocation;
@@ -55,17 +79,20 @@ typedef struct Debug_Allocator_Options {
     isize pre_dead_zone_size;         //size in bytes of overwrite prevention dead zone. 
     isize post_dead_zone_size;        //size in bytes of overwrite prevention dead zone. 
     isize capture_stack_frames_count; //number of stack frames to capture on each allocation. 
+    isize guard_page_min_size;        //allocations at least this big are placed right before a protected page. 0 to disable. Only with do_header_tracking.
+    isize full_check_every;           //checks all allocations for overwrites once per n*alive_count calls so the cost per call stays constant. 0 to disable.
     bool do_printing;                 //prints all allocations/deallocation
     bool do_continual_checks;         //continually checks all allocations for overwrites
     bool do_deinit_leak_check;        //If the memory use on initialization and deinitialization does not match panics.
     bool do_set_as_default;           //set this allocator as default
-    bool _[4];
+    bool do_header_tracking;          //finds allocations in O(1) from a header in front of them instead of the hash and serves small blocks from slabs. Can only be set on init.
+    bool _[3];
 } Debug_Allocator_Options;
 
 //roughly one page big
 typedef struct Debug_Allocation_Block {
     struct Debug_Allocation_Block* next;
-    Debug_Allocation allocations[72];
+    Debug_Allocation allocations[63];
 } Debug_Allocation_Block;
 
 typedef struct Debug_Allocator {
@@ -89,6 +116,27 @@ typedef struct Debug_Allocator {
     isize reallocation_count;
 
     uint64_t last_id;
+    uint32_t magic;
+    bool is_header_tracking;
+    isize header_pre_dead_zone; //pre_dead_zone_size on init. Header tracked allocations are found through it so it cannot change.
+    isize calls_since_check;
+
+    //Alive header tracked allocations. Free slots are chained through the array as (next_free << 1) | 1
+    Debug_Allocation** slots;
+    isize slots_count;
+    isize slots_capacity;
+    isize slots_first_free; //index + 1 or 0 if none
+
+    //Slabs serving small header tracked allocations
+    void** slab_free_lists;
+    void* slab_chunks;
+    uint8_t* slab_from;
+    uint8_t* slab_to;
+
+    //Memory a header tracked allocation can live in, keyed by 64KB granule. The values are the starts of slab chunks
+    // with the lowest bit set, or the exact headers of blocks with their own memory. A header is read only after 
+    // the pointer was found to be in one of these, so foreign pointers are reported instead of crashing.
+    Hash regions;
     Allocator_Set allocator_backup;
 } Debug_Allocator;
 
@@ -99,6 +147,7 @@ typedef struct Debug_Allocator {
 #define DEBUG_ALLOC_CONTINUOUS          16 // do_continual_checks = true 
 #define DEBUG_ALLOC_PRINT               32 // do_printing = true 
 #define DEBUG_ALLOC_USE                 64 // do_set_as_default = true
+#define DEBUG_ALLOC_CHEAP               128 // do_header_tracking = true, guard_page_min_size = 64KB, full_check_every = 16
 
 //TODO: thread local list of debug allocators!
 
@@ -128,6 +177,15 @@ EXTERNAL void* debug_allocator_func(void* self, int mode, isize new_size, void*
 #define _DEBUG_ALLOCATOR_MAGIC_NUM8  0x9D //another one
 #define _DEBUG_ALLOCATOR_MAGIC_NUM64 0x9D9D9D9D9D9D9D9Dull
 
+#define _DEBUG_ALLOCATION_HEADER     1 //the Debug_Allocation is stored in front of the user data 
+#define _DEBUG_ALLOCATION_GUARDED    2 //the block are own pages followed by a protected guard page
+#define _DEBUG_ALLOCATION_SLAB       4 //the block is from the slabs of the allocator
+
+#define _DEBUG_SLAB_GRANULARITY      16
+#define _DEBUG_SLAB_MAX_SIZE         2048
+#define _DEBUG_SLAB_CHUNK_SIZE       (64*1024)
+#define _DEBUG_REGION_GRANULE_LOG2   16
+
 #ifndef INTERNAL
     #define INTERNAL inline static
 #endif
@@ -141,6 +199,14 @@ INTERNAL void _debug_allocator_check_consistency(const Debug_Allocator* self);
 INTERNAL void _debug_allocator_panic(const Debug_Allocator* self, void* user_ptr, const Debug_Allocation* allocation, isize dist, const char* panic_reason);
 INTERNAL void _debug_allocation_test_dead_zones(const Debug_Allocator* self, const Debug_Allocation* allocation);
 INTERNAL Debug_Allocation* _debug_allocation_get_closest(const Debug_Allocator* self, void* ptr, isize* dist_or_null);
+INTERNAL uint8_t* _debug_allocation_get_pre_dead_zone(const Debug_Allocation* allocation);
+INTERNAL uint64_t _debug_alloc_ptr_hash(void* ptr);
+INTERNAL uint64_t _debug_allocation_checksum(const Debug_Allocation* allocation);
+INTERNAL bool _debug_allocator_is_header_overwritten(const Debug_Allocator* self, void* ptr);
+INTERNAL Debug_Allocation* _debug_allocator_iterate(const Debug_Allocator* self, isize* index, const Debug_Allocation* curr);
+INTERNAL void* _debug_allocator_slab_push(Debug_Allocator* self, isize size, Allocator_Error* error);
+INTERNAL void _debug_allocator_slab_pop(Debug_Allocator* self, void* block, isize size);
+INTERNAL uint64_t _debug_region_key(const void* ptr);
 
 EXTERNAL void debug_allocator_init_options(Debug_Allocator* self, Allocator* parent, Allocator* internal, Debug_Allocator_Options options)
 {
@@ -153,9 +219,19 @@ EXTERNAL void debug_allocator_init_options(Debug_Allocator* self, Allocator* par
     self->options.pre_dead_zone_size = DIV_CEIL(self->options.pre_dead_zone_size, sizeof(uint64_t))*sizeof(uint64_t);
     self->options.post_dead_zone_size = DIV_CEIL(self->options.post_dead_zone_size, sizeof(uint64_t))*sizeof(uint64_t);
     self->alloc[0] = debug_allocator_func;
-
-    self->allocation_hash = ALLOCATE(self->internal_alloc, _DEBUG_ALLOC_HASH_SIZE, Debug_Allocation*);
-    memset(self->allocation_hash, 0, sizeof(Debug_Allocation*)*_DEBUG_ALLOC_HASH_SIZE);
+    self->is_header_tracking = options.do_header_tracking;
+    self->header_pre_dead_zone = self->is_header_tracking ? self->options.pre_dead_zone_size : 0;
+    self->magic = (uint32_t) _debug_alloc_ptr_hash(self) | 1;
+
+    if(self->is_header_tracking) {
+        self->slab_free_lists = ALLOCATE(self->internal_alloc, _DEBUG_SLAB_MAX_SIZE/_DEBUG_SLAB_GRANULARITY + 1, void*);
+        memset(self->slab_free_lists, 0, sizeof(void*)*(_DEBUG_SLAB_MAX_SIZE/_DEBUG_SLAB_GRANULARITY + 1));
+        hash_init(&self->regions, self->internal_alloc, 0);
+    }
+    else {
+        self->allocation_hash = ALLOCATE(self->internal_alloc, _DEBUG_ALLOC_HASH_SIZE, Debug_Allocation*);
+        memset(self->allocation_hash, 0, sizeof(Debug_Allocation*)*_DEBUG_ALLOC_HASH_SIZE);
+    }
 
     if(options.do_set_as_default)
         self->allocator_backup = allocator_set_default(self->alloc);
@@ -174,19 +250,26 @@ EXTERNAL void debug_allocator_deinit(Debug_Allocator* self)
         debug_allocator_print_alive_allocations(">DEBUG", LOG_FATAL, self, -1, DEBUG_ALLOC_PRINT_ALIVE_CALLSTACK | DEBUG_ALLOC_PRINT_ALIVE_TIME);
         PANIC("debug allocator%s%s reported failure '%s'", name ? "name: " : "", name, "memory leaked");
     }
-    if(self->allocation_hash) {
-        for(isize i = 0; i < _DEBUG_ALLOC_HASH_SIZE; i++) {
-            for(Debug_Allocation* curr = self->allocation_hash[i]; curr; ) {
-                ASSERT(curr->size != -1);
-                Debug_Allocation* next = curr->next;
-                _debug_allocation_test_dead_zones(self, curr);
-                _debug_allocator_deallocate_allocation(self, curr);
-                curr = next;
-            }
-        }
+    //The hash allocations live in the blocks below so they can still be iterated after deallocation. The slots dont need to.
+    isize iter = 0;
+    for(Debug_Allocation* curr = NULL; (curr = _debug_allocator_iterate(self, &iter, curr)) != NULL; ) {
+        ASSERT(curr->size != -1);
+        _debug_allocation_test_dead_zones(self, curr);
+        _debug_allocator_deallocate_allocation(self, curr);
+    }
 
+    if(self->allocation_hash) 
         DEALLOCATE(self->internal_alloc, self->allocation_hash, _DEBUG_ALLOC_HASH_SIZE, Debug_Allocation*);
+    if(self->slots)
+        DEALLOCATE(self->internal_alloc, self->slots, self->slots_capacity, Debug_Allocation*);
+    if(self->slab_free_lists)
+        DEALLOCATE(self->internal_alloc, self->slab_free_lists, _DEBUG_SLAB_MAX_SIZE/_DEBUG_SLAB_GRANULARITY + 1, void*);
+    for(void* chunk = self->slab_chunks; chunk; ) {
+        void* next = *(void**) chunk;
+        allocator_deallocate(self->parent_alloc, chunk, _DEBUG_SLAB_CHUNK_SIZE, _DEBUG_SLAB_GRANULARITY);
+        chunk = next;
     }
+    hash_deinit(&self->regions);
 
     for(Debug_Allocation_Block* curr = self->allocation_blocks; curr; ) {
         Debug_Allocation_Block* next = curr->next;
@@ -222,6 +305,11 @@ EXTERNAL void debug_allocator_init(Debug_Allocator* allocator, Allocator* parent
     }
     if(flags & DEBUG_ALLOC_CAPTURE_CALLSTACK)
         options.capture_stack_frames_count = 16;
+    if(flags & DEBUG_ALLOC_CHEAP) {
+        options.do_header_tracking = true;
+        options.guard_page_min_size = 64*1024;
+        options.full_check_every = 16;
+    }
     
     debug_allocator_init_options(allocator, parent, parent, options);
 }
@@ -236,7 +324,8 @@ EXTERNAL Debug_Allocator debug_allocator_make(Allocator* parent, uint64_t flags)
 
 EXTERNAL void** debug_allocation_get_callstack(const Debug_Allocation* self)
 {
-    uint8_t* ptr = (uint8_t*) self->ptr - self->pre_dead_zone - self->call_stack_count*sizeof(void*);
+    isize header_size = self->flags & _DEBUG_ALLOCATION_HEADER ? sizeof(Debug_Allocation) : 0;
+    uint8_t* ptr = _debug_allocation_get_pre_dead_zone(self) - header_size - self->pre_padding - self->call_stack_count*sizeof(void*);
     return (void**) ptr;
 }
 
@@ -260,6 +349,12 @@ EXTERNAL void* debug_allocator_func(void* self_void, int mode, isize new_size, v
         if(old_ptr != NULL)
         {
             old_alloc = _debug_allocator_find_allocation(self, old_ptr);
+            if(old_alloc == NULL && _debug_allocator_is_header_overwritten(self, old_ptr)) {
+                LOG_FATAL("DEBUG", "debug allocator%s%s found the header of allocation 0x%016llx overwritten", 
+                    name ? "name: " : "", name, (llu) old_ptr);
+                _debug_allocator_panic(self, old_ptr, NULL, 0, "overwrite before block");
+            }
+
             if(old_alloc == NULL) {
                 LOG_FATAL("DEBUG", "%s%s%s no allocation at 0x%016llx", 
                     name ? "name: " : "", name, (llu) old_ptr);
@@ -296,22 +391,71 @@ EXTERNAL void* debug_allocator_func(void* self_void, int mode, isize new_size, v
         uint8_t* out_ptr = NULL;
         if(new_size > 0)
         {
-            isize preamble_size = self->options.pre_dead_zone_size + self->options.capture_stack_frames_count*sizeof(void*);
+            //Header tracked allocations need the header aligned so overalign the user data if needed
+            isize header_size = self->is_header_tracking ? (isize) sizeof(Debug_Allocation) : 0;
+            isize block_align = self->is_header_tracking ? MAX(align, (isize) sizeof(uint64_t)) : align;
+            isize pre_dead_zone_size = self->is_header_tracking ? self->header_pre_dead_zone : self->options.pre_dead_zone_size;
+            isize preamble_size = pre_dead_zone_size + self->options.capture_stack_frames_count*sizeof(void*) + header_size;
             isize postamble_size = self->options.post_dead_zone_size;
-            isize new_total_size = preamble_size + postamble_size + align + new_size;
-            uint8_t* new_block_ptr = (uint8_t*) allocator_try_reallocate(self->parent_alloc, new_total_size, NULL, 0, DEF_ALIGN, (Allocator_Error*) rest);
+            isize new_total_size = preamble_size + postamble_size + block_align + new_size;
+            uint32_t block_flags = 0;
+            uint8_t* new_block_ptr = NULL;
+
+            //Guarded allocations end right before a protected page so any write past them faults. 
+            // If we cannot get the pages we fallback to the parent allocator.
+            isize page_size = 0;
+            if(self->is_header_tracking && self->options.guard_page_min_size > 0 && new_size >= self->options.guard_page_min_size 
+                && block_align <= (page_size = platform_page_size()))
+            {
+                isize data_size = DIV_CEIL(preamble_size + block_align + new_size, page_size)*page_size;
+                if(platform_virtual_reallocate((void**) &new_block_ptr, NULL, data_size + page_size, PLATFORM_VIRTUAL_ALLOC_RESERVE | PLATFORM_VIRTUAL_ALLOC_COMMIT, PLATFORM_MEMORY_PROT_READ_WRITE) == 0) {
+                    platform_virtual_reallocate(NULL, new_block_ptr + data_size, page_size, PLATFORM_VIRTUAL_ALLOC_COMMIT, PLATFORM_MEMORY_PROT_NO_ACCESS);
+                    new_total_size = data_size;
+                    block_flags = _DEBUG_ALLOCATION_GUARDED;
+                    out_ptr = (uint8_t*) align_backward(new_block_ptr + data_size - new_size, block_align);
+                }
+                else
+                    new_block_ptr = NULL;
+            }
+
             if(new_block_ptr == NULL)
             {
-                PROFILE_STOP();
-                return NULL;
+                if(self->is_header_tracking && new_total_size <= _DEBUG_SLAB_MAX_SIZE) {
+                    new_block_ptr = (uint8_t*) _debug_allocator_slab_push(self, new_total_size, (Allocator_Error*) rest);
+                    block_flags = _DEBUG_ALLOCATION_SLAB;
+                }
+                else
+                    new_block_ptr = (uint8_t*) allocator_try_reallocate(self->parent_alloc, new_total_size, NULL, 0, DEF_ALIGN, (Allocator_Error*) rest);
+
+                if(new_block_ptr == NULL)
+                {
+                    PROFILE_STOP();
+                    return NULL;
+                }
+                out_ptr = (uint8_t*) align_forward(new_block_ptr + preamble_size, block_align);
             }
 
-            out_ptr = (uint8_t*) align_forward(new_block_ptr + preamble_size, align);
+            //Alignment padding is part of the pre dead zone except for header tracked allocations
+            // which need the header at a fixed distance from the user data. There it is left before the header.
             void**   callstack = (void**) (void*) new_block_ptr;
-            uint8_t* pre_dead_zone = (uint8_t*) (void*) (callstack + self->options.capture_stack_frames_count); 
+            uint8_t* callstack_end = (uint8_t*) (void*) (callstack + self->options.capture_stack_frames_count); 
+            uint8_t* pre_dead_zone = self->is_header_tracking ? out_ptr - pre_dead_zone_size : callstack_end;
             uint8_t* post_dead_zone = out_ptr + new_size;
              
-            new_alloc = _debug_allocator_get_new_allocation(self);
+            if(self->is_header_tracking) {
+                new_alloc = (Debug_Allocation*) (void*) (pre_dead_zone - header_size);
+                memset(new_alloc, 0, sizeof *new_alloc);
+                new_alloc->magic = self->magic;
+                new_alloc->flags = (uint16_t) (_DEBUG_ALLOCATION_HEADER | block_flags);
+                new_alloc->pre_padding = (uint16_t) ((uint8_t*) new_alloc - callstack_end);
+                if(block_flags != _DEBUG_ALLOCATION_SLAB)
+                    hash_insert(&self->regions, _debug_region_key(new_alloc), (uintptr_t) new_alloc);
+            }
+            else {
+                new_alloc = _debug_allocator_get_new_allocation(self);
+                new_alloc->time = platform_epoch_time();
+            }
+
             new_alloc->ptr = out_ptr;
             new_alloc->align = (uint16_t) align;
             new_alloc->size = new_size;
@@ -319,18 +463,19 @@ EXTERNAL void* debug_allocator_func(void* self_void, int mode, isize new_size, v
             new_alloc->id = self->last_id++;
             new_alloc->pre_dead_zone = (uint16_t) (out_ptr - pre_dead_zone);
             new_alloc->post_dead_zone = (uint16_t) (new_block_ptr + new_total_size - post_dead_zone);
-            new_alloc->time = platform_epoch_time();
 
             if(new_alloc->call_stack_count > 0)
                 platform_capture_call_stack(callstack, new_alloc->call_stack_count, 1);
 
-            ASSERT(new_block_ptr <= pre_dead_zone && pre_dead_zone + new_alloc->pre_dead_zone <= out_ptr);
+            ASSERT(new_block_ptr <= callstack_end && callstack_end + new_alloc->pre_padding + header_size + new_alloc->pre_dead_zone == out_ptr);
             ASSERT(out_ptr + new_size <= post_dead_zone && post_dead_zone + new_alloc->post_dead_zone <= new_block_ptr + new_total_size);
+            ASSERT(_debug_allocation_get_pre_dead_zone(new_alloc) == pre_dead_zone);
 
             isize min_size = new_size < old_size ? new_size : old_size;
             memset(pre_dead_zone,  _DEBUG_ALLOCATOR_MAGIC_NUM8, (size_t) new_alloc->pre_dead_zone);
             if(old_ptr) memcpy(out_ptr, old_ptr, (size_t) min_size);
-            memset(out_ptr + min_size, _DEBUG_ALLOCATOR_FILL_NUM8, (size_t) (new_size - min_size)); 
+            if(self->is_header_tracking == false)
+                memset(out_ptr + min_size, _DEBUG_ALLOCATOR_FILL_NUM8, (size_t) (new_size - min_size)); 
             memset(post_dead_zone, _DEBUG_ALLOCATOR_MAGIC_NUM8, (size_t) new_alloc->post_dead_zone);
             
             _debug_allocator_insert_allocation(self, new_alloc);
@@ -339,10 +484,16 @@ EXTERNAL void* debug_allocator_func(void* self_void, int mode, isize new_size, v
             #endif
         }
     
-        //dealloc old ptr
+        //dealloc old ptr. Header tracked allocations live inside the block so they must be unlinked first.
         if(old_size != 0) {
-            _debug_allocator_deallocate_allocation(self, old_alloc);
-            _debug_allocator_remove_allocation(self, old_alloc);
+            if(self->is_header_tracking) {
+                _debug_allocator_remove_allocation(self, old_alloc);
+                _debug_allocator_deallocate_allocation(self, old_alloc);
+            }
+            else {
+                _debug_allocator_deallocate_allocation(self, old_alloc);
+                _debug_allocator_remove_allocation(self, old_alloc);
+            }
         }
     
         self->bytes_allocated += new_size - old_size;
@@ -367,6 +518,10 @@ EXTERNAL void* debug_allocator_func(void* self_void, int mode, isize new_size, v
         #else
             if(self->options.do_continual_checks)
                 debug_allocator_test_all_allocations(self->alloc);
+            else if(self->options.full_check_every > 0 && ++self->calls_since_check >= self->options.full_check_every*MAX(self->alive_count, 1)) {
+                self->calls_since_check = 0;
+                debug_allocator_test_all_allocations(self->alloc);
+            }
         #endif
 
         PROFILE_STOP();
@@ -401,6 +556,84 @@ INTERNAL uint64_t _debug_alloc_ptr_hash(void* ptr)
     return x;
 }
 
+INTERNAL uint64_t _debug_region_key(const void* ptr) 
+{
+    return _debug_alloc_ptr_hash((void*) ((uintptr_t) ptr >> _DEBUG_REGION_GRANULE_LOG2));
+}
+
+//Returns the alive allocation after curr or the first one if curr is NULL. Returns NULL once all were iterated.
+// index must be 0 for the first call.
+INTERNAL Debug_Allocation* _debug_allocator_iterate(const Debug_Allocator* self, isize* index, const Debug_Allocation* curr)
+{
+    if(self->is_header_tracking) {
+        while(*index < self->slots_count) {
+            Debug_Allocation* slot = self->slots[(*index)++];
+            if(((uintptr_t) slot & 1) == 0)
+                return slot;
+        }
+        return NULL;
+    }
+
+    if(curr && curr->next)
+        return curr->next;
+
+    if(self->allocation_hash)
+        while(*index < _DEBUG_ALLOC_HASH_SIZE) {
+            Debug_Allocation* first = self->allocation_hash[(*index)++];
+            if(first)
+                return first;
+        }
+    return NULL;
+}
+
+//Small blocks of header tracked allocations are served from per size class free lists over chunks from the parent.
+// Unlike most general purpose allocators this costs the same for all sizes so the size overhead of 
+// headers and dead zones does not push the allocations into slower paths. Chunks are only freed on deinit.
+INTERNAL void* _debug_allocator_slab_push(Debug_Allocator* self, isize size, Allocator_Error* error)
+{
+    isize class_i = DIV_CEIL(size, _DEBUG_SLAB_GRANULARITY);
+    void** free_list = &self->slab_free_lists[class_i];
+    if(*free_list) {
+        void* out = *free_list;
+        *free_list = *(void**) out;
+        return out;
+    }
+
+    //The rest of the current chunk is wasted which is at most _DEBUG_SLAB_MAX_SIZE per chunk
+    isize class_size = class_i*_DEBUG_SLAB_GRANULARITY;
+    if(self->slab_to - self->slab_from < class_size) {
+        uint8_t* chunk = (uint8_t*) allocator_try_reallocate(self->parent_alloc, _DEBUG_SLAB_CHUNK_SIZE, NULL, 0, _DEBUG_SLAB_GRANULARITY, error);
+        if(chunk == NULL)
+            return NULL;
+
+        *(void**) (void*) chunk = self->slab_chunks;
+        self->slab_chunks = chunk;
+        self->slab_from = chunk + _DEBUG_SLAB_GRANULARITY;
+        self->slab_to = chunk + _DEBUG_SLAB_CHUNK_SIZE;
+
+        //A chunk is at most one granule big so it touches at most two
+        hash_insert(&self->regions, _debug_region_key(chunk), (uintptr_t) chunk | 1);
+        if(_debug_region_key(chunk) != _debug_region_key(chunk + _DEBUG_SLAB_CHUNK_SIZE - 1))
+            hash_insert(&self->regions, _debug_region_key(chunk + _DEBUG_SLAB_CHUNK_SIZE - 1), (uintptr_t) chunk | 1);
+    }
+
+    void* out = self->slab_from;
+    self->slab_from += class_size;
+    return out;
+}
+
+INTERNAL void _debug_allocator_slab_pop(Debug_Allocator* self, void* block, isize size)
+{
+    void** free_list = &self->slab_free_lists[DIV_CEIL(size, _DEBUG_SLAB_GRANULARITY)];
+    *(void**) block = *free_list;
+    *free_list = block;
+}
+
+INTERNAL uint8_t* _debug_allocation_get_pre_dead_zone(const Debug_Allocation* allocation)
+{
+    return (uint8_t*) allocation->ptr - allocation->pre_dead_zone;
+}
+
 INTERNAL Debug_Allocation* _debug_allocator_get_new_allocation(Debug_Allocator* self)
 {
     if(self->allocation_first_free == NULL)
@@ -426,23 +659,64 @@ INTERNAL Debug_Allocation* _debug_allocator_get_new_allocation(Debug_Allocator*
 
 INTERNAL void _debug_allocator_insert_allocation(Debug_Allocator* self, Debug_Allocation* allocation)
 {
-    uint64_t hash = _debug_alloc_ptr_hash(allocation->ptr);
-    uint64_t bucket_i = hash % _DEBUG_ALLOC_HASH_SIZE;
+    ASSERT(self->alive_count >= 0);
+    self->alive_count += 1;
+    if(self->is_header_tracking) {
+        if(self->slots_first_free > 0) {
+            allocation->slot = self->slots_first_free - 1;
+            self->slots_first_free = (isize) ((uintptr_t) self->slots[allocation->slot] >> 1);
+        }
+        else {
+            if(self->slots_count >= self->slots_capacity) {
+                isize new_capacity = MAX(self->slots_capacity*2, 64);
+                self->slots = REALLOCATE(self->internal_alloc, new_capacity, self->slots, self->slots_capacity, Debug_Allocation*);
+                self->slots_capacity = new_capacity;
+            }
+            allocation->slot = self->slots_count++;
+        }
+        
+        self->slots[allocation->slot] = allocation;
+        allocation->checksum = _debug_allocation_checksum(allocation);
+        return;
+    }
+
+    uint64_t bucket_i = _debug_alloc_ptr_hash(allocation->ptr) % _DEBUG_ALLOC_HASH_SIZE;
     Debug_Allocation** bucket = &self->allocation_hash[bucket_i];
     if(*bucket) 
         (*bucket)->prev = allocation;
     
     allocation->next = *bucket;
     *bucket = allocation;
-
-    ASSERT(self->alive_count >= 0);
-    self->alive_count += 1;
 }
 
 INTERNAL Debug_Allocation* _debug_allocator_find_allocation(const Debug_Allocator* self, void* ptr)
 {
-    uint64_t hash = _debug_alloc_ptr_hash(ptr);
-    uint64_t bucket_i = hash % _DEBUG_ALLOC_HASH_SIZE;
+    //Only read the header when the pointer could have one. A header which does not point back 
+    // or does not belong to us means an invalid pointer or an overwrite before the block.
+    if(self->is_header_tracking) {
+        if((uintptr_t) ptr % sizeof(uint64_t) != 0)
+            return NULL;
+
+        Debug_Allocation* header = (Debug_Allocation*) (void*) ((uint8_t*) ptr - self->header_pre_dead_zone - sizeof(Debug_Allocation));
+        bool is_ours = false;
+        for(Hash_Iter it = {0}; hash_iterate(&self->regions, _debug_region_key(header), &it); ) {
+            uintptr_t value = (uintptr_t) it.entry->value;
+            uintptr_t chunk = value & ~(uintptr_t) 1;
+            if(value == (uintptr_t) header 
+                || ((value & 1) && chunk <= (uintptr_t) header && (uintptr_t) (header + 1) <= chunk + _DEBUG_SLAB_CHUNK_SIZE)) {
+                is_ours = true;
+                break;
+            }
+        }
+
+        if(is_ours == false 
+            || header->magic != self->magic || header->ptr != ptr || (header->flags & _DEBUG_ALLOCATION_HEADER) == 0 
+            || header->checksum != _debug_allocation_checksum(header))
+            return NULL;
+        return header;
+    }
+
+    uint64_t bucket_i = _debug_alloc_ptr_hash(ptr) % _DEBUG_ALLOC_HASH_SIZE;
     Debug_Allocation** bucket = &self->allocation_hash[bucket_i];
     for(Debug_Allocation* curr = *bucket; curr; curr = curr->next)
         if(curr->ptr == ptr)
@@ -451,8 +725,41 @@ INTERNAL Debug_Allocation* _debug_allocator_find_allocation(const Debug_Allocato
     return NULL;
 }
 
+INTERNAL uint64_t _debug_allocation_checksum(const Debug_Allocation* allocation)
+{
+    uint64_t words[sizeof(Debug_Allocation)/sizeof(uint64_t)] = {0};
+    memcpy(words, allocation, sizeof words);
+    uint64_t hash = 0;
+    for(isize i = 1; i < ARRAY_COUNT(words); i++)
+        hash = (hash ^ words[i])*(uint64_t) 0x9E3779B97F4A7C15;
+    return hash ^ (hash >> 29);
+}
+
+//Returns true if ptr belongs to an alive header tracked allocation even though its header does not check out. 
+// Walks all allocations so is only used for reporting.
+INTERNAL bool _debug_allocator_is_header_overwritten(const Debug_Allocator* self, void* ptr)
+{
+    if(self->is_header_tracking == false)
+        return false;
+
+    uint8_t* header = (uint8_t*) ptr - self->header_pre_dead_zone - sizeof(Debug_Allocation);
+    for(isize i = 0; i < self->slots_count; i++)
+        if((uint8_t*) self->slots[i] == header)
+            return true;
+    return false;
+}
+
 INTERNAL void _debug_allocator_remove_allocation(Debug_Allocator* self, Debug_Allocation* allocation)
 {
+    self->alive_count -= 1;
+    ASSERT(self->alive_count >= 0);
+    if(self->is_header_tracking) {
+        ASSERT(0 <= allocation->slot && allocation->slot < self->slots_count && self->slots[allocation->slot] == allocation);
+        self->slots[allocation->slot] = (Debug_Allocation*) (((uintptr_t) self->slots_first_free << 1) | 1);
+        self->slots_first_free = allocation->slot + 1;
+        return;
+    }
+
     if(allocation->next)
         allocation->next->prev = allocation->prev;
         
@@ -478,17 +785,27 @@ INTERNAL void _debug_allocator_remove_allocation(Debug_Allocator* self, Debug_Al
     allocation->prev = NULL;
     allocation->next = self->allocation_first_free;
     self->allocation_first_free = allocation;
-    
-    self->alive_count -= 1;
-    ASSERT(self->alive_count >= 0);
 }
 
 
 INTERNAL void _debug_allocator_deallocate_allocation(Debug_Allocator* self, Debug_Allocation* allocation)
 {
     void* block = debug_allocation_get_callstack(allocation);
-    isize total_size = sizeof(void*)*allocation->call_stack_count + allocation->pre_dead_zone + allocation->size + allocation->post_dead_zone;
-    allocator_deallocate(self->parent_alloc, block, total_size, DEF_ALIGN);
+    uint32_t flags = allocation->flags;
+    isize header_size = flags & _DEBUG_ALLOCATION_HEADER ? sizeof(Debug_Allocation) : 0;
+    isize total_size = sizeof(void*)*allocation->call_stack_count + allocation->pre_padding + header_size + allocation->pre_dead_zone + allocation->size + allocation->post_dead_zone;
+    
+    //Catch double frees of header tracked allocations at least until the memory is reused
+    allocation->magic = 0;
+    if((flags & _DEBUG_ALLOCATION_HEADER) && (flags & _DEBUG_ALLOCATION_SLAB) == 0)
+        hash_remove_with_value(&self->regions, _debug_region_key(allocation), (uintptr_t) allocation);
+
+    if(flags & _DEBUG_ALLOCATION_GUARDED)
+        platform_virtual_reallocate(NULL, block, total_size + platform_page_size(), PLATFORM_VIRTUAL_ALLOC_RELEASE, PLATFORM_MEMORY_PROT_NO_ACCESS);
+    else if(flags & _DEBUG_ALLOCATION_SLAB)
+        _debug_allocator_slab_pop(self, block, total_size);
+    else
+        allocator_deallocate(self->parent_alloc, block, total_size, DEF_ALIGN);
 }
 
 #include <time.h>
@@ -500,12 +817,14 @@ INTERNAL void _debug_allocator_panic(const Debug_Allocator* self, void* user_ptr
         else    
             LOG_FATAL("DEBUG", "Printing closest allocation to ptr 0x%016llx. Allocation 0x%016llx (%lliB away):", (llu) user_ptr, (llu) allocation->ptr, (lli) dist);
 
-        time_t epoch_time_secs = allocation->time / 1000000;
-        struct tm local_time = *localtime(&epoch_time_secs);
         LOG_FATAL(">DEBUG", "size : %s (%lliB)", format_bytes(allocation->size).data, (lli) allocation->size);
         LOG_FATAL(">DEBUG", "align: %lli", (lli) allocation->align);
         LOG_FATAL(">DEBUG", "id   : %lli", (lli) allocation->id);
-        LOG_FATAL(">DEBUG", "time : %02i:%02i:%02i", local_time.tm_hour, local_time.tm_min, local_time.tm_sec);
+        if(allocation->time) {
+            time_t epoch_time_secs = allocation->time / 1000000;
+            struct tm local_time = *localtime(&epoch_time_secs);
+            LOG_FATAL(">DEBUG", "time : %02i:%02i:%02i", local_time.tm_hour, local_time.tm_min, local_time.tm_sec);
+        }
         if(allocation->call_stack_count) {
             void** callstack = debug_allocation_get_callstack(allocation);
             LOG_FATAL(">DEBUG", "callstack:");
@@ -518,27 +837,37 @@ INTERNAL void _debug_allocator_panic(const Debug_Allocator* self, void* user_ptr
 
 INTERNAL void _debug_allocation_test_dead_zones(const Debug_Allocator* self, const Debug_Allocation* allocation)
 {
-    uint8_t* pre_dead_zone = (uint8_t*) allocation->ptr - allocation->pre_dead_zone;
+    if((allocation->flags & _DEBUG_ALLOCATION_HEADER) && allocation->checksum != _debug_allocation_checksum(allocation)) {
+        LOG_FATAL("DEBUG", "debug allocator%s%s found the header of allocation 0x%016llx overwritten", 
+            self->options.name ? "name: " : "", self->options.name, (llu) allocation->ptr);
+        _debug_allocator_panic(self, allocation->ptr, NULL, 0, "overwrite before block");
+    }
+
+    uint8_t* pre_dead_zone = _debug_allocation_get_pre_dead_zone(allocation);
     uint8_t* post_dead_zone = (uint8_t*) allocation->ptr + allocation->size;
 
-    uint64_t* pre_aligned = (uint64_t*) pre_dead_zone;
-    uint64_t* post_aligned = (uint64_t*) align_forward(post_dead_zone, sizeof(uint64_t));
+    //The post dead zone might end right at a guard page so we must not read past it. 
+    // When it is shorter than the bytes to the next 8 byte boundary (such as when it is empty) it is checked bytewise only.
+    uint64_t* pre_aligned = (uint64_t*) (void*) pre_dead_zone;
+    uint32_t rem = (uint32_t) ((uint8_t*) align_forward(post_dead_zone, sizeof(uint64_t)) - post_dead_zone);
+    rem = MIN(rem, allocation->post_dead_zone);
+    uint64_t* post_aligned = (uint64_t*) (void*) (post_dead_zone + rem);
 
     ASSERT((uintptr_t) pre_aligned % sizeof(uint64_t) == 0);
-    ASSERT((uintptr_t) post_aligned % sizeof(uint64_t) == 0);
-    uint32_t rem = (uint32_t) ((uint8_t*) post_aligned - post_dead_zone);
+    ASSERT(rem == allocation->post_dead_zone || (uintptr_t) post_aligned % sizeof(uint64_t) == 0);
 
     for(uint32_t i = 0; i < allocation->pre_dead_zone/sizeof(uint64_t); i++)
         if(pre_aligned[i] != _DEBUG_ALLOCATOR_MAGIC_NUM64)
             goto has_fault;
             
     for(uint32_t i = 0; i < rem; i++)
-        if(pre_dead_zone[i] != _DEBUG_ALLOCATOR_MAGIC_NUM8)
+        if(post_dead_zone[i] != _DEBUG_ALLOCATOR_MAGIC_NUM8)
             goto has_fault;
 
-    for(uint32_t i = 0; i < allocation->post_dead_zone/sizeof(uint64_t); i++)
-        if(post_aligned[i] != _DEBUG_ALLOCATOR_MAGIC_NUM64)
-            goto has_fault;
+    if(rem < allocation->post_dead_zone)
+        for(uint32_t i = 0; i < (allocation->post_dead_zone - rem)/sizeof(uint64_t); i++)
+            if(post_aligned[i] != _DEBUG_ALLOCATOR_MAGIC_NUM64)
+                goto has_fault;
 
     return;
 
@@ -626,22 +955,20 @@ INTERNAL Debug_Allocation* _debug_allocation_get_closest(const Debug_Allocator*
     Debug_Allocation* closest = NULL;
     isize closest_dist = INT64_MAX;
     
-    if(self->allocation_hash)
-        for(isize i = 0; i < _DEBUG_ALLOC_HASH_SIZE; i++) {
-            for(Debug_Allocation* curr = self->allocation_hash[i]; curr; curr = curr->next) {
-                isize dist = (ptrdiff_t) curr->ptr - (ptrdiff_t) ptr;
-                if(dist < 0)
-                    dist = -dist;
-            
-                if(closest_dist > dist) {
-                    closest_dist = dist;
-                    closest = curr;
-                }
-            }
+    isize iter = 0;
+    for(Debug_Allocation* curr = NULL; (curr = _debug_allocator_iterate(self, &iter, curr)) != NULL; ) {
+        isize dist = (ptrdiff_t) curr->ptr - (ptrdiff_t) ptr;
+        if(dist < 0)
+            dist = -dist;
+    
+        if(closest_dist > dist) {
+            closest_dist = dist;
+            closest = curr;
         }
+    }
 
     if(dist_or_null)
-        *dist_or_null = (ptrdiff_t) ptr - (ptrdiff_t) closest;
+        *dist_or_null = closest ? (ptrdiff_t) ptr - (ptrdiff_t) closest->ptr : 0;
     return closest;
 }
 
@@ -652,13 +979,11 @@ EXTERNAL void debug_allocator_test_all_allocations(const Allocator* self_alloc)
 
     const Debug_Allocator* self = (const Debug_Allocator*) (void*) self_alloc;
     isize size_sum = 0;
-    if(self->allocation_hash)
-        for(isize i = 0; i < _DEBUG_ALLOC_HASH_SIZE; i++) {
-            for(Debug_Allocation* curr = self->allocation_hash[i]; curr; curr = curr->next) {
-                _debug_allocation_test_dead_zones(self, curr);
-                size_sum += curr->size;
-            }
-        }
+    isize iter = 0;
+    for(Debug_Allocation* curr = NULL; (curr = _debug_allocator_iterate(self, &iter, curr)) != NULL; ) {
+        _debug_allocation_test_dead_zones(self, curr);
+        size_sum += curr->size;
+    }
 
     TEST(size_sum == self->bytes_allocated);
     TEST(size_sum <= self->max_bytes_allocated);
@@ -716,15 +1041,9 @@ EXTERNAL Debug_Allocation* debug_allocator_get_alive_allocations(const Debug_All
     
     Debug_Allocation* allocations = (Debug_Allocation*) allocator_allocate(alloc_result_from, sizeof(Debug_Allocation)*alloc_count, DEF_ALIGN);
     isize curr_count = 0;
-    
-    if(self->allocation_hash)
-        for(isize i = 0; i < _DEBUG_ALLOC_HASH_SIZE; i++) {
-            for(Debug_Allocation* curr = self->allocation_hash[i]; curr; curr = curr->next) {
-                allocations[curr_count++] = *curr;
-                if(curr_count >= alloc_count)
-                    break;
-            }
-        }
+    isize iter = 0;
+    for(Debug_Allocation* curr = NULL; curr_count < alloc_count && (curr = _debug_allocator_iterate(self, &iter, curr)) != NULL; ) 
+        allocations[curr_count++] = *curr;
     
     qsort(allocations, alloc_count, sizeof *allocations, _debug_allocation_alloc_id_compare);
     *count = alloc_count;
@@ -749,7 +1068,7 @@ EXTERNAL void debug_allocator_print_alive_allocations(const char* name, Log_Type
         Debug_Allocation curr = alive[i];
 
         char time_buffer[16] = "";
-        if(flags & DEBUG_ALLOC_PRINT_ALIVE_TIME) {
+        if((flags & DEBUG_ALLOC_PRINT_ALIVE_TIME) && curr.time) {
             time_t epoch_time_secs = curr.time / 1000000;
             struct tm local_time = *localtime(&epoch_time_secs);
             snprintf(time_buffer, sizeof time_buffer, " time:%02i:%02i:%02i", local_time.tm_hour, local_time.tm_min, local_time.tm_sec);
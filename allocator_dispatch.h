@@ -0,0 +1,56 @@
+#ifndef MODULE_ALLOCATOR_DISPATCH
+#define MODULE_ALLOCATOR_DISPATCH
+
+// Containers (Array, String_Builder, Hash, Map) obtain all of their memory through the ALLOCATOR_DISPATCH macro
+// which by default is a plain call through the Allocator function pointer. That call cannot be inlined even
+// when the allocator is an Arena or a Scratch so every growth pays for the indirect call, the allocator function
+// and its checks just to bump a pointer.
+//
+// Including this header before the containers redefines ALLOCATOR_DISPATCH to allocator_dispatch. It compares
+// the function pointer against the bump allocators known here and serves them with their inline push. Only pushes
+// which need something unusual (committing memory, scratch fall/rise, errors) go through the usual slow path.
+// All other allocators are called just like before.
+//
+// The macro is expanded where the containers are implemented so this header has to be included before any of
+// their implementations. Including it later is a compile error instead of silently keeping the plain call.
+
+#include "allocator.h"
+#include "arena.h"
+#include "scratch.h"
+
+ATTRIBUTE_INLINE_ALWAYS static void* allocator_dispatch(Allocator* alloc, isize new_size, void* old_ptr, isize old_size, isize align)
+{
+    Allocator func = *alloc;
+    if(func == scratch_allocator_func) {
+        //Same as scratch_allocator_func except that deallocations dont push anything.
+        // The memory is reclaimed when the scratch is released either way.
+        if(new_size <= 0)
+            return NULL;
+
+        void* out = scratch_push_nonzero_inline((Scratch*) (void*) alloc, new_size, align, NULL);
+        if(out && old_size > 0)
+            memcpy(out, old_ptr, (size_t) MIN(old_size, new_size));
+        return out;
+    }
+
+    if(func == arena_allocator_func) {
+        //The single allocation of an arena always starts at data so growing never copies.
+        Arena* arena = (Arena*) (void*) alloc;
+        REQUIRE(old_ptr == arena->data || old_size == 0);
+        REQUIRE(old_size == arena->used_to - arena->data);
+
+        arena->used_to = arena->data;
+        return arena_push_nonzero_inline(arena, new_size, align, NULL);
+    }
+
+    return func(alloc, ALLOCATOR_MODE_ALLOC, new_size, old_ptr, old_size, align, NULL);
+}
+
+#if defined(MODULE_HAS_IMPL_ARRAY) || defined(MODULE_HAS_IMPL_STRING) || defined(MODULE_HAS_IMPL_HASH) || defined(MODULE_HAS_IMPL_MAP)
+    #error "allocator_dispatch.h must be included before the implementation of array.h, string.h, hash.h and map.h"
+#endif
+
+#undef ALLOCATOR_DISPATCH
+#define ALLOCATOR_DISPATCH(alloc, new_size, old_ptr, old_size, align) allocator_dispatch((alloc), (new_size), (old_ptr), (old_size), (align))
+
+#endif
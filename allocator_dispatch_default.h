@@ -0,0 +1,12 @@
+#ifndef MODULE_ALLOCATOR_DISPATCH_DEFAULT
+#define MODULE_ALLOCATOR_DISPATCH_DEFAULT
+
+// Containers (Array, String_Builder, Hash, Map) call their allocator through ALLOCATOR_DISPATCH. This file
+// only holds its default which is a plain call through the Allocator function pointer. allocator_dispatch.h 
+// redefines it to serve Arena and Scratch inline. Freestanding so the containers can include it.
+
+#ifndef ALLOCATOR_DISPATCH
+    #define ALLOCATOR_DISPATCH(alloc, new_size, old_ptr, old_size, align) (*(alloc))((alloc), 0, (new_size), (old_ptr), (old_size), (align), NULL)
+#endif
+
+#endif
@@ -9,17 +9,38 @@
 // 
 // The main purpose of Tracking_Allocator is to be a quick substitute until more complex allocators are built.
 // Tracking_Allocator also exposes a malloc like interface for some basic control over allocations
+//
+// With TRACKING_ALLOCATOR_INIT_SITES it also attributes every allocation to its Allocator_Site (file, line and label 
+// captured by the ALLOCATE macros, see allocator.h). The file and line are only captured when ALLOCATOR_SITES is defined 
+// for the whole program, otherwise allocations are attributed to their label alone. This answers "who holds the memory" for the price of a few ns per 
+// allocation instead of the callstack capture Debug_Allocator would need. The site index lives in the 24B header and 
+// the live bytes are counted in per thread counters which are only merged when a report is requested. The sites and 
+// counters are process wide so all Tracking_Allocators with sites enabled add into the same report. Allocations done 
+// through the malloc like interface are not attributed.
 
 #include <stdlib.h>
+#include <stdio.h>
 #include "allocator.h"
 
+#ifdef __cplusplus
+    #include <atomic>
+    #define TRACKING_ATOMIC(T) std::atomic<T>
+#else
+    #include <stdatomic.h>
+    #define TRACKING_ATOMIC(T) _Atomic(T)
+#endif
+
+//Must fit into Allocation_List_Block::site. Site 0 holds allocations made without any site and the ones that did not fit.
+#define TRACKING_SITES_MAX 4096
+
 typedef struct Allocation_List_Block {
     struct Allocation_List_Block* next_block; 
     struct Allocation_List_Block* prev_block;
 
-    uint64_t align       : 16;
-    uint64_t size        : 47;
+    uint64_t align_log2  : 6;
+    uint64_t size        : 45;
     uint64_t is_offset   : 1;
+    uint64_t site        : 12;
 
     #ifdef DO_ASSERTS
     char magic[8];
@@ -53,9 +74,23 @@ EXTERNAL void* allocation_list_allocate(Allocation_List* self, Allocator* parent
 EXTERNAL isize allocation_list_get_block_size(Allocation_List* self, void* old_ptr);
 EXTERNAL Allocation_List_Block* allocation_list_get_block_header(Allocation_List* self, void* old_ptr);
 
-#define TRACKING_ALLOCATOR_INIT_USE 1
+typedef struct Tracking_Site_Stats {
+    Allocator_Site site;
+    isize bytes_allocated;      //live bytes allocated from this site
+    isize allocation_count;     //live allocations from this site
+    isize allocation_total;     //all allocations ever made from this site including the already freed ones
+} Tracking_Site_Stats;
+
+#define TRACKING_ALLOCATOR_INIT_USE   1
+#define TRACKING_ALLOCATOR_INIT_SITES 2 //attributes allocations to their Allocator_Site. See tracking_allocator_get_sites
 EXTERNAL void tracking_allocator_init(Tracking_Allocator* self, const char* name, uint64_t flags);
 EXTERNAL void tracking_allocator_deinit(Tracking_Allocator* self);
+
+//Merges the per thread counters and fills out with up to capacity sites holding live memory sorted by their live bytes 
+// in descending order. Returns the number of sites holding live memory (which can be bigger than capacity).
+EXTERNAL isize tracking_allocator_get_sites(Tracking_Site_Stats* out, isize capacity);
+//Prints the top_or_negative sites (all if negative) holding the most live memory into file.
+EXTERNAL void  tracking_allocator_print_sites(FILE* file, isize top_or_negative);
  
 EXTERNAL void* tracking_allocator_malloc(Tracking_Allocator* self, isize size);
 EXTERNAL void* tracking_allocator_realloc(Tracking_Allocator* self, void* old_ptr, isize new_size);
@@ -76,6 +111,23 @@ EXTERNAL void* tracking_allocator_func(void* self_void, int mode, isize new_size
     #ifndef INTERNAL
         #define INTERNAL inline static
     #endif
+
+    #ifdef __cplusplus
+        #define _TRACKING_USE_ATOMICS \
+            using std::memory_order_acquire;\
+            using std::memory_order_release;\
+            using std::memory_order_relaxed;
+    #else
+        #define _TRACKING_USE_ATOMICS
+    #endif
+
+    INTERNAL uint64_t _allocation_list_align_log2(isize align)
+    {
+        uint64_t log2 = 0;
+        while(((isize) 1 << log2) < align)
+            log2 += 1;
+        return log2;
+    }
     
     #define ALLOCATION_LIST_MAGIC "TrackAl"
     INTERNAL void _allocation_list_assert_block_coherency(Allocation_List* self, Allocation_List_Block* block)
@@ -102,7 +154,7 @@ EXTERNAL void* tracking_allocator_func(void* self_void, int mode, isize new_size
             Allocation_List_Block* prev_block = block->prev_block;
             _allocation_list_assert_block_coherency(self, block);
             
-            allocation_list_allocate(self, parent_or_null, 0, block + 1, block->size, block->align, NULL);
+            allocation_list_allocate(self, parent_or_null, 0, block + 1, block->size, (isize) 1 << block->align_log2, NULL);
             block = prev_block;
         }
 
@@ -144,11 +196,12 @@ EXTERNAL void* tracking_allocator_func(void* self_void, int mode, isize new_size
             }
 
             new_block_ptr->is_offset = is_offset; 
+            new_block_ptr->site = 0; 
             #ifdef __GNUC__
                 #pragma GCC diagnostic push
                 #pragma GCC diagnostic ignored "-Wconversion"
             #endif
-            new_block_ptr->align = (uint64_t) align; 
+            new_block_ptr->align_log2 = _allocation_list_align_log2(align); 
             new_block_ptr->size = (uint64_t) new_size; 
             #ifdef __GNUC__
                 #pragma GCC diagnostic pop
@@ -175,7 +228,7 @@ EXTERNAL void* tracking_allocator_func(void* self_void, int mode, isize new_size
         {
             Allocation_List_Block* old_block_ptr = (Allocation_List_Block*) old_ptr - 1;
             _allocation_list_assert_block_coherency(self, old_block_ptr);
-            ASSERT((isize) old_block_ptr->size == old_size && (isize) old_block_ptr->align == align);
+            ASSERT((isize) old_block_ptr->size == old_size && ((isize) 1 << old_block_ptr->align_log2) == align);
 
             //Unlink the block from the list
             if(old_block_ptr->next_block != NULL)
@@ -230,6 +283,156 @@ EXTERNAL void* tracking_allocator_func(void* self_void, int mode, isize new_size
         return block->size;
     }
     
+    //A site is claimed by publishing its hash and becomes readable once ready is set. 
+    // Sites are never removed so a found index stays valid for the lifetime of the process.
+    typedef struct _Tracking_Site_Slot {
+        TRACKING_ATOMIC(uint64_t) hash; 
+        TRACKING_ATOMIC(uint32_t) ready; 
+        uint32_t _;
+        Allocator_Site site;
+    } _Tracking_Site_Slot;
+
+    //Written only by the owning thread. Other threads read them only when merging.
+    // Frees from other threads than the allocating one make the counters of a single thread negative - only the sum is meaningful.
+    typedef struct _Tracking_Site_Counter {
+        TRACKING_ATOMIC(isize) bytes_allocated;
+        TRACKING_ATOMIC(isize) allocation_count;
+        TRACKING_ATOMIC(isize) allocation_total;
+    } _Tracking_Site_Counter;
+
+    //Pushed into a global list on first use by each thread and never freed so that allocations and frees of already 
+    // exited threads still add up.
+    typedef struct _Tracking_Site_Counters {
+        struct _Tracking_Site_Counters* next;
+        _Tracking_Site_Counter sites[TRACKING_SITES_MAX];
+    } _Tracking_Site_Counters;
+
+    _Tracking_Site_Slot g_tracking_sites[TRACKING_SITES_MAX];
+    TRACKING_ATOMIC(_Tracking_Site_Counters*) g_tracking_site_counters;
+    ATTRIBUTE_THREAD_LOCAL _Tracking_Site_Counters* t_tracking_site_counters = NULL;
+
+    INTERNAL uint32_t _tracking_site_index(const Allocator_Site* site)
+    {
+        _TRACKING_USE_ATOMICS;
+        if(site->file == NULL && site->label == NULL)
+            return 0;
+
+        uint64_t hash = (uint64_t) site->file*0x9E3779B97F4A7C15ULL ^ (uint64_t) site->label*0xC2B2AE3D27D4EB4FULL ^ (uint64_t) site->line*0x165667B19E3779F9ULL;
+        hash ^= hash >> 29;
+        hash += hash == 0;
+        for(uint64_t probe = 0; probe < TRACKING_SITES_MAX; probe++)
+        {
+            uint32_t index = (uint32_t) ((hash + probe) & (TRACKING_SITES_MAX - 1));
+            if(index == 0)
+                continue;
+
+            _Tracking_Site_Slot* slot = &g_tracking_sites[index];
+            uint64_t slot_hash = atomic_load_explicit(&slot->hash, memory_order_acquire);
+            if(slot_hash == 0) {
+                if(atomic_compare_exchange_strong(&slot->hash, &slot_hash, hash)) {
+                    slot->site = *site;
+                    atomic_store_explicit(&slot->ready, 1, memory_order_release);
+                    return index;
+                }
+                //someone else claimed it in the meantime. slot_hash now holds its hash.
+            }
+
+            if(slot_hash == hash) {
+                //The claiming thread is just two stores away from setting ready.
+                while(atomic_load_explicit(&slot->ready, memory_order_acquire) == 0);
+                if(slot->site.file == site->file && slot->site.label == site->label && slot->site.line == site->line)
+                    return index;
+            }
+        }
+        return 0;
+    }
+
+    INTERNAL _Tracking_Site_Counters* _tracking_site_counters_create()
+    {
+        _TRACKING_USE_ATOMICS;
+        _Tracking_Site_Counters* counters = (_Tracking_Site_Counters*) calloc(1, sizeof(_Tracking_Site_Counters));
+        if(counters) {
+            _Tracking_Site_Counters* head = atomic_load_explicit(&g_tracking_site_counters, memory_order_relaxed);
+            do counters->next = head;
+            while(!atomic_compare_exchange_weak_explicit(&g_tracking_site_counters, &head, counters, memory_order_release, memory_order_relaxed));
+            t_tracking_site_counters = counters;
+        }
+        return counters;
+    }
+
+    INTERNAL void _tracking_site_count(uint32_t site, isize bytes, isize count)
+    {
+        _TRACKING_USE_ATOMICS;
+        _Tracking_Site_Counters* counters = t_tracking_site_counters;
+        if(counters == NULL && (counters = _tracking_site_counters_create()) == NULL)
+            return;
+
+        _Tracking_Site_Counter* counter = &counters->sites[site];
+        atomic_store_explicit(&counter->bytes_allocated, atomic_load_explicit(&counter->bytes_allocated, memory_order_relaxed) + bytes, memory_order_relaxed);
+        atomic_store_explicit(&counter->allocation_count, atomic_load_explicit(&counter->allocation_count, memory_order_relaxed) + count, memory_order_relaxed);
+        if(count > 0)
+            atomic_store_explicit(&counter->allocation_total, atomic_load_explicit(&counter->allocation_total, memory_order_relaxed) + count, memory_order_relaxed);
+    }
+
+    INTERNAL int _tracking_site_stats_compare(const void* a_void, const void* b_void)
+    {
+        const Tracking_Site_Stats* a = (const Tracking_Site_Stats*) a_void;
+        const Tracking_Site_Stats* b = (const Tracking_Site_Stats*) b_void;
+        if(a->bytes_allocated != b->bytes_allocated)
+            return a->bytes_allocated > b->bytes_allocated ? -1 : 1;
+        return (a->allocation_count < b->allocation_count) - (a->allocation_count > b->allocation_count);
+    }
+
+    EXTERNAL isize tracking_allocator_get_sites(Tracking_Site_Stats* out, isize capacity)
+    {
+        _TRACKING_USE_ATOMICS;
+        Tracking_Site_Stats* merged = (Tracking_Site_Stats*) calloc(TRACKING_SITES_MAX, sizeof(Tracking_Site_Stats));
+        if(merged == NULL)
+            return 0;
+
+        for(_Tracking_Site_Counters* counters = atomic_load_explicit(&g_tracking_site_counters, memory_order_acquire); counters; counters = counters->next)
+            for(isize i = 0; i < TRACKING_SITES_MAX; i++) {
+                _Tracking_Site_Counter* counter = &counters->sites[i];
+                merged[i].bytes_allocated += atomic_load_explicit(&counter->bytes_allocated, memory_order_relaxed);
+                merged[i].allocation_count += atomic_load_explicit(&counter->allocation_count, memory_order_relaxed);
+                merged[i].allocation_total += atomic_load_explicit(&counter->allocation_total, memory_order_relaxed);
+            }
+
+        isize count = 0;
+        for(isize i = 0; i < TRACKING_SITES_MAX; i++)
+            if(merged[i].bytes_allocated != 0 || merged[i].allocation_count != 0) {
+                merged[count] = merged[i];
+                if(i != 0 && atomic_load_explicit(&g_tracking_sites[i].ready, memory_order_acquire))
+                    merged[count].site = g_tracking_sites[i].site;
+                else
+                    memset(&merged[count].site, 0, sizeof merged[count].site);
+                count += 1;
+            }
+
+        qsort(merged, (size_t) count, sizeof *merged, _tracking_site_stats_compare);
+        memcpy(out, merged, (size_t) (count < capacity ? count : capacity) * sizeof *merged);
+        free(merged);
+        return count;
+    }
+
+    EXTERNAL void tracking_allocator_print_sites(FILE* file, isize top_or_negative)
+    {
+        Tracking_Site_Stats* sites = (Tracking_Site_Stats*) calloc(TRACKING_SITES_MAX, sizeof(Tracking_Site_Stats));
+        if(sites == NULL)
+            return;
+
+        isize count = tracking_allocator_get_sites(sites, TRACKING_SITES_MAX);
+        isize printed = top_or_negative >= 0 && top_or_negative < count ? top_or_negative : count;
+        fprintf(file, "tracked sites with live memory: %lli (printing %lli)\n", (long long) count, (long long) printed);
+        for(isize i = 0; i < printed; i++) {
+            Tracking_Site_Stats* stats = &sites[i];
+            fprintf(file, "%14lliB %10lli alive %12lli total  %-16s %s:%i\n", 
+                (long long) stats->bytes_allocated, (long long) stats->allocation_count, (long long) stats->allocation_total, 
+                stats->site.label ? stats->site.label : "", stats->site.file ? stats->site.file : "<untagged>", (int) stats->site.line);
+        }
+        free(sites);
+    }
+
     EXTERNAL void tracking_allocator_init(Tracking_Allocator* self, const char* name, uint64_t flags)
     {
         tracking_allocator_deinit(self);
@@ -242,6 +445,10 @@ EXTERNAL void* tracking_allocator_func(void* self_void, int mode, isize new_size
     
     EXTERNAL void tracking_allocator_deinit(Tracking_Allocator* self)
     {
+        if(self->flags & TRACKING_ALLOCATOR_INIT_SITES)
+            for(Allocation_List_Block* block = self->list.last_block; block != NULL; block = block->prev_block)
+                _tracking_site_count((uint32_t) block->site, -(isize) block->size, -1);
+
         allocation_list_free_all(&self->list, self->parent);
         if(self->flags & TRACKING_ALLOCATOR_INIT_USE)
             allocators_set(self->allocator_backup);
@@ -253,7 +460,27 @@ EXTERNAL void* tracking_allocator_func(void* self_void, int mode, isize new_size
     {
         Tracking_Allocator* self = (Tracking_Allocator*) (void*) self_void;
         if(mode == ALLOCATOR_MODE_ALLOC) {
+            //Untagged reallocations (container growth) stay attributed to the site of the original allocation
+            uint32_t old_site = 0;
+            uint32_t new_site = 0;
+            bool track_sites = (self->flags & TRACKING_ALLOCATOR_INIT_SITES) != 0;
+            if(track_sites) {
+                old_site = old_ptr ? (uint32_t) allocation_list_get_block_header(&self->list, old_ptr)->site : 0;
+                if(new_size != 0) {
+                    Allocator_Site site = allocator_get_site();
+                    new_site = old_ptr && site.file == NULL ? old_site : _tracking_site_index(&site);
+                }
+            }
+
             void* out = allocation_list_allocate(&self->list, self->parent, new_size, old_ptr, old_size, align, (Allocator_Error*) rest);
+            if(track_sites && (out != NULL || new_size == 0)) {
+                if(out != NULL)
+                    allocation_list_get_block_header(&self->list, out)->site = new_site;
+                if(old_ptr != NULL)
+                    _tracking_site_count(old_site, -old_size, -1);
+                if(new_size != 0)
+                    _tracking_site_count(new_site, new_size, 1);
+            }
 
             if(old_size == 0)
                 self->allocation_count += 1;
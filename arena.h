@@ -43,6 +43,18 @@ EXTERNAL void arena_commit(Arena* arena, isize to);
 EXTERNAL void* arena_allocator_func(void* self, int mode, isize new_size, void* old_ptr, isize old_size, isize align, void* rest);
 
 #define ARENA_PUSH(arena_ptr, count, Type) ((Type*) arena_push((arena_ptr), (count) * sizeof(Type), __alignof(Type)))
+
+//Pushes size bytes aligned to align (power of two) when they fit into the committed memory. Otherwise falls back 
+// to arena_push_nonzero which commits more.
+ATTRIBUTE_INLINE_ALWAYS static void* arena_push_nonzero_inline(Arena* arena, isize size, isize align, Allocator_Error* error_or_null)
+{
+    uintptr_t out = ((uintptr_t) arena->used_to + (uintptr_t) align - 1) & ~((uintptr_t) align - 1);
+    if(out + (uintptr_t) size > (uintptr_t) arena->commit_to)
+        return arena_push_nonzero(arena, size, align, error_or_null);
+
+    arena->used_to = (uint8_t*) (out + (uintptr_t) size);
+    return (void*) out;
+}
 #endif
 
 #if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_ARENA)) && !defined(MODULE_HAS_IMPL_ARENA)
@@ -87,7 +99,7 @@ EXTERNAL void arena_deinit(Arena* arena)
     memset(arena, 0, sizeof *arena);
 }
 
-INTERNAL ATTRIBUTE_INLINE_NEVER void _arena_commit_no_inline(Arena* arena, const void* to, Allocator_Error* error_or_null)
+static ATTRIBUTE_INLINE_NEVER void _arena_commit_no_inline(Arena* arena, const void* to, Allocator_Error* error_or_null)
 {
     PROFILE_START();
     {
@@ -162,12 +174,12 @@ EXTERNAL void* arena_allocator_func(void* self, int mode, isize new_size, void*
     if(mode == ALLOCATOR_MODE_ALLOC) {
         Arena* arena = (Arena*) (void*) self;
 
-        REQUIRE(old_ptr == arena->data);
+        REQUIRE(old_ptr == arena->data || old_size == 0);
         REQUIRE(old_size == arena->used_to - arena->data);
         REQUIRE(is_power_of_two(align));
 
         arena_reset_ptr(arena, arena->data);
-        return arena_push_nonzero(arena, new_size, align, (Allocator_Error*) rest);
+        return arena_push_nonzero_inline(arena, new_size, align, (Allocator_Error*) rest);
     }
     if(mode == ALLOCATOR_MODE_GET_STATS) {
         Arena* arena = (Arena*) (void*) self;
@@ -26,6 +26,7 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
+#include "allocator_dispatch_default.h"
 
 #ifdef MODULE_ALL_COUPLED
     #include "defines.h"
@@ -210,7 +211,7 @@ EXTERNAL void generic_array_deinit(Generic_Array gen)
 {
     ASSERT_SLOW(generic_array_is_consistent(gen));
     if(gen.array->capacity > 0)
-        (*gen.array->allocator)(gen.array->allocator, 0, 0, gen.array->data, gen.array->capacity * gen.item_size, gen.item_align, NULL);
+        ALLOCATOR_DISPATCH(gen.array->allocator, 0, gen.array->data, gen.array->capacity * gen.item_size, gen.item_align);
     
     memset(gen.array, 0, sizeof *gen.array);
 }
@@ -224,7 +225,7 @@ EXTERNAL void generic_array_set_capacity(Generic_Array gen, isize capacity)
 
         isize old_byte_size = gen.item_size * gen.array->capacity;
         isize new_byte_size = gen.item_size * capacity;
-        gen.array->data = (uint8_t*) (*gen.array->allocator)(gen.array->allocator, 0, new_byte_size, gen.array->data, old_byte_size, gen.item_align, NULL);
+        gen.array->data = (uint8_t*) ALLOCATOR_DISPATCH(gen.array->allocator, new_byte_size, gen.array->data, old_byte_size, gen.item_align);
 
         //trim the size if too big
         gen.array->capacity = capacity;
@@ -0,0 +1,664 @@
+#ifndef MODULE_BTREE
+#define MODULE_BTREE
+
+//Ordered 64 -> 64 bit map implemented as a B+tree.
+//
+//Hash and Map are great for point lookups but know nothing about order. When we need ordered inserts together
+// with range scans ("all entries with key in [from, to)") the alternative was to keep a sorted array and re-sort/insert
+// into it, which is O(n) per insert. The B+tree gives O(log n) insert, remove and lookup and range scans at the speed
+// of walking an array.
+//
+//Like Hash this is just a building block mapping uint64_t keys to uint64_t values (for example a timestamp to an index
+// into an array of records). Unlike Hash the keys are unique and all values are allowed.
+//
+//The tree consists of nodes of fixed size (node_size bytes given at init, 128 to BTREE_MAX_NODE_SIZE) allocated through
+// the Allocator interface. All entries live in the leaves, the inner nodes contain only keys used for routing.
+// All leaves are at the same depth and are linked into a list in key order so iteration never needs to go back up the tree.
+// Each node except the root is at least half full.
+//
+//Node layout is:
+// [BTree_Node header][keys: capacity x uint64_t][values: capacity x uint64_t]          for leaves
+// [BTree_Node header][keys: capacity x uint64_t][children: (capacity + 1) x pointer]   for inner nodes
+// Keeping the keys contiguous lets us search within a node by comparing several keys at once (with AVX2 4 at a time).
+// For bigger nodes we first binary search down to BTREE_LINEAR_SEARCH keys and then scan linearly.
+//
+//The node size is a tradeoff. Smaller nodes (256B, 4 cache lines) make inserts and removals cheap since less data
+// is shifted around, larger nodes (4KB, a page) make the tree shallower so lookups need fewer dependent cache misses.
+// 512B is a good default for random workloads.
+//
+//The tree can also be built in O(n) from already sorted keys with btree_build_sorted.
+
+#include "allocator.h"
+#include "profile.h"
+#include "assert.h"
+#include "defines.h"
+
+#ifndef BTREE_DEFAULT_NODE_SIZE
+    #define BTREE_DEFAULT_NODE_SIZE 512
+#endif
+
+#ifndef BTREE_LINEAR_SEARCH
+    #define BTREE_LINEAR_SEARCH 16 //below this many keys we stop binary searching and compare all remaining keys
+#endif
+
+#define BTREE_MIN_NODE_SIZE 128
+#define BTREE_MAX_NODE_SIZE 4096
+#define BTREE_MAX_HEIGHT 32
+
+typedef struct BTree_Node {
+    uint32_t count;             //number of keys
+    uint32_t _;
+    struct BTree_Node* next;    //next leaf in key order. NULL for the last leaf and for all inner nodes.
+} BTree_Node;
+
+typedef struct BTree {
+    Allocator* allocator;
+    BTree_Node* root;
+    isize count;
+    isize node_count;
+    int32_t height;             //number of levels. 0 when empty, 1 when root is a leaf
+    uint32_t node_size;
+    uint32_t leaf_capacity;
+    uint32_t inner_capacity;
+} BTree;
+
+//Iterates entries in ascending key order. Obtained by btree_iter_begin or btree_lower_bound
+// and then advanced by btree_iterate. The iterator is invalidated by any modification of the tree
+// (except for writing through value).
+typedef struct BTree_Iter {
+    BTree_Node* leaf;
+    isize index;
+    const BTree* tree;
+    uint64_t key;
+    uint64_t* value;
+} BTree_Iter;
+
+EXTERNAL void btree_init(BTree* tree, Allocator* alloc_or_null, isize node_size_or_zero);
+EXTERNAL void btree_deinit(BTree* tree);
+EXTERNAL void btree_clear(BTree* tree);
+
+EXTERNAL bool btree_find(const BTree* tree, uint64_t key, uint64_t* value_or_null);
+//Sets the value of key. Returns true if the key was not present before.
+EXTERNAL bool btree_set(BTree* tree, uint64_t key, uint64_t value);
+//Removes the key. Returns true if it was present in which case its value is stored into value_or_null.
+EXTERNAL bool btree_remove(BTree* tree, uint64_t key, uint64_t* value_or_null);
+
+//Replaces the contents of tree with count entries. The keys must be strictly ascending.
+// Leaves are filled as much as possible (but at least half) so the result is the smallest possible tree.
+EXTERNAL void btree_build_sorted(BTree* tree, const uint64_t* keys, const uint64_t* values, isize count);
+
+//Returns iterator before the first entry of the tree
+EXTERNAL BTree_Iter btree_iter_begin(const BTree* tree);
+//Returns iterator before the first entry with key >= the given key
+EXTERNAL BTree_Iter btree_lower_bound(const BTree* tree, uint64_t key);
+//Moves to the next entry filling it->key and it->value. Returns false when there are no more entries.
+//Range scan of [from, to) looks like:
+// for(BTree_Iter it = btree_lower_bound(&tree, from); btree_iterate(&it) && it.key < to; )
+//     ...
+EXTERNAL bool btree_iterate(BTree_Iter* it);
+
+EXTERNAL void btree_test_consistency(const BTree* tree);
+#endif
+
+#if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_BTREE)) && !defined(MODULE_HAS_IMPL_BTREE)
+#define MODULE_HAS_IMPL_BTREE
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define _BTREE_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define _BTREE_SSE
+#endif
+
+INTERNAL uint64_t* _btree_keys(const BTree_Node* node)
+{
+    return (uint64_t*) (void*) (node + 1);
+}
+
+INTERNAL uint64_t* _btree_values(const BTree* tree, const BTree_Node* leaf)
+{
+    return _btree_keys(leaf) + tree->leaf_capacity;
+}
+
+INTERNAL BTree_Node** _btree_children(const BTree* tree, const BTree_Node* inner)
+{
+    return (BTree_Node**) (void*) (_btree_keys(inner) + tree->inner_capacity);
+}
+
+//Returns the number of keys smaller than key (or smaller or equal if inclusive).
+INTERNAL isize _btree_rank(const uint64_t* keys, isize count, uint64_t key, bool inclusive)
+{
+    isize from = 0;
+    while(count > BTREE_LINEAR_SEARCH) {
+        isize half = count/2;
+        bool before = inclusive ? keys[from + half] <= key : keys[from + half] < key;
+        if(before) {
+            from += half + 1;
+            count -= half + 1;
+        }
+        else
+            count = half;
+    }
+
+    isize rank = from;
+    isize i = 0;
+    #if defined(_BTREE_AVX2)
+        //There is no unsigned 64 bit compare so we flip the sign bits and compare signed.
+        __m256i sign = _mm256_set1_epi64x((int64_t) ((uint64_t) 1 << 63));
+        __m256i key_vec = _mm256_xor_si256(_mm256_set1_epi64x((int64_t) key), sign);
+        for(; i + 4 <= count; i += 4) {
+            __m256i keys_vec = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*) (const void*) (keys + from + i)), sign);
+            //inclusive: keys <= key is !(keys > key). exclusive: keys < key is key > keys
+            __m256i cmp = inclusive ? _mm256_cmpgt_epi64(keys_vec, key_vec) : _mm256_cmpgt_epi64(key_vec, keys_vec);
+            int mask = _mm256_movemask_pd(_mm256_castsi256_pd(cmp));
+            int bits = (mask & 1) + (mask >> 1 & 1) + (mask >> 2 & 1) + (mask >> 3 & 1);
+            rank += inclusive ? 4 - bits : bits;
+        }
+    #elif defined(_BTREE_SSE)
+        //SSE2 has no 64 bit compare at all. a < b unsigned is the borrow out of a - b which is the top bit 
+        // of (~a & b) | (~(a ^ b) & (a - b)). We count keys < key or key < keys (for inclusive) this way.
+        __m128i key_vec = _mm_set1_epi64x((int64_t) key);
+        __m128i borrows = _mm_setzero_si128();
+        for(; i + 2 <= count; i += 2) {
+            __m128i keys_vec = _mm_loadu_si128((const __m128i*) (const void*) (keys + from + i));
+            __m128i a = inclusive ? key_vec : keys_vec;
+            __m128i b = inclusive ? keys_vec : key_vec;
+            __m128i borrow = _mm_or_si128(_mm_andnot_si128(a, b), _mm_andnot_si128(_mm_xor_si128(a, b), _mm_sub_epi64(a, b)));
+            borrows = _mm_add_epi64(borrows, _mm_srli_epi64(borrow, 63));
+        }
+        uint64_t lanes[2] = {0};
+        _mm_storeu_si128((__m128i*) (void*) lanes, borrows);
+        isize borrow_count = (isize) (lanes[0] + lanes[1]);
+        rank += inclusive ? i - borrow_count : borrow_count;
+    #endif
+    for(; i < count; i++)
+        rank += inclusive ? keys[from + i] <= key : keys[from + i] < key;
+    return rank;
+}
+
+INTERNAL BTree_Node* _btree_node_alloc(BTree* tree)
+{
+    BTree_Node* node = (BTree_Node*) allocator_allocate(tree->allocator, tree->node_size, 64);
+    node->count = 0;
+    node->next = NULL;
+    tree->node_count += 1;
+    return node;
+}
+
+INTERNAL void _btree_node_free(BTree* tree, BTree_Node* node)
+{
+    allocator_deallocate(tree->allocator, node, tree->node_size, 64);
+    tree->node_count -= 1;
+}
+
+INTERNAL void _btree_free_subtree(BTree* tree, BTree_Node* node, int32_t level)
+{
+    if(level > 1)
+        for(uint32_t i = 0; i <= node->count; i++)
+            _btree_free_subtree(tree, _btree_children(tree, node)[i], level - 1);
+    _btree_node_free(tree, node);
+}
+
+EXTERNAL void btree_clear(BTree* tree)
+{
+    if(tree->root)
+        _btree_free_subtree(tree, tree->root, tree->height);
+    tree->root = NULL;
+    tree->height = 0;
+    tree->count = 0;
+}
+
+EXTERNAL void btree_deinit(BTree* tree)
+{
+    btree_clear(tree);
+    ASSERT(tree->node_count == 0);
+    memset(tree, 0, sizeof *tree);
+}
+
+EXTERNAL void btree_init(BTree* tree, Allocator* alloc_or_null, isize node_size_or_zero)
+{
+    btree_deinit(tree);
+    isize node_size = node_size_or_zero > 0 ? node_size_or_zero : BTREE_DEFAULT_NODE_SIZE;
+    ASSERT(BTREE_MIN_NODE_SIZE <= node_size && node_size <= BTREE_MAX_NODE_SIZE);
+
+    tree->allocator = alloc_or_null ? alloc_or_null : allocator_get_default();
+    tree->node_size = (uint32_t) node_size;
+    tree->leaf_capacity = (uint32_t) ((node_size - sizeof(BTree_Node)) / (2*sizeof(uint64_t)));
+    tree->inner_capacity = (uint32_t) ((node_size - sizeof(BTree_Node) - sizeof(BTree_Node*)) / (sizeof(uint64_t) + sizeof(BTree_Node*)));
+}
+
+INTERNAL BTree_Node* _btree_find_leaf(const BTree* tree, uint64_t key)
+{
+    BTree_Node* node = tree->root;
+    for(int32_t level = tree->height; level > 1; level--) {
+        isize child = _btree_rank(_btree_keys(node), node->count, key, true);
+        node = _btree_children(tree, node)[child];
+    }
+    return node;
+}
+
+EXTERNAL bool btree_find(const BTree* tree, uint64_t key, uint64_t* value_or_null)
+{
+    if(tree->root == NULL)
+        return false;
+
+    BTree_Node* leaf = _btree_find_leaf(tree, key);
+    isize i = _btree_rank(_btree_keys(leaf), leaf->count, key, false);
+    if(i < leaf->count && _btree_keys(leaf)[i] == key) {
+        if(value_or_null)
+            *value_or_null = _btree_values(tree, leaf)[i];
+        return true;
+    }
+    return false;
+}
+
+EXTERNAL BTree_Iter btree_lower_bound(const BTree* tree, uint64_t key)
+{
+    BTree_Iter it = {0};
+    it.tree = tree;
+    if(tree->root) {
+        it.leaf = _btree_find_leaf(tree, key);
+        it.index = _btree_rank(_btree_keys(it.leaf), it.leaf->count, key, false);
+    }
+    return it;
+}
+
+EXTERNAL BTree_Iter btree_iter_begin(const BTree* tree)
+{
+    BTree_Iter it = {0};
+    it.tree = tree;
+    it.leaf = tree->root;
+    for(int32_t level = tree->height; level > 1; level--)
+        it.leaf = _btree_children(tree, it.leaf)[0];
+    return it;
+}
+
+EXTERNAL bool btree_iterate(BTree_Iter* it)
+{
+    while(it->leaf && it->index >= it->leaf->count) {
+        it->leaf = it->leaf->next;
+        it->index = 0;
+    }
+
+    if(it->leaf == NULL)
+        return false;
+
+    it->key = _btree_keys(it->leaf)[it->index];
+    it->value = &_btree_values(it->tree, it->leaf)[it->index];
+    it->index += 1;
+    return true;
+}
+
+typedef struct _BTree_Path {
+    BTree_Node* nodes[BTREE_MAX_HEIGHT];
+    isize indices[BTREE_MAX_HEIGHT];   //which child of nodes[level] we went into
+} _BTree_Path;
+
+//Descends to the leaf recording the path. Path level 0 is the root.
+INTERNAL BTree_Node* _btree_find_leaf_path(const BTree* tree, uint64_t key, _BTree_Path* path)
+{
+    BTree_Node* node = tree->root;
+    for(int32_t depth = 0; depth < tree->height - 1; depth++) {
+        isize child = _btree_rank(_btree_keys(node), node->count, key, true);
+        path->nodes[depth] = node;
+        path->indices[depth] = child;
+        node = _btree_children(tree, node)[child];
+    }
+    return node;
+}
+
+EXTERNAL bool btree_set(BTree* tree, uint64_t key, uint64_t value)
+{
+    if(tree->root == NULL) {
+        if(tree->node_size == 0)
+            btree_init(tree, NULL, 0);
+        tree->root = _btree_node_alloc(tree);
+        tree->height = 1;
+    }
+
+    _BTree_Path path;
+    BTree_Node* leaf = _btree_find_leaf_path(tree, key, &path);
+    uint64_t* keys = _btree_keys(leaf);
+    uint64_t* values = _btree_values(tree, leaf);
+    isize pos = _btree_rank(keys, leaf->count, key, false);
+    if(pos < leaf->count && keys[pos] == key) {
+        values[pos] = value;
+        return false;
+    }
+
+    tree->count += 1;
+    if(leaf->count < tree->leaf_capacity) {
+        memmove(keys + pos + 1, keys + pos, (leaf->count - pos)*sizeof *keys);
+        memmove(values + pos + 1, values + pos, (leaf->count - pos)*sizeof *values);
+        keys[pos] = key;
+        values[pos] = value;
+        leaf->count += 1;
+        return true;
+    }
+
+    //Split the leaf. Assemble the full sequence including the new entry on the stack and redistribute it.
+    uint64_t temp_keys[BTREE_MAX_NODE_SIZE/sizeof(uint64_t)];
+    uint64_t temp_values[BTREE_MAX_NODE_SIZE/sizeof(uint64_t)];
+    isize total = leaf->count + 1;
+    memcpy(temp_keys, keys, pos*sizeof *keys);
+    memcpy(temp_values, values, pos*sizeof *values);
+    temp_keys[pos] = key;
+    temp_values[pos] = value;
+    memcpy(temp_keys + pos + 1, keys + pos, (leaf->count - pos)*sizeof *keys);
+    memcpy(temp_values + pos + 1, values + pos, (leaf->count - pos)*sizeof *values);
+
+    BTree_Node* right = _btree_node_alloc(tree);
+    isize left_count = total/2;
+    leaf->count = (uint32_t) left_count;
+    right->count = (uint32_t) (total - left_count);
+    memcpy(keys, temp_keys, left_count*sizeof *keys);
+    memcpy(values, temp_values, left_count*sizeof *values);
+    memcpy(_btree_keys(right), temp_keys + left_count, right->count*sizeof *keys);
+    memcpy(_btree_values(tree, right), temp_values + left_count, right->count*sizeof *values);
+    right->next = leaf->next;
+    leaf->next = right;
+
+    //Insert (separator, right) into the parents, splitting them as needed
+    uint64_t separator = _btree_keys(right)[0];
+    BTree_Node* new_child = right;
+    for(int32_t depth = tree->height - 2; depth >= 0; depth--) {
+        BTree_Node* parent = path.nodes[depth];
+        isize at = path.indices[depth];
+        uint64_t* parent_keys = _btree_keys(parent);
+        BTree_Node** children = _btree_children(tree, parent);
+        if(parent->count < tree->inner_capacity) {
+            memmove(parent_keys + at + 1, parent_keys + at, (parent->count - at)*sizeof *parent_keys);
+            memmove(children + at + 2, children + at + 1, (parent->count - at)*sizeof *children);
+            parent_keys[at] = separator;
+            children[at + 1] = new_child;
+            parent->count += 1;
+            return true;
+        }
+
+        //Split inner node. The middle key moves up.
+        BTree_Node* temp_children[BTREE_MAX_NODE_SIZE/sizeof(BTree_Node*) + 1];
+        isize key_total = parent->count + 1;
+        memcpy(temp_keys, parent_keys, at*sizeof *parent_keys);
+        temp_keys[at] = separator;
+        memcpy(temp_keys + at + 1, parent_keys + at, (parent->count - at)*sizeof *parent_keys);
+        memcpy(temp_children, children, (at + 1)*sizeof *children);
+        temp_children[at + 1] = new_child;
+        memcpy(temp_children + at + 2, children + at + 1, (parent->count - at)*sizeof *children);
+
+        BTree_Node* parent_right = _btree_node_alloc(tree);
+        isize middle = key_total/2;
+        parent->count = (uint32_t) middle;
+        parent_right->count = (uint32_t) (key_total - middle - 1);
+        memcpy(parent_keys, temp_keys, middle*sizeof *parent_keys);
+        memcpy(children, temp_children, (middle + 1)*sizeof *children);
+        memcpy(_btree_keys(parent_right), temp_keys + middle + 1, parent_right->count*sizeof *parent_keys);
+        memcpy(_btree_children(tree, parent_right), temp_children + middle + 1, (parent_right->count + 1)*sizeof *children);
+
+        separator = temp_keys[middle];
+        new_child = parent_right;
+    }
+
+    //The root was split
+    BTree_Node* root = _btree_node_alloc(tree);
+    root->count = 1;
+    _btree_keys(root)[0] = separator;
+    _btree_children(tree, root)[0] = tree->root;
+    _btree_children(tree, root)[1] = new_child;
+    tree->root = root;
+    tree->height += 1;
+    ASSERT(tree->height <= BTREE_MAX_HEIGHT);
+    return true;
+}
+
+//Merges right into left (right is the child at separator_index + 1 of parent). Frees right.
+INTERNAL void _btree_merge(BTree* tree, BTree_Node* parent, isize separator_index, BTree_Node* left, BTree_Node* right, bool is_leaf)
+{
+    uint64_t* parent_keys = _btree_keys(parent);
+    BTree_Node** parent_children = _btree_children(tree, parent);
+    uint64_t* left_keys = _btree_keys(left);
+    if(is_leaf) {
+        memcpy(left_keys + left->count, _btree_keys(right), right->count*sizeof *left_keys);
+        memcpy(_btree_values(tree, left) + left->count, _btree_values(tree, right), right->count*sizeof(uint64_t));
+        left->count += right->count;
+        left->next = right->next;
+    }
+    else {
+        left_keys[left->count] = parent_keys[separator_index];
+        memcpy(left_keys + left->count + 1, _btree_keys(right), right->count*sizeof *left_keys);
+        memcpy(_btree_children(tree, left) + left->count + 1, _btree_children(tree, right), (right->count + 1)*sizeof(BTree_Node*));
+        left->count += right->count + 1;
+    }
+
+    memmove(parent_keys + separator_index, parent_keys + separator_index + 1, (parent->count - separator_index - 1)*sizeof *parent_keys);
+    memmove(parent_children + separator_index + 1, parent_children + separator_index + 2, (parent->count - separator_index - 1)*sizeof *parent_children);
+    parent->count -= 1;
+    _btree_node_free(tree, right);
+}
+
+EXTERNAL bool btree_remove(BTree* tree, uint64_t key, uint64_t* value_or_null)
+{
+    if(tree->root == NULL)
+        return false;
+
+    _BTree_Path path;
+    BTree_Node* leaf = _btree_find_leaf_path(tree, key, &path);
+    uint64_t* keys = _btree_keys(leaf);
+    uint64_t* values = _btree_values(tree, leaf);
+    isize pos = _btree_rank(keys, leaf->count, key, false);
+    if(pos >= leaf->count || keys[pos] != key)
+        return false;
+
+    if(value_or_null)
+        *value_or_null = values[pos];
+    memmove(keys + pos, keys + pos + 1, (leaf->count - pos - 1)*sizeof *keys);
+    memmove(values + pos, values + pos + 1, (leaf->count - pos - 1)*sizeof *values);
+    leaf->count -= 1;
+    tree->count -= 1;
+
+    //Rebalance upwards. Note that we never need to update the separators when removing the smallest key of a leaf
+    // since they are only used for routing and remain valid bounds.
+    BTree_Node* node = leaf;
+    for(int32_t depth = tree->height - 1; depth > 0; depth--) {
+        bool is_leaf = depth == tree->height - 1;
+        uint32_t min_count = (is_leaf ? tree->leaf_capacity : tree->inner_capacity)/2;
+        if(node->count >= min_count)
+            return true;
+
+        BTree_Node* parent = path.nodes[depth - 1];
+        isize at = path.indices[depth - 1];
+        uint64_t* parent_keys = _btree_keys(parent);
+        BTree_Node** siblings = _btree_children(tree, parent);
+        BTree_Node* left = at > 0 ? siblings[at - 1] : NULL;
+        BTree_Node* right = at < parent->count ? siblings[at + 1] : NULL;
+        uint64_t* node_keys = _btree_keys(node);
+
+        //Borrow the last entry of the left sibling
+        if(left && left->count > min_count) {
+            uint64_t* left_keys = _btree_keys(left);
+            memmove(node_keys + 1, node_keys, node->count*sizeof *node_keys);
+            if(is_leaf) {
+                uint64_t* node_values = _btree_values(tree, node);
+                memmove(node_values + 1, node_values, node->count*sizeof *node_values);
+                node_keys[0] = left_keys[left->count - 1];
+                node_values[0] = _btree_values(tree, left)[left->count - 1];
+                parent_keys[at - 1] = node_keys[0];
+            }
+            else {
+                BTree_Node** node_children = _btree_children(tree, node);
+                memmove(node_children + 1, node_children, (node->count + 1)*sizeof *node_children);
+                node_keys[0] = parent_keys[at - 1];
+                node_children[0] = _btree_children(tree, left)[left->count];
+                parent_keys[at - 1] = left_keys[left->count - 1];
+            }
+            node->count += 1;
+            left->count -= 1;
+            return true;
+        }
+
+        //Borrow the first entry of the right sibling
+        if(right && right->count > min_count) {
+            uint64_t* right_keys = _btree_keys(right);
+            if(is_leaf) {
+                uint64_t* right_values = _btree_values(tree, right);
+                node_keys[node->count] = right_keys[0];
+                _btree_values(tree, node)[node->count] = right_values[0];
+                memmove(right_keys, right_keys + 1, (right->count - 1)*sizeof *right_keys);
+                memmove(right_values, right_values + 1, (right->count - 1)*sizeof *right_values);
+                parent_keys[at] = right_keys[0];
+            }
+            else {
+                BTree_Node** right_children = _btree_children(tree, right);
+                node_keys[node->count] = parent_keys[at];
+                _btree_children(tree, node)[node->count + 1] = right_children[0];
+                parent_keys[at] = right_keys[0];
+                memmove(right_keys, right_keys + 1, (right->count - 1)*sizeof *right_keys);
+                memmove(right_children, right_children + 1, right->count*sizeof *right_children);
+            }
+            node->count += 1;
+            right->count -= 1;
+            return true;
+        }
+
+        //Neither sibling can spare anything so merge with one of them. This removes a key from the parent
+        // which might now be underfull itself so we continue one level up.
+        if(left)
+            _btree_merge(tree, parent, at - 1, left, node, is_leaf);
+        else
+            _btree_merge(tree, parent, at, node, right, is_leaf);
+        node = parent;
+    }
+
+    //Shrink the tree when root is left with a single child or becomes empty
+    BTree_Node* root = tree->root;
+    if(tree->height > 1 && root->count == 0) {
+        tree->root = _btree_children(tree, root)[0];
+        tree->height -= 1;
+        _btree_node_free(tree, root);
+    }
+    else if(tree->height == 1 && root->count == 0) {
+        tree->root = NULL;
+        tree->height = 0;
+        _btree_node_free(tree, root);
+    }
+    return true;
+}
+
+EXTERNAL void btree_build_sorted(BTree* tree, const uint64_t* keys, const uint64_t* values, isize count)
+{
+    PROFILE_START();
+    if(tree->node_size == 0)
+        btree_init(tree, NULL, 0);
+    btree_clear(tree);
+
+    if(count > 0) {
+        //Build the level of leaves, then repeatedly the level above it until we get a single node.
+        // Entries are distributed evenly so that every node is at least half full.
+        isize leaf_count = (count + tree->leaf_capacity - 1)/tree->leaf_capacity;
+        isize temp_size = leaf_count*(sizeof(BTree_Node*) + sizeof(uint64_t));
+        BTree_Node** level = (BTree_Node**) allocator_allocate(tree->allocator, temp_size, 8);
+        uint64_t* level_mins = (uint64_t*) (void*) (level + leaf_count);
+
+        BTree_Node* prev = NULL;
+        for(isize l = 0, from = 0; l < leaf_count; l++) {
+            isize to = count*(l + 1)/leaf_count;
+            BTree_Node* leaf = _btree_node_alloc(tree);
+            leaf->count = (uint32_t) (to - from);
+            memcpy(_btree_keys(leaf), keys + from, (to - from)*sizeof *keys);
+            memcpy(_btree_values(tree, leaf), values + from, (to - from)*sizeof *values);
+            #ifdef DO_ASSERTS_SLOW
+            for(isize i = from + 1; i < to; i++)
+                ASSERT(keys[i - 1] < keys[i], "keys must be strictly ascending");
+            #endif
+            ASSERT(from == 0 || keys[from - 1] < keys[from], "keys must be strictly ascending");
+
+            if(prev)
+                prev->next = leaf;
+            prev = leaf;
+            level[l] = leaf;
+            level_mins[l] = keys[from];
+            from = to;
+        }
+
+        isize level_count = leaf_count;
+        tree->height = 1;
+        while(level_count > 1) {
+            isize fanout = tree->inner_capacity + 1;
+            isize parent_count = (level_count + fanout - 1)/fanout;
+            for(isize p = 0, from = 0; p < parent_count; p++) {
+                isize to = level_count*(p + 1)/parent_count;
+                BTree_Node* parent = _btree_node_alloc(tree);
+                parent->count = (uint32_t) (to - from - 1);
+                for(isize i = from; i < to; i++) {
+                    _btree_children(tree, parent)[i - from] = level[i];
+                    if(i > from)
+                        _btree_keys(parent)[i - from - 1] = level_mins[i];
+                }
+
+                //Parents are written over the front of the level which we have already consumed
+                uint64_t min = level_mins[from];
+                level[p] = parent;
+                level_mins[p] = min;
+                from = to;
+            }
+            level_count = parent_count;
+            tree->height += 1;
+        }
+
+        tree->root = level[0];
+        tree->count = count;
+        allocator_deallocate(tree->allocator, level, temp_size, 8);
+    }
+    PROFILE_STOP();
+}
+
+INTERNAL isize _btree_test_subtree(const BTree* tree, const BTree_Node* node, int32_t depth, bool has_lo, uint64_t lo, bool has_hi, uint64_t hi, const BTree_Node** prev_leaf)
+{
+    bool is_leaf = depth == tree->height - 1;
+    uint32_t capacity = is_leaf ? tree->leaf_capacity : tree->inner_capacity;
+    TEST(node->count <= capacity);
+    if(node != tree->root)
+        TEST(node->count >= capacity/2, "every node except root must be at least half full");
+
+    const uint64_t* keys = _btree_keys(node);
+    for(uint32_t i = 0; i < node->count; i++) {
+        TEST(i == 0 || keys[i - 1] < keys[i]);
+        TEST(has_lo == false || lo <= keys[i]);
+        TEST(has_hi == false || keys[i] < hi);
+    }
+
+    if(is_leaf) {
+        TEST(node->count > 0);
+        TEST(*prev_leaf == NULL || (*prev_leaf)->next == node, "leaves must be linked in order");
+        *prev_leaf = node;
+        return node->count;
+    }
+
+    TEST(node->next == NULL);
+    isize count = 0;
+    BTree_Node** children = _btree_children(tree, node);
+    for(uint32_t i = 0; i <= node->count; i++) {
+        bool child_has_lo = i > 0 ? true : has_lo;
+        uint64_t child_lo = i > 0 ? keys[i - 1] : lo;
+        bool child_has_hi = i < node->count ? true : has_hi;
+        uint64_t child_hi = i < node->count ? keys[i] : hi;
+        count += _btree_test_subtree(tree, children[i], depth + 1, child_has_lo, child_lo, child_has_hi, child_hi, prev_leaf);
+    }
+    return count;
+}
+
+EXTERNAL void btree_test_consistency(const BTree* tree)
+{
+    PROFILE_START();
+    TEST((tree->root == NULL) == (tree->height == 0));
+    TEST((tree->root == NULL) == (tree->count == 0));
+    if(tree->root) {
+        const BTree_Node* prev_leaf = NULL;
+        isize count = _btree_test_subtree(tree, tree->root, 0, false, 0, false, 0, &prev_leaf);
+        TEST(count == tree->count);
+        TEST(prev_leaf->next == NULL);
+    }
+    PROFILE_STOP();
+}
+
+#endif
@@ -226,7 +226,9 @@ CHAN_OS_API bool chan_start_thread(void (*func)(void* context), void* context);
 
 #ifndef chan_debug_log
     //cheaply logs into memory msg static string followed by up to two uint64_t values
-    #define chan_debug_log(msg, ...) (void) sizeof((msg), ##__VA_ARGS__)   
+    //The call inside sizeof is never evaluated so _chan_debug_log_unused needs no definition.
+    int _chan_debug_log_unused(const char* msg, ...);
+    #define chan_debug_log(msg, ...) (void) sizeof(_chan_debug_log_unused((msg), ##__VA_ARGS__))   
     //performs n atomic additions on piece of global memory causing the caller to wait for a bit   
     // is used to make certain states more likely then others (increases the window between two instructions)
     #define chan_debug_wait(n)      (void) sizeof(n) 
@@ -0,0 +1,600 @@
+#ifndef MODULE_FILTER
+#define MODULE_FILTER
+
+//Approximate membership filters meant to sit in front of Hash/Map lookups.
+//
+//When most lookups into a table much bigger than cache are misses, each miss costs at least one DRAM round trip just to find out
+// the key is not there. A filter answers "definitely not present" or "maybe present" from a much smaller structure
+// (a few bits per key) that has much better chance of being in cache. Only the maybe answers then go to the table.
+//
+//All filters take the 64 bit hash of the key directly - the same one already calculated for Hash/Map. The hash is assumed
+// to be well mixed (for example from hash64_bijective or xxhash64). The filters are never wrong about a key that was inserted
+// (no false negatives), but they report some fraction of keys that were never inserted as present (false positive rate).
+//
+//There are three flavours with different tradeoffs:
+// 1. Bloom_Filter is a split block bloom filter. Each key maps to a single 32 byte block and sets one bit in each of its eight
+//    32 bit words. Thus insert and lookup touch exactly one cache line and the eight bit tests are done in parallel
+//    (with AVX2 as a single instruction sequence, with SSE2 as two halves, otherwise as a simple loop). Supports only insertion.
+//    At 10 bits/key the false positive rate is around 1.3%, at 16 bits/key around 0.15%.
+// 2. Cuckoo_Filter stores 16 bit fingerprints in buckets of four. Each key has two candidate buckets and inserting into full
+//    buckets kicks out other fingerprints to their alternative bucket (just like cuckoo hashing). Supports removal of previously
+//    inserted keys. Lookup touches at most two cache lines. False positive rate is around 0.012%, bits/key varies between
+//    ~17 and ~34 depending on how close the count got to the (power of two) capacity.
+// 3. Fuse_Filter is a static 3-wise binary fuse filter with 8 bit fingerprints (Graf and Lemire, "Binary Fuse Filters: Fast and
+//    Smaller Than Xor Filters"). It is built once from the complete set of keys and cannot be changed afterwards. It uses just
+//    ~9 bits/key for false positive rate of 0.39%. Lookup touches three locations which are close to each other.
+
+#include "allocator.h"
+#include "hash_func.h"
+#include "profile.h"
+#include "assert.h"
+#include "defines.h"
+
+#define BLOOM_FILTER_BLOCK_WORDS 8
+#define CUCKOO_FILTER_BUCKET_SIZE 4
+
+#ifndef CUCKOO_FILTER_MAX_KICKS
+    #define CUCKOO_FILTER_MAX_KICKS 500
+#endif
+
+#ifndef FUSE_FILTER_MAX_ATTEMPTS
+    #define FUSE_FILTER_MAX_ATTEMPTS 100
+#endif
+
+typedef struct Bloom_Filter {
+    Allocator* allocator;
+    uint32_t* blocks;       //block_count blocks of BLOOM_FILTER_BLOCK_WORDS words each. Aligned so that a block never straddles a cache line.
+    isize block_count;
+    isize count;            //number of insertions (including repeated ones)
+} Bloom_Filter;
+
+typedef struct Cuckoo_Filter {
+    Allocator* allocator;
+    uint16_t* fingerprints; //bucket_count buckets of CUCKOO_FILTER_BUCKET_SIZE fingerprints each. 0 means empty slot.
+    isize bucket_count;     //always a power of two
+    isize count;
+    isize victim_bucket;    //when inserting fails after CUCKOO_FILTER_MAX_KICKS the last kicked out fingerprint is kept here
+    uint16_t victim;        //0 if there is no victim. If there is the filter is full and further insertions fail.
+    uint16_t _;
+    uint32_t kicks;         //purely informational number of kicks so far
+} Cuckoo_Filter;
+
+typedef struct Fuse_Filter {
+    Allocator* allocator;
+    uint8_t* fingerprints;
+    isize fingerprint_count;
+    isize count;            //number of unique keys
+    uint64_t seed;
+    uint32_t segment_length;
+    uint32_t segment_length_mask;
+    uint32_t segment_count;
+    uint32_t segment_count_length;
+} Fuse_Filter;
+
+//Initializes the filter to hold expected_count keys using roughly bits_per_key bits for each.
+// More keys can be inserted but the false positive rate grows with it.
+EXTERNAL void bloom_filter_init(Bloom_Filter* filter, Allocator* alloc_or_null, isize expected_count, isize bits_per_key);
+EXTERNAL void bloom_filter_deinit(Bloom_Filter* filter);
+EXTERNAL void bloom_filter_clear(Bloom_Filter* filter);
+EXTERNAL void bloom_filter_insert(Bloom_Filter* filter, uint64_t hash);
+EXTERNAL bool bloom_filter_contains(const Bloom_Filter* filter, uint64_t hash);
+EXTERNAL f64  bloom_filter_bits_per_key(const Bloom_Filter* filter);
+
+//Initializes the filter to hold at least expected_count keys.
+EXTERNAL void cuckoo_filter_init(Cuckoo_Filter* filter, Allocator* alloc_or_null, isize expected_count);
+EXTERNAL void cuckoo_filter_deinit(Cuckoo_Filter* filter);
+EXTERNAL void cuckoo_filter_clear(Cuckoo_Filter* filter);
+//Returns false if the filter is full. In that case the filter is unchanged.
+// The same key can be inserted multiple times (up to 2*CUCKOO_FILTER_BUCKET_SIZE) and then has to be removed that many times.
+EXTERNAL bool cuckoo_filter_insert(Cuckoo_Filter* filter, uint64_t hash);
+//Removes one previously inserted key. Removing keys that were not inserted can remove other keys
+// with the same fingerprint and break the no false negatives guarantee!
+EXTERNAL bool cuckoo_filter_remove(Cuckoo_Filter* filter, uint64_t hash);
+EXTERNAL bool cuckoo_filter_contains(const Cuckoo_Filter* filter, uint64_t hash);
+EXTERNAL f64  cuckoo_filter_bits_per_key(const Cuckoo_Filter* filter);
+
+//Builds the filter from all hashes at once. Duplicate hashes are allowed.
+// Returns false (and leaves the filter empty) only if the construction failed FUSE_FILTER_MAX_ATTEMPTS times in a row
+// which practically never happens.
+EXTERNAL bool fuse_filter_build(Fuse_Filter* filter, Allocator* alloc_or_null, const uint64_t* hashes, isize count);
+EXTERNAL void fuse_filter_deinit(Fuse_Filter* filter);
+EXTERNAL bool fuse_filter_contains(const Fuse_Filter* filter, uint64_t hash);
+EXTERNAL f64  fuse_filter_bits_per_key(const Fuse_Filter* filter);
+#endif
+
+#if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_FILTER)) && !defined(MODULE_HAS_IMPL_FILTER)
+#define MODULE_HAS_IMPL_FILTER
+
+#include <math.h>
+#include <stdlib.h>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define _FILTER_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define _FILTER_SSE
+#endif
+
+INTERNAL uint64_t _filter_mulhi(uint64_t a, uint64_t b)
+{
+    #if defined(_MSC_VER)
+        return __umulh(a, b);
+    #else
+        return (uint64_t) (((__uint128_t) a * b) >> 64);
+    #endif
+}
+
+//=================== Bloom_Filter ===================
+//Odd constants from the parquet split block bloom filter specification.
+// Multiplying by them and taking the top 5 bits gives the bit index within each word.
+#define _BLOOM_FILTER_SALTS 0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U
+
+INTERNAL uint32_t* _bloom_filter_block(const Bloom_Filter* filter, uint64_t hash)
+{
+    //Upper 32 bits select the block (multiply and shift instead of modulo), lower 32 bits select the bits inside
+    uint64_t block = ((hash >> 32) * (uint64_t) filter->block_count) >> 32;
+    return filter->blocks + block*BLOOM_FILTER_BLOCK_WORDS;
+}
+
+#if defined(_FILTER_SSE)
+//Bit masks of the eight words of a block as two halves. SSE2 lacks both the 32 bit multiply and variable shifts. 
+// The multiply is done as two 32x32->64 bit multiplies of the even and odd words from which we take the bit index. 
+// 1 << index is the float 2^index converted to int. For index 31 the conversion overflows to 0x80000000 which is again 1 << 31.
+INTERNAL void _bloom_filter_masks_sse(uint64_t hash, __m128i masks[2])
+{
+    const uint32_t salts[BLOOM_FILTER_BLOCK_WORDS] = {_BLOOM_FILTER_SALTS};
+    __m128i hash_vec = _mm_set1_epi32((int) (uint32_t) hash);
+    __m128i low_five = _mm_set_epi32(0, 31, 0, 31);
+    for(isize i = 0; i < 2; i++) {
+        __m128i salt_vec = _mm_loadu_si128((const __m128i*) (const void*) (salts + 4*i));
+        __m128i even = _mm_and_si128(_mm_srli_epi64(_mm_mul_epu32(hash_vec, salt_vec), 27), low_five);
+        __m128i odd = _mm_and_si128(_mm_srli_epi64(_mm_mul_epu32(hash_vec, _mm_srli_epi64(salt_vec, 32)), 27), low_five);
+        __m128i shifts = _mm_or_si128(even, _mm_slli_epi64(odd, 32));
+        __m128i exponents = _mm_add_epi32(_mm_slli_epi32(shifts, 23), _mm_set1_epi32(127 << 23));
+        masks[i] = _mm_cvttps_epi32(_mm_castsi128_ps(exponents));
+    }
+}
+#endif
+
+EXTERNAL void bloom_filter_deinit(Bloom_Filter* filter)
+{
+    if(filter->blocks)
+        allocator_deallocate(filter->allocator, filter->blocks, filter->block_count*BLOOM_FILTER_BLOCK_WORDS*sizeof(uint32_t), 64);
+    memset(filter, 0, sizeof *filter);
+}
+
+EXTERNAL void bloom_filter_init(Bloom_Filter* filter, Allocator* alloc_or_null, isize expected_count, isize bits_per_key)
+{
+    bloom_filter_deinit(filter);
+    isize block_bits = BLOOM_FILTER_BLOCK_WORDS*32;
+    isize block_count = (MAX(expected_count, 1)*MAX(bits_per_key, 1) + block_bits - 1)/block_bits;
+    ASSERT(block_count <= UINT32_MAX);
+
+    filter->allocator = alloc_or_null ? alloc_or_null : allocator_get_default();
+    filter->block_count = block_count;
+    filter->blocks = (uint32_t*) allocator_allocate(filter->allocator, block_count*BLOOM_FILTER_BLOCK_WORDS*sizeof(uint32_t), 64);
+    bloom_filter_clear(filter);
+}
+
+EXTERNAL void bloom_filter_clear(Bloom_Filter* filter)
+{
+    if(filter->blocks)
+        memset(filter->blocks, 0, filter->block_count*BLOOM_FILTER_BLOCK_WORDS*sizeof(uint32_t));
+    filter->count = 0;
+}
+
+EXTERNAL void bloom_filter_insert(Bloom_Filter* filter, uint64_t hash)
+{
+    ASSERT(filter->blocks, "must be initialized");
+    uint32_t* block = _bloom_filter_block(filter, hash);
+    #if defined(_FILTER_AVX2)
+        __m256i salts = _mm256_setr_epi32(_BLOOM_FILTER_SALTS);
+        __m256i shifts = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32((int) (uint32_t) hash), salts), 27);
+        __m256i masks = _mm256_sllv_epi32(_mm256_set1_epi32(1), shifts);
+        __m256i* vec = (__m256i*) (void*) block;
+        _mm256_store_si256(vec, _mm256_or_si256(_mm256_load_si256(vec), masks));
+    #elif defined(_FILTER_SSE)
+        __m128i masks[2];
+        _bloom_filter_masks_sse(hash, masks);
+        __m128i* vec = (__m128i*) (void*) block;
+        _mm_store_si128(vec + 0, _mm_or_si128(_mm_load_si128(vec + 0), masks[0]));
+        _mm_store_si128(vec + 1, _mm_or_si128(_mm_load_si128(vec + 1), masks[1]));
+    #else
+        const uint32_t salts[BLOOM_FILTER_BLOCK_WORDS] = {_BLOOM_FILTER_SALTS};
+        for(isize i = 0; i < BLOOM_FILTER_BLOCK_WORDS; i++)
+            block[i] |= (uint32_t) 1 << (((uint32_t) hash*salts[i]) >> 27);
+    #endif
+    filter->count += 1;
+}
+
+EXTERNAL bool bloom_filter_contains(const Bloom_Filter* filter, uint64_t hash)
+{
+    if(filter->blocks == NULL)
+        return false;
+
+    const uint32_t* block = _bloom_filter_block(filter, hash);
+    #if defined(_FILTER_AVX2)
+        __m256i salts = _mm256_setr_epi32(_BLOOM_FILTER_SALTS);
+        __m256i shifts = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32((int) (uint32_t) hash), salts), 27);
+        __m256i masks = _mm256_sllv_epi32(_mm256_set1_epi32(1), shifts);
+        //testc returns 1 when all bits of masks are also set in the block
+        return _mm256_testc_si256(_mm256_load_si256((const __m256i*) (const void*) block), masks);
+    #elif defined(_FILTER_SSE)
+        __m128i masks[2];
+        _bloom_filter_masks_sse(hash, masks);
+        const __m128i* vec = (const __m128i*) (const void*) block;
+        __m128i missing = _mm_or_si128(_mm_andnot_si128(_mm_load_si128(vec + 0), masks[0]), _mm_andnot_si128(_mm_load_si128(vec + 1), masks[1]));
+        return _mm_movemask_epi8(_mm_cmpeq_epi32(missing, _mm_setzero_si128())) == 0xFFFF;
+    #else
+        const uint32_t salts[BLOOM_FILTER_BLOCK_WORDS] = {_BLOOM_FILTER_SALTS};
+        uint32_t missing = 0;
+        for(isize i = 0; i < BLOOM_FILTER_BLOCK_WORDS; i++) {
+            uint32_t mask = (uint32_t) 1 << (((uint32_t) hash*salts[i]) >> 27);
+            missing |= ~block[i] & mask;
+        }
+        return missing == 0;
+    #endif
+}
+
+EXTERNAL f64 bloom_filter_bits_per_key(const Bloom_Filter* filter)
+{
+    return filter->count ? (f64) (filter->block_count*BLOOM_FILTER_BLOCK_WORDS*32) / (f64) filter->count : 0;
+}
+
+//=================== Cuckoo_Filter ===================
+INTERNAL uint16_t _cuckoo_filter_fingerprint(uint64_t hash)
+{
+    //Top bits so that they are independent from the bucket index taken from the bottom bits. 0 is reserved for empty.
+    uint16_t fingerprint = (uint16_t) (hash >> 48);
+    return fingerprint ? fingerprint : 1;
+}
+
+INTERNAL isize _cuckoo_filter_alternate(const Cuckoo_Filter* filter, isize bucket, uint16_t fingerprint)
+{
+    //Xoring with the hash of the fingerprint is its own inverse so we can go back and forth
+    // between the two buckets knowing only the fingerprint.
+    return (isize) (((uint64_t) bucket ^ hash64_bijective(fingerprint)) & (uint64_t) (filter->bucket_count - 1));
+}
+
+INTERNAL bool _cuckoo_filter_bucket_add(Cuckoo_Filter* filter, isize bucket, uint16_t fingerprint)
+{
+    uint16_t* slots = filter->fingerprints + bucket*CUCKOO_FILTER_BUCKET_SIZE;
+    for(isize i = 0; i < CUCKOO_FILTER_BUCKET_SIZE; i++)
+        if(slots[i] == 0) {
+            slots[i] = fingerprint;
+            return true;
+        }
+    return false;
+}
+
+INTERNAL bool _cuckoo_filter_bucket_remove(Cuckoo_Filter* filter, isize bucket, uint16_t fingerprint)
+{
+    uint16_t* slots = filter->fingerprints + bucket*CUCKOO_FILTER_BUCKET_SIZE;
+    for(isize i = 0; i < CUCKOO_FILTER_BUCKET_SIZE; i++)
+        if(slots[i] == fingerprint) {
+            slots[i] = 0;
+            return true;
+        }
+    return false;
+}
+
+INTERNAL bool _cuckoo_filter_bucket_contains(const Cuckoo_Filter* filter, isize bucket, uint16_t fingerprint)
+{
+    const uint16_t* slots = filter->fingerprints + bucket*CUCKOO_FILTER_BUCKET_SIZE;
+    return (slots[0] == fingerprint) | (slots[1] == fingerprint) | (slots[2] == fingerprint) | (slots[3] == fingerprint);
+}
+
+EXTERNAL void cuckoo_filter_deinit(Cuckoo_Filter* filter)
+{
+    if(filter->fingerprints)
+        allocator_deallocate(filter->allocator, filter->fingerprints, filter->bucket_count*CUCKOO_FILTER_BUCKET_SIZE*sizeof(uint16_t), 64);
+    memset(filter, 0, sizeof *filter);
+}
+
+EXTERNAL void cuckoo_filter_init(Cuckoo_Filter* filter, Allocator* alloc_or_null, isize expected_count)
+{
+    cuckoo_filter_deinit(filter);
+    //Cuckoo filters with buckets of four can be filled up to ~95% before insertions start failing.
+    isize needed_buckets = (isize) ((f64) MAX(expected_count, 1) / (CUCKOO_FILTER_BUCKET_SIZE*0.95)) + 1;
+    isize bucket_count = 2;
+    while(bucket_count < needed_buckets)
+        bucket_count *= 2;
+
+    filter->allocator = alloc_or_null ? alloc_or_null : allocator_get_default();
+    filter->bucket_count = bucket_count;
+    filter->fingerprints = (uint16_t*) allocator_allocate(filter->allocator, bucket_count*CUCKOO_FILTER_BUCKET_SIZE*sizeof(uint16_t), 64);
+    cuckoo_filter_clear(filter);
+}
+
+EXTERNAL void cuckoo_filter_clear(Cuckoo_Filter* filter)
+{
+    if(filter->fingerprints)
+        memset(filter->fingerprints, 0, filter->bucket_count*CUCKOO_FILTER_BUCKET_SIZE*sizeof(uint16_t));
+    filter->count = 0;
+    filter->victim = 0;
+    filter->victim_bucket = 0;
+}
+
+EXTERNAL bool cuckoo_filter_insert(Cuckoo_Filter* filter, uint64_t hash)
+{
+    ASSERT(filter->fingerprints, "must be initialized");
+    if(filter->victim != 0)
+        return false;
+
+    uint16_t fingerprint = _cuckoo_filter_fingerprint(hash);
+    isize bucket = (isize) (hash & (uint64_t) (filter->bucket_count - 1));
+    isize alternate = _cuckoo_filter_alternate(filter, bucket, fingerprint);
+    if(_cuckoo_filter_bucket_add(filter, bucket, fingerprint) || _cuckoo_filter_bucket_add(filter, alternate, fingerprint)) {
+        filter->count += 1;
+        return true;
+    }
+
+    //Both buckets are full. Kick out random fingerprint and move it to its alternate bucket, repeat.
+    // The randomness is derived from the hash so that the filter is deterministic.
+    uint64_t random = hash;
+    bucket = random & ((uint64_t) 1 << 63) ? alternate : bucket;
+    for(isize kick = 0; kick < CUCKOO_FILTER_MAX_KICKS; kick++) {
+        random = hash64_bijective(random + 1);
+        uint16_t* slot = filter->fingerprints + bucket*CUCKOO_FILTER_BUCKET_SIZE + (random % CUCKOO_FILTER_BUCKET_SIZE);
+        uint16_t kicked = *slot;
+        *slot = fingerprint;
+        fingerprint = kicked;
+        filter->kicks += 1;
+
+        bucket = _cuckoo_filter_alternate(filter, bucket, fingerprint);
+        if(_cuckoo_filter_bucket_add(filter, bucket, fingerprint)) {
+            filter->count += 1;
+            return true;
+        }
+    }
+
+    //We have placed our fingerprint but now hold some other one which does not fit anywhere.
+    // Keep it on the side so that no inserted key is lost. From now on the filter is considered full.
+    filter->victim = fingerprint;
+    filter->victim_bucket = bucket;
+    filter->count += 1;
+    return true;
+}
+
+EXTERNAL bool cuckoo_filter_contains(const Cuckoo_Filter* filter, uint64_t hash)
+{
+    if(filter->fingerprints == NULL)
+        return false;
+
+    uint16_t fingerprint = _cuckoo_filter_fingerprint(hash);
+    isize bucket = (isize) (hash & (uint64_t) (filter->bucket_count - 1));
+    isize alternate = _cuckoo_filter_alternate(filter, bucket, fingerprint);
+    if(filter->victim == fingerprint && (filter->victim_bucket == bucket || filter->victim_bucket == alternate))
+        return true;
+
+    return _cuckoo_filter_bucket_contains(filter, bucket, fingerprint)
+        || _cuckoo_filter_bucket_contains(filter, alternate, fingerprint);
+}
+
+EXTERNAL bool cuckoo_filter_remove(Cuckoo_Filter* filter, uint64_t hash)
+{
+    if(filter->fingerprints == NULL)
+        return false;
+
+    uint16_t fingerprint = _cuckoo_filter_fingerprint(hash);
+    isize bucket = (isize) (hash & (uint64_t) (filter->bucket_count - 1));
+    isize alternate = _cuckoo_filter_alternate(filter, bucket, fingerprint);
+    bool removed = false;
+    if(filter->victim == fingerprint && (filter->victim_bucket == bucket || filter->victim_bucket == alternate)) {
+        filter->victim = 0;
+        removed = true;
+    }
+    else
+        removed = _cuckoo_filter_bucket_remove(filter, bucket, fingerprint)
+            || _cuckoo_filter_bucket_remove(filter, alternate, fingerprint);
+
+    if(removed) {
+        filter->count -= 1;
+        //We might have made space for the victim in one of its two buckets
+        if(filter->victim != 0) {
+            isize victim_alternate = _cuckoo_filter_alternate(filter, filter->victim_bucket, filter->victim);
+            if(_cuckoo_filter_bucket_add(filter, filter->victim_bucket, filter->victim)
+                || _cuckoo_filter_bucket_add(filter, victim_alternate, filter->victim))
+                filter->victim = 0;
+        }
+    }
+    return removed;
+}
+
+EXTERNAL f64 cuckoo_filter_bits_per_key(const Cuckoo_Filter* filter)
+{
+    return filter->count ? (f64) (filter->bucket_count*CUCKOO_FILTER_BUCKET_SIZE*16) / (f64) filter->count : 0;
+}
+
+//=================== Fuse_Filter ===================
+INTERNAL uint64_t _fuse_filter_mix(uint64_t hash, uint64_t seed)
+{
+    return hash64_bijective(hash + seed);
+}
+
+INTERNAL uint8_t _fuse_filter_fingerprint(uint64_t mixed)
+{
+    return (uint8_t) (mixed ^ (mixed >> 32));
+}
+
+//The three positions are in three consecutive segments. Because segments are small and consecutive they
+// are close in memory and the construction tends to go through them in order, which is what makes binary fuse filters
+// much faster to build than xor filters.
+INTERNAL void _fuse_filter_positions(const Fuse_Filter* filter, uint64_t mixed, uint32_t positions[3])
+{
+    uint32_t h0 = (uint32_t) _filter_mulhi(mixed, filter->segment_count_length);
+    uint32_t h1 = h0 + filter->segment_length;
+    uint32_t h2 = h1 + filter->segment_length;
+    h1 ^= (uint32_t) (mixed >> 18) & filter->segment_length_mask;
+    h2 ^= (uint32_t) mixed & filter->segment_length_mask;
+    positions[0] = h0;
+    positions[1] = h1;
+    positions[2] = h2;
+}
+
+INTERNAL int _fuse_filter_hash_compare(const void* a, const void* b)
+{
+    uint64_t x = *(const uint64_t*) a;
+    uint64_t y = *(const uint64_t*) b;
+    return (x > y) - (x < y);
+}
+
+EXTERNAL void fuse_filter_deinit(Fuse_Filter* filter)
+{
+    if(filter->fingerprints)
+        allocator_deallocate(filter->allocator, filter->fingerprints, filter->fingerprint_count, 64);
+    memset(filter, 0, sizeof *filter);
+}
+
+EXTERNAL bool fuse_filter_build(Fuse_Filter* filter, Allocator* alloc_or_null, const uint64_t* hashes, isize count)
+{
+    PROFILE_START();
+    fuse_filter_deinit(filter);
+    filter->allocator = alloc_or_null ? alloc_or_null : allocator_get_default();
+
+    //Sizing as described in the paper for arity 3
+    isize segment_length = count == 0 ? 4 : (isize) 1 << (int) floor(log((f64) count) / log(3.33) + 2.25);
+    segment_length = MIN(segment_length, 1 << 18);
+    f64 size_factor = count <= 1 ? 0 : fmax(1.125, 0.875 + 0.25*log(1000000.0)/log((f64) count));
+    isize capacity = (isize) round((f64) count*size_factor);
+    isize segment_count = (capacity + segment_length - 1)/segment_length - 2;
+    segment_count = MAX(segment_count, 1);
+    isize array_length = (segment_count + 2)*segment_length;
+    ASSERT(array_length <= UINT32_MAX);
+
+    filter->segment_length = (uint32_t) segment_length;
+    filter->segment_length_mask = (uint32_t) segment_length - 1;
+    filter->segment_count = (uint32_t) segment_count;
+    filter->segment_count_length = (uint32_t) (segment_count*segment_length);
+    filter->fingerprint_count = array_length;
+    filter->fingerprints = (uint8_t*) allocator_allocate(filter->allocator, array_length, 64);
+    memset(filter->fingerprints, 0, array_length);
+
+    //Temporary memory:
+    // counts     - number of keys mapped to each position times 4 xored with the index (0, 1, 2) of the position within the key.
+    //              When only a single key is left the bottom two bits thus tell which of its positions this is.
+    // xored      - xor of all mixed hashes mapped to each position. When only a single key is left this is its mixed hash.
+    // queue      - positions with single key left
+    // peeled     - mixed hashes in the order they were peeled off
+    // peeled_pos - which of the positions of each peeled key it was peeled from
+    // unique     - deduplicated copy of the input, only allocated if the build fails
+    isize temp_size = array_length*(sizeof(uint32_t) + sizeof(uint64_t) + sizeof(uint32_t)) + count*(sizeof(uint64_t) + sizeof(uint8_t));
+    uint8_t* temp = (uint8_t*) allocator_allocate(filter->allocator, temp_size, 8);
+    uint64_t* xored = (uint64_t*) (void*) temp;
+    uint64_t* peeled = xored + array_length;
+    uint32_t* counts = (uint32_t*) (void*) (peeled + count);
+    uint32_t* queue = counts + array_length;
+    uint8_t* peeled_pos = (uint8_t*) (queue + array_length);
+
+    uint64_t* unique = NULL;
+    isize unique_count = count;
+    const uint64_t* keys = hashes;
+
+    bool success = false;
+    for(isize attempt = 0; attempt < FUSE_FILTER_MAX_ATTEMPTS && success == false; attempt++) {
+        //Duplicate keys never peel off since they cancel out in xored.
+        // We only pay for removing them when the first attempt fails.
+        if(attempt == 1) {
+            unique = (uint64_t*) allocator_allocate(filter->allocator, count*sizeof(uint64_t), 8);
+            memcpy(unique, hashes, count*sizeof(uint64_t));
+            qsort(unique, (size_t) count, sizeof(uint64_t), _fuse_filter_hash_compare);
+            unique_count = 0;
+            for(isize i = 0; i < count; i++)
+                if(unique_count == 0 || unique[unique_count - 1] != unique[i])
+                    unique[unique_count++] = unique[i];
+            keys = unique;
+        }
+
+        filter->seed = hash64_bijective((uint64_t) attempt + 0x9E3779B97F4A7C15ULL);
+        memset(counts, 0, array_length*sizeof(uint32_t));
+        memset(xored, 0, array_length*sizeof(uint64_t));
+        for(isize i = 0; i < unique_count; i++) {
+            uint64_t mixed = _fuse_filter_mix(keys[i], filter->seed);
+            uint32_t positions[3];
+            _fuse_filter_positions(filter, mixed, positions);
+            for(uint32_t k = 0; k < 3; k++) {
+                counts[positions[k]] = (counts[positions[k]] + 4) ^ k;
+                xored[positions[k]] ^= mixed;
+            }
+        }
+
+        isize queue_size = 0;
+        for(isize i = 0; i < array_length; i++)
+            if(counts[i] >> 2 == 1)
+                queue[queue_size++] = (uint32_t) i;
+
+        isize peeled_count = 0;
+        while(queue_size > 0) {
+            uint32_t index = queue[--queue_size];
+            if(counts[index] >> 2 != 1)
+                continue;
+
+            uint64_t mixed = xored[index];
+            uint32_t found = counts[index] & 3;
+            peeled[peeled_count] = mixed;
+            peeled_pos[peeled_count] = (uint8_t) found;
+            peeled_count += 1;
+
+            uint32_t positions[3];
+            _fuse_filter_positions(filter, mixed, positions);
+            for(uint32_t k = 0; k < 3; k++) {
+                uint32_t other = positions[k];
+                if(k == found)
+                    counts[other] = 0;
+                else {
+                    counts[other] = (counts[other] - 4) ^ k;
+                    xored[other] ^= mixed;
+                    if(counts[other] >> 2 == 1)
+                        queue[queue_size++] = other;
+                }
+            }
+        }
+
+        success = peeled_count == unique_count;
+        if(success) {
+            //Assign in reverse peeling order. Each key is the last one to touch its peeled position
+            // so we can set it so that the xor of all three positions gives its fingerprint.
+            for(isize i = peeled_count; i-- > 0; ) {
+                uint64_t mixed = peeled[i];
+                uint32_t found = peeled_pos[i];
+                uint32_t positions[3];
+                _fuse_filter_positions(filter, mixed, positions);
+                filter->fingerprints[positions[found]] = _fuse_filter_fingerprint(mixed)
+                    ^ filter->fingerprints[positions[(found + 1) % 3]]
+                    ^ filter->fingerprints[positions[(found + 2) % 3]];
+            }
+        }
+    }
+
+    if(unique)
+        allocator_deallocate(filter->allocator, unique, count*sizeof(uint64_t), 8);
+    allocator_deallocate(filter->allocator, temp, temp_size, 8);
+
+    if(success)
+        filter->count = unique_count;
+    else
+        fuse_filter_deinit(filter);
+
+    PROFILE_STOP();
+    return success;
+}
+
+EXTERNAL bool fuse_filter_contains(const Fuse_Filter* filter, uint64_t hash)
+{
+    if(filter->count == 0)
+        return false;
+
+    uint64_t mixed = _fuse_filter_mix(hash, filter->seed);
+    uint32_t positions[3];
+    _fuse_filter_positions(filter, mixed, positions);
+    uint8_t xored = filter->fingerprints[positions[0]] ^ filter->fingerprints[positions[1]] ^ filter->fingerprints[positions[2]];
+    return xored == _fuse_filter_fingerprint(mixed);
+}
+
+EXTERNAL f64 fuse_filter_bits_per_key(const Fuse_Filter* filter)
+{
+    return filter->count ? (f64) (filter->fingerprint_count*8) / (f64) filter->count : 0;
+}
+
+#endif
@@ -0,0 +1,381 @@
+#ifndef MODULE_FROZEN
+#define MODULE_FROZEN
+
+//Read only snapshots of Array and Stable meant to be shared between forked worker processes.
+//
+//After fork the parent and the workers share all memory copy on write. Any write to a shared page - even an incidental
+// one like bumping a refcount, a stats counter or writing into a malloc header next to the data - makes the OS copy the
+// whole page into the writing process. With 32 workers a dataset built up in the parent can this way slowly turn into 33
+// private copies. Stable is especially prone to this as its items are spread over many separate allocations which share
+// pages with unrelated (and written) data and the data is only reachable by chasing Stable_Block.ptr.
+//
+//Freezing copies the container into a single contiguous region which is then made read only. The region contains only
+// offsets, never pointers, so it can be mapped at any address. Nothing else lives on its pages and nothing can write to them
+// (an accidental write crashes instead of silently copying the page) so all processes keep sharing a single physical copy.
+// Frozen Stable keeps the indices of the original: item at index i is at items + i*item_size and its liveness is the bit
+// i % 64 of masks[i / 64]. Dead slots are zero.
+//
+//The region is either anonymous memory (shared with the workers forked after freezing) or, when a path is given, a file
+// mapped shared read only. The file can then also be opened by unrelated processes with frozen_open. Passing a path on
+// a memory file system (for example /dev/shm on linux) gives the same as a memfd without touching the disk.
+//
+//Layout:
+//   [Frozen_Header] [padding to FROZEN_SECTION_ALIGN] [masks: capacity/64 * uint64_t] [padding] [items: capacity * item_size]
+
+#include "stable.h"
+#include "allocator.h"
+#include "platform.h"
+#include "profile.h"
+#include "hash_func.h"
+#include "assert.h"
+#include "defines.h"
+
+#define FROZEN_MAGIC "FROZENDS"
+#define FROZEN_VERSION 1
+#define FROZEN_SECTION_ALIGN 64 //each section starts on its own cache line
+
+typedef enum Frozen_Kind {
+    FROZEN_KIND_ARRAY = 1,
+    FROZEN_KIND_STABLE = 2,
+} Frozen_Kind;
+
+typedef enum Frozen_Error {
+    FROZEN_OK = 0,
+    FROZEN_ERROR_IO,        //the memory could not be obtained or the file could not be opened/written/mapped. See the platform error for details
+    FROZEN_ERROR_INVALID,   //the file is not a frozen region, is of different version or is truncated
+} Frozen_Error;
+
+typedef struct Frozen_Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t kind;
+
+    uint32_t item_size;
+    uint32_t item_align;
+    uint64_t count;         //number of (alive) items
+    uint64_t capacity;      //number of item slots. Same as count for Array and a multiple of STABLE_BLOCK_SIZE for Stable
+
+    uint64_t masks_offset;  //0 for Array
+    uint64_t items_offset;
+    uint64_t region_size;
+    uint64_t header_hash;   //hash of all the preceeding fields
+} Frozen_Header;
+
+//Only describes the region. Is filled once by the process which freezes or opens and is then only read.
+typedef struct Frozen {
+    const uint8_t* region;
+    isize region_size;
+    const uint64_t* masks;  //NULL for Array
+    const uint8_t* items;
+    isize count;
+    isize capacity;
+    isize item_size;
+    uint32_t kind;
+    uint32_t is_file;
+} Frozen;
+
+//Copies the array/stable into a new read only region. If path_or_empty is not empty the region is also written to that file
+// and the file is mapped instead of anonymous memory.
+EXTERNAL Frozen_Error frozen_from_array(Frozen* frozen, const void* data, isize count, isize item_size, isize item_align, Platform_String path_or_empty, Platform_Error* error_or_null);
+EXTERNAL Frozen_Error frozen_from_stable(Frozen* frozen, const Stable* stable, Platform_String path_or_empty, Platform_Error* error_or_null);
+EXTERNAL Frozen_Error frozen_open(Frozen* frozen, Platform_String path, Platform_Error* error_or_null);
+EXTERNAL void         frozen_close(Frozen* frozen);
+EXTERNAL const char*  frozen_error_to_string(Frozen_Error error);
+
+EXTERNAL isize _frozen_next_alive_slow(const Frozen* frozen, isize from);
+
+#define FROZEN_FROM_ARRAY(frozen, array_ptr, path_or_empty, error_or_null) \
+    frozen_from_array((frozen), (array_ptr)->data, (array_ptr)->count, sizeof *(array_ptr)->data, sizeof *(array_ptr)->ALIGN, (path_or_empty), (error_or_null))
+
+#define FROZEN_DATA(frozen_ptr, T) ((const T*) (const void*) (frozen_ptr)->items)
+
+//Iterates all alive indices in increasing order
+#define FROZEN_FOR(frozen_ptr, index) \
+    for(isize index = frozen_next_alive((frozen_ptr), 0); index < (frozen_ptr)->capacity; index = frozen_next_alive((frozen_ptr), index + 1))
+
+inline static bool frozen_is_alive(const Frozen* frozen, isize index)
+{
+    if(0 <= index && index < frozen->capacity)
+        return frozen->masks == NULL || (frozen->masks[(size_t) index / STABLE_BLOCK_SIZE] >> ((size_t) index % STABLE_BLOCK_SIZE) & 1);
+    return false;
+}
+
+//returns the first alive index in [from, capacity) or capacity if there is none. 
+// Only scanning over dead items is out of line.
+inline static isize frozen_next_alive(const Frozen* frozen, isize from)
+{
+    if(from < frozen->capacity && (frozen->masks == NULL || (frozen->masks[(size_t) from / STABLE_BLOCK_SIZE] >> ((size_t) from % STABLE_BLOCK_SIZE) & 1)))
+        return from;
+    return _frozen_next_alive_slow(frozen, from);
+}
+
+//returns the item at index which must be alive (asserts).
+inline static const void* frozen_at(const Frozen* frozen, isize index)
+{
+    ASSERT(frozen_is_alive(frozen, index));
+    return frozen->items + frozen->item_size*index;
+}
+
+//returns the item at index or if_not_found if the index is not from the valid range or the item is dead.
+inline static const void* frozen_at_or(const Frozen* frozen, isize index, const void* if_not_found)
+{
+    if(frozen_is_alive(frozen, index))
+        return frozen->items + frozen->item_size*index;
+    return if_not_found;
+}
+#endif
+
+#if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_FROZEN)) && !defined(MODULE_HAS_IMPL_FROZEN)
+#define MODULE_HAS_IMPL_FROZEN
+
+INTERNAL uint64_t _frozen_header_hash(const Frozen_Header* header)
+{
+    return xxhash64(header, offsetof(Frozen_Header, header_hash), 0);
+}
+
+INTERNAL uint64_t _frozen_align_up(uint64_t value, uint64_t align)
+{
+    return (value + align - 1) & ~(align - 1);
+}
+
+INTERNAL Frozen_Header _frozen_header_make(Frozen_Kind kind, isize count, isize capacity, isize item_size, isize item_align)
+{
+    REQUIRE(item_size > 0 && is_power_of_two(item_align) && count >= 0 && capacity >= count);
+    uint64_t section_align = (uint64_t) MAX(item_align, FROZEN_SECTION_ALIGN);
+
+    Frozen_Header header = {0};
+    memcpy(header.magic, FROZEN_MAGIC, sizeof header.magic);
+    header.version = FROZEN_VERSION;
+    header.kind = kind;
+    header.item_size = (uint32_t) item_size;
+    header.item_align = (uint32_t) item_align;
+    header.count = (uint64_t) count;
+    header.capacity = (uint64_t) capacity;
+
+    uint64_t at = _frozen_align_up(sizeof(Frozen_Header), FROZEN_SECTION_ALIGN);
+    if(kind == FROZEN_KIND_STABLE) {
+        header.masks_offset = at;
+        at += (uint64_t) capacity/STABLE_BLOCK_SIZE*sizeof(uint64_t);
+    }
+    header.items_offset = _frozen_align_up(at, section_align);
+    header.region_size = header.items_offset + (uint64_t) capacity*(uint64_t) item_size;
+    header.header_hash = _frozen_header_hash(&header);
+    return header;
+}
+
+//The masks have to lie between the header and the items and be aligned for uint64_t reads.
+INTERNAL bool _frozen_masks_are_valid(const Frozen_Header* header)
+{
+    uint64_t masks_size = header->capacity/STABLE_BLOCK_SIZE*sizeof(uint64_t);
+    return header->masks_offset >= sizeof(Frozen_Header)
+        && header->masks_offset % sizeof(uint64_t) == 0
+        && header->masks_offset <= header->items_offset
+        && masks_size <= header->items_offset - header->masks_offset;
+}
+
+INTERNAL void _frozen_set(Frozen* frozen, const uint8_t* region, isize region_size, const Frozen_Header* header, bool is_file)
+{
+    frozen->region = region;
+    frozen->region_size = region_size;
+    frozen->masks = header->masks_offset ? (const uint64_t*) (const void*) (region + header->masks_offset) : NULL;
+    frozen->items = region + header->items_offset;
+    frozen->count = (isize) header->count;
+    frozen->capacity = (isize) header->capacity;
+    frozen->item_size = (isize) header->item_size;
+    frozen->kind = header->kind;
+    frozen->is_file = is_file;
+}
+
+//Maps the region described by header at path read only.
+INTERNAL Frozen_Error _frozen_map_file(Frozen* frozen, Platform_String path, Frozen_Header header, Platform_Error* error)
+{
+    Platform_File file = {0};
+    uint8_t* mapped = NULL;
+    *error = platform_file_open(&file, path, PLATFORM_FILE_OPEN_READ);
+    if(*error == 0)
+        *error = platform_file_map((void**) &mapped, &file, 0, (isize) header.region_size, PLATFORM_FILE_MAP_READ);
+    platform_file_close(&file);
+
+    if(*error)
+        return FROZEN_ERROR_IO;
+
+    _frozen_set(frozen, mapped, (isize) header.region_size, &header, true);
+    return FROZEN_OK;
+}
+
+//Obtains zeroed writable memory, lets fill write the region into it and then either makes it read only or writes it
+// into the file at path and maps it instead.
+INTERNAL Frozen_Error _frozen_make(Frozen* frozen, Frozen_Header header, void (*fill)(uint8_t* region, const Frozen_Header* header, const void* context), const void* context, Platform_String path_or_empty, Platform_Error* error_or_null)
+{
+    PROFILE_START();
+    frozen_close(frozen);
+
+    Frozen_Error out = FROZEN_OK;
+    isize reserved_size = (isize) _frozen_align_up(header.region_size, (uint64_t) platform_allocation_granularity());
+    uint8_t* region = NULL;
+    Platform_Error error = platform_virtual_reallocate((void**) &region, NULL, reserved_size, PLATFORM_VIRTUAL_ALLOC_RESERVE | PLATFORM_VIRTUAL_ALLOC_COMMIT, PLATFORM_MEMORY_PROT_READ_WRITE);
+    if(error == 0) {
+        memcpy(region, &header, sizeof header);
+        fill(region, &header, context);
+    }
+
+    if(error == 0 && path_or_empty.count == 0) {
+        error = platform_virtual_reallocate(NULL, region, reserved_size, PLATFORM_VIRTUAL_ALLOC_COMMIT, PLATFORM_MEMORY_PROT_READ);
+        if(error == 0)
+            _frozen_set(frozen, region, reserved_size, &header, false);
+    }
+
+    if(error == 0 && path_or_empty.count > 0) {
+        Platform_File file = {0};
+        error = platform_file_open(&file, path_or_empty, PLATFORM_FILE_OPEN_WRITE | PLATFORM_FILE_OPEN_CREATE | PLATFORM_FILE_OPEN_REMOVE_CONTENT);
+        if(error == 0)
+            error = platform_file_write(&file, region, (isize) header.region_size, 0);
+        platform_file_close(&file);
+
+        platform_virtual_reallocate(NULL, region, reserved_size, PLATFORM_VIRTUAL_ALLOC_RELEASE, PLATFORM_MEMORY_PROT_NO_ACCESS);
+        region = NULL;
+        if(error == 0)
+            out = _frozen_map_file(frozen, path_or_empty, header, &error);
+    }
+
+    if(error) {
+        if(region && frozen->region == NULL)
+            platform_virtual_reallocate(NULL, region, reserved_size, PLATFORM_VIRTUAL_ALLOC_RELEASE, PLATFORM_MEMORY_PROT_NO_ACCESS);
+        out = FROZEN_ERROR_IO;
+    }
+
+    if(error_or_null)
+        *error_or_null = error;
+    PROFILE_STOP();
+    return out;
+}
+
+INTERNAL void _frozen_fill_array(uint8_t* region, const Frozen_Header* header, const void* context)
+{
+    if(header->count > 0)
+        memcpy(region + header->items_offset, context, (size_t) (header->count*header->item_size));
+}
+
+INTERNAL void _frozen_fill_stable(uint8_t* region, const Frozen_Header* header, const void* context)
+{
+    const Stable* stable = (const Stable*) context;
+    uint64_t* masks = (uint64_t*) (void*) (region + header->masks_offset);
+    uint8_t* items = region + header->items_offset;
+    isize block_bytes = STABLE_BLOCK_SIZE*(isize) header->item_size;
+    for(uint32_t b = 0; b < stable->blocks_count; b++)
+    {
+        Stable_Block* block = &stable->blocks[b];
+        uint8_t* into = items + b*block_bytes;
+        masks[b] = block->mask;
+        if(block->mask == UINT64_MAX)
+            memcpy(into, block->ptr, (size_t) block_bytes);
+        else
+            for(uint64_t mask = block->mask; mask; mask &= mask - 1) {
+                isize i = _stable_find_first_set_bit64(mask);
+                memcpy(into + i*(isize) header->item_size, block->ptr + i*(isize) header->item_size, header->item_size);
+            }
+    }
+}
+
+EXTERNAL Frozen_Error frozen_from_array(Frozen* frozen, const void* data, isize count, isize item_size, isize item_align, Platform_String path_or_empty, Platform_Error* error_or_null)
+{
+    Frozen_Header header = _frozen_header_make(FROZEN_KIND_ARRAY, count, count, item_size, item_align);
+    return _frozen_make(frozen, header, _frozen_fill_array, data, path_or_empty, error_or_null);
+}
+
+EXTERNAL Frozen_Error frozen_from_stable(Frozen* frozen, const Stable* stable, Platform_String path_or_empty, Platform_Error* error_or_null)
+{
+    Frozen_Header header = _frozen_header_make(FROZEN_KIND_STABLE, stable->count, stable_capacity(stable), stable->item_size, stable->item_align);
+    return _frozen_make(frozen, header, _frozen_fill_stable, stable, path_or_empty, error_or_null);
+}
+
+EXTERNAL Frozen_Error frozen_open(Frozen* frozen, Platform_String path, Platform_Error* error_or_null)
+{
+    PROFILE_START();
+    frozen_close(frozen);
+
+    Frozen_Error out = FROZEN_OK;
+    Frozen_Header header = {0};
+    isize file_size = 0;
+    isize read = 0;
+
+    Platform_File file = {0};
+    Platform_Error error = platform_file_open(&file, path, PLATFORM_FILE_OPEN_READ);
+    if(error == 0)
+        error = platform_file_size(&file, &file_size);
+    if(error == 0 && file_size < (isize) sizeof header)
+        out = FROZEN_ERROR_INVALID;
+    if(error == 0 && out == FROZEN_OK)
+        error = platform_file_read(&file, &header, sizeof header, 0, &read);
+    platform_file_close(&file);
+
+    if(error == 0 && out == FROZEN_OK) {
+        bool is_stable = header.kind == FROZEN_KIND_STABLE;
+        if(memcmp(header.magic, FROZEN_MAGIC, sizeof header.magic) != 0
+            || header.version != FROZEN_VERSION
+            || header.header_hash != _frozen_header_hash(&header)
+            || (header.kind != FROZEN_KIND_ARRAY && is_stable == false)
+            || header.item_size == 0
+            || (header.item_align & (header.item_align - 1)) != 0
+            || header.count > header.capacity
+            || (is_stable ? header.capacity % STABLE_BLOCK_SIZE != 0 : header.capacity != header.count)
+            || header.items_offset % MAX(header.item_align, FROZEN_SECTION_ALIGN) != 0
+            || header.items_offset < sizeof(Frozen_Header)
+            || (is_stable ? _frozen_masks_are_valid(&header) == false : header.masks_offset != 0)
+            || header.capacity > (UINT64_MAX - header.items_offset)/header.item_size
+            || header.region_size != header.items_offset + header.capacity*header.item_size
+            || header.region_size > (uint64_t) file_size)
+            out = FROZEN_ERROR_INVALID;
+    }
+
+    if(error == 0 && out == FROZEN_OK)
+        out = _frozen_map_file(frozen, path, header, &error);
+    if(error)
+        out = FROZEN_ERROR_IO;
+
+    if(error_or_null)
+        *error_or_null = error;
+    PROFILE_STOP();
+    return out;
+}
+
+EXTERNAL void frozen_close(Frozen* frozen)
+{
+    if(frozen->region) {
+        if(frozen->is_file)
+            platform_file_unmap((void*) frozen->region, frozen->region_size);
+        else
+            platform_virtual_reallocate(NULL, (void*) frozen->region, frozen->region_size, PLATFORM_VIRTUAL_ALLOC_RELEASE, PLATFORM_MEMORY_PROT_NO_ACCESS);
+    }
+    memset(frozen, 0, sizeof *frozen);
+}
+
+EXTERNAL const char* frozen_error_to_string(Frozen_Error error)
+{
+    switch(error) {
+        case FROZEN_OK: return "ok";
+        case FROZEN_ERROR_IO: return "io error";
+        case FROZEN_ERROR_INVALID: return "invalid frozen file";
+        default: return "unknown error";
+    }
+}
+
+EXTERNAL isize _frozen_next_alive_slow(const Frozen* frozen, isize from)
+{
+    if(from >= frozen->capacity)
+        return frozen->capacity;
+    if(frozen->masks == NULL)
+        return from;
+
+    size_t block_i = (size_t) from / STABLE_BLOCK_SIZE;
+    size_t block_count = (size_t) frozen->capacity / STABLE_BLOCK_SIZE;
+    uint64_t mask = frozen->masks[block_i] & (UINT64_MAX << ((size_t) from % STABLE_BLOCK_SIZE));
+    while(mask == 0) {
+        if(++block_i >= block_count)
+            return frozen->capacity;
+        mask = frozen->masks[block_i];
+    }
+    return (isize) (block_i*STABLE_BLOCK_SIZE) + _stable_find_first_set_bit64(mask);
+}
+
+#endif
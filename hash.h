@@ -5,6 +5,7 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
+#include "allocator_dispatch_default.h"
 
 typedef int64_t isize;
 typedef void* (*Allocator)(void* alloc, int mode, int64_t new_size, void* old_ptr, int64_t old_size, int64_t align, void* other);
@@ -150,6 +151,12 @@ EXTERNAL void  hash_backlink_copy_rehash(Hash* to_table, const Hash* from_table,
         return it;
     }
 
+    INTERNAL void _hash_it_advance(const Hash* table, Hash_Iter* it)
+    {
+        it->index = (it->index + (uint64_t) it->iter) & (table->capacity - 1);
+        it->iter += 1; 
+    }
+
     INTERNAL bool _hash_find_next(const Hash* table, uint64_t hash, Hash_Iter* it)
     {
         if(table->count > 0)
@@ -261,7 +268,7 @@ EXTERNAL void  hash_backlink_copy_rehash(Hash* to_table, const Hash* from_table,
     {
         #ifndef USE_MALLOC
             ASSERT(alloc);
-            return (*alloc)(alloc, 0, new_size, old_ptr, old_size, align, NULL);
+            return ALLOCATOR_DISPATCH(alloc, new_size, old_ptr, old_size, align);
         #else
             if(new_size != 0) {
                 void* out = realloc(old_ptr, new_size);
@@ -431,10 +438,8 @@ EXTERNAL void  hash_backlink_copy_rehash(Hash* to_table, const Hash* from_table,
         _hash_check_consistency(table);
         if(it->iter == 0)
             *it = _hash_it_make(table, hash);
-        else {
-            it->index = (it->index + (uint64_t) it->iter) & (table->capacity - 1);
-            it->iter += 1; 
-        }
+        else
+            _hash_it_advance(table, it);
         return _hash_find_next(table, hash, it);
     }
     
@@ -449,14 +454,14 @@ EXTERNAL void  hash_backlink_copy_rehash(Hash* to_table, const Hash* from_table,
     EXTERNAL isize hash_remove_with_value(Hash* table, uint64_t hash, uint64_t value)
     {
         isize count = 0;
-        for(Hash_Iter it = _hash_it_make(table, hash); _hash_find_next(table, hash, &it); )
+        for(Hash_Iter it = _hash_it_make(table, hash); _hash_find_next(table, hash, &it); _hash_it_advance(table, &it))
             if(it.entry->value == value)
                 count += hash_remove(table, it.index);
         return count;
     }
     EXTERNAL bool hash_find_with_value(const Hash* table, uint64_t hash, uint64_t value, isize* index)
     {
-        for(Hash_Iter it = _hash_it_make(table, hash); _hash_find_next(table, hash, &it); )
+        for(Hash_Iter it = _hash_it_make(table, hash); _hash_find_next(table, hash, &it); _hash_it_advance(table, &it))
             if(it.entry->value == value)
             {
                 if(index) *index = it.index;
@@ -0,0 +1,233 @@
+#ifndef MODULE_HASH_PARALLEL
+#define MODULE_HASH_PARALLEL
+
+//Bulk building of Hash on multiple threads.
+//
+//Inserting hundreds of millions of entries one by one is bound by the latency of the random memory access of each insert.
+// Since the accesses are independent we could just do them from multiple threads at once, except that two threads inserting
+// into the same table would race on the slots. We avoid that by splitting the table into P contiguous regions of slots and
+// partitioning the input by the region its home slot (hash & mask) falls into. Each region is then filled by exactly one thread.
+//
+//The only problem is that quadratic probing can jump out of the region the entry started in. When that happens we dont
+// place the entry and instead remember it as overflow. After all regions are done the overflowing entries are inserted
+// with the regular single threaded hash_insert. The result is exactly what some sequence of hash_insert calls would produce:
+// each entry sits at the first free slot of its probe sequence at the time of its placement and since we never remove
+// anything nothing before it can become empty. With regions of tens of thousands of slots and load at most 3/4 only a tiny
+// fraction of entries (those hashing close to the end of the region) overflows.
+//
+//The build is done in three phases separated by barriers:
+// 1. Each thread counts how many entries of its chunk of the input fall into each region (histogram).
+// 2. Each thread computes where its entries of each region go and scatters them into a temporary array, grouped by region.
+// 3. Threads grab regions one by one and insert the region's entries. Overflows are compacted to the front of the region's
+//    range in the temporary array.
+//
+//The temporary array and all bookkeeping is allocated from the table's allocator in the calling thread,
+// so the allocator does not need to be thread safe. The calling thread also participates as one of the workers.
+
+#include "hash.h"
+#include "platform.h"
+#include "parallel.h"
+#include "allocator.h"
+#include "profile.h"
+#include "assert.h"
+#include "defines.h"
+
+#ifndef HASH_PARALLEL_MIN_REGION
+    #define HASH_PARALLEL_MIN_REGION (1 << 14) //smallest number of slots of a region. Smaller regions overflow more often.
+#endif
+#ifndef HASH_PARALLEL_MIN_COUNT
+    #define HASH_PARALLEL_MIN_COUNT  (1 << 16) //below this many entries a simple loop is faster than starting the threads
+#endif
+
+//Inserts count entries into the table (that is behaves like calling hash_insert on each).
+//thread_count_or_zero of 0 uses all processors. Falls back to serial insertion when the table is not empty,
+// the input is small or only one thread is requested.
+EXTERNAL void hash_insert_parallel(Hash* table, const Hash_Entry* entries, isize count, isize thread_count_or_zero);
+#endif
+
+#if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_HASH_PARALLEL)) && !defined(MODULE_HAS_IMPL_HASH_PARALLEL)
+#define MODULE_HAS_IMPL_HASH_PARALLEL
+
+typedef struct _Hash_Parallel_Build {
+    Hash* table;
+    const Hash_Entry* input;
+    isize input_count;
+    Hash_Entry* partitioned;
+    isize* histograms;          //[thread_count][region_count] number of entries of each region in the thread's chunk
+    isize* offsets;             //[thread_count][region_count] where the next entry of the region from the thread's chunk goes
+    isize* region_from;         //[region_count + 1] start of each region in partitioned
+    isize* region_overflow;     //[region_count] number of overflowing entries at the start of each region
+    isize* region_placed;       //[region_count] number of placed entries
+    uint32_t region_shift;
+    uint32_t region_count;
+    uint32_t thread_count;
+    uint32_t _;
+
+    PLATFORM_ATOMIC(uint32_t) next_region;
+    PLATFORM_ATOMIC(uint32_t) barrier_arrived;
+    PLATFORM_ATOMIC(uint32_t) barrier_generation;
+} _Hash_Parallel_Build;
+
+INTERNAL void _hash_parallel_barrier(_Hash_Parallel_Build* build)
+{
+    uint32_t generation = atomic_load(&build->barrier_generation);
+    if(atomic_fetch_add(&build->barrier_arrived, 1) + 1 == build->thread_count) {
+        atomic_store(&build->barrier_arrived, 0);
+        atomic_fetch_add(&build->barrier_generation, 1);
+        platform_futex_wake_all(&build->barrier_generation);
+    }
+    else {
+        while(atomic_load(&build->barrier_generation) == generation)
+            platform_futex_wait(&build->barrier_generation, generation, -1);
+    }
+}
+
+INTERNAL void _hash_parallel_worker(void* context, isize thread_index)
+{
+    _Hash_Parallel_Build* build = (_Hash_Parallel_Build*) context;
+    uint32_t t = (uint32_t) thread_index;
+    uint32_t regions = build->region_count;
+    uint64_t mask = (uint64_t) build->table->capacity - 1;
+    isize from = build->input_count*t/build->thread_count;
+    isize to = build->input_count*(t + 1)/build->thread_count;
+    isize* histogram = build->histograms + (isize) t*regions;
+    isize* offsets = build->offsets + (isize) t*regions;
+
+    //1. Count
+    for(isize i = from; i < to; i++)
+        histogram[(build->input[i].hash & mask) >> build->region_shift] += 1;
+
+    _hash_parallel_barrier(build);
+    if(t == 0) {
+        build->region_from[0] = 0;
+        for(uint32_t r = 0; r < regions; r++) {
+            isize region_total = 0;
+            for(uint32_t other = 0; other < build->thread_count; other++)
+                region_total += build->histograms[(isize) other*regions + r];
+            build->region_from[r + 1] = build->region_from[r] + region_total;
+        }
+    }
+    _hash_parallel_barrier(build);
+
+    //2. Scatter. Our entries of region r go after entries of region r from preceeding threads.
+    for(uint32_t r = 0; r < regions; r++) {
+        offsets[r] = build->region_from[r];
+        for(uint32_t other = 0; other < t; other++)
+            offsets[r] += build->histograms[(isize) other*regions + r];
+    }
+
+    for(isize i = from; i < to; i++) {
+        Hash_Entry entry = build->input[i];
+        isize* offset = &offsets[(entry.hash & mask) >> build->region_shift];
+        build->partitioned[*offset] = entry;
+        *offset += 1;
+    }
+
+    _hash_parallel_barrier(build);
+
+    //3. Insert regions
+    Hash_Entry* entries = build->table->entries;
+    uint64_t empty = build->table->empty_value;
+    for(;;) {
+        uint32_t r = atomic_fetch_add(&build->next_region, 1);
+        if(r >= regions)
+            break;
+
+        uint64_t region_lo = (uint64_t) r << build->region_shift;
+        uint64_t region_hi = region_lo + ((uint64_t) 1 << build->region_shift);
+        isize overflow = build->region_from[r];
+        isize placed = 0;
+        for(isize j = build->region_from[r]; j < build->region_from[r + 1]; j++) {
+            Hash_Entry entry = build->partitioned[j];
+            uint64_t i = entry.hash & mask;
+            for(uint64_t it = 1;; it++) {
+                if(entries[i].value == empty) {
+                    entries[i] = entry;
+                    placed += 1;
+                    break;
+                }
+
+                i = (i + it) & mask;
+                if(i < region_lo || i >= region_hi) {
+                    build->partitioned[overflow++] = entry;
+                    break;
+                }
+            }
+        }
+
+        build->region_overflow[r] = overflow - build->region_from[r];
+        build->region_placed[r] = placed;
+    }
+}
+
+EXTERNAL void hash_insert_parallel(Hash* table, const Hash_Entry* entries, isize count, isize thread_count_or_zero)
+{
+    PROFILE_START();
+    isize thread_count = parallel_thread_count(thread_count_or_zero, count);
+
+    hash_reserve(table, table->count + count);
+
+    //Regions need to be powers of two so that the region is simply the top bits of the home slot.
+    // We make more regions than threads so that the work is balanced.
+    uint32_t region_count = 1;
+    while(region_count < thread_count*4 && (isize) table->capacity/region_count >= 2*HASH_PARALLEL_MIN_REGION)
+        region_count *= 2;
+
+    if(table->count > 0 || count < HASH_PARALLEL_MIN_COUNT || thread_count <= 1 || region_count <= 1) {
+        for(isize i = 0; i < count; i++)
+            hash_insert(table, entries[i].hash, entries[i].value);
+    }
+    else {
+        uint32_t capacity_log2 = 0;
+        while(((uint64_t) 1 << capacity_log2) < table->capacity)
+            capacity_log2 += 1;
+
+        uint32_t region_log2 = 0;
+        while(((uint32_t) 1 << region_log2) < region_count)
+            region_log2 += 1;
+
+        #ifdef DO_ASSERTS_SLOW
+        for(isize i = 0; i < count; i++)
+            ASSERT(entries[i].value - table->empty_value > 1, "the values must not be empty_value or empty_value + 1");
+        #endif
+
+        _Hash_Parallel_Build build = {0};
+        build.table = table;
+        build.input = entries;
+        build.input_count = count;
+        build.region_shift = capacity_log2 - region_log2;
+        build.region_count = region_count;
+        build.thread_count = (uint32_t) thread_count;
+
+        isize bookkeeping_count = 2*thread_count*region_count + (region_count + 1) + 2*region_count;
+        isize* bookkeeping = (isize*) allocator_allocate(table->allocator, bookkeeping_count*sizeof(isize), sizeof(isize));
+        memset(bookkeeping, 0, bookkeeping_count*sizeof(isize));
+        build.histograms = bookkeeping;
+        build.offsets = build.histograms + thread_count*region_count;
+        build.region_from = build.offsets + thread_count*region_count;
+        build.region_overflow = build.region_from + region_count + 1;
+        build.region_placed = build.region_overflow + region_count;
+        build.partitioned = (Hash_Entry*) allocator_allocate(table->allocator, count*sizeof(Hash_Entry), sizeof(Hash_Entry));
+
+        //The calling thread is worker 0
+        parallel_run(thread_count, _hash_parallel_worker, &build, "hash build");
+
+        //Insert the overflowing entries serially. The table is already big enough so this will not rehash.
+        isize placed = 0;
+        for(uint32_t r = 0; r < region_count; r++)
+            placed += build.region_placed[r];
+        table->count += (uint32_t) placed;
+
+        for(uint32_t r = 0; r < region_count; r++)
+            for(isize j = 0; j < build.region_overflow[r]; j++) {
+                Hash_Entry entry = build.partitioned[build.region_from[r] + j];
+                hash_insert(table, entry.hash, entry.value);
+            }
+
+        allocator_deallocate(table->allocator, build.partitioned, count*sizeof(Hash_Entry), sizeof(Hash_Entry));
+        allocator_deallocate(table->allocator, bookkeeping, bookkeeping_count*sizeof(isize), sizeof(isize));
+    }
+    PROFILE_STOP();
+}
+
+#endif
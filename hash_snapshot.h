@@ -0,0 +1,325 @@
+#ifndef MODULE_HASH_SNAPSHOT
+#define MODULE_HASH_SNAPSHOT
+
+//Persistent on disk format for Hash and Map.
+//
+//Building a big index from source data on every start is slow (tens of seconds for hundreds of millions of entries)
+// even though the resulting table is always the same. Instead we write the table once as is - header followed by the raw
+// entries array - and later simply map the file into memory. Opening is O(1): we read and validate the header and map the
+// rest. The pages are read in lazily by the OS on first access, so a process doing a handful of lookups only touches
+// a handful of pages. Lookups then work directly on the mapped memory through the regular hash_find/map_find/... functions.
+//
+//The format stores only offsets (relative to the start of the file), never pointers, so it can be mapped at any address.
+// For Hash this is always true. For Map it is only true as long as the entries themselves do not contain pointers
+// (for example String keys). Such maps have to store offsets into some other blob instead.
+// The format is native endian and is meant as a cache, not as an interchange format.
+//
+//By default the snapshot is mapped read only - only functions taking const Hash*/const Map* can be used on it.
+// When opened with HASH_SNAPSHOT_OPEN_COPY_ON_WRITE the mapping is private and writable. Then the table can be modified
+// freely: modified pages are copied into process memory by the OS (the file never changes) and once the table needs to
+// grow its entries are moved into memory obtained from the parent allocator. This works because Hash_Snapshot is itself
+// an allocator which knows that the mapped entries must not be freed.
+//
+//Layout:
+//   [Hash_Snapshot_Header] [padding to HASH_SNAPSHOT_ENTRIES_ALIGN] [entries: capacity * entry_size bytes]
+
+#include "hash.h"
+#include "map.h"
+#include "allocator.h"
+#include "platform.h"
+#include "profile.h"
+#include "hash_func.h"
+#include "assert.h"
+#include "defines.h"
+
+#define HASH_SNAPSHOT_MAGIC "HASHSNAP"
+#define HASH_SNAPSHOT_VERSION 1
+#define HASH_SNAPSHOT_ENTRIES_ALIGN (64*1024) //multiple of the allocation granularity on all platforms so the entries can be mapped on their own
+
+typedef enum Hash_Snapshot_Kind {
+    HASH_SNAPSHOT_KIND_HASH = 1,
+    HASH_SNAPSHOT_KIND_MAP = 2,
+} Hash_Snapshot_Kind;
+
+typedef enum Hash_Snapshot_Open_Flags {
+    HASH_SNAPSHOT_OPEN_READ_ONLY = 0,
+    HASH_SNAPSHOT_OPEN_COPY_ON_WRITE = 1,
+} Hash_Snapshot_Open_Flags;
+
+typedef enum Hash_Snapshot_Error {
+    HASH_SNAPSHOT_OK = 0,
+    HASH_SNAPSHOT_ERROR_IO,         //the file could not be opened/read/written/mapped. See the platform error for details
+    HASH_SNAPSHOT_ERROR_INVALID,    //the file is not a snapshot, is of different version or is truncated
+    HASH_SNAPSHOT_ERROR_MISMATCH,   //the file is a valid snapshot but of different kind or with different Map_Info
+} Hash_Snapshot_Error;
+
+typedef struct Hash_Snapshot_Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t kind;
+
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t gravestones;
+    uint32_t rehashes;
+
+    uint32_t entry_size;
+    uint32_t entry_align;
+    uint32_t key_offset;
+    uint32_t hash_offset;
+
+    uint64_t empty_value; //only used for Hash
+    uint64_t entries_offset;
+    uint64_t entries_size;
+    uint64_t header_hash; //hash of all the preceeding fields
+} Hash_Snapshot_Header;
+
+typedef struct Hash_Snapshot {
+    Allocator alloc[1]; //allocator given to the opened hash/map. Moves the entries out of the mapping when they need to be reallocated.
+    Allocator* parent;
+    uint8_t* mapped;
+    isize mapped_size;
+    Hash_Snapshot_Header header;
+    union {
+        Hash hash;
+        Map map;
+    };
+} Hash_Snapshot;
+
+EXTERNAL Hash_Snapshot_Error hash_snapshot_write_hash(const Hash* hash, Platform_String path, Platform_Error* error_or_null);
+EXTERNAL Hash_Snapshot_Error hash_snapshot_write_map(const Map* map, Map_Info info, Platform_String path, Platform_Error* error_or_null);
+
+//Opens the snapshot at path. On success snapshot->hash (or snapshot->map) can be used directly.
+// parent_alloc_or_null is only used in copy on write mode when the table grows. If NULL uses the default allocator.
+EXTERNAL Hash_Snapshot_Error hash_snapshot_open_hash(Hash_Snapshot* snapshot, Platform_String path, int open_flags, Allocator* parent_alloc_or_null, Platform_Error* error_or_null);
+EXTERNAL Hash_Snapshot_Error hash_snapshot_open_map(Hash_Snapshot* snapshot, Map_Info info, Platform_String path, int open_flags, Allocator* parent_alloc_or_null, Platform_Error* error_or_null);
+
+//Releases the mapping as well as any memory the table allocated after opening. Dont call hash_deinit/map_deinit on the table.
+EXTERNAL void hash_snapshot_close(Hash_Snapshot* snapshot);
+EXTERNAL const char* hash_snapshot_error_to_string(Hash_Snapshot_Error error);
+
+EXTERNAL void* hash_snapshot_allocator_func(void* self, int mode, isize new_size, void* old_ptr, isize old_size, isize align, void* rest);
+#endif
+
+#if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_HASH_SNAPSHOT)) && !defined(MODULE_HAS_IMPL_HASH_SNAPSHOT)
+#define MODULE_HAS_IMPL_HASH_SNAPSHOT
+
+INTERNAL uint64_t _hash_snapshot_header_hash(const Hash_Snapshot_Header* header)
+{
+    return xxhash64(header, offsetof(Hash_Snapshot_Header, header_hash), 0);
+}
+
+INTERNAL Hash_Snapshot_Error _hash_snapshot_write(Hash_Snapshot_Header header, const void* entries, Platform_String path, Platform_Error* error_or_null)
+{
+    PROFILE_START();
+    memcpy(header.magic, HASH_SNAPSHOT_MAGIC, sizeof header.magic);
+    header.version = HASH_SNAPSHOT_VERSION;
+    header.entries_offset = HASH_SNAPSHOT_ENTRIES_ALIGN;
+    header.entries_size = (uint64_t) header.capacity*header.entry_size;
+    header.header_hash = _hash_snapshot_header_hash(&header);
+
+    Platform_File file = {0};
+    Platform_Error error = platform_file_open(&file, path, PLATFORM_FILE_OPEN_WRITE | PLATFORM_FILE_OPEN_CREATE | PLATFORM_FILE_OPEN_REMOVE_CONTENT);
+    if(error == 0)
+        error = platform_file_write(&file, &header, sizeof header, 0);
+    //write at least one byte past the header padding so that the file size always covers the entries_offset
+    if(error == 0 && header.entries_size == 0)
+        error = platform_file_write(&file, "", 1, header.entries_offset);
+    if(error == 0 && header.entries_size > 0)
+        error = platform_file_write(&file, entries, (isize) header.entries_size, (isize) header.entries_offset);
+    platform_file_close(&file);
+
+    if(error_or_null)
+        *error_or_null = error;
+    PROFILE_STOP();
+    return error ? HASH_SNAPSHOT_ERROR_IO : HASH_SNAPSHOT_OK;
+}
+
+EXTERNAL Hash_Snapshot_Error hash_snapshot_write_hash(const Hash* hash, Platform_String path, Platform_Error* error_or_null)
+{
+    Hash_Snapshot_Header header = {0};
+    header.kind = HASH_SNAPSHOT_KIND_HASH;
+    header.count = hash->count;
+    header.capacity = hash->capacity;
+    header.gravestones = hash->gravestone_count;
+    header.rehashes = hash->rehashed_times;
+    header.entry_size = sizeof(Hash_Entry);
+    header.entry_align = __alignof(Hash_Entry);
+    header.key_offset = offsetof(Hash_Entry, hash);
+    header.hash_offset = offsetof(Hash_Entry, hash);
+    header.empty_value = hash->empty_value;
+    return _hash_snapshot_write(header, hash->entries, path, error_or_null);
+}
+
+EXTERNAL Hash_Snapshot_Error hash_snapshot_write_map(const Map* map, Map_Info info, Platform_String path, Platform_Error* error_or_null)
+{
+    Hash_Snapshot_Header header = {0};
+    header.kind = HASH_SNAPSHOT_KIND_MAP;
+    header.count = map->count;
+    header.capacity = map->capacity;
+    header.gravestones = map->gavestones;
+    header.rehashes = map->rehashes;
+    header.entry_size = info.entry_size;
+    header.entry_align = info.entry_align;
+    header.key_offset = info.key_offset;
+    header.hash_offset = info.hash_offset;
+    return _hash_snapshot_write(header, map->entries, path, error_or_null);
+}
+
+INTERNAL Hash_Snapshot_Error _hash_snapshot_open(Hash_Snapshot* snapshot, Hash_Snapshot_Header expected, Platform_String path, int open_flags, Allocator* parent_alloc_or_null, Platform_Error* error_or_null)
+{
+    PROFILE_START();
+    hash_snapshot_close(snapshot);
+
+    Hash_Snapshot_Error out = HASH_SNAPSHOT_OK;
+    Hash_Snapshot_Header header = {0};
+    isize file_size = 0;
+    isize read = 0;
+
+    Platform_File file = {0};
+    Platform_Error error = platform_file_open(&file, path, PLATFORM_FILE_OPEN_READ | PLATFORM_FILE_OPEN_HINT_RANDOM_ACCESS);
+    if(error == 0)
+        error = platform_file_size(&file, &file_size);
+    if(error == 0 && file_size < (isize) sizeof header)
+        out = HASH_SNAPSHOT_ERROR_INVALID;
+    if(error == 0 && out == HASH_SNAPSHOT_OK)
+        error = platform_file_read(&file, &header, sizeof header, 0, &read);
+
+    if(error == 0 && out == HASH_SNAPSHOT_OK) {
+        uint64_t load_limit = (uint64_t) header.capacity*3/4;
+        if(memcmp(header.magic, HASH_SNAPSHOT_MAGIC, sizeof header.magic) != 0
+            || header.version != HASH_SNAPSHOT_VERSION
+            || header.header_hash != _hash_snapshot_header_hash(&header)
+            || (header.capacity & (header.capacity - 1)) != 0
+            || (uint64_t) header.count + header.gravestones > load_limit
+            || header.entries_size != (uint64_t) header.capacity*header.entry_size
+            || header.entries_offset % HASH_SNAPSHOT_ENTRIES_ALIGN != 0
+            || header.entries_offset + header.entries_size > (uint64_t) file_size)
+            out = HASH_SNAPSHOT_ERROR_INVALID;
+        else if(header.kind != expected.kind
+            || header.entry_size != expected.entry_size
+            || header.entry_align != expected.entry_align
+            || header.key_offset != expected.key_offset
+            || header.hash_offset != expected.hash_offset)
+            out = HASH_SNAPSHOT_ERROR_MISMATCH;
+    }
+
+    //Map only the entries. The header was already read and is kept in the snapshot.
+    uint8_t* mapped = NULL;
+    if(error == 0 && out == HASH_SNAPSHOT_OK && header.entries_size > 0) {
+        int map_flags = PLATFORM_FILE_MAP_READ | PLATFORM_FILE_MAP_HINT_RANDOM_ACCESS;
+        if(open_flags & HASH_SNAPSHOT_OPEN_COPY_ON_WRITE)
+            map_flags |= PLATFORM_FILE_MAP_COPY_ON_WRITE;
+        error = platform_file_map((void**) &mapped, &file, (isize) header.entries_offset, (isize) header.entries_size, map_flags);
+    }
+    platform_file_close(&file);
+
+    if(error)
+        out = HASH_SNAPSHOT_ERROR_IO;
+
+    if(out == HASH_SNAPSHOT_OK) {
+        snapshot->alloc[0] = hash_snapshot_allocator_func;
+        snapshot->parent = parent_alloc_or_null ? parent_alloc_or_null : allocator_get_default();
+        snapshot->mapped = mapped;
+        snapshot->mapped_size = (isize) header.entries_size;
+        snapshot->header = header;
+        if(header.kind == HASH_SNAPSHOT_KIND_HASH) {
+            snapshot->hash.allocator = snapshot->alloc;
+            snapshot->hash.entries = (Hash_Entry*) (void*) mapped;
+            snapshot->hash.count = header.count;
+            snapshot->hash.capacity = header.capacity;
+            snapshot->hash.gravestone_count = header.gravestones;
+            snapshot->hash.rehashed_times = header.rehashes;
+            snapshot->hash.empty_value = header.empty_value;
+        }
+        else {
+            snapshot->map.alloc = snapshot->alloc;
+            snapshot->map.entries = mapped;
+            snapshot->map.count = header.count;
+            snapshot->map.capacity = header.capacity;
+            snapshot->map.gavestones = header.gravestones;
+            snapshot->map.rehashes = header.rehashes;
+        }
+    }
+
+    if(error_or_null)
+        *error_or_null = error;
+    PROFILE_STOP();
+    return out;
+}
+
+EXTERNAL Hash_Snapshot_Error hash_snapshot_open_hash(Hash_Snapshot* snapshot, Platform_String path, int open_flags, Allocator* parent_alloc_or_null, Platform_Error* error_or_null)
+{
+    Hash_Snapshot_Header expected = {0};
+    expected.kind = HASH_SNAPSHOT_KIND_HASH;
+    expected.entry_size = sizeof(Hash_Entry);
+    expected.entry_align = __alignof(Hash_Entry);
+    expected.key_offset = offsetof(Hash_Entry, hash);
+    expected.hash_offset = offsetof(Hash_Entry, hash);
+    return _hash_snapshot_open(snapshot, expected, path, open_flags, parent_alloc_or_null, error_or_null);
+}
+
+EXTERNAL Hash_Snapshot_Error hash_snapshot_open_map(Hash_Snapshot* snapshot, Map_Info info, Platform_String path, int open_flags, Allocator* parent_alloc_or_null, Platform_Error* error_or_null)
+{
+    Hash_Snapshot_Header expected = {0};
+    expected.kind = HASH_SNAPSHOT_KIND_MAP;
+    expected.entry_size = info.entry_size;
+    expected.entry_align = info.entry_align;
+    expected.key_offset = info.key_offset;
+    expected.hash_offset = info.hash_offset;
+    return _hash_snapshot_open(snapshot, expected, path, open_flags, parent_alloc_or_null, error_or_null);
+}
+
+EXTERNAL void hash_snapshot_close(Hash_Snapshot* snapshot)
+{
+    //Frees the entries if they were moved out of the mapping. Mapped entries are ignored by the allocator.
+    if(snapshot->header.kind == HASH_SNAPSHOT_KIND_HASH)
+        hash_deinit(&snapshot->hash);
+    else if(snapshot->header.kind == HASH_SNAPSHOT_KIND_MAP)
+        _map_deinit(&snapshot->map, snapshot->header.entry_size, snapshot->header.entry_align);
+
+    platform_file_unmap(snapshot->mapped, snapshot->mapped_size);
+    memset(snapshot, 0, sizeof *snapshot);
+}
+
+EXTERNAL const char* hash_snapshot_error_to_string(Hash_Snapshot_Error error)
+{
+    switch(error) {
+        case HASH_SNAPSHOT_OK: return "ok";
+        case HASH_SNAPSHOT_ERROR_IO: return "io error";
+        case HASH_SNAPSHOT_ERROR_INVALID: return "invalid snapshot";
+        case HASH_SNAPSHOT_ERROR_MISMATCH: return "snapshot kind mismatch";
+        default: return "unknown error";
+    }
+}
+
+EXTERNAL void* hash_snapshot_allocator_func(void* self, int mode, isize new_size, void* old_ptr, isize old_size, isize align, void* rest)
+{
+    if(mode == ALLOCATOR_MODE_ALLOC) {
+        Hash_Snapshot* snapshot = (Hash_Snapshot*) self;
+        uint8_t* old = (uint8_t*) old_ptr;
+        bool is_mapped = snapshot->mapped != NULL && snapshot->mapped <= old && old < snapshot->mapped + snapshot->mapped_size;
+        if(is_mapped == false)
+            return allocator_try_reallocate(snapshot->parent, new_size, old_ptr, old_size, align, (Allocator_Error*) rest);
+
+        //The mapped memory is not ours to free. Copy it out and forget it.
+        void* out = NULL;
+        if(new_size > 0) {
+            out = allocator_try_reallocate(snapshot->parent, new_size, NULL, 0, align, (Allocator_Error*) rest);
+            if(out)
+                memcpy(out, old_ptr, (size_t) (old_size < new_size ? old_size : new_size));
+        }
+        return out;
+    }
+    if(mode == ALLOCATOR_MODE_GET_STATS) {
+        Hash_Snapshot* snapshot = (Hash_Snapshot*) self;
+        Allocator_Stats stats = {0};
+        stats.parent = snapshot->parent;
+        stats.type_name = "Hash_Snapshot";
+        stats.fixed_memory_pool_size = snapshot->mapped_size;
+        *(Allocator_Stats*) rest = stats;
+    }
+    return NULL;
+}
+
+#endif
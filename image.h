@@ -373,6 +373,11 @@ EXTERNAL bool subimage_is_overlapping(Subimage a, Subimage b)
     return -bw < dx && dx < aw;
 }
 
+EXTERNAL bool subimage_is_same_format(Subimage a, Subimage b)
+{
+    return a.type == b.type && a.pixel_size == b.pixel_size;
+}
+
 EXTERNAL Subimage subimage_range(Subimage view, isize from_x, isize from_y, isize to_x, isize to_y)
 {
     Subimage out = view;
@@ -381,11 +386,11 @@ EXTERNAL Subimage subimage_range(Subimage view, isize from_x, isize from_y, isiz
     CHECK_BOUNDS(to_x, out.width + 1);
     CHECK_BOUNDS(to_y, out.height + 1);
 
-    CHECK_BOUNDS(from_x, to_x);
-    CHECK_BOUNDS(from_y, to_y);
+    CHECK_BOUNDS(from_x, to_x + 1);
+    CHECK_BOUNDS(from_y, to_y + 1);
 
-    out.from_x = (int32_t) from_x;
-    out.from_y = (int32_t) from_y;
+    out.from_x = view.from_x + (int32_t) from_x;
+    out.from_y = view.from_y + (int32_t) from_y;
     out.width = (int32_t) (to_x - from_x);
     out.height = (int32_t) (to_y - from_y);
 
@@ -439,7 +444,7 @@ EXTERNAL void subimage_copy(Subimage to_image, Subimage from_image, isize offset
 
     //if both are contiguous (full width) then we can do just a single move
     if(subimage_is_contiguous(to_portion) && subimage_is_contiguous(from_image))
-        memmove(to_image_ptr, from_image_ptr, (size_t) row_byte_size*to_portion.width);
+        memmove(to_image_ptr, from_image_ptr, (size_t) (row_byte_size*from_image.height));
     //Copy in the right order so we dont override any data
     else {
         if(from_image_ptr >= to_image_ptr)
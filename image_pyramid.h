@@ -0,0 +1,857 @@
+#ifndef MODULE_IMAGE_PYRAMID
+#define MODULE_IMAGE_PYRAMID
+
+//Multi resolution helpers on top of image.h: mip pyramids and summed area tables (integral images).
+//
+//Image_Pyramid holds a whole mip chain in a single allocation: level 0 (a copy of the source) followed by
+// successively halved levels, each starting at an IMAGE_ALIGN boundary. Together they take about 4/3 of level 0.
+// Level i + 1 is max(1, width/2) x max(1, height/2) of level i, so an odd last row or column is dropped.
+// Levels are handed out as Subimage views into the block.
+//
+//Two downsampling filters are available:
+// - IMAGE_FILTER_BOX averages every 2x2 block. Integer types are rounded to nearest and are exact
+//   (64 bit types do not overflow). U8 and F32 with 1 or 4 channels have SSE paths.
+// - IMAGE_FILTER_KAISER is a separable 8 tap Kaiser windowed sinc (alpha 4) which keeps noticeably more detail
+//   and aliases less than the box, but costs an order of magnitude more. It is computed in f32 for 8 and 16 bit types and in f64
+//   for the rest, and integer results are rounded and clamped to the range of the type.
+// Both work with all pixel types of image.h that have defined arithmetic (everything except PIXEL_TYPE_F8 and
+// custom types) and any channel count. The rows of each level are split between thread_count_or_zero threads
+// (0 means all processors) with the calling thread working as one of them.
+//
+//A summed area table of a w x h image is a (w + 1) x (h + 1) image where pixel (x, y) holds the per channel sum of
+// all source pixels in [0, x) x [0, y). The sum over any rectangle is then 4 lookups. Tables are ordinary Image-s
+// whose type is the type of the sums:
+// - PIXEL_TYPE_U64 / PIXEL_TYPE_I64 for unsigned / signed integer images.
+// - PIXEL_TYPE_U32 / PIXEL_TYPE_I32 for the same at half the memory. The table wraps around, but since the
+//   arithmetic is modular the rectangle sums are still exact as long as each sum fits into 32 bits
+//   (so any rectangle of up to 16M pixels of an U8 image).
+// - PIXEL_TYPE_F64 / PIXEL_TYPE_F32 for float images.
+
+#include "image.h"
+#include "allocator.h"
+#include "platform.h"
+#include "parallel.h"
+#include "profile.h"
+#include "assert.h"
+#include "defines.h"
+
+#define IMAGE_PYRAMID_MAX_LEVELS 32
+
+typedef enum Image_Filter {
+    IMAGE_FILTER_BOX = 0,
+    IMAGE_FILTER_KAISER = 1,
+} Image_Filter;
+
+typedef struct Image_Pyramid {
+    Allocator* allocator;
+    uint8_t* pixels;        //all levels in one block
+    isize capacity;
+    int32_t level_count;
+    int32_t _;
+    Subimage levels[IMAGE_PYRAMID_MAX_LEVELS];
+} Image_Pyramid;
+
+EXTERNAL void image_pyramid_init(Image_Pyramid* pyramid, Allocator* alloc);
+EXTERNAL void image_pyramid_deinit(Image_Pyramid* pyramid);
+//Builds the pyramid of image down to 1x1 or until max_levels_or_zero levels (level 0 included). Reuses the previous block if it is big enough.
+EXTERNAL void image_pyramid_build(Image_Pyramid* pyramid, Subimage image, Image_Filter filter, isize max_levels_or_zero, isize thread_count_or_zero);
+//Returns the number of levels from a width x height image down to 1x1.
+EXTERNAL isize image_pyramid_level_count(isize width, isize height);
+//Returns the size of the block holding level_count levels of a pyramid.
+EXTERNAL isize image_pyramid_byte_size(isize width, isize height, isize pixel_size, isize level_count);
+//Downsamples from into to, which must be max(1, from.width/2) x max(1, from.height/2) of the same format and must not overlap.
+EXTERNAL void image_downsample(Subimage to, Subimage from, Image_Filter filter, isize thread_count_or_zero);
+
+//Builds the summed area table of from into integral with the given sum_type (see above).
+EXTERNAL void image_integral_build(Image* integral, Subimage from, Pixel_Type sum_type);
+//Writes the per channel sums of the pixels in [from_x, to_x) x [from_y, to_y) into sums, which has one entry of integral.type per channel.
+EXTERNAL void image_integral_sum(Image integral, isize from_x, isize from_y, isize to_x, isize to_y, void* sums);
+//Returns the sum of a single channel of the pixels in [from_x, to_x) x [from_y, to_y) converted to f64.
+EXTERNAL f64 image_integral_sum_f64(Image integral, isize from_x, isize from_y, isize to_x, isize to_y, isize channel);
+#endif
+
+#if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_IMAGE_PYRAMID)) && !defined(MODULE_HAS_IMPL_IMAGE_PYRAMID)
+#define MODULE_HAS_IMPL_IMAGE_PYRAMID
+
+#include <math.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define _IMAGE_PYRAMID_SSE
+#endif
+
+#define _IMAGE_KAISER_TAPS 8
+
+// ============================ Pixel conversions ============================
+INTERNAL float _image_f16_to_f32(uint16_t half)
+{
+    uint32_t sign = (uint32_t) (half >> 15) << 31;
+    uint32_t exponent = (half >> 10) & 0x1F;
+    uint32_t mantissa = half & 0x3FF;
+    uint32_t bits = sign;
+    if(exponent == 0x1F)
+        bits |= 0x7F800000 | (mantissa << 13);
+    else if(exponent != 0)
+        bits |= ((exponent + 112) << 23) | (mantissa << 13);
+    else if(mantissa != 0) {
+        float subnormal = (float) mantissa*(1.0f/16777216.0f);
+        return sign ? -subnormal : subnormal;
+    }
+
+    float out = 0;
+    memcpy(&out, &bits, sizeof out);
+    return out;
+}
+
+//Rounds to nearest even like the hardware conversion
+INTERNAL uint16_t _image_f32_to_f16(float value)
+{
+    uint32_t bits = 0;
+    memcpy(&bits, &value, sizeof bits);
+    uint32_t sign = (bits >> 16) & 0x8000;
+    uint32_t abs_bits = bits & 0x7FFFFFFF;
+    if(abs_bits >= 0x7F800000)
+        return (uint16_t) (sign | 0x7C00 | (abs_bits > 0x7F800000 ? 0x200 : 0));
+    //65520 and above round to infinity
+    if(abs_bits >= 0x477FF000)
+        return (uint16_t) (sign | 0x7C00);
+    //Below the smallest normal half. Scaling by 2^24 is exact and rintf rounds to nearest even
+    if(abs_bits < 0x38800000) {
+        float abs_value = 0;
+        memcpy(&abs_value, &abs_bits, sizeof abs_value);
+        return (uint16_t) (sign | (uint32_t) rintf(abs_value*16777216.0f));
+    }
+
+    uint32_t rounded = abs_bits + 0xFFF + ((abs_bits >> 13) & 1);
+    return (uint16_t) (sign | ((rounded - 0x38000000) >> 13));
+}
+
+INTERNAL int32_t _image_load_i24(const uint8_t* data, bool is_signed)
+{
+    uint32_t value = (uint32_t) data[0] | (uint32_t) data[1] << 8 | (uint32_t) data[2] << 16;
+    if(is_signed && (value & 0x800000))
+        value |= 0xFF000000;
+    return (int32_t) value;
+}
+
+INTERNAL void _image_store_i24(uint8_t* data, int32_t value)
+{
+    data[0] = (uint8_t) value;
+    data[1] = (uint8_t) (value >> 8);
+    data[2] = (uint8_t) (value >> 16);
+}
+
+//Rounds to nearest and clamps into [min, max]. NaN gives min.
+INTERNAL f64 _image_round_clamp(f64 value, f64 min, f64 max)
+{
+    if(!(value >= min))
+        return min;
+    if(value >= max)
+        return max;
+    return floor(value + 0.5);
+}
+
+//Doubles closest to the 64 bit limits which still convert to the integer without overflow
+#define _IMAGE_I64_MAX_F64 9223372036854774784.0
+#define _IMAGE_U64_MAX_F64 18446744073709549568.0
+
+//Defines _image_row_load_<T> and _image_row_store_<T> converting count channel values of a row of the given type
+// to and from T.
+#define _IMAGE_DEFINE_ROW_CONVERT(T, suffix) \
+    INTERNAL void _image_row_load_##suffix(T* out, const uint8_t* row, isize count, Pixel_Type type) \
+    { \
+        switch(type) { \
+            case PIXEL_TYPE_U8:  for(isize i = 0; i < count; i++) out[i] = (T) ((const uint8_t*) (const void*) row)[i]; break; \
+            case PIXEL_TYPE_U16: for(isize i = 0; i < count; i++) out[i] = (T) ((const uint16_t*) (const void*) row)[i]; break; \
+            case PIXEL_TYPE_U24: for(isize i = 0; i < count; i++) out[i] = (T) _image_load_i24(row + 3*i, false); break; \
+            case PIXEL_TYPE_U32: for(isize i = 0; i < count; i++) out[i] = (T) ((const uint32_t*) (const void*) row)[i]; break; \
+            case PIXEL_TYPE_U64: for(isize i = 0; i < count; i++) out[i] = (T) ((const uint64_t*) (const void*) row)[i]; break; \
+            case PIXEL_TYPE_I8:  for(isize i = 0; i < count; i++) out[i] = (T) ((const int8_t*) (const void*) row)[i]; break; \
+            case PIXEL_TYPE_I16: for(isize i = 0; i < count; i++) out[i] = (T) ((const int16_t*) (const void*) row)[i]; break; \
+            case PIXEL_TYPE_I24: for(isize i = 0; i < count; i++) out[i] = (T) _image_load_i24(row + 3*i, true); break; \
+            case PIXEL_TYPE_I32: for(isize i = 0; i < count; i++) out[i] = (T) ((const int32_t*) (const void*) row)[i]; break; \
+            case PIXEL_TYPE_I64: for(isize i = 0; i < count; i++) out[i] = (T) ((const int64_t*) (const void*) row)[i]; break; \
+            case PIXEL_TYPE_F16: for(isize i = 0; i < count; i++) out[i] = (T) _image_f16_to_f32(((const uint16_t*) (const void*) row)[i]); break; \
+            case PIXEL_TYPE_F32: for(isize i = 0; i < count; i++) out[i] = (T) ((const float*) (const void*) row)[i]; break; \
+            case PIXEL_TYPE_F64: for(isize i = 0; i < count; i++) out[i] = (T) ((const f64*) (const void*) row)[i]; break; \
+            default: UNREACHABLE(); \
+        } \
+    } \
+    \
+    INTERNAL void _image_row_store_##suffix(uint8_t* row, const T* in, isize count, Pixel_Type type) \
+    { \
+        switch(type) { \
+            case PIXEL_TYPE_U8:  for(isize i = 0; i < count; i++) ((uint8_t*) (void*) row)[i] = (uint8_t) _image_round_clamp(in[i], 0, UINT8_MAX); break; \
+            case PIXEL_TYPE_U16: for(isize i = 0; i < count; i++) ((uint16_t*) (void*) row)[i] = (uint16_t) _image_round_clamp(in[i], 0, UINT16_MAX); break; \
+            case PIXEL_TYPE_U24: for(isize i = 0; i < count; i++) _image_store_i24(row + 3*i, (int32_t) _image_round_clamp(in[i], 0, 0xFFFFFF)); break; \
+            case PIXEL_TYPE_U32: for(isize i = 0; i < count; i++) ((uint32_t*) (void*) row)[i] = (uint32_t) _image_round_clamp(in[i], 0, UINT32_MAX); break; \
+            case PIXEL_TYPE_U64: for(isize i = 0; i < count; i++) ((uint64_t*) (void*) row)[i] = (uint64_t) _image_round_clamp(in[i], 0, _IMAGE_U64_MAX_F64); break; \
+            case PIXEL_TYPE_I8:  for(isize i = 0; i < count; i++) ((int8_t*) (void*) row)[i] = (int8_t) _image_round_clamp(in[i], INT8_MIN, INT8_MAX); break; \
+            case PIXEL_TYPE_I16: for(isize i = 0; i < count; i++) ((int16_t*) (void*) row)[i] = (int16_t) _image_round_clamp(in[i], INT16_MIN, INT16_MAX); break; \
+            case PIXEL_TYPE_I24: for(isize i = 0; i < count; i++) _image_store_i24(row + 3*i, (int32_t) _image_round_clamp(in[i], -0x800000, 0x7FFFFF)); break; \
+            case PIXEL_TYPE_I32: for(isize i = 0; i < count; i++) ((int32_t*) (void*) row)[i] = (int32_t) _image_round_clamp(in[i], INT32_MIN, INT32_MAX); break; \
+            case PIXEL_TYPE_I64: for(isize i = 0; i < count; i++) ((int64_t*) (void*) row)[i] = (int64_t) _image_round_clamp(in[i], -_IMAGE_I64_MAX_F64, _IMAGE_I64_MAX_F64); break; \
+            case PIXEL_TYPE_F16: for(isize i = 0; i < count; i++) ((uint16_t*) (void*) row)[i] = _image_f32_to_f16((float) in[i]); break; \
+            case PIXEL_TYPE_F32: for(isize i = 0; i < count; i++) ((float*) (void*) row)[i] = (float) in[i]; break; \
+            case PIXEL_TYPE_F64: for(isize i = 0; i < count; i++) ((f64*) (void*) row)[i] = (f64) in[i]; break; \
+            default: UNREACHABLE(); \
+        } \
+    } \
+
+_IMAGE_DEFINE_ROW_CONVERT(float, f32)
+_IMAGE_DEFINE_ROW_CONVERT(f64, f64)
+
+INTERNAL bool _image_type_is_filterable(Pixel_Type type)
+{
+    return type < 0 && type != PIXEL_TYPE_F8 && type != PIXEL_TYPE_INVALID && pixel_type_size_or_zero(type) > 0;
+}
+
+//The Kaiser filter runs in f32 for types which fit into its mantissa
+INTERNAL bool _image_type_needs_f64(Pixel_Type type)
+{
+    switch(type) {
+        case PIXEL_TYPE_U8: case PIXEL_TYPE_U16: case PIXEL_TYPE_I8: case PIXEL_TYPE_I16:
+        case PIXEL_TYPE_F16: case PIXEL_TYPE_F32:
+            return false;
+        default:
+            return true;
+    }
+}
+
+// ============================ Downsampling ============================
+typedef struct _Image_Downsample {
+    Subimage to;
+    Subimage from;
+    Pixel_Type type;
+    isize channels;         //number of values of type per pixel
+    isize chunk;
+    bool use_f64;
+
+    f64 weights[_IMAGE_KAISER_TAPS];
+    float weights_f32[_IMAGE_KAISER_TAPS];
+    uint8_t* temp;          //kaiser: from.height rows of to.width pixels filtered horizontally
+    isize temp_stride;
+    uint8_t* scratch;       //kaiser: one row of from.width pixels per thread
+    isize scratch_stride;
+} _Image_Downsample;
+
+//Averages with rounding to nearest. The 64 bit version avoids overflow by averaging the quarters and the remainders separately.
+#define _IMAGE_AVERAGE_SMALL(T, a, b, c, d)  (T) (((int32_t) (a) + (b) + (c) + (d) + 2) >> 2)
+#define _IMAGE_AVERAGE_32(T, a, b, c, d)     (T) (((int64_t) (a) + (b) + (c) + (d) + 2) >> 2)
+#define _IMAGE_AVERAGE_64(T, a, b, c, d)     (T) (((a) >> 2) + ((b) >> 2) + ((c) >> 2) + ((d) >> 2) + ((((a) & 3) + ((b) & 3) + ((c) & 3) + ((d) & 3) + 2) >> 2))
+#define _IMAGE_AVERAGE_FLOAT(T, a, b, c, d)  (T) ((((a) + (b)) + ((c) + (d)))*(T) 0.25)
+
+#define _IMAGE_BOX_LOOP(T, AVERAGE) { \
+        const T* a = (const T*) (const void*) row0; \
+        const T* b = (const T*) (const void*) row1; \
+        T* o = (T*) (void*) out; \
+        for(isize x = x_from; x < width; x++) \
+            for(isize c = 0; c < channels; c++) { \
+                isize i = 2*x*channels + c; \
+                isize j = i + step; \
+                o[x*channels + c] = AVERAGE(T, a[i], a[j], b[i], b[j]); \
+            } \
+    } \
+
+INTERNAL void _image_box_row(const _Image_Downsample* down, isize y)
+{
+    Subimage from = down->from;
+    isize y0 = MIN(2*y, from.height - 1);
+    isize y1 = MIN(2*y + 1, from.height - 1);
+    const uint8_t* row0 = (const uint8_t*) subimage_at(from, 0, y0);
+    const uint8_t* row1 = (const uint8_t*) subimage_at(from, 0, y1);
+    uint8_t* out = (uint8_t*) subimage_at(down->to, 0, y);
+
+    //Every output pixel averages input pixels 2x and 2x + 1, except for 1 pixel wide input where both are 0
+    isize channels = down->channels;
+    isize width = down->to.width;
+    isize step = from.width > 1 ? channels : 0;
+    isize x_from = 0;
+
+    #ifdef _IMAGE_PYRAMID_SSE
+    if(step > 0 && down->type == PIXEL_TYPE_U8 && channels == 1) {
+        __m128i low_bytes = _mm_set1_epi16(0x00FF);
+        __m128i two = _mm_set1_epi16(2);
+        for(; x_from + 16 <= width; x_from += 16) {
+            const uint8_t* a = row0 + 2*x_from;
+            const uint8_t* b = row1 + 2*x_from;
+            __m128i a0 = _mm_loadu_si128((const __m128i*) (const void*) a);
+            __m128i a1 = _mm_loadu_si128((const __m128i*) (const void*) (a + 16));
+            __m128i b0 = _mm_loadu_si128((const __m128i*) (const void*) b);
+            __m128i b1 = _mm_loadu_si128((const __m128i*) (const void*) (b + 16));
+            __m128i sum0 = _mm_add_epi16(_mm_add_epi16(_mm_and_si128(a0, low_bytes), _mm_srli_epi16(a0, 8)), _mm_add_epi16(_mm_and_si128(b0, low_bytes), _mm_srli_epi16(b0, 8)));
+            __m128i sum1 = _mm_add_epi16(_mm_add_epi16(_mm_and_si128(a1, low_bytes), _mm_srli_epi16(a1, 8)), _mm_add_epi16(_mm_and_si128(b1, low_bytes), _mm_srli_epi16(b1, 8)));
+            sum0 = _mm_srli_epi16(_mm_add_epi16(sum0, two), 2);
+            sum1 = _mm_srli_epi16(_mm_add_epi16(sum1, two), 2);
+            _mm_storeu_si128((__m128i*) (void*) (out + x_from), _mm_packus_epi16(sum0, sum1));
+        }
+    }
+    else if(step > 0 && down->type == PIXEL_TYPE_U8 && channels == 4) {
+        //Widens the 4 pixels of a register to u16 and adds the neighbouring pairs giving 2 pixels
+        #define _IMAGE_PAIRS(v) _mm_unpacklo_epi64( \
+            _mm_add_epi16(_mm_unpacklo_epi8(v, zero), _mm_srli_si128(_mm_unpacklo_epi8(v, zero), 8)), \
+            _mm_add_epi16(_mm_unpackhi_epi8(v, zero), _mm_srli_si128(_mm_unpackhi_epi8(v, zero), 8)))
+
+        __m128i zero = _mm_setzero_si128();
+        __m128i two = _mm_set1_epi16(2);
+        for(; x_from + 4 <= width; x_from += 4) {
+            const uint8_t* a = row0 + 8*x_from;
+            const uint8_t* b = row1 + 8*x_from;
+            __m128i a0 = _mm_loadu_si128((const __m128i*) (const void*) a);
+            __m128i a1 = _mm_loadu_si128((const __m128i*) (const void*) (a + 16));
+            __m128i b0 = _mm_loadu_si128((const __m128i*) (const void*) b);
+            __m128i b1 = _mm_loadu_si128((const __m128i*) (const void*) (b + 16));
+            __m128i sum0 = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(_IMAGE_PAIRS(a0), _IMAGE_PAIRS(b0)), two), 2);
+            __m128i sum1 = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(_IMAGE_PAIRS(a1), _IMAGE_PAIRS(b1)), two), 2);
+            _mm_storeu_si128((__m128i*) (void*) (out + 4*x_from), _mm_packus_epi16(sum0, sum1));
+        }
+        #undef _IMAGE_PAIRS
+    }
+    else if(step > 0 && down->type == PIXEL_TYPE_F32 && channels == 1) {
+        const float* a = (const float*) (const void*) row0;
+        const float* b = (const float*) (const void*) row1;
+        float* o = (float*) (void*) out;
+        __m128 quarter = _mm_set1_ps(0.25f);
+        for(; x_from + 4 <= width; x_from += 4) {
+            __m128 a0 = _mm_loadu_ps(a + 2*x_from), a1 = _mm_loadu_ps(a + 2*x_from + 4);
+            __m128 b0 = _mm_loadu_ps(b + 2*x_from), b1 = _mm_loadu_ps(b + 2*x_from + 4);
+            __m128 sum_a = _mm_add_ps(_mm_shuffle_ps(a0, a1, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(3, 1, 3, 1)));
+            __m128 sum_b = _mm_add_ps(_mm_shuffle_ps(b0, b1, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(b0, b1, _MM_SHUFFLE(3, 1, 3, 1)));
+            _mm_storeu_ps(o + x_from, _mm_mul_ps(_mm_add_ps(sum_a, sum_b), quarter));
+        }
+    }
+    else if(step > 0 && down->type == PIXEL_TYPE_F32 && channels == 4) {
+        const float* a = (const float*) (const void*) row0;
+        const float* b = (const float*) (const void*) row1;
+        float* o = (float*) (void*) out;
+        __m128 quarter = _mm_set1_ps(0.25f);
+        for(; x_from < width; x_from++) {
+            __m128 sum_a = _mm_add_ps(_mm_loadu_ps(a + 8*x_from), _mm_loadu_ps(a + 8*x_from + 4));
+            __m128 sum_b = _mm_add_ps(_mm_loadu_ps(b + 8*x_from), _mm_loadu_ps(b + 8*x_from + 4));
+            _mm_storeu_ps(o + 4*x_from, _mm_mul_ps(_mm_add_ps(sum_a, sum_b), quarter));
+        }
+    }
+    #endif
+
+    switch(down->type) {
+        case PIXEL_TYPE_U8:  _IMAGE_BOX_LOOP(uint8_t,  _IMAGE_AVERAGE_SMALL); break;
+        case PIXEL_TYPE_U16: _IMAGE_BOX_LOOP(uint16_t, _IMAGE_AVERAGE_SMALL); break;
+        case PIXEL_TYPE_U32: _IMAGE_BOX_LOOP(uint32_t, _IMAGE_AVERAGE_32); break;
+        case PIXEL_TYPE_U64: _IMAGE_BOX_LOOP(uint64_t, _IMAGE_AVERAGE_64); break;
+        case PIXEL_TYPE_I8:  _IMAGE_BOX_LOOP(int8_t,   _IMAGE_AVERAGE_SMALL); break;
+        case PIXEL_TYPE_I16: _IMAGE_BOX_LOOP(int16_t,  _IMAGE_AVERAGE_SMALL); break;
+        case PIXEL_TYPE_I32: _IMAGE_BOX_LOOP(int32_t,  _IMAGE_AVERAGE_32); break;
+        case PIXEL_TYPE_I64: _IMAGE_BOX_LOOP(int64_t,  _IMAGE_AVERAGE_64); break;
+        case PIXEL_TYPE_F32: _IMAGE_BOX_LOOP(float,    _IMAGE_AVERAGE_FLOAT); break;
+        case PIXEL_TYPE_F64: _IMAGE_BOX_LOOP(f64,      _IMAGE_AVERAGE_FLOAT); break;
+
+        case PIXEL_TYPE_U24:
+        case PIXEL_TYPE_I24: {
+            bool is_signed = down->type == PIXEL_TYPE_I24;
+            for(isize x = x_from; x < width; x++)
+                for(isize c = 0; c < channels; c++) {
+                    isize i = 2*x*channels + c;
+                    isize j = i + step;
+                    int32_t average = _IMAGE_AVERAGE_SMALL(int32_t,
+                        _image_load_i24(row0 + 3*i, is_signed), _image_load_i24(row0 + 3*j, is_signed),
+                        _image_load_i24(row1 + 3*i, is_signed), _image_load_i24(row1 + 3*j, is_signed));
+                    _image_store_i24(out + 3*(x*channels + c), average);
+                }
+        } break;
+
+        case PIXEL_TYPE_F16: {
+            const uint16_t* a = (const uint16_t*) (const void*) row0;
+            const uint16_t* b = (const uint16_t*) (const void*) row1;
+            uint16_t* o = (uint16_t*) (void*) out;
+            for(isize x = x_from; x < width; x++)
+                for(isize c = 0; c < channels; c++) {
+                    isize i = 2*x*channels + c;
+                    isize j = i + step;
+                    float average = _IMAGE_AVERAGE_FLOAT(float, _image_f16_to_f32(a[i]), _image_f16_to_f32(a[j]), _image_f16_to_f32(b[i]), _image_f16_to_f32(b[j]));
+                    o[x*channels + c] = _image_f32_to_f16(average);
+                }
+        } break;
+
+        default: UNREACHABLE();
+    }
+}
+
+INTERNAL void _image_box_rows(void* context, isize from, isize to, isize thread_index)
+{
+    (void) thread_index;
+    for(isize y = from; y < to; y++)
+        _image_box_row((const _Image_Downsample*) context, y);
+}
+
+INTERNAL f64 _image_bessel_i0(f64 x)
+{
+    f64 sum = 1;
+    f64 term = 1;
+    for(int k = 1; k < 32; k++) {
+        term *= (x/(2*k))*(x/(2*k));
+        sum += term;
+    }
+    return sum;
+}
+
+//Taps k = 0..7 sit at input pixels 2x - 3 + k whose centers are k - 3.5 input pixels from the center of output pixel x.
+//The ideal 2x decimation filter sinc(d/2)/2 is windowed by Kaiser of radius 4 and normalized.
+INTERNAL void _image_kaiser_weights(f64* weights)
+{
+    const f64 alpha = 4;
+    const f64 radius = _IMAGE_KAISER_TAPS/2;
+    f64 total = 0;
+    for(isize k = 0; k < _IMAGE_KAISER_TAPS; k++) {
+        f64 d = (f64) k - 3.5;
+        f64 t = d/2;
+        f64 sinc = sin(3.14159265358979323846*t)/(3.14159265358979323846*t);
+        f64 r = d/radius;
+        f64 window = _image_bessel_i0(alpha*sqrt(MAX(1 - r*r, 0.0)))/_image_bessel_i0(alpha);
+        weights[k] = sinc*window;
+        total += weights[k];
+    }
+    for(isize k = 0; k < _IMAGE_KAISER_TAPS; k++)
+        weights[k] /= total;
+}
+
+//The SIMD parts of the Kaiser passes. They return how far they got and the scalar code finishes the rest.
+//Both accumulate the taps in the same order as the scalar code so the results do not depend on the path taken.
+#ifdef _IMAGE_PYRAMID_SSE
+INTERNAL isize _image_kaiser_horizontal_simd_f32(float* out, const float* row, const float* weights, isize from_x, isize to_x, isize channels)
+{
+    __m128 w[_IMAGE_KAISER_TAPS];
+    for(isize k = 0; k < _IMAGE_KAISER_TAPS; k++)
+        w[k] = _mm_set1_ps(weights[k]);
+
+    isize x = from_x;
+    if(channels == 4) {
+        for(; x < to_x; x++) {
+            const float* in = row + (2*x - 3)*4;
+            __m128 sum = _mm_setzero_ps();
+            for(isize k = 0; k < _IMAGE_KAISER_TAPS; k++)
+                sum = _mm_add_ps(sum, _mm_mul_ps(w[k], _mm_loadu_ps(in + 4*k)));
+            _mm_storeu_ps(out + 4*x, sum);
+        }
+    }
+    //4 outputs at once from the even elements of 8 consecutive inputs. Reads one element past the last tap
+    // which is why the rows are padded.
+    else if(channels == 1) {
+        for(; x + 4 <= to_x; x += 4) {
+            const float* in = row + 2*x - 3;
+            __m128 sum = _mm_setzero_ps();
+            for(isize k = 0; k < _IMAGE_KAISER_TAPS; k++) {
+                __m128 low = _mm_loadu_ps(in + k);
+                __m128 high = _mm_loadu_ps(in + k + 4);
+                sum = _mm_add_ps(sum, _mm_mul_ps(w[k], _mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0))));
+            }
+            _mm_storeu_ps(out + x, sum);
+        }
+    }
+    return x;
+}
+
+INTERNAL isize _image_kaiser_vertical_simd_f32(float* sums, const float* const* rows, const float* weights, isize count)
+{
+    __m128 w[_IMAGE_KAISER_TAPS];
+    for(isize k = 0; k < _IMAGE_KAISER_TAPS; k++)
+        w[k] = _mm_set1_ps(weights[k]);
+
+    isize i = 0;
+    for(; i + 4 <= count; i += 4) {
+        __m128 sum = _mm_setzero_ps();
+        for(isize k = 0; k < _IMAGE_KAISER_TAPS; k++)
+            sum = _mm_add_ps(sum, _mm_mul_ps(w[k], _mm_loadu_ps(rows[k] + i)));
+        _mm_storeu_ps(sums + i, sum);
+    }
+    return i;
+}
+#else
+INTERNAL isize _image_kaiser_horizontal_simd_f32(float* out, const float* row, const float* weights, isize from_x, isize to_x, isize channels)
+{
+    (void) out; (void) row; (void) weights; (void) to_x; (void) channels;
+    return from_x;
+}
+
+INTERNAL isize _image_kaiser_vertical_simd_f32(float* sums, const float* const* rows, const float* weights, isize count)
+{
+    (void) sums; (void) rows; (void) weights; (void) count;
+    return 0;
+}
+#endif
+
+INTERNAL isize _image_kaiser_horizontal_simd_f64(f64* out, const f64* row, const f64* weights, isize from_x, isize to_x, isize channels)
+{
+    (void) out; (void) row; (void) weights; (void) to_x; (void) channels;
+    return from_x;
+}
+
+INTERNAL isize _image_kaiser_vertical_simd_f64(f64* sums, const f64* const* rows, const f64* weights, isize count)
+{
+    (void) sums; (void) rows; (void) weights; (void) count;
+    return 0;
+}
+
+//Defines the horizontal and vertical Kaiser passes computing in T. The horizontal pass filters full rows of the input
+// into temp, the vertical pass combines 8 rows of temp into each output row.
+#define _IMAGE_DEFINE_KAISER(T, suffix, WEIGHTS) \
+    ATTRIBUTE_INLINE_ALWAYS static void _image_kaiser_interior_##suffix(T* out, const T* row, const T* weights, isize from_x, isize to_x, isize channels) \
+    { \
+        for(isize x = from_x; x < to_x; x++) { \
+            const T* in = row + (2*x - 3)*channels; \
+            for(isize c = 0; c < channels; c++) { \
+                T sum = 0; \
+                for(isize k = 0; k < _IMAGE_KAISER_TAPS; k++) \
+                    sum += weights[k]*in[k*channels + c]; \
+                out[x*channels + c] = sum; \
+            } \
+        } \
+    } \
+    \
+    INTERNAL void _image_kaiser_horizontal_##suffix(void* context, isize from, isize to, isize thread_index) \
+    { \
+        const _Image_Downsample* down = (const _Image_Downsample*) context; \
+        isize channels = down->channels; \
+        isize in_width = down->from.width; \
+        isize out_width = down->to.width; \
+        T* row = (T*) (void*) (down->scratch + thread_index*down->scratch_stride); \
+        /* Outputs [interior_from, interior_to) have all taps inside the row */ \
+        isize interior_from = MIN(2, out_width); \
+        isize interior_to = MAX((in_width - _IMAGE_KAISER_TAPS + 3)/2 + 1, interior_from); \
+        interior_to = MIN(interior_to, out_width); \
+        for(isize y = from; y < to; y++) { \
+            _image_row_load_##suffix(row, (const uint8_t*) subimage_at(down->from, 0, y), in_width*channels, down->type); \
+            T* out = (T*) (void*) (down->temp + y*down->temp_stride); \
+            isize simd_to = _image_kaiser_horizontal_simd_##suffix(out, row, down->WEIGHTS, interior_from, interior_to, channels); \
+            /* Constant channel counts let the compiler unroll the common cases */ \
+            if(channels == 4) \
+                _image_kaiser_interior_##suffix(out, row, down->WEIGHTS, simd_to, interior_to, 4); \
+            else if(channels == 1) \
+                _image_kaiser_interior_##suffix(out, row, down->WEIGHTS, simd_to, interior_to, 1); \
+            else \
+                _image_kaiser_interior_##suffix(out, row, down->WEIGHTS, simd_to, interior_to, channels); \
+            \
+            for(isize x = 0; x < out_width; x++) { \
+                if(x == interior_from) \
+                    x = MAX(interior_to, x); \
+                if(x >= out_width) \
+                    break; \
+                isize first = 2*x - 3; \
+                for(isize c = 0; c < channels; c++) { \
+                    T sum = 0; \
+                    for(isize k = 0; k < _IMAGE_KAISER_TAPS; k++) { \
+                        isize at = CLAMP(first + k, 0, in_width - 1); \
+                        sum += down->WEIGHTS[k]*row[at*channels + c]; \
+                    } \
+                    out[x*channels + c] = sum; \
+                } \
+            } \
+        } \
+    } \
+    \
+    INTERNAL void _image_kaiser_vertical_##suffix(void* context, isize from, isize to, isize thread_index) \
+    { \
+        const _Image_Downsample* down = (const _Image_Downsample*) context; \
+        isize count = down->to.width*down->channels; \
+        T* sums = (T*) (void*) (down->scratch + thread_index*down->scratch_stride); \
+        for(isize y = from; y < to; y++) { \
+            const T* rows[_IMAGE_KAISER_TAPS]; \
+            for(isize k = 0; k < _IMAGE_KAISER_TAPS; k++) \
+                rows[k] = (const T*) (const void*) (down->temp + CLAMP(2*y - 3 + k, 0, (isize) down->from.height - 1)*down->temp_stride); \
+            for(isize i = _image_kaiser_vertical_simd_##suffix(sums, rows, down->WEIGHTS, count); i < count; i++) { \
+                T sum = 0; \
+                for(isize k = 0; k < _IMAGE_KAISER_TAPS; k++) \
+                    sum += down->WEIGHTS[k]*rows[k][i]; \
+                sums[i] = sum; \
+            } \
+            _image_row_store_##suffix((uint8_t*) subimage_at(down->to, 0, y), sums, count, down->type); \
+        } \
+    } \
+
+_IMAGE_DEFINE_KAISER(float, f32, weights_f32)
+_IMAGE_DEFINE_KAISER(f64, f64, weights)
+
+EXTERNAL void image_downsample(Subimage to, Subimage from, Image_Filter filter, isize thread_count_or_zero)
+{
+    PROFILE_START();
+    REQUIRE(_image_type_is_filterable(from.type), "pixel type %s cannot be filtered", pixel_type_name(from.type));
+    REQUIRE(subimage_is_same_format(to, from) && subimage_is_overlapping(to, from) == false);
+    REQUIRE(to.width == MAX(from.width/2, 1) && to.height == MAX(from.height/2, 1));
+
+    if(from.width > 0 && from.height > 0)
+    {
+        _Image_Downsample down = {to, from, from.type};
+        down.channels = subimage_channel_count(from);
+        isize row_bytes = (isize) to.width*to.pixel_size;
+        down.chunk = MAX((1 << 16)/MAX(row_bytes, 1), 1);
+        isize thread_count = parallel_thread_count(thread_count_or_zero, (to.height + down.chunk - 1)/down.chunk);
+
+        if(filter == IMAGE_FILTER_BOX)
+            parallel_for(to.height, down.chunk, thread_count, _image_box_rows, &down, "image");
+        else
+        {
+            //The horizontal pass needs all input rows so it gets its own chunking
+            down.use_f64 = _image_type_needs_f64(from.type);
+            isize value_size = down.use_f64 ? sizeof(f64) : sizeof(float);
+            isize horizontal_chunk = MAX((1 << 16)/MAX((isize) from.width*from.pixel_size, 1), 1);
+            isize horizontal_threads = parallel_thread_count(thread_count_or_zero, (from.height + horizontal_chunk - 1)/horizontal_chunk);
+            isize threads = MAX(thread_count, horizontal_threads);
+
+            _image_kaiser_weights(down.weights);
+            for(isize k = 0; k < _IMAGE_KAISER_TAPS; k++)
+                down.weights_f32[k] = (float) down.weights[k];
+
+            Allocator* alloc = allocator_get_default();
+            down.temp_stride = (isize) to.width*down.channels*value_size;
+            //Padded for the SIMD loads reading past the last tap
+            down.scratch_stride = (MAX((isize) from.width, (isize) to.width)*down.channels + 16)*value_size;
+            isize temp_size = down.temp_stride*from.height;
+            isize scratch_size = down.scratch_stride*threads;
+            down.temp = (uint8_t*) allocator_allocate(alloc, temp_size, IMAGE_ALIGN);
+            down.scratch = (uint8_t*) allocator_allocate(alloc, scratch_size, IMAGE_ALIGN);
+
+            if(down.use_f64) {
+                parallel_for(from.height, horizontal_chunk, horizontal_threads, _image_kaiser_horizontal_f64, &down, "image");
+                parallel_for(to.height, down.chunk, thread_count, _image_kaiser_vertical_f64, &down, "image");
+            }
+            else {
+                parallel_for(from.height, horizontal_chunk, horizontal_threads, _image_kaiser_horizontal_f32, &down, "image");
+                parallel_for(to.height, down.chunk, thread_count, _image_kaiser_vertical_f32, &down, "image");
+            }
+
+            allocator_deallocate(alloc, down.scratch, scratch_size, IMAGE_ALIGN);
+            allocator_deallocate(alloc, down.temp, temp_size, IMAGE_ALIGN);
+        }
+    }
+    PROFILE_STOP();
+}
+
+// ============================ Pyramid ============================
+EXTERNAL isize image_pyramid_level_count(isize width, isize height)
+{
+    isize count = 1;
+    for(; width > 1 || height > 1; count++) {
+        width = MAX(width/2, 1);
+        height = MAX(height/2, 1);
+    }
+    return count;
+}
+
+EXTERNAL isize image_pyramid_byte_size(isize width, isize height, isize pixel_size, isize level_count)
+{
+    isize size = 0;
+    for(isize i = 0; i < level_count; i++) {
+        size += (width*height*pixel_size + IMAGE_ALIGN - 1)/IMAGE_ALIGN*IMAGE_ALIGN;
+        width = MAX(width/2, 1);
+        height = MAX(height/2, 1);
+    }
+    return size;
+}
+
+EXTERNAL void image_pyramid_init(Image_Pyramid* pyramid, Allocator* alloc)
+{
+    memset(pyramid, 0, sizeof *pyramid);
+    pyramid->allocator = alloc;
+}
+
+EXTERNAL void image_pyramid_deinit(Image_Pyramid* pyramid)
+{
+    if(pyramid->capacity)
+        allocator_deallocate(pyramid->allocator, pyramid->pixels, pyramid->capacity, IMAGE_ALIGN);
+    memset(pyramid, 0, sizeof *pyramid);
+}
+
+EXTERNAL void image_pyramid_build(Image_Pyramid* pyramid, Subimage image, Image_Filter filter, isize max_levels_or_zero, isize thread_count_or_zero)
+{
+    PROFILE_START();
+    REQUIRE(pyramid->allocator != NULL, "must be initialized with image_pyramid_init");
+    REQUIRE(_image_type_is_filterable(image.type), "pixel type %s cannot be filtered", pixel_type_name(image.type));
+
+    isize level_count = image_pyramid_level_count(image.width, image.height);
+    if(max_levels_or_zero > 0)
+        level_count = MIN(level_count, max_levels_or_zero);
+    level_count = MIN(level_count, IMAGE_PYRAMID_MAX_LEVELS);
+
+    isize size = image_pyramid_byte_size(image.width, image.height, image.pixel_size, level_count);
+    if(size > pyramid->capacity) {
+        if(pyramid->capacity)
+            allocator_deallocate(pyramid->allocator, pyramid->pixels, pyramid->capacity, IMAGE_ALIGN);
+        pyramid->pixels = (uint8_t*) allocator_allocate(pyramid->allocator, size, IMAGE_ALIGN);
+        pyramid->capacity = size;
+    }
+
+    memset(pyramid->levels, 0, sizeof pyramid->levels);
+    pyramid->level_count = (int32_t) level_count;
+    isize offset = 0;
+    isize width = image.width;
+    isize height = image.height;
+    for(isize i = 0; i < level_count; i++) {
+        pyramid->levels[i] = subimage_make(pyramid->pixels + offset, width, height, image.pixel_size, image.type);
+        offset += (width*height*image.pixel_size + IMAGE_ALIGN - 1)/IMAGE_ALIGN*IMAGE_ALIGN;
+        width = MAX(width/2, 1);
+        height = MAX(height/2, 1);
+    }
+
+    subimage_copy(pyramid->levels[0], image, 0, 0);
+    for(isize i = 1; i < level_count; i++)
+        image_downsample(pyramid->levels[i], pyramid->levels[i - 1], filter, thread_count_or_zero);
+    PROFILE_STOP();
+}
+
+// ============================ Summed area tables ============================
+INTERNAL bool _image_type_is_float(Pixel_Type type)
+{
+    return type == PIXEL_TYPE_F16 || type == PIXEL_TYPE_F32 || type == PIXEL_TYPE_F64;
+}
+
+INTERNAL bool _image_type_is_signed(Pixel_Type type)
+{
+    return type == PIXEL_TYPE_I8 || type == PIXEL_TYPE_I16 || type == PIXEL_TYPE_I24 || type == PIXEL_TYPE_I32 || type == PIXEL_TYPE_I64;
+}
+
+//Loads a row of integer values as u64. Signed values are sign extended so that wrapping u64 arithmetic matches i64.
+INTERNAL void _image_row_load_u64(uint64_t* out, const uint8_t* row, isize count, Pixel_Type type)
+{
+    switch(type) {
+        case PIXEL_TYPE_U8:  for(isize i = 0; i < count; i++) out[i] = ((const uint8_t*) (const void*) row)[i]; break;
+        case PIXEL_TYPE_U16: for(isize i = 0; i < count; i++) out[i] = ((const uint16_t*) (const void*) row)[i]; break;
+        case PIXEL_TYPE_U24: for(isize i = 0; i < count; i++) out[i] = (uint64_t) _image_load_i24(row + 3*i, false); break;
+        case PIXEL_TYPE_U32: for(isize i = 0; i < count; i++) out[i] = ((const uint32_t*) (const void*) row)[i]; break;
+        case PIXEL_TYPE_U64: for(isize i = 0; i < count; i++) out[i] = ((const uint64_t*) (const void*) row)[i]; break;
+        case PIXEL_TYPE_I8:  for(isize i = 0; i < count; i++) out[i] = (uint64_t) (int64_t) ((const int8_t*) (const void*) row)[i]; break;
+        case PIXEL_TYPE_I16: for(isize i = 0; i < count; i++) out[i] = (uint64_t) (int64_t) ((const int16_t*) (const void*) row)[i]; break;
+        case PIXEL_TYPE_I24: for(isize i = 0; i < count; i++) out[i] = (uint64_t) (int64_t) _image_load_i24(row + 3*i, true); break;
+        case PIXEL_TYPE_I32: for(isize i = 0; i < count; i++) out[i] = (uint64_t) (int64_t) ((const int32_t*) (const void*) row)[i]; break;
+        case PIXEL_TYPE_I64: for(isize i = 0; i < count; i++) out[i] = (uint64_t) ((const int64_t*) (const void*) row)[i]; break;
+        default: UNREACHABLE();
+    }
+}
+
+EXTERNAL void image_integral_build(Image* integral, Subimage from, Pixel_Type sum_type)
+{
+    PROFILE_START();
+    REQUIRE(_image_type_is_filterable(from.type), "pixel type %s cannot be summed", pixel_type_name(from.type));
+    bool is_float = _image_type_is_float(from.type);
+    bool is_signed = _image_type_is_signed(from.type);
+    if(is_float)
+        REQUIRE(sum_type == PIXEL_TYPE_F32 || sum_type == PIXEL_TYPE_F64);
+    else if(is_signed)
+        REQUIRE(sum_type == PIXEL_TYPE_I32 || sum_type == PIXEL_TYPE_I64);
+    else
+        REQUIRE(sum_type == PIXEL_TYPE_U32 || sum_type == PIXEL_TYPE_U64);
+
+    isize channels = subimage_channel_count(from);
+    isize sum_size = pixel_type_size(sum_type);
+    isize width = from.width;
+    isize height = from.height;
+    image_reshape(integral, width + 1, height + 1, channels*sum_size, sum_type, NULL);
+    memset(integral->pixels, 0, (size_t) ((width + 1)*channels*sum_size));
+
+    //Each row is the running sum of its pixels added to the row above. The running sums are kept in 64 bits
+    // (wrapping for integers) and truncated to the sum type on store which keeps the modular arithmetic intact.
+    isize values = width*channels;
+    Allocator* alloc = allocator_get_default();
+    isize scratch_size = (values + channels)*8;
+    uint8_t* scratch = (uint8_t*) allocator_allocate(alloc, scratch_size, 8);
+    for(isize y = 0; y < height; y++)
+    {
+        const uint8_t* in = (const uint8_t*) subimage_at(from, 0, y);
+        uint8_t* above = (uint8_t*) image_at(*integral, 0, y);
+        uint8_t* out = (uint8_t*) image_at(*integral, 0, y + 1);
+        memset(out, 0, (size_t) (channels*sum_size));
+
+        if(is_float) {
+            f64* row = (f64*) (void*) scratch;
+            _image_row_load_f64(row, in, values, from.type);
+            for(isize i = channels; i < values; i++)
+                row[i] += row[i - channels];
+
+            if(sum_type == PIXEL_TYPE_F64) {
+                const f64* a = (const f64*) (void*) above + channels;
+                f64* o = (f64*) (void*) out + channels;
+                for(isize i = 0; i < values; i++)
+                    o[i] = a[i] + row[i];
+            }
+            else {
+                //Adding in f64 keeps the error of the f32 table to a single rounding per entry
+                const float* a = (const float*) (void*) above + channels;
+                float* o = (float*) (void*) out + channels;
+                for(isize i = 0; i < values; i++)
+                    o[i] = (float) ((f64) a[i] + row[i]);
+            }
+        }
+        else {
+            uint64_t* row = (uint64_t*) (void*) scratch;
+            _image_row_load_u64(row, in, values, from.type);
+            for(isize i = channels; i < values; i++)
+                row[i] += row[i - channels];
+
+            if(sum_size == 8) {
+                const uint64_t* a = (const uint64_t*) (void*) above + channels;
+                uint64_t* o = (uint64_t*) (void*) out + channels;
+                for(isize i = 0; i < values; i++)
+                    o[i] = a[i] + row[i];
+            }
+            else {
+                const uint32_t* a = (const uint32_t*) (void*) above + channels;
+                uint32_t* o = (uint32_t*) (void*) out + channels;
+                for(isize i = 0; i < values; i++)
+                    o[i] = a[i] + (uint32_t) row[i];
+            }
+        }
+    }
+    allocator_deallocate(alloc, scratch, scratch_size, 8);
+    PROFILE_STOP();
+}
+
+EXTERNAL void image_integral_sum(Image integral, isize from_x, isize from_y, isize to_x, isize to_y, void* sums)
+{
+    ASSERT(0 <= from_x && from_x <= to_x && to_x < integral.width);
+    ASSERT(0 <= from_y && from_y <= to_y && to_y < integral.height);
+
+    isize channels = image_channel_count(integral);
+    const uint8_t* a = (const uint8_t*) image_at(integral, from_x, from_y);
+    const uint8_t* b = (const uint8_t*) image_at(integral, to_x, from_y);
+    const uint8_t* c = (const uint8_t*) image_at(integral, from_x, to_y);
+    const uint8_t* d = (const uint8_t*) image_at(integral, to_x, to_y);
+    #define _IMAGE_INTEGRAL_SUM(T, Acc) \
+        for(isize i = 0; i < channels; i++) \
+            ((T*) sums)[i] = (T) ((Acc) ((const T*) (const void*) d)[i] - (Acc) ((const T*) (const void*) b)[i] \
+                                - (Acc) ((const T*) (const void*) c)[i] + (Acc) ((const T*) (const void*) a)[i]) \
+
+    switch(integral.type) {
+        case PIXEL_TYPE_U32: _IMAGE_INTEGRAL_SUM(uint32_t, uint32_t); break;
+        case PIXEL_TYPE_I32: _IMAGE_INTEGRAL_SUM(int32_t, uint32_t); break;
+        case PIXEL_TYPE_U64: _IMAGE_INTEGRAL_SUM(uint64_t, uint64_t); break;
+        case PIXEL_TYPE_I64: _IMAGE_INTEGRAL_SUM(int64_t, uint64_t); break;
+        case PIXEL_TYPE_F32: _IMAGE_INTEGRAL_SUM(float, f64); break;
+        case PIXEL_TYPE_F64: _IMAGE_INTEGRAL_SUM(f64, f64); break;
+        default: REQUIRE(false, "not a summed area table");
+    }
+    #undef _IMAGE_INTEGRAL_SUM
+}
+
+EXTERNAL f64 image_integral_sum_f64(Image integral, isize from_x, isize from_y, isize to_x, isize to_y, isize channel)
+{
+    isize channels = image_channel_count(integral);
+    ASSERT(0 <= channel && channel < channels);
+
+    //Look at a single channel image starting at the requested channel
+    Image single = integral;
+    single.pixel_size = pixel_type_size(integral.type);
+    single.pixels += channel*single.pixel_size;
+    single.width = (int32_t) (integral.width*channels);
+
+    uint64_t sum = 0;
+    image_integral_sum(single, from_x*channels, from_y, to_x*channels, to_y, &sum);
+    switch(integral.type) {
+        case PIXEL_TYPE_U32: { uint32_t out = 0; memcpy(&out, &sum, sizeof out); return (f64) out; }
+        case PIXEL_TYPE_I32: { int32_t out = 0;  memcpy(&out, &sum, sizeof out); return (f64) out; }
+        case PIXEL_TYPE_U64: { uint64_t out = 0; memcpy(&out, &sum, sizeof out); return (f64) out; }
+        case PIXEL_TYPE_I64: { int64_t out = 0;  memcpy(&out, &sum, sizeof out); return (f64) out; }
+        case PIXEL_TYPE_F32: { float out = 0;    memcpy(&out, &sum, sizeof out); return (f64) out; }
+        case PIXEL_TYPE_F64: { f64 out = 0;      memcpy(&out, &sum, sizeof out); return out; }
+        default: return 0;
+    }
+}
+
+#endif
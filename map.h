@@ -27,6 +27,7 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
+#include "allocator_dispatch_default.h"
 
 typedef int64_t isize;
 typedef void* (*Allocator)(void* alloc, int mode, int64_t new_size, void* old_ptr, int64_t old_size, int64_t align, void* other);
@@ -364,7 +365,7 @@ MAP_INLINE_API void map_clear(Map* map, Map_Info info)
 inline static void* _map_alloc(Allocator* alloc, int64_t new_size, void* old_ptr, int64_t old_size, int64_t align)
 {
     #ifndef USE_MALLOC
-        return (*alloc)(alloc, 0, new_size, old_ptr, old_size, align, NULL);
+        return ALLOCATOR_DISPATCH(alloc, new_size, old_ptr, old_size, align);
     #else
         if(new_size != 0) {
             void* out = realloc(old_ptr, new_size);
@@ -0,0 +1,538 @@
+#ifndef MODULE_MAP_ROBIN
+#define MODULE_MAP_ROBIN
+
+//This is a robin hood hashing variant of the "generic" map from map.h. It uses the exact same Map_Info description
+// of the entries, the same "pass the already escaped hash in" convention and the same inline-everything approach
+// (see the comment at the top of map.h for the reasoning behind those).
+//
+//The difference is in how collisions and removals are handled. map.h uses quadratic probing and marks removed entries
+// with gravestones (MAP_REMOVED_ENTRY). Gravestones are simple but every removal makes all lookups passing over
+// that slot a little bit longer until the next rehash. For workloads with constant churn (insert, remove, insert, remove...)
+// this means the probe lengths slowly creep up to dozens of slots and we keep paying for it.
+//
+//Here we use linear probing with the robin hood insertion policy: when inserting we walk from the home slot and whenever we
+// encounter an entry that is closer to its home slot than we are to ours (it is "richer") we take its place and it
+// continues further. In linear probing this is equivalent to keeping every run of occupied slots sorted by home slot,
+// so instead of swapping entries one by one we simply find the first "richer" slot and shift the rest of the run one
+// slot forward. This has two nice consequences:
+// 1. Lookups can stop as soon as they reach an entry closer to its home than we would be. Misses thus terminate early
+//    instead of having to find an empty slot.
+// 2. Removal does not need gravestones. We remove the entry and shift the following entries of the run one slot back
+//    (called backward shift deletion) until we reach an empty slot or an entry sitting in its home slot.
+//    The table after removal is exactly as if the entry was never inserted.
+//
+//The probe distance of each slot is stored in a separate byte array (called probes) right after the entries in the same
+// allocation. 0 means empty, otherwise its the distance + 1. This means we only touch the entries themselves when the
+// distance matches, which keeps the hot loop inside a few cache lines even for large entries. Distances that do not fit
+// into a byte are saturated to ROBIN_MAP_PROBE_SATURATED and calculated from the stored hash when needed (which happens
+// practically only for multimaps with very many duplicate keys).
+//
+//To keep the probe lengths bounded we grow the map when an insertion would produce a probe sequence longer than
+// ROBIN_MAP_GROW_PROBE (given the map is at least half full - otherwise growing would not help since the long probe
+// is caused by many entries with the same hash, not by the load).
+//
+//Because the entries move around on insertion and removal, indices/pointers returned from any of the functions are only
+// valid until the next insertion or removal (with map.h they were stable until the next rehash). This also means that when
+// removing all entries of a given key in a multimap one should restart the iteration after each removal (see robin_map_remove).
+//
+//Empty slots are always zeroed so entries can be iterated using MAP_FOR from map.h just as with Map.
+
+#include "map.h"
+
+typedef struct Robin_Map {
+    Allocator* alloc;
+    uint8_t* entries;
+    uint32_t count;
+    uint32_t capacity;
+    uint8_t* probes;    //probe distance + 1 of each slot or 0 if empty. Lives in the same allocation right after entries.
+    uint32_t max_probe; //purely informational longest probe sequence since the last rehash
+    uint32_t rehashes;  //purely informational number of rehashes so far
+} Robin_Map;
+
+#ifndef ROBIN_MAP_GROW_PROBE
+    #define ROBIN_MAP_GROW_PROBE 64
+#endif
+
+#define ROBIN_MAP_PROBE_SATURATED 255
+#define ROBIN_MAP_MAX_LOAD(capacity) ((capacity)/8*7)
+
+#ifndef ROBIN_MAP_INLINE_API
+    #define ROBIN_MAP_INLINE_API ATTRIBUTE_INLINE_ALWAYS static
+    #define MODULE_IMPL_INLINE_MAP_ROBIN
+#endif
+
+ROBIN_MAP_INLINE_API void  robin_map_init(Robin_Map* map, Map_Info info, Allocator* alloc);
+ROBIN_MAP_INLINE_API void  robin_map_deinit(Robin_Map* map, Map_Info info);
+ROBIN_MAP_INLINE_API void  robin_map_reserve(Robin_Map* map, Map_Info info, isize count);
+ROBIN_MAP_INLINE_API void  robin_map_rehash(Robin_Map* map, Map_Info info, isize count);
+ROBIN_MAP_INLINE_API void  robin_map_clear(Robin_Map* map, Map_Info info);
+ROBIN_MAP_INLINE_API bool  robin_map_find(const Robin_Map* map, Map_Info info, const void* key, uint64_t hash, isize* found);
+
+//Removes the entry at found index and shifts the following entries back.
+//The entry that followed the removed one (possibly another entry with the same key) now resides at found.
+ROBIN_MAP_INLINE_API void  robin_map_remove(Robin_Map* map, Map_Info info, isize found);
+
+ROBIN_MAP_INLINE_API void* robin_map_get_or(const Robin_Map* map, Map_Info info, const void* key, uint64_t hash, void* if_not_found);
+ROBIN_MAP_INLINE_API void* robin_map_set(Robin_Map* map, Map_Info info, const void* value);
+ROBIN_MAP_INLINE_API void* robin_map_insert(Robin_Map* map, Map_Info info, const void* value);
+
+//Can be used to iterate all entries correspoind to certain key in case of multimap
+ROBIN_MAP_INLINE_API bool  robin_map_find_next(const Robin_Map* map, Map_Info info, const void* key, uint64_t hash, uint32_t* index, uint32_t* dist);
+ROBIN_MAP_INLINE_API void  robin_map_find_next_make(const Robin_Map* map, uint64_t hash, uint32_t* index, uint32_t* dist);
+
+//these functions just do the background work of inserting/inserting or finding without actually storing anything.
+// one has to fill in the entry at the returned index/ptr appropriately to keep the map in good state.
+// The returned entry is zeroed.
+ROBIN_MAP_INLINE_API isize robin_map_prepare_insert(Robin_Map* map, Map_Info info, const void* key, uint64_t hash);
+ROBIN_MAP_INLINE_API bool  robin_map_prepare_insert_or_find(Robin_Map* map, Map_Info info, const void* key, uint64_t hash, isize* found);
+ROBIN_MAP_INLINE_API bool  robin_map_prepare_insert_or_find_ptr(Robin_Map* map, Map_Info info, const void* key, uint64_t hash, void** found);
+
+ATTRIBUTE_INLINE_NEVER EXTERNAL void robin_map_test_consistency(const Robin_Map* map, Map_Info info, uint32_t flags);
+ROBIN_MAP_INLINE_API void robin_map_debug_test_consistency(const Robin_Map* map, Map_Info info);
+#endif
+
+//Inline implementation
+#if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_INLINE_MAP_ROBIN)) && !defined(MODULE_HAS_IMPL_INLINE_MAP_ROBIN)
+#define MODULE_HAS_IMPL_INLINE_MAP_ROBIN
+
+ATTRIBUTE_INLINE_NEVER EXTERNAL void _robin_map_rehash(Robin_Map* map, isize requested_capacity, uint32_t entry_size, uint32_t entry_align, uint32_t hash_offset);
+ATTRIBUTE_INLINE_NEVER EXTERNAL void _robin_map_deinit(Robin_Map* map, uint32_t entry_size, uint32_t entry_align);
+
+ROBIN_MAP_INLINE_API void robin_map_debug_test_consistency(const Robin_Map* map, Map_Info info)
+{
+    #ifndef MAP_DEBUG
+        #if defined(DO_ASSERTS_SLOW)
+            #define MAP_DEBUG 2
+        #elif !defined(NDEBUG)
+            #define MAP_DEBUG 1
+        #else
+            #define MAP_DEBUG 0
+        #endif
+    #endif
+
+    (void) map;
+    (void) info;
+    #if MAP_DEBUG > 1
+        robin_map_test_consistency(map, info, MAP_TEST_INVARIANTS_ALL);
+    #elif MAP_DEBUG > 0
+        robin_map_test_consistency(map, info, MAP_TEST_INVARIANTS_BASIC);
+    #endif
+}
+
+ROBIN_MAP_INLINE_API void robin_map_init(Robin_Map* map, Map_Info info, Allocator* alloc)
+{
+    robin_map_deinit(map, info);
+    map->alloc = alloc;
+}
+
+ROBIN_MAP_INLINE_API void robin_map_deinit(Robin_Map* map, Map_Info info)
+{
+    robin_map_debug_test_consistency(map, info);
+    _robin_map_deinit(map, info.entry_size, info.entry_align);
+    robin_map_debug_test_consistency(map, info);
+}
+
+ROBIN_MAP_INLINE_API void robin_map_rehash(Robin_Map* map, Map_Info info, isize requested_capacity)
+{
+    robin_map_debug_test_consistency(map, info);
+    _robin_map_rehash(map, requested_capacity, info.entry_size, info.entry_align, info.hash_offset);
+    robin_map_debug_test_consistency(map, info);
+}
+
+ROBIN_MAP_INLINE_API void robin_map_reserve(Robin_Map* map, Map_Info info, isize requested_capacity)
+{
+    if(ROBIN_MAP_MAX_LOAD(map->capacity) <= requested_capacity)
+        robin_map_rehash(map, info, requested_capacity);
+}
+
+//Returns the exact probe distance of the slot at index. Only calculates it from the hash when the stored distance is saturated.
+ROBIN_MAP_INLINE_API uint32_t _robin_map_slot_dist(const Robin_Map* map, Map_Info info, uint32_t index)
+{
+    uint32_t probe = map->probes[index];
+    ASSERT(probe != 0);
+    if(probe != ROBIN_MAP_PROBE_SATURATED)
+        return probe - 1;
+
+    uint64_t entry_hash = 0; memcpy(&entry_hash, map->entries + info.entry_size*index + info.hash_offset, sizeof entry_hash);
+    return (index - (uint32_t) entry_hash) & (map->capacity - 1);
+}
+
+ROBIN_MAP_INLINE_API uint8_t _robin_map_probe_make(uint32_t dist)
+{
+    return dist + 1 < ROBIN_MAP_PROBE_SATURATED ? (uint8_t) (dist + 1) : ROBIN_MAP_PROBE_SATURATED;
+}
+
+//this is a separate fucntion specifically because it doesnt call robin_map_debug_test_consistency so it can be used
+// within robin_map_debug_test_consistency
+ROBIN_MAP_INLINE_API bool _robin_map_find_next(const Robin_Map* map, Map_Info info, const void* key, uint64_t hash, uint32_t* index, uint32_t* dist)
+{
+    if(map->count > 0)
+        for(;; *index = (*index + 1) & (map->capacity - 1), *dist += 1) {
+            ASSERT(*dist <= map->capacity);
+            uint32_t probe = map->probes[*index];
+            //Empty slot or a slot that is closer to its home than we are to ours.
+            // If our entry was in the map it would have to be before it.
+            if(probe < *dist + 1 && probe != ROBIN_MAP_PROBE_SATURATED)
+                break;
+
+            uint32_t slot_dist = _robin_map_slot_dist(map, info, *index);
+            if(slot_dist < *dist)
+                break;
+
+            if(slot_dist == *dist) {
+                uint8_t* entry = map->entries + info.entry_size**index;
+                uint64_t entry_hash = 0; memcpy(&entry_hash, entry + info.hash_offset, sizeof entry_hash);
+                if(entry_hash == hash)
+                    if(info.key_equals == NULL || ((Key_Equals_Func)info.key_equals)(entry + info.key_offset, key))
+                        return true;
+            }
+        }
+    return false;
+}
+
+ROBIN_MAP_INLINE_API void robin_map_find_next_make(const Robin_Map* map, uint64_t hash, uint32_t* index, uint32_t* dist)
+{
+    ASSERT(map_hash_is_valid(hash));
+    //robin_map_find_next advances by one before looking so we start one before the home slot
+    *dist = (uint32_t) -1;
+    *index = ((uint32_t) hash - 1) & (map->capacity - 1);
+}
+
+ROBIN_MAP_INLINE_API bool robin_map_find_next(const Robin_Map* map, Map_Info info, const void* key, uint64_t hash, uint32_t* index, uint32_t* dist)
+{
+    ASSERT(map_hash_is_valid(hash));
+    robin_map_debug_test_consistency(map, info);
+    *index = (*index + 1) & (map->capacity - 1);
+    *dist += 1;
+    return _robin_map_find_next(map, info, key, hash, index, dist);
+}
+
+ROBIN_MAP_INLINE_API bool robin_map_find(const Robin_Map* map, Map_Info info, const void* key, uint64_t hash, isize* found)
+{
+    ASSERT(map_hash_is_valid(hash));
+    robin_map_debug_test_consistency(map, info);
+    uint32_t dist = 0;
+    uint32_t index = (uint32_t) hash & (map->capacity - 1);
+    bool out = _robin_map_find_next(map, info, key, hash, &index, &dist);
+    *found = index;
+    return out;
+}
+
+ROBIN_MAP_INLINE_API void* robin_map_get_or(const Robin_Map* map, Map_Info info, const void* key, uint64_t hash, void* if_not_found)
+{
+    ASSERT(map_hash_is_valid(hash));
+    robin_map_debug_test_consistency(map, info);
+    uint32_t dist = 0;
+    uint32_t index = (uint32_t) hash & (map->capacity - 1);
+    if(_robin_map_find_next(map, info, key, hash, &index, &dist))
+        return map->entries + info.entry_size*index;
+    return if_not_found;
+}
+
+ROBIN_MAP_INLINE_API bool _robin_map_insert_or_find(Robin_Map* map, Map_Info info, const void* key, uint64_t hash, isize* found, bool do_only_insert)
+{
+    ASSERT(map_hash_is_valid(hash));
+    robin_map_debug_test_consistency(map, info);
+    robin_map_reserve(map, info, (isize) map->count + 1);
+
+    for(;;) {
+        uint32_t mask = map->capacity - 1;
+        uint32_t i = (uint32_t) hash & mask;
+        uint32_t dist = 0;
+
+        //Find the slot where the entry belongs. That is either an empty slot
+        // or the first slot which is "richer" than us.
+        for(;; i = (i + 1) & mask, dist += 1) {
+            ASSERT(dist <= map->capacity);
+            if(map->probes[i] == 0)
+                break;
+
+            uint32_t slot_dist = _robin_map_slot_dist(map, info, i);
+            if(slot_dist < dist)
+                break;
+
+            //if we are inserting we dont care about duplicates.
+            // We just insert to the first slot where we can
+            if(do_only_insert == false && slot_dist == dist) {
+                uint8_t* entry = map->entries + info.entry_size*i;
+                uint64_t entry_hash = 0; memcpy(&entry_hash, entry + info.hash_offset, sizeof entry_hash);
+                if(entry_hash == hash)
+                    if(info.key_equals == NULL || ((Key_Equals_Func)info.key_equals)(entry + info.key_offset, key)) {
+                        *found = i;
+                        return true;
+                    }
+            }
+        }
+
+        //Find the end of the run which will get shifted one slot forward.
+        // Each shifted entry gets one further from its home.
+        uint32_t longest = dist;
+        uint32_t empty_i = i;
+        for(uint32_t shifted = 0; map->probes[empty_i] != 0; empty_i = (empty_i + 1) & mask, shifted++) {
+            ASSERT(shifted <= map->capacity);
+            uint32_t slot_dist = _robin_map_slot_dist(map, info, empty_i) + 1;
+            if(longest < slot_dist)
+                longest = slot_dist;
+        }
+
+        //If the probe sequences would get too long grow and try again.
+        if(longest > ROBIN_MAP_GROW_PROBE && (uint64_t) map->count*2 >= map->capacity) {
+            robin_map_rehash(map, info, (isize) map->capacity);
+            continue;
+        }
+
+        //Shift the run [i, empty_i) to [i + 1, empty_i + 1)
+        for(uint32_t j = empty_i; j != i; ) {
+            uint32_t prev = (j - 1) & mask;
+            uint32_t prev_dist = _robin_map_slot_dist(map, info, prev);
+            memcpy(map->entries + info.entry_size*j, map->entries + info.entry_size*prev, info.entry_size);
+            map->probes[j] = _robin_map_probe_make(prev_dist + 1);
+            j = prev;
+        }
+
+        memset(map->entries + info.entry_size*i, 0, info.entry_size);
+        map->probes[i] = _robin_map_probe_make(dist);
+        if(map->max_probe < longest)
+            map->max_probe = longest;
+
+        map->count += 1;
+        *found = i;
+        return false;
+    }
+}
+
+ROBIN_MAP_INLINE_API isize robin_map_prepare_insert(Robin_Map* map, Map_Info info, const void* key, uint64_t hash)
+{
+    isize found = 0;
+    _robin_map_insert_or_find(map, info, key, hash, &found, true);
+    return found;
+}
+
+ROBIN_MAP_INLINE_API bool robin_map_prepare_insert_or_find(Robin_Map* map, Map_Info info, const void* key, uint64_t hash, isize* found)
+{
+    return _robin_map_insert_or_find(map, info, key, hash, found, false);
+}
+
+ROBIN_MAP_INLINE_API bool robin_map_prepare_insert_or_find_ptr(Robin_Map* map, Map_Info info, const void* key, uint64_t hash, void** found)
+{
+    isize index = 0;
+    bool out = _robin_map_insert_or_find(map, info, key, hash, &index, false);
+    *found = map->entries + info.entry_size*index;
+    return out;
+}
+
+ROBIN_MAP_INLINE_API void* robin_map_insert(Robin_Map* map, Map_Info info, const void* value)
+{
+    isize found = 0;
+    uint8_t* entry = (uint8_t*) value;
+    uint64_t entry_hash = 0;
+    memcpy(&entry_hash, entry + info.hash_offset, sizeof entry_hash);
+    _robin_map_insert_or_find(map, info, entry + info.key_offset, entry_hash, &found, true);
+    uint8_t* found_entry = map->entries + info.entry_size*found;
+    memcpy(found_entry, entry, info.entry_size);
+    return found_entry;
+}
+
+ROBIN_MAP_INLINE_API void* robin_map_set(Robin_Map* map, Map_Info info, const void* value)
+{
+    isize found = 0;
+    uint8_t* entry = (uint8_t*) value;
+    uint64_t entry_hash = 0;
+    memcpy(&entry_hash, entry + info.hash_offset, sizeof entry_hash);
+    _robin_map_insert_or_find(map, info, entry + info.key_offset, entry_hash, &found, false);
+    uint8_t* found_entry = map->entries + info.entry_size*found;
+    memcpy(found_entry, entry, info.entry_size);
+    return found_entry;
+}
+
+ROBIN_MAP_INLINE_API void robin_map_remove(Robin_Map* map, Map_Info info, isize found)
+{
+    ASSERT(found < map->capacity && map->probes[found] != 0);
+    uint32_t mask = map->capacity - 1;
+    uint32_t i = (uint32_t) found;
+
+    //Backward shift: move all following entries of the run one slot back
+    // until we reach an empty slot or an entry that is in its home slot.
+    for(;;) {
+        uint32_t next = (i + 1) & mask;
+        if(map->probes[next] <= 1)
+            break;
+
+        uint32_t next_dist = _robin_map_slot_dist(map, info, next);
+        memcpy(map->entries + info.entry_size*i, map->entries + info.entry_size*next, info.entry_size);
+        map->probes[i] = _robin_map_probe_make(next_dist - 1);
+        i = next;
+    }
+
+    memset(map->entries + info.entry_size*i, 0, info.entry_size);
+    map->probes[i] = 0;
+    map->count -= 1;
+}
+
+ROBIN_MAP_INLINE_API void robin_map_clear(Robin_Map* map, Map_Info info)
+{
+    memset(map->entries, 0, map->capacity*info.entry_size);
+    memset(map->probes, 0, map->capacity);
+    map->count = 0;
+    map->max_probe = 0;
+}
+#endif
+
+#if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_MAP_ROBIN)) && !defined(MODULE_HAS_IMPL_MAP_ROBIN)
+#define MODULE_HAS_IMPL_MAP_ROBIN
+
+inline static void* _robin_map_alloc(Allocator* alloc, int64_t new_size, void* old_ptr, int64_t old_size, int64_t align)
+{
+    #ifndef USE_MALLOC
+        return (*alloc)(alloc, 0, new_size, old_ptr, old_size, align, NULL);
+    #else
+        if(new_size != 0) {
+            void* out = realloc(old_ptr, new_size);
+            TEST(out);
+            return out;
+        }
+        else
+            free(old_ptr);
+        return NULL;
+    #endif
+}
+
+ATTRIBUTE_INLINE_NEVER
+EXTERNAL void _robin_map_rehash(Robin_Map* map, isize requested_capacity, uint32_t entry_size, uint32_t entry_align, uint32_t hash_offset)
+{
+    TEST(requested_capacity <= UINT32_MAX);
+    isize least_size = map->count;
+    if(least_size < requested_capacity)
+        least_size = requested_capacity;
+
+    isize new_cap = 16;
+    while(ROBIN_MAP_MAX_LOAD(new_cap) <= least_size)
+        new_cap *= 2;
+    TEST(new_cap <= UINT32_MAX);
+
+    // allocate new slots and set all to empty
+    uint32_t new_mask = (uint32_t) new_cap - 1;
+    uint8_t* new_entries = (uint8_t*) _robin_map_alloc(map->alloc, new_cap*(entry_size + 1), NULL, 0, entry_align);
+    uint8_t* new_probes = new_entries + new_cap*entry_size;
+    memset(new_entries, 0, new_cap*(entry_size + 1));
+
+    //Reinsert all entries. Since we know there are no duplicates to be checked
+    // we can just do the plain robin hood insertion by swapping.
+    uint32_t max_probe = 0;
+    uint8_t* carried = (uint8_t*) _robin_map_alloc(map->alloc, entry_size, NULL, 0, entry_align);
+    for(uint32_t j = 0; j < map->capacity; j++)
+    {
+        if(map->probes[j] == 0)
+            continue;
+
+        memcpy(carried, map->entries + entry_size*j, entry_size);
+        uint64_t hash = 0; memcpy(&hash, carried + hash_offset, sizeof hash);
+        uint32_t i = (uint32_t) hash & new_mask;
+        for(uint32_t dist = 0; ; i = (i + 1) & new_mask, dist++) {
+            ASSERT(dist <= new_cap);
+            if(new_probes[i] == 0) {
+                memcpy(new_entries + entry_size*i, carried, entry_size);
+                new_probes[i] = _robin_map_probe_make(dist);
+                max_probe = max_probe > dist ? max_probe : dist;
+                break;
+            }
+
+            uint64_t slot_hash = 0; memcpy(&slot_hash, new_entries + entry_size*i + hash_offset, sizeof slot_hash);
+            uint32_t slot_dist = (i - (uint32_t) slot_hash) & new_mask;
+            if(slot_dist < dist) {
+                //swap the carried entry with the richer one and continue with it
+                for(uint32_t k = 0; k < entry_size; k++) {
+                    uint8_t temp = carried[k];
+                    carried[k] = new_entries[entry_size*i + k];
+                    new_entries[entry_size*i + k] = temp;
+                }
+                new_probes[i] = _robin_map_probe_make(dist);
+                max_probe = max_probe > dist ? max_probe : dist;
+                dist = slot_dist;
+            }
+        }
+    }
+    _robin_map_alloc(map->alloc, 0, carried, entry_size, entry_align);
+
+    if(map->capacity > 0)
+        _robin_map_alloc(map->alloc, 0, map->entries, map->capacity*(entry_size + 1), entry_align);
+    map->entries = new_entries;
+    map->probes = new_probes;
+    map->capacity = (uint32_t) new_cap;
+    map->max_probe = max_probe;
+    map->rehashes += 1;
+}
+
+ATTRIBUTE_INLINE_NEVER
+EXTERNAL void _robin_map_deinit(Robin_Map* map, uint32_t entry_size, uint32_t entry_align)
+{
+    if(map->capacity > 0)
+        _robin_map_alloc(map->alloc, 0, map->entries, map->capacity*(entry_size + 1), entry_align);
+    memset(map, 0, sizeof* map);
+}
+
+ATTRIBUTE_INLINE_NEVER
+EXTERNAL void robin_map_test_consistency(const Robin_Map* map, Map_Info info, uint32_t flags)
+{
+    if(flags & MAP_TEST_INVARIANTS_BASIC) {
+        if(map->alloc == NULL) {
+            Robin_Map null = {0};
+            TEST(memcmp(map, &null, sizeof *map) == 0);
+        }
+        else {
+            TEST(map->count <= ROBIN_MAP_MAX_LOAD(map->capacity));
+            TEST((map->capacity & (map->capacity - 1)) == 0);
+            TEST((map->capacity == 0) == (map->entries == NULL));
+            TEST(map->probes == map->entries + (isize) map->capacity*info.entry_size);
+        }
+    }
+
+    if(flags & MAP_TEST_INVARIANTS_FIND) {
+        uint32_t mask = map->capacity - 1;
+        isize found_count = 0;
+        for(uint32_t i = 0; i < map->capacity; i++)
+        {
+            uint8_t* entry = map->entries + info.entry_size*i;
+            uint8_t* key = entry + info.key_offset;
+            uint64_t hash = 0; memcpy(&hash, entry + info.hash_offset, sizeof hash);
+
+            //empty slots must be zeroed so that MAP_FOR works
+            if(map->probes[i] == 0) {
+                TEST(hash == 0);
+                continue;
+            }
+
+            //The stored distance must be the real one and runs must be sorted by home slot.
+            // That is the distance can only increase by one from slot to slot.
+            uint32_t dist = (i - (uint32_t) hash) & mask;
+            uint32_t prev = (i - 1) & mask;
+            TEST(map_hash_is_valid(hash));
+            TEST(map->probes[i] == _robin_map_probe_make(dist));
+            TEST(map->probes[prev] != 0 || dist == 0);
+            if(map->probes[prev] != 0)
+                TEST(dist <= _robin_map_slot_dist(map, info, prev) + 1);
+
+            uint32_t index = 0;
+            uint32_t iter = 0;
+            robin_map_find_next_make(map, hash, &index, &iter);
+            bool found_self = false;
+            for(;;) {
+                index = (index + 1) & mask;
+                iter += 1;
+                if(_robin_map_find_next(map, info, key, hash, &index, &iter) == false)
+                    break;
+
+                if(index == i) {
+                    found_self = true;
+                    break;
+                }
+            }
+
+            TEST(found_self);
+            found_count += 1;
+        }
+
+        TEST(map->count == found_count);
+    }
+}
+#endif
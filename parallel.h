@@ -0,0 +1,145 @@
+#ifndef MODULE_PARALLEL
+#define MODULE_PARALLEL
+
+//Simple fork/join helpers shared by the modules which split work over threads (spatial, image_pyramid, slz4_parallel,
+// hash_parallel and sort_external).
+//
+//Threads are launched for each call and joined at its end. That costs tens of microseconds so callers should only go wide
+// for work of at least a few milliseconds. The calling thread always takes part as thread_index 0 so that asking for a
+// single thread never launches anything. parallel_for hands out chunks through one shared counter so chunks of uneven
+// cost balance themselves out.
+
+#include "platform.h"
+#include "assert.h"
+#include "defines.h"
+
+#define PARALLEL_MAX_THREADS 256
+
+typedef void (*Parallel_Func)(void* context, isize thread_index);
+typedef void (*Parallel_For_Func)(void* context, isize from, isize to, isize thread_index);
+
+typedef struct Parallel_Group {
+    Parallel_Func func;
+    void* context;
+    isize launched;
+    PLATFORM_ATOMIC(uint32_t) next_index;
+    PLATFORM_ATOMIC(uint32_t) finished;
+    PLATFORM_ATOMIC(uint32_t) released; //threads which will no longer touch the group
+} Parallel_Group;
+
+//Returns thread_count_or_zero (or the processor count if 0) clamped to [1, min(max_useful, PARALLEL_MAX_THREADS)].
+EXTERNAL isize parallel_thread_count(isize thread_count_or_zero, isize max_useful);
+
+//Starts thread_count threads calling func(context, thread_index) with thread indices first_index, first_index + 1, ...
+// The calling thread is free to do other work in the meantime but must call parallel_join before group goes out of scope.
+EXTERNAL void parallel_launch(Parallel_Group* group, isize first_index, isize thread_count, Parallel_Func func, void* context, const char* name);
+//Waits until all threads launched into group have returned.
+EXTERNAL void parallel_join(Parallel_Group* group);
+
+//Calls func(context, thread_index) from thread_count threads including the calling one (which has thread_index 0) and returns once all are done.
+EXTERNAL void parallel_run(isize thread_count, Parallel_Func func, void* context, const char* name);
+//Calls func on consecutive chunks of [0, count) from at most thread_count_or_zero threads including the calling one (which has thread_index 0).
+// chunk <= 0 splits count evenly between the threads.
+// Uses as many threads as parallel_thread_count(thread_count_or_zero, chunk count) so indices below that can be used to address per thread scratch.
+EXTERNAL void parallel_for(isize count, isize chunk, isize thread_count_or_zero, Parallel_For_Func func, void* context, const char* name);
+#endif
+
+#if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_PARALLEL)) && !defined(MODULE_HAS_IMPL_PARALLEL)
+#define MODULE_HAS_IMPL_PARALLEL
+
+EXTERNAL isize parallel_thread_count(isize thread_count_or_zero, isize max_useful)
+{
+    isize thread_count = thread_count_or_zero > 0 ? thread_count_or_zero : platform_thread_get_processor_count();
+    thread_count = MIN(thread_count, PARALLEL_MAX_THREADS);
+    thread_count = MIN(thread_count, max_useful);
+    return MAX(thread_count, 1);
+}
+
+INTERNAL void _parallel_thread_func(void* context)
+{
+    Parallel_Group* group = (Parallel_Group*) context;
+    isize thread_index = (isize) atomic_fetch_add(&group->next_index, 1);
+    group->func(group->context, thread_index);
+
+    atomic_fetch_add(&group->finished, 1);
+    platform_futex_wake_all(&group->finished);
+    //The last access to group. parallel_join waits for it so that group can live on the joining thread's stack.
+    atomic_fetch_add(&group->released, 1);
+}
+
+EXTERNAL void parallel_launch(Parallel_Group* group, isize first_index, isize thread_count, Parallel_Func func, void* context, const char* name)
+{
+    memset(group, 0, sizeof *group);
+    group->func = func;
+    group->context = context;
+    group->launched = thread_count;
+    atomic_store(&group->next_index, (uint32_t) first_index);
+    for(isize t = 0; t < thread_count; t++) {
+        Platform_Error error = platform_thread_launch(0, _parallel_thread_func, group, "%s %i", name, (int) (first_index + t));
+        TEST(error == 0, "failed to launch %s thread", name);
+    }
+}
+
+EXTERNAL void parallel_join(Parallel_Group* group)
+{
+    uint32_t launched = (uint32_t) group->launched;
+    for(uint32_t finished = 0; (finished = atomic_load(&group->finished)) != launched; )
+        platform_futex_wait(&group->finished, finished, -1);
+
+    //The remaining threads are at most inside the wake above so this spins only briefly
+    while(atomic_load(&group->released) != launched)
+        platform_thread_yield();
+}
+
+EXTERNAL void parallel_run(isize thread_count, Parallel_Func func, void* context, const char* name)
+{
+    if(thread_count <= 1) {
+        func(context, 0);
+        return;
+    }
+
+    Parallel_Group group = {0};
+    parallel_launch(&group, 1, thread_count - 1, func, context, name);
+    func(context, 0);
+    parallel_join(&group);
+}
+
+typedef struct _Parallel_For {
+    Parallel_For_Func func;
+    void* context;
+    isize count;
+    isize chunk;
+    PLATFORM_ATOMIC(uint32_t) next_chunk;
+} _Parallel_For;
+
+INTERNAL void _parallel_for_worker(void* context, isize thread_index)
+{
+    _Parallel_For* work = (_Parallel_For*) context;
+    for(;;) {
+        isize from = (isize) atomic_fetch_add(&work->next_chunk, 1)*work->chunk;
+        if(from >= work->count)
+            break;
+        work->func(work->context, from, MIN(from + work->chunk, work->count), thread_index);
+    }
+}
+
+EXTERNAL void parallel_for(isize count, isize chunk, isize thread_count_or_zero, Parallel_For_Func func, void* context, const char* name)
+{
+    if(count <= 0)
+        return;
+    if(chunk <= 0) {
+        isize threads = parallel_thread_count(thread_count_or_zero, count);
+        chunk = (count + threads - 1)/threads;
+    }
+
+    isize thread_count = parallel_thread_count(thread_count_or_zero, (count + chunk - 1)/chunk);
+    if(thread_count <= 1) {
+        func(context, 0, count, 0);
+        return;
+    }
+
+    _Parallel_For work = {func, context, count, chunk};
+    parallel_run(thread_count, _parallel_for_worker, &work, name);
+}
+
+#endif
@@ -180,6 +180,7 @@ EXTERNAL void         path_builder_assign(Path_Builder* into, Path path, int fla
 EXTERNAL Path_Builder path_builder_dup(Allocator* alloc, Path_Builder to_copy);
 EXTERNAL void         path_builder_clear(Path_Builder* builder);
 EXTERNAL void         path_normalize_in_place(Path_Builder* path, int flags);
+EXTERNAL void         path_append_normalized_root(String_Builder* into, Path path, char slash); //Appends the root of path with the separators replaced by slash and the drive letter uppercased
 
 //Normalizes the given path removing '..', '.', double slashes, converting slashes to '/'. 
 //When given relative resp. absolute path the output is relative resp. absolute.
@@ -628,6 +629,59 @@ EXTERNAL void path_builder_clear(Path_Builder* builder)
     builder_clear(&builder->builder);
 }
 
+EXTERNAL void path_append_normalized_root(String_Builder* into, Path path, char slash)
+{
+    String root_content = path_get_root_content(path);
+    switch(path.info.root_kind)
+    {
+        case PATH_ROOT_NONE: {
+            ASSERT(path.info.is_absolute == false);
+        } break;
+
+        case PATH_ROOT_SLASH: {
+            builder_push(into, slash);
+        } break;
+
+        case PATH_ROOT_SLASH_SLASH: {
+            builder_push(into, slash);
+            builder_push(into, slash);
+        } break;
+
+        case PATH_ROOT_SERVER: {
+            builder_push(into, slash);
+            builder_push(into, slash);
+            if(path.info.root_content_to > path.info.root_content_from)
+            {
+                builder_append(into, root_content);
+                builder_push(into, slash);
+            }
+            else
+                LOG_WARN("path", "Empty prefix '%.*s' with PATH_ROOT_SERVER", STRING_PRINT(root_content));
+        } break;
+
+        case PATH_ROOT_WIN: {
+            char c = 'C';
+            if(root_content.count > 0 && char_is_alpha(root_content.data[0]))
+                c = root_content.data[0];
+            else
+                LOG_WARN("path", "Strange prefix '%.*s' with PATH_ROOT_WIN", STRING_PRINT(root_content));
+
+            //to uppercase
+            if('a' <= c && c <= 'z')
+                c = c - 'a' + 'A';
+
+            builder_push(into, c);
+            builder_push(into, ':');
+            if(path.info.is_absolute)
+                builder_push(into, slash);
+        } break;
+
+        case PATH_ROOT_UNKNOWN: {
+            builder_append(into, path_get_root(path));
+        } break;
+    }
+}
+
 EXTERNAL bool path_builder_append(Path_Builder* into, Path path, int flags)
 {
     PROFILE_START();
@@ -677,60 +731,11 @@ EXTERNAL bool path_builder_append(Path_Builder* into, Path path, int flags)
             //Only set root when empty else bad bad.
             if(was_empty)
             {
-                String root_content = path_get_root_content(path);
                 ASSERT(into->info.root_kind == PATH_ROOT_NONE);
                 ASSERT(into->info.root_size == 0);
                 ASSERT(into->info.root_content_from == 0);
                 ASSERT(into->info.root_content_to == 0);
-
-                switch(path.info.root_kind)
-                {
-                    case PATH_ROOT_NONE: {
-                        ASSERT(path.info.is_absolute == false);
-                    } break;
-
-                    case PATH_ROOT_SLASH: {
-                        builder_push(&into->builder, slash);
-                    } break;
-
-                    case PATH_ROOT_SLASH_SLASH: {
-                        builder_push(&into->builder, slash);
-                        builder_push(&into->builder, slash);
-                    } break;
-
-                    case PATH_ROOT_SERVER: {
-                        builder_push(&into->builder, slash);
-                        builder_push(&into->builder, slash);
-                        if(path.info.root_content_to > path.info.root_content_from)
-                        {
-                            builder_append(&into->builder, root_content);
-                            builder_push(&into->builder, slash);
-                        }
-                        else
-                            LOG_WARN("path", "Empty prefix '%.*s' with PATH_ROOT_SERVER", STRING_PRINT(root_content));
-                    } break;
-
-                    case PATH_ROOT_WIN: {
-                        char c = 'C';
-                        if(root_content.count > 0 && char_is_alpha(root_content.data[0]))
-                            c = root_content.data[0];
-                        else
-                            LOG_WARN("path", "Strange prefix '%.*s' with PATH_ROOT_WIN", STRING_PRINT(root_content));
-
-                        //to uppercase
-                        if('a' <= c && c <= 'z')
-                            c = c - 'a' + 'A';
-
-                        builder_push(&into->builder, c);
-                        builder_push(&into->builder, ':');
-                        if(path.info.is_absolute)
-                            builder_push(&into->builder, slash);
-                    } break;
-
-                    case PATH_ROOT_UNKNOWN: {
-                        builder_append(&into->builder, path_get_root(path));
-                    } break;
-                }
+                path_append_normalized_root(&into->builder, path, slash);
 
                 if(path.info.root_kind != PATH_ROOT_NONE)
                     path_parse_root(into->string, &into->info);
@@ -776,9 +781,10 @@ EXTERNAL bool path_builder_append(Path_Builder* into, Path path, int flags)
                     if(into->info.segment_count > 0)
                     {
                         isize last_segment_i = string_find_last_path_separator(into->string, into->string.count);
+                        isize last_segment_from = last_segment_i + 1;
                         if(last_segment_i < root_till)
-                           last_segment_i = root_till;
-                        String last_segement = string_tail(into->string, last_segment_i);
+                           last_segment_i = last_segment_from = root_till;
+                        String last_segement = string_tail(into->string, last_segment_from);
                         if(string_is_equal(last_segement, STRING("..")) == false)
                         {
                             builder_resize(&into->builder, last_segment_i, '\0');
@@ -0,0 +1,560 @@
+#ifndef MODULE_PATH_STORE
+#define MODULE_PATH_STORE
+
+//Interns normalized paths into a prefix tree so that each distinct path is a single 32 bit Path_Id.
+//
+//Every node of the tree is one path segment with a link to its parent. Roots (together with the prefix such as \\?\)
+// are children of node 0 which is the empty relative path. Segment strings are themselves interned so a segment
+// such as "src" is stored once no matter how many directories contain it. A path of n segments below an already
+// interned directory thus costs n nodes of 16 bytes at most and usually much less.
+//
+//The low bit of Path_Id tells if the path is a directory (has trailing slash), the rest is the node index. Because
+// the text is always normalized (the same as path_normalize with no flags would produce) two paths are equal exactly
+// when their ids are equal. Root only paths ("/", "C:/") and paths ending in ".." are always directories.
+//
+//path_store_parent and path_store_child are O(1). path_store_concat is O(1) for pairs which were concatenated
+// before and O(depth of b) the first time. path_store_intern_many interns a batch of paths without any allocation
+// besides growing the store and reuses the nodes of the shared prefix of consecutive paths, which is the common
+// case for sorted file lists.
+//
+//The text of a path is rebuilt on demand with path_store_append_into by walking from the node to the root.
+
+#include "path.h"
+#include "hash.h"
+#include "hash_func.h"
+
+typedef uint32_t Path_Id;
+
+#define PATH_ID_EMPTY   ((Path_Id) 0) //""
+#define PATH_ID_CURRENT ((Path_Id) 1) //"./"
+
+typedef enum Path_Store_Node_Flag {
+    PATH_STORE_NODE_ROOT = 1,       //The segment is the prefix and root
+    PATH_STORE_NODE_ABSOLUTE = 2,   //The path starts with an absolute root. Inherited by all children
+    PATH_STORE_NODE_DOT_DOT = 4,    //The segment is ".." (which can only be the leading segments of relative paths)
+    PATH_STORE_NODE_PREFIX_ONLY = 8,//The root is just a prefix such as \\.\ which on its own is written as \\.\./
+} Path_Store_Node_Flag;
+
+typedef struct Path_Store_Node {
+    uint32_t parent;
+    uint32_t segment;
+    uint32_t text_size; //size of the text without trailing slash
+    uint16_t depth;     //number of segments not counting the root
+    uint16_t flags;
+} Path_Store_Node;
+
+typedef struct Path_Store_Segment {
+    uint32_t from;      //offset into segment_data
+    uint32_t size;
+} Path_Store_Segment;
+
+typedef struct Path_Store {
+    Allocator* allocator;
+    Path_Store_Node* nodes;
+    Path_Store_Segment* segments;
+    isize node_count;
+    isize node_capacity;
+    isize segment_count;
+    isize segment_capacity;
+    String_Builder segment_data;
+    String_Builder root;        //scratch for normalizing roots
+
+    Hash segment_hash;          //xxhash64 of segment text -> segment index
+    Hash child_hash;            //parent << 32 | segment -> node index
+    Hash concat_hash;           //a << 32 | b -> Path_Id
+} Path_Store;
+
+EXTERNAL void    path_store_init(Path_Store* store, Allocator* alloc_or_null);
+EXTERNAL void    path_store_deinit(Path_Store* store);
+
+EXTERNAL Path_Id path_store_intern(Path_Store* store, Path path); //Returns the id of the normalized path
+EXTERNAL Path_Id path_store_intern_string(Path_Store* store, String path);
+EXTERNAL void    path_store_intern_many(Path_Store* store, const String* paths, isize count, Path_Id* ids); //Fills ids[i] with the id of paths[i]. Faster when similar paths are next to each other
+
+EXTERNAL Path_Id path_store_parent(Path_Store* store, Path_Id id); //Returns the containing directory, same as id/.. Roots and "" are their own parents
+EXTERNAL Path_Id path_store_child(Path_Store* store, Path_Id id, String segment); //Returns id/segment. "." returns id as directory, ".." behaves as in normalization
+EXTERNAL Path_Id path_store_concat(Path_Store* store, Path_Id a, Path_Id b); //Returns a/b. The root of b is ignored unless a is empty
+EXTERNAL Path_Id path_store_make_relative(Path_Store* store, Path_Id relative_to, Path_Id path); //Returns path relative to the directory of relative_to. Returns path if they have different roots
+EXTERNAL bool    path_store_is_within(const Path_Store* store, Path_Id directory, Path_Id path); //Returns true if path is directory or is contained in it at any depth
+EXTERNAL Path_Id path_store_to_directory(Path_Id id);
+EXTERNAL Path_Id path_store_to_file(const Path_Store* store, Path_Id id); //Removes the trailing slash unless the path must be a directory
+
+EXTERNAL String  path_store_segment(const Path_Store* store, Path_Id id); //Returns the last segment (or the prefix and root for root only paths)
+EXTERNAL isize   path_store_depth(const Path_Store* store, Path_Id id); //Returns the number of segments not counting the root
+EXTERNAL Path_Id path_store_root(const Path_Store* store, Path_Id id); //Returns the prefix and root of id or PATH_ID_EMPTY if it has none
+EXTERNAL bool    path_store_is_absolute(const Path_Store* store, Path_Id id);
+EXTERNAL bool    path_store_is_directory(Path_Id id);
+EXTERNAL isize   path_store_text_size(const Path_Store* store, Path_Id id);
+EXTERNAL void    path_store_append_into(const Path_Store* store, Path_Id id, String_Builder* into); //Appends the normalized text of id
+
+#endif
+
+#if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_PATH_STORE)) && !defined(MODULE_HAS_IMPL_PATH_STORE)
+#define MODULE_HAS_IMPL_PATH_STORE
+
+#define _PATH_STORE_EMPTY       ((uint64_t) -2)
+#define _PATH_STORE_ROOT_PARENT 0xFFFFFFFFull
+
+EXTERNAL void path_store_init(Path_Store* store, Allocator* alloc_or_null)
+{
+    path_store_deinit(store);
+    store->allocator = alloc_or_null ? alloc_or_null : allocator_get_default();
+    builder_init(&store->segment_data, store->allocator);
+    builder_init(&store->root, store->allocator);
+    hash_init(&store->segment_hash, store->allocator, _PATH_STORE_EMPTY);
+    hash_init(&store->child_hash, store->allocator, _PATH_STORE_EMPTY);
+    hash_init(&store->concat_hash, store->allocator, _PATH_STORE_EMPTY);
+
+    store->node_capacity = 64;
+    store->nodes = (Path_Store_Node*) allocator_allocate(store->allocator, store->node_capacity*sizeof(Path_Store_Node), 8);
+    store->node_count = 1;
+    memset(&store->nodes[0], 0, sizeof store->nodes[0]);
+}
+
+EXTERNAL void path_store_deinit(Path_Store* store)
+{
+    if(store->allocator)
+    {
+        allocator_deallocate(store->allocator, store->nodes, store->node_capacity*sizeof(Path_Store_Node), 8);
+        allocator_deallocate(store->allocator, store->segments, store->segment_capacity*sizeof(Path_Store_Segment), 8);
+        builder_deinit(&store->segment_data);
+        builder_deinit(&store->root);
+        hash_deinit(&store->segment_hash);
+        hash_deinit(&store->child_hash);
+        hash_deinit(&store->concat_hash);
+    }
+    memset(store, 0, sizeof *store);
+}
+
+INTERNAL String _path_store_segment_string(const Path_Store* store, uint32_t segment)
+{
+    Path_Store_Segment seg = store->segments[segment];
+    String out = {store->segment_data.data + seg.from, (isize) seg.size};
+    return out;
+}
+
+INTERNAL uint32_t _path_store_intern_segment(Path_Store* store, String segment)
+{
+    uint64_t hash = xxhash64(segment.data, segment.count, 0);
+    for(Hash_Iter it = {0}; hash_iterate(&store->segment_hash, hash, &it); )
+    {
+        uint32_t found = (uint32_t) it.entry->value;
+        if(string_is_equal(_path_store_segment_string(store, found), segment))
+            return found;
+    }
+
+    if(store->segment_count >= store->segment_capacity)
+    {
+        isize new_capacity = store->segment_capacity*2 + 64;
+        store->segments = (Path_Store_Segment*) allocator_reallocate(store->allocator, new_capacity*sizeof(Path_Store_Segment), store->segments, store->segment_capacity*sizeof(Path_Store_Segment), 8);
+        store->segment_capacity = new_capacity;
+    }
+
+    ASSERT(store->segment_data.count + segment.count <= UINT32_MAX && "too much segment data");
+    uint32_t index = (uint32_t) store->segment_count++;
+    store->segments[index].from = (uint32_t) store->segment_data.count;
+    store->segments[index].size = (uint32_t) segment.count;
+    builder_append(&store->segment_data, segment);
+    hash_insert(&store->segment_hash, hash, index);
+    return index;
+}
+
+//Returns the child of parent with the given interned segment, adding it if its not yet present.
+//Roots are keyed under a parent index that cannot occur so that a root never matches a segment of the same text.
+INTERNAL uint32_t _path_store_child_node(Path_Store* store, uint32_t parent, uint32_t segment, uint16_t flags)
+{
+    uint64_t key_parent = (flags & PATH_STORE_NODE_ROOT) ? _PATH_STORE_ROOT_PARENT : parent;
+    uint64_t hash = hash64_bijective(key_parent << 32 | segment);
+    isize found = 0;
+    if(hash_find_or_insert(&store->child_hash, hash, (uint64_t) store->node_count, &found) == false)
+        return (uint32_t) store->child_hash.entries[found].value;
+
+    if(store->node_count >= store->node_capacity)
+    {
+        isize new_capacity = store->node_capacity*2;
+        store->nodes = (Path_Store_Node*) allocator_reallocate(store->allocator, new_capacity*sizeof(Path_Store_Node), store->nodes, store->node_capacity*sizeof(Path_Store_Node), 8);
+        store->node_capacity = new_capacity;
+    }
+
+    ASSERT(store->node_count < UINT32_MAX/2 && "too many paths");
+    Path_Store_Node parent_node = store->nodes[parent];
+    Path_Store_Node* node = &store->nodes[store->node_count];
+    node->parent = parent;
+    node->segment = segment;
+    node->text_size = parent_node.text_size + (parent_node.depth > 0) + store->segments[segment].size;
+    node->flags = (uint16_t) (flags | (parent_node.flags & PATH_STORE_NODE_ABSOLUTE));
+    if(flags & PATH_STORE_NODE_ROOT)
+        node->depth = 0;
+    else
+    {
+        ASSERT(parent_node.depth < UINT16_MAX && "path too deep");
+        node->depth = (uint16_t) (parent_node.depth + 1);
+    }
+
+    return (uint32_t) store->node_count++;
+}
+
+//Applies ".." to node: removes the last segment if there is one to remove,
+// otherwise does nothing for absolute paths and appends ".." for relative ones
+INTERNAL uint32_t _path_store_pop(Path_Store* store, uint32_t node)
+{
+    Path_Store_Node at = store->nodes[node];
+    if(at.depth > 0 && (at.flags & PATH_STORE_NODE_DOT_DOT) == 0)
+        return at.parent;
+    if(at.flags & PATH_STORE_NODE_ABSOLUTE)
+        return node;
+    return _path_store_child_node(store, node, _path_store_intern_segment(store, STRING("..")), PATH_STORE_NODE_DOT_DOT);
+}
+
+INTERNAL uint32_t _path_store_push(Path_Store* store, uint32_t node, String segment)
+{
+    if(segment.count == 0 || (segment.count == 1 && segment.data[0] == '.'))
+        return node;
+    if(segment.count == 2 && segment.data[0] == '.' && segment.data[1] == '.')
+        return _path_store_pop(store, node);
+    return _path_store_child_node(store, node, _path_store_intern_segment(store, segment), 0);
+}
+
+INTERNAL uint32_t _path_store_root_node(Path_Store* store, Path path)
+{
+    if(path.info.prefix_size == 0 && path.info.root_kind == PATH_ROOT_NONE)
+        return 0;
+
+    builder_clear(&store->root);
+    builder_append(&store->root, path_get_prefix(path));
+    path_append_normalized_root(&store->root, path, '/');
+    uint32_t segment = _path_store_intern_segment(store, store->root.string);
+    uint16_t flags = PATH_STORE_NODE_ROOT;
+    if(path.info.is_absolute)
+        flags |= PATH_STORE_NODE_ABSOLUTE;
+    if(path.info.root_kind == PATH_ROOT_NONE)
+        flags |= PATH_STORE_NODE_PREFIX_ONLY;
+    return _path_store_child_node(store, 0, segment, flags);
+}
+
+//Roots and paths ending in ".." are always directories. A non empty path normalizing to nothing is "./"
+INTERNAL Path_Id _path_store_id(const Path_Store* store, uint32_t node, bool is_directory, bool is_empty)
+{
+    if(node == 0)
+        return is_empty ? PATH_ID_EMPTY : PATH_ID_CURRENT;
+
+    Path_Store_Node at = store->nodes[node];
+    if(at.depth == 0 || (at.flags & PATH_STORE_NODE_DOT_DOT))
+        is_directory = true;
+    return (Path_Id) node << 1 | (Path_Id) is_directory;
+}
+
+EXTERNAL Path_Id path_store_intern(Path_Store* store, Path path)
+{
+    PROFILE_START();
+    uint32_t node = _path_store_root_node(store, path);
+    for(Path_Segement_Iterator it = {0}; path_segment_iterate(&it, path); )
+        node = _path_store_push(store, node, it.segment);
+
+    Path_Id out = _path_store_id(store, node, path.info.is_directory, path_is_empty(path));
+    PROFILE_STOP();
+    return out;
+}
+
+EXTERNAL Path_Id path_store_intern_string(Path_Store* store, String path)
+{
+    return path_store_intern(store, path_parse(path));
+}
+
+EXTERNAL void path_store_intern_many(Path_Store* store, const String* paths, isize count, Path_Id* ids)
+{
+    PROFILE_START();
+    //The node after processing the first byte_to bytes of the previous path for each of its segment ends.
+    //Another path which starts with the same bytes up to a segment end can continue from that node.
+    enum {MAX_RESUME = 64};
+    isize resume_bytes[MAX_RESUME];
+    uint32_t resume_nodes[MAX_RESUME];
+    isize resume_count = 0;
+    isize prev_root_to = -1;
+    String prev = {0};
+
+    for(isize i = 0; i < count; i++)
+    {
+        String string = paths[i];
+        Path path = path_parse(string);
+        isize root_to = path.info.prefix_size + path.info.root_size;
+
+        isize r = 0;
+        if(root_to == prev_root_to)
+        {
+            isize common = 0;
+            isize max_common = MIN(string.count, prev.count);
+            while(common < max_common && string.data[common] == prev.data[common])
+                common += 1;
+
+            for(r = resume_count; r > 0; r--)
+            {
+                isize at = resume_bytes[r - 1];
+                if(at < common || (at == common && (at == string.count || is_path_sep(string.data[at]))))
+                    break;
+            }
+        }
+
+        uint32_t node = 0;
+        isize from = root_to;
+        if(r > 0)
+        {
+            node = resume_nodes[r - 1];
+            from = resume_bytes[r - 1];
+        }
+        else
+        {
+            node = _path_store_root_node(store, path);
+            resume_bytes[0] = root_to;
+            resume_nodes[0] = node;
+            r = 1;
+        }
+
+        //Split by hand so that we know the byte offsets of the segment ends
+        while(from < string.count)
+        {
+            if(is_path_sep(string.data[from]))
+                from += 1;
+
+            isize to = from;
+            while(to < string.count && is_path_sep(string.data[to]) == false)
+                to += 1;
+
+            node = _path_store_push(store, node, string_range(string, from, to));
+            if(r < MAX_RESUME)
+            {
+                resume_bytes[r] = to;
+                resume_nodes[r] = node;
+                r += 1;
+            }
+            from = to;
+        }
+
+        resume_count = r;
+        prev_root_to = root_to;
+        prev = string;
+        ids[i] = _path_store_id(store, node, path.info.is_directory, path_is_empty(path));
+    }
+    PROFILE_STOP();
+}
+
+EXTERNAL Path_Id path_store_parent(Path_Store* store, Path_Id id)
+{
+    uint32_t node = id >> 1;
+    if(id == PATH_ID_EMPTY || (node != 0 && store->nodes[node].depth == 0))
+        return id;
+    return _path_store_id(store, _path_store_pop(store, node), true, false);
+}
+
+EXTERNAL Path_Id path_store_child(Path_Store* store, Path_Id id, String segment)
+{
+    uint32_t node = _path_store_push(store, id >> 1, segment);
+    bool is_directory = segment.count == 0 || string_is_equal(segment, STRING(".")) || string_is_equal(segment, STRING(".."));
+    return _path_store_id(store, node, is_directory, false);
+}
+
+EXTERNAL Path_Id path_store_to_directory(Path_Id id)
+{
+    return id | 1;
+}
+
+EXTERNAL Path_Id path_store_to_file(const Path_Store* store, Path_Id id)
+{
+    return _path_store_id(store, id >> 1, false, id == PATH_ID_EMPTY);
+}
+
+//Appends the segment nodes of node (that is without its root) onto onto. Walks up from the node into a
+// buffer first since the segments need to be applied from the top.
+INTERNAL uint32_t _path_store_apply_segments(Path_Store* store, uint32_t onto, uint32_t node)
+{
+    uint32_t chain_buffer[64];
+    uint32_t* chain = chain_buffer;
+    isize depth = store->nodes[node].depth;
+    if(depth > (isize) ARRAY_COUNT(chain_buffer))
+        chain = (uint32_t*) allocator_allocate(store->allocator, depth*(isize) sizeof(uint32_t), 4);
+
+    isize i = depth;
+    for(uint32_t n = node; i > 0; n = store->nodes[n].parent)
+        chain[--i] = n;
+
+    for(i = 0; i < depth; i++)
+    {
+        Path_Store_Node at = store->nodes[chain[i]];
+        if(at.flags & PATH_STORE_NODE_DOT_DOT)
+            onto = _path_store_pop(store, onto);
+        else
+            onto = _path_store_child_node(store, onto, at.segment, 0);
+    }
+
+    if(chain != chain_buffer)
+        allocator_deallocate(store->allocator, chain, depth*(isize) sizeof(uint32_t), 4);
+    return onto;
+}
+
+EXTERNAL Path_Id path_store_concat(Path_Store* store, Path_Id a, Path_Id b)
+{
+    if(b == PATH_ID_EMPTY)
+        return a;
+    if(a == PATH_ID_EMPTY)
+        return b;
+
+    uint64_t hash = hash64_bijective((uint64_t) a << 32 | b);
+    isize found = 0;
+    if(hash_find(&store->concat_hash, hash, &found))
+        return (Path_Id) store->concat_hash.entries[found].value;
+
+    uint32_t node = _path_store_apply_segments(store, a >> 1, b >> 1);
+    Path_Id out = _path_store_id(store, node, b & 1, false);
+    hash_insert(&store->concat_hash, hash, out);
+    return out;
+}
+
+INTERNAL uint32_t _path_store_ancestor(const Path_Store* store, uint32_t node, isize depth)
+{
+    while(store->nodes[node].depth > depth)
+        node = store->nodes[node].parent;
+    return node;
+}
+
+EXTERNAL Path_Id path_store_make_relative(Path_Store* store, Path_Id relative_to, Path_Id path)
+{
+    uint32_t base = relative_to >> 1;
+    uint32_t node = path >> 1;
+    if((relative_to & 1) == 0)
+        base = store->nodes[base].parent;
+
+    //Different roots cannot be made relative to each other
+    if(_path_store_ancestor(store, base, 0) != _path_store_ancestor(store, node, 0))
+        return path;
+
+    isize depth = MIN(store->nodes[base].depth, store->nodes[node].depth);
+    uint32_t common_base = _path_store_ancestor(store, base, depth);
+    uint32_t common_node = _path_store_ancestor(store, node, depth);
+    while(common_base != common_node)
+    {
+        common_base = store->nodes[common_base].parent;
+        common_node = store->nodes[common_node].parent;
+    }
+
+    //Going up through ".." of base would need the name of the directory above it which we dont know.
+    uint32_t out = 0;
+    for(uint32_t n = base; n != common_base; n = store->nodes[n].parent)
+    {
+        if(store->nodes[n].flags & PATH_STORE_NODE_DOT_DOT)
+            return path;
+        out = _path_store_pop(store, out);
+    }
+
+    //Append the segments of path below the common node
+    isize below = store->nodes[node].depth - store->nodes[common_node].depth;
+    uint32_t chain_buffer[64];
+    uint32_t* chain = chain_buffer;
+    if(below > (isize) ARRAY_COUNT(chain_buffer))
+        chain = (uint32_t*) allocator_allocate(store->allocator, below*(isize) sizeof(uint32_t), 4);
+
+    isize i = below;
+    for(uint32_t n = node; i > 0; n = store->nodes[n].parent)
+        chain[--i] = n;
+    for(i = 0; i < below; i++)
+        out = _path_store_child_node(store, out, store->nodes[chain[i]].segment, store->nodes[chain[i]].flags & PATH_STORE_NODE_DOT_DOT);
+
+    if(chain != chain_buffer)
+        allocator_deallocate(store->allocator, chain, below*(isize) sizeof(uint32_t), 4);
+
+    return _path_store_id(store, out, path & 1, false);
+}
+
+EXTERNAL bool path_store_is_within(const Path_Store* store, Path_Id directory, Path_Id path)
+{
+    uint32_t dir_node = directory >> 1;
+    uint32_t node = path >> 1;
+    isize dir_depth = store->nodes[dir_node].depth;
+    isize depth = store->nodes[node].depth;
+    if(depth <= dir_depth)
+        return node == dir_node;
+
+    //"../../x" is not within "../" even though it starts with it
+    uint32_t below = _path_store_ancestor(store, node, dir_depth + 1);
+    if(store->nodes[below].flags & PATH_STORE_NODE_DOT_DOT)
+        return false;
+    return store->nodes[below].parent == dir_node;
+}
+
+EXTERNAL String path_store_segment(const Path_Store* store, Path_Id id)
+{
+    uint32_t node = id >> 1;
+    if(node == 0)
+        return id == PATH_ID_CURRENT ? STRING(".") : STRING("");
+    return _path_store_segment_string(store, store->nodes[node].segment);
+}
+
+EXTERNAL isize path_store_depth(const Path_Store* store, Path_Id id)
+{
+    return store->nodes[id >> 1].depth;
+}
+
+EXTERNAL Path_Id path_store_root(const Path_Store* store, Path_Id id)
+{
+    uint32_t root = _path_store_ancestor(store, id >> 1, 0);
+    return root == 0 ? PATH_ID_EMPTY : (Path_Id) root << 1 | 1;
+}
+
+EXTERNAL bool path_store_is_absolute(const Path_Store* store, Path_Id id)
+{
+    return (store->nodes[id >> 1].flags & PATH_STORE_NODE_ABSOLUTE) != 0;
+}
+
+EXTERNAL bool path_store_is_directory(Path_Id id)
+{
+    return (id & 1) != 0;
+}
+
+//Size of the trailing part not contained in text_size of the node: "/" for directories, "./" for prefix only roots
+INTERNAL isize _path_store_suffix_size(const Path_Store* store, Path_Id id)
+{
+    Path_Store_Node at = store->nodes[id >> 1];
+    if(at.flags & PATH_STORE_NODE_PREFIX_ONLY && at.depth == 0)
+        return 2;
+    return (id & 1) && at.depth > 0;
+}
+
+EXTERNAL isize path_store_text_size(const Path_Store* store, Path_Id id)
+{
+    if(id >> 1 == 0)
+        return id == PATH_ID_CURRENT ? 2 : 0;
+    return (isize) store->nodes[id >> 1].text_size + _path_store_suffix_size(store, id);
+}
+
+EXTERNAL void path_store_append_into(const Path_Store* store, Path_Id id, String_Builder* into)
+{
+    isize size = path_store_text_size(store, id);
+    isize start = into->count;
+    builder_resize(into, start + size, BUILDER_REISIZE_FOR_OVERWRITE);
+    char* out = into->data + start;
+    if(id == PATH_ID_CURRENT)
+    {
+        memcpy(out, "./", 2);
+        return;
+    }
+
+    isize text_size = store->nodes[id >> 1].text_size;
+    if(size - text_size == 2)
+        memcpy(out + text_size, "./", 2);
+    else if(size - text_size == 1)
+        out[text_size] = '/';
+
+    //Write the segments backwards from the end. Only segments (not roots) are separated by slash
+    isize pos = text_size;
+    for(uint32_t n = id >> 1; n != 0; n = store->nodes[n].parent)
+    {
+        Path_Store_Node at = store->nodes[n];
+        String segment = _path_store_segment_string(store, at.segment);
+        pos -= segment.count;
+        memcpy(out + pos, segment.data, (size_t) segment.count);
+        if(at.depth > 1)
+            out[--pos] = '/';
+    }
+    ASSERT(pos == 0);
+}
+
+#endif
@@ -144,7 +144,7 @@ void* platform_heap_reallocate(isize new_size, void* old_ptr, isize old_size, is
 // not programmer mistake. However in practice they will not happened and if they do we are doing something
 // very specific and a custom implementation is preferred (or we can just change this).
 
-Platform_Error  platform_thread_launch(isize stack_size_or_zero, void (*func)(void*), void* context, const char* name_fmt, ...);
+Platform_Error  platform_thread_launch(isize stack_size_or_zero, void (*func)(void*), void* context, const char* name_fmt, ...); //Launches a detached thread. Its resources are released once func returns.
 int32_t         platform_thread_get_processor_count();
 int32_t         platform_thread_id(); //returns a unique identificator of the calling thread
 int32_t         platform_thread_main_id(); //Returns the handle to the thread which called platform_init(). If platform_init() was not called returns -1.
@@ -293,6 +293,18 @@ Platform_Error platform_file_read(Platform_File* file, void* buffer, isize size,
 Platform_Error platform_file_write(Platform_File* file, const void* buffer, isize size, isize offset); //if offset is INT64_MAX writes at end
 Platform_Error platform_file_flush(Platform_File* file);
 
+typedef enum Platform_File_Map_Flags {
+    PLATFORM_FILE_MAP_READ = 1,             //The mapped memory can be read
+    PLATFORM_FILE_MAP_WRITE = 2,            //Writes to the mapped memory are written back to the file. Requires the file to be opened for writing.
+    PLATFORM_FILE_MAP_COPY_ON_WRITE = 4,    //The mapped memory can be written but the changes are private to the process and never reach the file.
+    PLATFORM_FILE_MAP_HINT_RANDOM_ACCESS = 8, //we expect to access the mapped pages in random order (disables read ahead)
+} Platform_File_Map_Flags;
+
+//Maps size bytes of already open file starting at offset into memory. Offset must be a multiple of platform_allocation_granularity().
+//The pages are read in lazily on first access. The mapping stays valid even after the file is closed and has to be released with platform_file_unmap.
+Platform_Error platform_file_map(void** address, const Platform_File* file, isize offset, isize size, int map_flags);
+Platform_Error platform_file_unmap(void* address, isize size);
+
 //The fastest way to read/write/append a file. 
 //@NOTE: Maybe in the future we will want some mechanism to read as fast as possible a collection of files in async way. 
 //This could be useful for games with loose files
@@ -267,7 +267,6 @@ void* platform_heap_reallocate(isize new_size, void* old_ptr, isize old_size, is
 #include <linux/prctl.h>  /* Definition of PR_* constants */
 #include <sys/prctl.h>
 typedef struct Platform_Pthread_State {
-    pthread_t thread;
     char* name;
     int name_size;
     void (*func)(void*);
@@ -294,8 +293,10 @@ Platform_Error platform_thread_launch(isize stack_size_or_zero, void (*func)(voi
     error = _platform_error_code(thread_state != NULL);
     if(error == 0)
     {
+        //Nothing ever joins the threads so they must be detached, else each keeps its stack until the process exits
         pthread_attr_t attr = {0};
         pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
         if(stack_size_or_zero > 0)
             pthread_attr_setstacksize(&attr, (size_t) stack_size_or_zero);
 
@@ -313,8 +314,12 @@ Platform_Error platform_thread_launch(isize stack_size_or_zero, void (*func)(voi
 
         thread_state->func = func;
         thread_state->context = context;
-        error = pthread_create(&thread_state->thread, &attr, _platform_pthread_start_routine, thread_state);
+        //The thread might have already finished and freed thread_state so the handle cannot be written into it
+        pthread_t thread = {0};
+        error = pthread_create(&thread, &attr, _platform_pthread_start_routine, thread_state);
         pthread_attr_destroy(&attr);
+        if(error)
+            free(thread_state->name);
     }
 
     if(error)
@@ -818,7 +823,7 @@ Platform_Error platform_file_read(Platform_File* file, void* buffer, isize size,
     isize total_read = 0;
     if(file->handle) {
         for(; total_read < size;) {
-            ssize_t bytes_read = pread(_platform_fd(file), (unsigned char*)buffer + total_read, (size_t) (size - total_read), offset);
+            ssize_t bytes_read = pread(_platform_fd(file), (unsigned char*)buffer + total_read, (size_t) (size - total_read), offset + total_read);
             if(bytes_read <= 0) //eof or error
                 break;
             total_read += bytes_read;
@@ -913,6 +918,34 @@ Platform_Error platform_file_flush(Platform_File* file)
     return _platform_error_code(state);
 }
 
+Platform_Error platform_file_map(void** address, const Platform_File* file, isize offset, isize size, int map_flags)
+{
+    void* out = NULL;
+    if(file->handle) {
+        int prot = PROT_NONE;
+        if(map_flags & PLATFORM_FILE_MAP_READ) prot |= PROT_READ;
+        if(map_flags & (PLATFORM_FILE_MAP_WRITE | PLATFORM_FILE_MAP_COPY_ON_WRITE)) prot |= PROT_WRITE;
+        int flags = (map_flags & PLATFORM_FILE_MAP_COPY_ON_WRITE) ? MAP_PRIVATE : MAP_SHARED;
+
+        out = mmap(NULL, (size_t) size, prot, flags, _platform_fd(file), (off_t) offset);
+        if(out == MAP_FAILED)
+            out = NULL;
+        else if(map_flags & PLATFORM_FILE_MAP_HINT_RANDOM_ACCESS)
+            madvise(out, (size_t) size, MADV_RANDOM);
+    }
+
+    *address = out;
+    return _platform_error_code(out != NULL);
+}
+
+Platform_Error platform_file_unmap(void* address, isize size)
+{
+    bool state = true;
+    if(address)
+        state = munmap(address, (size_t) size) == 0;
+    return _platform_error_code(state);
+}
+
 Platform_Error platform_file_create(Platform_String file_path, bool fail_if_exists)
 {   
     int flags = O_WRONLY | O_CREAT | O_LARGEFILE;
@@ -1439,6 +1472,8 @@ int64_t platform_capture_call_stack(void** stack, int64_t stack_size, int64_t sk
     int64_t not_skipped_size = found_size - skip_count;
     if(not_skipped_size < 0)
         not_skipped_size = 0;
+    if(not_skipped_size > stack_size)
+        not_skipped_size = stack_size > 0 ? stack_size : 0;
 
     memcpy(stack, stack_ptrs + skip_count, (size_t) not_skipped_size*sizeof(void*));
     return not_skipped_size;
@@ -1677,6 +1712,7 @@ bool platform_exception_sandbox(
 
         bool state = sigaction(sig_error->signal, &sig_error->action, &sig_error->prev_action) == 0;
         assert(state && "bad signal specifier!");
+        (void) state;
     }
 
     bool is_okay = false;
@@ -1722,6 +1758,7 @@ bool platform_exception_sandbox(
         Signal_Error* sig_error = &error_handlers[i];
         bool state = sigaction(sig_error->signal, &sig_error->prev_action, NULL) == 0;
         assert(state && "bad signal specifier");
+        (void) state;
     }
 
     return is_okay;
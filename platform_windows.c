@@ -231,8 +231,11 @@ Platform_Error platform_thread_launch(isize stack_size_or_zero, void (*func)(voi
         va_end(args);
 
         HANDLE handle = (HANDLE) _beginthreadex(NULL, (unsigned int) stack_size_or_zero, _thread_func, thread_context, 0, NULL);
-        if(handle) 
+        //Nothing ever waits on the thread so the handle is closed right away. The thread keeps running.
+        if(handle) {
+            CloseHandle(handle);
             return PLATFORM_ERROR_OK;
+        }
 
         free(thread_context->name);
     }
@@ -935,6 +938,42 @@ Platform_Error platform_file_size(const Platform_File* file, isize* size)
     return _platform_error_code(state);
 }
 
+Platform_Error platform_file_map(void** address, const Platform_File* file, isize offset, isize size, int map_flags)
+{
+    void* out = NULL;
+    if(file->handle) {
+        DWORD protect = PAGE_READONLY;
+        DWORD access = FILE_MAP_READ;
+        if(map_flags & PLATFORM_FILE_MAP_COPY_ON_WRITE) {
+            protect = PAGE_WRITECOPY;
+            access = FILE_MAP_COPY;
+        }
+        else if(map_flags & PLATFORM_FILE_MAP_WRITE) {
+            protect = PAGE_READWRITE;
+            access = FILE_MAP_READ | FILE_MAP_WRITE;
+        }
+
+        //The view keeps the mapping object alive so we can close it right away
+        HANDLE mapping = CreateFileMappingW(_platform_flip_handle(file->handle), NULL, protect, 0, 0, NULL);
+        if(mapping) {
+            out = MapViewOfFile(mapping, access, (DWORD) ((uint64_t) offset >> 32), (DWORD) offset, (SIZE_T) size);
+            CloseHandle(mapping);
+        }
+    }
+
+    *address = out;
+    return _platform_error_code(out != NULL);
+}
+
+Platform_Error platform_file_unmap(void* address, isize size)
+{
+    (void) size;
+    bool state = true;
+    if(address)
+        state = !!UnmapViewOfFile(address);
+    return _platform_error_code(state);
+}
+
 Platform_Error platform_file_read_entire(Platform_String file_path, void* buffer, isize plt_buffer_size)
 {
     Platform_File file = {0};
@@ -17,6 +17,7 @@
 #include "defines.h"
 #include "allocator.h"
 #include "profile.h"
+#include <string.h>
 
 #ifndef SCRATCH_ARENA_DEBUG
     #ifdef DO_ASSERTS_SLOW
@@ -78,8 +79,13 @@ EXTERNAL Scratch scratch_acquire(Scratch_Arena* arena);
 EXTERNAL void  scratch_release(Scratch* arena);
 EXTERNAL void* scratch_push_generic(Scratch* scratch, isize size, isize align, Allocator_Error* error);
 EXTERNAL void* scratch_push_nonzero_generic(Scratch* scratch, isize size, isize align, Allocator_Error* error);
-#define scratch_push(arena_ptr, count, Type)         ((Type*) scratch_push_generic((arena_ptr), (count) * sizeof(Type), __alignof(Type), NULL))
-#define scratch_push_nonzero(arena_ptr, count, Type) ((Type*) scratch_push_nonzero_generic((arena_ptr), (count) * sizeof(Type), __alignof(Type), NULL))
+EXTERNAL void* _scratch_push_slow(Scratch* scratch, isize size, isize align, Allocator_Error* error);
+
+//The typed push macros go through the inline fast path. For constant count the size and alignment are compile 
+// time constants so the alignment folds away for align 1 and is a single and/add otherwise.
+#define scratch_push(arena_ptr, count, Type)         ((Type*) scratch_push_inline((arena_ptr), (isize) ((count) * sizeof(Type)), (isize) __alignof(Type)))
+#define scratch_push_nonzero(arena_ptr, count, Type) ((Type*) scratch_push_nonzero_inline((arena_ptr), (isize) ((count) * sizeof(Type)), (isize) __alignof(Type), NULL))
+#define scratch_push_one(arena_ptr, Type)            scratch_push(arena_ptr, 1, Type)
 
 EXTERNAL void* scratch_allocator_func(void* self, int mode, isize new_size, void* old_ptr, isize old_size, isize align, void* rest);
 
@@ -90,6 +96,35 @@ EXTERNAL Scratch        global_scratch_acquire();
 #define SCRATCH_SCOPE_FROM(scratch, arena_ptr) \
     for(Scratch scratch = scratch_acquire(arena_ptr); scratch._ == 0; scratch_release(&scratch), scratch._ = 1)
 
+//Pushes size bytes aligned to align (power of two). Only bumps the pointer of the frame and does a single compare.
+// Everything else - pushing from a frame that is not the top of its stack (fall/rise), committing more memory,
+// running out of memory and all checks in SCRATCH_ARENA_DEBUG - is handled by the never inlined _scratch_push_slow.
+ATTRIBUTE_INLINE_ALWAYS static void* scratch_push_nonzero_inline(Scratch* scratch, isize size, isize align, Allocator_Error* error)
+{
+    if(SCRATCH_ARENA_DEBUG)
+        return _scratch_push_slow(scratch, size, align, error);
+
+    Scratch_Stack* stack = scratch->stack;
+    uintptr_t used_to = (uintptr_t) *scratch->frame_ptr;
+    uintptr_t out = (used_to + (uintptr_t) align - 1) & ~((uintptr_t) align - 1);
+
+    //Frames which are not at the top of the stack get limit 0 so that they always fail the compare.
+    uintptr_t limit = stack->curr_frame == scratch->frame_ptr ? (uintptr_t) stack->commit_to : 0;
+    if(out + (uintptr_t) size > limit)
+        return _scratch_push_slow(scratch, size, align, error);
+
+    *scratch->frame_ptr = (u8*) (out + (uintptr_t) size);
+    return (void*) out;
+}
+
+ATTRIBUTE_INLINE_ALWAYS static void* scratch_push_inline(Scratch* scratch, isize size, isize align)
+{
+    void* out = scratch_push_nonzero_inline(scratch, size, align, NULL);
+    if(out)
+        memset(out, 0, (size_t) size);
+    return out;
+}
+
 #endif
 
 // ===================================== REASONING =================================================
@@ -384,7 +419,7 @@ EXTERNAL Scratch        global_scratch_acquire();
         return out;
     }
 
-    EXTERNAL ATTRIBUTE_INLINE_ALWAYS void* scratch_push_nonzero_generic(Scratch* scratch, isize size, isize align, Allocator_Error* error)
+    EXTERNAL ATTRIBUTE_INLINE_NEVER void* _scratch_push_slow(Scratch* scratch, isize size, isize align, Allocator_Error* error)
     {
         PROFILE_START();
         REQUIRE(scratch->arena && scratch->stack && 0 <= scratch->level && scratch->level <= scratch->arena->frame_count, 
@@ -405,11 +440,17 @@ EXTERNAL Scratch        global_scratch_acquire();
         return out;
     }
 
-    EXTERNAL ATTRIBUTE_INLINE_ALWAYS void* scratch_push_generic(Scratch* scratch, isize size, isize align, Allocator_Error* error)
+    EXTERNAL void* scratch_push_nonzero_generic(Scratch* scratch, isize size, isize align, Allocator_Error* error)
+    {
+        return scratch_push_nonzero_inline(scratch, size, align, error);
+    }
+
+    EXTERNAL void* scratch_push_generic(Scratch* scratch, isize size, isize align, Allocator_Error* error)
     {
-        void* frame_ptr = scratch_push_nonzero_generic(scratch, size, align, error);
-        memset(frame_ptr, 0, (size_t) size);
-        return frame_ptr;
+        void* out = scratch_push_nonzero_inline(scratch, size, align, error);
+        if(out)
+            memset(out, 0, (size_t) size);
+        return out;
     }
 
     EXTERNAL ATTRIBUTE_INLINE_ALWAYS Scratch scratch_acquire(Scratch_Arena* arena)
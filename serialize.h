@@ -5,6 +5,7 @@
 #include <stdbool.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stddef.h>
 
 //TLDR This is a "simple" serialization system roughly equivalent to json in binary.
 //based on https://rxi.github.io/a_simple_serialization_system.html.
@@ -139,6 +140,11 @@ typedef enum Ser_Type {
     SER_COMPOUND_TYPES_COUNT = 4,
 } Ser_Type;
 
+//Receives the size bytes written since the last flush. Called instead of growing the buffer by writers 
+// initialized with ser_writer_init_flushing. Every ser_* function reserves its whole item before writing
+// so the flushed bytes always contain whole items and are never split in the middle of one.
+typedef void (*Ser_Flush_Func)(void* context, const uint8_t* data, isize size);
+
 typedef struct Ser_Writer {
     Allocator* alloc;
     uint8_t* data;
@@ -146,10 +152,17 @@ typedef struct Ser_Writer {
     isize capacity;
     isize depth;
     bool has_user_buffer;
+    Ser_Flush_Func flush;
+    void* flush_context;
 } Ser_Writer;
 
 
 EXTERNAL void ser_writer_init(Ser_Writer* w, void* buffer_or_null, isize size, Allocator* alloc_or_null_if_malloc);
+//Initializes a writer which keeps at most chunk_size bytes (or the size of the biggest single item) in memory.
+// When the buffer fills up its contents are passed to flush and writing continues from the start of it.
+EXTERNAL void ser_writer_init_flushing(Ser_Writer* w, isize chunk_size, Ser_Flush_Func flush, void* context, Allocator* alloc_or_null_if_malloc);
+//Passes everything written so far to flush. Does nothing for regular writers.
+EXTERNAL void ser_writer_flush(Ser_Writer* w);
 EXTERNAL void ser_writer_deinit(Ser_Writer* w);
 static inline void ser_writer_write(Ser_Writer* w, const void* ptr, isize size);
 static inline void ser_writer_reserve(Ser_Writer* w, isize size);
@@ -162,8 +175,8 @@ static inline void ser_string(Ser_Writer* w, Ser_String string) { ser_string_sep
 static inline void ser_cstring(Ser_Writer* w, const char* ptr) { ser_string_separate(w, ptr, ptr ? strlen(ptr) : 0); }
 
 static inline void ser_primitive(Ser_Writer* w, Ser_Type type, const void* ptr, isize size);
-static inline void ser_null(Ser_Writer* w)              { ser_primitive(w, SER_I8, NULL, 0); }
-static inline void ser_bool(Ser_Writer* w, bool val)    { ser_primitive(w, SER_I8,  &val, sizeof val); }
+static inline void ser_null(Ser_Writer* w)              { ser_primitive(w, SER_NULL, NULL, 0); }
+static inline void ser_bool(Ser_Writer* w, bool val)    { ser_primitive(w, SER_BOOL, &val, sizeof val); }
 
 static inline void ser_i8(Ser_Writer* w, int8_t val)    { ser_primitive(w, SER_I8,  &val, sizeof val); }
 static inline void ser_i16(Ser_Writer* w, int16_t val)  { ser_primitive(w, SER_I16, &val, sizeof val); }
@@ -204,16 +217,26 @@ static inline void ser_writer_write(Ser_Writer* w, const void* ptr, isize size)
 static inline void ser_primitive(Ser_Writer* w, Ser_Type type, const void* ptr, isize size) {
     ser_writer_reserve(w, size+1);
     w->data[w->offset] = (uint8_t) type;
-    memcpy(&w->data[w->offset + 1], ptr, size);
+    if(size > 0) //size is a constant at every call site so this costs nothing
+        memcpy(&w->data[w->offset + 1], ptr, size);
     w->offset += size+1;
 }
 
 //reading 
+typedef struct Ser_Reader Ser_Reader;
+
+//Called when the reader runs out of data at the start of a value. Should point data and capacity to the next
+// chunk and set offset to 0. Returns false at the end of the stream. Values read from previous chunks
+// stay valid only as long as the caller keeps those chunks alive.
+typedef bool (*Ser_Refill_Func)(void* context, Ser_Reader* r);
+
 typedef struct Ser_Reader {
     const uint8_t* data;
     isize offset;
     isize capacity;
     isize depth;
+    Ser_Refill_Func refill;
+    void* refill_context;
 } Ser_Reader;
 
 typedef struct Ser_Value {
@@ -279,6 +302,81 @@ static inline bool ser_cstring_eq(Ser_Value value, const char* str) {
 
 EXTERNAL bool ser_write_json(Ser_Writer* w, Ser_Value val, isize indent_or_negative, isize max_recursion);
 EXTERNAL bool ser_write_json_read(Ser_Writer* w, Ser_Reader* r, isize indent_or_negative, isize max_recursion);
+
+//Schemas describe a struct as a list of fields with names, offsets and types so that it can be written and read
+// without any per field code. Reading a struct by hand compares every key against field names until it finds 
+// a match, which for many objects with many fields is where most of the time goes. Instead ser_schema_init finds
+// a seed for which the hashes of all field names fall into distinct slots of a small table, so each key is matched
+// with one hash, one lookup and one memcmp to verify it. Writing precomputes the size of all keys and fixed size 
+// values so the whole object is reserved once and written without further checks.
+// 
+// The written data is a regular object so it stays forward and backward compatible: unknown keys are skipped,
+// missing fields are left untouched and values are converted with the same rules as deser_i32 etc.
+// 
+// Example:
+//   typedef struct Particle {uint64_t id; float pos[3]; Ser_String name; bool alive;} Particle;
+//   Ser_Schema_Field particle_fields[] = {
+//       SER_SCHEMA_FIELD(Particle, id, SER_U64),
+//       SER_SCHEMA_FIELD_CUSTOM(Particle, pos, deser_f32v3, ser_f32v3),
+//       SER_SCHEMA_FIELD(Particle, name, SER_STRING),
+//       SER_SCHEMA_FIELD_NAMED(Particle, alive, "is_alive", SER_BOOL),
+//   };
+//   Ser_Schema particle_schema = {0};
+//   ser_schema_init(&particle_schema, particle_fields, 4, "Particle");
+//   ser_schema_write(w, &particle_schema, &particle);
+//   deser_schema(value, &particle_schema, &particle, NULL);
+#define SER_SCHEMA_MAX_FIELDS 64
+#define SER_SCHEMA_MAX_SLOTS 1024
+
+typedef bool (*Ser_Schema_Read_Func)(Ser_Value val, void* field);
+typedef void (*Ser_Schema_Write_Func)(Ser_Writer* w, const void* field);
+
+typedef struct Ser_Schema Ser_Schema;
+typedef struct Ser_Schema_Field {
+    const char* name;
+    isize offset;
+    isize size;
+    //SER_BOOL, SER_U8...SER_U64, SER_I8...SER_I64, SER_F32 or SER_F64 for fields of the matching C type,
+    // SER_STRING or SER_BINARY for Ser_String fields (which point into the read data), SER_OBJECT for nested 
+    // structs described by schema, SER_NULL for fields read and written by read and write.
+    Ser_Type type;
+    const Ser_Schema* schema;
+    Ser_Schema_Read_Func read;
+    Ser_Schema_Write_Func write;
+
+    //filled by ser_schema_init
+    isize name_len;
+    isize encoded_len;          //size of the key followed by the value type byte for fixed size values. 0 if it does not fit into encoded
+    uint8_t encoded[24];
+} Ser_Schema_Field;
+
+#define SER_SCHEMA_FIELD_NAMED(Struct, member, name, type)      {name, offsetof(Struct, member), sizeof(((Struct*) 0)->member), type}
+#define SER_SCHEMA_FIELD(Struct, member, type)                  SER_SCHEMA_FIELD_NAMED(Struct, member, #member, type)
+#define SER_SCHEMA_FIELD_OBJECT(Struct, member, schema)         {#member, offsetof(Struct, member), sizeof(((Struct*) 0)->member), SER_OBJECT, schema}
+#define SER_SCHEMA_FIELD_CUSTOM(Struct, member, read, write)    {#member, offsetof(Struct, member), sizeof(((Struct*) 0)->member), SER_NULL, NULL, read, write}
+
+typedef struct Ser_Schema {
+    Ser_Schema_Field* fields;
+    isize field_count;
+    const char* recovery_tag;   //if not NULL objects are written as recovery objects with this tag
+
+    //filled by ser_schema_init
+    isize fixed_size;           //bytes needed for all keys and fixed size values
+    isize recovery_len;
+    uint32_t recovery_hash;
+    uint32_t slot_mask;
+    uint64_t seed;
+    uint8_t slots[SER_SCHEMA_MAX_SLOTS]; //field index + 1 or 0 for empty slot
+} Ser_Schema;
+
+//Validates the fields and builds the key lookup. Returns false if there are more than SER_SCHEMA_MAX_FIELDS fields,
+// a name is empty, longer than 255 bytes or duplicate, or a field size does not match its type.
+// The fields must stay alive for as long as the schema is used.
+EXTERNAL bool ser_schema_init(Ser_Schema* schema, Ser_Schema_Field* fields, isize field_count, const char* recovery_tag_or_null);
+EXTERNAL void ser_schema_write(Ser_Writer* w, const Ser_Schema* schema, const void* object);
+//Reads the fields present in object into out and sets bit i of found_or_null for each field i that was read.
+// Returns false if object is not an object or some of its known fields could not be converted.
+EXTERNAL bool deser_schema(Ser_Value object, const Ser_Schema* schema, void* out, uint64_t* found_or_null);
 #endif
 
 #if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_SERIALIZE)) && !defined(MODULE_HAS_IMPL_SERIALIZE)
@@ -295,6 +393,22 @@ EXTERNAL void ser_writer_init(Ser_Writer* w, void* buffer_or_null, isize size, A
     }
 }
 
+EXTERNAL void ser_writer_init_flushing(Ser_Writer* w, isize chunk_size, Ser_Flush_Func flush, void* context, Allocator* alloc_or_null_if_malloc)
+{
+    ser_writer_init(w, NULL, 0, alloc_or_null_if_malloc);
+    ser_writer_grow(w, chunk_size);
+    w->flush = flush;
+    w->flush_context = context;
+}
+
+EXTERNAL void ser_writer_flush(Ser_Writer* w)
+{
+    if(w->flush && w->offset > 0) {
+        w->flush(w->flush_context, w->data, w->offset);
+        w->offset = 0;
+    }
+}
+
 EXTERNAL void ser_writer_deinit(Ser_Writer* w)
 {
     if(w->has_user_buffer == false) {
@@ -309,6 +423,14 @@ EXTERNAL void ser_writer_deinit(Ser_Writer* w)
 ATTRIBUTE_INLINE_NEVER 
 EXTERNAL void ser_writer_grow(Ser_Writer* w, isize size)
 {
+    //Flushing writers first make space by flushing and only grow for items bigger than the whole buffer
+    if(w->flush && w->offset > 0) {
+        size -= w->offset;
+        ser_writer_flush(w);
+        if(size <= w->capacity)
+            return;
+    }
+
     isize new_capacity = w->capacity*3/2 + 8;
     if(new_capacity < size)
         new_capacity = size;
@@ -332,8 +454,7 @@ EXTERNAL void ser_writer_grow(Ser_Writer* w, isize size)
 
 EXTERNAL void ser_string_separate(Ser_Writer* w, const void* ptr, isize size)
 {
-    if(w->offset + size+10 > w->capacity)
-        ser_writer_grow(w, size+10);
+    ser_writer_reserve(w, size+10);
 
     if(size <= 0)
         w->data[w->offset++] = (uint8_t) SER_STRING_0;
@@ -364,6 +485,7 @@ EXTERNAL void ser_binary(Ser_Writer* w, const void* ptr, isize size)
 EXTERNAL void ser_custom_recovery(Ser_Writer* w, Ser_Type type, const void* ptr, isize size, const void* ptr2, isize size2)
 {
     uint8_t usize = (uint8_t) (size + size2);
+    ser_writer_reserve(w, 2 + size + size2);
     ser_primitive(w, type, &usize, sizeof usize);
     ser_writer_write(w, ptr, size);
     ser_writer_write(w, ptr2, size2);
@@ -403,17 +525,29 @@ static bool deser_skip(Ser_Reader* r, isize size)
     return true;
 }
 
+ATTRIBUTE_INLINE_NEVER
+static void _deser_refill(Ser_Reader* r)
+{
+    //Skips empty chunks
+    while(r->offset >= r->capacity)
+        if(r->refill(r->refill_context, r) == false)
+            break;
+}
+
 EXTERNAL bool deser_value(Ser_Reader* r, Ser_Value* out_val)
 {
     Ser_Value out = {0};
     out.type = SER_ERROR;
     out.exact_type = SER_ERROR;
     out.r = r;
+    if(r->offset >= r->capacity && r->refill)
+        _deser_refill(r);
+
     isize offset_before = r->offset; 
 
     uint8_t uncast_type = 0; 
-    uint8_t ok = true;
-    if(deser_read(r, &uncast_type, sizeof uncast_type))
+    uint8_t ok = deser_read(r, &uncast_type, sizeof uncast_type);
+    if(ok)
     {
         Ser_Type type = (Ser_Type) uncast_type;
         out.exact_type = type;
@@ -453,7 +587,7 @@ EXTERNAL bool deser_value(Ser_Reader* r, Ser_Value* out_val)
                 out.mcompound.recovery_len = size;
                 out.mcompound.depth = (uint32_t) r->depth;
 
-                ok &= deser_skip(r, out.mstring.count);
+                ok &= deser_skip(r, size);
                 if(ok) {
                     if((uint32_t) type - SER_ARRAY_END < SER_COMPOUND_TYPES_COUNT) 
                         r->depth -= 1; 
@@ -520,6 +654,18 @@ inline static bool _ser_type_is_ender_or_error(Ser_Type type)
     return (uint32_t) type - SER_ARRAY_END <= SER_COMPOUND_TYPES_COUNT;
 }
 
+//The recovery begin types are not in the same order as their enders so we cannot just subtract SER_COMPOUND_TYPES_COUNT
+inline static Ser_Type _ser_ender_of(Ser_Type type)
+{
+    switch(type) {
+        case SER_ARRAY_BEGIN:           return SER_ARRAY_END;
+        case SER_OBJECT_BEGIN:          return SER_OBJECT_END;
+        case SER_RECOVERY_ARRAY_BEGIN:  return SER_RECOVERY_ARRAY_END;
+        case SER_RECOVERY_OBJECT_BEGIN: return SER_RECOVERY_OBJECT_END;
+        default:                        return SER_ERROR;
+    }
+}
+
 EXTERNAL bool deser_iterate_array(const Ser_Value* array, Ser_Value* out_val)
 {
     if(array->type != SER_ARRAY && array->type != SER_RECOVERY_ARRAY)
@@ -529,7 +675,7 @@ EXTERNAL bool deser_iterate_array(const Ser_Value* array, Ser_Value* out_val)
     deser_value(array->r, out_val);
     if(_ser_type_is_ender_or_error(out_val->type))
     {
-        if(array->type != out_val->type - SER_COMPOUND_TYPES_COUNT)
+        if(out_val->type != _ser_ender_of(array->type))
             _deser_recover(array);
         return false;
     }
@@ -547,7 +693,7 @@ EXTERNAL bool deser_iterate_object(const Ser_Value* object, Ser_Value* out_key,
     if(_ser_type_is_ender_or_error(out_key->type)) 
     {
         //if the ending type does not correspond to the object type
-        if(object->type != out_key->type - SER_COMPOUND_TYPES_COUNT)
+        if(out_key->type != _ser_ender_of(object->type))
             goto recover;
         return false;
     }
@@ -556,7 +702,7 @@ EXTERNAL bool deser_iterate_object(const Ser_Value* object, Ser_Value* out_key,
     // then this case will just full under error.
     deser_skip_to_depth(object->r, object->mcompound.depth + 1); 
     deser_value(object->r, out_val);
-    if(_ser_type_is_ender_or_error(out_key->type))
+    if(_ser_type_is_ender_or_error(out_val->type))
         goto recover;
 
     return true;
@@ -610,7 +756,8 @@ static isize _ser_find_first_or(Ser_String in_str, Ser_String search_for, isize
 ATTRIBUTE_INLINE_NEVER
 static bool _deser_recover(const Ser_Value*  object)
 {
-    if(object->type == SER_ARRAY || object->type == SER_OBJECT)
+    //Streamed readers might no longer have the chunk holding the tag
+    if(object->type == SER_ARRAY || object->type == SER_OBJECT || object->r->refill)
         return false;
 
     Ser_Reader* reader = object->r;
@@ -620,8 +767,8 @@ static bool _deser_recover(const Ser_Value*  object)
     {
         isize i = 0;
         recovery_text[i++] = object->type == SER_RECOVERY_ARRAY ? SER_RECOVERY_ARRAY_END : SER_RECOVERY_OBJECT_END;
-        recovery_text[i++] = (uint8_t) object->mstring.count;
-        memcpy(recovery_text + i, object->mstring.data, object->mstring.count); i += object->mstring.count + 2;
+        recovery_text[i++] = (uint8_t) object->mcompound.recovery_len;
+        memcpy(recovery_text + i, object->mcompound.recovery, object->mcompound.recovery_len); i += object->mcompound.recovery_len;
         recovery_len = i;
     }
 
@@ -875,4 +1022,289 @@ EXTERNAL bool ser_write_json_read(Ser_Writer* w, Ser_Reader* r, isize indent_or_
         return _ser_write_json(w, val, indent_or_negative, max_recursion, 0);
     return false;
 }
+
+static uint64_t _ser_schema_hash(const char* data, isize len, uint64_t seed)
+{
+    uint64_t hash = seed ^ ((uint64_t) len * 0x9E3779B97F4A7C15ULL);
+    isize i = 0;
+    for(; i + 8 <= len; i += 8) {
+        uint64_t word = 0; memcpy(&word, data + i, 8);
+        hash = (hash ^ word) * 0xBF58476D1CE4E5B9ULL;
+        hash ^= hash >> 31;
+    }
+
+    uint64_t tail = 0;
+    for(; i < len; i++)
+        tail = tail << 8 | (uint8_t) data[i];
+    
+    hash = (hash ^ tail) * 0x94D049BB133111EBULL;
+    return hash ^ (hash >> 29);
+}
+
+static isize _ser_schema_type_size(Ser_Type type)
+{
+    switch(type) {
+        case SER_BOOL: return sizeof(bool);
+        case SER_U8: case SER_I8: return 1;
+        case SER_U16: case SER_I16: return 2;
+        case SER_U32: case SER_I32: case SER_F32: return 4;
+        case SER_U64: case SER_I64: case SER_F64: return 8;
+        case SER_STRING: case SER_BINARY: return sizeof(Ser_String);
+        default: return -1;
+    }
+}
+
+EXTERNAL bool ser_schema_init(Ser_Schema* schema, Ser_Schema_Field* fields, isize field_count, const char* recovery_tag_or_null)
+{
+    memset(schema, 0, sizeof *schema);
+    schema->fields = fields;
+    schema->field_count = field_count;
+    schema->recovery_tag = recovery_tag_or_null;
+    if(field_count > SER_SCHEMA_MAX_FIELDS)
+        return false;
+
+    //Same as ser_custom_recovery_with_hash
+    if(recovery_tag_or_null) {
+        uint32_t hash = 2166136261UL;
+        const uint8_t* data = (const uint8_t*) recovery_tag_or_null;
+        isize len = 0;
+        for(; len < 254 && data[len] != 0; len++) {
+            hash ^= data[len];
+            hash *= 16777619;
+        }
+        schema->recovery_len = len;
+        schema->recovery_hash = hash;
+    }
+
+    for(isize i = 0; i < field_count; i++)
+    {
+        Ser_Schema_Field* field = &fields[i];
+        field->name_len = field->name ? (isize) strlen(field->name) : 0;
+        if(field->name_len <= 0 || field->name_len > 255)
+            return false;
+
+        for(isize j = 0; j < i; j++)
+            if(fields[j].name_len == field->name_len && memcmp(fields[j].name, field->name, field->name_len) == 0)
+                return false;
+
+        bool is_fixed = false;
+        if(field->read || field->write) {
+            if(field->read == NULL || field->write == NULL)
+                return false;
+        }
+        else if(field->type == SER_OBJECT) {
+            if(field->schema == NULL)
+                return false;
+        }
+        else {
+            if(_ser_schema_type_size(field->type) != field->size)
+                return false;
+            is_fixed = field->type != SER_STRING && field->type != SER_BINARY;
+        }
+
+        //{u8 type, u8 size}[size bytes]\0 followed by {u8 type}[value] if the value is of fixed size
+        isize key_size = field->name_len + 3;
+        schema->fixed_size += key_size + (is_fixed ? 1 + field->size : 0);
+
+        memset(field->encoded, 0, sizeof field->encoded);
+        field->encoded_len = 0;
+        if(key_size + is_fixed <= (isize) sizeof field->encoded) {
+            field->encoded[0] = (uint8_t) SER_STRING_8;
+            field->encoded[1] = (uint8_t) field->name_len;
+            memcpy(field->encoded + 2, field->name, field->name_len);
+            if(is_fixed)
+                field->encoded[key_size] = (uint8_t) field->type;
+            field->encoded_len = key_size + is_fixed;
+        }
+    }
+
+    //Find the perfect hash. Start with a table at least twice as big as the number of fields and try a number  
+    // of seeds. If none works double the table. With 64 fields in 1024 slots about every 7th seed works.
+    for(isize slot_count = 4; slot_count <= SER_SCHEMA_MAX_SLOTS; slot_count *= 2)
+    {
+        if(slot_count < field_count*2)
+            continue;
+
+        for(uint64_t attempt = 0; attempt < 1024; attempt++)
+        {
+            uint64_t seed = (attempt + 1) * 0x9E3779B97F4A7C15ULL;
+            bool collided = false;
+            memset(schema->slots, 0, sizeof schema->slots);
+            for(isize i = 0; i < field_count && collided == false; i++)
+            {
+                uint64_t slot = _ser_schema_hash(fields[i].name, fields[i].name_len, seed) & (uint64_t) (slot_count - 1);
+                collided = schema->slots[slot] != 0;
+                schema->slots[slot] = (uint8_t) (i + 1);
+            }
+
+            if(collided == false) {
+                schema->seed = seed;
+                schema->slot_mask = (uint32_t) (slot_count - 1);
+                return true;
+            }
+        }
+    }
+
+    memset(schema->slots, 0, sizeof schema->slots);
+    return false;
+}
+
+static bool _ser_schema_is_fixed(const Ser_Schema_Field* field)
+{
+    return field->read == NULL && field->type != SER_STRING && field->type != SER_BINARY && field->type != SER_OBJECT;
+}
+
+EXTERNAL void ser_schema_write(Ser_Writer* w, const Ser_Schema* schema, const void* object)
+{
+    if(schema->recovery_tag)
+        ser_custom_recovery(w, SER_RECOVERY_OBJECT_BEGIN, schema->recovery_tag, schema->recovery_len + 1, &schema->recovery_hash, sizeof schema->recovery_hash);
+    else
+        ser_object_begin(w);
+
+    //All keys and fixed size values are covered by a single reserve which only needs repeating after variable sized values.
+    // Encoded keys are always copied whole so there must be space for the unused part of the last one.
+    isize reserve = schema->fixed_size + (isize) sizeof schema->fields[0].encoded;
+    ser_writer_reserve(w, reserve);
+    for(isize i = 0; i < schema->field_count; i++)
+    {
+        const Ser_Schema_Field* field = &schema->fields[i];
+        const uint8_t* ptr = (const uint8_t*) object + field->offset;
+        uint8_t* key = w->data + w->offset;
+        if(field->encoded_len > 0) {
+            memcpy(key, field->encoded, sizeof field->encoded);
+            w->offset += field->encoded_len;
+        }
+        else {
+            key[0] = (uint8_t) SER_STRING_8;
+            key[1] = (uint8_t) field->name_len;
+            memcpy(key + 2, field->name, field->name_len);
+            key[2 + field->name_len] = 0;
+            w->offset += field->name_len + 3;
+            if(_ser_schema_is_fixed(field))
+                w->data[w->offset++] = (uint8_t) field->type;
+        }
+
+        uint8_t* value = w->data + w->offset;
+        if(field->write) {
+            field->write(w, ptr);
+            ser_writer_reserve(w, reserve);
+        }
+        else switch(field->type) {
+            case SER_STRING: ser_string(w, *(const Ser_String*) ptr); ser_writer_reserve(w, reserve); break;
+            case SER_BINARY: ser_binary(w, ((const Ser_String*) ptr)->data, ((const Ser_String*) ptr)->count); ser_writer_reserve(w, reserve); break;
+            case SER_OBJECT: ser_schema_write(w, field->schema, ptr); ser_writer_reserve(w, reserve); break;
+
+            //Constant sizes so that the copies get inlined
+            case SER_BOOL: case SER_U8: case SER_I8:    memcpy(value, ptr, 1); w->offset += 1; break;
+            case SER_U16: case SER_I16:                 memcpy(value, ptr, 2); w->offset += 2; break;
+            case SER_U32: case SER_I32: case SER_F32:   memcpy(value, ptr, 4); w->offset += 4; break;
+            case SER_U64: case SER_I64: case SER_F64:   memcpy(value, ptr, 8); w->offset += 8; break;
+            default: break;
+        }
+    }
+
+    if(schema->recovery_tag)
+        ser_custom_recovery(w, SER_RECOVERY_OBJECT_END, schema->recovery_tag, schema->recovery_len + 1, &schema->recovery_hash, sizeof schema->recovery_hash);
+    else
+        ser_object_end(w);
+}
+
+static const Ser_Schema_Field* _ser_schema_find(const Ser_Schema* schema, const char* name, isize name_len)
+{
+    uint64_t hash = _ser_schema_hash(name, name_len, schema->seed);
+    uint8_t slot = schema->slots[hash & schema->slot_mask];
+    if(slot == 0)
+        return NULL;
+
+    //Names are short so a simple loop is a lot faster than calling memcmp
+    const Ser_Schema_Field* field = &schema->fields[slot - 1];
+    if(field->name_len != name_len)
+        return NULL;
+    for(isize i = 0; i < name_len; i++)
+        if(field->name[i] != name[i])
+            return NULL;
+
+    return field;
+}
+
+static bool _deser_schema_field(const Ser_Schema_Field* field, Ser_Value val, void* ptr)
+{
+    if(field->read)
+        return field->read(val, ptr);
+
+    switch(field->type) {
+        case SER_BOOL:   return deser_bool(val, (bool*) ptr);
+        case SER_U8:     return deser_u8(val, (uint8_t*) ptr);
+        case SER_U16:    return deser_u16(val, (uint16_t*) ptr);
+        case SER_U32:    return deser_u32(val, (uint32_t*) ptr);
+        case SER_U64:    return deser_u64(val, (uint64_t*) ptr);
+        case SER_I8:     return deser_i8(val, (int8_t*) ptr);
+        case SER_I16:    return deser_i16(val, (int16_t*) ptr);
+        case SER_I32:    return deser_i32(val, (int32_t*) ptr);
+        case SER_I64:    return deser_i64(val, (int64_t*) ptr);
+        case SER_F32:    return deser_f32(val, (float*) ptr);
+        case SER_F64:    return deser_f64(val, (double*) ptr);
+        case SER_STRING: return deser_string(val, (Ser_String*) ptr);
+        case SER_BINARY: return deser_binary(val, (Ser_String*) ptr);
+        case SER_OBJECT: return deser_schema(val, field->schema, ptr, NULL);
+        default:         return false;
+    }
+}
+
+EXTERNAL bool deser_schema(Ser_Value object, const Ser_Schema* schema, void* out, uint64_t* found_or_null)
+{
+    if(object.type != SER_OBJECT && object.type != SER_RECOVERY_OBJECT)
+        return false;
+
+    Ser_Reader* r = object.r;
+    isize depth = (isize) object.mcompound.depth + 1;
+    bool ok = true;
+    uint64_t found = 0;
+    for(;;)
+    {
+        //Fast path: a short string key directly followed by a value of exactly the field type, all inside the current buffer.
+        // The value is simply copied. Everything else, including the end of the object, goes through deser_iterate_object.
+        const uint8_t* data = r->data + r->offset;
+        isize remaining = r->capacity - r->offset;
+        if(r->depth == depth && remaining >= 4)
+        {
+            if(data[0] == SER_STRING_8) 
+            {
+                isize len = data[1];
+                if(len + 4 <= remaining && data[len + 2] == 0) 
+                {
+                    const Ser_Schema_Field* field = _ser_schema_find(schema, (const char*) data + 2, len);
+                    if(field && data[len + 3] == field->type && _ser_schema_is_fixed(field) && len + 4 + field->size <= remaining) 
+                    {
+                        memcpy((uint8_t*) out + field->offset, data + len + 4, field->size);
+                        r->offset += len + 4 + field->size;
+                        found |= (uint64_t) 1 << (field - schema->fields);
+                        continue;
+                    }
+                }
+            }
+            else if(data[0] == SER_OBJECT_END && object.type == SER_OBJECT) {
+                r->offset += 1;
+                r->depth -= 1;
+                break;
+            }
+        }
+
+        Ser_Value key = {0}, val = {0};
+        if(deser_iterate_object(&object, &key, &val) == false)
+            break;
+
+        const Ser_Schema_Field* field = key.type == SER_STRING ? _ser_schema_find(schema, key.mstring.data, key.mstring.count) : NULL;
+        if(field) {
+            if(_deser_schema_field(field, val, (uint8_t*) out + field->offset))
+                found |= (uint64_t) 1 << (field - schema->fields);
+            else
+                ok = false;
+        }
+    }
+
+    if(found_or_null)
+        *found_or_null = found;
+    return ok;
+}
 #endif
\ No newline at end of file
@@ -0,0 +1,420 @@
+#ifndef MODULE_SERIALIZE_STREAM
+#define MODULE_SERIALIZE_STREAM
+
+//Streaming of serialize.h documents of any size through fixed size chunks with optional slz4 compression.
+//
+//Ser_Stream_Writer wraps a flushing Ser_Writer (see ser_writer_init_flushing). Whenever its chunk_size buffer fills up,
+// the chunk is compressed and appended to a file or pushed into a Channel, and writing continues from the start of the buffer.
+// Ser_Stream_Reader wraps a Ser_Reader with a refill function which reads and decompresses the next chunk once the
+// current one is used up. Both sides use the regular ser_* / deser_* functions and keep only a few chunks in memory
+// regardless of the size of the document.
+//
+//The stream format is a header {u32 magic, u32 version} followed by frames {u64 raw_size, u64 stored_size}[stored_size bytes].
+// When stored_size == raw_size the frame is stored uncompressed, otherwise it is a single slz4 block. The stream ends with
+// a frame of raw_size == 0 so a truncated stream is detected. Over a Channel each frame is a separate Ser_Stream_Message.
+//
+//Items are never split between chunks (see Ser_Flush_Func) so a single item bigger than chunk_size gets a chunk of its own.
+// Strings and binaries returned by the reader point into the chunk they were read from. The reader keeps the previous
+// chunk alive so a value stays valid while reading the next one (key and value of an object), but anything kept for longer
+// needs to be copied. Recovery (see serialize.h) is not done for streamed documents.
+
+#include "defines.h"
+#include "assert.h"
+#include "profile.h"
+#include "allocator.h"
+#include "platform.h"
+#include "channel.h"
+#include "slz4.h"
+#include "serialize.h"
+
+#ifndef SER_STREAM_DEFAULT_CHUNK
+    #define SER_STREAM_DEFAULT_CHUNK (256*1024)
+#endif
+#define SER_STREAM_MAGIC    0x4D525453 //"STRM" in little endian
+#define SER_STREAM_VERSION  1
+
+typedef enum Ser_Stream_Error {
+    SER_STREAM_OK = 0,
+    SER_STREAM_ERROR_IO,            //the file could not be opened/read/written. See platform_error for details
+    SER_STREAM_ERROR_CLOSED,        //the channel was closed before the end of the stream
+    SER_STREAM_ERROR_CORRUPTED,     //invalid header or frame, or a frame failed to decompress
+    SER_STREAM_ERROR_TRUNCATED,     //the stream ended without the end frame
+} Ser_Stream_Error;
+
+typedef struct Ser_Stream_Options {
+    Allocator* allocator_or_null;   //used for all buffers and messages. If NULL uses the default allocator.
+    isize chunk_size;               //0 means SER_STREAM_DEFAULT_CHUNK
+    bool compress;                  //compresses each chunk with slz4. Chunks which do not get smaller are stored raw.
+} Ser_Stream_Options;
+
+//Item of the Channel used by channel writers and readers. data is allocated by the writer with alloc
+// and deallocated by the reader. The last message of a stream has size 0.
+typedef struct Ser_Stream_Message {
+    uint8_t* data;                  //{u64 raw_size, u64 stored_size}[stored_size bytes]
+    isize size;
+    Allocator* alloc;
+} Ser_Stream_Message;
+
+#define SER_STREAM_CHANNEL_INFO SINIT(Channel_Info){sizeof(Ser_Stream_Message), chan_wait_block, chan_wake_block}
+
+typedef struct Ser_Stream_Writer {
+    Ser_Writer w;                   //write into this using the regular ser_* functions
+    Allocator* alloc;
+    bool compress;
+    bool _[7];
+    Platform_File file;             //if writing into a file
+    isize file_offset;
+    Channel* channel;               //if writing into a channel
+    uint8_t* staging;               //frame header followed by compressed chunk
+    isize staging_capacity;
+
+    Ser_Stream_Error error;         //first error. Once set no more data is written
+    Platform_Error platform_error;
+    isize raw_bytes;                //stats
+    isize stored_bytes;
+    isize chunk_count;
+} Ser_Stream_Writer;
+
+typedef struct Ser_Stream_Reader {
+    Ser_Reader r;                   //read from this using the regular deser_* functions
+    Allocator* alloc;
+    Platform_File file;             //if reading from a file
+    isize file_offset;
+    isize file_size;
+    Channel* channel;               //if reading from a channel
+    uint8_t* buffers[2];            //decompressed chunks. The current and the previous one.
+    isize capacities[2];
+    isize current;
+    uint8_t* staging;               //compressed chunk read from the file
+    isize staging_capacity;
+
+    Ser_Stream_Error error;         //first error. Once set the reader behaves as if at the end of the document
+    Platform_Error platform_error;
+    bool ended;                     //received the end frame
+    bool _[7];
+} Ser_Stream_Reader;
+
+EXTERNAL Ser_Stream_Error ser_stream_writer_init_file(Ser_Stream_Writer* s, Platform_String path, const Ser_Stream_Options* options_or_null);
+EXTERNAL void ser_stream_writer_init_channel(Ser_Stream_Writer* s, Channel* channel, const Ser_Stream_Options* options_or_null);
+//Flushes the last chunk, writes the end frame and frees everything. Returns the first error that occured while writing.
+EXTERNAL Ser_Stream_Error ser_stream_writer_deinit(Ser_Stream_Writer* s);
+
+EXTERNAL Ser_Stream_Error ser_stream_reader_init_file(Ser_Stream_Reader* s, Platform_String path, Allocator* alloc_or_null);
+EXTERNAL void ser_stream_reader_init_channel(Ser_Stream_Reader* s, Channel* channel, Allocator* alloc_or_null);
+//Frees everything. Returns the first error that occured while reading.
+EXTERNAL Ser_Stream_Error ser_stream_reader_deinit(Ser_Stream_Reader* s);
+
+EXTERNAL const char* ser_stream_error_to_string(Ser_Stream_Error error);
+#endif
+
+#if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_SERIALIZE_STREAM)) && !defined(MODULE_HAS_IMPL_SERIALIZE_STREAM)
+#define MODULE_HAS_IMPL_SERIALIZE_STREAM
+
+typedef struct _Ser_Stream_Header {
+    uint32_t magic;
+    uint32_t version;
+} _Ser_Stream_Header;
+
+typedef struct _Ser_Stream_Frame {
+    uint64_t raw_size;
+    uint64_t stored_size;
+} _Ser_Stream_Frame;
+
+INTERNAL void _ser_stream_writer_fail(Ser_Stream_Writer* s, Ser_Stream_Error error, Platform_Error platform_error)
+{
+    if(s->error == SER_STREAM_OK) {
+        s->error = error;
+        s->platform_error = platform_error;
+    }
+}
+
+INTERNAL void _ser_stream_writer_write(Ser_Stream_Writer* s, const void* data, isize size)
+{
+    if(s->error == SER_STREAM_OK) {
+        Platform_Error error = platform_file_write(&s->file, data, size, s->file_offset);
+        if(error)
+            _ser_stream_writer_fail(s, SER_STREAM_ERROR_IO, error);
+        s->file_offset += size;
+    }
+}
+
+//Compresses the chunk into staging right after the frame header. Returns the stored size which is equal
+// to size if the chunk is stored raw, in which case the data is not copied.
+INTERNAL isize _ser_stream_writer_encode(Ser_Stream_Writer* s, const uint8_t* data, isize size)
+{
+    isize stored = size;
+    if(s->compress && size <= SLZ4_MAX_SIZE)
+    {
+        isize needed = (isize) sizeof(_Ser_Stream_Frame) + slz4_compressed_size_upper_bound((int) size);
+        if(s->staging_capacity < needed) {
+            s->staging = (uint8_t*) allocator_reallocate(s->alloc, needed, s->staging, s->staging_capacity, 8);
+            s->staging_capacity = needed;
+        }
+
+        int compressed = slz4_compress(s->staging + sizeof(_Ser_Stream_Frame), (int) (needed - sizeof(_Ser_Stream_Frame)), data, (int) size, NULL);
+        if(compressed > 0 && compressed < size)
+            stored = compressed;
+    }
+
+    return stored;
+}
+
+INTERNAL void _ser_stream_writer_flush(void* context, const uint8_t* data, isize size)
+{
+    PROFILE_START();
+    Ser_Stream_Writer* s = (Ser_Stream_Writer*) context;
+    if(s->error == SER_STREAM_OK)
+    {
+        isize stored = _ser_stream_writer_encode(s, data, size);
+        _Ser_Stream_Frame frame = {(uint64_t) size, (uint64_t) stored};
+        const uint8_t* stored_data = stored != size ? s->staging + sizeof frame : data;
+        if(s->channel)
+        {
+            Ser_Stream_Message message = {0};
+            message.size = (isize) sizeof frame + stored;
+            message.alloc = s->alloc;
+            message.data = (uint8_t*) allocator_allocate(s->alloc, message.size, 8);
+            memcpy(message.data, &frame, sizeof frame);
+            memcpy(message.data + sizeof frame, stored_data, stored);
+            if(channel_push(s->channel, &message, SER_STREAM_CHANNEL_INFO) == false) {
+                allocator_deallocate(s->alloc, message.data, message.size, 8);
+                _ser_stream_writer_fail(s, SER_STREAM_ERROR_CLOSED, 0);
+            }
+        }
+        else if(stored != size)
+        {
+            memcpy(s->staging, &frame, sizeof frame);
+            _ser_stream_writer_write(s, s->staging, (isize) sizeof frame + stored);
+        }
+        else
+        {
+            _ser_stream_writer_write(s, &frame, sizeof frame);
+            _ser_stream_writer_write(s, data, size);
+        }
+
+        s->raw_bytes += size;
+        s->stored_bytes += (isize) sizeof frame + stored;
+        s->chunk_count += 1;
+    }
+    PROFILE_STOP();
+}
+
+INTERNAL void _ser_stream_writer_init(Ser_Stream_Writer* s, const Ser_Stream_Options* options_or_null)
+{
+    Ser_Stream_Options options = {0};
+    if(options_or_null)
+        options = *options_or_null;
+
+    memset(s, 0, sizeof *s);
+    s->alloc = options.allocator_or_null ? options.allocator_or_null : allocator_get_default();
+    s->compress = options.compress;
+    ser_writer_init_flushing(&s->w, options.chunk_size > 0 ? options.chunk_size : SER_STREAM_DEFAULT_CHUNK, _ser_stream_writer_flush, s, s->alloc);
+}
+
+EXTERNAL Ser_Stream_Error ser_stream_writer_init_file(Ser_Stream_Writer* s, Platform_String path, const Ser_Stream_Options* options_or_null)
+{
+    _ser_stream_writer_init(s, options_or_null);
+    Platform_Error error = platform_file_open(&s->file, path, PLATFORM_FILE_OPEN_WRITE | PLATFORM_FILE_OPEN_CREATE | PLATFORM_FILE_OPEN_REMOVE_CONTENT);
+    if(error)
+        _ser_stream_writer_fail(s, SER_STREAM_ERROR_IO, error);
+
+    _Ser_Stream_Header header = {SER_STREAM_MAGIC, SER_STREAM_VERSION};
+    _ser_stream_writer_write(s, &header, sizeof header);
+    return s->error;
+}
+
+EXTERNAL void ser_stream_writer_init_channel(Ser_Stream_Writer* s, Channel* channel, const Ser_Stream_Options* options_or_null)
+{
+    _ser_stream_writer_init(s, options_or_null);
+    s->channel = channel;
+}
+
+EXTERNAL Ser_Stream_Error ser_stream_writer_deinit(Ser_Stream_Writer* s)
+{
+    ser_writer_flush(&s->w);
+    if(s->error == SER_STREAM_OK)
+    {
+        _Ser_Stream_Frame end = {0};
+        if(s->channel) {
+            Ser_Stream_Message message = {0};
+            message.alloc = s->alloc;
+            if(channel_push(s->channel, &message, SER_STREAM_CHANNEL_INFO) == false)
+                _ser_stream_writer_fail(s, SER_STREAM_ERROR_CLOSED, 0);
+        }
+        else
+            _ser_stream_writer_write(s, &end, sizeof end);
+    }
+
+    Ser_Stream_Error error = s->error;
+    ser_writer_deinit(&s->w);
+    platform_file_close(&s->file);
+    allocator_deallocate(s->alloc, s->staging, s->staging_capacity, 8);
+    memset(s, 0, sizeof *s);
+    return error;
+}
+
+INTERNAL void _ser_stream_reader_fail(Ser_Stream_Reader* s, Ser_Stream_Error error, Platform_Error platform_error)
+{
+    if(s->error == SER_STREAM_OK) {
+        s->error = error;
+        s->platform_error = platform_error;
+    }
+}
+
+INTERNAL bool _ser_stream_reader_read(Ser_Stream_Reader* s, void* data, isize size)
+{
+    isize read = 0;
+    Platform_Error error = platform_file_read(&s->file, data, size, s->file_offset, &read);
+    if(read != size && s->file_offset + read >= s->file_size)
+        _ser_stream_reader_fail(s, SER_STREAM_ERROR_TRUNCATED, 0);
+    else if(error)
+        _ser_stream_reader_fail(s, SER_STREAM_ERROR_IO, error);
+    s->file_offset += size;
+    return s->error == SER_STREAM_OK;
+}
+
+INTERNAL uint8_t* _ser_stream_reserve(Allocator* alloc, uint8_t** buffer, isize* capacity, isize size)
+{
+    if(*capacity < size) {
+        isize new_capacity = MAX(size, *capacity*3/2);
+        *buffer = (uint8_t*) allocator_reallocate(alloc, new_capacity, *buffer, *capacity, 8);
+        *capacity = new_capacity;
+    }
+    return *buffer;
+}
+
+INTERNAL bool _ser_stream_reader_refill(void* context, Ser_Reader* r)
+{
+    PROFILE_START();
+    Ser_Stream_Reader* s = (Ser_Stream_Reader*) context;
+    bool state = false;
+    if(s->error == SER_STREAM_OK && s->ended == false)
+    {
+        //Obtain the frame and its stored data.
+        _Ser_Stream_Frame frame = {0};
+        const uint8_t* stored = NULL;
+        Ser_Stream_Message message = {0};
+        if(s->channel)
+        {
+            if(channel_pop(s->channel, &message, SER_STREAM_CHANNEL_INFO) == false)
+                _ser_stream_reader_fail(s, SER_STREAM_ERROR_CLOSED, 0);
+            else if(message.size == 0)
+                s->ended = true;
+            else if(message.size < (isize) sizeof frame)
+                _ser_stream_reader_fail(s, SER_STREAM_ERROR_CORRUPTED, 0);
+            else {
+                memcpy(&frame, message.data, sizeof frame);
+                stored = message.data + sizeof frame;
+                if(frame.stored_size != (uint64_t) message.size - sizeof frame)
+                    _ser_stream_reader_fail(s, SER_STREAM_ERROR_CORRUPTED, 0);
+            }
+        }
+        else if(_ser_stream_reader_read(s, &frame, sizeof frame))
+        {
+            if(frame.raw_size == 0)
+                s->ended = true;
+            else if(frame.stored_size > (uint64_t) (s->file_size - s->file_offset))
+                _ser_stream_reader_fail(s, SER_STREAM_ERROR_TRUNCATED, 0);
+            else if(frame.stored_size > frame.raw_size)
+                _ser_stream_reader_fail(s, SER_STREAM_ERROR_CORRUPTED, 0);
+            else if(frame.stored_size != frame.raw_size) {
+                stored = _ser_stream_reserve(s->alloc, &s->staging, &s->staging_capacity, (isize) frame.stored_size);
+                _ser_stream_reader_read(s, s->staging, (isize) frame.stored_size);
+            }
+        }
+
+        //Place it into the buffer which does not hold the previous chunk.
+        // slz4 cannot expand data more than 255 times so a bigger raw_size is surely corrupted.
+        if(s->error == SER_STREAM_OK && s->ended == false)
+        {
+            if(frame.stored_size > frame.raw_size || frame.raw_size == 0 || frame.raw_size/256 > frame.stored_size)
+                _ser_stream_reader_fail(s, SER_STREAM_ERROR_CORRUPTED, 0);
+            else
+            {
+                isize next = 1 - s->current;
+                isize raw_size = (isize) frame.raw_size;
+                uint8_t* into = _ser_stream_reserve(s->alloc, &s->buffers[next], &s->capacities[next], raw_size);
+                if(frame.stored_size == frame.raw_size) {
+                    if(stored)
+                        memcpy(into, stored, raw_size);
+                    else
+                        _ser_stream_reader_read(s, into, raw_size);
+                }
+                else if(raw_size > SLZ4_MAX_SIZE
+                    || slz4_decompress(into, (int) raw_size, stored, (int) frame.stored_size, NULL) != raw_size)
+                    _ser_stream_reader_fail(s, SER_STREAM_ERROR_CORRUPTED, 0);
+
+                if(s->error == SER_STREAM_OK) {
+                    s->current = next;
+                    r->data = into;
+                    r->offset = 0;
+                    r->capacity = raw_size;
+                    state = true;
+                }
+            }
+        }
+
+        if(message.data)
+            allocator_deallocate(message.alloc, message.data, message.size, 8);
+    }
+    PROFILE_STOP();
+    return state;
+}
+
+INTERNAL void _ser_stream_reader_init(Ser_Stream_Reader* s, Allocator* alloc_or_null)
+{
+    memset(s, 0, sizeof *s);
+    s->alloc = alloc_or_null ? alloc_or_null : allocator_get_default();
+    s->r.refill = _ser_stream_reader_refill;
+    s->r.refill_context = s;
+}
+
+EXTERNAL Ser_Stream_Error ser_stream_reader_init_file(Ser_Stream_Reader* s, Platform_String path, Allocator* alloc_or_null)
+{
+    _ser_stream_reader_init(s, alloc_or_null);
+    Platform_Error error = platform_file_open(&s->file, path, PLATFORM_FILE_OPEN_READ | PLATFORM_FILE_OPEN_HINT_FRONT_TO_BACK_ACCESS);
+    if(error == 0)
+        error = platform_file_size(&s->file, &s->file_size);
+    if(error)
+        _ser_stream_reader_fail(s, SER_STREAM_ERROR_IO, error);
+    else {
+        _Ser_Stream_Header header = {0};
+        if(_ser_stream_reader_read(s, &header, sizeof header))
+            if(header.magic != SER_STREAM_MAGIC || header.version != SER_STREAM_VERSION)
+                _ser_stream_reader_fail(s, SER_STREAM_ERROR_CORRUPTED, 0);
+    }
+    return s->error;
+}
+
+EXTERNAL void ser_stream_reader_init_channel(Ser_Stream_Reader* s, Channel* channel, Allocator* alloc_or_null)
+{
+    _ser_stream_reader_init(s, alloc_or_null);
+    s->channel = channel;
+}
+
+EXTERNAL Ser_Stream_Error ser_stream_reader_deinit(Ser_Stream_Reader* s)
+{
+    Ser_Stream_Error error = s->error;
+    if(error == SER_STREAM_OK && s->ended == false)
+        error = SER_STREAM_ERROR_TRUNCATED;
+
+    platform_file_close(&s->file);
+    for(isize i = 0; i < 2; i++)
+        allocator_deallocate(s->alloc, s->buffers[i], s->capacities[i], 8);
+    allocator_deallocate(s->alloc, s->staging, s->staging_capacity, 8);
+    memset(s, 0, sizeof *s);
+    return error;
+}
+
+EXTERNAL const char* ser_stream_error_to_string(Ser_Stream_Error error)
+{
+    switch(error) {
+        case SER_STREAM_OK:                 return "ok";
+        case SER_STREAM_ERROR_IO:           return "io error";
+        case SER_STREAM_ERROR_CLOSED:       return "channel closed";
+        case SER_STREAM_ERROR_CORRUPTED:    return "corrupted";
+        case SER_STREAM_ERROR_TRUNCATED:    return "truncated";
+        default:                            return "unknown";
+    }
+}
+#endif
@@ -21,7 +21,7 @@
     #include <assert.h>
 
     #define SLZ4_MALLOC(new_size)       malloc(new_size)
-    #define SLZ4_FREE(ptr, old_size)    ((void) old_size, free(ptr))
+    #define SLZ4_FREE(ptr, old_size)    ((void) (old_size), free(ptr))
     #define SLZ4_ASSERT(x)              (assert(x), (void) sizeof(x))
     #define SLZ4_TEST(x)                (!(x) ? printf("SLZ4_TEST(" #x ") failed\n"), abort() : (void)0) //assert that does not get removed from release builds
     #define SLZ4_INTERNAL               inline static
@@ -86,6 +86,33 @@ SLZ4_EXPORT SLZ4_Malloced slz4_compress_malloc(const void* input, int input_size
 //Same as slz4_decompress except the output is placed into returned malloced memory. 
 SLZ4_EXPORT SLZ4_Malloced slz4_decompress_malloc(const void* input, int input_size, SLZ4_Decompress_State* state_or_null);
 
+//Prepared dictionary for compression of small inputs. Matches can refer to the last SLZ4_WINDOW_SIZE bytes of the dictionary
+// as if they were placed right before the input. The hash table of the dictionary is built once in slz4_dictionary_init
+// and only read during compression, so the same dictionary can be used from multiple threads at once.
+typedef struct SLZ4_Dictionary {
+    uint8_t* data;          //copy of the used part of the dictionary followed by 8 bytes of padding
+    int size;
+    int hash_size_exponent;
+    int bucket_size_exponent;
+    int table_size;
+    void* table;            //same layout as SLZ4_Compress_State::compression_table_or_null, positions are within data
+} SLZ4_Dictionary;
+
+//Builds the dictionary from the given bytes. Only the last SLZ4_WINDOW_SIZE bytes are used.
+SLZ4_EXPORT SLZ4_Status slz4_dictionary_init(SLZ4_Dictionary* dictionary, const void* data, int size);
+SLZ4_EXPORT void slz4_dictionary_deinit(SLZ4_Dictionary* dictionary);
+
+//Same as slz4_compress but can use the dictionary for matches. Must be decompressed with slz4_decompress_with_dictionary 
+// given the same dictionary bytes. When state_or_null is NULL uses a hash table sized for the input which makes compression
+// of small inputs cheap.
+SLZ4_EXPORT int slz4_compress_with_dictionary(void* output, int output_size, const void* input, int input_size, const SLZ4_Dictionary* dictionary, SLZ4_Compress_State* state_or_null);
+//Same as slz4_decompress but resolves matches reaching before the start of output into the dictionary.
+SLZ4_EXPORT int slz4_decompress_with_dictionary(void* output, int output_size, const void* input, int input_size, const void* dictionary, int dictionary_size, SLZ4_Decompress_State* state_or_null);
+
+//Builds a dictionary of at most dictionary_capacity bytes from sample_count samples stored one after another in samples.
+// Picks the segments whose 8 byte sequences occur in the most samples. Returns the size of the dictionary or negative SLZ4_Status.
+SLZ4_EXPORT int slz4_dictionary_train(void* dictionary, int dictionary_capacity, const void* samples, const int* sample_sizes, int sample_count);
+
 //Returns maximum size after compression of an input of the given size.
 SLZ4_EXPORT int slz4_compressed_size_upper_bound(int size_before_compression);
 //Returns the needed size in bytes for compression table (from SLZ4_Compress_State) given the provided parameters. 
@@ -99,6 +126,8 @@ SLZ4_EXPORT size_t slz4_required_size_for_compression_table(int size_exponent, i
 SLZ4_INTERNAL int  _slz4_find_first_set_bit64(uint64_t num);
 SLZ4_INTERNAL bool _slz4_output_token(uint8_t* out, uint32_t* out_i, uint32_t output_size, uint32_t in_i, uint32_t literal_size, const uint8_t* literal_data, uint32_t match_size, uint32_t match_offset, bool is_last_literal);
 SLZ4_INTERNAL uint32_t  _slz4_read_long_size(const uint8_t* in, uint32_t size, uint32_t* in_i, bool can_safely_skip_first_check);
+SLZ4_INTERNAL int  _slz4_compress(void* output, int output_size, const void* input, int input_size, SLZ4_Compress_State* state_or_null, const SLZ4_Dictionary* dict);
+SLZ4_INTERNAL int  _slz4_decompress(void* output, int output_size, const void* input, int input_size, const uint8_t* dict, uint32_t dict_size, SLZ4_Decompress_State* state_or_null);
 
 SLZ4_EXPORT int slz4_compressed_size_upper_bound(int size_before_compression)
 {
@@ -119,7 +148,203 @@ SLZ4_EXPORT size_t slz4_required_size_for_compression_table(int size_exponent, i
     return bytes;
 }
 
+SLZ4_EXPORT SLZ4_Status slz4_dictionary_init(SLZ4_Dictionary* dictionary, const void* data, int size)
+{
+    memset(dictionary, 0, sizeof *dictionary);
+    if(size < 0 || (data == NULL && size != 0))
+        return SLZ4_ERROR_INVALID_PARAMS;
+
+    const uint8_t* from = (const uint8_t*) data;
+    if(size > SLZ4_WINDOW_SIZE) {
+        from += size - SLZ4_WINDOW_SIZE;
+        size = SLZ4_WINDOW_SIZE;
+    }
+
+    //The whole window fits into the table with little loss so lookups are about as good as in the input itself
+    dictionary->hash_size_exponent = 14;
+    dictionary->bucket_size_exponent = 2;
+    dictionary->table_size = (int) slz4_required_size_for_compression_table(dictionary->hash_size_exponent, dictionary->bucket_size_exponent);
+    dictionary->data = (uint8_t*) SLZ4_MALLOC((size_t) size + 8);
+    dictionary->table = SLZ4_MALLOC((size_t) dictionary->table_size);
+    if(dictionary->data == NULL || dictionary->table == NULL) {
+        slz4_dictionary_deinit(dictionary);
+        return SLZ4_ERROR_MALLOC_FAILED;
+    }
+
+    dictionary->size = size;
+    if(size > 0)
+        memcpy(dictionary->data, from, (size_t) size);
+    memset(dictionary->data + size, 0, 8);
+
+    uint32_t hash_exponent = (uint32_t) dictionary->hash_size_exponent;
+    uint32_t bucket_size = 1u << dictionary->bucket_size_exponent;
+    uint32_t hash_size = 1u << hash_exponent;
+    uint32_t* hash = (uint32_t*) dictionary->table;
+    uint8_t* buckets_last = (uint8_t*) (void*) (hash + hash_size*bucket_size);
+    memset(hash, 0xFF, hash_size*bucket_size*sizeof(uint32_t));
+    memset(buckets_last, 0, hash_size*sizeof(uint8_t));
+
+    for(uint32_t i = 0; i + SLZ4_MIN_MATCH <= (uint32_t) size; i++)
+    {
+        uint32_t read = 0; memcpy(&read, dictionary->data + i, sizeof read);
+        uint32_t hash_index = (read * 2654435761U) >> (32 - hash_exponent);
+        hash[hash_index*bucket_size + buckets_last[hash_index]] = i;
+        buckets_last[hash_index] = (uint8_t) ((buckets_last[hash_index] + 1) & (bucket_size - 1));
+    }
+
+    return SLZ4_SUCCESS;
+}
+
+SLZ4_EXPORT void slz4_dictionary_deinit(SLZ4_Dictionary* dictionary)
+{
+    if(dictionary->data)
+        SLZ4_FREE(dictionary->data, (size_t) dictionary->size + 8);
+    if(dictionary->table)
+        SLZ4_FREE(dictionary->table, (size_t) dictionary->table_size);
+    memset(dictionary, 0, sizeof *dictionary);
+}
+
+SLZ4_EXPORT int slz4_dictionary_train(void* dictionary, int dictionary_capacity, const void* samples, const int* sample_sizes, int sample_count)
+{
+    //This is a simplified version of the COVER algorithm of zstd. 
+    // 1. For every 8 byte sequence count the number of samples it occurs in.
+    // 2. Split the concatenated samples into as many epochs as we want segments. From each epoch pick the segment 
+    //    with the highest sum of counts of its sequences (ignoring those occuring in a single sample).
+    //    Zero the counts of the sequences of the picked segment so that no other segment covers them again.
+    // 3. Concatenate the segments with the best ones at the end. Matches are only allowed SLZ4_WINDOW_SIZE back 
+    //    so the end of the dictionary is reachable from further into the input than the start.
+    enum {GRAM = 8, SEGMENT = 64, COUNT_EXPONENT = 18};
+    if(dictionary_capacity < 0 || sample_count < 0 || (dictionary == NULL && dictionary_capacity != 0) 
+        || (sample_sizes == NULL && sample_count != 0))
+        return SLZ4_ERROR_INVALID_PARAMS;
+
+    int64_t total = 0;
+    for(int i = 0; i < sample_count; i++) {
+        if(sample_sizes[i] < 0)
+            return SLZ4_ERROR_INVALID_PARAMS;
+        total += sample_sizes[i];
+    }
+    if(total > SLZ4_MAX_SIZE || (samples == NULL && total != 0))
+        return SLZ4_ERROR_INVALID_PARAMS;
+    if(dictionary_capacity > SLZ4_WINDOW_SIZE)
+        dictionary_capacity = SLZ4_WINDOW_SIZE;
+    if(total < SEGMENT || dictionary_capacity < SEGMENT)
+        return 0;
+
+    const uint8_t* in = (const uint8_t*) samples;
+    uint32_t segment_count = (uint32_t) dictionary_capacity/SEGMENT;
+    size_t counts_size = sizeof(uint32_t) << COUNT_EXPONENT;
+    size_t grams_size = (size_t) total*sizeof(uint32_t);
+    size_t segments_size = segment_count*sizeof(uint64_t);
+    uint32_t* counts = (uint32_t*) SLZ4_MALLOC(counts_size);
+    uint32_t* last_sample = (uint32_t*) SLZ4_MALLOC(counts_size);
+    uint32_t* grams = (uint32_t*) SLZ4_MALLOC(grams_size);         //hash of the sequence at each position or UINT32_MAX if it crosses a sample boundary
+    uint64_t* segments = (uint64_t*) SLZ4_MALLOC(segments_size);   //score << 32 | start of each picked segment
+    int out = 0;
+    if(counts == NULL || last_sample == NULL || grams == NULL || segments == NULL)
+        out = SLZ4_ERROR_MALLOC_FAILED;
+    else
+    {
+        memset(counts, 0, counts_size);
+        memset(last_sample, 0, counts_size);
+        uint32_t pos = 0;
+        for(int s = 0; s < sample_count; s++)
+        {
+            uint32_t end = pos + (uint32_t) sample_sizes[s];
+            for(; pos < end; pos++)
+            {
+                grams[pos] = UINT32_MAX;
+                if(pos + GRAM <= end)
+                {
+                    uint64_t read = 0; memcpy(&read, in + pos, sizeof read);
+                    uint32_t h = (uint32_t) ((read * 0x9E3779B97F4A7C15ull) >> (64 - COUNT_EXPONENT));
+                    grams[pos] = h;
+                    if(last_sample[h] != (uint32_t) s + 1) {
+                        last_sample[h] = (uint32_t) s + 1;
+                        counts[h] += 1;
+                    }
+                }
+            }
+        }
+
+        #define _slz4_gram_score(p) (grams[p] != UINT32_MAX && counts[grams[p]] > 1 ? counts[grams[p]] : 0)
+        uint32_t picked = 0;
+        uint64_t epoch_size = (uint64_t) total/segment_count;
+        for(uint32_t e = 0; e < segment_count; e++)
+        {
+            uint32_t from = (uint32_t) (e*epoch_size);
+            uint32_t to = (uint32_t) ((e + 1)*epoch_size);
+            if(to - from < SEGMENT)
+                continue;
+
+            //Sliding sum of the scores of the sequences starting within [start, start + SEGMENT - GRAM]
+            uint64_t score = 0;
+            for(uint32_t p = from; p <= from + SEGMENT - GRAM; p++)
+                score += _slz4_gram_score(p);
+
+            uint64_t best_score = score;
+            uint32_t best_start = from;
+            for(uint32_t start = from + 1; start + SEGMENT <= to; start++)
+            {
+                score -= _slz4_gram_score(start - 1);
+                score += _slz4_gram_score(start + SEGMENT - GRAM);
+                if(score > best_score) {
+                    best_score = score;
+                    best_start = start;
+                }
+            }
+
+            if(best_score == 0)
+                continue;
+
+            for(uint32_t p = best_start; p <= best_start + SEGMENT - GRAM; p++)
+                if(grams[p] != UINT32_MAX)
+                    counts[grams[p]] = 0;
+
+            if(best_score > UINT32_MAX)
+                best_score = UINT32_MAX;
+            segments[picked++] = best_score << 32 | best_start;
+        }
+        #undef _slz4_gram_score
+
+        //Insertion sort by score, worst first. There are at most SLZ4_WINDOW_SIZE/SEGMENT segments.
+        for(uint32_t i = 1; i < picked; i++)
+        {
+            uint64_t segment = segments[i];
+            uint32_t j = i;
+            for(; j > 0 && segments[j - 1] > segment; j--)
+                segments[j] = segments[j - 1];
+            segments[j] = segment;
+        }
+
+        uint8_t* dict = (uint8_t*) dictionary;
+        for(uint32_t i = 0; i < picked; i++)
+        {
+            memcpy(dict + out, in + (uint32_t) segments[i], SEGMENT);
+            out += SEGMENT;
+        }
+    }
+
+    if(counts) SLZ4_FREE(counts, counts_size);
+    if(last_sample) SLZ4_FREE(last_sample, counts_size);
+    if(grams) SLZ4_FREE(grams, grams_size);
+    if(segments) SLZ4_FREE(segments, segments_size);
+    return out;
+}
+
 SLZ4_EXPORT int slz4_compress(void* output, int output_size, const void* input, int input_size, SLZ4_Compress_State* state_or_null)
+{
+    return _slz4_compress(output, output_size, input, input_size, state_or_null, NULL);
+}
+
+SLZ4_EXPORT int slz4_compress_with_dictionary(void* output, int output_size, const void* input, int input_size, const SLZ4_Dictionary* dictionary, SLZ4_Compress_State* state_or_null)
+{
+    if(dictionary == NULL || dictionary->size <= 0)
+        return _slz4_compress(output, output_size, input, input_size, state_or_null, NULL);
+    return _slz4_compress(output, output_size, input, input_size, state_or_null, dictionary);
+}
+
+SLZ4_INTERNAL int _slz4_compress(void* output, int output_size, const void* input, int input_size, SLZ4_Compress_State* state_or_null, const SLZ4_Dictionary* dict)
 {
     if((output == NULL && output_size != 0) 
         || (input == NULL && input_size != 0) 
@@ -147,6 +372,10 @@ SLZ4_EXPORT int slz4_compress(void* output, int output_size, const void* input,
     // stored in a separate array of u8's. This means we dont need to worry about removing items from the hash. 
     // We also dont store the keys anywhere instead see if the memory pointed to by the match really does 
     // equal the input.
+    //
+    // With a dictionary we additionally look into the read only hash table of the dictionary built the same way.
+    // The dictionary is logically placed right before the input so a match starting in it has offset 
+    // in_i + dict_size - match_pos and can continue from the end of the dictionary into the start of the input.
 
     //Use provided state or default one
     SLZ4_Compress_State default_state = {0};
@@ -154,6 +383,12 @@ SLZ4_EXPORT int slz4_compress(void* output, int output_size, const void* input,
     default_state.bucket_size_exponent = 2;
     SLZ4_Compress_State* state = state_or_null ? state_or_null : &default_state;
 
+    //Small inputs compressed against a dictionary are the common case so we dont want to clear a table 
+    // many times bigger than the input. The dictionary has its own table so this does not hurt the ratio.
+    if(dict && state_or_null == NULL)
+        while(default_state.hash_size_exponent > 6 && (1 << (default_state.hash_size_exponent - 1)) >= input_size)
+            default_state.hash_size_exponent -= 1;
+
     //Allocate and populate the hash table
     void* hash_table_data = state->compression_table_or_null;
     if(hash_table_data == NULL)
@@ -218,7 +453,7 @@ SLZ4_EXPORT int slz4_compress(void* output, int output_size, const void* input,
             //Starts from the most recently added and stops when either:
             // 1. Iterated the whole bucket
             // 2. The position pointed to by the slot is outside of the window
-            uint32_t longest_match_pos = 0;
+            uint32_t longest_match_offset = 0;
             uint32_t longest_match_size = 0;
             for(uint32_t k = 0; k < bucket_size; k++)
             {
@@ -249,7 +484,61 @@ SLZ4_EXPORT int slz4_compress(void* output, int output_size, const void* input,
                 if(longest_match_size < match_size)
                 {
                     longest_match_size = match_size;
-                    longest_match_pos = match_pos;
+                    longest_match_offset = in_i - match_pos;
+                }
+            }
+
+            if(dict)
+            {
+                const uint32_t* dict_hash = (const uint32_t*) dict->table;
+                uint32_t dict_bucket_size = 1u << dict->bucket_size_exponent;
+                uint32_t dict_hash_index = ((uint32_t) first_input_read * 2654435761U) >> (32 - dict->hash_size_exponent);
+                const uint32_t* dict_offsets = &dict_hash[dict_hash_index*dict_bucket_size];
+                const uint8_t* dict_last = (const uint8_t*) (dict_hash + ((size_t) dict_bucket_size << dict->hash_size_exponent)) + dict_hash_index;
+                uint32_t dict_size = (uint32_t) dict->size;
+                for(uint32_t k = 0; k < dict_bucket_size; k++)
+                {
+                    uint32_t match_pos = dict_offsets[(*dict_last - k - 1) & (dict_bucket_size - 1)];
+                    if(match_pos >= dict_size || in_i + dict_size - match_pos > SLZ4_WINDOW_SIZE)
+                        break;
+
+                    //Compare against the rest of the dictionary (which is padded so we can overread)
+                    // and if all of it matches continue from the start of the input.
+                    uint32_t in_dict = dict_size - match_pos;
+                    uint32_t match_size = 0;
+                    for(; match_size < in_dict && in_i + match_size <= in_size; match_size += 8)
+                    {
+                        uint64_t input_read = 0; memcpy(&input_read, in + in_i + match_size, sizeof input_read);
+                        uint64_t match_read = 0; memcpy(&match_read, dict->data + match_pos + match_size, sizeof match_read);
+                        uint64_t comp = input_read ^ match_read;
+                        if(comp != 0)
+                        {
+                            match_size += _slz4_find_first_set_bit64(comp)/8;
+                            break;
+                        }
+                    }
+
+                    if(match_size >= in_dict)
+                    {
+                        match_size = in_dict;
+                        for(uint32_t from = 0; in_i + match_size <= in_size; match_size += 8, from += 8)
+                        {
+                            uint64_t input_read = 0; memcpy(&input_read, in + in_i + match_size, sizeof input_read);
+                            uint64_t match_read = 0; memcpy(&match_read, in + from, sizeof match_read);
+                            uint64_t comp = input_read ^ match_read;
+                            if(comp != 0)
+                            {
+                                match_size += _slz4_find_first_set_bit64(comp)/8;
+                                break;
+                            }
+                        }
+                    }
+
+                    if(longest_match_size < match_size)
+                    {
+                        longest_match_size = match_size;
+                        longest_match_offset = in_i + dict_size - match_pos;
+                    }
                 }
             }
             
@@ -275,10 +564,10 @@ SLZ4_EXPORT int slz4_compress(void* output, int output_size, const void* input,
             {
                 SLZ4_ASSERT(longest_match_size >= SLZ4_MIN_MATCH);
                 SLZ4_ASSERT(in_i >= last_token_in_i);
-                SLZ4_ASSERT(in_i >= longest_match_pos);
 
-                uint32_t match_offset = in_i - longest_match_pos;
-                if(_slz4_output_token(out, &out_i, out_size, in_i, literal_size, in + last_token_in_i, longest_match_size, match_offset, false) == false)
+                uint32_t match_offset = longest_match_offset;
+                uint32_t reachable = dict ? in_i + (uint32_t) dict->size : in_i;
+                if(_slz4_output_token(out, &out_i, out_size, reachable, literal_size, in + last_token_in_i, longest_match_size, match_offset, false) == false)
                 {
                     okay = false;
                     break;
@@ -401,6 +690,40 @@ SLZ4_INTERNAL bool _slz4_output_token(uint8_t* out, uint32_t* out_i, uint32_t ou
 }
 
 SLZ4_EXPORT int slz4_decompress(void* output, int output_size, const void* input, int input_size, SLZ4_Decompress_State* state_or_null)
+{
+    return _slz4_decompress(output, output_size, input, input_size, NULL, 0, state_or_null);
+}
+
+SLZ4_EXPORT int slz4_decompress_with_dictionary(void* output, int output_size, const void* input, int input_size, const void* dictionary, int dictionary_size, SLZ4_Decompress_State* state_or_null)
+{
+    if(dictionary == NULL || dictionary_size <= 0)
+        return _slz4_decompress(output, output_size, input, input_size, NULL, 0, state_or_null);
+
+    //Only the last window of the dictionary can be referenced
+    const uint8_t* dict = (const uint8_t*) dictionary;
+    if(dictionary_size > SLZ4_WINDOW_SIZE) {
+        dict += dictionary_size - SLZ4_WINDOW_SIZE;
+        dictionary_size = SLZ4_WINDOW_SIZE;
+    }
+    return _slz4_decompress(output, output_size, input, input_size, dict, (uint32_t) dictionary_size, state_or_null);
+}
+
+//Matches with offset bigger than the current position start in the dictionary. Copies the part of the match 
+// within the dictionary after which the rest of the match is a regular match starting at the start of output.
+// When the whole match was within the dictionary match_size is left 0 and the offset check below lets it through.
+#define _SLZ4_COPY_FROM_DICT(out, out_i, out_size, match_offset, match_size, dict, dict_size)             \
+    if(match_offset > out_i && match_offset - out_i <= dict_size && out_i + match_size <= out_size)     \
+    {                                                                                                   \
+        uint32_t from_dict = match_offset - out_i;                                                      \
+        if(from_dict > match_size)                                                                      \
+            from_dict = match_size;                                                                     \
+        if(out)                                                                                         \
+            memcpy(out + out_i, dict + dict_size - (match_offset - out_i), from_dict);                  \
+        out_i += from_dict;                                                                             \
+        match_size -= from_dict;                                                                        \
+    }                                                                                                   \
+
+SLZ4_INTERNAL int _slz4_decompress(void* output, int output_size, const void* input, int input_size, const uint8_t* dict, uint32_t dict_size, SLZ4_Decompress_State* state_or_null)
 {
     const uint8_t* in = (const uint8_t*) input;
     uint8_t* out = (uint8_t*) output;
@@ -527,7 +850,8 @@ SLZ4_EXPORT int slz4_decompress(void* output, int output_size, const void* input
         
             //Match size is possibly unbounded so we need to check
             match_size += 4;
-            if(match_offset > out_i || match_offset == 0 || out_i + match_size > out_size) // (*)
+            _SLZ4_COPY_FROM_DICT(out, out_i, out_size, match_offset, match_size, dict, dict_size);
+            if((match_offset > out_i && match_size > 0) || match_offset == 0 || out_i + match_size > out_size) // (*)
                 break;
 
             if(out) {
@@ -614,7 +938,8 @@ SLZ4_EXPORT int slz4_decompress(void* output, int output_size, const void* input
         }
 
         match_size += 4;
-        if(match_offset > out_i || match_offset == 0 || out_i + match_size > out_size)
+        _SLZ4_COPY_FROM_DICT(out, out_i, out_size, match_offset, match_size, dict, dict_size);
+        if((match_offset > out_i && match_size > 0) || match_offset == 0 || out_i + match_size > out_size)
             goto error_invalid_offset_or_match;
         
         if(out)
@@ -801,6 +1126,7 @@ SLZ4_EXPORT SLZ4_Malloced slz4_decompress_malloc(const void* input, int input_si
 SLZ4_EXPORT void slz4_test_unit();
 SLZ4_EXPORT void slz4_test_sizes(double seconds);
 SLZ4_EXPORT void slz4_test_invalid_decompress(double seconds);
+SLZ4_EXPORT void slz4_test_dictionary();
 
 SLZ4_INTERNAL void _slz4_test_get_rotated_text(char* string, int size);
 SLZ4_INTERNAL double _slz4_now();
@@ -924,6 +1250,139 @@ SLZ4_EXPORT void slz4_test_unit()
     slz4_test_roundtrip_string(testing_buffer);
 
     free(testing_buffer);
+    slz4_test_dictionary();
+}
+
+//Compresses with and without the dictionary and checks both decompress back. Returns the compressed size with the dictionary.
+SLZ4_EXPORT int slz4_test_roundtrip_dictionary(const void* data, int size, const SLZ4_Dictionary* dictionary, const void* dictionary_data, int dictionary_size)
+{
+    int capacity = slz4_compressed_size_upper_bound(size);
+    char* compressed = (char*) calloc((size_t) capacity + 1, 1);
+    char* decompressed = (char*) calloc((size_t) size + 1, 1);
+    SLZ4_TEST(compressed != NULL && decompressed != NULL);
+
+    int compressed_size = slz4_compress_with_dictionary(compressed, capacity, data, size, dictionary, NULL);
+    SLZ4_TEST(compressed_size > 0);
+    
+    //Dry run and exact sized output
+    SLZ4_TEST(slz4_decompress_with_dictionary(NULL, 0, compressed, compressed_size, dictionary_data, dictionary_size, NULL) == size);
+    int decompressed_size = slz4_decompress_with_dictionary(decompressed, size, compressed, compressed_size, dictionary_data, dictionary_size, NULL);
+    SLZ4_TEST(decompressed_size == size);
+    SLZ4_TEST(memcmp(data, decompressed, (size_t) size) == 0);
+    if(size > 0)
+        SLZ4_TEST(slz4_decompress_with_dictionary(decompressed, size - 1, compressed, compressed_size, dictionary_data, dictionary_size, NULL) < 0);
+
+    //Using an explicit (bigger) table must give the same result
+    SLZ4_Compress_State state = {0};
+    state.hash_size_exponent = 14;
+    state.bucket_size_exponent = 2;
+    int state_size = slz4_compress_with_dictionary(compressed, capacity, data, size, dictionary, &state);
+    SLZ4_TEST(state_size > 0);
+    SLZ4_TEST(slz4_decompress_with_dictionary(decompressed, size, compressed, state_size, dictionary_data, dictionary_size, NULL) == size);
+    SLZ4_TEST(memcmp(data, decompressed, (size_t) size) == 0);
+
+    free(compressed);
+    free(decompressed);
+    return compressed_size;
+}
+
+SLZ4_INTERNAL int _slz4_test_message(char* into, int capacity, int i)
+{
+    const char* statuses[] = {"active", "suspended", "pending_verification", "deleted"};
+    const char* countries[] = {"Czech Republic", "Germany", "United Kingdom", "Japan", "Brazil"};
+    return snprintf(into, (size_t) capacity, 
+        "{\"id\":%i,\"username\":\"user_%i\",\"email\":\"user_%i@example.com\",\"status\":\"%s\","
+        "\"address\":{\"country\":\"%s\",\"zip\":\"%05i\"},\"created_at\":\"2024-%02i-%02iT%02i:%02i:00Z\","
+        "\"roles\":[\"reader\",\"%s\"],\"score\":%i}", 
+        i*7919 % 100000, i*31 % 1000, i*31 % 1000, statuses[i % 4], countries[i*7 % 5], i*131 % 100000, 
+        i % 12 + 1, i % 28 + 1, i % 24, i*13 % 60, i % 3 ? "writer" : "admin", i*i % 1000);
+}
+
+SLZ4_EXPORT void slz4_test_dictionary()
+{
+    printf("sLZ4 Testing dictionaries\n");
+    enum {SAMPLE_COUNT = 500, MESSAGE_CAPACITY = 512, DICT_CAPACITY = 4096};
+    char* samples = (char*) malloc(SAMPLE_COUNT*MESSAGE_CAPACITY);
+    int* sample_sizes = (int*) malloc(SAMPLE_COUNT*sizeof(int));
+    char* trained = (char*) malloc(DICT_CAPACITY);
+    SLZ4_TEST(samples && sample_sizes && trained);
+
+    //Train on one set of messages and compress a different one
+    int samples_size = 0;
+    for(int i = 0; i < SAMPLE_COUNT; i++) {
+        sample_sizes[i] = _slz4_test_message(samples + samples_size, MESSAGE_CAPACITY, i);
+        samples_size += sample_sizes[i];
+    }
+
+    int trained_size = slz4_dictionary_train(trained, DICT_CAPACITY, samples, sample_sizes, SAMPLE_COUNT);
+    SLZ4_TEST(0 < trained_size && trained_size <= DICT_CAPACITY);
+    SLZ4_TEST(slz4_dictionary_train(trained, DICT_CAPACITY, samples, sample_sizes, 0) == 0);
+    SLZ4_TEST(slz4_dictionary_train(trained, -1, samples, sample_sizes, SAMPLE_COUNT) == SLZ4_ERROR_INVALID_PARAMS);
+
+    SLZ4_Dictionary dictionary = {0};
+    SLZ4_TEST(slz4_dictionary_init(&dictionary, trained, trained_size) == SLZ4_SUCCESS);
+    
+    int plain_total = 0;
+    int dict_total = 0;
+    char message[MESSAGE_CAPACITY];
+    char compressed[MESSAGE_CAPACITY*2];
+    for(int i = SAMPLE_COUNT; i < SAMPLE_COUNT + 200; i++)
+    {
+        int size = _slz4_test_message(message, MESSAGE_CAPACITY, i);
+        plain_total += slz4_compress(compressed, sizeof compressed, message, size, NULL);
+        dict_total += slz4_test_roundtrip_dictionary(message, size, &dictionary, trained, trained_size);
+    }
+    SLZ4_TEST(dict_total*2 < plain_total);
+
+    //All prefixes of a message. Covers matches ending exactly at the end of the dictionary as well 
+    // as the very short inputs which are stored as a single literal.
+    int size = _slz4_test_message(message, MESSAGE_CAPACITY, 3*SAMPLE_COUNT);
+    for(int i = 0; i <= size; i++)
+        slz4_test_roundtrip_dictionary(message, i, &dictionary, trained, trained_size);
+    slz4_dictionary_deinit(&dictionary);
+
+    //Matches spanning from the dictionary into the input and matches fully within the dictionary
+    {
+        const char* text = "The quick brown fox jumps over the lazy dog. The five boxing wizards jump quickly. ";
+        char input[256];
+        int text_size = (int) strlen(text);
+        SLZ4_TEST(slz4_dictionary_init(&dictionary, text, text_size) == SLZ4_SUCCESS);
+        for(int from = 0; from < text_size; from += 5)
+        {
+            int input_size = snprintf(input, sizeof input, "%s%s", text + from, text);
+            slz4_test_roundtrip_dictionary(input, input_size, &dictionary, text, text_size);
+            slz4_test_roundtrip_dictionary(text + from, text_size - from, &dictionary, text, text_size);
+        }
+
+        //The input equal to the dictionary is a single match plus the mandatory literals at the end
+        SLZ4_TEST(slz4_test_roundtrip_dictionary(text, text_size, &dictionary, text, text_size) < 20);
+        slz4_dictionary_deinit(&dictionary);
+    }
+
+    //Dictionary bigger than the window. Only its end is used and the decompressor needs to cut it the same way
+    {
+        enum {BIG_SIZE = 100000};
+        char* big = (char*) malloc(BIG_SIZE);
+        SLZ4_TEST(big != NULL);
+        _slz4_test_get_rotated_text(big, BIG_SIZE);
+        SLZ4_TEST(slz4_dictionary_init(&dictionary, big, BIG_SIZE) == SLZ4_SUCCESS);
+        SLZ4_TEST(dictionary.size == SLZ4_WINDOW_SIZE);
+        for(int from = 0; from < BIG_SIZE; from += 9973) {
+            int input_size = BIG_SIZE - from < 1000 ? BIG_SIZE - from : 1000;
+            slz4_test_roundtrip_dictionary(big + from, input_size, &dictionary, big, BIG_SIZE);
+        }
+        slz4_dictionary_deinit(&dictionary);
+        free(big);
+    }
+
+    SLZ4_TEST(slz4_dictionary_init(&dictionary, NULL, 10) == SLZ4_ERROR_INVALID_PARAMS);
+    SLZ4_TEST(slz4_dictionary_init(&dictionary, NULL, 0) == SLZ4_SUCCESS);
+    slz4_test_roundtrip_dictionary("hello hello hello hello", 23, &dictionary, NULL, 0);
+    slz4_dictionary_deinit(&dictionary);
+
+    free(samples);
+    free(sample_sizes);
+    free(trained);
 }
 
 SLZ4_EXPORT void slz4_test_sizes(double seconds)
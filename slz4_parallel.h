@@ -0,0 +1,433 @@
+#ifndef MODULE_SLZ4_PARALLEL
+#define MODULE_SLZ4_PARALLEL
+
+//Container of independently slz4 compressed blocks which can be compressed and decompressed on multiple threads.
+//
+//A single slz4 stream can only be decompressed front to back by one thread because every match may refer to
+// anything in the 64KB before it. Here we instead cut the input into blocks of block_size bytes (1MB by default) and
+// compress each on its own. The compressed blocks are followed by an index of their positions, so any block can be
+// found and decompressed without touching the others. This costs a little ratio (matches cannot cross blocks and
+// there are 16 bytes of index per block) but buys:
+// - parallel decompression into a preallocated buffer. Threads grab blocks one by one, each block knows where its
+//   output goes (block i always starts at i*block_size).
+// - streaming decompression in order. Worker threads decompress ahead into a ring of block buffers while the calling
+//   thread hands finished blocks to a consumer function in order.
+// - random access to any byte range by decompressing only the blocks which overlap it.
+//
+//The layout is:
+//    SLZ4_Parallel_Header | block 0 | block 1 | ... | block N-1 | SLZ4_Parallel_Block[N]
+//All integers are little endian. Blocks which do not compress are stored as is (stored_size == raw_size).
+//
+//All threads are launched for the duration of the call with the calling thread working as one of them
+// (except for streaming where the calling thread runs the consumer).
+//Functions return the resulting size or a negative SLZ4_Status. A malformed container gives SLZ4_ERROR_INVALID_PARAMS.
+
+#include "slz4.h"
+#include "platform.h"
+#include "parallel.h"
+#include "allocator.h"
+#include "profile.h"
+#include "assert.h"
+#include "defines.h"
+
+#define SLZ4_PARALLEL_MAGIC         0x31524150345A4C53ull //"SLZ4PAR1"
+#ifndef SLZ4_PARALLEL_DEFAULT_BLOCK
+    #define SLZ4_PARALLEL_DEFAULT_BLOCK (1 << 20)
+#endif
+
+typedef struct SLZ4_Parallel_Header {
+    uint64_t magic;
+    uint32_t block_size;
+    uint32_t block_count;
+    uint64_t raw_size;
+    uint64_t index_offset;  //offset of the SLZ4_Parallel_Block array from the start of the container
+} SLZ4_Parallel_Header;
+
+typedef struct SLZ4_Parallel_Block {
+    uint64_t offset;        //from the start of the container
+    uint32_t stored_size;
+    uint32_t raw_size;
+} SLZ4_Parallel_Block;
+
+//Receives the decompressed blocks in order. offset is the position of data within the whole decompressed output.
+//Returning false stops the decompression.
+typedef bool (*SLZ4_Parallel_Consumer)(void* context, const void* data, isize size, isize offset);
+
+//Returns the maximum size of the container for input of the given size.
+EXTERNAL isize slz4_parallel_compressed_size_upper_bound(isize input_size, isize block_size_or_zero);
+//Compresses input into a container placed into output. Is fastest when output_size is at least the upper bound,
+// otherwise needs a temporary buffer. thread_count_or_zero of 0 uses all processors.
+EXTERNAL isize slz4_parallel_compress(void* output, isize output_size, const void* input, isize input_size, isize block_size_or_zero, isize thread_count_or_zero);
+
+//Validates the container header and returns the decompressed size. Optionally also returns the header.
+EXTERNAL isize slz4_parallel_decompressed_size(const void* input, isize input_size, SLZ4_Parallel_Header* header_or_null);
+//Decompresses the entire container into output, which must be big enough for the decompressed size.
+EXTERNAL isize slz4_parallel_decompress(void* output, isize output_size, const void* input, isize input_size, isize thread_count_or_zero);
+//Decompresses the entire container passing consecutive blocks to consumer in order. Returns the number of bytes passed to consumer.
+EXTERNAL isize slz4_parallel_decompress_stream(const void* input, isize input_size, SLZ4_Parallel_Consumer consumer, void* context, isize thread_count_or_zero);
+//Decompresses bytes [from, from + size) of the decompressed data into output. Only the overlapping blocks are decompressed.
+EXTERNAL isize slz4_parallel_decompress_range(void* output, isize from, isize size, const void* input, isize input_size);
+#endif
+
+#if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_SLZ4_PARALLEL)) && !defined(MODULE_HAS_IMPL_SLZ4_PARALLEL)
+#define MODULE_HAS_IMPL_SLZ4_PARALLEL
+
+typedef enum _SLZ4_Parallel_Kind {
+    _SLZ4_PARALLEL_COMPRESS,
+    _SLZ4_PARALLEL_DECOMPRESS,
+    _SLZ4_PARALLEL_STREAM,
+} _SLZ4_Parallel_Kind;
+
+typedef struct _SLZ4_Parallel {
+    _SLZ4_Parallel_Kind kind;
+    uint32_t thread_count;
+    const uint8_t* input;
+    isize input_size;
+    uint8_t* output;
+    isize block_size;
+    isize block_count;
+    isize raw_size;
+
+    //Compress: block i is compressed into staging + i*slot_size and described by blocks[i] with offset relative to staging
+    uint8_t* staging;
+    isize slot_size;
+    SLZ4_Parallel_Block* blocks;
+
+    //Decompress
+    const uint8_t* index;
+
+    //Stream: block i is decompressed into ring + (i % ring_count)*block_size once i < delivered + ring_count.
+    // ready[i % ring_count] is set to i + 1 when it is done. The consumer sleeps on produced which changes
+    // whenever any block is done or an error happens so that it cannot miss either. Workers sleep on delivered
+    // which is set to UINT32_MAX together with stop.
+    uint8_t* ring;
+    uint32_t ring_count;
+    PLATFORM_ATOMIC(uint32_t)* ready;
+    PLATFORM_ATOMIC(uint32_t) produced;
+    PLATFORM_ATOMIC(uint32_t) delivered;
+    PLATFORM_ATOMIC(uint32_t) stop;
+
+    PLATFORM_ATOMIC(uint32_t) next_block;
+    PLATFORM_ATOMIC(int32_t) error;
+} _SLZ4_Parallel;
+
+INTERNAL isize _slz4_parallel_block_size(isize block_size_or_zero)
+{
+    isize block_size = block_size_or_zero > 0 ? block_size_or_zero : SLZ4_PARALLEL_DEFAULT_BLOCK;
+    return MIN(block_size, SLZ4_MAX_SIZE/2);
+}
+
+INTERNAL void _slz4_parallel_fail(_SLZ4_Parallel* work, int32_t status)
+{
+    int32_t none = SLZ4_SUCCESS;
+    atomic_compare_exchange_strong(&work->error, &none, status);
+    atomic_fetch_add(&work->produced, 1);
+    platform_futex_wake_all(&work->produced);
+}
+
+//Decompresses block i into into. Returns false on error.
+INTERNAL bool _slz4_parallel_decompress_block(const uint8_t* input, isize input_size, const uint8_t* index, isize block_size, isize raw_size, isize i, uint8_t* into)
+{
+    SLZ4_Parallel_Block block = {0};
+    memcpy(&block, index + i*sizeof(SLZ4_Parallel_Block), sizeof block);
+    isize expected = MIN(block_size, raw_size - i*block_size);
+    if(block.raw_size != expected || block.offset > (uint64_t) input_size || block.stored_size > (uint64_t) input_size - block.offset)
+        return false;
+
+    const uint8_t* stored = input + block.offset;
+    if(block.stored_size == block.raw_size) {
+        memcpy(into, stored, block.raw_size);
+        return true;
+    }
+    return slz4_decompress(into, (int) block.raw_size, stored, (int) block.stored_size, NULL) == (int) block.raw_size;
+}
+
+INTERNAL void _slz4_parallel_worker(void* context, isize thread_index)
+{
+    (void) thread_index;
+    _SLZ4_Parallel* work = (_SLZ4_Parallel*) context;
+    for(;;) {
+        uint32_t i = atomic_fetch_add(&work->next_block, 1);
+        if(i >= work->block_count || atomic_load(&work->error) != SLZ4_SUCCESS)
+            break;
+
+        isize raw_from = (isize) i*work->block_size;
+        isize raw_size = MIN(work->block_size, work->raw_size - raw_from);
+        switch(work->kind) {
+            case _SLZ4_PARALLEL_COMPRESS: {
+                uint8_t* slot = work->staging + i*work->slot_size;
+                int compressed = slz4_compress(slot, (int) work->slot_size, work->input + raw_from, (int) raw_size, NULL);
+                SLZ4_Parallel_Block block = {(uint64_t) i*work->slot_size, (uint32_t) raw_size, (uint32_t) raw_size};
+                if(0 < compressed && compressed < raw_size)
+                    block.stored_size = (uint32_t) compressed;
+                else
+                    memcpy(slot, work->input + raw_from, raw_size);
+                work->blocks[i] = block;
+            } break;
+
+            case _SLZ4_PARALLEL_DECOMPRESS: {
+                if(_slz4_parallel_decompress_block(work->input, work->input_size, work->index, work->block_size, work->raw_size, i, work->output + raw_from) == false)
+                    _slz4_parallel_fail(work, SLZ4_ERROR_INVALID_PARAMS);
+            } break;
+
+            case _SLZ4_PARALLEL_STREAM: {
+                //Wait for the slot to be freed by the consumer
+                for(uint32_t delivered = 0; atomic_load(&work->stop) == 0 && i - (delivered = atomic_load(&work->delivered)) >= work->ring_count; )
+                    platform_futex_wait(&work->delivered, delivered, -1);
+                if(atomic_load(&work->stop))
+                    return;
+
+                uint32_t slot = i % work->ring_count;
+                if(_slz4_parallel_decompress_block(work->input, work->input_size, work->index, work->block_size, work->raw_size, i, work->ring + slot*work->block_size) == false)
+                    _slz4_parallel_fail(work, SLZ4_ERROR_INVALID_PARAMS);
+
+                atomic_store(&work->ready[slot], i + 1);
+                atomic_fetch_add(&work->produced, 1);
+                platform_futex_wake_all(&work->produced);
+            } break;
+        }
+    }
+}
+
+EXTERNAL isize slz4_parallel_compressed_size_upper_bound(isize input_size, isize block_size_or_zero)
+{
+    isize block_size = _slz4_parallel_block_size(block_size_or_zero);
+    isize block_count = (input_size + block_size - 1)/block_size;
+    return (isize) sizeof(SLZ4_Parallel_Header) + block_count*(slz4_compressed_size_upper_bound((int) block_size) + (isize) sizeof(SLZ4_Parallel_Block));
+}
+
+EXTERNAL isize slz4_parallel_compress(void* output, isize output_size, const void* input, isize input_size, isize block_size_or_zero, isize thread_count_or_zero)
+{
+    PROFILE_START();
+    isize out = 0;
+    isize block_size = _slz4_parallel_block_size(block_size_or_zero);
+    isize block_count = (input_size + block_size - 1)/block_size;
+    isize header_size = sizeof(SLZ4_Parallel_Header);
+    if((output == NULL && output_size != 0) || (input == NULL && input_size != 0) || output_size < 0 || input_size < 0 || block_count > UINT32_MAX)
+        out = SLZ4_ERROR_INVALID_PARAMS;
+    else if(output_size < header_size + block_count*(isize) sizeof(SLZ4_Parallel_Block))
+        out = SLZ4_ERROR_OUTPUT_TOO_SMALL;
+    else {
+        _SLZ4_Parallel work = {_SLZ4_PARALLEL_COMPRESS};
+        work.thread_count = (uint32_t) parallel_thread_count(thread_count_or_zero, block_count);
+        work.input = (const uint8_t*) input;
+        work.input_size = input_size;
+        work.block_size = block_size;
+        work.block_count = block_count;
+        work.raw_size = input_size;
+        work.slot_size = slz4_compressed_size_upper_bound((int) block_size);
+
+        //Blocks are compressed into slots of the maximum compressed size, which are then compacted.
+        // If output fits all slots we use it directly since the compacted blocks never overtake their slots.
+        Allocator* alloc = allocator_get_default();
+        isize blocks_bytes = block_count*sizeof(SLZ4_Parallel_Block);
+        isize staging_bytes = block_count*work.slot_size;
+        bool staging_in_output = output_size - header_size - blocks_bytes >= staging_bytes;
+        work.blocks = (SLZ4_Parallel_Block*) allocator_allocate(alloc, blocks_bytes, 8);
+        work.staging = staging_in_output ? (uint8_t*) output + header_size : (uint8_t*) allocator_allocate(alloc, staging_bytes, 8);
+
+        parallel_run(work.thread_count, _slz4_parallel_worker, &work, "slz4");
+
+        uint8_t* out_data = (uint8_t*) output;
+        isize offset = header_size;
+        for(isize i = 0; i < block_count; i++) {
+            SLZ4_Parallel_Block* block = &work.blocks[i];
+            if(offset + (isize) block->stored_size + blocks_bytes > output_size) {
+                offset = SLZ4_ERROR_OUTPUT_TOO_SMALL;
+                break;
+            }
+            memmove(out_data + offset, work.staging + block->offset, block->stored_size);
+            block->offset = (uint64_t) offset;
+            offset += block->stored_size;
+        }
+
+        if(offset >= 0) {
+            SLZ4_Parallel_Header header = {SLZ4_PARALLEL_MAGIC};
+            header.block_size = (uint32_t) block_size;
+            header.block_count = (uint32_t) block_count;
+            header.raw_size = (uint64_t) input_size;
+            header.index_offset = (uint64_t) offset;
+            memcpy(out_data, &header, sizeof header);
+            memcpy(out_data + offset, work.blocks, blocks_bytes);
+            offset += blocks_bytes;
+        }
+        out = offset;
+
+        if(staging_in_output == false)
+            allocator_deallocate(alloc, work.staging, staging_bytes, 8);
+        allocator_deallocate(alloc, work.blocks, blocks_bytes, 8);
+    }
+    PROFILE_STOP();
+    return out;
+}
+
+//Validates the header and returns the index or NULL if the container is malformed.
+//The index does not need to be aligned so its entries are always read with memcpy.
+INTERNAL const uint8_t* _slz4_parallel_parse(SLZ4_Parallel_Header* header, const void* input, isize input_size)
+{
+    memset(header, 0, sizeof *header);
+    if(input == NULL || input_size < (isize) sizeof(SLZ4_Parallel_Header))
+        return NULL;
+
+    memcpy(header, input, sizeof *header);
+    uint64_t max_blocks = header->block_size ? (header->raw_size + header->block_size - 1)/header->block_size : 0;
+    if(header->magic != SLZ4_PARALLEL_MAGIC
+        || header->block_size == 0
+        || header->block_size > SLZ4_MAX_SIZE/2
+        || header->block_count != max_blocks
+        || header->index_offset < sizeof(SLZ4_Parallel_Header)
+        || header->index_offset > (uint64_t) input_size
+        || ((uint64_t) input_size - header->index_offset)/sizeof(SLZ4_Parallel_Block) < header->block_count)
+        return NULL;
+
+    return (const uint8_t*) input + header->index_offset;
+}
+
+EXTERNAL isize slz4_parallel_decompressed_size(const void* input, isize input_size, SLZ4_Parallel_Header* header_or_null)
+{
+    SLZ4_Parallel_Header header = {0};
+    const uint8_t* index = _slz4_parallel_parse(&header, input, input_size);
+    if(header_or_null)
+        *header_or_null = header;
+    return index ? (isize) header.raw_size : SLZ4_ERROR_INVALID_PARAMS;
+}
+
+EXTERNAL isize slz4_parallel_decompress(void* output, isize output_size, const void* input, isize input_size, isize thread_count_or_zero)
+{
+    PROFILE_START();
+    isize out = 0;
+    SLZ4_Parallel_Header header = {0};
+    const uint8_t* index = _slz4_parallel_parse(&header, input, input_size);
+    if(index == NULL)
+        out = SLZ4_ERROR_INVALID_PARAMS;
+    else if(output_size < (isize) header.raw_size || (output == NULL && header.raw_size > 0))
+        out = SLZ4_ERROR_OUTPUT_TOO_SMALL;
+    else {
+        _SLZ4_Parallel work = {_SLZ4_PARALLEL_DECOMPRESS};
+        work.thread_count = (uint32_t) parallel_thread_count(thread_count_or_zero, header.block_count);
+        work.input = (const uint8_t*) input;
+        work.input_size = input_size;
+        work.output = (uint8_t*) output;
+        work.block_size = header.block_size;
+        work.block_count = header.block_count;
+        work.raw_size = (isize) header.raw_size;
+        work.index = index;
+
+        parallel_run(work.thread_count, _slz4_parallel_worker, &work, "slz4");
+
+        int32_t error = atomic_load(&work.error);
+        out = error ? error : work.raw_size;
+    }
+    PROFILE_STOP();
+    return out;
+}
+
+EXTERNAL isize slz4_parallel_decompress_stream(const void* input, isize input_size, SLZ4_Parallel_Consumer consumer, void* context, isize thread_count_or_zero)
+{
+    PROFILE_START();
+    isize out = 0;
+    SLZ4_Parallel_Header header = {0};
+    const uint8_t* index = _slz4_parallel_parse(&header, input, input_size);
+    if(index == NULL || consumer == NULL)
+        out = SLZ4_ERROR_INVALID_PARAMS;
+    else if(header.block_count > 0) {
+        _SLZ4_Parallel work = {_SLZ4_PARALLEL_STREAM};
+        work.thread_count = (uint32_t) parallel_thread_count(thread_count_or_zero, header.block_count);
+        work.input = (const uint8_t*) input;
+        work.input_size = input_size;
+        work.block_size = header.block_size;
+        work.block_count = header.block_count;
+        work.raw_size = (isize) header.raw_size;
+        work.index = index;
+
+        //Two blocks per thread so that each has one to work on while the consumer is busy with the other
+        Allocator* alloc = allocator_get_default();
+        work.ring_count = (uint32_t) MIN(2*work.thread_count, work.block_count);
+        isize ring_bytes = work.ring_count*work.block_size;
+        isize ready_bytes = work.ring_count*sizeof(PLATFORM_ATOMIC(uint32_t));
+        work.ring = (uint8_t*) allocator_allocate(alloc, ring_bytes, 8);
+        work.ready = (PLATFORM_ATOMIC(uint32_t)*) allocator_allocate(alloc, ready_bytes, 8);
+        memset((void*) work.ready, 0, ready_bytes);
+
+        Parallel_Group group = {0};
+        parallel_launch(&group, 0, work.thread_count, _slz4_parallel_worker, &work, "slz4");
+
+        for(uint32_t i = 0; i < work.block_count; i++) {
+            uint32_t slot = i % work.ring_count;
+            for(uint32_t produced = atomic_load(&work.produced); atomic_load(&work.ready[slot]) != i + 1 && atomic_load(&work.error) == SLZ4_SUCCESS; produced = atomic_load(&work.produced))
+                platform_futex_wait(&work.produced, produced, -1);
+
+            isize raw_from = (isize) i*work.block_size;
+            isize raw_size = MIN(work.block_size, work.raw_size - raw_from);
+            if(atomic_load(&work.error) != SLZ4_SUCCESS)
+                break;
+
+            out += raw_size;
+            if(consumer(context, work.ring + slot*work.block_size, raw_size, raw_from) == false)
+                break;
+
+            atomic_store(&work.delivered, i + 1);
+            platform_futex_wake_all(&work.delivered);
+        }
+
+        //Workers sleep on delivered so it has to change too, otherwise one that read it just before
+        // the stop could go to sleep after the wake and never return
+        atomic_store(&work.stop, 1);
+        atomic_store(&work.delivered, UINT32_MAX);
+        platform_futex_wake_all(&work.delivered);
+        parallel_join(&group);
+
+        int32_t error = atomic_load(&work.error);
+        if(error)
+            out = error;
+
+        allocator_deallocate(alloc, (void*) work.ready, ready_bytes, 8);
+        allocator_deallocate(alloc, work.ring, ring_bytes, 8);
+    }
+    PROFILE_STOP();
+    return out;
+}
+
+EXTERNAL isize slz4_parallel_decompress_range(void* output, isize from, isize size, const void* input, isize input_size)
+{
+    PROFILE_START();
+    isize out = size;
+    SLZ4_Parallel_Header header = {0};
+    const uint8_t* index = _slz4_parallel_parse(&header, input, input_size);
+    if(index == NULL || from < 0 || size < 0 || (output == NULL && size > 0) || from > (isize) header.raw_size || size > (isize) header.raw_size - from)
+        out = SLZ4_ERROR_INVALID_PARAMS;
+    else if(size > 0) {
+        //Blocks fully inside the range are decompressed right into output. The partial ones at the edges go through a temporary block.
+        isize block_size = header.block_size;
+        isize raw_size = (isize) header.raw_size;
+        uint8_t* temp = NULL;
+        Allocator* alloc = allocator_get_default();
+        for(isize i = from/block_size; i <= (from + size - 1)/block_size; i++) {
+            isize block_from = i*block_size;
+            isize block_to = MIN(block_from + block_size, raw_size);
+            isize copy_from = MAX(block_from, from);
+            isize copy_to = MIN(block_to, from + size);
+            uint8_t* into = (uint8_t*) output + (block_from - from);
+            if(copy_from != block_from || copy_to != block_to) {
+                if(temp == NULL)
+                    temp = (uint8_t*) allocator_allocate(alloc, block_size, 8);
+                into = temp;
+            }
+
+            if(_slz4_parallel_decompress_block((const uint8_t*) input, input_size, index, block_size, raw_size, i, into) == false) {
+                out = SLZ4_ERROR_INVALID_PARAMS;
+                break;
+            }
+
+            if(into == temp)
+                memcpy((uint8_t*) output + (copy_from - from), temp + (copy_from - block_from), copy_to - copy_from);
+        }
+
+        if(temp)
+            allocator_deallocate(alloc, temp, block_size, 8);
+    }
+    PROFILE_STOP();
+    return out;
+}
+
+#endif
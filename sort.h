@@ -4,8 +4,8 @@
 // This file provides a replacement for the `qsort` stdlib.h function in a form of custom sorting functions. 
 // By abusing __forceinline and compiler optimalizations we achieve similar effect to c++ templates. 
 // The calls to comparison function are fully inlined and replaced with efficient assembly, memcpy calls 
-// are replaced with mov instructions. We implement insertion sort, heap sort, quick sort and merge sort as well
-// as few convenience functions. 
+// are replaced with mov instructions. We implement insertion sort, heap sort, quick sort, merge sort and an adaptive
+// power sort for mostly sorted data as well as few convenience functions. 
 // The heapsort and quicksort routines are heavily optimized and reach state of the art performance. 
 // On random integers hqsort is about 20% faster tan MSVC std::sort and on par with pdqsort. On large sizes (> 3000)
 // we use our efficient heapsort implementation and consistently outperform pdqsort by about 20%-30% (as of 9/3/2024).
@@ -14,6 +14,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <stdbool.h>
+#include <math.h>
 
 #ifndef SORT_API
     #if defined(_MSC_VER)
@@ -47,6 +48,40 @@ SORT_API void* merge_sort(void* __restrict input, void* __restrict temp, bool do
 //Merges sorted arrays a and b into output in O(n) time such that output is sorted.
 SORT_API void  merge_sorted(void* __restrict output, const void* a, isize a_len, const void* b, isize b_len, isize item_size, Is_Less_Func is_less, void* context);
 
+// Adaptive stable sort for data which is already mostly sorted. Finds the natural ascending (and strictly descending) runs
+// in the input and merges them using the powersort merge policy with galloping. Sorted or reversed input is sorted in O(n),
+// input made of k runs in O(n log k) and random input in O(n log n).
+// Uses temp which needs to have space for at least one and ideally item_count/2 items. Merges of runs for which temp
+// is too small fall back to slower in-place merging, so any temp_count >= 1 is valid.
+SORT_API void  power_sort(void* items, void* temp, isize temp_count, isize item_count, isize item_size, Is_Less_Func is_less, void* context);
+
+//Rearranges items such that items[nth] is the item which would be there if items were sorted, all items before it are not bigger
+// and all items after are not smaller. Runs in O(n) on average with about n + min(nth, n - nth) comparisons for large n.
+//Uses Floyd-Rivest sampling to pick pivots very close to nth and falls back to heap sort to stay O(n log n) in the worst case.
+SORT_API void  select_nth(void* items, void* space_for_two_items, isize nth, isize item_count, isize item_size, Is_Less_Func is_less, void* context);
+//Sorts only the first sorted_count smallest items into items[0, sorted_count). The order of the rest is unspecified. 
+//Runs in O(n + k log k) for k = sorted_count.
+SORT_API void  partial_sort(void* items, void* space_for_two_items, isize sorted_count, isize item_count, isize item_size, Is_Less_Func is_less, void* context);
+
+//Streaming selection of the capacity smallest items (according to is_less) out of arbitrarily many pushed ones. 
+//To keep the biggest items (such as the best scored) pass is_less which compares in reverse.
+//The items are kept in a heap with the worst kept item on top, so that rejecting an item which would not make it costs a single comparison. 
+//Top_K's filled on separate threads can be combined with top_k_merge.
+typedef struct Top_K {
+    void* items;     //user provided storage for capacity items 
+    isize count;
+    isize capacity;
+    isize item_size;
+} Top_K;
+
+SORT_API Top_K top_k_make(void* storage, isize capacity, isize item_size);
+//Adds item if it is among the capacity smallest seen so far. Returns if the item was kept.
+SORT_API bool  top_k_push(Top_K* top, const void* item, Is_Less_Func is_less, void* context);
+//Pushes all items kept in from into into. Both need to use the same is_less.
+SORT_API void  top_k_merge(Top_K* into, const Top_K* from, Is_Less_Func is_less, void* context);
+//Sorts the kept items from smallest to biggest and returns their count. Afterwards top can no longer be pushed into.
+SORT_API isize top_k_sort(Top_K* top, Is_Less_Func is_less, void* context);
+
 //Binary searches for an index I such that `search_for <= sorted_items[I]` where `I = lower_bound(search_for, sorted_items,...)`. 
 //If no such index exists (search_for is bigger then everything in the sorted_items) then returns item_count.
 SORT_API isize lower_bound(const void* search_for, const void* sorted_items, isize item_count, isize item_size, Is_Less_Func is_less, void* context);
@@ -65,6 +100,22 @@ SORT_API isize lower_bound_no_fail(const void* search_for, const void* sorted_it
 #ifndef HEAP_SORT_TWO_PHASE_BUBBLING_FROM
     #define HEAP_SORT_TWO_PHASE_BUBBLING_FROM 1300
 #endif
+
+//Natural runs shorter than this are extended with insertion sort before merging
+#ifndef POWER_SORT_MIN_RUN
+    #define POWER_SORT_MIN_RUN 32
+#endif
+
+//Ranges bigger than this are narrowed down by select_nth on a sample before partitioning
+#ifndef SELECT_FLOYD_RIVEST_FROM
+    #define SELECT_FLOYD_RIVEST_FROM 600
+#endif
+
+//Number of consecutive items taken from the same run before power_sort switches to galloping.
+//Adapts during the merge, this is only the starting value.
+#ifndef POWER_SORT_MIN_GALLOP
+    #define POWER_SORT_MIN_GALLOP 7
+#endif
 #endif
 
 #if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_SORT)) && !defined(MODULE_HAS_IMPL_SORT)
@@ -463,13 +514,520 @@ SORT_API isize lower_bound_no_fail(const void* search_for, const void* sorted_it
         #undef SORT_MIN
     }
 
+    // Returns the first index I in sorted items such that `search_for < items[I]` if upper else `!(items[I] < search_for)`.
+    // Searches exponentially from the start (or the end if from_end) so that finding index k away costs only O(log k) comparisons.
+    // This is what makes power_sort fast when long stretches of one run go before the other.
+    SORT_API isize _power_sort_gallop(const void* search_for, const void* items, isize item_count, bool upper, bool from_end, isize item_size, Is_Less_Func is_less, void* context)
+    {
+        #define GOES_BEFORE(I) (upper ? !is_less(search_for, AT(I), context) : is_less(AT(I), search_for, context))
+        isize lo = 0;
+        isize hi = item_count;
+        if(from_end == false) {
+            if(item_count == 0 || GOES_BEFORE(0) == false)
+                return 0;
+
+            isize last = 0;
+            isize offset = 1;
+            for(; offset < item_count && GOES_BEFORE(offset); offset = 2*offset + 1)
+                last = offset;
+
+            lo = last + 1;
+            hi = offset < item_count ? offset : item_count;
+        }
+        else {
+            if(item_count == 0 || GOES_BEFORE(item_count - 1))
+                return item_count;
+
+            isize last = 0;
+            isize offset = 1;
+            for(; offset < item_count && GOES_BEFORE(item_count - 1 - offset) == false; offset = 2*offset + 1)
+                last = offset;
+
+            lo = offset < item_count ? item_count - offset : 0;
+            hi = item_count - 1 - last;
+        }
+
+        while(lo < hi) {
+            isize mid = lo + (hi - lo)/2;
+            if(GOES_BEFORE(mid))
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+        #undef GOES_BEFORE
+    }
+
+    SORT_API void _power_sort_reverse(void* items, void* space_for_one_item, isize from, isize to, isize item_size)
+    {
+        for(isize i = from, j = to - 1; i < j; i++, j--)
+            SWAP_DYN(AT(i), AT(j), space_for_one_item);
+    }
+
+    //Merges the sorted runs items[lo, mid) and items[mid, hi) using temp.
+    //The shorter of the two runs is moved to temp and merged towards the end of the longer one.
+    SORT_API void _power_sort_merge_buffered(void* items, void* __restrict temp, isize* min_gallop, isize lo, isize mid, isize hi, isize item_size, Is_Less_Func is_less, void* context)
+    {
+        #define TEMP_AT(I) ((char*) temp + (I)*item_size)
+        isize gallop = *min_gallop;
+        if(mid - lo <= hi - mid)
+        {
+            //Merge forward with a in temp. b is moved in place as dest never overtakes it.
+            isize a_len = mid - lo;
+            isize a = 0;
+            isize b = mid;
+            isize dest = lo;
+            memcpy(temp, AT(lo), a_len*item_size);
+            for(;;) {
+                isize a_count = 0;
+                isize b_count = 0;
+                do {
+                    if(is_less(AT(b), TEMP_AT(a), context)) {
+                        memcpy(AT(dest++), AT(b++), item_size);
+                        b_count += 1;
+                        a_count = 0;
+                        if(b == hi) goto forward_done;
+                    }
+                    else {
+                        memcpy(AT(dest++), TEMP_AT(a++), item_size);
+                        a_count += 1;
+                        b_count = 0;
+                        if(a == a_len) goto forward_done;
+                    }
+                } while(a_count < gallop && b_count < gallop);
+
+                do {
+                    gallop -= gallop > 1;
+                    a_count = _power_sort_gallop(AT(b), TEMP_AT(a), a_len - a, true, false, item_size, is_less, context);
+                    memcpy(AT(dest), TEMP_AT(a), a_count*item_size);
+                    dest += a_count;
+                    a += a_count;
+                    if(a == a_len) goto forward_done;
+
+                    memcpy(AT(dest++), AT(b++), item_size);
+                    if(b == hi) goto forward_done;
+
+                    b_count = _power_sort_gallop(TEMP_AT(a), AT(b), hi - b, false, false, item_size, is_less, context);
+                    memmove(AT(dest), AT(b), b_count*item_size);
+                    dest += b_count;
+                    b += b_count;
+                    if(b == hi) goto forward_done;
+
+                    memcpy(AT(dest++), TEMP_AT(a++), item_size);
+                    if(a == a_len) goto forward_done;
+                } while(a_count >= POWER_SORT_MIN_GALLOP || b_count >= POWER_SORT_MIN_GALLOP);
+                gallop += 2;
+            }
+
+            forward_done:
+            memcpy(AT(dest), TEMP_AT(a), (a_len - a)*item_size);
+        }
+        else
+        {
+            //Merge backward with b in temp. Indices point one past the next item to take.
+            isize b_len = hi - mid;
+            isize a = mid;
+            isize b = b_len;
+            isize dest = hi;
+            memcpy(temp, AT(mid), b_len*item_size);
+            for(;;) {
+                isize a_count = 0;
+                isize b_count = 0;
+                do {
+                    if(is_less(TEMP_AT(b - 1), AT(a - 1), context)) {
+                        memcpy(AT(--dest), AT(--a), item_size);
+                        a_count += 1;
+                        b_count = 0;
+                        if(a == lo) goto backward_done;
+                    }
+                    else {
+                        memcpy(AT(--dest), TEMP_AT(--b), item_size);
+                        b_count += 1;
+                        a_count = 0;
+                        if(b == 0) goto backward_done;
+                    }
+                } while(a_count < gallop && b_count < gallop);
+
+                do {
+                    gallop -= gallop > 1;
+                    a_count = (a - lo) - _power_sort_gallop(TEMP_AT(b - 1), AT(lo), a - lo, true, true, item_size, is_less, context);
+                    dest -= a_count;
+                    a -= a_count;
+                    memmove(AT(dest), AT(a), a_count*item_size);
+                    if(a == lo) goto backward_done;
+
+                    memcpy(AT(--dest), TEMP_AT(--b), item_size);
+                    if(b == 0) goto backward_done;
+
+                    b_count = b - _power_sort_gallop(AT(a - 1), temp, b, false, true, item_size, is_less, context);
+                    dest -= b_count;
+                    b -= b_count;
+                    memcpy(AT(dest), TEMP_AT(b), b_count*item_size);
+                    if(b == 0) goto backward_done;
+
+                    memcpy(AT(--dest), AT(--a), item_size);
+                    if(a == lo) goto backward_done;
+                } while(a_count >= POWER_SORT_MIN_GALLOP || b_count >= POWER_SORT_MIN_GALLOP);
+                gallop += 2;
+            }
+
+            backward_done:
+            memcpy(AT(lo), temp, b*item_size);
+        }
+
+        *min_gallop = gallop;
+        #undef TEMP_AT
+    }
+
+    //Merges the sorted runs items[lo, mid) and items[mid, hi). When the shorter of the two does not fit into temp
+    // splits the problem in two by rotation (as in the classic in-place merge) until the pieces do.
+    SORT_API void _power_sort_merge(void* items, void* temp, isize temp_count, isize* min_gallop, isize lo, isize mid, isize hi, isize item_size, Is_Less_Func is_less, void* context)
+    {
+        //Each split at least halves the longer run so the depth is bounded by twice the bit count of isize
+        isize stack[2*64*3];
+        isize stack_count = 0;
+        for(;;) {
+            //Skip the items which are already in place: the start of a smaller than the first item in b
+            // and the end of b bigger than the last item of a
+            lo += _power_sort_gallop(AT(mid), AT(lo), mid - lo, true, false, item_size, is_less, context);
+            if(lo < mid)
+                hi = mid + _power_sort_gallop(AT(mid - 1), AT(mid), hi - mid, false, true, item_size, is_less, context);
+
+            if(lo < mid && mid < hi) {
+                isize a_len = mid - lo;
+                isize b_len = hi - mid;
+                if(a_len <= temp_count || b_len <= temp_count)
+                    _power_sort_merge_buffered(items, temp, min_gallop, lo, mid, hi, item_size, is_less, context);
+                else {
+                    isize cut_a = 0;
+                    isize cut_b = 0;
+                    if(a_len >= b_len) {
+                        cut_a = lo + a_len/2;
+                        cut_b = mid + _power_sort_gallop(AT(cut_a), AT(mid), b_len, false, false, item_size, is_less, context);
+                    }
+                    else {
+                        cut_b = mid + b_len/2;
+                        cut_a = lo + _power_sort_gallop(AT(cut_b), AT(lo), a_len, true, false, item_size, is_less, context);
+                    }
+
+                    //rotate [cut_a, mid) and [mid, cut_b)
+                    _power_sort_reverse(items, temp, cut_a, mid, item_size);
+                    _power_sort_reverse(items, temp, mid, cut_b, item_size);
+                    _power_sort_reverse(items, temp, cut_a, cut_b, item_size);
+
+                    isize new_mid = cut_a + (cut_b - mid);
+                    ASSERT(stack_count + 3 <= (isize) (sizeof stack / sizeof *stack));
+                    stack[stack_count++] = new_mid;
+                    stack[stack_count++] = cut_b;
+                    stack[stack_count++] = hi;
+                    mid = cut_a;
+                    hi = new_mid;
+                    continue;
+                }
+            }
+
+            if(stack_count == 0)
+                break;
+
+            hi = stack[--stack_count];
+            mid = stack[--stack_count];
+            lo = stack[--stack_count];
+        }
+    }
+
+    //Returns the end of the run starting at from. Strictly descending runs are reversed so that the result is always ascending.
+    //Runs shorter than POWER_SORT_MIN_RUN are extended using insertion sort.
+    SORT_API isize _power_sort_next_run(void* items, void* space_for_one_item, isize from, isize item_count, isize item_size, Is_Less_Func is_less, void* context)
+    {
+        isize to = from + 1;
+        if(to < item_count) {
+            if(is_less(AT(to), AT(from), context)) {
+                while(to + 1 < item_count && is_less(AT(to + 1), AT(to), context))
+                    to += 1;
+                to += 1;
+                _power_sort_reverse(items, space_for_one_item, from, to, item_size);
+            }
+            else {
+                while(to + 1 < item_count && is_less(AT(to + 1), AT(to), context) == false)
+                    to += 1;
+                to += 1;
+            }
+        }
+
+        if(to - from < POWER_SORT_MIN_RUN && to < item_count) {
+            //the sorted prefix costs just one comparison per item
+            to = from + POWER_SORT_MIN_RUN < item_count ? from + POWER_SORT_MIN_RUN : item_count;
+            insertion_sort(AT(from), space_for_one_item, to - from, item_size, is_less, context);
+        }
+        return to;
+    }
+
+    //The powersort merge policy: the power of the boundary between two adjacent runs is the depth at which
+    // the boundary would be in a perfectly balanced merge tree over the whole array. See https://arxiv.org/abs/1805.04154.
+    SORT_API isize _power_sort_node_power(isize a_from, isize a_len, isize b_len, isize item_count)
+    {
+        //midpoints of a and b times two, compared as binary fractions of item_count
+        isize a = 2*a_from + a_len;
+        isize b = a + a_len + b_len;
+        isize power = 0;
+        for(;;) {
+            power += 1;
+            if(a >= item_count) {
+                a -= item_count;
+                b -= item_count;
+            }
+            else if(b >= item_count)
+                break;
+
+            a <<= 1;
+            b <<= 1;
+        }
+        return power;
+    }
+
+    SORT_API void power_sort(void* items, void* temp, isize temp_count, isize item_count, isize item_size, Is_Less_Func is_less, void* context)
+    {
+        REQUIRE(item_count >= 0 && item_size > 0 && (item_count == 0 || (items && temp && temp_count > 0 && is_less)));
+        if(item_count <= 1)
+            return;
+
+        //Pending runs. Their powers are strictly increasing towards the top so there can be at most one per bit.
+        typedef struct {
+            isize from;
+            isize power;
+        } Power_Sort_Run;
+
+        Power_Sort_Run stack[66];
+        isize stack_count = 0;
+        isize min_gallop = POWER_SORT_MIN_GALLOP;
+
+        isize a_from = 0;
+        isize a_to = _power_sort_next_run(items, temp, 0, item_count, item_size, is_less, context);
+        for(;;) {
+            //When we reach the end power 0 merges all remaining runs
+            isize b_to = a_to;
+            isize power = 0;
+            if(a_to < item_count) {
+                b_to = _power_sort_next_run(items, temp, a_to, item_count, item_size, is_less, context);
+                power = _power_sort_node_power(a_from, a_to - a_from, b_to - a_to, item_count);
+            }
+
+            while(stack_count > 0 && stack[stack_count - 1].power > power) {
+                Power_Sort_Run top = stack[--stack_count];
+                _power_sort_merge(items, temp, temp_count, &min_gallop, top.from, a_from, a_to, item_size, is_less, context);
+                a_from = top.from;
+            }
+
+            if(a_to >= item_count)
+                break;
+
+            ASSERT(stack_count < (isize) (sizeof stack / sizeof *stack));
+            Power_Sort_Run run = {a_from, power};
+            stack[stack_count++] = run;
+            a_from = a_to;
+            a_to = b_to;
+        }
+    }
+
+    SORT_API void select_nth(void* items, void* space_for_two_items, isize nth, isize item_count, isize item_size, Is_Less_Func is_less, void* context)
+    {
+        REQUIRE(item_count >= 0 && item_size > 0 && (item_count == 0 || (items && space_for_two_items && is_less && 0 <= nth && nth < item_count)));
+
+        // This is the Floyd-Rivest algorithm (https://en.wikipedia.org/wiki/Floyd%E2%80%93Rivest_algorithm).
+        // It is quickselect except that for big ranges it first recursively selects within a small sample of items
+        // around the position where nth is expected to be. The result is used as a pivot which then lands very close to nth
+        // so the next range is tiny. The sample size is n^(2/3) so the recursion depth is tiny as well.
+        //
+        // As in quick_sort we cannot use real recursion without losing the inlining so we keep an explicit stack
+        // of the ranges we sampled from. Once the sample range is done we return to partitioning the parent range.
+        isize los[16]; (void) los;
+        isize his[16]; (void) his;
+        isize unbalances[16]; (void) unbalances;
+        isize depth = 0;
+        bool sampled = false;
+
+        void* pivot = space_for_two_items;
+        void* swap_space = (char*) space_for_two_items + item_size;
+
+        //Safeguard against pathological inputs: just like quick_sort we allow at maximum log2_n partitions
+        // which fail to shrink the range by at least 1/8. After that we heap sort the remaining range.
+        isize log2_n = 0;
+        {
+            isize n_copy = item_count;
+            while (n_copy >>= 1) ++log2_n;
+        }
+        isize unbalanced = log2_n;
+
+        isize lo = 0;
+        isize hi = item_count - 1;
+        isize k = nth;
+        while(item_count > 0)
+        {
+            isize size = hi - lo + 1;
+            if(size > SELECT_FLOYD_RIVEST_FROM && sampled == false && depth < 16)
+            {
+                double n = (double) size;
+                double i = (double) (k - lo + 1);
+                double z = log(n);
+                double s = 0.5*exp(2*z/3);
+                double sd = 0.5*sqrt(z*s*(n - s)/n)*(i < n/2 ? -1 : 1);
+                isize sample_lo = (isize) ((double) k - i*s/n + sd);
+                isize sample_hi = (isize) ((double) k + (n - i)*s/n + sd);
+
+                los[depth] = lo;
+                his[depth] = hi;
+                unbalances[depth] = unbalanced;
+                depth += 1;
+                lo = sample_lo < lo ? lo : sample_lo > k ? k : sample_lo;
+                hi = sample_hi > hi ? hi : sample_hi < k ? k : sample_hi;
+                continue;
+            }
+
+            bool range_done = true;
+            if(size <= INSERTION_SORT_TO)
+                insertion_sort(AT(lo), swap_space, size, item_size, is_less, context);
+            else if(unbalanced <= 0)
+                heap_sort(AT(lo), swap_space, size, item_size, is_less, context);
+            else
+            {
+                //Small ranges are not sampled so we use median of three as the pivot instead
+                if(sampled == false) {
+                    isize i = lo, j = lo + (hi - lo)/2, m = hi;
+                    if (is_less(AT(m), AT(i), context)) SWAP_DYN(AT(m), AT(i), swap_space);
+                    if (is_less(AT(j), AT(i), context)) SWAP_DYN(AT(j), AT(i), swap_space);
+                    if (is_less(AT(m), AT(j), context)) SWAP_DYN(AT(m), AT(j), swap_space);
+                    SWAP_DYN(AT(j), AT(k), swap_space);
+                }
+
+                //Partition around items[k]. It is placed at lo or hi first so that it acts as a sentinel for both inner loops.
+                memcpy(pivot, AT(k), item_size);
+                SWAP_DYN(AT(lo), AT(k), swap_space);
+                if(is_less(pivot, AT(hi), context))
+                    SWAP_DYN(AT(hi), AT(lo), swap_space);
+
+                isize i = lo;
+                isize j = hi;
+                while(i < j) {
+                    SWAP_DYN(AT(i), AT(j), swap_space);
+                    i++;
+                    j--;
+                    while(is_less(AT(i), pivot, context))
+                        i++;
+                    while(is_less(pivot, AT(j), context))
+                        j--;
+                }
+
+                //items[lo] is never bigger than pivot so this checks equality
+                if(is_less(AT(lo), pivot, context) == false)
+                    SWAP_DYN(AT(lo), AT(j), swap_space);
+                else {
+                    j++;
+                    SWAP_DYN(AT(j), AT(hi), swap_space);
+                }
+
+                if(j <= k)
+                    lo = j + 1;
+                if(k <= j)
+                    hi = j - 1;
+                unbalanced -= (uint64_t) (hi - lo + 1) > (uint64_t) size/8*7;
+                range_done = lo >= hi;
+            }
+
+            if(range_done)
+            {
+                if(depth == 0)
+                    break;
+
+                depth -= 1;
+                lo = los[depth];
+                hi = his[depth];
+                unbalanced = unbalances[depth];
+                sampled = true;
+            }
+            else
+                sampled = false;
+        }
+    }
+
+    SORT_API void partial_sort(void* items, void* space_for_two_items, isize sorted_count, isize item_count, isize item_size, Is_Less_Func is_less, void* context)
+    {
+        REQUIRE(sorted_count >= 0 && item_count >= 0);
+        if(sorted_count > item_count)
+            sorted_count = item_count;
+        if(sorted_count <= 0)
+            return;
+
+        if(sorted_count < item_count)
+            select_nth(items, space_for_two_items, sorted_count - 1, item_count, item_size, is_less, context);
+        quick_sort(items, space_for_two_items, HEAP_SORT_FROM, sorted_count, item_size, is_less, context);
+    }
+
+    SORT_API Top_K top_k_make(void* storage, isize capacity, isize item_size)
+    {
+        REQUIRE(capacity >= 0 && item_size > 0 && (capacity == 0 || storage));
+        Top_K top = {storage, 0, capacity, item_size};
+        return top;
+    }
+
+    SORT_API bool top_k_push(Top_K* top, const void* item, Is_Less_Func is_less, void* context)
+    {
+        void* items = top->items;
+        isize item_size = top->item_size;
+        isize hole = 0;
+        if(top->count < top->capacity)
+        {
+            //Bubble up from the new last position
+            hole = top->count++;
+            for(isize parent = (hole - 1)/2; hole > 0 && is_less(AT(parent), item, context); parent = (hole - 1)/2) {
+                memcpy(AT(hole), AT(parent), item_size);
+                hole = parent;
+            }
+        }
+        else
+        {
+            if(top->capacity == 0 || is_less(item, AT(0), context) == false)
+                return false;
+
+            //Replace the worst kept item and bubble down
+            for(;;) {
+                isize child = 2*hole + 1;
+                if(child >= top->count)
+                    break;
+                if(child + 1 < top->count && is_less(AT(child), AT(child + 1), context))
+                    child += 1;
+                if(is_less(item, AT(child), context) == false)
+                    break;
+
+                memcpy(AT(hole), AT(child), item_size);
+                hole = child;
+            }
+        }
+
+        memcpy(AT(hole), item, item_size);
+        return true;
+    }
+
+    SORT_API void top_k_merge(Top_K* into, const Top_K* from, Is_Less_Func is_less, void* context)
+    {
+        REQUIRE(into->item_size == from->item_size);
+        for(isize i = 0; i < from->count; i++)
+            top_k_push(into, (char*) from->items + i*from->item_size, is_less, context);
+    }
+
+    SORT_API isize top_k_sort(Top_K* top, Is_Less_Func is_less, void* context)
+    {
+        hqsort(top->items, top->count, top->item_size, is_less, context);
+        return top->count;
+    }
+
 #undef AT
 #undef SWAP_DYN
 
 #endif
 
 //================== TESTS =======================
-#if defined(MODULE_TEST_SORT) || defined(MODULE_ALL_TEST) 
+#if (defined(MODULE_TEST_SORT) || defined(MODULE_ALL_TEST)) && !defined(MODULE_HAS_TEST_SORT)
+#define MODULE_HAS_TEST_SORT
     static bool _sort_test_i32_less(const void* a, const void* b, void* context)
     {
         (void) context;
@@ -498,6 +1056,17 @@ SORT_API isize lower_bound_no_fail(const void* search_for, const void* sorted_it
         return strcmp(av, bv);
     }
 
+    typedef struct _Sort_Test_Pair {
+        int32_t key;
+        int32_t index;
+    } _Sort_Test_Pair;
+
+    static bool _sort_test_pair_less(const void* a, const void* b, void* context)
+    {
+        (void) context;
+        return ((_Sort_Test_Pair*) a)->key < ((_Sort_Test_Pair*) b)->key;
+    }
+
     int _sort_rand_exponential_distribution(int max_log2, float jitter_ammount)
     {
         int rand_log2 = rand() % max_log2;
@@ -573,6 +1142,12 @@ SORT_API isize lower_bound_no_fail(const void* search_for, const void* sorted_it
                 hqsort(items_sorted, size, sizeof(int32_t), _sort_test_i32_less, NULL);
                 TEST(memcmp(items_refernce_sorted, items_sorted, bytes) == 0);
 
+                //small temp to exercise the in-place merge fallback as well
+                isize temp_count = rand() % 2 ? size/2 + 1 : rand() % 8 + 1;
+                memcpy(items_sorted, items_randomized, bytes);
+                power_sort(items_sorted, items_temp, temp_count, size, sizeof(int32_t), _sort_test_i32_less, NULL);
+                TEST(memcmp(items_refernce_sorted, items_sorted, bytes) == 0);
+
                 //lower bound tests
                 if(size > 0)
                 {   
@@ -603,6 +1178,36 @@ SORT_API isize lower_bound_no_fail(const void* search_for, const void* sorted_it
                     isize should_be_size = lower_bound(&any, items_sorted, size, sizeof(int32_t), _sort_test_i32_less, NULL);
                     TEST(should_be_size == size);
                 }
+
+                //selection
+                if(size > 0)
+                {
+                    int32_t* reference_val = (int32_t*) items_refernce_sorted;
+                    int32_t* sorted_val = (int32_t*) items_sorted;
+                    int nth = rand() % size;
+                    memcpy(items_sorted, items_randomized, bytes);
+                    select_nth(items_sorted, items_temp, nth, size, sizeof(int32_t), _sort_test_i32_less, NULL);
+                    TEST(sorted_val[nth] == reference_val[nth]);
+                    for(int i = 0; i < size; i++)
+                        TEST(i < nth ? sorted_val[i] <= sorted_val[nth] : sorted_val[i] >= sorted_val[nth]);
+
+                    memcpy(items_sorted, items_randomized, bytes);
+                    partial_sort(items_sorted, items_temp, nth, size, sizeof(int32_t), _sort_test_i32_less, NULL);
+                    TEST(memcmp(items_refernce_sorted, items_sorted, (size_t) nth*sizeof(int32_t)) == 0);
+
+                    //top k split into two halves as if filled by two threads and merged
+                    int capacity = rand() % 300;
+                    Top_K halves[2] = {
+                        top_k_make(items_sorted, capacity, sizeof(int32_t)),
+                        top_k_make(sorted_val + capacity, capacity, sizeof(int32_t)),
+                    };
+                    int32_t* input_val = (int32_t*) items_randomized;
+                    for(int i = 0; i < size; i++)
+                        top_k_push(&halves[i % 2], &input_val[i], _sort_test_i32_less, NULL);
+                    top_k_merge(&halves[0], &halves[1], _sort_test_i32_less, NULL);
+                    TEST(top_k_sort(&halves[0], _sort_test_i32_less, NULL) == (capacity < size ? capacity : size));
+                    TEST(memcmp(items_refernce_sorted, items_sorted, (size_t) halves[0].count*sizeof(int32_t)) == 0);
+                }
             }
 
             //cstring
@@ -635,6 +1240,35 @@ SORT_API isize lower_bound_no_fail(const void* search_for, const void* sorted_it
                 memcpy(items_sorted, items_randomized, bytes);
                 hqsort(items_sorted, size, sizeof(const char*), _sort_test_cstring_less, NULL);
                 TEST(memcmp(items_refernce_sorted, items_sorted, bytes) == 0);
+
+                memcpy(items_sorted, items_randomized, bytes);
+                power_sort(items_sorted, items_temp, size/2 + 1, size, sizeof(const char*), _sort_test_cstring_less, NULL);
+                TEST(memcmp(items_refernce_sorted, items_sorted, bytes) == 0);
+            }
+
+            //power_sort on partially sorted inputs. Checks stability by sorting (key, index) pairs by key only.
+            {
+                int size = _sort_rand_exponential_distribution(MAX_SIZE_LOG2, 0.5)/(int)sizeof(_Sort_Test_Pair);
+                int pattern = rand() % 5;
+                int modulo = rand() % 1000 + 1;
+                _Sort_Test_Pair* items_val = (_Sort_Test_Pair*) items_sorted;
+                for(int i = 0; i < size; i++) {
+                    switch(pattern) {
+                        case 0:  items_val[i].key = rand() % modulo; break;   //random with duplicates
+                        case 1:  items_val[i].key = i / 4; break;             //sorted
+                        case 2:  items_val[i].key = (size - i) / 4; break;    //reversed
+                        case 3:  items_val[i].key = i % modulo; break;        //sawtooth
+                        default: items_val[i].key = rand() % 100 == 0 ? rand() % (size + 1) : i; break; //mostly sorted
+                    }
+                    items_val[i].index = i;
+                }
+
+                isize temp_count = rand() % 2 ? size/2 + 1 : rand() % 8 + 1;
+                power_sort(items_sorted, items_temp, temp_count, size, sizeof(_Sort_Test_Pair), _sort_test_pair_less, NULL);
+                for(int i = 1; i < size; i++) {
+                    TEST(items_val[i - 1].key <= items_val[i].key);
+                    TEST(items_val[i - 1].key < items_val[i].key || items_val[i - 1].index < items_val[i].index);
+                }
             }
         }
     
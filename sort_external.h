@@ -0,0 +1,616 @@
+#ifndef MODULE_SORT_EXTERNAL
+#define MODULE_SORT_EXTERNAL
+
+//Sorting of files of fixed size records which are larger than the available memory.
+//
+//This is the classic external merge sort done in two phases:
+// 1. Runs: the input is read in chunks of about a third of memory_budget. Each chunk is sorted in memory with hqsort
+//    and written into a temporary file as a run, split into blocks of block_size bytes which are optionally compressed
+//    with slz4. We keep three chunk buffers so that reading of the next chunk, sorting of the current one and writing
+//    of the previous one all happen at the same time.
+// 2. Merge: all runs are merged at once using a loser tree. Each run has two block sized buffers: one being merged
+//    and one being read (and decompressed) in the background. The merged output goes through two buffers the same way.
+//    Merging k runs this way needs 2(k + 1) blocks of memory. If there are more runs than that fits into memory_budget
+//    we first merge the oldest runs into bigger ones (written back to the temporary file) until they do fit.
+//
+//All reading, writing and compression is done as jobs on io_threads background threads (plain blocking reads and writes
+// at explicit offsets, so the only asynchronicity is that of the threads). The calling thread only sorts and merges.
+// With io_threads < 0 the jobs are done directly on the calling thread instead, which is useful for debugging.
+//
+//The loser tree needs only log2(k) comparisons per item, one per level, as the winner of each match was already decided
+// and only the path from the leaf of the item which was just taken to the root needs to be replayed.
+//
+//The sort is not stable since runs are sorted with hqsort. Ties between runs are broken by run order.
+//The temporary file is removed once the sort finishes. It may grow up to the size of the input times the number
+// of merge passes as the space of already merged runs is not reused.
+
+#include "defines.h"
+#include "assert.h"
+#include "profile.h"
+#include "allocator.h"
+#include "platform.h"
+#include "parallel.h"
+#include "channel.h"
+#include "slz4.h"
+#include "sort.h"
+
+#ifndef EXTERNAL_SORT_DEFAULT_MEMORY
+    #define EXTERNAL_SORT_DEFAULT_MEMORY (256*1024*1024)
+#endif
+#ifndef EXTERNAL_SORT_DEFAULT_BLOCK
+    #define EXTERNAL_SORT_DEFAULT_BLOCK  (1024*1024)
+#endif
+#define EXTERNAL_SORT_MAX_IO_THREADS 64
+
+typedef struct External_Sort_Options {
+    Allocator* allocator_or_null;   //used for all buffers. If NULL uses the default allocator.
+    isize memory_budget;            //approximate amount of memory used in bytes. 0 means EXTERNAL_SORT_DEFAULT_MEMORY
+    isize block_size;               //unit of reading, writing and compression in bytes. 0 means EXTERNAL_SORT_DEFAULT_BLOCK
+    isize io_threads;               //number of background threads doing reading, writing and compression. 0 means 2. Negative means none.
+    bool compress_runs;             //compresses the runs with slz4. Trades CPU time for less disk traffic.
+    Platform_String temp_path;      //path of the temporary file. If empty uses output path with ".runs" appended.
+} External_Sort_Options;
+
+typedef struct External_Sort_Stats {
+    isize item_count;
+    isize run_count;                //number of runs created in the first phase
+    isize merge_passes;             //number of merges done. 1 if all runs fit into memory at once.
+    isize temp_bytes_written;       //total bytes written to the temporary file (after compression)
+} External_Sort_Stats;
+
+typedef enum External_Sort_Error {
+    EXTERNAL_SORT_OK = 0,
+    EXTERNAL_SORT_ERROR_IO,         //a file could not be opened/read/written. See the platform error for details
+    EXTERNAL_SORT_ERROR_INVALID,    //the input size is not a multiple of item_size or the options are invalid
+    EXTERNAL_SORT_ERROR_CORRUPTED,  //a compressed block of the temporary file failed to decompress
+} External_Sort_Error;
+
+//Sorts the item_size sized records of input_path from smallest to biggest according to is_less and writes them to output_path.
+//Input and output must be different files. options_or_null and stats_or_null can be NULL.
+EXTERNAL External_Sort_Error external_sort_file(Platform_String output_path, Platform_String input_path, isize item_size, Is_Less_Func is_less, void* context,
+    const External_Sort_Options* options_or_null, External_Sort_Stats* stats_or_null, Platform_Error* error_or_null);
+EXTERNAL const char* external_sort_error_to_string(External_Sort_Error error);
+#endif
+
+#if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_SORT_EXTERNAL)) && !defined(MODULE_HAS_IMPL_SORT_EXTERNAL)
+#define MODULE_HAS_IMPL_SORT_EXTERNAL
+
+typedef struct _External_Sort_Block {
+    isize offset;           //in the temporary file
+    int32_t stored_size;    //equal to raw_size if the block is not compressed
+    int32_t raw_size;
+} _External_Sort_Block;
+
+typedef struct _External_Sort_Run {
+    _External_Sort_Block* blocks;
+    isize block_count;
+    isize item_count;
+} _External_Sort_Run;
+
+typedef enum _External_Sort_Job_Kind {
+    _EXTERNAL_SORT_JOB_QUIT = 0,
+    _EXTERNAL_SORT_JOB_READ,            //reads size bytes at offset of file into data
+    _EXTERNAL_SORT_JOB_WRITE,           //writes size bytes of data at offset of file
+    _EXTERNAL_SORT_JOB_READ_BLOCK,      //reads block from the temporary file into data, decompressing it if needed
+    _EXTERNAL_SORT_JOB_WRITE_BLOCKS,    //splits size bytes of data into blocks, compresses them and appends them to the temporary file
+} _External_Sort_Job_Kind;
+
+typedef struct _External_Sort_Job {
+    _External_Sort_Job_Kind kind;
+    PLATFORM_ATOMIC(uint32_t) pending;
+    Platform_File* file;
+    uint8_t* data;
+    isize size;
+    isize offset;
+    _External_Sort_Block block;         //READ_BLOCK
+    _External_Sort_Block* blocks;       //WRITE_BLOCKS: receives the written blocks. Needs space for size/block_size rounded up.
+} _External_Sort_Job;
+
+typedef struct _External_Sort {
+    Allocator* alloc;
+    isize item_size;
+    Is_Less_Func is_less;
+    void* context;
+    isize block_size;
+    bool compress;
+    bool _[7];
+
+    Platform_File temp;
+    PLATFORM_ATOMIC(int64_t) temp_size;         //writers reserve space at the end of the temporary file by adding to this
+    PLATFORM_ATOMIC(uint32_t) error;            //first External_Sort_Error of any job
+    PLATFORM_ATOMIC(uint32_t) platform_error;   //and its Platform_Error
+
+    Channel* jobs;                              //NULL if there are no io threads
+    isize io_threads;
+    isize staging_size;
+    uint8_t* staging[EXTERNAL_SORT_MAX_IO_THREADS + 1]; //for compressed data. One per io thread (the last is for the calling thread)
+    Parallel_Group io_group;
+} _External_Sort;
+
+#define _EXTERNAL_SORT_CHANNEL_INFO SINIT(Channel_Info){sizeof(_External_Sort_Job*), chan_wait_block, chan_wake_block}
+
+INTERNAL void _external_sort_fail(_External_Sort* sort, External_Sort_Error error, Platform_Error platform_error)
+{
+    uint32_t none = EXTERNAL_SORT_OK;
+    if(atomic_compare_exchange_strong(&sort->error, &none, (uint32_t) error))
+        atomic_store(&sort->platform_error, platform_error);
+}
+
+INTERNAL void _external_sort_do_job(_External_Sort* sort, _External_Sort_Job* job, isize worker_index)
+{
+    Platform_Error error = 0;
+    uint8_t* staging = sort->staging[worker_index];
+    switch(job->kind) {
+        case _EXTERNAL_SORT_JOB_READ: {
+            error = platform_file_read(job->file, job->data, job->size, job->offset, NULL);
+        } break;
+
+        case _EXTERNAL_SORT_JOB_WRITE: {
+            error = platform_file_write(job->file, job->data, job->size, job->offset);
+        } break;
+
+        case _EXTERNAL_SORT_JOB_READ_BLOCK: {
+            _External_Sort_Block block = job->block;
+            if(block.stored_size == block.raw_size)
+                error = platform_file_read(&sort->temp, job->data, block.raw_size, block.offset, NULL);
+            else {
+                error = platform_file_read(&sort->temp, staging, block.stored_size, block.offset, NULL);
+                if(error == 0 && slz4_decompress(job->data, block.raw_size, staging, block.stored_size, NULL) != block.raw_size)
+                    _external_sort_fail(sort, EXTERNAL_SORT_ERROR_CORRUPTED, 0);
+            }
+        } break;
+
+        case _EXTERNAL_SORT_JOB_WRITE_BLOCKS: {
+            isize block_count = 0;
+            for(isize from = 0; from < job->size && error == 0; from += sort->block_size) {
+                _External_Sort_Block block = {0};
+                block.raw_size = (int32_t) MIN(sort->block_size, job->size - from);
+                block.stored_size = block.raw_size;
+
+                const uint8_t* stored = job->data + from;
+                if(sort->compress) {
+                    int compressed = slz4_compress(staging, (int) sort->staging_size, stored, block.raw_size, NULL);
+                    if(0 < compressed && compressed < block.raw_size) {
+                        block.stored_size = compressed;
+                        stored = staging;
+                    }
+                }
+
+                block.offset = atomic_fetch_add(&sort->temp_size, block.stored_size);
+                error = platform_file_write(&sort->temp, stored, block.stored_size, block.offset);
+                job->blocks[block_count++] = block;
+            }
+        } break;
+
+        default: UNREACHABLE();
+    }
+
+    if(error)
+        _external_sort_fail(sort, EXTERNAL_SORT_ERROR_IO, error);
+
+    atomic_store(&job->pending, 0);
+    platform_futex_wake_all(&job->pending);
+}
+
+INTERNAL void _external_sort_worker_func(void* context, isize thread_index)
+{
+    _External_Sort* sort = (_External_Sort*) context;
+    for(;;) {
+        _External_Sort_Job* job = NULL;
+        channel_pop(sort->jobs, &job, _EXTERNAL_SORT_CHANNEL_INFO);
+        if(job->kind == _EXTERNAL_SORT_JOB_QUIT)
+            break;
+        _external_sort_do_job(sort, job, thread_index);
+    }
+}
+
+INTERNAL void _external_sort_submit(_External_Sort* sort, _External_Sort_Job* job)
+{
+    atomic_store(&job->pending, 1);
+    if(sort->jobs)
+        channel_push(sort->jobs, &job, _EXTERNAL_SORT_CHANNEL_INFO);
+    else
+        _external_sort_do_job(sort, job, sort->io_threads);
+}
+
+//Waits for the job to finish (or returns right away if it was never submitted). Returns false if any job failed so far.
+INTERNAL bool _external_sort_wait(_External_Sort* sort, _External_Sort_Job* job)
+{
+    for(uint32_t pending = 0; (pending = atomic_load(&job->pending)) != 0; )
+        platform_futex_wait(&job->pending, pending, -1);
+    return atomic_load(&sort->error) == EXTERNAL_SORT_OK;
+}
+
+INTERNAL void _external_sort_read_chunk(_External_Sort* sort, _External_Sort_Job* job, Platform_File* input, uint8_t* into, isize offset, isize size)
+{
+    job->kind = _EXTERNAL_SORT_JOB_READ;
+    job->file = input;
+    job->data = into;
+    job->offset = offset;
+    job->size = size;
+    _external_sort_submit(sort, job);
+}
+
+typedef struct _External_Sort_Reader {
+    const _External_Sort_Run* run;
+    uint8_t* buffers[2];            //block i is read into buffers[i % 2]
+    _External_Sort_Job jobs[2];
+    isize requested;                //number of blocks submitted for reading
+    isize consumed;                 //number of blocks fully merged
+    uint8_t* at;                    //NULL once the run is exhausted
+    uint8_t* end;
+} _External_Sort_Reader;
+
+INTERNAL void _external_sort_reader_request(_External_Sort* sort, _External_Sort_Reader* reader)
+{
+    if(reader->requested < reader->run->block_count) {
+        _External_Sort_Job* job = &reader->jobs[reader->requested % 2];
+        job->kind = _EXTERNAL_SORT_JOB_READ_BLOCK;
+        job->data = reader->buffers[reader->requested % 2];
+        job->block = reader->run->blocks[reader->requested];
+        _external_sort_submit(sort, job);
+        reader->requested += 1;
+    }
+}
+
+//Moves reader to its next block. Requests the block after it into the buffer which was just freed.
+INTERNAL bool _external_sort_reader_next_block(_External_Sort* sort, _External_Sort_Reader* reader)
+{
+    isize block = reader->consumed;
+    reader->at = NULL;
+    reader->end = NULL;
+    if(block < reader->run->block_count) {
+        if(_external_sort_wait(sort, &reader->jobs[block % 2]) == false)
+            return false;
+        reader->at = reader->buffers[block % 2];
+        reader->end = reader->at + reader->run->blocks[block].raw_size;
+    }
+    return true;
+}
+
+//Returns true if the current item of reader a goes before the one of reader b. Exhausted readers lose to everything.
+INTERNAL bool _external_sort_beats(const _External_Sort* sort, const _External_Sort_Reader* readers, isize a, isize b)
+{
+    if(readers[a].at == NULL)
+        return false;
+    if(readers[b].at == NULL)
+        return true;
+    if(a < b)
+        return sort->is_less(readers[b].at, readers[a].at, sort->context) == false;
+    else
+        return sort->is_less(readers[a].at, readers[b].at, sort->context);
+}
+
+//Merges the runs into the output file at offset 0 (if into_run is NULL) or into a new run into_run in the temporary file.
+INTERNAL void _external_sort_merge(_External_Sort* sort, const _External_Sort_Run* runs, isize run_count, Platform_File* output, _External_Sort_Run* into_run)
+{
+    PROFILE_START();
+    isize k = run_count;
+    isize memory_size = k*sizeof(_External_Sort_Reader) + 3*k*sizeof(isize) + (2*k + 2)*sort->block_size;
+    uint8_t* memory = (uint8_t*) allocator_allocate(sort->alloc, memory_size, 8);
+    _External_Sort_Reader* readers = (_External_Sort_Reader*) (void*) memory;
+    isize* tree = (isize*) (void*) (readers + k);   //tree[0] is the overall winner, tree[1, k) the losers of matches at inner nodes
+    isize* winners = tree + k;                      //only used while building the tree. Leaves are at [k, 2k)
+    uint8_t* block_memory = (uint8_t*) (winners + 2*k);
+    memset(readers, 0, k*sizeof(_External_Sort_Reader));
+
+    _External_Sort_Job out_jobs[2] = {0};
+    uint8_t* out_buffers[2] = {block_memory + 2*k*sort->block_size, block_memory + (2*k + 1)*sort->block_size};
+    isize out_current = 0;
+    isize out_used = 0;
+    isize out_offset = 0;
+    isize out_blocks = 0;
+    isize total_items = 0;
+    bool ok = true;
+
+    //Request the first two blocks of every run before waiting on any so that they are all read at once
+    for(isize i = 0; i < k; i++) {
+        _External_Sort_Reader* reader = &readers[i];
+        reader->run = &runs[i];
+        reader->buffers[0] = block_memory + 2*i*sort->block_size;
+        reader->buffers[1] = block_memory + (2*i + 1)*sort->block_size;
+        total_items += runs[i].item_count;
+        _external_sort_reader_request(sort, reader);
+        _external_sort_reader_request(sort, reader);
+    }
+
+    if(into_run) {
+        into_run->item_count = total_items;
+        into_run->block_count = 0;
+        into_run->blocks = (_External_Sort_Block*) allocator_allocate(sort->alloc, (total_items*sort->item_size/sort->block_size + 1)*sizeof(_External_Sort_Block), 8);
+    }
+
+    for(isize i = 0; i < k && ok; i++)
+        ok = _external_sort_reader_next_block(sort, &readers[i]);
+
+    if(ok) {
+        for(isize i = 0; i < k; i++)
+            winners[k + i] = i;
+        for(isize node = k - 1; node > 0; node--) {
+            isize left = winners[2*node];
+            isize right = winners[2*node + 1];
+            bool left_wins = _external_sort_beats(sort, readers, left, right);
+            winners[node] = left_wins ? left : right;
+            tree[node] = left_wins ? right : left;
+        }
+        tree[0] = k > 1 ? winners[1] : 0;
+    }
+
+    while(ok)
+    {
+        isize winner = tree[0];
+        _External_Sort_Reader* reader = &readers[winner];
+        if(reader->at == NULL)
+            break;
+
+        memcpy(out_buffers[out_current] + out_used, reader->at, sort->item_size);
+        out_used += sort->item_size;
+        if(out_used + sort->item_size > sort->block_size) {
+            _External_Sort_Job* job = &out_jobs[out_current];
+            job->data = out_buffers[out_current];
+            job->size = out_used;
+            if(into_run) {
+                job->kind = _EXTERNAL_SORT_JOB_WRITE_BLOCKS;
+                job->blocks = &into_run->blocks[out_blocks];
+            }
+            else {
+                job->kind = _EXTERNAL_SORT_JOB_WRITE;
+                job->file = output;
+                job->offset = out_offset;
+            }
+            _external_sort_submit(sort, job);
+            out_offset += out_used;
+            out_blocks += 1;
+            out_used = 0;
+            out_current ^= 1;
+            ok = _external_sort_wait(sort, &out_jobs[out_current]);
+        }
+
+        reader->at += sort->item_size;
+        if(reader->at >= reader->end) {
+            reader->consumed += 1;
+            _external_sort_reader_request(sort, reader);
+            if(_external_sort_reader_next_block(sort, reader) == false)
+                ok = false;
+        }
+
+        //Replay the matches on the path from the leaf of winner to the root
+        for(isize node = (winner + k)/2; node > 0; node /= 2) {
+            isize other = tree[node];
+            if(_external_sort_beats(sort, readers, other, winner)) {
+                tree[node] = winner;
+                winner = other;
+            }
+        }
+        tree[0] = winner;
+    }
+
+    if(ok && out_used > 0) {
+        _External_Sort_Job* job = &out_jobs[out_current];
+        job->data = out_buffers[out_current];
+        job->size = out_used;
+        if(into_run) {
+            job->kind = _EXTERNAL_SORT_JOB_WRITE_BLOCKS;
+            job->blocks = &into_run->blocks[out_blocks];
+        }
+        else {
+            job->kind = _EXTERNAL_SORT_JOB_WRITE;
+            job->file = output;
+            job->offset = out_offset;
+        }
+        _external_sort_submit(sort, job);
+        out_blocks += 1;
+    }
+
+    //Wait for everything in flight (also on failure) before releasing the buffers
+    _external_sort_wait(sort, &out_jobs[0]);
+    _external_sort_wait(sort, &out_jobs[1]);
+    for(isize i = 0; i < k; i++) {
+        _external_sort_wait(sort, &readers[i].jobs[0]);
+        _external_sort_wait(sort, &readers[i].jobs[1]);
+    }
+
+    if(into_run)
+        into_run->block_count = out_blocks;
+    allocator_deallocate(sort->alloc, memory, memory_size, 8);
+    PROFILE_STOP();
+}
+
+EXTERNAL External_Sort_Error external_sort_file(Platform_String output_path, Platform_String input_path, isize item_size, Is_Less_Func is_less, void* context,
+    const External_Sort_Options* options_or_null, External_Sort_Stats* stats_or_null, Platform_Error* error_or_null)
+{
+    PROFILE_START();
+    External_Sort_Options options = {0};
+    if(options_or_null)
+        options = *options_or_null;
+    if(options.memory_budget <= 0)
+        options.memory_budget = EXTERNAL_SORT_DEFAULT_MEMORY;
+    if(options.block_size <= 0)
+        options.block_size = EXTERNAL_SORT_DEFAULT_BLOCK;
+    if(options.io_threads == 0)
+        options.io_threads = 2;
+    if(options.io_threads < 0)
+        options.io_threads = 0;
+    if(options.io_threads > EXTERNAL_SORT_MAX_IO_THREADS)
+        options.io_threads = EXTERNAL_SORT_MAX_IO_THREADS;
+
+    External_Sort_Stats stats = {0};
+    _External_Sort sort = {0};
+    sort.alloc = options.allocator_or_null ? options.allocator_or_null : allocator_get_default();
+    sort.item_size = item_size;
+    sort.is_less = is_less;
+    sort.context = context;
+    sort.block_size = options.block_size/item_size*item_size;
+    sort.compress = options.compress_runs;
+    sort.io_threads = options.io_threads;
+
+    //We need at least the three chunk buffers in the first phase and two runs with their output in the second.
+    isize chunk_size = options.memory_budget/3/sort.block_size*sort.block_size;
+    isize max_fan_in = options.memory_budget/(2*sort.block_size) - 1;
+
+    Platform_File input = {0};
+    Platform_File output = {0};
+    Platform_Error platform_error = 0;
+    isize input_size = 0;
+    if(item_size <= 0 || sort.block_size <= 0 || sort.block_size > SLZ4_MAX_SIZE || chunk_size <= 0 || max_fan_in < 2 || is_less == NULL)
+        _external_sort_fail(&sort, EXTERNAL_SORT_ERROR_INVALID, 0);
+    else {
+        platform_error = platform_file_open(&input, input_path, PLATFORM_FILE_OPEN_READ | PLATFORM_FILE_OPEN_HINT_FRONT_TO_BACK_ACCESS);
+        if(platform_error == 0)
+            platform_error = platform_file_size(&input, &input_size);
+        if(platform_error == 0)
+            platform_error = platform_file_open(&output, output_path, PLATFORM_FILE_OPEN_WRITE | PLATFORM_FILE_OPEN_CREATE | PLATFORM_FILE_OPEN_REMOVE_CONTENT);
+
+        if(platform_error)
+            _external_sort_fail(&sort, EXTERNAL_SORT_ERROR_IO, platform_error);
+        else if(input_size % item_size != 0)
+            _external_sort_fail(&sort, EXTERNAL_SORT_ERROR_INVALID, 0);
+    }
+
+    //Temporary file path defaults to output_path + ".runs"
+    char* temp_path_data = NULL;
+    isize temp_path_size = 0;
+    if(atomic_load(&sort.error) == EXTERNAL_SORT_OK) {
+        Platform_String temp_path = options.temp_path;
+        if(temp_path.count == 0) {
+            temp_path_size = output_path.count + 6;
+            temp_path_data = (char*) allocator_allocate(sort.alloc, temp_path_size, 1);
+            memcpy(temp_path_data, output_path.data, (size_t) output_path.count);
+            memcpy(temp_path_data + output_path.count, ".runs", 6);
+            temp_path.data = temp_path_data;
+            temp_path.count = output_path.count + 5;
+        }
+        platform_error = platform_file_open(&sort.temp, temp_path, PLATFORM_FILE_OPEN_READ_WRITE | PLATFORM_FILE_OPEN_CREATE | PLATFORM_FILE_OPEN_REMOVE_CONTENT);
+        if(platform_error)
+            _external_sort_fail(&sort, EXTERNAL_SORT_ERROR_IO, platform_error);
+        options.temp_path = temp_path;
+    }
+
+    if(atomic_load(&sort.error) == EXTERNAL_SORT_OK)
+    {
+        isize item_count = input_size/item_size;
+        isize chunk_items = chunk_size/item_size;
+        isize chunk_count = (item_count + chunk_items - 1)/chunk_items;
+        isize chunk_blocks = chunk_size/sort.block_size;
+        stats.item_count = item_count;
+        stats.run_count = chunk_count;
+
+        //Every merge pass replaces at least two runs with one so there are never more than 2*chunk_count runs
+        isize run_capacity = 2*chunk_count + 1;
+        _External_Sort_Run* runs = (_External_Sort_Run*) allocator_allocate(sort.alloc, run_capacity*sizeof(_External_Sort_Run), 8);
+        _External_Sort_Block* chunk_block_storage = (_External_Sort_Block*) allocator_allocate(sort.alloc, (chunk_count*chunk_blocks + 1)*sizeof(_External_Sort_Block), 8);
+        memset(runs, 0, run_capacity*sizeof(_External_Sort_Run));
+
+        //Start the io threads
+        sort.staging_size = slz4_compressed_size_upper_bound((int) sort.block_size);
+        for(isize t = 0; t <= sort.io_threads; t++)
+            sort.staging[t] = (uint8_t*) allocator_allocate(sort.alloc, sort.staging_size, 8);
+
+        if(sort.io_threads > 0) {
+            sort.jobs = channel_malloc(4*sort.io_threads, _EXTERNAL_SORT_CHANNEL_INFO);
+            parallel_launch(&sort.io_group, 0, sort.io_threads, _external_sort_worker_func, &sort, "external sort io");
+        }
+
+        //1. Runs
+        {
+            uint8_t* chunk_memory = (uint8_t*) allocator_allocate(sort.alloc, 3*chunk_size, 8);
+            _External_Sort_Job reads[3] = {0};
+            _External_Sort_Job writes[3] = {0};
+            for(isize c = 0; c < chunk_count; c++) {
+                if(c == 0)
+                    _external_sort_read_chunk(&sort, &reads[0], &input, chunk_memory, 0, MIN(chunk_items, item_count)*item_size);
+
+                //Request the next chunk before sorting this one. Its buffer was last used by chunk c - 2 so we wait for its write.
+                isize next = c + 1;
+                if(next < chunk_count) {
+                    isize b = next % 3;
+                    if(_external_sort_wait(&sort, &writes[b]) == false)
+                        break;
+                    _external_sort_read_chunk(&sort, &reads[b], &input, chunk_memory + b*chunk_size, next*chunk_items*item_size, MIN(chunk_items, item_count - next*chunk_items)*item_size);
+                }
+
+                isize b = c % 3;
+                if(_external_sort_wait(&sort, &reads[b]) == false)
+                    break;
+
+                isize count = reads[b].size/item_size;
+                hqsort(reads[b].data, count, item_size, is_less, context);
+
+                runs[c].item_count = count;
+                runs[c].blocks = chunk_block_storage + c*chunk_blocks;
+                runs[c].block_count = (reads[b].size + sort.block_size - 1)/sort.block_size;
+                writes[b].kind = _EXTERNAL_SORT_JOB_WRITE_BLOCKS;
+                writes[b].data = reads[b].data;
+                writes[b].size = reads[b].size;
+                writes[b].blocks = runs[c].blocks;
+                _external_sort_submit(&sort, &writes[b]);
+            }
+
+            for(isize b = 0; b < 3; b++) {
+                _external_sort_wait(&sort, &reads[b]);
+                _external_sort_wait(&sort, &writes[b]);
+            }
+            allocator_deallocate(sort.alloc, chunk_memory, 3*chunk_size, 8);
+        }
+
+        //2. Merge. While there are too many runs merge the oldest ones into a new run at the end.
+        isize first_run = 0;
+        isize run_count = chunk_count;
+        while(atomic_load(&sort.error) == EXTERNAL_SORT_OK && run_count - first_run > max_fan_in) {
+            _external_sort_merge(&sort, runs + first_run, max_fan_in, NULL, &runs[run_count]);
+            first_run += max_fan_in;
+            run_count += 1;
+            stats.merge_passes += 1;
+        }
+
+        if(atomic_load(&sort.error) == EXTERNAL_SORT_OK && run_count > first_run) {
+            _external_sort_merge(&sort, runs + first_run, run_count - first_run, &output, NULL);
+            stats.merge_passes += 1;
+        }
+
+        //Stop the io threads
+        if(sort.jobs) {
+            _External_Sort_Job quit = {_EXTERNAL_SORT_JOB_QUIT};
+            for(isize t = 0; t < sort.io_threads; t++)
+                _external_sort_submit(&sort, &quit);
+            parallel_join(&sort.io_group);
+            channel_deinit(sort.jobs);
+        }
+
+        for(isize t = 0; t <= sort.io_threads; t++)
+            allocator_deallocate(sort.alloc, sort.staging[t], sort.staging_size, 8);
+        for(isize r = chunk_count; r < run_count; r++)
+            allocator_deallocate(sort.alloc, runs[r].blocks, (runs[r].item_count*item_size/sort.block_size + 1)*sizeof(_External_Sort_Block), 8);
+        allocator_deallocate(sort.alloc, chunk_block_storage, (chunk_count*chunk_blocks + 1)*sizeof(_External_Sort_Block), 8);
+        allocator_deallocate(sort.alloc, runs, run_capacity*sizeof(_External_Sort_Run), 8);
+
+        stats.temp_bytes_written = atomic_load(&sort.temp_size);
+        platform_file_close(&sort.temp);
+        platform_file_remove(options.temp_path, false);
+    }
+
+    if(temp_path_data)
+        allocator_deallocate(sort.alloc, temp_path_data, temp_path_size, 1);
+    platform_file_close(&input);
+    platform_file_close(&output);
+
+    if(stats_or_null)
+        *stats_or_null = stats;
+    if(error_or_null)
+        *error_or_null = atomic_load(&sort.platform_error);
+    PROFILE_STOP();
+    return (External_Sort_Error) atomic_load(&sort.error);
+}
+
+EXTERNAL const char* external_sort_error_to_string(External_Sort_Error error)
+{
+    switch(error) {
+        case EXTERNAL_SORT_OK: return "ok";
+        case EXTERNAL_SORT_ERROR_IO: return "io error";
+        case EXTERNAL_SORT_ERROR_INVALID: return "invalid input or options";
+        case EXTERNAL_SORT_ERROR_CORRUPTED: return "corrupted temporary file";
+        default: return "unknown";
+    }
+}
+
+#endif
@@ -0,0 +1,1318 @@
+#ifndef MODULE_SPATIAL
+#define MODULE_SPATIAL
+
+//Spatial acceleration structures over Vec3 for the three usual cases:
+// - Spatial_BVH: bounding volume hierarchy over boxes of static (or rarely rebuilt) geometry. Answers raycasts and
+//   box overlap queries.
+// - Spatial_Grid: uniform hash grid over points which move every frame such as particles. Answers radius queries.
+// - Spatial_KD_Tree: k-d tree over static points. Answers k nearest neighbour and radius queries.
+//
+//Spatial_BVH is a 4-wide BVH built top down with binned SAH (surface area heuristic). The items of a node are
+// binned into SPATIAL_BVH_BINS bins along the axis of greatest centroid extent and split at the bin boundary with
+// the lowest SAH cost. Both halves are then split again giving up to four children per node. The bounds of the four
+// children are stored as SoA so a ray or box is tested against all four with a handful of SSE instructions.
+// Building is parallel: the big nodes near the top are binned by all threads, and once the ranges get small enough
+// each becomes a task building its subtree into its own node array. These are concatenated once all are done.
+//
+//Spatial_Grid hashes points into cubic cells of cell_size and sorts them by hash slot using counting sort. Building
+// is O(n) with no allocations once the grid is warmed up, so the intended use is to rebuild it every step.
+// A radius query visits every cell the query sphere touches, so cell_size should be around the typical radius.
+//
+//Spatial_KD_Tree splits points at the median of the axis of greatest extent until at most SPATIAL_KD_LEAF points
+// remain. Because the split is always at the median the shape of the tree depends only on the point count, so
+// every subtree knows upfront where its nodes go and subtrees are built in parallel without any merging. Leaves
+// store their points as SoA so distances are computed four at a time.
+//
+//All queries report items by their index in the array given at build time. Batch queries split their queries
+// between thread_count_or_zero threads (0 means all processors) with the calling thread working as one of them.
+// The allocator given to the structures is only ever used from the calling thread.
+
+#include "allocator.h"
+#include "platform.h"
+#include "parallel.h"
+#include "sort.h"
+#include "profile.h"
+#include "assert.h"
+#include "defines.h"
+#include "math.h"
+
+#ifndef SPATIAL_BVH_BINS
+    #define SPATIAL_BVH_BINS        16
+#endif
+#ifndef SPATIAL_BVH_MAX_LEAF
+    #define SPATIAL_BVH_MAX_LEAF    4       //at most 15
+#endif
+#ifndef SPATIAL_KD_LEAF
+    #define SPATIAL_KD_LEAF         16
+#endif
+#define SPATIAL_BVH_MAX_ITEMS       (1 << 27)
+
+typedef struct Aabb {
+    Vec3 min;
+    Vec3 max;
+} Aabb;
+
+typedef struct Spatial_Ray {
+    Vec3 origin;
+    Vec3 dir;       //does not need to be normalized. t is then in the multiples of dir
+    float t_max;    //only hits with t in [0, t_max) are reported. Use INFINITY for unlimited
+} Spatial_Ray;
+
+typedef struct Spatial_Hit {
+    isize index;    //-1 if nothing was hit
+    float t;        //t_max of the ray if nothing was hit
+} Spatial_Hit;
+
+typedef struct Spatial_Neighbor {
+    isize index;    //-1 for unused entries of batch queries
+    float dist_sq;
+} Spatial_Neighbor;
+
+//Called for every item found by a query. query is the index of the query within its batch or 0 for single queries.
+//Returning false stops the query. Batch queries call this from multiple threads at once.
+typedef bool (*Spatial_Found_Func)(void* context, isize query, isize index);
+//Returns the t at which ray hits the item with the given index or any value outside [0, ray.t_max) on miss.
+// ray.t_max is the distance of the closest hit so far so the test can be skipped early.
+typedef float (*Spatial_Ray_Func)(void* context, isize index, Spatial_Ray ray);
+
+typedef struct Spatial_BVH_Node {
+    //Bounds of the four children in SoA layout
+    float min_x[4];
+    float min_y[4];
+    float min_z[4];
+    float max_x[4];
+    float max_y[4];
+    float max_z[4];
+    //Index of the child node if >= 0, otherwise ~(first << 4 | count) for a leaf with items [first, first + count).
+    //Unused children are -1 (that is an empty leaf).
+    int32_t children[4];
+} Spatial_BVH_Node;
+
+typedef struct Spatial_BVH {
+    Allocator* alloc;
+    Spatial_BVH_Node* nodes;    //nodes[0] is the root
+    Aabb* boxes;                //boxes of the items in leaf order
+    uint32_t* indices;          //original index of each item in leaf order
+    isize node_count;
+    isize node_capacity;
+    isize count;
+    Aabb bounds;
+} Spatial_BVH;
+
+typedef struct Spatial_Grid {
+    Allocator* alloc;
+    Vec3* points;               //points sorted by slot
+    uint32_t* indices;          //original index of each sorted point
+    uint32_t* slots;            //scratch: slot of each input point
+    uint32_t* slot_starts;      //points of slot s are [slot_starts[s], slot_starts[s + 1])
+    isize count;
+    isize capacity;
+    isize slot_count;           //power of two
+    isize slot_shift;
+    float cell_size;
+    float inv_cell_size;
+} Spatial_Grid;
+
+typedef struct Spatial_KD_Node {
+    float split;                //inner nodes: the left subtree has coordinates <= split, the right one >= split
+    uint32_t axis;              //0, 1, 2 for inner nodes or 3 for leaves
+    uint32_t right_or_first;    //inner nodes: index of the right child (the left one is always next). leaves: first point
+    uint32_t count;             //leaves: number of points
+} Spatial_KD_Node;
+
+typedef struct Spatial_KD_Tree {
+    Allocator* alloc;
+    Spatial_KD_Node* nodes;     //preorder, nodes[0] is the root
+    float* xs;                  //coordinates of the points in leaf order. Padded with 4 extra entries
+    float* ys;
+    float* zs;
+    uint32_t* indices;          //original index of each point in leaf order
+    isize node_count;
+    isize count;
+} Spatial_KD_Tree;
+
+MATHAPI Aabb aabb_empty() {
+    Aabb out = {{INFINITY, INFINITY, INFINITY}, {-INFINITY, -INFINITY, -INFINITY}};
+    return out;
+}
+MATHAPI Aabb aabb_from_point(Vec3 point) {
+    Aabb out = {point, point};
+    return out;
+}
+MATHAPI Aabb aabb_from_sphere(Vec3 center, float radius) {
+    Aabb out = {vec3_sub(center, vec3_of(radius)), vec3_add(center, vec3_of(radius))};
+    return out;
+}
+MATHAPI Aabb aabb_union(Aabb a, Aabb b) {
+    Aabb out = {vec3_min(a.min, b.min), vec3_max(a.max, b.max)};
+    return out;
+}
+MATHAPI Aabb aabb_add_point(Aabb box, Vec3 point) {
+    Aabb out = {vec3_min(box.min, point), vec3_max(box.max, point)};
+    return out;
+}
+MATHAPI bool aabb_overlaps(Aabb a, Aabb b) {
+    return a.min.x <= b.max.x && b.min.x <= a.max.x
+        && a.min.y <= b.max.y && b.min.y <= a.max.y
+        && a.min.z <= b.max.z && b.min.z <= a.max.z;
+}
+MATHAPI bool aabb_contains_point(Aabb box, Vec3 point) {
+    return box.min.x <= point.x && point.x <= box.max.x
+        && box.min.y <= point.y && point.y <= box.max.y
+        && box.min.z <= point.z && point.z <= box.max.z;
+}
+//Returns 0 for empty boxes
+MATHAPI float aabb_half_area(Aabb box) {
+    Vec3 d = vec3_sub(box.max, box.min);
+    if(d.x < 0 || d.y < 0 || d.z < 0)
+        return 0;
+    return d.x*d.y + d.y*d.z + d.z*d.x;
+}
+
+//Builds bvh over count boxes. Previous contents of bvh are freed. count must be at most SPATIAL_BVH_MAX_ITEMS.
+EXTERNAL void spatial_bvh_build(Spatial_BVH* bvh, Allocator* alloc_or_null, const Aabb* boxes, isize count, isize thread_count_or_zero);
+EXTERNAL void spatial_bvh_deinit(Spatial_BVH* bvh);
+//Returns the closest hit of ray as reported by hit.
+EXTERNAL Spatial_Hit spatial_bvh_raycast(const Spatial_BVH* bvh, Spatial_Ray ray, Spatial_Ray_Func hit, void* context);
+EXTERNAL void spatial_bvh_raycast_batch(const Spatial_BVH* bvh, const Spatial_Ray* rays, isize count, Spatial_Ray_Func hit, void* context, Spatial_Hit* hits, isize thread_count_or_zero);
+//Calls found for every item whose box overlaps box. Returns false if found stopped the query.
+EXTERNAL bool spatial_bvh_query_aabb(const Spatial_BVH* bvh, Aabb box, Spatial_Found_Func found, void* context);
+EXTERNAL void spatial_bvh_query_aabb_batch(const Spatial_BVH* bvh, const Aabb* boxes, isize count, Spatial_Found_Func found, void* context, isize thread_count_or_zero);
+
+EXTERNAL void spatial_grid_init(Spatial_Grid* grid, Allocator* alloc_or_null, float cell_size);
+EXTERNAL void spatial_grid_deinit(Spatial_Grid* grid);
+//Replaces the contents of the grid with the given points. Reuses the memory of the previous build when possible.
+EXTERNAL void spatial_grid_build(Spatial_Grid* grid, const Vec3* points, isize count);
+//Calls found for every point within radius of center. Returns false if found stopped the query.
+EXTERNAL bool spatial_grid_query_radius(const Spatial_Grid* grid, Vec3 center, float radius, Spatial_Found_Func found, void* context);
+EXTERNAL void spatial_grid_query_radius_batch(const Spatial_Grid* grid, const Vec3* centers, isize count, float radius, Spatial_Found_Func found, void* context, isize thread_count_or_zero);
+
+//Builds tree over count points. Previous contents of tree are freed.
+EXTERNAL void spatial_kd_tree_build(Spatial_KD_Tree* tree, Allocator* alloc_or_null, const Vec3* points, isize count, isize thread_count_or_zero);
+EXTERNAL void spatial_kd_tree_deinit(Spatial_KD_Tree* tree);
+//Fills neighbors with the min(k, count) nearest points to point sorted from the closest and returns their number.
+EXTERNAL isize spatial_kd_tree_knn(const Spatial_KD_Tree* tree, Vec3 point, isize k, Spatial_Neighbor* neighbors);
+//Finds the k nearest neighbors of each point. neighbors has k entries per point, the ones which were not found have index -1.
+EXTERNAL void spatial_kd_tree_knn_batch(const Spatial_KD_Tree* tree, const Vec3* points, isize count, isize k, Spatial_Neighbor* neighbors, isize thread_count_or_zero);
+//Calls found for every point within radius of center. Returns false if found stopped the query.
+EXTERNAL bool spatial_kd_tree_query_radius(const Spatial_KD_Tree* tree, Vec3 center, float radius, Spatial_Found_Func found, void* context);
+#endif
+
+#if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_SPATIAL)) && !defined(MODULE_HAS_IMPL_SPATIAL)
+#define MODULE_HAS_IMPL_SPATIAL
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define _SPATIAL_SSE
+#endif
+
+#define _SPATIAL_BVH_EMPTY      (-1)
+#define _SPATIAL_BVH_SAH_DEPTH  40      //deeper than this we split at the median so that the depth stays bounded
+#define _SPATIAL_BVH_STACK      256
+#define _SPATIAL_KD_STACK       64
+#define _SPATIAL_KD_LEAF_AXIS   3
+#define _SPATIAL_BATCH_CHUNK    64
+
+// ============================ BVH build ============================
+typedef struct _Spatial_BVH_Range {
+    isize first;
+    isize count;
+    Aabb bounds;
+    Aabb centroids;     //bounds of min + max of the items (twice the centroid, which saves a multiply)
+} _Spatial_BVH_Range;
+
+//Items are moved around as a whole while partitioning so that every pass over a range reads memory in order
+typedef struct _Spatial_BVH_Item {
+    Aabb box;
+    uint32_t index;
+    uint32_t _;
+} _Spatial_BVH_Item;
+
+typedef struct _Spatial_BVH_Bin {
+    Aabb bounds;
+    Aabb centroids;
+    isize count;
+} _Spatial_BVH_Bin;
+
+typedef struct _Spatial_BVH_Task {
+    _Spatial_BVH_Range range;
+    isize depth;
+    isize parent;
+    isize slot;
+    Spatial_BVH_Node* nodes;
+    isize node_count;
+    isize node_capacity;
+} _Spatial_BVH_Task;
+
+typedef struct _Spatial_BVH_Builder {
+    Allocator* alloc;
+    _Spatial_BVH_Item* items;
+    Spatial_BVH_Node* nodes;
+    isize node_count;
+    isize node_capacity;
+
+    isize thread_count;
+    isize task_threshold;       //subtrees of at most this many items become tasks. 0 when building a task
+    _Spatial_BVH_Task* tasks;
+    isize task_count;
+    isize task_capacity;
+} _Spatial_BVH_Builder;
+
+typedef struct _Spatial_BVH_Binning {
+    const _Spatial_BVH_Item* items;
+    isize first;
+    isize axis;
+    float origin;
+    float scale;
+    isize chunk;
+    _Spatial_BVH_Bin* chunk_bins;
+} _Spatial_BVH_Binning;
+
+INTERNAL Vec3 _spatial_centroid2(Aabb box)
+{
+    return vec3_add(box.min, box.max);
+}
+
+INTERNAL isize _spatial_bvh_bin_of(const _Spatial_BVH_Binning* binning, Aabb box)
+{
+    float c = box.min.floats[binning->axis] + box.max.floats[binning->axis];
+    isize bin = (isize) ((c - binning->origin)*binning->scale);
+    return bin < 0 ? 0 : bin >= SPATIAL_BVH_BINS ? SPATIAL_BVH_BINS - 1 : bin;
+}
+
+INTERNAL void _spatial_bvh_bins_clear(_Spatial_BVH_Bin* bins)
+{
+    for(isize b = 0; b < SPATIAL_BVH_BINS; b++) {
+        bins[b].bounds = aabb_empty();
+        bins[b].centroids = aabb_empty();
+        bins[b].count = 0;
+    }
+}
+
+INTERNAL void _spatial_bvh_bin_items(const _Spatial_BVH_Binning* binning, isize from, isize to, _Spatial_BVH_Bin* bins)
+{
+    _spatial_bvh_bins_clear(bins);
+    for(isize i = from; i < to; i++) {
+        Aabb box = binning->items[i].box;
+        _Spatial_BVH_Bin* bin = &bins[_spatial_bvh_bin_of(binning, box)];
+        bin->bounds = aabb_union(bin->bounds, box);
+        bin->centroids = aabb_add_point(bin->centroids, _spatial_centroid2(box));
+        bin->count += 1;
+    }
+}
+
+INTERNAL void _spatial_bvh_bin_chunk(void* context, isize from, isize to, isize thread_index)
+{
+    (void) thread_index;
+    _Spatial_BVH_Binning* binning = (_Spatial_BVH_Binning*) context;
+    _Spatial_BVH_Bin* bins = binning->chunk_bins + from/binning->chunk*SPATIAL_BVH_BINS;
+    _spatial_bvh_bin_items(binning, binning->first + from, binning->first + to, bins);
+}
+
+INTERNAL void _spatial_bvh_range_bounds(_Spatial_BVH_Builder* builder, _Spatial_BVH_Range* range)
+{
+    range->bounds = aabb_empty();
+    range->centroids = aabb_empty();
+    for(isize i = range->first; i < range->first + range->count; i++) {
+        Aabb box = builder->items[i].box;
+        range->bounds = aabb_union(range->bounds, box);
+        range->centroids = aabb_add_point(range->centroids, _spatial_centroid2(box));
+    }
+}
+
+
+
+INTERNAL bool _spatial_bvh_median_less(const void* a, const void* b, void* context)
+{
+    isize axis = *(const isize*) context;
+    Aabb box_a = ((const _Spatial_BVH_Item*) a)->box;
+    Aabb box_b = ((const _Spatial_BVH_Item*) b)->box;
+    return box_a.min.floats[axis] + box_a.max.floats[axis] < box_b.min.floats[axis] + box_b.max.floats[axis];
+}
+
+//Splits range in two by binned SAH. Falls back to splitting at the median when all centroids are the same or
+// when the tree got too deep.
+INTERNAL void _spatial_bvh_split(_Spatial_BVH_Builder* builder, const _Spatial_BVH_Range* range, isize depth, _Spatial_BVH_Range* left, _Spatial_BVH_Range* right)
+{
+    Vec3 extent = vec3_sub(range->centroids.max, range->centroids.min);
+    isize axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : extent.y >= extent.z ? 1 : 2;
+
+    isize split = -1;
+    _Spatial_BVH_Bin bins[SPATIAL_BVH_BINS];
+    _Spatial_BVH_Binning binning = {builder->items, range->first, axis};
+    if(extent.floats[axis] > 0 && depth < _SPATIAL_BVH_SAH_DEPTH)
+    {
+        binning.origin = range->centroids.min.floats[axis];
+        binning.scale = (float) SPATIAL_BVH_BINS/extent.floats[axis];
+
+        //Big ranges are binned by all threads into per chunk bins which are then merged
+        if(builder->thread_count > 1 && range->count >= (1 << 16))
+        {
+            binning.chunk = 1 << 15;
+            isize chunk_count = (range->count + binning.chunk - 1)/binning.chunk;
+            binning.chunk_bins = (_Spatial_BVH_Bin*) allocator_allocate(builder->alloc, chunk_count*SPATIAL_BVH_BINS*sizeof(_Spatial_BVH_Bin), 8);
+            parallel_for(range->count, binning.chunk, builder->thread_count, _spatial_bvh_bin_chunk, &binning, "spatial");
+
+            _spatial_bvh_bins_clear(bins);
+            for(isize c = 0; c < chunk_count; c++)
+                for(isize b = 0; b < SPATIAL_BVH_BINS; b++) {
+                    _Spatial_BVH_Bin* from = &binning.chunk_bins[c*SPATIAL_BVH_BINS + b];
+                    bins[b].bounds = aabb_union(bins[b].bounds, from->bounds);
+                    bins[b].centroids = aabb_union(bins[b].centroids, from->centroids);
+                    bins[b].count += from->count;
+                }
+            allocator_deallocate(builder->alloc, binning.chunk_bins, chunk_count*SPATIAL_BVH_BINS*sizeof(_Spatial_BVH_Bin), 8);
+        }
+        else
+            _spatial_bvh_bin_items(&binning, range->first, range->first + range->count, bins);
+
+        //Sweep from the right to get the cost of every right side, then from the left to find the cheapest split
+        float right_costs[SPATIAL_BVH_BINS] = {0};
+        Aabb accumulated = aabb_empty();
+        isize accumulated_count = 0;
+        for(isize b = SPATIAL_BVH_BINS - 1; b > 0; b--) {
+            accumulated = aabb_union(accumulated, bins[b].bounds);
+            accumulated_count += bins[b].count;
+            right_costs[b] = aabb_half_area(accumulated)*(float) accumulated_count;
+        }
+
+        float best_cost = INFINITY;
+        accumulated = aabb_empty();
+        accumulated_count = 0;
+        for(isize b = 0; b < SPATIAL_BVH_BINS - 1; b++) {
+            accumulated = aabb_union(accumulated, bins[b].bounds);
+            accumulated_count += bins[b].count;
+            float cost = aabb_half_area(accumulated)*(float) accumulated_count + right_costs[b + 1];
+            if(accumulated_count > 0 && accumulated_count < range->count && cost < best_cost) {
+                best_cost = cost;
+                split = b + 1;
+            }
+        }
+    }
+
+    if(split >= 0)
+    {
+        _Spatial_BVH_Item* items = builder->items;
+        isize i = range->first;
+        isize j = range->first + range->count - 1;
+        while(i <= j) {
+            if(_spatial_bvh_bin_of(&binning, items[i].box) < split)
+                i += 1;
+            else {
+                _Spatial_BVH_Item temp = items[i];
+                items[i] = items[j];
+                items[j] = temp;
+                j -= 1;
+            }
+        }
+
+        *left = *range;
+        *right = *range;
+        left->count = i - range->first;
+        right->first = i;
+        right->count = range->count - left->count;
+        left->bounds = left->centroids = right->bounds = right->centroids = aabb_empty();
+        for(isize b = 0; b < SPATIAL_BVH_BINS; b++) {
+            _Spatial_BVH_Range* side = b < split ? left : right;
+            side->bounds = aabb_union(side->bounds, bins[b].bounds);
+            side->centroids = aabb_union(side->centroids, bins[b].centroids);
+        }
+    }
+    else
+    {
+        _Spatial_BVH_Item space[2];
+        isize half = range->count/2;
+        select_nth(builder->items + range->first, space, half, range->count, sizeof(_Spatial_BVH_Item), _spatial_bvh_median_less, &axis);
+
+        *left = *range;
+        *right = *range;
+        left->count = half;
+        right->first = range->first + half;
+        right->count = range->count - half;
+        _spatial_bvh_range_bounds(builder, left);
+        _spatial_bvh_range_bounds(builder, right);
+    }
+}
+
+INTERNAL int32_t _spatial_bvh_leaf(isize first, isize count)
+{
+    return ~(int32_t) ((first << 4) | count);
+}
+
+INTERNAL isize _spatial_bvh_push_node(Allocator* alloc, Spatial_BVH_Node** nodes, isize* node_count, isize* node_capacity)
+{
+    if(*node_count >= *node_capacity) {
+        isize new_capacity = MAX(*node_capacity*2, 16);
+        *nodes = (Spatial_BVH_Node*) allocator_reallocate(alloc, new_capacity*sizeof(Spatial_BVH_Node), *nodes, *node_capacity*sizeof(Spatial_BVH_Node), 16);
+        *node_capacity = new_capacity;
+    }
+
+    Spatial_BVH_Node* node = &(*nodes)[*node_count];
+    for(isize c = 0; c < 4; c++) {
+        node->min_x[c] = node->min_y[c] = node->min_z[c] = INFINITY;
+        node->max_x[c] = node->max_y[c] = node->max_z[c] = -INFINITY;
+        node->children[c] = _SPATIAL_BVH_EMPTY;
+    }
+    return (*node_count)++;
+}
+
+INTERNAL void _spatial_bvh_set_child_bounds(Spatial_BVH_Node* node, isize slot, Aabb bounds)
+{
+    node->min_x[slot] = bounds.min.x;
+    node->min_y[slot] = bounds.min.y;
+    node->min_z[slot] = bounds.min.z;
+    node->max_x[slot] = bounds.max.x;
+    node->max_y[slot] = bounds.max.y;
+    node->max_z[slot] = bounds.max.z;
+}
+
+//Returns the child reference for range. Ranges small enough are deferred as tasks and get patched in later.
+INTERNAL int32_t _spatial_bvh_build_range(_Spatial_BVH_Builder* builder, const _Spatial_BVH_Range* range, isize depth, isize parent, isize slot)
+{
+    if(range->count <= SPATIAL_BVH_MAX_LEAF)
+        return _spatial_bvh_leaf(range->first, range->count);
+
+    if(parent >= 0 && range->count <= builder->task_threshold) {
+        if(builder->task_count >= builder->task_capacity) {
+            isize new_capacity = MAX(builder->task_capacity*2, 16);
+            builder->tasks = (_Spatial_BVH_Task*) allocator_reallocate(builder->alloc, new_capacity*sizeof(_Spatial_BVH_Task), builder->tasks, builder->task_capacity*sizeof(_Spatial_BVH_Task), 8);
+            builder->task_capacity = new_capacity;
+        }
+        _Spatial_BVH_Task task = {*range, depth, parent, slot};
+        builder->tasks[builder->task_count++] = task;
+        return _SPATIAL_BVH_EMPTY;
+    }
+
+    isize node_index = _spatial_bvh_push_node(builder->alloc, &builder->nodes, &builder->node_count, &builder->node_capacity);
+
+    _Spatial_BVH_Range halves[2];
+    _Spatial_BVH_Range children[4];
+    isize child_count = 0;
+    _spatial_bvh_split(builder, range, depth, &halves[0], &halves[1]);
+    for(isize h = 0; h < 2; h++) {
+        if(halves[h].count > SPATIAL_BVH_MAX_LEAF) {
+            _spatial_bvh_split(builder, &halves[h], depth, &children[child_count], &children[child_count + 1]);
+            child_count += 2;
+        }
+        else
+            children[child_count++] = halves[h];
+    }
+
+    for(isize c = 0; c < child_count; c++)
+        _spatial_bvh_set_child_bounds(&builder->nodes[node_index], c, children[c].bounds);
+
+    //The node array may get reallocated by the recursive calls so we only remember the index
+    for(isize c = 0; c < child_count; c++) {
+        int32_t child = _spatial_bvh_build_range(builder, &children[c], depth + 1, node_index, c);
+        builder->nodes[node_index].children[c] = child;
+    }
+    return (int32_t) node_index;
+}
+
+INTERNAL void _spatial_bvh_build_tasks(void* context, isize from, isize to, isize thread_index)
+{
+    (void) thread_index;
+    _Spatial_BVH_Builder* main = (_Spatial_BVH_Builder*) context;
+    for(isize t = from; t < to; t++) {
+        _Spatial_BVH_Task* task = &main->tasks[t];
+        //The allocator given to build is not necessarily thread safe, so the temporary node arrays come from malloc
+        _Spatial_BVH_Builder builder = {allocator_get_malloc(), main->items};
+        builder.thread_count = 1;
+        _spatial_bvh_build_range(&builder, &task->range, task->depth, -1, 0);
+        task->nodes = builder.nodes;
+        task->node_count = builder.node_count;
+        task->node_capacity = builder.node_capacity;
+    }
+}
+
+EXTERNAL void spatial_bvh_deinit(Spatial_BVH* bvh)
+{
+    if(bvh->alloc) {
+        allocator_deallocate(bvh->alloc, bvh->nodes, bvh->node_capacity*sizeof(Spatial_BVH_Node), 16);
+        allocator_deallocate(bvh->alloc, bvh->boxes, bvh->count*sizeof(Aabb), 16);
+        allocator_deallocate(bvh->alloc, bvh->indices, bvh->count*sizeof(uint32_t), 4);
+    }
+    memset(bvh, 0, sizeof *bvh);
+}
+
+EXTERNAL void spatial_bvh_build(Spatial_BVH* bvh, Allocator* alloc_or_null, const Aabb* boxes, isize count, isize thread_count_or_zero)
+{
+    PROFILE_START();
+    ASSERT(0 <= count && count <= SPATIAL_BVH_MAX_ITEMS);
+    spatial_bvh_deinit(bvh);
+    bvh->alloc = alloc_or_null ? alloc_or_null : allocator_get_default();
+    bvh->count = count;
+    bvh->bounds = aabb_empty();
+    if(count > 0)
+    {
+        _Spatial_BVH_Builder builder = {bvh->alloc};
+        builder.items = (_Spatial_BVH_Item*) allocator_allocate(bvh->alloc, count*sizeof(_Spatial_BVH_Item), 16);
+        builder.thread_count = parallel_thread_count(thread_count_or_zero, count/4096 + 1);
+        if(builder.thread_count > 1)
+            builder.task_threshold = MAX(count/(builder.thread_count*8), 4096);
+
+        _Spatial_BVH_Range root = {0, count};
+        for(isize i = 0; i < count; i++) {
+            builder.items[i].box = boxes[i];
+            builder.items[i].index = (uint32_t) i;
+        }
+        _spatial_bvh_range_bounds(&builder, &root);
+
+        //The root is always a node, even if it has just one leaf under it
+        if(count <= SPATIAL_BVH_MAX_LEAF) {
+            _spatial_bvh_push_node(builder.alloc, &builder.nodes, &builder.node_count, &builder.node_capacity);
+            _spatial_bvh_set_child_bounds(&builder.nodes[0], 0, root.bounds);
+            builder.nodes[0].children[0] = _spatial_bvh_leaf(0, count);
+        }
+        else
+            _spatial_bvh_build_range(&builder, &root, 0, -1, 0);
+
+        //Build the deferred subtrees and append them after the top nodes
+        parallel_for(builder.task_count, 1, builder.thread_count, _spatial_bvh_build_tasks, &builder, "spatial");
+        isize total_count = builder.node_count;
+        for(isize t = 0; t < builder.task_count; t++)
+            total_count += builder.tasks[t].node_count;
+        if(total_count > builder.node_capacity) {
+            builder.nodes = (Spatial_BVH_Node*) allocator_reallocate(bvh->alloc, total_count*sizeof(Spatial_BVH_Node), builder.nodes, builder.node_capacity*sizeof(Spatial_BVH_Node), 16);
+            builder.node_capacity = total_count;
+        }
+        for(isize t = 0; t < builder.task_count; t++) {
+            _Spatial_BVH_Task* task = &builder.tasks[t];
+            int32_t base = (int32_t) builder.node_count;
+            for(isize n = 0; n < task->node_count; n++) {
+                Spatial_BVH_Node node = task->nodes[n];
+                for(isize c = 0; c < 4; c++)
+                    if(node.children[c] >= 0)
+                        node.children[c] += base;
+                builder.nodes[builder.node_count++] = node;
+            }
+            builder.nodes[task->parent].children[task->slot] = base;
+            allocator_deallocate(allocator_get_malloc(), task->nodes, task->node_capacity*sizeof(Spatial_BVH_Node), 16);
+        }
+        allocator_deallocate(bvh->alloc, builder.tasks, builder.task_capacity*sizeof(_Spatial_BVH_Task), 8);
+
+        bvh->nodes = builder.nodes;
+        bvh->node_count = builder.node_count;
+        bvh->node_capacity = builder.node_capacity;
+        bvh->bounds = root.bounds;
+        bvh->boxes = (Aabb*) allocator_allocate(bvh->alloc, count*sizeof(Aabb), 16);
+        bvh->indices = (uint32_t*) allocator_allocate(bvh->alloc, count*sizeof(uint32_t), 4);
+        for(isize i = 0; i < count; i++) {
+            bvh->boxes[i] = builder.items[i].box;
+            bvh->indices[i] = builder.items[i].index;
+        }
+        allocator_deallocate(bvh->alloc, builder.items, count*sizeof(_Spatial_BVH_Item), 16);
+    }
+    PROFILE_STOP();
+}
+
+// ============================ BVH queries ============================
+INTERNAL int _spatial_bvh_valid_mask(const Spatial_BVH_Node* node)
+{
+    return (node->children[0] != _SPATIAL_BVH_EMPTY)
+        | (node->children[1] != _SPATIAL_BVH_EMPTY) << 1
+        | (node->children[2] != _SPATIAL_BVH_EMPTY) << 2
+        | (node->children[3] != _SPATIAL_BVH_EMPTY) << 3;
+}
+
+//Slab test of the ray against all four children. Returns the mask of hit children and their entry distances.
+INTERNAL int _spatial_bvh_ray_test(const Spatial_BVH_Node* node, Vec3 origin, Vec3 inv_dir, float t_max, float* t_near)
+{
+#ifdef _SPATIAL_SSE
+    __m128 ox = _mm_set1_ps(origin.x), oy = _mm_set1_ps(origin.y), oz = _mm_set1_ps(origin.z);
+    __m128 ix = _mm_set1_ps(inv_dir.x), iy = _mm_set1_ps(inv_dir.y), iz = _mm_set1_ps(inv_dir.z);
+    __m128 tx0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node->min_x), ox), ix);
+    __m128 tx1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node->max_x), ox), ix);
+    __m128 ty0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node->min_y), oy), iy);
+    __m128 ty1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node->max_y), oy), iy);
+    __m128 tz0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node->min_z), oz), iz);
+    __m128 tz1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node->max_z), oz), iz);
+    __m128 enter = _mm_max_ps(_mm_max_ps(_mm_min_ps(tx0, tx1), _mm_min_ps(ty0, ty1)), _mm_max_ps(_mm_min_ps(tz0, tz1), _mm_setzero_ps()));
+    __m128 exit = _mm_min_ps(_mm_min_ps(_mm_max_ps(tx0, tx1), _mm_max_ps(ty0, ty1)), _mm_min_ps(_mm_max_ps(tz0, tz1), _mm_set1_ps(t_max)));
+    _mm_storeu_ps(t_near, enter);
+    return _mm_movemask_ps(_mm_cmple_ps(enter, exit)) & _spatial_bvh_valid_mask(node);
+#else
+    int mask = 0;
+    for(int c = 0; c < 4; c++) {
+        float tx0 = (node->min_x[c] - origin.x)*inv_dir.x, tx1 = (node->max_x[c] - origin.x)*inv_dir.x;
+        float ty0 = (node->min_y[c] - origin.y)*inv_dir.y, ty1 = (node->max_y[c] - origin.y)*inv_dir.y;
+        float tz0 = (node->min_z[c] - origin.z)*inv_dir.z, tz1 = (node->max_z[c] - origin.z)*inv_dir.z;
+        float enter = MAX(MAX(MIN(tx0, tx1), MIN(ty0, ty1)), MAX(MIN(tz0, tz1), 0.0f));
+        float exit = MIN(MIN(MAX(tx0, tx1), MAX(ty0, ty1)), MIN(MAX(tz0, tz1), t_max));
+        t_near[c] = enter;
+        mask |= (enter <= exit) << c;
+    }
+    return mask & _spatial_bvh_valid_mask(node);
+#endif
+}
+
+INTERNAL int _spatial_bvh_box_test(const Spatial_BVH_Node* node, Aabb box)
+{
+#ifdef _SPATIAL_SSE
+    __m128 x = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(node->min_x), _mm_set1_ps(box.max.x)), _mm_cmpge_ps(_mm_loadu_ps(node->max_x), _mm_set1_ps(box.min.x)));
+    __m128 y = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(node->min_y), _mm_set1_ps(box.max.y)), _mm_cmpge_ps(_mm_loadu_ps(node->max_y), _mm_set1_ps(box.min.y)));
+    __m128 z = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(node->min_z), _mm_set1_ps(box.max.z)), _mm_cmpge_ps(_mm_loadu_ps(node->max_z), _mm_set1_ps(box.min.z)));
+    return _mm_movemask_ps(_mm_and_ps(_mm_and_ps(x, y), z)) & _spatial_bvh_valid_mask(node);
+#else
+    int mask = 0;
+    for(int c = 0; c < 4; c++)
+        mask |= (node->min_x[c] <= box.max.x && node->max_x[c] >= box.min.x
+              && node->min_y[c] <= box.max.y && node->max_y[c] >= box.min.y
+              && node->min_z[c] <= box.max.z && node->max_z[c] >= box.min.z) << c;
+    return mask & _spatial_bvh_valid_mask(node);
+#endif
+}
+
+typedef struct _Spatial_BVH_Entry {
+    int32_t child;
+    float t;
+} _Spatial_BVH_Entry;
+
+EXTERNAL Spatial_Hit spatial_bvh_raycast(const Spatial_BVH* bvh, Spatial_Ray ray, Spatial_Ray_Func hit, void* context)
+{
+    Spatial_Hit out = {-1, ray.t_max};
+    if(bvh->node_count == 0)
+        return out;
+
+    Vec3 inv_dir = {1.0f/ray.dir.x, 1.0f/ray.dir.y, 1.0f/ray.dir.z};
+    _Spatial_BVH_Entry stack[_SPATIAL_BVH_STACK];
+    _Spatial_BVH_Entry root = {0, 0};
+    isize stack_size = 0;
+    stack[stack_size++] = root;
+    while(stack_size > 0)
+    {
+        _Spatial_BVH_Entry entry = stack[--stack_size];
+        if(entry.t > out.t)
+            continue;
+
+        if(entry.child >= 0)
+        {
+            //Push the hit children so that the closest is popped first
+            const Spatial_BVH_Node* node = &bvh->nodes[entry.child];
+            float t_near[4];
+            int mask = _spatial_bvh_ray_test(node, ray.origin, inv_dir, out.t, t_near);
+            _Spatial_BVH_Entry hits[4];
+            isize hit_count = 0;
+            for(int c = 0; c < 4; c++) {
+                if((mask & (1 << c)) == 0)
+                    continue;
+                isize k = hit_count++;
+                for(; k > 0 && hits[k - 1].t < t_near[c]; k--)
+                    hits[k] = hits[k - 1];
+                hits[k].child = node->children[c];
+                hits[k].t = t_near[c];
+            }
+            ASSERT(stack_size + hit_count <= _SPATIAL_BVH_STACK);
+            for(isize k = 0; k < hit_count; k++)
+                stack[stack_size++] = hits[k];
+        }
+        else
+        {
+            uint32_t leaf = ~(uint32_t) entry.child;
+            isize first = leaf >> 4;
+            isize count = leaf & 15;
+            for(isize i = first; i < first + count; i++) {
+                ray.t_max = out.t;
+                float t = hit(context, bvh->indices[i], ray);
+                if(t >= 0 && t < out.t) {
+                    out.t = t;
+                    out.index = bvh->indices[i];
+                }
+            }
+        }
+    }
+    return out;
+}
+
+INTERNAL bool _spatial_bvh_query_aabb(const Spatial_BVH* bvh, Aabb box, isize query, Spatial_Found_Func found, void* context)
+{
+    if(bvh->node_count == 0)
+        return true;
+
+    int32_t stack[_SPATIAL_BVH_STACK];
+    isize stack_size = 0;
+    stack[stack_size++] = 0;
+    while(stack_size > 0)
+    {
+        int32_t child = stack[--stack_size];
+        if(child >= 0)
+        {
+            const Spatial_BVH_Node* node = &bvh->nodes[child];
+            int mask = _spatial_bvh_box_test(node, box);
+            ASSERT(stack_size + 4 <= _SPATIAL_BVH_STACK);
+            for(int c = 0; c < 4; c++)
+                if(mask & (1 << c))
+                    stack[stack_size++] = node->children[c];
+        }
+        else
+        {
+            uint32_t leaf = ~(uint32_t) child;
+            isize first = leaf >> 4;
+            isize count = leaf & 15;
+            for(isize i = first; i < first + count; i++)
+                if(aabb_overlaps(bvh->boxes[i], box))
+                    if(found(context, query, bvh->indices[i]) == false)
+                        return false;
+        }
+    }
+    return true;
+}
+
+EXTERNAL bool spatial_bvh_query_aabb(const Spatial_BVH* bvh, Aabb box, Spatial_Found_Func found, void* context)
+{
+    return _spatial_bvh_query_aabb(bvh, box, 0, found, context);
+}
+
+typedef struct _Spatial_Batch {
+    const void* tree;
+    const void* queries;
+    void* results;
+    isize k;
+    float radius;
+    Spatial_Found_Func found;
+    Spatial_Ray_Func hit;
+    void* context;
+} _Spatial_Batch;
+
+INTERNAL void _spatial_bvh_raycast_chunk(void* context, isize from, isize to, isize thread_index)
+{
+    (void) thread_index;
+    _Spatial_Batch* batch = (_Spatial_Batch*) context;
+    const Spatial_Ray* rays = (const Spatial_Ray*) batch->queries;
+    Spatial_Hit* hits = (Spatial_Hit*) batch->results;
+    for(isize i = from; i < to; i++)
+        hits[i] = spatial_bvh_raycast((const Spatial_BVH*) batch->tree, rays[i], batch->hit, batch->context);
+}
+
+INTERNAL void _spatial_bvh_query_aabb_chunk(void* context, isize from, isize to, isize thread_index)
+{
+    (void) thread_index;
+    _Spatial_Batch* batch = (_Spatial_Batch*) context;
+    const Aabb* boxes = (const Aabb*) batch->queries;
+    for(isize i = from; i < to; i++)
+        _spatial_bvh_query_aabb((const Spatial_BVH*) batch->tree, boxes[i], i, batch->found, batch->context);
+}
+
+EXTERNAL void spatial_bvh_raycast_batch(const Spatial_BVH* bvh, const Spatial_Ray* rays, isize count, Spatial_Ray_Func hit, void* context, Spatial_Hit* hits, isize thread_count_or_zero)
+{
+    PROFILE_START();
+    _Spatial_Batch batch = {bvh, rays, hits};
+    batch.hit = hit;
+    batch.context = context;
+    parallel_for(count, _SPATIAL_BATCH_CHUNK, thread_count_or_zero, _spatial_bvh_raycast_chunk, &batch, "spatial");
+    PROFILE_STOP();
+}
+
+EXTERNAL void spatial_bvh_query_aabb_batch(const Spatial_BVH* bvh, const Aabb* boxes, isize count, Spatial_Found_Func found, void* context, isize thread_count_or_zero)
+{
+    PROFILE_START();
+    _Spatial_Batch batch = {bvh, boxes};
+    batch.found = found;
+    batch.context = context;
+    parallel_for(count, _SPATIAL_BATCH_CHUNK, thread_count_or_zero, _spatial_bvh_query_aabb_chunk, &batch, "spatial");
+    PROFILE_STOP();
+}
+
+// ============================ Grid ============================
+typedef struct _Spatial_Cell {
+    int32_t x;
+    int32_t y;
+    int32_t z;
+} _Spatial_Cell;
+
+INTERNAL float _spatial_dist_sq(Vec3 a, Vec3 b)
+{
+    Vec3 d = vec3_sub(a, b);
+    return d.x*d.x + d.y*d.y + d.z*d.z;
+}
+
+INTERNAL _Spatial_Cell _spatial_grid_cell(const Spatial_Grid* grid, Vec3 point)
+{
+    _Spatial_Cell out = {
+        (int32_t) floorf(point.x*grid->inv_cell_size),
+        (int32_t) floorf(point.y*grid->inv_cell_size),
+        (int32_t) floorf(point.z*grid->inv_cell_size),
+    };
+    return out;
+}
+
+INTERNAL uint32_t _spatial_grid_slot(const Spatial_Grid* grid, int32_t x, int32_t y, int32_t z)
+{
+    uint32_t hash = (uint32_t) x*73856093u ^ (uint32_t) y*19349663u ^ (uint32_t) z*83492791u;
+    return (uint32_t) (((uint64_t) hash*0x9E3779B97F4A7C15ull) >> grid->slot_shift);
+}
+
+EXTERNAL void spatial_grid_init(Spatial_Grid* grid, Allocator* alloc_or_null, float cell_size)
+{
+    ASSERT(cell_size > 0);
+    spatial_grid_deinit(grid);
+    grid->alloc = alloc_or_null ? alloc_or_null : allocator_get_default();
+    grid->cell_size = cell_size;
+    grid->inv_cell_size = 1.0f/cell_size;
+}
+
+EXTERNAL void spatial_grid_deinit(Spatial_Grid* grid)
+{
+    if(grid->alloc) {
+        allocator_deallocate(grid->alloc, grid->points, grid->capacity*sizeof(Vec3), 4);
+        allocator_deallocate(grid->alloc, grid->indices, grid->capacity*sizeof(uint32_t), 4);
+        allocator_deallocate(grid->alloc, grid->slots, grid->capacity*sizeof(uint32_t), 4);
+        if(grid->slot_starts)
+            allocator_deallocate(grid->alloc, grid->slot_starts, (grid->slot_count + 1)*sizeof(uint32_t), 4);
+    }
+    memset(grid, 0, sizeof *grid);
+}
+
+EXTERNAL void spatial_grid_build(Spatial_Grid* grid, const Vec3* points, isize count)
+{
+    PROFILE_START();
+    ASSERT(grid->alloc != NULL, "must be initialized with spatial_grid_init");
+    ASSERT(0 <= count && count < UINT32_MAX);
+    if(count > grid->capacity) {
+        isize new_capacity = MAX(count, grid->capacity*3/2);
+        allocator_deallocate(grid->alloc, grid->points, grid->capacity*sizeof(Vec3), 4);
+        allocator_deallocate(grid->alloc, grid->indices, grid->capacity*sizeof(uint32_t), 4);
+        allocator_deallocate(grid->alloc, grid->slots, grid->capacity*sizeof(uint32_t), 4);
+        grid->points = (Vec3*) allocator_allocate(grid->alloc, new_capacity*sizeof(Vec3), 4);
+        grid->indices = (uint32_t*) allocator_allocate(grid->alloc, new_capacity*sizeof(uint32_t), 4);
+        grid->slots = (uint32_t*) allocator_allocate(grid->alloc, new_capacity*sizeof(uint32_t), 4);
+        grid->capacity = new_capacity;
+    }
+
+    //Around two slots per point so that most cells get a slot of their own
+    isize slot_count = 16;
+    isize slot_bits = 4;
+    for(; slot_count < count*2; slot_count *= 2)
+        slot_bits += 1;
+    if(slot_count != grid->slot_count) {
+        if(grid->slot_starts)
+            allocator_deallocate(grid->alloc, grid->slot_starts, (grid->slot_count + 1)*sizeof(uint32_t), 4);
+        grid->slot_starts = (uint32_t*) allocator_allocate(grid->alloc, (slot_count + 1)*sizeof(uint32_t), 4);
+        grid->slot_count = slot_count;
+        grid->slot_shift = 64 - slot_bits;
+    }
+    grid->count = count;
+
+    //Counting sort by slot. The counts are summed into the end of each slot and then decremented while
+    // placing the points back to front, which leaves each at the start of its slot.
+    uint32_t* starts = grid->slot_starts;
+    memset(starts, 0, (slot_count + 1)*sizeof(uint32_t));
+    for(isize i = 0; i < count; i++) {
+        _Spatial_Cell cell = _spatial_grid_cell(grid, points[i]);
+        uint32_t slot = _spatial_grid_slot(grid, cell.x, cell.y, cell.z);
+        grid->slots[i] = slot;
+        starts[slot] += 1;
+    }
+    for(isize s = 1; s <= slot_count; s++)
+        starts[s] += starts[s - 1];
+    for(isize i = count; i-- > 0; ) {
+        uint32_t to = --starts[grid->slots[i]];
+        grid->points[to] = points[i];
+        grid->indices[to] = (uint32_t) i;
+    }
+    PROFILE_STOP();
+}
+
+INTERNAL bool _spatial_grid_query_radius(const Spatial_Grid* grid, Vec3 center, float radius, isize query, Spatial_Found_Func found, void* context)
+{
+    if(grid->count == 0)
+        return true;
+
+    float radius_sq = radius*radius;
+    _Spatial_Cell lo = _spatial_grid_cell(grid, vec3_sub(center, vec3_of(radius)));
+    _Spatial_Cell hi = _spatial_grid_cell(grid, vec3_add(center, vec3_of(radius)));
+    f64 cell_count = ((f64) hi.x - lo.x + 1)*((f64) hi.y - lo.y + 1)*((f64) hi.z - lo.z + 1);
+
+    //When the query covers more cells than there are slots it is cheaper to check every point
+    if(cell_count > (f64) grid->slot_count) {
+        for(isize i = 0; i < grid->count; i++)
+            if(_spatial_dist_sq(grid->points[i], center) <= radius_sq)
+                if(found(context, query, grid->indices[i]) == false)
+                    return false;
+        return true;
+    }
+
+    //Different cells can share a slot. We only report points from the cell that is being visited, so that
+    // a point is never reported twice.
+    for(int32_t z = lo.z; z <= hi.z; z++)
+        for(int32_t y = lo.y; y <= hi.y; y++)
+            for(int32_t x = lo.x; x <= hi.x; x++) {
+                uint32_t slot = _spatial_grid_slot(grid, x, y, z);
+                for(uint32_t i = grid->slot_starts[slot]; i < grid->slot_starts[slot + 1]; i++) {
+                    Vec3 point = grid->points[i];
+                    if(_spatial_dist_sq(point, center) <= radius_sq) {
+                        _Spatial_Cell cell = _spatial_grid_cell(grid, point);
+                        if(cell.x == x && cell.y == y && cell.z == z)
+                            if(found(context, query, grid->indices[i]) == false)
+                                return false;
+                    }
+                }
+            }
+    return true;
+}
+
+EXTERNAL bool spatial_grid_query_radius(const Spatial_Grid* grid, Vec3 center, float radius, Spatial_Found_Func found, void* context)
+{
+    return _spatial_grid_query_radius(grid, center, radius, 0, found, context);
+}
+
+INTERNAL void _spatial_grid_query_chunk(void* context, isize from, isize to, isize thread_index)
+{
+    (void) thread_index;
+    _Spatial_Batch* batch = (_Spatial_Batch*) context;
+    const Vec3* centers = (const Vec3*) batch->queries;
+    for(isize i = from; i < to; i++)
+        _spatial_grid_query_radius((const Spatial_Grid*) batch->tree, centers[i], batch->radius, i, batch->found, batch->context);
+}
+
+EXTERNAL void spatial_grid_query_radius_batch(const Spatial_Grid* grid, const Vec3* centers, isize count, float radius, Spatial_Found_Func found, void* context, isize thread_count_or_zero)
+{
+    PROFILE_START();
+    _Spatial_Batch batch = {grid, centers};
+    batch.radius = radius;
+    batch.found = found;
+    batch.context = context;
+    parallel_for(count, _SPATIAL_BATCH_CHUNK, thread_count_or_zero, _spatial_grid_query_chunk, &batch, "spatial");
+    PROFILE_STOP();
+}
+
+// ============================ K-d tree ============================
+typedef struct _Spatial_KD_Point {
+    Vec3 point;
+    uint32_t index;
+} _Spatial_KD_Point;
+
+typedef struct _Spatial_KD_Task {
+    isize node;
+    isize first;
+    isize count;
+} _Spatial_KD_Task;
+
+typedef struct _Spatial_KD_Builder {
+    Allocator* alloc;
+    Spatial_KD_Node* nodes;
+    _Spatial_KD_Point* points;
+    isize task_threshold;       //subtrees of at most this many points become tasks. 0 when building a task
+    _Spatial_KD_Task* tasks;
+    isize task_count;
+    isize task_capacity;
+} _Spatial_KD_Builder;
+
+INTERNAL bool _spatial_kd_less_x(const void* a, const void* b, void* context) { (void) context; return ((const _Spatial_KD_Point*) a)->point.x < ((const _Spatial_KD_Point*) b)->point.x; }
+INTERNAL bool _spatial_kd_less_y(const void* a, const void* b, void* context) { (void) context; return ((const _Spatial_KD_Point*) a)->point.y < ((const _Spatial_KD_Point*) b)->point.y; }
+INTERNAL bool _spatial_kd_less_z(const void* a, const void* b, void* context) { (void) context; return ((const _Spatial_KD_Point*) a)->point.z < ((const _Spatial_KD_Point*) b)->point.z; }
+
+//Fills out with the node counts of trees over n and n + 1 points. At every depth the subtree sizes are one of
+// two consecutive numbers so this only takes O(log n).
+INTERNAL void _spatial_kd_node_counts(isize n, isize out[2])
+{
+    if(n < SPATIAL_KD_LEAF) {
+        out[0] = out[1] = 1;
+        return;
+    }
+
+    isize half = n/2;
+    isize halves[2];
+    _spatial_kd_node_counts(half, halves);
+    for(isize i = 0; i < 2; i++) {
+        isize k = n + i;
+        if(k <= SPATIAL_KD_LEAF)
+            out[i] = 1;
+        else
+            out[i] = 1 + halves[k/2 - half] + halves[k - k/2 - half];
+    }
+}
+
+INTERNAL void _spatial_kd_build_range(_Spatial_KD_Builder* builder, isize node_index, isize first, isize count)
+{
+    Spatial_KD_Node* node = &builder->nodes[node_index];
+    if(count <= SPATIAL_KD_LEAF) {
+        node->split = 0;
+        node->axis = _SPATIAL_KD_LEAF_AXIS;
+        node->right_or_first = (uint32_t) first;
+        node->count = (uint32_t) count;
+        return;
+    }
+
+    if(count <= builder->task_threshold) {
+        if(builder->task_count >= builder->task_capacity) {
+            isize new_capacity = MAX(builder->task_capacity*2, 16);
+            builder->tasks = (_Spatial_KD_Task*) allocator_reallocate(builder->alloc, new_capacity*sizeof(_Spatial_KD_Task), builder->tasks, builder->task_capacity*sizeof(_Spatial_KD_Task), 8);
+            builder->task_capacity = new_capacity;
+        }
+        _Spatial_KD_Task task = {node_index, first, count};
+        builder->tasks[builder->task_count++] = task;
+        return;
+    }
+
+    _Spatial_KD_Point* points = builder->points + first;
+    Aabb bounds = aabb_empty();
+    for(isize i = 0; i < count; i++)
+        bounds = aabb_add_point(bounds, points[i].point);
+    Vec3 extent = vec3_sub(bounds.max, bounds.min);
+    isize axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : extent.y >= extent.z ? 1 : 2;
+
+    isize half = count/2;
+    _Spatial_KD_Point space[2];
+    Is_Less_Func less = axis == 0 ? _spatial_kd_less_x : axis == 1 ? _spatial_kd_less_y : _spatial_kd_less_z;
+    select_nth(points, space, half, count, sizeof(_Spatial_KD_Point), less, NULL);
+
+    isize left_counts[2];
+    _spatial_kd_node_counts(half, left_counts);
+    isize right = node_index + 1 + left_counts[0];
+    node->split = points[half].point.floats[axis];
+    node->axis = (uint32_t) axis;
+    node->right_or_first = (uint32_t) right;
+    node->count = 0;
+
+    _spatial_kd_build_range(builder, node_index + 1, first, half);
+    _spatial_kd_build_range(builder, right, first + half, count - half);
+}
+
+INTERNAL void _spatial_kd_build_tasks(void* context, isize from, isize to, isize thread_index)
+{
+    (void) thread_index;
+    _Spatial_KD_Builder* main = (_Spatial_KD_Builder*) context;
+    for(isize t = from; t < to; t++) {
+        _Spatial_KD_Task task = main->tasks[t];
+        _Spatial_KD_Builder builder = {main->alloc, main->nodes, main->points};
+        _spatial_kd_build_range(&builder, task.node, task.first, task.count);
+    }
+}
+
+EXTERNAL void spatial_kd_tree_deinit(Spatial_KD_Tree* tree)
+{
+    if(tree->alloc) {
+        allocator_deallocate(tree->alloc, tree->nodes, tree->node_count*sizeof(Spatial_KD_Node), 16);
+        allocator_deallocate(tree->alloc, tree->xs, (tree->count + 4)*sizeof(float), 16);
+        allocator_deallocate(tree->alloc, tree->ys, (tree->count + 4)*sizeof(float), 16);
+        allocator_deallocate(tree->alloc, tree->zs, (tree->count + 4)*sizeof(float), 16);
+        allocator_deallocate(tree->alloc, tree->indices, tree->count*sizeof(uint32_t), 4);
+    }
+    memset(tree, 0, sizeof *tree);
+}
+
+EXTERNAL void spatial_kd_tree_build(Spatial_KD_Tree* tree, Allocator* alloc_or_null, const Vec3* points, isize count, isize thread_count_or_zero)
+{
+    PROFILE_START();
+    ASSERT(0 <= count && count < UINT32_MAX);
+    spatial_kd_tree_deinit(tree);
+    tree->alloc = alloc_or_null ? alloc_or_null : allocator_get_default();
+    tree->count = count;
+
+    isize node_counts[2];
+    _spatial_kd_node_counts(count, node_counts);
+    tree->node_count = node_counts[0];
+    tree->nodes = (Spatial_KD_Node*) allocator_allocate(tree->alloc, tree->node_count*sizeof(Spatial_KD_Node), 16);
+
+    _Spatial_KD_Builder builder = {tree->alloc, tree->nodes};
+    builder.points = (_Spatial_KD_Point*) allocator_allocate(tree->alloc, (count + 1)*sizeof(_Spatial_KD_Point), 16);
+    for(isize i = 0; i < count; i++) {
+        builder.points[i].point = points[i];
+        builder.points[i].index = (uint32_t) i;
+    }
+
+    isize thread_count = parallel_thread_count(thread_count_or_zero, count/4096 + 1);
+    if(thread_count > 1)
+        builder.task_threshold = MAX(count/(thread_count*8), 4096);
+    _spatial_kd_build_range(&builder, 0, 0, count);
+    builder.task_threshold = 0;
+    parallel_for(builder.task_count, 1, thread_count, _spatial_kd_build_tasks, &builder, "spatial");
+
+    tree->xs = (float*) allocator_allocate(tree->alloc, (count + 4)*sizeof(float), 16);
+    tree->ys = (float*) allocator_allocate(tree->alloc, (count + 4)*sizeof(float), 16);
+    tree->zs = (float*) allocator_allocate(tree->alloc, (count + 4)*sizeof(float), 16);
+    tree->indices = (uint32_t*) allocator_allocate(tree->alloc, count*sizeof(uint32_t), 4);
+    for(isize i = 0; i < count; i++) {
+        tree->xs[i] = builder.points[i].point.x;
+        tree->ys[i] = builder.points[i].point.y;
+        tree->zs[i] = builder.points[i].point.z;
+        tree->indices[i] = builder.points[i].index;
+    }
+    for(isize i = count; i < count + 4; i++)
+        tree->xs[i] = tree->ys[i] = tree->zs[i] = 0;
+
+    allocator_deallocate(tree->alloc, builder.points, (count + 1)*sizeof(_Spatial_KD_Point), 16);
+    allocator_deallocate(tree->alloc, builder.tasks, builder.task_capacity*sizeof(_Spatial_KD_Task), 8);
+    PROFILE_STOP();
+}
+
+typedef struct _Spatial_KD_Entry {
+    uint32_t node;
+    float dist_sq;      //lower bound of the distance to any point under node
+} _Spatial_KD_Entry;
+
+//Pushes the children of an inner node so that the one on the side of point is popped first
+INTERNAL isize _spatial_kd_push_children(const Spatial_KD_Node* node, uint32_t node_index, Vec3 point, float dist_sq, _Spatial_KD_Entry* stack, isize stack_size)
+{
+    float diff = point.floats[node->axis] - node->split;
+    _Spatial_KD_Entry left = {node_index + 1, dist_sq};
+    _Spatial_KD_Entry right = {node->right_or_first, dist_sq};
+    ASSERT(stack_size + 2 <= _SPATIAL_KD_STACK);
+    if(diff < 0) {
+        right.dist_sq = MAX(dist_sq, diff*diff);
+        stack[stack_size++] = right;
+        stack[stack_size++] = left;
+    }
+    else {
+        left.dist_sq = MAX(dist_sq, diff*diff);
+        stack[stack_size++] = left;
+        stack[stack_size++] = right;
+    }
+    return stack_size;
+}
+
+//Computes squared distances of 4 consecutive leaf points to point
+INTERNAL void _spatial_kd_dist4(const Spatial_KD_Tree* tree, isize i, Vec3 point, float* dist_sq)
+{
+#ifdef _SPATIAL_SSE
+    __m128 dx = _mm_sub_ps(_mm_loadu_ps(tree->xs + i), _mm_set1_ps(point.x));
+    __m128 dy = _mm_sub_ps(_mm_loadu_ps(tree->ys + i), _mm_set1_ps(point.y));
+    __m128 dz = _mm_sub_ps(_mm_loadu_ps(tree->zs + i), _mm_set1_ps(point.z));
+    __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+    _mm_storeu_ps(dist_sq, d);
+#else
+    for(isize l = 0; l < 4; l++) {
+        float dx = tree->xs[i + l] - point.x;
+        float dy = tree->ys[i + l] - point.y;
+        float dz = tree->zs[i + l] - point.z;
+        dist_sq[l] = dx*dx + dy*dy + dz*dz;
+    }
+#endif
+}
+
+//Max heap of the k best neighbors found so far
+INTERNAL void _spatial_knn_push(Spatial_Neighbor* heap, isize* size, isize k, isize index, float dist_sq)
+{
+    isize i = 0;
+    if(*size < k) {
+        //Sift up from the new last position
+        for(i = (*size)++; i > 0 && heap[(i - 1)/2].dist_sq < dist_sq; i = (i - 1)/2)
+            heap[i] = heap[(i - 1)/2];
+    }
+    else {
+        //Replace the root and sift down
+        for(;;) {
+            isize child = 2*i + 1;
+            if(child >= k)
+                break;
+            if(child + 1 < k && heap[child + 1].dist_sq > heap[child].dist_sq)
+                child += 1;
+            if(heap[child].dist_sq <= dist_sq)
+                break;
+            heap[i] = heap[child];
+            i = child;
+        }
+    }
+    heap[i].index = index;
+    heap[i].dist_sq = dist_sq;
+}
+
+EXTERNAL isize spatial_kd_tree_knn(const Spatial_KD_Tree* tree, Vec3 point, isize k, Spatial_Neighbor* neighbors)
+{
+    isize found = 0;
+    if(k <= 0 || tree->node_count == 0)
+        return 0;
+
+    _Spatial_KD_Entry stack[_SPATIAL_KD_STACK];
+    isize stack_size = 0;
+    _Spatial_KD_Entry root = {0, 0};
+    stack[stack_size++] = root;
+    while(stack_size > 0)
+    {
+        _Spatial_KD_Entry entry = stack[--stack_size];
+        float worst = found < k ? INFINITY : neighbors[0].dist_sq;
+        if(entry.dist_sq > worst)
+            continue;
+
+        const Spatial_KD_Node* node = &tree->nodes[entry.node];
+        if(node->axis != _SPATIAL_KD_LEAF_AXIS)
+            stack_size = _spatial_kd_push_children(node, entry.node, point, entry.dist_sq, stack, stack_size);
+        else {
+            isize first = node->right_or_first;
+            isize end = first + node->count;
+            for(isize i = first; i < end; i += 4) {
+                float dist_sq[4];
+                _spatial_kd_dist4(tree, i, point, dist_sq);
+                for(isize l = 0; l < 4 && i + l < end; l++)
+                    if(found < k || dist_sq[l] < neighbors[0].dist_sq)
+                        _spatial_knn_push(neighbors, &found, k, tree->indices[i + l], dist_sq[l]);
+            }
+        }
+    }
+
+    //Heap sort into ascending order
+    for(isize size = found; size > 1; ) {
+        Spatial_Neighbor last = neighbors[size - 1];
+        neighbors[size - 1] = neighbors[0];
+        size -= 1;
+        _spatial_knn_push(neighbors, &size, size, last.index, last.dist_sq);
+    }
+    return found;
+}
+
+INTERNAL bool _spatial_kd_tree_query_radius(const Spatial_KD_Tree* tree, Vec3 center, float radius, isize query, Spatial_Found_Func found, void* context)
+{
+    if(tree->node_count == 0)
+        return true;
+
+    float radius_sq = radius*radius;
+    _Spatial_KD_Entry stack[_SPATIAL_KD_STACK];
+    isize stack_size = 0;
+    _Spatial_KD_Entry root = {0, 0};
+    stack[stack_size++] = root;
+    while(stack_size > 0)
+    {
+        _Spatial_KD_Entry entry = stack[--stack_size];
+        if(entry.dist_sq > radius_sq)
+            continue;
+
+        const Spatial_KD_Node* node = &tree->nodes[entry.node];
+        if(node->axis != _SPATIAL_KD_LEAF_AXIS)
+            stack_size = _spatial_kd_push_children(node, entry.node, center, entry.dist_sq, stack, stack_size);
+        else {
+            isize first = node->right_or_first;
+            isize end = first + node->count;
+            for(isize i = first; i < end; i += 4) {
+                float dist_sq[4];
+                _spatial_kd_dist4(tree, i, center, dist_sq);
+                for(isize l = 0; l < 4 && i + l < end; l++)
+                    if(dist_sq[l] <= radius_sq)
+                        if(found(context, query, tree->indices[i + l]) == false)
+                            return false;
+            }
+        }
+    }
+    return true;
+}
+
+EXTERNAL bool spatial_kd_tree_query_radius(const Spatial_KD_Tree* tree, Vec3 center, float radius, Spatial_Found_Func found, void* context)
+{
+    return _spatial_kd_tree_query_radius(tree, center, radius, 0, found, context);
+}
+
+INTERNAL void _spatial_kd_knn_chunk(void* context, isize from, isize to, isize thread_index)
+{
+    (void) thread_index;
+    _Spatial_Batch* batch = (_Spatial_Batch*) context;
+    const Vec3* points = (const Vec3*) batch->queries;
+    Spatial_Neighbor* neighbors = (Spatial_Neighbor*) batch->results;
+    for(isize i = from; i < to; i++) {
+        Spatial_Neighbor* into = neighbors + i*batch->k;
+        isize found = spatial_kd_tree_knn((const Spatial_KD_Tree*) batch->tree, points[i], batch->k, into);
+        for(isize j = found; j < batch->k; j++) {
+            into[j].index = -1;
+            into[j].dist_sq = INFINITY;
+        }
+    }
+}
+
+EXTERNAL void spatial_kd_tree_knn_batch(const Spatial_KD_Tree* tree, const Vec3* points, isize count, isize k, Spatial_Neighbor* neighbors, isize thread_count_or_zero)
+{
+    PROFILE_START();
+    _Spatial_Batch batch = {tree, points, neighbors, k};
+    parallel_for(count, _SPATIAL_BATCH_CHUNK, thread_count_or_zero, _spatial_kd_knn_chunk, &batch, "spatial");
+    PROFILE_STOP();
+}
+
+#endif
@@ -6,6 +6,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdarg.h>
+#include "allocator_dispatch_default.h"
 
 #ifdef MODULE_ALL_COUPLED
     #include "assert.h"
@@ -380,7 +381,7 @@ EXTERNAL bool line_iterator_next(Line_Iterator* iterator, String string);
 
     EXTERNAL String string_allocate(Allocator* alloc, String string)
     {
-        char* data = (char*) (*alloc)(alloc, 0, string.count + 1, NULL, 0, 1, NULL);
+        char* data = (char*) ALLOCATOR_DISPATCH(alloc, string.count + 1, NULL, 0, 1);
         memcpy(data, string.data, (size_t) string.count);
         data[string.count] = '\0';
         String out = {data, string.count};
@@ -390,7 +391,7 @@ EXTERNAL bool line_iterator_next(Line_Iterator* iterator, String string);
     EXTERNAL void string_deallocate(Allocator* alloc, String* string)
     {
         if(string->data != NULL)
-            (char*) (*alloc)(alloc, 0, 0, (void*) string->data, string->count + 1, 1, NULL);
+            ALLOCATOR_DISPATCH(alloc, 0, (void*) string->data, string->count + 1, 1);
         String nil = {0};
         *string = nil;
     }
@@ -434,7 +435,7 @@ EXTERNAL bool line_iterator_next(Line_Iterator* iterator, String string);
     {
         ASSERT_SLOW(builder_is_consistent(*builder));
         if(builder->data != NULL && builder->data != _builder_null_termination)
-            (*builder->allocator)(builder->allocator, 0, 0, builder->data, builder->capacity + 1, 1, NULL);
+            ALLOCATOR_DISPATCH(builder->allocator, 0, builder->data, builder->capacity + 1, 1);
     
         memset(builder, 0, sizeof *builder);
     }
@@ -499,7 +500,7 @@ EXTERNAL bool line_iterator_next(Line_Iterator* iterator, String string);
         if(capacity == 0)
             new_alloced = 0;
 
-        builder->data = (char*) (*builder->allocator)(builder->allocator, 0, new_alloced, old_data, old_alloced, 1, NULL);
+        builder->data = (char*) ALLOCATOR_DISPATCH(builder->allocator, new_alloced, old_data, old_alloced, 1);
         
         //Always memset the new capacity to zero so that that we dont have to set null termination
         //while pushing
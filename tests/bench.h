@@ -0,0 +1,236 @@
+#pragma once
+
+//Shared infrastructure of the bench_ functions run by `make bench`.
+//
+// Each benchmark measures a fixed amount of work BENCH_REPEATS times and keeps the fastest run.
+// The result is then reported with bench_report which logs it and appends one machine readable line
+//    name,size,threads,ns_per_op,mb_per_s
+// to the results file. Since the benchmarks run in forked processes the file is the only thing
+// shared with the runner, which afterwards matches the lines against a stored baseline by
+// (name, size, threads) and flags everything slower than the threshold as a regression.
+//
+// The baseline is specific to the machine it was recorded on, so regressions only fail the run
+// when asked to with --check. To check a change record a local baseline before it and compare
+// against that after it:
+//    make bench ARGS="--baseline build/bench_baseline.csv --save-baseline"
+//    make bench ARGS="--baseline build/bench_baseline.csv --check"
+
+#include "../time.h"
+#include "../log.h"
+#include "../allocator.h"
+#include "../array.h"
+#include "../hash_func.h"
+#include "../parallel.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#define BENCH_REPEATS 5
+#define BENCH_CSV_HEADER "name,size,threads,ns_per_op,mb_per_s\n"
+
+typedef struct Bench_Options {
+    const char* results_path;
+    const char* baseline_path;
+    double threshold;          //relative slowdown counted as a regression. 0.25 means 25% slower
+    bool save_baseline;        //overwrites the baseline with the new results
+    bool check;                //regressions fail the run
+} Bench_Options;
+
+static Bench_Options bench_options = {"bench_results.csv", "tests/bench_baseline.csv", 0.25, false, false};
+
+typedef struct Bench_Time {
+    int64_t start;
+    int64_t best;   //duration of the fastest repeat in ns
+    int32_t repeats;
+    int32_t _;
+} Bench_Time;
+
+typedef struct Bench_Result {
+    char name[64];
+    int64_t size;
+    int64_t threads;
+    double ns_per_op;
+    double mb_per_s;
+} Bench_Result;
+
+INTERNAL void bench_time_start(Bench_Time* time)
+{
+    time->start = clock_ns();
+}
+
+INTERNAL void bench_time_stop(Bench_Time* time)
+{
+    int64_t duration = clock_ns() - time->start;
+    if(time->repeats == 0 || duration < time->best)
+        time->best = duration;
+    time->repeats += 1;
+}
+
+//Reports the best of the measured repeats, each of which did ops operations processing bytes bytes (or 0 if throughput makes no sense).
+INTERNAL void bench_report(const Bench_Time* time, const char* name, isize size, isize threads, isize ops, isize bytes)
+{
+    Bench_Result result = {0};
+    double seconds = (double) MAX(time->best, 1)/1e9;
+    snprintf(result.name, sizeof result.name, "%s", name);
+    result.size = size;
+    result.threads = threads;
+    result.ns_per_op = seconds*1e9/(double) MAX(ops, 1);
+    result.mb_per_s = (double) bytes/seconds/1e6;
+
+    if(bytes > 0)
+        LOG_INFO("BENCH", "%-24s size %8lli threads %2lli: %10.3lfns/op %10.2lfMB/s", name, (long long) size, (long long) threads, result.ns_per_op, result.mb_per_s);
+    else
+        LOG_INFO("BENCH", "%-24s size %8lli threads %2lli: %10.3lfns/op", name, (long long) size, (long long) threads, result.ns_per_op);
+
+    //Opened for each line so that concurrently running benchmark processes can append without coordination
+    FILE* file = fopen(bench_options.results_path, "ab");
+    if(file) {
+        fprintf(file, "%s,%lli,%lli,%.4lf,%.4lf\n", result.name, (long long) result.size, (long long) result.threads, result.ns_per_op, result.mb_per_s);
+        fclose(file);
+    }
+    else
+        LOG_WARN("BENCH", "could not open results file '%s'", bench_options.results_path);
+}
+
+typedef Array(Bench_Result) Bench_Result_Array;
+
+//Reads all results from a file written by bench_report. Returns false if the file could not be opened.
+INTERNAL bool bench_read_results(const char* path, Bench_Result_Array* results)
+{
+    FILE* file = fopen(path, "rb");
+    if(file == NULL)
+        return false;
+
+    char line[256];
+    while(fgets(line, sizeof line, file))
+    {
+        Bench_Result result = {0};
+        long long size = 0;
+        long long threads = 0;
+        if(sscanf(line, "%63[^,],%lli,%lli,%lf,%lf", result.name, &size, &threads, &result.ns_per_op, &result.mb_per_s) != 5)
+            continue; //header or garbage
+
+        result.size = size;
+        result.threads = threads;
+        array_push(results, result);
+    }
+    fclose(file);
+    return true;
+}
+
+INTERNAL void bench_reset_results()
+{
+    FILE* file = fopen(bench_options.results_path, "wb");
+    if(file) {
+        fputs(BENCH_CSV_HEADER, file);
+        fclose(file);
+    }
+}
+
+//Compares the results file against the baseline. Logs every result and returns the number of regressions.
+INTERNAL isize bench_compare_baseline()
+{
+    Bench_Result_Array results = {allocator_get_default()};
+    Bench_Result_Array baseline = {allocator_get_default()};
+    bool has_results = bench_read_results(bench_options.results_path, &results);
+    bool has_baseline = bench_read_results(bench_options.baseline_path, &baseline);
+    isize regressions = 0;
+    if(has_baseline == false)
+        LOG_INFO("BENCH", "no baseline at '%s'. Record one with --save-baseline", bench_options.baseline_path);
+    else
+    {
+        LOG_INFO("BENCH", "comparing %lli results against baseline '%s' (threshold %.0lf%%)", (long long) results.count, bench_options.baseline_path, bench_options.threshold*100);
+        for(isize i = 0; i < results.count; i++)
+        {
+            Bench_Result* curr = &results.data[i];
+            Bench_Result* base = NULL;
+            for(isize j = 0; j < baseline.count; j++)
+                if(strcmp(baseline.data[j].name, curr->name) == 0 && baseline.data[j].size == curr->size && baseline.data[j].threads == curr->threads) {
+                    base = &baseline.data[j];
+                    break;
+                }
+
+            if(base == NULL) {
+                LOG_INFO("BENCH", "%-24s size %8lli threads %2lli: %10.3lfns/op (not in baseline)", curr->name, (long long) curr->size, (long long) curr->threads, curr->ns_per_op);
+                continue;
+            }
+
+            double change = curr->ns_per_op/MAX(base->ns_per_op, 1e-9) - 1;
+            if(change > bench_options.threshold) {
+                regressions += 1;
+                LOG_ERROR("BENCH", "%-24s size %8lli threads %2lli: %10.3lfns/op was %10.3lfns/op %+7.1lf%% REGRESSION", curr->name, (long long) curr->size, (long long) curr->threads, curr->ns_per_op, base->ns_per_op, change*100);
+            }
+            else if(change < -bench_options.threshold)
+                LOG_OKAY("BENCH", "%-24s size %8lli threads %2lli: %10.3lfns/op was %10.3lfns/op %+7.1lf%%", curr->name, (long long) curr->size, (long long) curr->threads, curr->ns_per_op, base->ns_per_op, change*100);
+            else
+                LOG_INFO("BENCH", "%-24s size %8lli threads %2lli: %10.3lfns/op was %10.3lfns/op %+7.1lf%%", curr->name, (long long) curr->size, (long long) curr->threads, curr->ns_per_op, base->ns_per_op, change*100);
+        }
+    }
+
+    if(bench_options.save_baseline && has_results)
+    {
+        FILE* file = fopen(bench_options.baseline_path, "wb");
+        if(file) {
+            fputs(BENCH_CSV_HEADER, file);
+            for(isize i = 0; i < results.count; i++) {
+                Bench_Result result = results.data[i];
+                fprintf(file, "%s,%lli,%lli,%.4lf,%.4lf\n", result.name, (long long) result.size, (long long) result.threads, result.ns_per_op, result.mb_per_s);
+            }
+            fclose(file);
+            LOG_OKAY("BENCH", "saved %lli results as baseline '%s'", (long long) results.count, bench_options.baseline_path);
+        }
+        else
+            LOG_ERROR("BENCH", "could not write baseline '%s'", bench_options.baseline_path);
+    }
+
+    array_deinit(&baseline);
+    array_deinit(&results);
+    return regressions;
+}
+
+//Fills into with deterministic text made of words from a small vocabulary. Compresses about as well as real prose.
+INTERNAL void bench_fill_text(char* into, isize size)
+{
+    static const char* words[] = {
+        "the", "of", "and", "to", "in", "is", "that", "for", "it", "as", "was", "with", "be", "by", "on", "not",
+        "he", "this", "are", "or", "his", "from", "at", "which", "but", "have", "an", "had", "they", "you", "were", "their",
+        "benchmark", "allocator", "compression", "throughput", "structure", "memory", "channel", "queue", 
+    };
+    isize i = 0;
+    for(uint64_t w = 0; i < size; w++) {
+        const char* word = words[hash64_bijective(w) % ARRAY_COUNT(words)];
+        for(isize j = 0; word[j] && i < size; j++)
+            into[i++] = word[j];
+        if(i < size)
+            into[i++] = w % 13 == 12 ? '\n' : ' ';
+    }
+}
+
+//Runs func(context, thread_index) on thread_count threads (including the calling one as thread 0)
+// and returns once all of them finish. Unlike parallel_run the threads wait for each other before 
+// calling func so the measured section does not include the thread launches.
+typedef Parallel_Func Bench_Thread_Func;
+
+typedef struct _Bench_Threads {
+    Bench_Thread_Func func;
+    void* context;
+    isize thread_count;
+    _Atomic(uint32_t) ready;
+} _Bench_Threads;
+
+INTERNAL void _bench_thread_func(void* context, isize thread_index)
+{
+    _Bench_Threads* threads = (_Bench_Threads*) context;
+    atomic_fetch_add(&threads->ready, 1);
+    while(atomic_load(&threads->ready) != threads->thread_count) 
+        platform_thread_yield();
+
+    threads->func(threads->context, thread_index);
+}
+
+INTERNAL void bench_run_threads(isize thread_count, Bench_Thread_Func func, void* context)
+{
+    _Bench_Threads threads = {func, context, thread_count};
+    parallel_run(thread_count, _bench_thread_func, &threads, "bench");
+}
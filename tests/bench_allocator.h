@@ -0,0 +1,133 @@
+#pragma once
+
+#include "bench.h"
+#include "../allocator.h"
+#include "../allocator_tlsf.h"
+#include "../arena.h"
+#include "../scratch.h"
+#include "../random.h"
+
+#define _BENCH_ALLOCATOR_BATCH  1024
+#define _BENCH_ALLOCATOR_ROUNDS 64
+
+typedef struct _Bench_Allocator {
+    isize size;
+    const uint16_t* free_order;
+} _Bench_Allocator;
+
+//Each round allocates a batch of blocks, touches them and frees them in random order
+INTERNAL void _bench_allocator_malloc_thread(void* context, isize index)
+{
+    (void) index;
+    _Bench_Allocator* bench = (_Bench_Allocator*) context;
+    Allocator* alloc = allocator_get_malloc();
+    void* ptrs[_BENCH_ALLOCATOR_BATCH];
+    for(isize round = 0; round < _BENCH_ALLOCATOR_ROUNDS; round++) {
+        for(isize i = 0; i < _BENCH_ALLOCATOR_BATCH; i++) {
+            ptrs[i] = allocator_allocate(alloc, bench->size, 8);
+            *(uint8_t*) ptrs[i] = (uint8_t) i;
+        }
+        for(isize i = 0; i < _BENCH_ALLOCATOR_BATCH; i++)
+            allocator_deallocate(alloc, ptrs[bench->free_order[i]], bench->size, 8);
+    }
+}
+
+//Allocation followed by deallocation of blocks of different sizes with malloc, tlsf, arena and scratch allocators. 
+//Only malloc is thread safe so it is the only one measured with multiple threads, each doing the full amount of work.
+INTERNAL void bench_allocator(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {OPS = _BENCH_ALLOCATOR_BATCH*_BENCH_ALLOCATOR_ROUNDS};
+    uint16_t free_order[_BENCH_ALLOCATOR_BATCH] = {0};
+    for(isize i = 0; i < _BENCH_ALLOCATOR_BATCH; i++)
+        free_order[i] = (uint16_t) i;
+    for(isize i = _BENCH_ALLOCATOR_BATCH - 1; i > 0; i--) {
+        isize j = random_range(0, i + 1);
+        SWAP(&free_order[i], &free_order[j]);
+    }
+
+    isize sizes[] = {16, 256, 4096};
+    for(isize s = 0; s < ARRAY_COUNT(sizes); s++)
+    {
+        isize size = sizes[s];
+        _Bench_Allocator bench = {size, free_order};
+
+        isize thread_counts[] = {1, 2, 4};
+        for(isize t = 0; t < ARRAY_COUNT(thread_counts); t++) {
+            Bench_Time time = {0};
+            for(isize r = 0; r < BENCH_REPEATS; r++) {
+                bench_time_start(&time);
+                bench_run_threads(thread_counts[t], _bench_allocator_malloc_thread, &bench);
+                bench_time_stop(&time);
+            }
+            bench_report(&time, "allocator.malloc", size, thread_counts[t], OPS*thread_counts[t], 0);
+        }
+
+        //Tlsf
+        {
+            isize memory_size = (size + 64)*_BENCH_ALLOCATOR_BATCH*2;
+            isize node_memory_size = (_BENCH_ALLOCATOR_BATCH + 16)*sizeof(Tlsf_Node);
+            void* memory = allocator_allocate(allocator_get_malloc(), memory_size, 64);
+            void* node_memory = allocator_allocate(allocator_get_malloc(), node_memory_size, 64);
+            Tlsf_Allocator tlsf = {0};
+            TEST(tlsf_init(&tlsf, memory, memory_size, node_memory, node_memory_size));
+
+            void* ptrs[_BENCH_ALLOCATOR_BATCH];
+            Bench_Time time = {0};
+            for(isize r = 0; r < BENCH_REPEATS; r++) {
+                bench_time_start(&time);
+                for(isize round = 0; round < _BENCH_ALLOCATOR_ROUNDS; round++) {
+                    for(isize i = 0; i < _BENCH_ALLOCATOR_BATCH; i++) {
+                        ptrs[i] = tlsf_malloc(&tlsf, size, 8, 0);
+                        *(uint8_t*) ptrs[i] = (uint8_t) i;
+                    }
+                    for(isize i = 0; i < _BENCH_ALLOCATOR_BATCH; i++)
+                        tlsf_free(&tlsf, ptrs[free_order[i]]);
+                }
+                bench_time_stop(&time);
+            }
+            bench_report(&time, "allocator.tlsf", size, 1, OPS, 0);
+
+            allocator_deallocate(allocator_get_malloc(), node_memory, node_memory_size, 64);
+            allocator_deallocate(allocator_get_malloc(), memory, memory_size, 64);
+        }
+
+        //Arena. Frees everything at once
+        {
+            Arena arena = {0};
+            TEST(arena_init(&arena, "bench arena", 0, 0) == 0);
+            Bench_Time time = {0};
+            for(isize r = 0; r < BENCH_REPEATS; r++) {
+                bench_time_start(&time);
+                for(isize round = 0; round < _BENCH_ALLOCATOR_ROUNDS; round++) {
+                    for(isize i = 0; i < _BENCH_ALLOCATOR_BATCH; i++) {
+                        uint8_t* ptr = (uint8_t*) arena_push_nonzero(&arena, size, 8, NULL);
+                        *ptr = (uint8_t) i;
+                    }
+                    arena_reset(&arena, 0);
+                }
+                bench_time_stop(&time);
+            }
+            bench_report(&time, "allocator.arena", size, 1, OPS, 0);
+            arena_deinit(&arena);
+        }
+
+        //Scratch. Frees everything at once on release
+        {
+            Bench_Time time = {0};
+            for(isize r = 0; r < BENCH_REPEATS; r++) {
+                bench_time_start(&time);
+                for(isize round = 0; round < _BENCH_ALLOCATOR_ROUNDS; round++) {
+                    Scratch scratch = global_scratch_acquire();
+                    for(isize i = 0; i < _BENCH_ALLOCATOR_BATCH; i++) {
+                        uint8_t* ptr = (uint8_t*) scratch_push_nonzero_generic(&scratch, size, 8, NULL);
+                        *ptr = (uint8_t) i;
+                    }
+                    scratch_release(&scratch);
+                }
+                bench_time_stop(&time);
+            }
+            bench_report(&time, "allocator.scratch", size, 1, OPS, 0);
+        }
+    }
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "bench.h"
+#include "../allocator_dispatch.h"
+#include "../array.h"
+#include "../string.h"
+#include "../hash.h"
+
+#define _BENCH_DISPATCH_CONTAINERS 256
+#define _BENCH_DISPATCH_ITEMS      32
+#define _BENCH_DISPATCH_FRAMES     256
+
+//The same allocators under a function allocator_dispatch does not know so that every growth takes the indirect call.
+static void* _bench_dispatch_scratch_indirect(void* self, int mode, isize new_size, void* old_ptr, isize old_size, isize align, void* rest)
+{
+    return scratch_allocator_func(self, mode, new_size, old_ptr, old_size, align, rest);
+}
+
+static void* _bench_dispatch_arena_indirect(void* self, int mode, isize new_size, void* old_ptr, isize old_size, isize align, void* rest)
+{
+    return arena_allocator_func(self, mode, new_size, old_ptr, old_size, align, rest);
+}
+
+//Many small containers built within a frame like a parser or a per request handler would.
+// Each container gets _BENCH_DISPATCH_ITEMS pushes of which about 5 grow it.
+ATTRIBUTE_INLINE_NEVER static uint64_t _bench_dispatch_scratch(Scratch_Arena* scratch_arena, bool indirect)
+{
+    uint64_t sum = 0;
+    for(isize f = 0; f < _BENCH_DISPATCH_FRAMES; f++)
+        SCRATCH_SCOPE_FROM(scratch, scratch_arena)
+        {
+            if(indirect)
+                scratch.alloc[0] = _bench_dispatch_scratch_indirect;
+
+            for(isize c = 0; c < _BENCH_DISPATCH_CONTAINERS; c++)
+            {
+                u32_Array array = {scratch.alloc};
+                String_Builder builder = builder_make(scratch.alloc, 0);
+                Hash hash = {0};
+                hash_init(&hash, scratch.alloc, 0);
+                for(isize i = 0; i < _BENCH_DISPATCH_ITEMS; i++)
+                {
+                    array_push(&array, (uint32_t) i);
+                    builder_append(&builder, STRING("item"));
+                    hash_insert(&hash, (uint64_t) (c*_BENCH_DISPATCH_ITEMS + i), (uint64_t) i + 2);
+                }
+                sum += (uint64_t) array.data[array.count - 1] + (uint64_t) builder.count + hash.count;
+            }
+        }
+    return sum;
+}
+
+//A single array reused for many short lists in an arena. Deinit resets the arena so every list grows from empty.
+ATTRIBUTE_INLINE_NEVER static uint64_t _bench_dispatch_arena(Arena* arena, bool indirect)
+{
+    arena->alloc[0] = indirect ? _bench_dispatch_arena_indirect : arena_allocator_func;
+
+    uint64_t sum = 0;
+    for(isize f = 0; f < _BENCH_DISPATCH_FRAMES; f++)
+        for(isize c = 0; c < _BENCH_DISPATCH_CONTAINERS; c++)
+        {
+            u32_Array array = {arena->alloc};
+            for(isize i = 0; i < _BENCH_DISPATCH_ITEMS*3; i++)
+                array_push(&array, (uint32_t) i);
+            sum += (uint64_t) array.data[array.count - 1];
+            array_deinit(&array);
+        }
+
+    arena->alloc[0] = arena_allocator_func;
+    return sum;
+}
+
+//Container heavy code over Scratch and Arena with growth going through the indirect allocator call
+// against allocator_dispatch serving it inline.
+INTERNAL void bench_allocator_dispatch(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {OPS = _BENCH_DISPATCH_FRAMES*_BENCH_DISPATCH_CONTAINERS*_BENCH_DISPATCH_ITEMS*3};
+    Scratch_Arena scratch_arena = {0};
+    Arena arena = {0};
+    TEST(scratch_arena_init(&scratch_arena, "bench_allocator_dispatch", 0, 0, 0) == 0);
+    TEST(arena_init(&arena, "bench_allocator_dispatch", 0, 0) == 0);
+
+    const char* names[2][2] = {
+        {"dispatch.scratch_indirect", "dispatch.scratch_inline"},
+        {"dispatch.arena_indirect", "dispatch.arena_inline"},
+    };
+
+    for(isize kind = 0; kind < 2; kind++)
+    {
+        uint64_t sums[2] = {0};
+        for(isize inline_i = 0; inline_i < 2; inline_i++)
+        {
+            Bench_Time time = {0};
+            for(isize r = 0; r < BENCH_REPEATS; r++) {
+                bench_time_start(&time);
+                if(kind == 0)
+                    sums[inline_i] = _bench_dispatch_scratch(&scratch_arena, inline_i == 0);
+                else
+                    sums[inline_i] = _bench_dispatch_arena(&arena, inline_i == 0);
+                bench_time_stop(&time);
+            }
+            bench_report(&time, names[kind][inline_i], _BENCH_DISPATCH_ITEMS, 1, OPS, 0);
+        }
+        TEST(sums[0] == sums[1]);
+    }
+
+    arena_deinit(&arena);
+    scratch_arena_deinit(&scratch_arena);
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "bench.h"
+#include "../allocator_tracking.h"
+#include "../random.h"
+
+#define _BENCH_TRACKING_SLOTS 4096
+#define _BENCH_TRACKING_OPS   (1 << 20)
+
+//Allocation churn over a live set of _BENCH_TRACKING_SLOTS blocks of 8 to 1024 bytes made from four different sites.
+// Each op frees a random slot and fills it with a new allocation.
+ATTRIBUTE_INLINE_NEVER static uint64_t _bench_tracking_churn(Allocator* alloc, uint8_t** ptrs, isize* sizes, const uint32_t* randoms)
+{
+    uint64_t sum = 0;
+    for(isize i = 0; i < _BENCH_TRACKING_OPS; i++) {
+        uint32_t random = randoms[i];
+        isize slot = random % _BENCH_TRACKING_SLOTS;
+        isize size = 8 + (random >> 16) % 1017;
+
+        if(ptrs[slot])
+            DEALLOCATE(alloc, ptrs[slot], sizes[slot], uint8_t);
+        switch(random >> 30) {
+            case 0:  ptrs[slot] = ALLOCATE(alloc, size, uint8_t); break;
+            case 1:  ptrs[slot] = ALLOCATE(alloc, size, uint8_t); break;
+            case 2:  ptrs[slot] = ALLOCATE(alloc, size, uint8_t); break;
+            default: ptrs[slot] = ALLOCATE(alloc, size, uint8_t); break;
+        }
+        sizes[slot] = size;
+        sum += (uint64_t) size;
+    }
+
+    for(isize slot = 0; slot < _BENCH_TRACKING_SLOTS; slot++) {
+        if(ptrs[slot])
+            DEALLOCATE(alloc, ptrs[slot], sizes[slot], uint8_t);
+        ptrs[slot] = NULL;
+    }
+    return sum;
+}
+
+//Allocation immediately followed by its free. Everything stays in cache so this shows the per call overhead.
+ATTRIBUTE_INLINE_NEVER static uint64_t _bench_tracking_pairs(Allocator* alloc, const uint32_t* randoms)
+{
+    uint64_t sum = 0;
+    for(isize i = 0; i < _BENCH_TRACKING_OPS; i++) {
+        isize size = 8 + (randoms[i] >> 16) % 1017;
+        uint8_t* ptr = NULL;
+        if(randoms[i] & 1)
+            ptr = ALLOCATE(alloc, size, uint8_t);
+        else
+            ptr = ALLOCATE(alloc, size, uint8_t);
+        ptr[0] = (uint8_t) size;
+        sum += ptr[0];
+        DEALLOCATE(alloc, ptr, size, uint8_t);
+    }
+    return sum;
+}
+
+//The parent allocator against Tracking_Allocator with and without per call site accounting under random churn 
+// over a large live set and under allocation/free pairs.
+INTERNAL void bench_allocator_tracking(f64 max_seconds)
+{
+    (void) max_seconds;
+    uint8_t** ptrs = (uint8_t**) calloc(_BENCH_TRACKING_SLOTS, sizeof(uint8_t*));
+    isize* sizes = (isize*) calloc(_BENCH_TRACKING_SLOTS, sizeof(isize));
+    uint32_t* randoms = (uint32_t*) malloc(_BENCH_TRACKING_OPS*sizeof(uint32_t));
+    for(isize i = 0; i < _BENCH_TRACKING_OPS; i++)
+        randoms[i] = (uint32_t) random_u64();
+
+    const char* names[2][3] = {
+        {"tracking_alloc.churn_parent", "tracking_alloc.churn_plain", "tracking_alloc.churn_sites"},
+        {"tracking_alloc.pairs_parent", "tracking_alloc.pairs_plain", "tracking_alloc.pairs_sites"},
+    };
+    for(isize pattern = 0; pattern < 2; pattern++) {
+        uint64_t sums[3] = {0};
+        for(isize kind = 0; kind < 3; kind++) {
+            Bench_Time time = {0};
+            for(isize r = 0; r < BENCH_REPEATS; r++) {
+                Tracking_Allocator tracking = {0};
+                Allocator* alloc = allocator_get_default();
+                if(kind > 0) {
+                    tracking_allocator_init(&tracking, "bench_allocator_tracking", kind == 2 ? TRACKING_ALLOCATOR_INIT_SITES : 0);
+                    tracking.parent = allocator_get_default();
+                    alloc = tracking.alloc;
+                }
+
+                bench_time_start(&time);
+                if(pattern == 0)
+                    sums[kind] = _bench_tracking_churn(alloc, ptrs, sizes, randoms);
+                else
+                    sums[kind] = _bench_tracking_pairs(alloc, randoms);
+                bench_time_stop(&time);
+                if(kind > 0)
+                    tracking_allocator_deinit(&tracking);
+            }
+            bench_report(&time, names[pattern][kind], 512, 1, _BENCH_TRACKING_OPS, 0);
+        }
+        TEST(sums[0] == sums[1] && sums[1] == sums[2]);
+    }
+
+    free(ptrs);
+    free(sizes);
+    free(randoms);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "bench.h"
+#include "../base64.h"
+#include "../random.h"
+
+//Encoding and decoding throughput of random bytes for different input sizes
+INTERNAL void bench_base64(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {TOTAL = 8 << 20};
+    Allocator* alloc = allocator_get_default();
+    isize sizes[] = {64, 4 << 10, 1 << 20};
+    for(isize s = 0; s < ARRAY_COUNT(sizes); s++)
+    {
+        isize size = sizes[s];
+        isize encoded_capacity = base64_encode_max_size(size);
+        isize decoded_capacity = base64_encode_max_size(encoded_capacity); //base64_decode checks against this
+        uint8_t* input = (uint8_t*) allocator_allocate(alloc, size, 8);
+        char* encoded = (char*) allocator_allocate(alloc, encoded_capacity, 8);
+        uint8_t* decoded = (uint8_t*) allocator_allocate(alloc, decoded_capacity, 8);
+        for(isize i = 0; i < size; i++)
+            input[i] = (uint8_t) random_u64();
+
+        isize iters = TOTAL/size;
+        isize encoded_size = 0;
+        Bench_Time encode_time = {0};
+        Bench_Time decode_time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++)
+        {
+            bench_time_start(&encode_time);
+            for(isize i = 0; i < iters; i++)
+                encoded_size = base64_encode(encoded, encoded_capacity, input, size, BASE64_ENCODING_STD, '=', BASE64_ENCODE_PAD);
+            bench_time_stop(&encode_time);
+
+            bench_time_start(&decode_time);
+            for(isize i = 0; i < iters; i++)
+                TEST(base64_decode(decoded, decoded_capacity, encoded, encoded_size, BASE64_DECODING_STD, '=', 0, NULL) == size);
+            bench_time_stop(&decode_time);
+            TEST(memcmp(input, decoded, size) == 0);
+        }
+
+        bench_report(&encode_time, "base64.encode", size, 1, iters, iters*size);
+        bench_report(&decode_time, "base64.decode", size, 1, iters, iters*size);
+        allocator_deallocate(alloc, decoded, decoded_capacity, 8);
+        allocator_deallocate(alloc, encoded, encoded_capacity, 8);
+        allocator_deallocate(alloc, input, size, 8);
+    }
+}
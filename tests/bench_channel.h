@@ -0,0 +1,65 @@
+#pragma once
+
+#include "bench.h"
+#include "../channel.h"
+
+#define _BENCH_CHANNEL_INFO SINIT(Channel_Info){sizeof(uint64_t), chan_wait_block, chan_wake_block}
+
+typedef struct _Bench_Channel {
+    Channel* chan;
+    isize producers;
+    isize items_per_thread;
+    _Atomic(uint64_t) checksum;
+} _Bench_Channel;
+
+//The first half of the threads push, the second half pops
+INTERNAL void _bench_channel_thread(void* context, isize index)
+{
+    _Bench_Channel* bench = (_Bench_Channel*) context;
+    if(index < bench->producers) {
+        for(isize i = 0; i < bench->items_per_thread; i++) {
+            uint64_t item = (uint64_t) i;
+            channel_push(bench->chan, &item, _BENCH_CHANNEL_INFO);
+        }
+    }
+    else {
+        uint64_t sum = 0;
+        for(isize i = 0; i < bench->items_per_thread; i++) {
+            uint64_t item = 0;
+            channel_pop(bench->chan, &item, _BENCH_CHANNEL_INFO);
+            sum += item;
+        }
+        atomic_fetch_add(&bench->checksum, sum);
+    }
+}
+
+//Throughput of passing u64 items from producers to the same number of consumers through channels of different capacities
+INTERNAL void bench_channel(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {ITEMS = 1 << 18};
+    isize capacities[] = {64, 4096};
+    isize thread_counts[] = {1, 2, 4};
+    for(isize c = 0; c < ARRAY_COUNT(capacities); c++)
+        for(isize t = 0; t < ARRAY_COUNT(thread_counts); t++)
+        {
+            isize producers = thread_counts[t];
+            Bench_Time time = {0};
+            for(isize r = 0; r < BENCH_REPEATS; r++)
+            {
+                _Bench_Channel bench = {0};
+                bench.chan = channel_malloc(capacities[c], _BENCH_CHANNEL_INFO);
+                bench.producers = producers;
+                bench.items_per_thread = ITEMS/producers;
+
+                bench_time_start(&time);
+                bench_run_threads(2*producers, _bench_channel_thread, &bench);
+                bench_time_stop(&time);
+
+                uint64_t per_thread = (uint64_t) bench.items_per_thread;
+                TEST(atomic_load(&bench.checksum) == per_thread*(per_thread - 1)/2*(uint64_t) producers);
+                channel_deinit(bench.chan);
+            }
+            bench_report(&time, "channel.push_pop", capacities[c], producers, ITEMS, 0);
+        }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "bench.h"
+#include "../allocator_debug.h"
+#include "../random.h"
+
+#define _BENCH_DEBUG_ALLOC_SLOTS 4096
+#define _BENCH_DEBUG_ALLOC_OPS   (1 << 20)
+
+//Allocation churn over a live set of _BENCH_DEBUG_ALLOC_SLOTS blocks of 8 to 1024 bytes.
+// Each op frees a random slot and fills it with a new allocation.
+ATTRIBUTE_INLINE_NEVER static uint64_t _bench_debug_alloc_churn(Allocator* alloc, void** ptrs, isize* sizes, const uint32_t* randoms)
+{
+    uint64_t sum = 0;
+    for(isize i = 0; i < _BENCH_DEBUG_ALLOC_OPS; i++) {
+        uint32_t random = randoms[i];
+        isize slot = random % _BENCH_DEBUG_ALLOC_SLOTS;
+        isize size = 8 + (random >> 16) % 1017;
+
+        if(ptrs[slot])
+            allocator_deallocate(alloc, ptrs[slot], sizes[slot], 8);
+        ptrs[slot] = allocator_allocate(alloc, size, 8);
+        sizes[slot] = size;
+        sum += (uint64_t) size;
+    }
+
+    for(isize slot = 0; slot < _BENCH_DEBUG_ALLOC_SLOTS; slot++) {
+        if(ptrs[slot])
+            allocator_deallocate(alloc, ptrs[slot], sizes[slot], 8);
+        ptrs[slot] = NULL;
+    }
+    return sum;
+}
+
+//The parent allocator against the hash based Debug_Allocator and its header tracked DEBUG_ALLOC_CHEAP mode.
+INTERNAL void bench_debug_allocator(f64 max_seconds)
+{
+    (void) max_seconds;
+    void** ptrs = (void**) calloc(_BENCH_DEBUG_ALLOC_SLOTS, sizeof(void*));
+    isize* sizes = (isize*) calloc(_BENCH_DEBUG_ALLOC_SLOTS, sizeof(isize));
+    uint32_t* randoms = (uint32_t*) malloc(_BENCH_DEBUG_ALLOC_OPS*sizeof(uint32_t));
+    for(isize i = 0; i < _BENCH_DEBUG_ALLOC_OPS; i++)
+        randoms[i] = (uint32_t) random_u64();
+
+    const char* names[] = {"debug_alloc.parent", "debug_alloc.hash", "debug_alloc.cheap"};
+    uint64_t sums[3] = {0};
+    for(isize kind = 0; kind < 3; kind++) {
+        Bench_Time time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++) {
+            Debug_Allocator debug = {0};
+            Allocator* alloc = allocator_get_default();
+            if(kind > 0) {
+                debug_allocator_init(&debug, alloc, kind == 2 ? DEBUG_ALLOC_CHEAP : 0);
+                alloc = debug.alloc;
+            }
+
+            bench_time_start(&time);
+            sums[kind] = _bench_debug_alloc_churn(alloc, ptrs, sizes, randoms);
+            bench_time_stop(&time);
+            debug_allocator_deinit(&debug);
+        }
+        bench_report(&time, names[kind], 512, 1, _BENCH_DEBUG_ALLOC_OPS, 0);
+    }
+    TEST(sums[0] == sums[1] && sums[1] == sums[2]);
+
+    free(ptrs);
+    free(sizes);
+    free(randoms);
+}
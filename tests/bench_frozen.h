@@ -0,0 +1,172 @@
+#pragma once
+
+#include "bench.h"
+#include "../frozen.h"
+#include "../stable.h"
+
+#if PLATFORM_OS == PLATFORM_OS_UNIX
+    #include <unistd.h>
+    #include <sys/wait.h>
+#endif
+
+#define _BENCH_FROZEN_WORKERS 32
+
+typedef struct _Bench_Frozen_Item {
+    uint64_t key;
+    uint64_t value;
+    uint32_t hits;      //per item statistic. Written by the workers when the data is not frozen
+    uint32_t _[9];
+} _Bench_Frozen_Item;
+
+typedef enum _Bench_Frozen_Work {
+    _BENCH_FROZEN_STABLE_READ,
+    _BENCH_FROZEN_STABLE_STATS,     //bumps hits of every 16th item (the alive ones at index % 16 == 1) in place
+    _BENCH_FROZEN_FROZEN_READ,
+    _BENCH_FROZEN_FROZEN_STATS,     //keeps the hits in worker private memory instead
+} _Bench_Frozen_Work;
+
+INTERNAL uint64_t _bench_frozen_work(Stable* stable, const Frozen* frozen, _Bench_Frozen_Work work, uint32_t* private_hits)
+{
+    uint64_t sum = 0;
+    if(work == _BENCH_FROZEN_STABLE_READ || work == _BENCH_FROZEN_STABLE_STATS) {
+        STABLE_FOR(stable, it, _Bench_Frozen_Item, item) {
+            sum += item->value;
+            if(work == _BENCH_FROZEN_STABLE_STATS && it.index % 16 == 1)
+                item->hits += 1;
+        }
+    }
+    else {
+        FROZEN_FOR(frozen, i) {
+            const _Bench_Frozen_Item* item = (const _Bench_Frozen_Item*) frozen_at(frozen, i);
+            sum += item->value;
+            if(work == _BENCH_FROZEN_FROZEN_STATS && i % 16 == 1)
+                private_hits[i / 16] += 1;
+        }
+    }
+    return sum;
+}
+
+//Returns the Private_Dirty memory of this process in kB or -1 if it cannot be determined.
+INTERNAL isize _bench_frozen_private_dirty_kb()
+{
+    isize out = -1;
+    FILE* file = fopen("/proc/self/smaps_rollup", "r");
+    if(file) {
+        char line[256];
+        while(fgets(line, sizeof line, file)) {
+            long long kb = 0;
+            if(sscanf(line, "Private_Dirty: %lld kB", &kb) == 1)
+                out = (isize) kb;
+        }
+        fclose(file);
+    }
+    return out;
+}
+
+//Forks _BENCH_FROZEN_WORKERS workers each running work over the shared data once. Returns the summed growth of their
+// private dirty memory - the memory the workers did not share with the parent - in kB or -1 if it cannot be measured.
+INTERNAL isize _bench_frozen_fork_workers(Stable* stable, const Frozen* frozen, _Bench_Frozen_Work work, uint64_t expected_sum)
+{
+    isize total_kb = 0;
+    #if PLATFORM_OS == PLATFORM_OS_UNIX
+        int pipes[_BENCH_FROZEN_WORKERS][2] = {0};
+        pid_t pids[_BENCH_FROZEN_WORKERS] = {0};
+        for(isize w = 0; w < _BENCH_FROZEN_WORKERS; w++) {
+            TEST(pipe(pipes[w]) == 0);
+            pids[w] = fork();
+            TEST(pids[w] >= 0);
+            if(pids[w] == 0) {
+                isize hits_count = stable_capacity(stable)/16 + 1;
+                uint32_t* private_hits = (uint32_t*) calloc((size_t) hits_count, sizeof(uint32_t));
+                isize before = _bench_frozen_private_dirty_kb();
+                uint64_t sum = _bench_frozen_work(stable, frozen, work, private_hits);
+                isize after = _bench_frozen_private_dirty_kb();
+
+                int64_t message[2] = {before < 0 ? -1 : after - before, (int64_t) sum};
+                ssize_t written = write(pipes[w][1], message, sizeof message);
+                _exit(written == sizeof message ? 0 : 1);
+            }
+            close(pipes[w][1]);
+        }
+
+        for(isize w = 0; w < _BENCH_FROZEN_WORKERS; w++) {
+            int64_t message[2] = {-1, 0};
+            TEST(read(pipes[w][0], message, sizeof message) == sizeof message);
+            close(pipes[w][0]);
+            waitpid(pids[w], NULL, 0);
+
+            TEST((uint64_t) message[1] == expected_sum);
+            if(message[0] < 0 || total_kb < 0)
+                total_kb = -1;
+            else
+                total_kb += (isize) message[0];
+        }
+    #else
+        (void) stable; (void) frozen; (void) work; (void) expected_sum;
+        total_kb = -1;
+    #endif
+    return total_kb;
+}
+
+//Iteration speed of Stable against its frozen copy and the memory which 32 forked workers stop sharing with the parent
+// while going once over a 64MB dataset. Workers of the stats variants also count hits of every 16th item.
+INTERNAL void bench_frozen(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {COUNT = 1 << 20};
+    Stable stable = {0};
+    stable_init(&stable, allocator_get_default(), sizeof(_Bench_Frozen_Item));
+
+    //Interleave the items with unrelated small allocations like a long running process would.
+    // Every 8th item is removed so that the blocks have holes.
+    void* unrelated[COUNT/64] = {0};
+    for(isize i = 0; i < COUNT; i++) {
+        _Bench_Frozen_Item item = {(uint64_t) i, (uint64_t) i*3};
+        stable_insert_value(&stable, &item);
+        if(i % 64 == 0)
+            unrelated[i/64] = malloc(48);
+    }
+    for(isize i = 0; i < COUNT; i += 8)
+        stable_remove(&stable, i);
+
+    Frozen frozen = {0};
+    Bench_Time freeze_time = {0};
+    for(isize r = 0; r < BENCH_REPEATS; r++) {
+        bench_time_start(&freeze_time);
+        TEST(frozen_from_stable(&frozen, &stable, SINIT(Platform_String){0}, NULL) == FROZEN_OK);
+        bench_time_stop(&freeze_time);
+    }
+    bench_report(&freeze_time, "frozen.freeze_stable", sizeof(_Bench_Frozen_Item), 1, stable.count, stable.count*(isize) sizeof(_Bench_Frozen_Item));
+
+    uint64_t expected = 0;
+    {
+        Bench_Time stable_time = {0};
+        Bench_Time frozen_time = {0};
+        uint64_t sums[2] = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++) {
+            bench_time_start(&stable_time);
+            sums[0] = _bench_frozen_work(&stable, &frozen, _BENCH_FROZEN_STABLE_READ, NULL);
+            bench_time_stop(&stable_time);
+
+            bench_time_start(&frozen_time);
+            sums[1] = _bench_frozen_work(&stable, &frozen, _BENCH_FROZEN_FROZEN_READ, NULL);
+            bench_time_stop(&frozen_time);
+        }
+        TEST(sums[0] == sums[1]);
+        expected = sums[0];
+        bench_report(&stable_time, "frozen.iterate_stable", sizeof(_Bench_Frozen_Item), 1, stable.count, 0);
+        bench_report(&frozen_time, "frozen.iterate_frozen", sizeof(_Bench_Frozen_Item), 1, stable.count, 0);
+    }
+
+    const char* names[] = {"stable read", "stable stats", "frozen read", "frozen stats"};
+    for(isize work = 0; work < ARRAY_COUNT(names); work++) {
+        isize kb = _bench_frozen_fork_workers(&stable, &frozen, (_Bench_Frozen_Work) work, expected);
+        LOG_INFO("BENCH", "frozen %-12s: %i workers over %.1lfMB of items stopped sharing %.1lfMB",
+            names[work], _BENCH_FROZEN_WORKERS, stable.count*(isize) sizeof(_Bench_Frozen_Item)/1e6, kb/1e3);
+    }
+
+    for(isize i = 0; i < COUNT/64; i++)
+        free(unrelated[i]);
+    frozen_close(&frozen);
+    stable_deinit(&stable);
+}
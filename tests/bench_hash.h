@@ -0,0 +1,97 @@
+#pragma once
+
+#include "bench.h"
+#include "../hash.h"
+#include "../hash_parallel.h"
+#include "../hash_func.h"
+#include "../random.h"
+
+//Insert, successful and unsuccessful lookups and removal of random hashes. 
+//Also the parallel bulk build over different thread counts.
+INTERNAL void bench_hash(f64 max_seconds)
+{
+    (void) max_seconds;
+    Allocator* alloc = allocator_get_default();
+    isize sizes[] = {1 << 10, 1 << 16, 1 << 20};
+    for(isize s = 0; s < ARRAY_COUNT(sizes); s++)
+    {
+        isize size = sizes[s];
+        uint64_t* order = (uint64_t*) allocator_allocate(alloc, size*sizeof(uint64_t), 8);
+        for(isize i = 0; i < size; i++)
+            order[i] = hash64_bijective((uint64_t) random_range(0, size));
+
+        Bench_Time insert_time = {0};
+        Bench_Time find_time = {0};
+        Bench_Time miss_time = {0};
+        Bench_Time remove_time = {0};
+        uint64_t checksum = 0;
+        for(isize r = 0; r < BENCH_REPEATS; r++)
+        {
+            Hash table = {0};
+            hash_init(&table, alloc, 0);
+
+            bench_time_start(&insert_time);
+            for(isize i = 0; i < size; i++)
+                hash_insert(&table, hash64_bijective((uint64_t) i), (uint64_t) i + 2);
+            bench_time_stop(&insert_time);
+
+            bench_time_start(&find_time);
+            for(isize i = 0; i < size; i++) {
+                isize found = 0;
+                if(hash_find(&table, order[i], &found))
+                    checksum += table.entries[found].value;
+            }
+            bench_time_stop(&find_time);
+
+            bench_time_start(&miss_time);
+            for(isize i = 0; i < size; i++) {
+                isize found = 0;
+                checksum += hash_find(&table, hash64_bijective((uint64_t) (size + i)), &found);
+            }
+            bench_time_stop(&miss_time);
+
+            bench_time_start(&remove_time);
+            for(isize i = 0; i < size; i++) {
+                isize found = 0;
+                if(hash_find(&table, hash64_bijective((uint64_t) i), &found))
+                    hash_remove(&table, found);
+            }
+            bench_time_stop(&remove_time);
+
+            TEST(table.count == 0);
+            hash_deinit(&table);
+        }
+
+        bench_report(&insert_time, "hash.insert", size, 1, size, 0);
+        bench_report(&find_time, "hash.find_hit", size, 1, size, 0);
+        bench_report(&miss_time, "hash.find_miss", size, 1, size, 0);
+        bench_report(&remove_time, "hash.remove", size, 1, size, 0);
+        TEST(checksum > 0);
+        allocator_deallocate(alloc, order, size*sizeof(uint64_t), 8);
+    }
+
+    enum {BUILD_SIZE = 1 << 20};
+    Hash_Entry* entries = (Hash_Entry*) allocator_allocate(alloc, BUILD_SIZE*sizeof(Hash_Entry), 8);
+    for(isize i = 0; i < BUILD_SIZE; i++) {
+        entries[i].hash = hash64_bijective((uint64_t) i);
+        entries[i].value = (uint64_t) i + 2;
+    }
+
+    isize thread_counts[] = {1, 2, 4};
+    for(isize t = 0; t < ARRAY_COUNT(thread_counts); t++)
+    {
+        Bench_Time build_time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++)
+        {
+            Hash table = {0};
+            hash_init(&table, alloc, 0);
+            bench_time_start(&build_time);
+            hash_insert_parallel(&table, entries, BUILD_SIZE, thread_counts[t]);
+            bench_time_stop(&build_time);
+            TEST(table.count == BUILD_SIZE);
+            hash_deinit(&table);
+        }
+        bench_report(&build_time, "hash.insert_parallel", BUILD_SIZE, thread_counts[t], BUILD_SIZE, 0);
+    }
+    allocator_deallocate(alloc, entries, BUILD_SIZE*sizeof(Hash_Entry), 8);
+}
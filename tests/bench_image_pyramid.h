@@ -0,0 +1,93 @@
+#pragma once
+
+#include "bench.h"
+#include "../image_pyramid.h"
+#include "../random.h"
+
+//Full mip chains of a 4096x4096 image in the common formats (RGBA8, gray U8 and gray F32 which hit the SSE box
+// paths, RGBA16 which does not) with both filters on 1 and 4 threads, then a summed area table of the gray U8
+// image with 32 and 64 bit sums and random rectangle queries against it.
+INTERNAL void bench_image_pyramid(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {SIZE = 4096, QUERIES = 1000000};
+    typedef struct {const char* name; Pixel_Type type; isize channels;} Bench_Format;
+    Bench_Format formats[] = {
+        {"rgba8", PIXEL_TYPE_U8, 4},
+        {"gray8", PIXEL_TYPE_U8, 1},
+        {"grayf32", PIXEL_TYPE_F32, 1},
+        {"rgba16", PIXEL_TYPE_U16, 4},
+    };
+    isize thread_counts[] = {1, 4};
+    Allocator* alloc = allocator_get_default();
+
+    Image_Pyramid pyramid = {0};
+    image_pyramid_init(&pyramid, alloc);
+    for(isize f = 0; f < ARRAY_COUNT(formats); f++) {
+        Bench_Format format = formats[f];
+        Image image = {0};
+        image_init_sized(&image, alloc, SIZE, SIZE, pixel_type_size(format.type)*format.channels, format.type, NULL);
+        if(format.type == PIXEL_TYPE_F32)
+            for(isize i = 0; i < image_pixel_count(image); i++)
+                ((float*) (void*) image.pixels)[i] = random_f32();
+        else
+            random_bytes(image.pixels, image_byte_size(image));
+
+        for(isize filter = IMAGE_FILTER_BOX; filter <= IMAGE_FILTER_KAISER; filter++)
+            for(isize t = 0; t < ARRAY_COUNT(thread_counts); t++) {
+                Bench_Time time = {0};
+                for(isize r = 0; r < BENCH_REPEATS; r++) {
+                    bench_time_start(&time);
+                    image_pyramid_build(&pyramid, subimage_of(image), (Image_Filter) filter, 0, thread_counts[t]);
+                    bench_time_stop(&time);
+                }
+
+                char name[64] = {0};
+                snprintf(name, sizeof name, "image_pyramid.%s_%s", filter == IMAGE_FILTER_BOX ? "box" : "kaiser", format.name);
+                bench_report(&time, name, SIZE*SIZE, thread_counts[t], SIZE*SIZE, image_byte_size(image));
+            }
+
+        if(f == 1) {
+            Pixel_Type sum_types[] = {PIXEL_TYPE_U32, PIXEL_TYPE_U64};
+            isize* rects = (isize*) allocator_allocate(alloc, QUERIES*4*sizeof(isize), 8);
+            for(isize q = 0; q < QUERIES; q++) {
+                isize* rect = rects + 4*q;
+                rect[0] = random_range(0, SIZE + 1);
+                rect[1] = random_range(0, SIZE + 1);
+                rect[2] = random_range(rect[0], SIZE + 1);
+                rect[3] = random_range(rect[1], SIZE + 1);
+            }
+
+            Image integral = {0};
+            image_init_unshaped(&integral, alloc);
+            for(isize s = 0; s < ARRAY_COUNT(sum_types); s++) {
+                Bench_Time build_time = {0};
+                Bench_Time query_time = {0};
+                uint64_t checksum = 0;
+                for(isize r = 0; r < BENCH_REPEATS; r++) {
+                    bench_time_start(&build_time);
+                    image_integral_build(&integral, subimage_of(image), sum_types[s]);
+                    bench_time_stop(&build_time);
+
+                    bench_time_start(&query_time);
+                    for(isize q = 0; q < QUERIES; q++) {
+                        isize* rect = rects + 4*q;
+                        uint64_t sum = 0;
+                        image_integral_sum(integral, rect[0], rect[1], rect[2], rect[3], &sum);
+                        checksum += sum;
+                    }
+                    bench_time_stop(&query_time);
+                }
+                bench_report(&build_time, sum_types[s] == PIXEL_TYPE_U32 ? "image_pyramid.integral_build_u32" : "image_pyramid.integral_build_u64",
+                    SIZE*SIZE, 1, SIZE*SIZE, image_byte_size(image));
+                bench_report(&query_time, sum_types[s] == PIXEL_TYPE_U32 ? "image_pyramid.integral_sum_u32" : "image_pyramid.integral_sum_u64",
+                    SIZE*SIZE, 1, QUERIES, 0);
+                TEST(checksum != 0);
+            }
+            image_deinit(&integral);
+            allocator_deallocate(alloc, rects, QUERIES*4*sizeof(isize), 8);
+        }
+        image_deinit(&image);
+    }
+    image_pyramid_deinit(&pyramid);
+}
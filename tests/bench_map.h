@@ -0,0 +1,88 @@
+#pragma once
+
+#include "bench.h"
+#include "../map.h"
+#include "../hash_func.h"
+#include "../random.h"
+
+typedef struct _Bench_Map_Entry {
+    uint64_t hash;
+    uint64_t key;
+    uint64_t value;
+} _Bench_Map_Entry;
+
+//Keys are unique because hash64_bijective is a bijection so comparing hashes is enough
+#define _BENCH_MAP_INFO SINIT(Map_Info){sizeof(_Bench_Map_Entry), __alignof(_Bench_Map_Entry), offsetof(_Bench_Map_Entry, key), offsetof(_Bench_Map_Entry, hash), NULL}
+
+INTERNAL uint64_t _bench_map_hash(uint64_t key)
+{
+    return map_hash_escape(hash64_bijective(key));
+}
+
+//Insert, successful and unsuccessful lookups and removal of u64 keys in a random order
+INTERNAL void bench_map(f64 max_seconds)
+{
+    (void) max_seconds;
+    Allocator* alloc = allocator_get_default();
+    isize sizes[] = {1 << 10, 1 << 16, 1 << 20};
+    for(isize s = 0; s < ARRAY_COUNT(sizes); s++)
+    {
+        isize size = sizes[s];
+        uint64_t* order = (uint64_t*) allocator_allocate(alloc, size*sizeof(uint64_t), 8);
+        for(isize i = 0; i < size; i++)
+            order[i] = (uint64_t) random_range(0, size);
+
+        Bench_Time insert_time = {0};
+        Bench_Time find_time = {0};
+        Bench_Time miss_time = {0};
+        Bench_Time remove_time = {0};
+        uint64_t checksum = 0;
+        for(isize r = 0; r < BENCH_REPEATS; r++)
+        {
+            Map map = {0};
+            map_init(&map, _BENCH_MAP_INFO, alloc);
+
+            bench_time_start(&insert_time);
+            for(isize i = 0; i < size; i++) {
+                _Bench_Map_Entry entry = {_bench_map_hash((uint64_t) i), (uint64_t) i, (uint64_t) i};
+                map_insert(&map, _BENCH_MAP_INFO, &entry);
+            }
+            bench_time_stop(&insert_time);
+
+            bench_time_start(&find_time);
+            for(isize i = 0; i < size; i++) {
+                isize found = 0;
+                if(map_find(&map, _BENCH_MAP_INFO, &order[i], _bench_map_hash(order[i]), &found))
+                    checksum += ((_Bench_Map_Entry*) (void*) map.entries)[found].value;
+            }
+            bench_time_stop(&find_time);
+
+            bench_time_start(&miss_time);
+            for(isize i = 0; i < size; i++) {
+                isize found = 0;
+                uint64_t key = order[i] + (uint64_t) size;
+                checksum += map_find(&map, _BENCH_MAP_INFO, &key, _bench_map_hash(key), &found);
+            }
+            bench_time_stop(&miss_time);
+
+            bench_time_start(&remove_time);
+            for(isize i = 0; i < size; i++) {
+                isize found = 0;
+                uint64_t key = (uint64_t) i;
+                if(map_find(&map, _BENCH_MAP_INFO, &key, _bench_map_hash(key), &found))
+                    map_remove(&map, _BENCH_MAP_INFO, found);
+            }
+            bench_time_stop(&remove_time);
+
+            TEST(map.count == 0);
+            map_deinit(&map, _BENCH_MAP_INFO);
+        }
+
+        bench_report(&insert_time, "map.insert", size, 1, size, 0);
+        bench_report(&find_time, "map.find_hit", size, 1, size, 0);
+        bench_report(&miss_time, "map.find_miss", size, 1, size, 0);
+        bench_report(&remove_time, "map.remove", size, 1, size, 0);
+        TEST(checksum > 0);
+        allocator_deallocate(alloc, order, size*sizeof(uint64_t), 8);
+    }
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "bench.h"
+#include "../path_store.h"
+#include "../allocator_debug.h"
+
+//Build graph like file list: /home/build/project/modules/modMMM/src/subSS/fileFFFF.cpp in sorted order
+// so that consecutive paths share all but the last segment.
+INTERNAL isize _bench_path_store_paths(char* text, String* paths, isize module_count, isize sub_count, isize file_count)
+{
+    isize at = 0;
+    isize count = 0;
+    for(isize m = 0; m < module_count; m++)
+        for(isize s = 0; s < sub_count; s++)
+            for(isize f = 0; f < file_count; f++)
+            {
+                isize size = snprintf(text + at, 128, "/home/build/project/modules/mod%03lli/src/sub%02lli/file%04lli.cpp", (long long) m, (long long) s, (long long) f);
+                paths[count++] = string_make(text + at, size);
+                at += size;
+            }
+    return at;
+}
+
+//Normalizing, concatenating and comparing a million paths with one Path_Builder per path against the
+// ids of Path_Store. Also logs the memory taken by keeping all of the normalized paths either way.
+INTERNAL void bench_path_store(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {MODULES = 64, SUBS = 16, FILES = 1024, COUNT = MODULES*SUBS*FILES};
+    Allocator* alloc = allocator_get_default();
+    char* text = (char*) allocator_allocate(alloc, (isize) COUNT*64, 8);
+    String* paths = (String*) allocator_allocate(alloc, COUNT*(isize) sizeof(String), 8);
+    Path_Id* ids = (Path_Id*) allocator_allocate(alloc, COUNT*(isize) sizeof(Path_Id), 8);
+    isize text_size = _bench_path_store_paths(text, paths, MODULES, SUBS, FILES);
+
+    //Normalize
+    {
+        Bench_Time time = {0};
+        isize checksum = 0;
+        for(isize r = 0; r < BENCH_REPEATS; r++) {
+            bench_time_start(&time);
+            for(isize i = 0; i < COUNT; i++) {
+                Path_Builder normalized = path_normalize(alloc, path_parse(paths[i]), 0);
+                checksum += normalized.count;
+                path_builder_deinit(&normalized);
+            }
+            bench_time_stop(&time);
+        }
+        TEST(checksum == text_size*BENCH_REPEATS);
+        bench_report(&time, "path_store.normalize_builders", COUNT, 1, COUNT, text_size);
+    }
+
+    Path_Store store = {0};
+    {
+        Bench_Time single = {0};
+        Bench_Time many = {0};
+        Bench_Time warm = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++) {
+            bench_time_start(&single);
+            path_store_init(&store, alloc);
+            for(isize i = 0; i < COUNT; i++)
+                ids[i] = path_store_intern(&store, path_parse(paths[i]));
+            bench_time_stop(&single);
+
+            bench_time_start(&many);
+            path_store_init(&store, alloc);
+            path_store_intern_many(&store, paths, COUNT, ids);
+            bench_time_stop(&many);
+
+            bench_time_start(&warm);
+            path_store_intern_many(&store, paths, COUNT, ids);
+            bench_time_stop(&warm);
+        }
+        TEST(path_store_text_size(&store, ids[COUNT - 1]) == paths[COUNT - 1].count);
+        bench_report(&single, "path_store.intern_cold", COUNT, 1, COUNT, text_size);
+        bench_report(&many, "path_store.intern_many_cold", COUNT, 1, COUNT, text_size);
+        bench_report(&warm, "path_store.intern_many_warm", COUNT, 1, COUNT, text_size);
+    }
+
+    //Concat "../../include/fileFFFF.h" onto the containing directory of each path
+    {
+        enum {RELATIVE = 1024};
+        char relative_text[RELATIVE][32] = {0};
+        String relatives[RELATIVE] = {0};
+        Path_Id relative_ids[RELATIVE] = {0};
+        for(isize i = 0; i < RELATIVE; i++) {
+            isize size = snprintf(relative_text[i], sizeof relative_text[i], "../../include/file%04lli.h", (long long) i);
+            relatives[i] = string_make(relative_text[i], size);
+            relative_ids[i] = path_store_intern_string(&store, relatives[i]);
+        }
+
+        Bench_Time builders = {0};
+        Bench_Time concat = {0};
+        isize checksum_builders = 0;
+        isize checksum_ids = 0;
+        for(isize r = 0; r < BENCH_REPEATS; r++) {
+            bench_time_start(&builders);
+            for(isize i = 0; i < COUNT; i++) {
+                Path_Builder concated = path_concat(alloc, path_strip_to_containing_directory(path_parse(paths[i])), path_parse(relatives[i % RELATIVE]));
+                checksum_builders += concated.count;
+                path_builder_deinit(&concated);
+            }
+            bench_time_stop(&builders);
+
+            bench_time_start(&concat);
+            for(isize i = 0; i < COUNT; i++) {
+                Path_Id concated = path_store_concat(&store, path_store_parent(&store, ids[i]), relative_ids[i % RELATIVE]);
+                checksum_ids += path_store_text_size(&store, concated);
+            }
+            bench_time_stop(&concat);
+        }
+        TEST(checksum_builders == checksum_ids);
+        bench_report(&builders, "path_store.concat_builders", COUNT, 1, COUNT, 0);
+        bench_report(&concat, "path_store.concat_ids", COUNT, 1, COUNT, 0);
+    }
+
+    //Count how many paths equal the one 1024 places after them (the same file name in the next directory)
+    {
+        Path_Builder* normalized = (Path_Builder*) allocator_allocate(alloc, COUNT*(isize) sizeof(Path_Builder), 8);
+        for(isize i = 0; i < COUNT; i++)
+            normalized[i] = path_normalize(alloc, path_parse(paths[i]), 0);
+
+        Bench_Time builders = {0};
+        Bench_Time id_time = {0};
+        isize equal_builders = 0;
+        isize equal_ids = 0;
+        for(isize r = 0; r < BENCH_REPEATS; r++) {
+            bench_time_start(&builders);
+            for(isize i = 0; i + FILES < COUNT; i++)
+                equal_builders += string_is_equal(normalized[i].string, normalized[i + FILES].string);
+            bench_time_stop(&builders);
+
+            bench_time_start(&id_time);
+            for(isize i = 0; i + FILES < COUNT; i++)
+                equal_ids += ids[i] == ids[i + FILES];
+            bench_time_stop(&id_time);
+        }
+        TEST(equal_builders == equal_ids);
+        bench_report(&builders, "path_store.equal_builders", COUNT, 1, COUNT, 0);
+        bench_report(&id_time, "path_store.equal_ids", COUNT, 1, COUNT, 0);
+
+        for(isize i = 0; i < COUNT; i++)
+            path_builder_deinit(&normalized[i]);
+        allocator_deallocate(alloc, normalized, COUNT*(isize) sizeof(Path_Builder), 8);
+    }
+    path_store_deinit(&store);
+
+    //Memory of keeping every normalized path. Only for a part of the paths since the debug allocator is slow
+    {
+        enum {MEMORY_COUNT = COUNT/16};
+        Debug_Allocator debug = debug_allocator_make(alloc, 0);
+        Path_Builder* normalized = (Path_Builder*) allocator_allocate(debug.alloc, MEMORY_COUNT*(isize) sizeof(Path_Builder), 8);
+        for(isize i = 0; i < MEMORY_COUNT; i++)
+            normalized[i] = path_normalize(debug.alloc, path_parse(paths[i]), 0);
+        isize builder_bytes = debug.bytes_allocated;
+        for(isize i = 0; i < MEMORY_COUNT; i++)
+            path_builder_deinit(&normalized[i]);
+        allocator_deallocate(debug.alloc, normalized, MEMORY_COUNT*(isize) sizeof(Path_Builder), 8);
+
+        Path_Store measured = {0};
+        path_store_init(&measured, debug.alloc);
+        Path_Id* measured_ids = (Path_Id*) allocator_allocate(debug.alloc, MEMORY_COUNT*(isize) sizeof(Path_Id), 8);
+        path_store_intern_many(&measured, paths, MEMORY_COUNT, measured_ids);
+        isize store_bytes = debug.bytes_allocated;
+        allocator_deallocate(debug.alloc, measured_ids, MEMORY_COUNT*(isize) sizeof(Path_Id), 8);
+        path_store_deinit(&measured);
+        debug_allocator_deinit(&debug);
+
+        LOG_INFO("BENCH", "path_store memory for %lli paths (%lli bytes of text): builders %.2lfMB, store %.2lfMB",
+            (long long) MEMORY_COUNT, (long long) (paths[MEMORY_COUNT - 1].data + paths[MEMORY_COUNT - 1].count - text), builder_bytes/1e6, store_bytes/1e6);
+    }
+
+    allocator_deallocate(alloc, ids, COUNT*(isize) sizeof(Path_Id), 8);
+    allocator_deallocate(alloc, paths, COUNT*(isize) sizeof(String), 8);
+    allocator_deallocate(alloc, text, (isize) COUNT*64, 8);
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include "bench.h"
+#include "../scratch.h"
+#include "../arena.h"
+
+#define _BENCH_SCRATCH_FRAME  4096
+#define _BENCH_SCRATCH_FRAMES 4096
+
+typedef struct _Bench_Scratch_Node {
+    void* next;
+    uint64_t key;
+    uint64_t value;
+} _Bench_Scratch_Node;
+
+typedef struct _Bench_Scratch {
+    Scratch_Arena* scratch_arena;
+    Arena* arena;
+    isize size;     //passed at runtime so that the untyped pushes cannot fold it
+} _Bench_Scratch;
+
+//Each function pushes _BENCH_SCRATCH_FRAME nodes per frame touching each one, like a parser building a tree would.
+ATTRIBUTE_INLINE_NEVER static uint64_t _bench_scratch_push_slow(_Bench_Scratch* bench)
+{
+    uint64_t sum = 0;
+    for(isize f = 0; f < _BENCH_SCRATCH_FRAMES; f++)
+        SCRATCH_SCOPE_FROM(scratch, bench->scratch_arena)
+            for(isize i = 0; i < _BENCH_SCRATCH_FRAME; i++) {
+                _Bench_Scratch_Node* node = (_Bench_Scratch_Node*) _scratch_push_slow(&scratch, bench->size, 8, NULL);
+                node->key = (uint64_t) i;
+                sum += (uint64_t) node;
+            }
+    return sum;
+}
+
+ATTRIBUTE_INLINE_NEVER static uint64_t _bench_scratch_push_generic(_Bench_Scratch* bench)
+{
+    uint64_t sum = 0;
+    for(isize f = 0; f < _BENCH_SCRATCH_FRAMES; f++)
+        SCRATCH_SCOPE_FROM(scratch, bench->scratch_arena)
+            for(isize i = 0; i < _BENCH_SCRATCH_FRAME; i++) {
+                _Bench_Scratch_Node* node = (_Bench_Scratch_Node*) scratch_push_nonzero_generic(&scratch, bench->size, 8, NULL);
+                node->key = (uint64_t) i;
+                sum += (uint64_t) node;
+            }
+    return sum;
+}
+
+ATTRIBUTE_INLINE_NEVER static uint64_t _bench_scratch_push_inline(_Bench_Scratch* bench)
+{
+    uint64_t sum = 0;
+    for(isize f = 0; f < _BENCH_SCRATCH_FRAMES; f++)
+        SCRATCH_SCOPE_FROM(scratch, bench->scratch_arena)
+            for(isize i = 0; i < _BENCH_SCRATCH_FRAME; i++) {
+                _Bench_Scratch_Node* node = (_Bench_Scratch_Node*) scratch_push_nonzero_inline(&scratch, bench->size, 8, NULL);
+                node->key = (uint64_t) i;
+                sum += (uint64_t) node;
+            }
+    return sum;
+}
+
+ATTRIBUTE_INLINE_NEVER static uint64_t _bench_scratch_push_typed(_Bench_Scratch* bench)
+{
+    uint64_t sum = 0;
+    for(isize f = 0; f < _BENCH_SCRATCH_FRAMES; f++)
+        SCRATCH_SCOPE_FROM(scratch, bench->scratch_arena)
+            for(isize i = 0; i < _BENCH_SCRATCH_FRAME; i++) {
+                _Bench_Scratch_Node* node = scratch_push_nonzero(&scratch, 1, _Bench_Scratch_Node);
+                node->key = (uint64_t) i;
+                sum += (uint64_t) node;
+            }
+    return sum;
+}
+
+ATTRIBUTE_INLINE_NEVER static uint64_t _bench_scratch_push_typed_zero(_Bench_Scratch* bench)
+{
+    uint64_t sum = 0;
+    for(isize f = 0; f < _BENCH_SCRATCH_FRAMES; f++)
+        SCRATCH_SCOPE_FROM(scratch, bench->scratch_arena)
+            for(isize i = 0; i < _BENCH_SCRATCH_FRAME; i++) {
+                _Bench_Scratch_Node* node = scratch_push_one(&scratch, _Bench_Scratch_Node);
+                node->key = (uint64_t) i;
+                sum += (uint64_t) node;
+            }
+    return sum;
+}
+
+ATTRIBUTE_INLINE_NEVER static uint64_t _bench_scratch_arena_push(_Bench_Scratch* bench)
+{
+    uint64_t sum = 0;
+    for(isize f = 0; f < _BENCH_SCRATCH_FRAMES; f++) {
+        for(isize i = 0; i < _BENCH_SCRATCH_FRAME; i++) {
+            _Bench_Scratch_Node* node = (_Bench_Scratch_Node*) arena_push_nonzero(bench->arena, bench->size, 8, NULL);
+            node->key = (uint64_t) i;
+            sum += (uint64_t) node;
+        }
+        arena_reset(bench->arena, 0);
+    }
+    return sum;
+}
+
+ATTRIBUTE_INLINE_NEVER static uint64_t _bench_scratch_arena_push_typed_zero(_Bench_Scratch* bench)
+{
+    uint64_t sum = 0;
+    for(isize f = 0; f < _BENCH_SCRATCH_FRAMES; f++) {
+        for(isize i = 0; i < _BENCH_SCRATCH_FRAME; i++) {
+            _Bench_Scratch_Node* node = ARENA_PUSH(bench->arena, 1, _Bench_Scratch_Node);
+            node->key = (uint64_t) i;
+            sum += (uint64_t) node;
+        }
+        arena_reset(bench->arena, 0);
+    }
+    return sum;
+}
+
+//Tiny pushes: the checked push (what scratch_push_nonzero_generic used to be), the out of line generic function,
+// the inline fast path, the typed macros and arena_push for comparison.
+INTERNAL void bench_scratch(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {OPS = _BENCH_SCRATCH_FRAME*_BENCH_SCRATCH_FRAMES};
+    Scratch_Arena scratch_arena = {0};
+    Arena arena = {0};
+    TEST(scratch_arena_init(&scratch_arena, "bench_scratch", 0, 0, 0) == 0);
+    TEST(arena_init(&arena, "bench_scratch", 0, 0) == 0);
+
+    _Bench_Scratch bench = {&scratch_arena, &arena, sizeof(_Bench_Scratch_Node)};
+    typedef struct {const char* name; uint64_t (*func)(_Bench_Scratch*);} Bench_Func;
+    Bench_Func funcs[] = {
+        {"scratch.push_checked", _bench_scratch_push_slow},
+        {"scratch.push_generic", _bench_scratch_push_generic},
+        {"scratch.push_inline", _bench_scratch_push_inline},
+        {"scratch.push_typed", _bench_scratch_push_typed},
+        {"scratch.push_typed_zero", _bench_scratch_push_typed_zero},
+        {"arena.push", _bench_scratch_arena_push},
+        {"arena.push_typed_zero", _bench_scratch_arena_push_typed_zero},
+    };
+
+    uint64_t sums[ARRAY_COUNT(funcs)] = {0};
+    for(isize f = 0; f < ARRAY_COUNT(funcs); f++) {
+        Bench_Time time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++) {
+            bench_time_start(&time);
+            sums[f] = funcs[f].func(&bench);
+            bench_time_stop(&time);
+        }
+        bench_report(&time, funcs[f].name, sizeof(_Bench_Scratch_Node), 1, OPS, 0);
+    }
+
+    //All scratch variants push the same sequence of addresses
+    for(isize f = 1; f < 5; f++)
+        TEST(sums[f] == sums[0]);
+
+    arena_deinit(&arena);
+    scratch_arena_deinit(&scratch_arena);
+}
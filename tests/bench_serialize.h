@@ -0,0 +1,111 @@
+#pragma once
+
+#include "bench.h"
+#include "../serialize.h"
+
+typedef struct Bench_Ser_Record {
+    uint64_t id;
+    uint32_t parent;
+    int32_t depth;
+    float x;
+    float y;
+    float z;
+    double weight;
+    int16_t kind;
+    uint8_t flags;
+    bool visible;
+} Bench_Ser_Record;
+
+INTERNAL void _bench_ser_record_write(Ser_Writer* w, const Bench_Ser_Record* r)
+{
+    ser_object_begin(w);
+        ser_cstring(w, "id");       ser_u64(w, r->id);
+        ser_cstring(w, "parent");   ser_u32(w, r->parent);
+        ser_cstring(w, "depth");    ser_i32(w, r->depth);
+        ser_cstring(w, "x");        ser_f32(w, r->x);
+        ser_cstring(w, "y");        ser_f32(w, r->y);
+        ser_cstring(w, "z");        ser_f32(w, r->z);
+        ser_cstring(w, "weight");   ser_f64(w, r->weight);
+        ser_cstring(w, "kind");     ser_i16(w, r->kind);
+        ser_cstring(w, "flags");    ser_u8(w, r->flags);
+        ser_cstring(w, "visible");  ser_bool(w, r->visible);
+    ser_object_end(w);
+}
+
+INTERNAL bool _bench_ser_record_read(Ser_Value object, Bench_Ser_Record* r)
+{
+    bool ok = true;
+    for(Ser_Value key = {0}, val = {0}; deser_iterate_object(&object, &key, &val); )
+    {
+        if(0) {}
+        else if(ser_cstring_eq(key, "id"))      ok &= deser_u64(val, &r->id);
+        else if(ser_cstring_eq(key, "parent"))  ok &= deser_u32(val, &r->parent);
+        else if(ser_cstring_eq(key, "depth"))   ok &= deser_i32(val, &r->depth);
+        else if(ser_cstring_eq(key, "x"))       ok &= deser_f32(val, &r->x);
+        else if(ser_cstring_eq(key, "y"))       ok &= deser_f32(val, &r->y);
+        else if(ser_cstring_eq(key, "z"))       ok &= deser_f32(val, &r->z);
+        else if(ser_cstring_eq(key, "weight"))  ok &= deser_f64(val, &r->weight);
+        else if(ser_cstring_eq(key, "kind"))    ok &= deser_i16(val, &r->kind);
+        else if(ser_cstring_eq(key, "flags"))   ok &= deser_u8(val, &r->flags);
+        else if(ser_cstring_eq(key, "visible")) ok &= deser_bool(val, &r->visible);
+    }
+    return ok;
+}
+
+//Writing and reading 1M records of 10 fields by hand with ser_cstring_eq key matching and through a Ser_Schema
+INTERNAL void bench_serialize_schema(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {COUNT = 1 << 20};
+    Ser_Schema_Field fields[] = {
+        SER_SCHEMA_FIELD(Bench_Ser_Record, id, SER_U64),
+        SER_SCHEMA_FIELD(Bench_Ser_Record, parent, SER_U32),
+        SER_SCHEMA_FIELD(Bench_Ser_Record, depth, SER_I32),
+        SER_SCHEMA_FIELD(Bench_Ser_Record, x, SER_F32),
+        SER_SCHEMA_FIELD(Bench_Ser_Record, y, SER_F32),
+        SER_SCHEMA_FIELD(Bench_Ser_Record, z, SER_F32),
+        SER_SCHEMA_FIELD(Bench_Ser_Record, weight, SER_F64),
+        SER_SCHEMA_FIELD(Bench_Ser_Record, kind, SER_I16),
+        SER_SCHEMA_FIELD(Bench_Ser_Record, flags, SER_U8),
+        SER_SCHEMA_FIELD(Bench_Ser_Record, visible, SER_BOOL),
+    };
+    Ser_Schema schema = {0};
+    TEST(ser_schema_init(&schema, fields, ARRAY_COUNT(fields), NULL));
+
+    const char* names[2][2] = {{"serialize.write.manual", "serialize.read.manual"}, {"serialize.write.schema", "serialize.read.schema"}};
+    for(isize use_schema = 0; use_schema < 2; use_schema++)
+    {
+        Ser_Writer w = {0};
+        uint64_t checksum = 0;
+        Bench_Time write_time = {0};
+        Bench_Time read_time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++)
+        {
+            w.offset = 0;
+            bench_time_start(&write_time);
+            for(isize i = 0; i < COUNT; i++) {
+                Bench_Ser_Record record = {(uint64_t) i, (uint32_t) i/2, (int32_t) (i % 17), (float) i, (float) -i, 0.5f, (double) i/3, (int16_t) (i % 5), (uint8_t) i, (i & 1) != 0};
+                if(use_schema)
+                    ser_schema_write(&w, &schema, &record);
+                else
+                    _bench_ser_record_write(&w, &record);
+            }
+            bench_time_stop(&write_time);
+
+            bench_time_start(&read_time);
+            Ser_Reader reader = ser_reader_make(w.data, w.offset);
+            for(Ser_Value value = {0}; deser_value(&reader, &value); ) {
+                Bench_Ser_Record record = {0};
+                bool ok = use_schema ? deser_schema(value, &schema, &record, NULL) : _bench_ser_record_read(value, &record);
+                TEST(ok);
+                checksum += record.id + record.parent + (uint64_t) record.kind;
+            }
+            bench_time_stop(&read_time);
+        }
+
+        TEST(checksum > 0);
+        bench_report(&write_time, names[use_schema][0], w.offset, 1, COUNT, w.offset);
+        bench_report(&read_time, names[use_schema][1], w.offset, 1, COUNT, w.offset);
+        ser_writer_deinit(&w);
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "bench.h"
+#include "../serialize_stream.h"
+
+#define BENCH_SER_STREAM_PATH "__bench_ser_stream__.bin"
+
+//Writes and reads back a ~70MB document of small objects through a file with and without compression.
+// Memory use stays at a few chunks, the file is usually in the page cache.
+INTERNAL void bench_serialize_stream(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {COUNT = 1 << 20};
+    Platform_String path = {BENCH_SER_STREAM_PATH, sizeof(BENCH_SER_STREAM_PATH) - 1};
+    char text[64] = {0};
+    bench_fill_text(text, sizeof text);
+
+    const char* names[2][2] = {{"ser_stream.write.raw", "ser_stream.read.raw"}, {"ser_stream.write.slz4", "ser_stream.read.slz4"}};
+    for(isize compress = 0; compress < 2; compress++)
+    {
+        Ser_Stream_Options options = {0};
+        options.compress = compress != 0;
+
+        isize raw_bytes = 0;
+        isize stored_bytes = 0;
+        uint64_t checksum = 0;
+        Bench_Time write_time = {0};
+        Bench_Time read_time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++)
+        {
+            bench_time_start(&write_time);
+            Ser_Stream_Writer writer = {0};
+            TEST(ser_stream_writer_init_file(&writer, path, &options) == SER_STREAM_OK);
+            ser_array_begin(&writer.w);
+            for(isize i = 0; i < COUNT; i++) {
+                ser_object_begin(&writer.w);
+                    ser_cstring(&writer.w, "id");   ser_u64(&writer.w, (uint64_t) i);
+                    ser_cstring(&writer.w, "pos");  ser_f32(&writer.w, (float) i); ser_f32(&writer.w, (float) -i);
+                    ser_cstring(&writer.w, "name"); ser_string_separate(&writer.w, text, 8 + i % 32);
+                ser_object_end(&writer.w);
+            }
+            ser_array_end(&writer.w);
+            ser_writer_flush(&writer.w);
+            raw_bytes = writer.raw_bytes;
+            stored_bytes = writer.stored_bytes;
+            TEST(ser_stream_writer_deinit(&writer) == SER_STREAM_OK);
+            bench_time_stop(&write_time);
+
+            bench_time_start(&read_time);
+            Ser_Stream_Reader reader = {0};
+            TEST(ser_stream_reader_init_file(&reader, path, NULL) == SER_STREAM_OK);
+            Ser_Value array = {0};
+            isize count = 0;
+            TEST(deser_value(&reader.r, &array));
+            for(Ser_Value item = {0}; deser_iterate_array(&array, &item); count++)
+                for(Ser_Value key = {0}, val = {0}; deser_iterate_object(&item, &key, &val); ) {
+                    uint64_t id = 0;
+                    if(deser_u64(val, &id))
+                        checksum += id;
+                }
+            TEST(count == COUNT);
+            TEST(deser_value(&reader.r, &array) == false);
+            TEST(ser_stream_reader_deinit(&reader) == SER_STREAM_OK);
+            bench_time_stop(&read_time);
+        }
+
+        LOG_INFO("BENCH", "%s: %.1lfMB stored as %.1lfMB (checksum %llu)", names[compress][0], (f64) raw_bytes/1e6, (f64) stored_bytes/1e6, (unsigned long long) checksum);
+        bench_report(&write_time, names[compress][0], raw_bytes, 1, COUNT, raw_bytes);
+        bench_report(&read_time, names[compress][1], raw_bytes, 1, COUNT, raw_bytes);
+    }
+
+    platform_file_remove(path, false);
+}
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "bench.h"
+#include "../slz4.h"
+#include "../slz4_parallel.h"
+
+//Compression and decompression throughput of text-like data in blocks of different sizes
+INTERNAL void bench_slz4(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {TOTAL = 8 << 20};
+    Allocator* alloc = allocator_get_default();
+    isize sizes[] = {4 << 10, 64 << 10, 1 << 20};
+    for(isize s = 0; s < ARRAY_COUNT(sizes); s++)
+    {
+        int size = (int) sizes[s];
+        int bound = slz4_compressed_size_upper_bound(size);
+        char* input = (char*) allocator_allocate(alloc, size, 8);
+        char* compressed = (char*) allocator_allocate(alloc, bound, 8);
+        char* decompressed = (char*) allocator_allocate(alloc, size, 8);
+        bench_fill_text(input, size);
+
+        isize iters = TOTAL/size;
+        int compressed_size = 0;
+        Bench_Time compress_time = {0};
+        Bench_Time decompress_time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++)
+        {
+            bench_time_start(&compress_time);
+            for(isize i = 0; i < iters; i++)
+                compressed_size = slz4_compress(compressed, bound, input, size, NULL);
+            bench_time_stop(&compress_time);
+            TEST(compressed_size > 0);
+
+            bench_time_start(&decompress_time);
+            for(isize i = 0; i < iters; i++)
+                TEST(slz4_decompress(decompressed, size, compressed, compressed_size, NULL) == size);
+            bench_time_stop(&decompress_time);
+            TEST(memcmp(input, decompressed, size) == 0);
+        }
+
+        bench_report(&compress_time, "slz4.compress", size, 1, iters, iters*size);
+        bench_report(&decompress_time, "slz4.decompress", size, 1, iters, iters*size);
+        allocator_deallocate(alloc, decompressed, size, 8);
+        allocator_deallocate(alloc, compressed, bound, 8);
+        allocator_deallocate(alloc, input, size, 8);
+    }
+}
+
+INTERNAL bool _bench_slz4_parallel_consumer(void* context, const void* data, isize size, isize offset)
+{
+    (void) offset;
+    *(uint64_t*) context += ((const uint8_t*) data)[size - 1];
+    return true;
+}
+
+//Block index container on 1 and 4 threads: compression, decompression into a buffer and in order streaming.
+INTERNAL void bench_slz4_parallel(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {SIZE = 32 << 20};
+    Allocator* alloc = allocator_get_default();
+    isize bound = slz4_parallel_compressed_size_upper_bound(SIZE, 0);
+    char* input = (char*) allocator_allocate(alloc, SIZE, 8);
+    char* compressed = (char*) allocator_allocate(alloc, bound, 8);
+    char* decompressed = (char*) allocator_allocate(alloc, SIZE, 8);
+    bench_fill_text(input, SIZE);
+
+    isize thread_counts[] = {1, 4};
+    for(isize t = 0; t < ARRAY_COUNT(thread_counts); t++)
+    {
+        isize threads = thread_counts[t];
+        isize compressed_size = 0;
+        uint64_t checksum = 0;
+        Bench_Time compress_time = {0};
+        Bench_Time decompress_time = {0};
+        Bench_Time stream_time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++)
+        {
+            bench_time_start(&compress_time);
+            compressed_size = slz4_parallel_compress(compressed, bound, input, SIZE, 0, threads);
+            bench_time_stop(&compress_time);
+            TEST(compressed_size > 0);
+
+            bench_time_start(&decompress_time);
+            TEST(slz4_parallel_decompress(decompressed, SIZE, compressed, compressed_size, threads) == SIZE);
+            bench_time_stop(&decompress_time);
+            TEST(memcmp(input, decompressed, SIZE) == 0);
+
+            bench_time_start(&stream_time);
+            TEST(slz4_parallel_decompress_stream(compressed, compressed_size, _bench_slz4_parallel_consumer, &checksum, threads) == SIZE);
+            bench_time_stop(&stream_time);
+        }
+
+        bench_report(&compress_time, "slz4_parallel.compress", SIZE, threads, 1, SIZE);
+        bench_report(&decompress_time, "slz4_parallel.decompress", SIZE, threads, 1, SIZE);
+        bench_report(&stream_time, "slz4_parallel.stream", SIZE, threads, 1, SIZE);
+    }
+
+    allocator_deallocate(alloc, decompressed, SIZE, 8);
+    allocator_deallocate(alloc, compressed, bound, 8);
+    allocator_deallocate(alloc, input, SIZE, 8);
+}
+
+//Log line like messages of 200 to 2000 bytes sharing most of their structure but little within a single message
+INTERNAL int _bench_slz4_message(char* into, int capacity, isize index)
+{
+    const char* methods[] = {"GET", "POST", "PUT", "DELETE"};
+    const char* paths[] = {"/api/v2/users", "/api/v2/orders", "/api/v2/products/search", "/static/bundle.js", "/health"};
+    uint64_t seed = (uint64_t) index*0x9E3779B97F4A7C15ull;
+    int size = 0;
+    int header_count = 2 + (int) (index % 19);
+    size += snprintf(into + size, capacity - size, "{\"ts\":\"2024-05-%02i T%02i:%02i:%02i.%03iZ\",\"level\":\"%s\",\"method\":\"%s\",\"path\":\"%s/%llu\",\"status\":%i,\"headers\":{",
+        (int) (seed % 28) + 1, (int) (seed >> 8) % 24, (int) (seed >> 16) % 60, (int) (seed >> 24) % 60, (int) (seed >> 32) % 1000,
+        index % 7 ? "info" : "warning", methods[index % 4], paths[index % 5], (unsigned long long) (seed >> 40), index % 11 ? 200 : 404);
+    for(int h = 0; h < header_count && size < capacity - 200; h++)
+        size += snprintf(into + size, capacity - size, "\"x-header-%i\":\"value-%llu\",\"user-agent\":\"Mozilla/5.0 (X11; Linux x86_64; rv:%i.0)\",", 
+            h, (unsigned long long) (seed >> (h % 32)) % 100000, 100 + h);
+    size += snprintf(into + size, capacity - size, "\"request-id\":\"%016llx\"},\"duration_ms\":%i}", (unsigned long long) seed, (int) (seed >> 48) % 5000);
+    return size;
+}
+
+//Compression of small messages independently of each other with no dictionary and with a trained 16KB dictionary.
+// The table of the dictionary is built once so per message setup is just clearing the small input table.
+INTERNAL void bench_slz4_dictionary(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {COUNT = 4096, CAPACITY = 2048, TRAIN_COUNT = 2048, DICT_CAPACITY = 16 << 10};
+    Allocator* alloc = allocator_get_default();
+    char* messages = (char*) allocator_allocate(alloc, COUNT*CAPACITY, 8);
+    char* compressed = (char*) allocator_allocate(alloc, COUNT*CAPACITY*2, 8);
+    char* decompressed = (char*) allocator_allocate(alloc, CAPACITY, 8);
+    char* dictionary_data = (char*) allocator_allocate(alloc, DICT_CAPACITY, 8);
+    char* training = (char*) allocator_allocate(alloc, TRAIN_COUNT*CAPACITY, 8);
+    int sizes[COUNT] = {0};
+    int compressed_sizes[COUNT] = {0};
+    int training_sizes[TRAIN_COUNT] = {0};
+
+    isize total = 0;
+    for(isize i = 0; i < COUNT; i++) {
+        sizes[i] = _bench_slz4_message(messages + i*CAPACITY, CAPACITY, i);
+        total += sizes[i];
+    }
+
+    //Train on different messages than the ones compressed
+    isize training_size = 0;
+    for(isize i = 0; i < TRAIN_COUNT; i++) {
+        training_sizes[i] = _bench_slz4_message(training + training_size, CAPACITY, COUNT + i);
+        training_size += training_sizes[i];
+    }
+    int dictionary_size = slz4_dictionary_train(dictionary_data, DICT_CAPACITY, training, training_sizes, TRAIN_COUNT);
+    TEST(dictionary_size > 0);
+
+    SLZ4_Dictionary dictionary = {0};
+    TEST(slz4_dictionary_init(&dictionary, dictionary_data, dictionary_size) == SLZ4_SUCCESS);
+
+    const char* names[2][2] = {{"slz4_dictionary.compress.none", "slz4_dictionary.decompress.none"}, {"slz4_dictionary.compress", "slz4_dictionary.decompress"}};
+    for(isize with_dictionary = 0; with_dictionary < 2; with_dictionary++)
+    {
+        const SLZ4_Dictionary* dict = with_dictionary ? &dictionary : NULL;
+        isize compressed_total = 0;
+        Bench_Time compress_time = {0};
+        Bench_Time decompress_time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++)
+        {
+            compressed_total = 0;
+            bench_time_start(&compress_time);
+            for(isize i = 0; i < COUNT; i++) {
+                compressed_sizes[i] = slz4_compress_with_dictionary(compressed + i*CAPACITY*2, CAPACITY*2, messages + i*CAPACITY, sizes[i], dict, NULL);
+                compressed_total += compressed_sizes[i];
+            }
+            bench_time_stop(&compress_time);
+
+            bench_time_start(&decompress_time);
+            for(isize i = 0; i < COUNT; i++)
+                TEST(slz4_decompress_with_dictionary(decompressed, sizes[i], compressed + i*CAPACITY*2, compressed_sizes[i], dict ? dictionary_data : NULL, dictionary_size, NULL) == sizes[i]);
+            bench_time_stop(&decompress_time);
+            TEST(memcmp(decompressed, messages + (COUNT - 1)*CAPACITY, sizes[COUNT - 1]) == 0);
+        }
+
+        LOG_INFO("BENCH", "%s: ratio %.2lf (%lli -> %lli bytes) dictionary %i bytes", names[with_dictionary][0], 
+            (f64) total/(f64) compressed_total, (long long) total, (long long) compressed_total, with_dictionary ? dictionary_size : 0);
+        bench_report(&compress_time, names[with_dictionary][0], total/COUNT, 1, COUNT, total);
+        bench_report(&decompress_time, names[with_dictionary][1], total/COUNT, 1, COUNT, total);
+    }
+
+    slz4_dictionary_deinit(&dictionary);
+    allocator_deallocate(alloc, training, TRAIN_COUNT*CAPACITY, 8);
+    allocator_deallocate(alloc, dictionary_data, DICT_CAPACITY, 8);
+    allocator_deallocate(alloc, decompressed, CAPACITY, 8);
+    allocator_deallocate(alloc, compressed, COUNT*CAPACITY*2, 8);
+    allocator_deallocate(alloc, messages, COUNT*CAPACITY, 8);
+}
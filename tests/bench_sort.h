@@ -0,0 +1,164 @@
+#pragma once
+
+#include "bench.h"
+#include "../random.h"
+
+INTERNAL bool _bench_sort_u64_is_less(const void* a, const void* b, void* context)
+{
+    (void) context;
+    return *(const uint64_t*) a < *(const uint64_t*) b;
+}
+
+//Sorts arrays of u64 with hqsort, merge_sort and power_sort. Smaller arrays are sorted more times so that
+// every size processes the same total number of items. Besides random input covers the partially sorted
+// patterns power_sort is made for: sorted, reversed, sawtooth (ascending runs of 1000) and mostly sorted (1% displaced).
+INTERNAL void bench_sort(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {TOTAL = 1 << 19, PATTERNS = 5, ALGORITHMS = 3};
+    const char* names[ALGORITHMS][PATTERNS] = {
+        {"sort.hqsort_random", "sort.hqsort_sorted", "sort.hqsort_reversed", "sort.hqsort_sawtooth", "sort.hqsort_mostly"},
+        {"sort.merge_sort_random", "sort.merge_sort_sorted", "sort.merge_sort_reversed", "sort.merge_sort_sawtooth", "sort.merge_sort_mostly"},
+        {"sort.power_sort_random", "sort.power_sort_sorted", "sort.power_sort_reversed", "sort.power_sort_sawtooth", "sort.power_sort_mostly"},
+    };
+
+    Allocator* alloc = allocator_get_default();
+    isize sizes[] = {100, 10000, 1 << 19};
+    for(isize s = 0; s < ARRAY_COUNT(sizes); s++)
+        for(isize pattern = 0; pattern < PATTERNS; pattern++)
+        {
+            isize size = sizes[s];
+            isize iters = TOTAL/size;
+            uint64_t* input = (uint64_t*) allocator_allocate(alloc, size*sizeof(uint64_t), 8);
+            uint64_t* items = (uint64_t*) allocator_allocate(alloc, size*sizeof(uint64_t), 8);
+            uint64_t* temp = (uint64_t*) allocator_allocate(alloc, size*sizeof(uint64_t), 8);
+            for(isize i = 0; i < size; i++) {
+                switch(pattern) {
+                    case 0:  input[i] = random_u64(); break;
+                    case 1:  input[i] = (uint64_t) i; break;
+                    case 2:  input[i] = (uint64_t) (size - i); break;
+                    case 3:  input[i] = (uint64_t) (i % 1000); break;
+                    default: input[i] = random_range(0, 100) == 0 ? (uint64_t) random_range(0, size) : (uint64_t) i; break;
+                }
+            }
+
+            for(isize algorithm = 0; algorithm < ALGORITHMS; algorithm++)
+            {
+                Bench_Time time = {0};
+                for(isize r = 0; r < BENCH_REPEATS; r++)
+                {
+                    bench_time_start(&time);
+                    for(isize i = 0; i < iters; i++) {
+                        memcpy(items, input, size*sizeof(uint64_t));
+                        if(algorithm == 0)
+                            hqsort(items, size, sizeof(uint64_t), _bench_sort_u64_is_less, NULL);
+                        else if(algorithm == 1)
+                            merge_sort(items, temp, false, size, sizeof(uint64_t), _bench_sort_u64_is_less, NULL);
+                        else
+                            power_sort(items, temp, size/2 + 1, size, sizeof(uint64_t), _bench_sort_u64_is_less, NULL);
+                    }
+                    bench_time_stop(&time);
+                    for(isize i = 1; i < size; i++)
+                        TEST(items[i - 1] <= items[i]);
+                }
+                bench_report(&time, names[algorithm][pattern], size, 1, iters*size, iters*size*sizeof(uint64_t));
+            }
+
+            allocator_deallocate(alloc, temp, size*sizeof(uint64_t), 8);
+            allocator_deallocate(alloc, items, size*sizeof(uint64_t), 8);
+            allocator_deallocate(alloc, input, size*sizeof(uint64_t), 8);
+        }
+}
+
+INTERNAL bool _bench_sort_u64_is_greater(const void* a, const void* b, void* context)
+{
+    (void) context;
+    return *(const uint64_t*) a > *(const uint64_t*) b;
+}
+
+typedef struct _Bench_Select_Threads {
+    const uint64_t* scores;
+    isize count;
+    isize thread_count;
+    Top_K* tops;
+} _Bench_Select_Threads;
+
+INTERNAL void _bench_select_thread(void* context, isize thread_index)
+{
+    _Bench_Select_Threads* threads = (_Bench_Select_Threads*) context;
+    Top_K* top = &threads->tops[thread_index];
+    isize from = threads->count*thread_index/threads->thread_count;
+    isize to = threads->count*(thread_index + 1)/threads->thread_count;
+    for(isize i = from; i < to; i++)
+        top_k_push(top, &threads->scores[i], _bench_sort_u64_is_greater, NULL);
+}
+
+//Finds the k best (biggest) out of 1M random scores in sorted order using a full hqsort, select_nth followed by sorting
+// of the first k, partial_sort and streaming top_k (also on 4 threads which are then merged).
+INTERNAL void bench_select(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {COUNT = 1 << 20, THREADS = 4, ALGORITHMS = 5};
+    const char* names[ALGORITHMS] = {"select.hqsort", "select.select_nth", "select.partial_sort", "select.top_k", "select.top_k_merged"};
+
+    Allocator* alloc = allocator_get_default();
+    uint64_t* scores = (uint64_t*) allocator_allocate(alloc, COUNT*sizeof(uint64_t), 8);
+    uint64_t* items = (uint64_t*) allocator_allocate(alloc, COUNT*sizeof(uint64_t), 8);
+    for(isize i = 0; i < COUNT; i++)
+        scores[i] = random_u64();
+
+    isize ks[] = {100, 10000};
+    for(isize s = 0; s < ARRAY_COUNT(ks); s++)
+    {
+        isize k = ks[s];
+        uint64_t* storage = (uint64_t*) allocator_allocate(alloc, THREADS*k*sizeof(uint64_t), 8);
+        for(isize algorithm = 0; algorithm < ALGORITHMS; algorithm++)
+        {
+            Bench_Time time = {0};
+            uint64_t* best = items;
+            for(isize r = 0; r < BENCH_REPEATS; r++)
+            {
+                uint64_t space[2] = {0};
+                if(algorithm < 3)
+                    memcpy(items, scores, COUNT*sizeof(uint64_t));
+
+                bench_time_start(&time);
+                switch(algorithm) {
+                    case 0: hqsort(items, COUNT, sizeof(uint64_t), _bench_sort_u64_is_greater, NULL); break;
+                    case 1: {
+                        select_nth(items, space, k - 1, COUNT, sizeof(uint64_t), _bench_sort_u64_is_greater, NULL);
+                        hqsort(items, k, sizeof(uint64_t), _bench_sort_u64_is_greater, NULL);
+                    } break;
+                    case 2: partial_sort(items, space, k, COUNT, sizeof(uint64_t), _bench_sort_u64_is_greater, NULL); break;
+                    case 3: {
+                        Top_K top = top_k_make(storage, k, sizeof(uint64_t));
+                        for(isize i = 0; i < COUNT; i++)
+                            top_k_push(&top, &scores[i], _bench_sort_u64_is_greater, NULL);
+                        top_k_sort(&top, _bench_sort_u64_is_greater, NULL);
+                        best = storage;
+                    } break;
+                    default: {
+                        Top_K tops[THREADS] = {0};
+                        for(isize t = 0; t < THREADS; t++)
+                            tops[t] = top_k_make(storage + t*k, k, sizeof(uint64_t));
+                        _Bench_Select_Threads threads = {scores, COUNT, THREADS, tops};
+                        bench_run_threads(THREADS, _bench_select_thread, &threads);
+                        for(isize t = 1; t < THREADS; t++)
+                            top_k_merge(&tops[0], &tops[t], _bench_sort_u64_is_greater, NULL);
+                        top_k_sort(&tops[0], _bench_sort_u64_is_greater, NULL);
+                        best = storage;
+                    } break;
+                }
+                bench_time_stop(&time);
+
+                for(isize i = 1; i < k; i++)
+                    TEST(best[i - 1] >= best[i]);
+            }
+            bench_report(&time, names[algorithm], k, algorithm == 4 ? THREADS : 1, COUNT, COUNT*sizeof(uint64_t));
+        }
+        allocator_deallocate(alloc, storage, THREADS*k*sizeof(uint64_t), 8);
+    }
+
+    allocator_deallocate(alloc, items, COUNT*sizeof(uint64_t), 8);
+    allocator_deallocate(alloc, scores, COUNT*sizeof(uint64_t), 8);
+}
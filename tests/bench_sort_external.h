@@ -0,0 +1,78 @@
+#pragma once
+
+#include "bench.h"
+#include "../sort_external.h"
+#include "../random.h"
+
+#define BENCH_SORT_EXTERNAL_INPUT  "__bench_sort_external_input__.bin"
+#define BENCH_SORT_EXTERNAL_OUTPUT "__bench_sort_external_output__.bin"
+
+typedef struct _Bench_Sort_External_Record {
+    uint64_t key;
+    char payload[56];
+} _Bench_Sort_External_Record;
+
+INTERNAL bool _bench_sort_external_record_less(const void* a, const void* b, void* context)
+{
+    (void) context;
+    return ((const _Bench_Sort_External_Record*) a)->key < ((const _Bench_Sort_External_Record*) b)->key;
+}
+
+//Sorts a file of 64 byte records (random key and text payload) four times bigger than the memory budget
+// so that the run and merge phases are both exercised. Covers runs stored raw and compressed with slz4,
+// with all io done on the calling thread and on background threads. The files are usually
+// in the page cache so this measures mostly the cpu side of the sort.
+INTERNAL void bench_sort_external(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {DATASET = 128 << 20, BUDGET = DATASET/4, COUNT = DATASET/sizeof(_Bench_Sort_External_Record), CHUNK = 1 << 16};
+    Platform_String input_path = {BENCH_SORT_EXTERNAL_INPUT, sizeof(BENCH_SORT_EXTERNAL_INPUT) - 1};
+    Platform_String output_path = {BENCH_SORT_EXTERNAL_OUTPUT, sizeof(BENCH_SORT_EXTERNAL_OUTPUT) - 1};
+
+    Allocator* alloc = allocator_get_default();
+    _Bench_Sort_External_Record* records = (_Bench_Sort_External_Record*) allocator_allocate(alloc, CHUNK*sizeof(_Bench_Sort_External_Record), 8);
+    Platform_File file = {0};
+    TEST(platform_file_open(&file, input_path, PLATFORM_FILE_OPEN_WRITE | PLATFORM_FILE_OPEN_CREATE | PLATFORM_FILE_OPEN_REMOVE_CONTENT) == 0);
+    for(isize from = 0; from < COUNT; from += CHUNK) {
+        for(isize i = 0; i < CHUNK; i++) {
+            records[i].key = random_u64() % (COUNT*16);
+            bench_fill_text(records[i].payload, sizeof records[i].payload);
+        }
+        TEST(platform_file_write(&file, records, CHUNK*sizeof(_Bench_Sort_External_Record), from*(isize) sizeof(_Bench_Sort_External_Record)) == 0);
+    }
+    platform_file_close(&file);
+
+    const char* names[4] = {"sort_external.raw", "sort_external.raw", "sort_external.slz4", "sort_external.slz4"};
+    for(isize variant = 0; variant < 4; variant++)
+    {
+        External_Sort_Options options = {0};
+        options.memory_budget = BUDGET;
+        options.compress_runs = variant >= 2;
+        options.io_threads = variant % 2 ? 2 : -1;
+
+        Bench_Time time = {0};
+        External_Sort_Stats stats = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++)
+        {
+            bench_time_start(&time);
+            External_Sort_Error error = external_sort_file(output_path, input_path, sizeof(_Bench_Sort_External_Record), _bench_sort_external_record_less, NULL, &options, &stats, NULL);
+            bench_time_stop(&time);
+            TEST(error == EXTERNAL_SORT_OK, "%s", external_sort_error_to_string(error));
+        }
+
+        //Spot check the output
+        TEST(platform_file_open(&file, output_path, PLATFORM_FILE_OPEN_READ) == 0);
+        TEST(platform_file_read(&file, records, CHUNK*sizeof(_Bench_Sort_External_Record), 0, NULL) == 0);
+        platform_file_close(&file);
+        for(isize i = 1; i < CHUNK; i++)
+            TEST(records[i - 1].key <= records[i].key);
+
+        LOG_INFO("BENCH", "%s io threads %lli: %lli runs %lli merges temp file %.1lfMB", names[variant], (long long) MAX(options.io_threads, 0),
+            (long long) stats.run_count, (long long) stats.merge_passes, (f64) stats.temp_bytes_written/1e6);
+        bench_report(&time, names[variant], COUNT, MAX(options.io_threads, 0), COUNT, DATASET);
+    }
+
+    platform_file_remove(input_path, false);
+    platform_file_remove(output_path, false);
+    allocator_deallocate(alloc, records, CHUNK*sizeof(_Bench_Sort_External_Record), 8);
+}
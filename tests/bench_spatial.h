@@ -0,0 +1,185 @@
+#pragma once
+
+#include "bench.h"
+#include "../spatial.h"
+#include "../random.h"
+
+typedef struct _Bench_Spatial_Found {
+    isize* counts;
+} _Bench_Spatial_Found;
+
+INTERNAL bool _bench_spatial_found(void* context, isize query, isize index)
+{
+    (void) index;
+    ((_Bench_Spatial_Found*) context)->counts[query] += 1;
+    return true;
+}
+
+INTERNAL float _bench_spatial_hit_sphere(void* context, isize index, Spatial_Ray ray)
+{
+    const Vec3* centers = (const Vec3*) context;
+    const float radius = 0.05f;
+    Vec3 oc = vec3_sub(ray.origin, centers[index]);
+    float a = vec3_dot(ray.dir, ray.dir);
+    float b = vec3_dot(oc, ray.dir);
+    float c = vec3_dot(oc, oc) - radius*radius;
+    float disc = b*b - a*c;
+    if(disc < 0)
+        return INFINITY;
+    float t = (-b - sqrtf(disc))/a;
+    return t >= 0 ? t : (-b + sqrtf(disc))/a;
+}
+
+//10M points uniformly spread in a 100^3 cube (so about 10 per unit cube). Measures building each structure on
+// 1 and 4 threads and batches of queries against it: k nearest neighbours on the k-d tree, radius queries on the grid,
+// and raycasts and box queries on a BVH of small spheres centered at the points. The brute force versions run on
+// a handful of queries only and are there to put the numbers into perspective (and check the results).
+INTERNAL void bench_spatial(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {COUNT = 10000000, QUERIES = 100000, BRUTE_QUERIES = 8, K = 8};
+    Allocator* alloc = allocator_get_default();
+    Vec3* points = (Vec3*) allocator_allocate(alloc, COUNT*sizeof(Vec3), 4);
+    Vec3* queries = (Vec3*) allocator_allocate(alloc, QUERIES*sizeof(Vec3), 4);
+    isize* counts = (isize*) allocator_allocate(alloc, QUERIES*sizeof(isize), 8);
+    for(isize i = 0; i < COUNT; i++)
+        points[i] = vec3(random_f32()*100, random_f32()*100, random_f32()*100);
+    for(isize i = 0; i < QUERIES; i++)
+        queries[i] = vec3(random_f32()*100, random_f32()*100, random_f32()*100);
+
+    isize thread_counts[] = {1, 4};
+
+    //K-d tree
+    {
+        Spatial_KD_Tree tree = {0};
+        Spatial_Neighbor* neighbors = (Spatial_Neighbor*) allocator_allocate(alloc, QUERIES*K*sizeof(Spatial_Neighbor), 8);
+        for(isize t = 0; t < ARRAY_COUNT(thread_counts); t++) {
+            Bench_Time build_time = {0};
+            Bench_Time knn_time = {0};
+            for(isize r = 0; r < BENCH_REPEATS; r++) {
+                bench_time_start(&build_time);
+                spatial_kd_tree_build(&tree, alloc, points, COUNT, thread_counts[t]);
+                bench_time_stop(&build_time);
+
+                bench_time_start(&knn_time);
+                spatial_kd_tree_knn_batch(&tree, queries, QUERIES, K, neighbors, thread_counts[t]);
+                bench_time_stop(&knn_time);
+            }
+            bench_report(&build_time, "spatial.kd_build", COUNT, thread_counts[t], COUNT, COUNT*sizeof(Vec3));
+            bench_report(&knn_time, "spatial.kd_knn8", COUNT, thread_counts[t], QUERIES, 0);
+        }
+
+        Bench_Time brute_time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++) {
+            bench_time_start(&brute_time);
+            for(isize q = 0; q < BRUTE_QUERIES; q++) {
+                //Only the closest one, which is the last thing the tree found
+                float best = INFINITY;
+                for(isize i = 0; i < COUNT; i++) {
+                    Vec3 d = vec3_sub(points[i], queries[q]);
+                    best = MIN(best, d.x*d.x + d.y*d.y + d.z*d.z);
+                }
+                TEST(best == neighbors[q*K].dist_sq);
+            }
+            bench_time_stop(&brute_time);
+        }
+        bench_report(&brute_time, "spatial.brute_nearest", COUNT, 1, BRUTE_QUERIES, 0);
+
+        spatial_kd_tree_deinit(&tree);
+        allocator_deallocate(alloc, neighbors, QUERIES*K*sizeof(Spatial_Neighbor), 8);
+    }
+
+    //Hash grid rebuilt from scratch as it would be every frame
+    {
+        Spatial_Grid grid = {0};
+        spatial_grid_init(&grid, alloc, 1.0f);
+        Bench_Time build_time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++) {
+            bench_time_start(&build_time);
+            spatial_grid_build(&grid, points, COUNT);
+            bench_time_stop(&build_time);
+        }
+        bench_report(&build_time, "spatial.grid_build", COUNT, 1, COUNT, COUNT*sizeof(Vec3));
+
+        for(isize t = 0; t < ARRAY_COUNT(thread_counts); t++) {
+            Bench_Time query_time = {0};
+            _Bench_Spatial_Found found = {counts};
+            for(isize r = 0; r < BENCH_REPEATS; r++) {
+                memset(counts, 0, QUERIES*sizeof(isize));
+                bench_time_start(&query_time);
+                spatial_grid_query_radius_batch(&grid, queries, QUERIES, 1.0f, _bench_spatial_found, &found, thread_counts[t]);
+                bench_time_stop(&query_time);
+            }
+            bench_report(&query_time, "spatial.grid_radius", COUNT, thread_counts[t], QUERIES, 0);
+        }
+        spatial_grid_deinit(&grid);
+    }
+
+    //BVH over spheres of radius 0.05 at the points
+    {
+        Aabb* boxes = (Aabb*) allocator_allocate(alloc, COUNT*sizeof(Aabb), 4);
+        for(isize i = 0; i < COUNT; i++)
+            boxes[i] = aabb_from_sphere(points[i], 0.05f);
+
+        Spatial_Ray* rays = (Spatial_Ray*) allocator_allocate(alloc, QUERIES*sizeof(Spatial_Ray), 4);
+        Spatial_Hit* hits = (Spatial_Hit*) allocator_allocate(alloc, QUERIES*sizeof(Spatial_Hit), 8);
+        Aabb* query_boxes = (Aabb*) allocator_allocate(alloc, QUERIES*sizeof(Aabb), 4);
+        for(isize i = 0; i < QUERIES; i++) {
+            rays[i].origin = queries[i];
+            rays[i].dir = vec3(random_f32() - 0.5f, random_f32() - 0.5f, random_f32() - 0.5f);
+            rays[i].t_max = INFINITY;
+            query_boxes[i] = aabb_from_sphere(queries[i], 0.5f);
+        }
+
+        Spatial_BVH bvh = {0};
+        for(isize t = 0; t < ARRAY_COUNT(thread_counts); t++) {
+            Bench_Time build_time = {0};
+            Bench_Time raycast_time = {0};
+            Bench_Time query_time = {0};
+            _Bench_Spatial_Found found = {counts};
+            for(isize r = 0; r < BENCH_REPEATS; r++) {
+                bench_time_start(&build_time);
+                spatial_bvh_build(&bvh, alloc, boxes, COUNT, thread_counts[t]);
+                bench_time_stop(&build_time);
+
+                bench_time_start(&raycast_time);
+                spatial_bvh_raycast_batch(&bvh, rays, QUERIES, _bench_spatial_hit_sphere, points, hits, thread_counts[t]);
+                bench_time_stop(&raycast_time);
+
+                memset(counts, 0, QUERIES*sizeof(isize));
+                bench_time_start(&query_time);
+                spatial_bvh_query_aabb_batch(&bvh, query_boxes, QUERIES, _bench_spatial_found, &found, thread_counts[t]);
+                bench_time_stop(&query_time);
+            }
+            bench_report(&build_time, "spatial.bvh_build", COUNT, thread_counts[t], COUNT, COUNT*sizeof(Aabb));
+            bench_report(&raycast_time, "spatial.bvh_raycast", COUNT, thread_counts[t], QUERIES, 0);
+            bench_report(&query_time, "spatial.bvh_query_aabb", COUNT, thread_counts[t], QUERIES, 0);
+        }
+
+        Bench_Time brute_time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++) {
+            bench_time_start(&brute_time);
+            for(isize q = 0; q < BRUTE_QUERIES; q++) {
+                float best = INFINITY;
+                for(isize i = 0; i < COUNT; i++) {
+                    float t = _bench_spatial_hit_sphere(points, i, rays[q]);
+                    if(t >= 0 && t < best)
+                        best = t;
+                }
+                TEST(best == hits[q].t);
+            }
+            bench_time_stop(&brute_time);
+        }
+        bench_report(&brute_time, "spatial.brute_raycast", COUNT, 1, BRUTE_QUERIES, 0);
+
+        spatial_bvh_deinit(&bvh);
+        allocator_deallocate(alloc, query_boxes, QUERIES*sizeof(Aabb), 4);
+        allocator_deallocate(alloc, hits, QUERIES*sizeof(Spatial_Hit), 8);
+        allocator_deallocate(alloc, rays, QUERIES*sizeof(Spatial_Ray), 4);
+        allocator_deallocate(alloc, boxes, COUNT*sizeof(Aabb), 4);
+    }
+
+    allocator_deallocate(alloc, counts, QUERIES*sizeof(isize), 8);
+    allocator_deallocate(alloc, queries, QUERIES*sizeof(Vec3), 4);
+    allocator_deallocate(alloc, points, COUNT*sizeof(Vec3), 4);
+}
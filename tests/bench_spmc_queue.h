@@ -0,0 +1,82 @@
+#pragma once
+
+#include "bench.h"
+#include "../spmc_queue.h"
+
+typedef struct _Bench_SPMC_Queue {
+    SPMC_Queue queue;
+    isize items;
+    _Atomic(int64_t) popped;
+    _Atomic(uint64_t) checksum;
+} _Bench_SPMC_Queue;
+
+//Thread 0 pushes, all others pop until everything was popped
+INTERNAL void _bench_spmc_queue_thread(void* context, isize index)
+{
+    _Bench_SPMC_Queue* bench = (_Bench_SPMC_Queue*) context;
+    if(index == 0) {
+        for(isize i = 0; i < bench->items; i++) {
+            uint64_t item = (uint64_t) i;
+            spmc_queue_push_st(&bench->queue, &item, 1);
+        }
+    }
+    else {
+        uint64_t sum = 0;
+        while(atomic_load_explicit(&bench->popped, memory_order_relaxed) < bench->items) {
+            uint64_t item = 0;
+            if(spmc_queue_pop(&bench->queue, &item, 1).success) {
+                sum += item;
+                atomic_fetch_add_explicit(&bench->popped, 1, memory_order_relaxed);
+            }
+        }
+        atomic_fetch_add(&bench->checksum, sum);
+    }
+}
+
+//Single threaded push/pop and throughput of one producer feeding different numbers of consumers
+INTERNAL void bench_spmc_queue(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {ITEMS = 1 << 18};
+    isize batches[] = {1, 64};
+    for(isize b = 0; b < ARRAY_COUNT(batches); b++)
+    {
+        isize batch = batches[b];
+        uint64_t items[64] = {0};
+        Bench_Time time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++)
+        {
+            SPMC_Queue queue = {0};
+            spmc_queue_init(&queue, sizeof(uint64_t), -1);
+            bench_time_start(&time);
+            for(isize i = 0; i < ITEMS; i += batch)
+                spmc_queue_push_st(&queue, items, batch);
+            for(isize i = 0; i < ITEMS; i += batch)
+                spmc_queue_pop_st(&queue, items, batch);
+            bench_time_stop(&time);
+            TEST(spmc_queue_count(&queue) == 0);
+            spmc_queue_deinit(&queue);
+        }
+        bench_report(&time, "spmc_queue.push_pop_st", batch, 1, ITEMS, 0);
+    }
+
+    isize consumer_counts[] = {1, 2, 4};
+    for(isize c = 0; c < ARRAY_COUNT(consumer_counts); c++)
+    {
+        Bench_Time time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++)
+        {
+            _Bench_SPMC_Queue bench = {0};
+            spmc_queue_init(&bench.queue, sizeof(uint64_t), -1);
+            bench.items = ITEMS;
+
+            bench_time_start(&time);
+            bench_run_threads(consumer_counts[c] + 1, _bench_spmc_queue_thread, &bench);
+            bench_time_stop(&time);
+
+            TEST(atomic_load(&bench.checksum) == (uint64_t) ITEMS*(ITEMS - 1)/2);
+            spmc_queue_deinit(&bench.queue);
+        }
+        bench_report(&time, "spmc_queue.push_pop", 1, consumer_counts[c], ITEMS, 0);
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "bench.h"
+#include "../stable.h"
+#include "../random.h"
+
+typedef struct _Bench_Stable_Item {
+    uint64_t values[4];
+} _Bench_Stable_Item;
+
+//Insert, random access, removal in random order and reinsertion into the freed slots
+INTERNAL void bench_stable(f64 max_seconds)
+{
+    (void) max_seconds;
+    Allocator* alloc = allocator_get_default();
+    isize sizes[] = {1 << 10, 1 << 16, 1 << 20};
+    for(isize s = 0; s < ARRAY_COUNT(sizes); s++)
+    {
+        isize size = sizes[s];
+        isize* order = (isize*) allocator_allocate(alloc, size*sizeof(isize), 8);
+        for(isize i = 0; i < size; i++)
+            order[i] = i;
+        for(isize i = size - 1; i > 0; i--) {
+            isize j = random_range(0, i + 1);
+            SWAP(&order[i], &order[j]);
+        }
+
+        Bench_Time insert_time = {0};
+        Bench_Time at_time = {0};
+        Bench_Time remove_time = {0};
+        Bench_Time reinsert_time = {0};
+        uint64_t checksum = 0;
+        for(isize r = 0; r < BENCH_REPEATS; r++)
+        {
+            Stable stable = {0};
+            stable_init(&stable, alloc, sizeof(_Bench_Stable_Item));
+
+            bench_time_start(&insert_time);
+            for(isize i = 0; i < size; i++) {
+                _Bench_Stable_Item item = {{(uint64_t) i}};
+                stable_insert_value(&stable, &item);
+            }
+            bench_time_stop(&insert_time);
+
+            bench_time_start(&at_time);
+            for(isize i = 0; i < size; i++) 
+                checksum += ((_Bench_Stable_Item*) stable_at(&stable, order[i]))->values[0];
+            bench_time_stop(&at_time);
+
+            bench_time_start(&remove_time);
+            for(isize i = 0; i < size; i++) 
+                stable_remove(&stable, order[i]);
+            bench_time_stop(&remove_time);
+
+            bench_time_start(&reinsert_time);
+            for(isize i = 0; i < size; i++) {
+                _Bench_Stable_Item item = {{(uint64_t) i}};
+                stable_insert_value(&stable, &item);
+            }
+            bench_time_stop(&reinsert_time);
+
+            TEST(stable.count == size);
+            stable_deinit(&stable);
+        }
+
+        bench_report(&insert_time, "stable.insert", size, 1, size, 0);
+        bench_report(&at_time, "stable.at", size, 1, size, 0);
+        bench_report(&remove_time, "stable.remove", size, 1, size, 0);
+        bench_report(&reinsert_time, "stable.reinsert", size, 1, size, 0);
+        TEST(checksum > 0);
+        allocator_deallocate(alloc, order, size*sizeof(isize), 8);
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "bench.h"
+#include "../unicode_norm.h"
+#include "../random.h"
+
+//Builds about size bytes of text from words of the given code points separated by spaces
+INTERNAL isize _bench_unicode_norm_text(char* text, isize size, const uint32_t* codepoints, isize codepoint_count)
+{
+    isize at = 0;
+    while(at + 64 < size) {
+        isize word = random_range(2, 10);
+        for(isize i = 0; i < word; i++)
+            utf8_encode(text, size, codepoints[random_range(0, codepoint_count)], &at);
+        text[at++] = ' ';
+    }
+    return at;
+}
+
+//NFC, NFD and case folding of 4MB of text which is ascii, already NFC latin with accents, greek and cyrillic
+// and decomposed latin. The first ones mostly measure the fast paths.
+INTERNAL void bench_unicode_norm(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {SIZE = 4 << 20};
+    uint32_t ascii[] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'k', 'l', 'm', 'n', 'o', 'p', 'r', 's', 't', 'u', 'T', 'H', 'E', ',', '.'};
+    uint32_t latin[] = {'a', 'c', 'd', 'e', 'i', 'l', 'n', 'o', 'r', 's', 't', 'u', 'z', 'A', 'S', 0xE1, 0xE9, 0xED, 0xF3, 0x161, 0x10D, 0x17E, 0xFC, 0xDF};
+    uint32_t greek_cyrillic[] = {0x3B1, 0x3B2, 0x3B3, 0x3B5, 0x3B9, 0x3BF, 0x3C3, 0x3AC, 0x391, 0x3A3, 0x430, 0x431, 0x432, 0x435, 0x438, 0x43E, 0x441, 0x442, 0x410, 0x414};
+    uint32_t decomposed[] = {'a', 'e', 'i', 'o', 'u', 'n', 's', 'c', 0x301, 0x300, 0x308, 0x30C, 0x327};
+    typedef struct {const char* name; const uint32_t* codepoints; isize count;} Bench_Text;
+    Bench_Text texts[] = {
+        {"ascii", ascii, ARRAY_COUNT(ascii)},
+        {"latin", latin, ARRAY_COUNT(latin)},
+        {"greek_cyrillic", greek_cyrillic, ARRAY_COUNT(greek_cyrillic)},
+        {"decomposed", decomposed, ARRAY_COUNT(decomposed)},
+    };
+    typedef struct {const char* name; isize (*func)(void*, isize, const void*, isize);} Bench_Func;
+    Bench_Func funcs[] = {
+        {"nfc", unicode_nfc},
+        {"nfd", unicode_nfd},
+        {"casefold", unicode_casefold},
+    };
+
+    Allocator* alloc = allocator_get_default();
+    char* text = (char*) allocator_allocate(alloc, SIZE, 8);
+    char* output = (char*) allocator_allocate(alloc, SIZE*UNICODE_NORM_MAX_GROWTH, 8);
+    for(isize t = 0; t < ARRAY_COUNT(texts); t++) {
+        isize size = _bench_unicode_norm_text(text, SIZE, texts[t].codepoints, texts[t].count);
+        for(isize f = 0; f < ARRAY_COUNT(funcs); f++) {
+            Bench_Time time = {0};
+            isize output_size = 0;
+            for(isize r = 0; r < BENCH_REPEATS; r++) {
+                bench_time_start(&time);
+                output_size = funcs[f].func(output, SIZE*UNICODE_NORM_MAX_GROWTH, text, size);
+                bench_time_stop(&time);
+            }
+            TEST(output_size > 0);
+
+            char name[64] = {0};
+            snprintf(name, sizeof name, "unicode_norm.%s_%s", funcs[f].name, texts[t].name);
+            bench_report(&time, name, size, 1, size, size);
+        }
+    }
+    allocator_deallocate(alloc, output, SIZE*UNICODE_NORM_MAX_GROWTH, 8);
+    allocator_deallocate(alloc, text, SIZE, 8);
+}
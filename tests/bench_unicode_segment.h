@@ -0,0 +1,104 @@
+#pragma once
+
+#include "bench.h"
+#include "../unicode_segment.h"
+#include "../unicode.h"
+#include "../random.h"
+
+//Builds about size bytes of text from words of the given code points separated by the given separators
+INTERNAL isize _bench_unicode_segment_text(char* text, isize size, const uint32_t* codepoints, isize codepoint_count, const uint32_t* separators, isize separator_count)
+{
+    isize at = 0;
+    while(at + 64 < size) {
+        isize word = random_range(1, 8);
+        for(isize i = 0; i < word; i++)
+            utf8_encode(text, size, codepoints[random_range(0, codepoint_count)], &at);
+        utf8_encode(text, size, separators[random_range(0, separator_count)], &at);
+    }
+    return at;
+}
+
+//The tokenizer this replaces: a word is a run of code points for which unicode_is_alpha holds
+INTERNAL isize _bench_unicode_segment_naive_words(const char* text, isize size)
+{
+    isize words = 0;
+    bool was_alpha = false;
+    for(isize i = 0; i < size; ) {
+        uint32_t codepoint = 0;
+        if(utf8_decode(text, size, &codepoint, &i) == false) {
+            codepoint = UTF_REPLACEMENT;
+            i += 1;
+        }
+        bool is_alpha = unicode_is_alpha(codepoint);
+        words += is_alpha && was_alpha == false;
+        was_alpha = is_alpha;
+    }
+    return words;
+}
+
+INTERNAL isize _bench_unicode_segment_words(const char* text, isize size)
+{
+    isize words = 0;
+    for(Unicode_Segment_Iterator it = {0}; unicode_word_next(&it, text, size); )
+        words += it.kind == UNICODE_WORD_LETTER;
+    return words;
+}
+
+INTERNAL isize _bench_unicode_segment_graphemes(const char* text, isize size)
+{
+    isize graphemes = 0;
+    for(Unicode_Segment_Iterator it = {0}; unicode_grapheme_next(&it, text, size); )
+        graphemes += 1;
+    return graphemes;
+}
+
+//Words by the naive per code point tokenizer against UAX#29 words and grapheme clusters over 4MB of english,
+// russian, japanese (no spaces, every ideograph is a word) and a mix of scripts with numbers and emoji sequences.
+INTERNAL void bench_unicode_segment(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {SIZE = 4 << 20};
+    uint32_t english[] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'k', 'l', 'm', 'n', 'o', 'p', 'r', 's', 't', 'u', 'T', 'H', 'E', '\''};
+    uint32_t english_separators[] = {' ', ' ', ' ', ' ', ' ', ' ', ',', '.', '\n'};
+    uint32_t russian[] = {0x430, 0x431, 0x432, 0x433, 0x434, 0x435, 0x438, 0x43A, 0x43B, 0x43C, 0x43D, 0x43E, 0x43F, 0x440, 0x441, 0x442, 0x410, 0x414};
+    uint32_t russian_separators[] = {' ', ' ', ' ', ' ', ' ', ',', '.', 0xAB, 0xBB};
+    uint32_t japanese[] = {0x65E5, 0x672C, 0x8A9E, 0x6587, 0x5B57, 0x3042, 0x3044, 0x3046, 0x306E, 0x306F, 0x3092, 0x30A2, 0x30AB, 0x30BF, 0x30CA, 0x30FC};
+    uint32_t japanese_separators[] = {0x3001, 0x3002, 0x306F, 0x3092};
+    uint32_t mixed[] = {'a', 'e', 'o', 's', 't', '1', '9', '.', 0xE9, 0x301, 0x3B1, 0x3C3, 0x430, 0x5D0, 0x627, 0x4E00, 0x30AB,
+        0xAC00, 0x1F600, 0x1F3FB, 0x200D, 0x1F1E8, 0x1F1FF, 0x2764, 0xFE0F};
+    uint32_t mixed_separators[] = {' ', ' ', ' ', ',', '-', 0x3000, '\n'};
+    typedef struct {const char* name; const uint32_t* codepoints; isize count; const uint32_t* separators; isize separator_count;} Bench_Text;
+    Bench_Text texts[] = {
+        {"english", english, ARRAY_COUNT(english), english_separators, ARRAY_COUNT(english_separators)},
+        {"russian", russian, ARRAY_COUNT(russian), russian_separators, ARRAY_COUNT(russian_separators)},
+        {"japanese", japanese, ARRAY_COUNT(japanese), japanese_separators, ARRAY_COUNT(japanese_separators)},
+        {"mixed", mixed, ARRAY_COUNT(mixed), mixed_separators, ARRAY_COUNT(mixed_separators)},
+    };
+    typedef struct {const char* name; isize (*func)(const char*, isize);} Bench_Func;
+    Bench_Func funcs[] = {
+        {"naive_words", _bench_unicode_segment_naive_words},
+        {"words", _bench_unicode_segment_words},
+        {"graphemes", _bench_unicode_segment_graphemes},
+    };
+
+    Allocator* alloc = allocator_get_default();
+    char* text = (char*) allocator_allocate(alloc, SIZE, 8);
+    for(isize t = 0; t < ARRAY_COUNT(texts); t++) {
+        isize size = _bench_unicode_segment_text(text, SIZE, texts[t].codepoints, texts[t].count, texts[t].separators, texts[t].separator_count);
+        for(isize f = 0; f < ARRAY_COUNT(funcs); f++) {
+            Bench_Time time = {0};
+            isize segments = 0;
+            for(isize r = 0; r < BENCH_REPEATS; r++) {
+                bench_time_start(&time);
+                segments = funcs[f].func(text, size);
+                bench_time_stop(&time);
+            }
+            TEST(segments > 0);
+
+            char name[64] = {0};
+            snprintf(name, sizeof name, "unicode_segment.%s_%s", funcs[f].name, texts[t].name);
+            bench_report(&time, name, size, 1, segments, size);
+        }
+    }
+    allocator_deallocate(alloc, text, SIZE, 8);
+}
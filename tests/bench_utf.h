@@ -0,0 +1,83 @@
+#pragma once
+
+#include "bench.h"
+#include "../utf.h"
+#include "../random.h"
+
+//Returns a random valid code point. Ascii only or a mix of 1, 2, 3 and 4 byte (in utf8) code points.
+INTERNAL uint32_t _bench_utf_code_point(bool ascii)
+{
+    if(ascii)
+        return (uint32_t) random_range(0x20, 0x7F);
+
+    switch(random_range(0, 4)) {
+        case 0:  return (uint32_t) random_range(0x20, 0x80);
+        case 1:  return (uint32_t) random_range(0x80, 0x800);
+        case 2:  return (uint32_t) random_range(0xE000, 0x10000);
+        default: return (uint32_t) random_range(0x10000, UTF_MAX + 1);
+    }
+}
+
+//Converts code_point_count code points between utf8, utf32 (the code point array) and utf16 
+INTERNAL void bench_utf(f64 max_seconds)
+{
+    (void) max_seconds;
+    Allocator* alloc = allocator_get_default();
+    isize sizes[] = {1 << 12, 1 << 20};
+    for(isize s = 0; s < ARRAY_COUNT(sizes); s++)
+        for(isize ascii = 1; ascii >= 0; ascii--)
+        {
+            isize count = sizes[s];
+            uint32_t* code_points = (uint32_t*) allocator_allocate(alloc, count*sizeof(uint32_t), 8);
+            uint32_t* decoded = (uint32_t*) allocator_allocate(alloc, count*sizeof(uint32_t), 8);
+            uint8_t* utf8 = (uint8_t*) allocator_allocate(alloc, count*4, 8);
+            uint16_t* utf16 = (uint16_t*) allocator_allocate(alloc, count*4, 8);
+            for(isize i = 0; i < count; i++)
+                code_points[i] = _bench_utf_code_point(ascii);
+
+            Bench_Time encode8_time = {0};
+            Bench_Time decode8_time = {0};
+            Bench_Time encode16_time = {0};
+            Bench_Time decode16_time = {0};
+            isize utf8_size = 0;
+            isize utf16_size = 0;
+            for(isize r = 0; r < BENCH_REPEATS; r++)
+            {
+                bench_time_start(&encode8_time);
+                utf8_size = 0;
+                for(isize i = 0; i < count; i++)
+                    utf8_encode(utf8, count*4, code_points[i], &utf8_size);
+                bench_time_stop(&encode8_time);
+
+                bench_time_start(&decode8_time);
+                isize index = 0;
+                for(isize i = 0; i < count; i++)
+                    utf8_decode(utf8, utf8_size, &decoded[i], &index);
+                bench_time_stop(&decode8_time);
+                TEST(memcmp(decoded, code_points, count*sizeof(uint32_t)) == 0);
+
+                bench_time_start(&encode16_time);
+                utf16_size = 0;
+                for(isize i = 0; i < count; i++)
+                    utf16_encode(utf16, count*4, code_points[i], &utf16_size, UTF_ENDIAN_LITTLE);
+                bench_time_stop(&encode16_time);
+
+                bench_time_start(&decode16_time);
+                index = 0;
+                for(isize i = 0; i < count; i++)
+                    utf16_decode(utf16, utf16_size, &decoded[i], &index, UTF_ENDIAN_LITTLE);
+                bench_time_stop(&decode16_time);
+                TEST(memcmp(decoded, code_points, count*sizeof(uint32_t)) == 0);
+            }
+
+            bench_report(&encode8_time,  ascii ? "utf8.encode_ascii" : "utf8.encode_mixed", count, 1, count, utf8_size);
+            bench_report(&decode8_time,  ascii ? "utf8.decode_ascii" : "utf8.decode_mixed", count, 1, count, utf8_size);
+            bench_report(&encode16_time, ascii ? "utf16.encode_ascii" : "utf16.encode_mixed", count, 1, count, utf16_size);
+            bench_report(&decode16_time, ascii ? "utf16.decode_ascii" : "utf16.decode_mixed", count, 1, count, utf16_size);
+
+            allocator_deallocate(alloc, utf16, count*4, 8);
+            allocator_deallocate(alloc, utf8, count*4, 8);
+            allocator_deallocate(alloc, decoded, count*sizeof(uint32_t), 8);
+            allocator_deallocate(alloc, code_points, count*sizeof(uint32_t), 8);
+        }
+}
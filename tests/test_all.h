@@ -3,6 +3,7 @@
 
 #if defined(TEST_RUNNER)
 #define MODULE_IMPL_ALL
+#define ALLOCATOR_SITES //captured file and line are checked by test_allocator_tracking
 #endif
 
 #define MODULE_ALL_COUPLED
@@ -11,6 +12,7 @@
 #include "../defines.h"
 #include "../assert.h"
 #include "../profile.h"
+#include "../allocator_dispatch.h"
 #include "../allocator_tlsf.h"
 #include "../allocator_tracking.h"
 #include "../perf.h"
@@ -34,6 +36,12 @@
 #include "test_log.h"
 #include "test_mem.h"
 #include "test_map.h"
+#include "test_map_robin.h"
+#include "test_hash_snapshot.h"
+#include "test_hash_parallel.h"
+#include "test_filter.h"
+#include "test_btree.h"
+#include "test_time.h"
 #include "test_math.h"
 #include "test_stable.h"
 #include "test_image.h"
@@ -43,6 +51,41 @@
 #include "test_spmc_queue.h"
 #include "test_debug_allocator.h"
 #include "test_unicode.h"
+#include "test_sort_external.h"
+#include "test_slz4_parallel.h"
+#include "test_serialize_stream.h"
+#include "test_parallel.h"
+#include "test_spatial.h"
+#include "test_image_pyramid.h"
+#include "test_unicode_norm.h"
+#include "test_unicode_segment.h"
+#include "test_path_store.h"
+#include "test_frozen.h"
+#include "test_allocator_tracking.h"
+
+#include "bench_map.h"
+#include "bench_hash.h"
+#include "bench_stable.h"
+#include "bench_channel.h"
+#include "bench_spmc_queue.h"
+#include "bench_slz4.h"
+#include "bench_serialize.h"
+#include "bench_serialize_stream.h"
+#include "bench_base64.h"
+#include "bench_utf.h"
+#include "bench_sort.h"
+#include "bench_sort_external.h"
+#include "bench_allocator.h"
+#include "bench_spatial.h"
+#include "bench_image_pyramid.h"
+#include "bench_unicode_norm.h"
+#include "bench_unicode_segment.h"
+#include "bench_path_store.h"
+#include "bench_scratch.h"
+#include "bench_allocator_dispatch.h"
+#include "bench_frozen.h"
+#include "bench_debug_allocator.h"
+#include "bench_allocator_tracking.h"
 
 typedef enum Test_Func_Type {
     TEST_FUNC_TYPE_SIMPLE,
@@ -60,16 +103,29 @@ typedef struct Test_Run_Context {
     double max_time;
 } Test_Run_Context;
 
+//Controls how run_tests executes the given tests. Filled from the command line in main.
+typedef struct Test_Runner_Options {
+    const char* filters[32]; //runs only tests whose name contains one of the filters. If there are none runs everything.
+    int filter_count;
+    int jobs;                //max number of tests running at once. 0 means one per processor.
+    bool isolate;            //runs every test in its own forked process so that a crash or a hang does not take down the whole run. Unix only.
+    bool list;               //only lists the selected tests without running them
+    double timeout;          //kills isolated tests running for longer than this many seconds. 0 means no limit.
+} Test_Runner_Options;
+
+static Test_Runner_Options test_runner_options = {{0}, 0, 0, true, false, 0};
+
 static bool run_test(Test_Run_Context context);
 static int run_tests(int* total, double time, ...);
 
 #define UNIT_TEST(func) SINIT(Test_Run_Context){(void*) (func), #func, TEST_FUNC_TYPE_SIMPLE}
 #define TIMED_TEST(func, ...) SINIT(Test_Run_Context){(void*) (func), #func, TEST_FUNC_TYPE_TIMED, 0, ##__VA_ARGS__}
 
-static void test_all(double total_time)
+static bool test_all(double total_time)
 {
     //unicode_format_ranges_file("GeneralCategory.txt", "GeneralCategory_C.txt");
-    run_tests(NULL, total_time, 
+    int total = 0;
+    int passed = run_tests(&total, total_time, 
         UNIT_TEST(platform_test_all),
         UNIT_TEST(test_unicode_unit),
         UNIT_TEST(test_list),
@@ -79,9 +135,26 @@ static void test_all(double total_time)
         UNIT_TEST(test_path),
         UNIT_TEST(test_log),
         UNIT_TEST(test_match),
+        UNIT_TEST(test_hash_snapshot),
+        UNIT_TEST(test_hash_parallel),
+        UNIT_TEST(test_filter),
+        UNIT_TEST(test_sort_external),
+        UNIT_TEST(test_slz4_parallel),
+        UNIT_TEST(test_serialize_stream),
+        UNIT_TEST(test_parallel),
+        UNIT_TEST(test_spatial),
+        UNIT_TEST(test_image_pyramid),
+        UNIT_TEST(test_unicode_norm),
+        UNIT_TEST(test_unicode_segment),
+        UNIT_TEST(test_path_store),
+        UNIT_TEST(test_frozen),
+        UNIT_TEST(test_allocator_tracking),
         TIMED_TEST(test_hash),
         TIMED_TEST(test_stable),
         TIMED_TEST(test_map),
+        TIMED_TEST(test_map_robin),
+        TIMED_TEST(test_btree),
+        TIMED_TEST(test_time),
         TIMED_TEST(test_base64),
         TIMED_TEST(test_utf),
         TIMED_TEST(test_array),
@@ -96,11 +169,123 @@ static void test_all(double total_time)
         TIMED_TEST(test_spmc_queue),
         UNIT_TEST(NULL)
     );
+    return passed == total;
+}
+
+//The bench_ functions use fixed iteration counts and ignore the time they are given. 
+//They run one at a time so that they do not compete for cores. The results are compared against 
+// the stored baseline (see bench.h). Regressions fail the run only with --check.
+static bool bench_all(double total_time)
+{
+    test_runner_options.jobs = 1;
+    bench_reset_results();
+
+    int total = 0;
+    int passed = run_tests(&total, total_time, 
+        TIMED_TEST(bench_map),
+        TIMED_TEST(bench_hash),
+        TIMED_TEST(bench_stable),
+        TIMED_TEST(bench_channel),
+        TIMED_TEST(bench_spmc_queue),
+        TIMED_TEST(bench_slz4),
+        TIMED_TEST(bench_slz4_parallel),
+        TIMED_TEST(bench_slz4_dictionary),
+        TIMED_TEST(bench_serialize_schema),
+        TIMED_TEST(bench_serialize_stream),
+        TIMED_TEST(bench_base64),
+        TIMED_TEST(bench_utf),
+        TIMED_TEST(bench_sort),
+        TIMED_TEST(bench_select),
+        TIMED_TEST(bench_sort_external),
+        TIMED_TEST(bench_allocator),
+        TIMED_TEST(bench_map_robin),
+        TIMED_TEST(bench_hash_snapshot),
+        TIMED_TEST(bench_hash_parallel),
+        TIMED_TEST(bench_filter),
+        TIMED_TEST(bench_spatial),
+        TIMED_TEST(bench_image_pyramid),
+        TIMED_TEST(bench_unicode_norm),
+        TIMED_TEST(bench_unicode_segment),
+        TIMED_TEST(bench_path_store),
+        TIMED_TEST(bench_scratch),
+        TIMED_TEST(bench_allocator_dispatch),
+        TIMED_TEST(bench_frozen),
+        TIMED_TEST(bench_debug_allocator),
+        TIMED_TEST(bench_allocator_tracking),
+        TIMED_TEST(bench_btree),
+        TIMED_TEST(bench_time),
+        UNIT_TEST(NULL)
+    );
+
+    if(test_runner_options.list)
+        return true;
+
+    isize regressions = bench_compare_baseline();
+    if(regressions > 0 && bench_options.check)
+        LOG_ERROR("BENCH", "%lli benchmarks regressed by more than %.0lf%%", (long long) regressions, bench_options.threshold*100);
+    else if(regressions > 0)
+        LOG_WARN("BENCH", "%lli benchmarks are more than %.0lf%% slower than the baseline. Pass --check to fail the run on this", (long long) regressions, bench_options.threshold*100);
+    return passed == total && (regressions == 0 || bench_options.check == false);
 }
 
 #if defined(TEST_RUNNER)
-    int main()
+    static void print_usage(const char* program)
+    {
+        printf("usage: %s [options] [filter...]\n", program);
+        printf("Runs all tests whose name contains any of the filters (or all tests if no filter is given).\n");
+        printf("  -j, --jobs N      run up to N tests at once (default: processor count)\n");
+        printf("  -t, --time S      total time budget in seconds split between the timed tests (default: 30)\n");
+        printf("      --timeout S   kill tests running longer than S seconds (default: no limit)\n");
+        printf("      --no-fork     run all tests serially within this process (useful for debugging)\n");
+        printf("      --list        only list the selected tests\n");
+        printf("benchmarks only:\n");
+        printf("      --results P   file the results are written into as csv (default: %s)\n", bench_options.results_path);
+        printf("      --baseline P  baseline to compare the results against (default: %s)\n", bench_options.baseline_path);
+        printf("      --threshold X relative slowdown reported as a regression (default: %.2lf)\n", bench_options.threshold);
+        printf("      --save-baseline  overwrite the baseline with the results\n");
+        printf("      --check       fail the run when a benchmark regressed by more than the threshold\n");
+    }
+
+    int main(int argc, char** argv)
     {
+        double time = 30;
+        for(int i = 1; i < argc; i++)
+        {
+            const char* arg = argv[i];
+            const char* value = i + 1 < argc ? argv[i + 1] : "0";
+            if(strcmp(arg, "-j") == 0 || strcmp(arg, "--jobs") == 0)
+                test_runner_options.jobs = atoi(value), i++;
+            else if(strcmp(arg, "-t") == 0 || strcmp(arg, "--time") == 0)
+                time = atof(value), i++;
+            else if(strcmp(arg, "--timeout") == 0)
+                test_runner_options.timeout = atof(value), i++;
+            else if(strcmp(arg, "--no-fork") == 0)
+                test_runner_options.isolate = false;
+            else if(strcmp(arg, "--list") == 0)
+                test_runner_options.list = true;
+            else if(strcmp(arg, "--results") == 0)
+                bench_options.results_path = value, i++;
+            else if(strcmp(arg, "--baseline") == 0)
+                bench_options.baseline_path = value, i++;
+            else if(strcmp(arg, "--threshold") == 0)
+                bench_options.threshold = atof(value), i++;
+            else if(strcmp(arg, "--save-baseline") == 0)
+                bench_options.save_baseline = true;
+            else if(strcmp(arg, "--check") == 0)
+                bench_options.check = true;
+            else if(strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+                print_usage(argv[0]);
+                return 0;
+            }
+            else if(arg[0] == '-') {
+                fprintf(stderr, "unknown option '%s'\n", arg);
+                print_usage(argv[0]);
+                return 2;
+            }
+            else if(test_runner_options.filter_count < (int) ARRAY_COUNT(test_runner_options.filters))
+                test_runner_options.filters[test_runner_options.filter_count++] = arg;
+        }
+
         platform_init();
         
         Scratch_Arena* global_stack = global_scratch_arena();
@@ -109,10 +294,14 @@ static void test_all(double total_time)
         File_Logger logger = {0};
         file_logger_init(&logger, "logs", FILE_LOGGER_USE);
 
-        test_all(30);
+        #if defined(BENCH_RUNNER)
+            bool ok = bench_all(time);
+        #else
+            bool ok = test_all(time);
+        #endif
 
         //no deinit code!
-        return 0;
+        return ok ? 0 : 1;
     }
 
     #if PLATFORM_OS == PLATFORM_OS_UNIX
@@ -124,6 +313,13 @@ static void test_all(double total_time)
     #endif
 #endif
 
+typedef struct Test_Run_Result {
+    bool ok;
+    bool ran;
+    char error[62];  //why an isolated test died. Empty if it finished on its own.
+    double seconds;  //wall clock time
+} Test_Run_Result;
+
 static void _run_test_try(void* context)
 {
     Test_Run_Context* c = (Test_Run_Context*) context;
@@ -157,42 +353,229 @@ static bool run_test(Test_Run_Context context)
     return ok;
 }
 
+static bool _run_test_selected(const char* name)
+{
+    if(test_runner_options.filter_count == 0)
+        return true;
+    for(int i = 0; i < test_runner_options.filter_count; i++)
+        if(strstr(name, test_runner_options.filters[i]))
+            return true;
+    return false;
+}
+
+#if PLATFORM_OS == PLATFORM_OS_UNIX
+    #include <unistd.h>
+    #include <signal.h>
+    #include <sys/wait.h>
+
+    typedef struct _Test_Worker {
+        pid_t pid;
+        int index;
+        bool killed;
+        double start;
+        FILE* output;
+    } _Test_Worker;
+
+    //Runs each test in a forked child process, up to jobs at the same time. 
+    //A test that crashes or gets killed for exceeding the timeout only fails itself.
+    static void _run_tests_isolated(const Test_Run_Context* contexts, Test_Run_Result* results, int count, int jobs)
+    {
+        _Test_Worker workers[256] = {0};
+        int running = 0;
+        int next = 0;
+
+        //With a single worker the output can go straight to the console. Otherwise the output of each test 
+        // is captured and printed in one piece once it finishes so that concurrent tests do not interleave.
+        bool capture = jobs > 1;
+        while(next < count || running > 0)
+        {
+            while(running < jobs && next < count)
+            {
+                _Test_Worker* worker = &workers[running];
+                memset(worker, 0, sizeof *worker);
+                worker->index = next++;
+                worker->output = capture ? tmpfile() : NULL;
+                worker->start = clock_sec();
+
+                //else anything buffered would get printed by both processes
+                fflush(NULL);
+                worker->pid = fork();
+                if(worker->pid == 0)
+                {
+                    if(worker->output) {
+                        dup2(fileno(worker->output), STDOUT_FILENO);
+                        dup2(fileno(worker->output), STDERR_FILENO);
+                    }
+                    bool ok = run_test(contexts[worker->index]);
+                    fflush(NULL);
+                    _exit(ok ? 0 : 1);
+                }
+
+                if(worker->pid < 0) {
+                    LOG_WARN("TEST", "fork failed: %s. Running '%s' in this process", strerror(errno), contexts[worker->index].name);
+                    if(worker->output)
+                        fclose(worker->output);
+                    results[worker->index].ok = run_test(contexts[worker->index]);
+                    results[worker->index].ran = true;
+                    results[worker->index].seconds = clock_sec() - worker->start;
+                    continue;
+                }
+                running += 1;
+            }
+
+            if(running == 0)
+                continue;
+
+            int status = 0;
+            pid_t pid = waitpid(-1, &status, test_runner_options.timeout > 0 ? WNOHANG : 0);
+            if(pid <= 0)
+            {
+                double now = clock_sec();
+                for(int i = 0; i < running; i++)
+                    if(workers[i].killed == false && now - workers[i].start > test_runner_options.timeout) {
+                        kill(workers[i].pid, SIGKILL);
+                        workers[i].killed = true;
+                    }
+
+                platform_thread_sleep(0.005);
+                continue;
+            }
+
+            int w = 0;
+            for(; w < running; w++)
+                if(workers[w].pid == pid)
+                    break;
+            if(w == running)
+                continue;
+
+            _Test_Worker* worker = &workers[w];
+            Test_Run_Context context = contexts[worker->index];
+            Test_Run_Result* result = &results[worker->index];
+            result->ran = true;
+            result->seconds = clock_sec() - worker->start;
+            if(WIFEXITED(status))
+                result->ok = WEXITSTATUS(status) == 0;
+            else if(worker->killed)
+                snprintf(result->error, sizeof result->error, "timed out after %.1lfs", result->seconds);
+            else if(WIFSIGNALED(status))
+                snprintf(result->error, sizeof result->error, "crashed with signal %i (%s)", WTERMSIG(status), strsignal(WTERMSIG(status)));
+            else
+                snprintf(result->error, sizeof result->error, "exited abnormally");
+
+            if(worker->output)
+            {
+                char buffer[4096];
+                rewind(worker->output);
+                for(size_t read = 0; (read = fread(buffer, 1, sizeof buffer, worker->output)) > 0; )
+                    fwrite(buffer, 1, read, stdout);
+                fclose(worker->output);
+            }
+
+            if(result->error[0])
+                LOG_ERROR("TEST", "%s FAILED: %s", context.name, result->error);
+
+            workers[w] = workers[--running];
+        }
+    }
+#endif
+
 static int run_tests(int* total, double time, ...)
 {
     Test_Run_Context contexts[256] = {0};
+    Test_Run_Result results[256] = {0};
     int count = 0;
     int timed_count = 0;
 
     va_list ap;
     va_start(ap, time);
-    for(; count < 256; count++)
+    while(count < 256)
     {
-        contexts[count] = va_arg(ap, Test_Run_Context);
-        timed_count += contexts[count].type == TEST_FUNC_TYPE_TIMED;
-        if(contexts[count].func == NULL)
+        Test_Run_Context context = va_arg(ap, Test_Run_Context);
+        if(context.func == NULL)
             break;
+        if(_run_test_selected(context.name)) {
+            contexts[count++] = context;
+            timed_count += context.type == TEST_FUNC_TYPE_TIMED;
+        }
     }
     va_end(ap);
 
-    LOG_INFO("TEST", "RUNNING %i TESTS (time = %lfs)", count, time);
-    double time_for_one = time/timed_count;
-    int successfull = 0;
-    for(int i = 0; i < count; i++)
+    if(total)
+        *total = count;
+
+    if(test_runner_options.list)
     {
+        for(int i = 0; i < count; i++)
+            printf("%s\n", contexts[i].name);
+        return count;
+    }
+
+    bool isolate = test_runner_options.isolate;
+    int jobs = test_runner_options.jobs > 0 ? test_runner_options.jobs : platform_thread_get_processor_count();
+    #if PLATFORM_OS != PLATFORM_OS_UNIX
+        isolate = false;
+    #endif
+    if(isolate == false || jobs < 1)
+        jobs = 1;
+    if(jobs > count && count > 0)
+        jobs = count;
+
+    //The timed tests run on jobs cores at once, so each can take jobs times its share of the total time
+    LOG_INFO("TEST", "RUNNING %i TESTS (time = %lfs, jobs = %i)", count, time, jobs);
+    double time_for_one = timed_count > 0 ? time*jobs/timed_count : 0;
+    for(int i = 0; i < count; i++)
         if(contexts[i].max_time == 0) 
             contexts[i].max_time = time_for_one;
-        successfull += run_test(contexts[i]);
+
+    double start = clock_sec();
+    #if PLATFORM_OS == PLATFORM_OS_UNIX
+    if(isolate)
+        _run_tests_isolated(contexts, results, count, jobs);
+    else
+    #endif
+    {
+        for(int i = 0; i < count; i++)
+        {
+            double test_start = clock_sec();
+            results[i].ok = run_test(contexts[i]);
+            results[i].ran = true;
+            results[i].seconds = clock_sec() - test_start;
+        }
     }
+    double duration = clock_sec() - start;
 
-    if(total)
-        *total = count;
+    //Timing report, slowest first
+    int order[256] = {0};
+    for(int i = 0; i < count; i++)
+    {
+        int j = i;
+        for(; j > 0 && results[order[j - 1]].seconds < results[i].seconds; j--)
+            order[j] = order[j - 1];
+        order[j] = i;
+    }
+
+    int successfull = 0;
+    double sum = 0;
+    LOG_INFO("TEST", "TIMINGS:");
+    for(int i = 0; i < count; i++)
+    {
+        Test_Run_Result result = results[order[i]];
+        const char* name = contexts[order[i]].name;
+        successfull += result.ok;
+        sum += result.seconds;
+        if(result.ok)
+            LOG_INFO("TEST", "%9.3lfs OK     %s", result.seconds, name);
+        else
+            LOG_ERROR("TEST", "%9.3lfs FAILED %s %s", result.seconds, name, result.error);
+    }
+    LOG_INFO("TEST", "took %.3lfs (%.3lfs summed over all tests)", duration, sum);
 
     if(successfull == count)
-        LOG_OKAY("TEST", "TESTING FINISHED! passed %i of %i test uwu", count, successfull);
+        LOG_OKAY("TEST", "TESTING FINISHED! passed %i of %i test uwu", successfull, count);
     else
-        LOG_WARN("TEST", "TESTING FINISHED! passed %i of %i tests", count, successfull);
+        LOG_WARN("TEST", "TESTING FINISHED! passed %i of %i tests", successfull, count);
 
     return successfull;
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "../allocator_tracking.h"
+#include "../platform.h"
+
+//Returns the merged stats of the site at file:line with label or zeroed stats if it holds no live memory.
+INTERNAL Tracking_Site_Stats _test_tracking_site(const char* file, int32_t line, const char* label)
+{
+    Tracking_Site_Stats out = {0};
+    Tracking_Site_Stats sites[64] = {0};
+    isize count = tracking_allocator_get_sites(sites, 64);
+    for(isize i = 0; i < count && i < 64; i++)
+        if(sites[i].site.file == file && sites[i].site.line == line && sites[i].site.label == label)
+            out = sites[i];
+    return out;
+}
+
+typedef struct _Test_Tracking_Thread {
+    Tracking_Allocator* tracking;
+    void* ptrs[100];
+    int32_t line;
+    PLATFORM_ATOMIC(uint32_t) done;
+} _Test_Tracking_Thread;
+
+INTERNAL void _test_tracking_thread_func(void* context)
+{
+    _Test_Tracking_Thread* thread = (_Test_Tracking_Thread*) context;
+    for(isize i = 0; i < 100; i++) {
+        thread->line = __LINE__; thread->ptrs[i] = ALLOCATE(thread->tracking->alloc, 10, uint32_t);
+    }
+    atomic_store(&thread->done, 1);
+    platform_futex_wake_all(&thread->done);
+}
+
+INTERNAL void test_allocator_tracking()
+{
+    Tracking_Allocator tracking = {0};
+    tracking_allocator_init(&tracking, "test_allocator_tracking", TRACKING_ALLOCATOR_INIT_SITES);
+    const char* file = __FILE__;
+    const char* label = "test label";
+
+    //Two sites, one allocating more
+    int32_t big_line = __LINE__; uint64_t* big = ALLOCATE(tracking.alloc, 1000, uint64_t);
+    int32_t small_line = __LINE__; uint8_t* small = ALLOCATE(tracking.alloc, 24, uint8_t);
+    TEST(_test_tracking_site(file, big_line, NULL).bytes_allocated == 8000);
+    TEST(_test_tracking_site(file, small_line, NULL).bytes_allocated == 24);
+    TEST(_test_tracking_site(file, small_line, NULL).allocation_count == 1);
+    TEST(allocator_get_site().file == NULL);
+
+    {
+        Tracking_Site_Stats sites[2] = {0};
+        TEST(tracking_allocator_get_sites(sites, 2) >= 2);
+        TEST(sites[0].bytes_allocated >= sites[1].bytes_allocated);
+        TEST(sites[0].site.line == big_line);
+    }
+
+    //Untagged growth stays with the original site, tagged reallocation moves to the new one
+    small = (uint8_t*) allocator_reallocate(tracking.alloc, 48, small, 24, 1);
+    TEST(_test_tracking_site(file, small_line, NULL).bytes_allocated == 48);
+    int32_t realloc_line = __LINE__; small = REALLOCATE(tracking.alloc, 64, small, 48, uint8_t);
+    TEST(_test_tracking_site(file, small_line, NULL).bytes_allocated == 0);
+    TEST(_test_tracking_site(file, realloc_line, NULL).bytes_allocated == 64);
+    TEST(_test_tracking_site(file, realloc_line, NULL).allocation_total == 1);
+
+    //The label covers untagged allocations such as the ones made by containers
+    const char* prev_label = allocator_set_site_label(label);
+    void* labeled = allocator_allocate(tracking.alloc, 100, 8);
+    int32_t labeled_line = __LINE__; void* labeled_here = ALLOCATE(tracking.alloc, 7, uint8_t);
+    TEST(allocator_set_site_label(prev_label) == label);
+    TEST(_test_tracking_site(NULL, 0, label).bytes_allocated == 100);
+    TEST(_test_tracking_site(file, labeled_line, label).bytes_allocated == 7);
+
+    //Allocations of other threads are merged. They can also be freed from here
+    _Test_Tracking_Thread thread = {&tracking};
+    TEST(platform_thread_launch(0, _test_tracking_thread_func, &thread, "tracking test") == 0);
+    while(atomic_load(&thread.done) == 0)
+        platform_futex_wait(&thread.done, 0, -1);
+    TEST(_test_tracking_site(file, thread.line, NULL).bytes_allocated == 100*10*sizeof(uint32_t));
+    TEST(_test_tracking_site(file, thread.line, NULL).allocation_count == 100);
+    for(isize i = 0; i < 50; i++)
+        DEALLOCATE(tracking.alloc, thread.ptrs[i], 10, uint32_t);
+    TEST(_test_tracking_site(file, thread.line, NULL).bytes_allocated == 50*10*sizeof(uint32_t));
+
+    DEALLOCATE(tracking.alloc, big, 1000, uint64_t);
+    allocator_deallocate(tracking.alloc, labeled, 100, 8);
+    TEST(_test_tracking_site(file, big_line, NULL).allocation_count == 0);
+    TEST(_test_tracking_site(NULL, 0, label).allocation_count == 0);
+    (void) labeled_here;
+
+    //Deinit frees everything and so must clear the remaining sites
+    tracking_allocator_deinit(&tracking);
+    TEST(_test_tracking_site(file, realloc_line, NULL).bytes_allocated == 0);
+    TEST(_test_tracking_site(file, labeled_line, label).bytes_allocated == 0);
+    TEST(_test_tracking_site(file, thread.line, NULL).bytes_allocated == 0);
+}
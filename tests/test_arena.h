@@ -1,5 +1,9 @@
 #pragma once
 #include "../scratch.h"
+#include "../allocator_dispatch.h"
+#include "../array.h"
+#include "../string.h"
+#include "../hash.h"
 #include "../random.h"
 #include "../time.h"
 #include "../assert.h"
@@ -180,9 +184,107 @@ void test_arena_assembly()
         scratch_push_nonzero(&arena, 200, void*);
 }
 
+//The inline fast path must fall back whenever the frame is not the top of its stack or memory needs to be committed
+static void test_arena_push_inline()
+{
+    typedef struct {double x; char c;} Aligned8;
+    typedef struct {char c[3];} Aligned1;
+
+    Scratch_Arena arena_stack = {0};
+    scratch_arena_init(&arena_stack, "test_arena_push_inline", 64*MB, 64*KB, 0);
+    SCRATCH_SCOPE_FROM(level1, &arena_stack)
+    {
+        for(isize i = 0; i < 10000; i++)
+        {
+            Aligned1* a = scratch_push_one(&level1, Aligned1);
+            Aligned8* b = scratch_push_one(&level1, Aligned8);
+            int* c = scratch_push_nonzero(&level1, i % 7, int);
+            TEST(a && b && c);
+            TEST((uintptr_t) b % __alignof(Aligned8) == 0 && (uintptr_t) c % __alignof(int) == 0);
+            TEST(a->c[0] == 0 && a->c[2] == 0 && b->x == 0 && b->c == 0);
+            memset(b, 0x11, sizeof *b);
+        }
+        TEST(arena_stack.commit_count > 0);
+
+        //Level 3 lives in the same stack as level 1 so pushing into level 1 while it is alive is a fall
+        SCRATCH_SCOPE_FROM(level2, &arena_stack)
+        SCRATCH_SCOPE_FROM(level3, &arena_stack)
+        {
+            char* inner = scratch_push(&level3, 100, char);
+            memset(inner, 0x22, 100);
+            isize falls = arena_stack.fall_count;
+            char* outer = scratch_push(&level1, 100, char);
+            TEST(arena_stack.fall_count == falls + 1);
+            TEST(outer >= inner + 100 || outer + 100 <= inner);
+            TEST(inner[99] == 0x22 && outer[99] == 0);
+            (void) level2;
+        }
+    }
+    scratch_arena_deinit(&arena_stack);
+}
+
+//Containers growing in Arena and Scratch through allocator_dispatch
+static void test_allocator_dispatch()
+{
+    Arena arena = {0};
+    TEST(arena_init(&arena, "test_allocator_dispatch", 0, 0) == 0);
+    {
+        //The arena holds a single allocation which grows in place
+        i64_Array array = {arena.alloc};
+        for(isize i = 0; i < 100000; i++)
+            array_push(&array, i);
+        TEST(array.count == 100000 && (uint8_t*) array.data == arena.data);
+        TEST(array.data[0] == 0 && array.data[99999] == 99999);
+        array_deinit(&array);
+        TEST(arena.used_to == arena.data);
+    }
+    arena_deinit(&arena);
+
+    Scratch_Arena scratch_arena = {0};
+    TEST(scratch_arena_init(&scratch_arena, "test_allocator_dispatch", 0, 0, 0) == 0);
+    SCRATCH_SCOPE_FROM(scratch, &scratch_arena)
+    {
+        String_Builder builder = builder_make(scratch.alloc, 0);
+        Hash hash = {0};
+        hash_init(&hash, scratch.alloc, 0);
+        for(isize i = 0; i < 1000; i++)
+        {
+            builder_append(&builder, STRING("abc"));
+            hash_insert(&hash, (uint64_t) i*7919, (uint64_t) i + 2);
+
+            //Growing in a frame which is not the top of its stack falls back to the slow path
+            if(i % 100 == 0)
+                SCRATCH_SCOPE_FROM(level2, &scratch_arena)
+                SCRATCH_SCOPE_FROM(level3, &scratch_arena)
+                {
+                    i64_Array array = {level3.alloc};
+                    for(isize k = 0; k < 100; k++)
+                        array_push(&array, k);
+                    builder_append(&builder, STRING("d"));
+                    TEST(array.data[99] == 99);
+                    (void) level2;
+                }
+        }
+
+        TEST(builder.count == 3000 + 10);
+        TEST(string_is_equal(string_head(builder.string, 4), STRING("abcd")));
+        TEST(hash.count == 1000);
+        for(isize i = 0; i < 1000; i++)
+        {
+            isize found = -1;
+            TEST(hash_find(&hash, (uint64_t) i*7919, &found) && hash.entries[found].value == (uint64_t) i + 2);
+        }
+        builder_deinit(&builder);
+        hash_deinit(&hash);
+    }
+    scratch_arena_deinit(&scratch_arena);
+}
+
 static void test_arena(f64 time)
 {
     test_arena_unit();
+    test_arena_push_inline();
+    test_allocator_dispatch();
     test_arena_stress(time);
     test_arena_assembly();
 }
\ No newline at end of file
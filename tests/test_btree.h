@@ -0,0 +1,278 @@
+#pragma once
+
+#include "../btree.h"
+#include "../hash_func.h"
+#include "../allocator_debug.h"
+#include "../random.h"
+#include "../time.h"
+#include "../log.h"
+#include "bench.h"
+
+INTERNAL bool _test_btree_u64_is_less(const void* a, const void* b, void* context)
+{
+    (void) context;
+    return *(const uint64_t*) a < *(const uint64_t*) b;
+}
+
+//Reference sorted array of keys. Values are always derived from the key so we dont need to store them.
+typedef struct _Test_BTree_Reference {
+    uint64_t* keys;
+    isize count;
+} _Test_BTree_Reference;
+
+INTERNAL uint64_t _test_btree_value(uint64_t key, uint64_t generation)
+{
+    return hash64_bijective(key) + generation;
+}
+
+INTERNAL void _test_btree_check_range(const BTree* tree, const _Test_BTree_Reference* ref, uint64_t from, uint64_t to)
+{
+    isize i = lower_bound(&from, ref->keys, ref->count, sizeof(uint64_t), _test_btree_u64_is_less, NULL);
+    for(BTree_Iter it = btree_lower_bound(tree, from); btree_iterate(&it) && it.key < to; i++) {
+        TEST(i < ref->count && ref->keys[i] == it.key);
+    }
+    TEST(i == ref->count || ref->keys[i] >= to);
+}
+
+INTERNAL void test_btree_stress(isize node_size, isize ops, uint64_t key_range)
+{
+    Debug_Allocator debug = debug_allocator_make(allocator_get_default(), DEBUG_ALLOC_LEAK_CHECK);
+    {
+        _Test_BTree_Reference ref = {0};
+        ref.keys = (uint64_t*) allocator_allocate(debug.alloc, key_range*sizeof(uint64_t), 8);
+        uint64_t* generations = (uint64_t*) allocator_allocate(debug.alloc, key_range*sizeof(uint64_t), 8);
+        memset(generations, 0, key_range*sizeof(uint64_t));
+
+        BTree tree = {0};
+        btree_init(&tree, debug.alloc, node_size);
+        for(isize op = 0; op < ops; op++) {
+            //Bias towards inserting for the first half and towards removing for the second so that the tree both grows and shrinks
+            uint64_t key = (uint64_t) random_range(0, (int64_t) key_range);
+            isize at = lower_bound(&key, ref.keys, ref.count, sizeof(uint64_t), _test_btree_u64_is_less, NULL);
+            bool present = at < ref.count && ref.keys[at] == key;
+            isize insert_chance = op < ops/2 ? 70 : 30;
+            isize action = random_range(0, 100);
+            if(action < insert_chance) {
+                generations[key] += 1;
+                TEST(btree_set(&tree, key, _test_btree_value(key, generations[key])) == !present);
+                if(!present) {
+                    memmove(ref.keys + at + 1, ref.keys + at, (ref.count - at)*sizeof(uint64_t));
+                    ref.keys[at] = key;
+                    ref.count += 1;
+                }
+            }
+            else if(action < 95) {
+                uint64_t removed = 0;
+                TEST(btree_remove(&tree, key, &removed) == present);
+                if(present) {
+                    TEST(removed == _test_btree_value(key, generations[key]));
+                    memmove(ref.keys + at, ref.keys + at + 1, (ref.count - at - 1)*sizeof(uint64_t));
+                    ref.count -= 1;
+                }
+            }
+            else {
+                uint64_t to = key + (uint64_t) random_range(0, 100);
+                _test_btree_check_range(&tree, &ref, key, to);
+            }
+
+            uint64_t found = 0;
+            bool is_in_ref = at < ref.count && ref.keys[at] == key;
+            TEST(btree_find(&tree, key, &found) == is_in_ref);
+            TEST(is_in_ref == false || found == _test_btree_value(key, generations[key]));
+            TEST(tree.count == ref.count);
+            if(op % 512 == 0)
+                btree_test_consistency(&tree);
+        }
+
+        btree_test_consistency(&tree);
+        _test_btree_check_range(&tree, &ref, 0, UINT64_MAX);
+
+        //Remove everything
+        for(isize i = 0; i < ref.count; i++)
+            TEST(btree_remove(&tree, ref.keys[i], NULL));
+        TEST(tree.count == 0 && tree.root == NULL && tree.node_count == 0);
+        btree_test_consistency(&tree);
+
+        btree_deinit(&tree);
+        allocator_deallocate(debug.alloc, generations, key_range*sizeof(uint64_t), 8);
+        allocator_deallocate(debug.alloc, ref.keys, key_range*sizeof(uint64_t), 8);
+    }
+    debug_allocator_deinit(&debug);
+}
+
+INTERNAL void test_btree_build_sorted(isize node_size, isize count)
+{
+    Debug_Allocator debug = debug_allocator_make(allocator_get_default(), DEBUG_ALLOC_LEAK_CHECK);
+    {
+        uint64_t* keys = (uint64_t*) allocator_allocate(debug.alloc, count*sizeof(uint64_t), 8);
+        uint64_t* values = (uint64_t*) allocator_allocate(debug.alloc, count*sizeof(uint64_t), 8);
+        for(isize i = 0; i < count; i++) {
+            keys[i] = (uint64_t) i*3 + 1;
+            values[i] = _test_btree_value(keys[i], 0);
+        }
+
+        BTree tree = {0};
+        btree_init(&tree, debug.alloc, node_size);
+        btree_set(&tree, 0, 0); //is replaced
+        btree_build_sorted(&tree, keys, values, count);
+        btree_test_consistency(&tree);
+        TEST(tree.count == count);
+
+        isize i = 0;
+        for(BTree_Iter it = btree_iter_begin(&tree); btree_iterate(&it); i++)
+            TEST(it.key == keys[i] && *it.value == values[i]);
+        TEST(i == count);
+
+        //Lower bound of keys between the stored ones
+        for(isize j = 0; j < count; j++) {
+            BTree_Iter it = btree_lower_bound(&tree, keys[j] - 1);
+            TEST(btree_iterate(&it) && it.key == keys[j]);
+        }
+        BTree_Iter past_end = btree_lower_bound(&tree, (uint64_t) count*3 + 1);
+        TEST(btree_iterate(&past_end) == false);
+
+        //The tree remains fully usable
+        for(isize j = 0; j < count; j++)
+            TEST(btree_set(&tree, keys[j] + 1, 0));
+        for(isize j = 0; j < count; j += 2)
+            TEST(btree_remove(&tree, keys[j], NULL));
+        TEST(tree.count == count + count/2);
+        btree_test_consistency(&tree);
+
+        btree_deinit(&tree);
+        allocator_deallocate(debug.alloc, values, count*sizeof(uint64_t), 8);
+        allocator_deallocate(debug.alloc, keys, count*sizeof(uint64_t), 8);
+    }
+    debug_allocator_deinit(&debug);
+}
+
+INTERNAL void test_btree(f64 max_seconds)
+{
+    f64 start = clock_sec();
+    isize node_sizes[] = {BTREE_MIN_NODE_SIZE, 256, 0, BTREE_MAX_NODE_SIZE};
+    for(isize i = 0; i < ARRAY_COUNT(node_sizes); i++) {
+        test_btree_build_sorted(node_sizes[i], 0);
+        test_btree_build_sorted(node_sizes[i], 1);
+        test_btree_build_sorted(node_sizes[i], 15);
+        test_btree_build_sorted(node_sizes[i], 2000);
+
+        test_btree_stress(node_sizes[i], 20000, 100);
+        test_btree_stress(node_sizes[i], 20000, 5000);
+    }
+
+    //Spend the rest of the budget on random node sizes and key ranges
+    while(clock_sec() - start < max_seconds) {
+        isize node_size = random_range(BTREE_MIN_NODE_SIZE, BTREE_MAX_NODE_SIZE + 1);
+        uint64_t key_range = (uint64_t) random_range(1, 10000);
+        test_btree_stress(node_size, random_range(1, 20000), key_range);
+    }
+}
+
+//Compares B+tree of different node sizes against a sorted array with lower_bound on a mixed workload
+// of lookups, inserts and short range scans. Not part of the regular tests.
+INTERNAL void bench_btree(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {COUNT = 1 << 20, OPS = 1 << 18, SCAN = 64};
+    Allocator* alloc = allocator_get_default();
+
+    //ops: 80% lookups, 10% inserts, 10% range scans
+    uint64_t* keys = (uint64_t*) allocator_allocate(alloc, (COUNT + OPS)*sizeof(uint64_t), 8);
+    uint64_t* ops_keys = (uint64_t*) allocator_allocate(alloc, OPS*sizeof(uint64_t), 8);
+    uint8_t* ops_kinds = (uint8_t*) allocator_allocate(alloc, OPS, 8);
+    for(isize i = 0; i < COUNT; i++)
+        keys[i] = hash64_bijective((uint64_t) i);
+    for(isize i = 0; i < OPS; i++) {
+        isize kind = random_range(0, 10);
+        ops_kinds[i] = kind == 0 ? 1 : kind == 1 ? 2 : 0;
+        ops_keys[i] = ops_kinds[i] == 1 ? hash64_bijective((uint64_t) (COUNT + i)) : keys[random_range(0, COUNT)];
+    }
+
+    //Sorted array. The memmove of inserts makes each op O(n) so only the first SORTED_OPS ops are run.
+    {
+        enum {SORTED_OPS = OPS/16};
+        uint64_t* sorted = (uint64_t*) allocator_allocate(alloc, (COUNT + SORTED_OPS)*sizeof(uint64_t), 8);
+        uint64_t checksum = 0;
+        Bench_Time build_time = {0};
+        Bench_Time ops_time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++) {
+            memcpy(sorted, keys, COUNT*sizeof(uint64_t));
+            isize count = COUNT;
+
+            bench_time_start(&build_time);
+            hqsort(sorted, count, sizeof(uint64_t), _test_btree_u64_is_less, NULL);
+            bench_time_stop(&build_time);
+
+            checksum = 0;
+            bench_time_start(&ops_time);
+            for(isize i = 0; i < SORTED_OPS; i++) {
+                uint64_t key = ops_keys[i];
+                isize at = lower_bound(&key, sorted, count, sizeof(uint64_t), _test_btree_u64_is_less, NULL);
+                if(ops_kinds[i] == 1) {
+                    memmove(sorted + at + 1, sorted + at, (count - at)*sizeof(uint64_t));
+                    sorted[at] = key;
+                    count += 1;
+                }
+                else if(ops_kinds[i] == 2) {
+                    for(isize j = at; j < at + SCAN && j < count; j++)
+                        checksum += sorted[j];
+                }
+                else
+                    checksum += at;
+            }
+            bench_time_stop(&ops_time);
+        }
+        bench_report(&build_time, "btree.sorted_array_build", COUNT, 1, COUNT, 0);
+        bench_report(&ops_time, "btree.sorted_array_mixed", COUNT, 1, SORTED_OPS, 0);
+        LOG_INFO("BENCH", "sorted array checksum %llx", (long long) checksum);
+        allocator_deallocate(alloc, sorted, (COUNT + SORTED_OPS)*sizeof(uint64_t), 8);
+    }
+
+    isize node_sizes[] = {256, 512, 1024, 4096};
+    for(isize n = 0; n < ARRAY_COUNT(node_sizes); n++)
+    {
+        uint64_t checksum = 0;
+        int32_t height = 0;
+        Bench_Time build_time = {0};
+        Bench_Time ops_time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++) {
+            BTree tree = {0};
+            btree_init(&tree, alloc, node_sizes[n]);
+
+            bench_time_start(&build_time);
+            for(isize i = 0; i < COUNT; i++)
+                btree_set(&tree, keys[i], (uint64_t) i);
+            bench_time_stop(&build_time);
+
+            checksum = 0;
+            bench_time_start(&ops_time);
+            for(isize i = 0; i < OPS; i++) {
+                uint64_t key = ops_keys[i];
+                if(ops_kinds[i] == 1)
+                    btree_set(&tree, key, (uint64_t) i);
+                else if(ops_kinds[i] == 2) {
+                    isize j = 0;
+                    for(BTree_Iter it = btree_lower_bound(&tree, key); j < SCAN && btree_iterate(&it); j++)
+                        checksum += it.key;
+                }
+                else {
+                    uint64_t value = 0;
+                    btree_find(&tree, key, &value);
+                    checksum += value;
+                }
+            }
+            bench_time_stop(&ops_time);
+            height = tree.height;
+            btree_deinit(&tree);
+        }
+
+        //size is the node size; every tree holds COUNT entries
+        bench_report(&build_time, "btree.build", node_sizes[n], 1, COUNT, 0);
+        bench_report(&ops_time, "btree.mixed", node_sizes[n], 1, OPS, 0);
+        LOG_INFO("BENCH", "btree node %4lli height %i checksum %llx", (long long) node_sizes[n], height, (long long) checksum);
+    }
+
+    allocator_deallocate(alloc, ops_kinds, OPS, 8);
+    allocator_deallocate(alloc, ops_keys, OPS*sizeof(uint64_t), 8);
+    allocator_deallocate(alloc, keys, (COUNT + OPS)*sizeof(uint64_t), 8);
+}
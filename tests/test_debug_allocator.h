@@ -3,7 +3,7 @@
 #include "../random.h"
 
 #include <math.h>
-INTERNAL void test_debug_allocator(double time)
+INTERNAL void test_debug_allocator_options(double time, Debug_Allocator_Options options)
 {
     //this might be a little weird but we debug the debug allocator with itself.
     Debug_Allocator debugdebug = debug_allocator_make(allocator_get_default(), DEBUG_ALLOC_LEAK_CHECK | DEBUG_ALLOC_CONTINUOUS);
@@ -13,16 +13,22 @@ INTERNAL void test_debug_allocator(double time)
         isize* sizes  = ALLOCATE(debugdebug.alloc, MAX_COUNT, isize);
         isize* aligns = ALLOCATE(debugdebug.alloc, MAX_COUNT, isize);
 
+        //A single iteration can take seconds with continuous checks or guard pages so the deadline is checked 
+        // between the individual calls as well. The allocations left over when it passes are freed by deinit.
         isize iter = 0;
-        for(double start = clock_sec(); clock_sec() - start < time; ) {
+        double deadline = clock_sec() + time;
+        for(; clock_sec() < deadline; ) {
             iter += 1;
-            Debug_Allocator debug = debug_allocator_make(debugdebug.alloc, 0);
+            Debug_Allocator debug = {0};
+            debug_allocator_init_options(&debug, debugdebug.alloc, debugdebug.alloc, options);
 
             isize allocate_count = random_range(1, MAX_COUNT);
-            isize reallocate_count = random_range(0, allocate_count);
-            isize deallocate_count = random_range(0, allocate_count);
-
             for(isize j = 0; j < allocate_count; j++) {
+                if(clock_sec() >= deadline) {
+                    allocate_count = j;
+                    break;
+                }
+
                 double float_size = exp2(random_range_f64(-5, 10)) * random_range_f64(1 - 0.05, 1 + 0.05) - 1;
                 float_size = MAX(float_size, 0);
             
@@ -31,7 +37,9 @@ INTERNAL void test_debug_allocator(double time)
                 allocs[j] = debug_allocator_func(debug.alloc, ALLOCATOR_MODE_ALLOC, sizes[j], NULL, 0, aligns[j], NULL);
             }
 
-            for(isize j = 0; j < reallocate_count; j++) {
+            isize reallocate_count = random_range(0, allocate_count);
+            isize deallocate_count = random_range(0, allocate_count);
+            for(isize j = 0; j < reallocate_count && clock_sec() < deadline; j++) {
                 double float_size = exp2(random_range_f64(-5, 10)) * random_range_f64(1 - 0.05, 1 + 0.05) - 1;
                 float_size = MAX(float_size, 0);
             
@@ -41,7 +49,7 @@ INTERNAL void test_debug_allocator(double time)
                 sizes[j] = new_size;
             }
             
-            for(isize j = 0; j < deallocate_count; j++) {
+            for(isize j = 0; j < deallocate_count && clock_sec() < deadline; j++) {
                 double float_size = exp2(random_range_f64(-5, 10)) * random_range_f64(1 - 0.05, 1 + 0.05) - 1;
                 float_size = MAX(float_size, 0);
             
@@ -58,3 +66,158 @@ INTERNAL void test_debug_allocator(double time)
     }
     debug_allocator_deinit(&debugdebug);
 }
+
+typedef struct _Test_Debug_Underflow {
+    Debug_Allocator* debug;
+    uint8_t* ptr;
+    isize size;
+    char message[256];
+} _Test_Debug_Underflow;
+
+INTERNAL void _test_debug_underflow_panic(void* context, const char* type, const char* expression, const char* file, const char* function, int line, const char* format, va_list args)
+{
+    (void) type, (void) expression, (void) file, (void) function, (void) line;
+    _Test_Debug_Underflow* underflow = (_Test_Debug_Underflow*) context;
+    vsnprintf(underflow->message, sizeof underflow->message, format, args);
+}
+
+INTERNAL bool _test_debug_underflow_no_break(void* context)
+{
+    (void) context;
+    return false;
+}
+
+INTERNAL void _test_debug_underflow_free(void* context)
+{
+    _Test_Debug_Underflow* underflow = (_Test_Debug_Underflow*) context;
+    allocator_deallocate(underflow->debug->alloc, underflow->ptr, underflow->size, 8);
+}
+
+//Returns the message of the panic caused by freeing ptr
+INTERNAL const char* _test_debug_panicking_free(_Test_Debug_Underflow* underflow)
+{
+    Panic_Handler handler = {_test_debug_underflow_panic, _test_debug_underflow_no_break, underflow};
+    Panic_Handler prev_handler = panic_set_handler(handler);
+    Logger* prev_logger = log_set_logger(silent_logger());
+    memset(underflow->message, 0, sizeof underflow->message);
+    bool ok = platform_exception_sandbox(_test_debug_underflow_free, underflow, NULL);
+    log_set_logger(prev_logger);
+    panic_set_handler(prev_handler);
+
+    TEST(ok == false);
+    panic_recovered();
+    return underflow->message;
+}
+
+//Writes a byte dist bytes before ptr and returns the message of the panic caused by freeing it. The write is undone afterwards.
+INTERNAL const char* _test_debug_underflow(_Test_Debug_Underflow* underflow, isize dist)
+{
+    uint8_t* at = underflow->ptr - dist;
+    uint8_t before = *at;
+    *at = (uint8_t) ~before;
+    const char* message = _test_debug_panicking_free(underflow);
+    *at = before;
+    return message;
+}
+
+INTERNAL void test_debug_allocator_header_tracking()
+{
+    Debug_Allocator debug = {0};
+    debug_allocator_init(&debug, allocator_get_default(), DEBUG_ALLOC_CHEAP | DEBUG_ALLOC_LEAK_CHECK);
+    isize page_size = platform_page_size();
+
+    //Small allocations are found through their header
+    uint8_t* small = (uint8_t*) allocator_allocate(debug.alloc, 24, 4);
+    const Debug_Allocation* small_alloc = debug_allocator_get_allocation(&debug, small);
+    TEST(small_alloc && small_alloc->ptr == small && small_alloc->size == 24 && small_alloc->align == 4);
+    TEST((uint8_t*) (small_alloc + 1) + debug.header_pre_dead_zone == small);
+    TEST(debug_allocator_get_allocation(&debug, small + 8) == NULL);
+
+    //Underflows into the dead zone as well as into any part of the header are reported as such and not as an invalid pointer
+    {
+        _Test_Debug_Underflow underflow = {&debug, small, 24};
+        isize dists[] = {1, 8, 9, 17, 24, 32, 40, 48, 56, 64, 72};
+        for(isize i = 0; i < ARRAY_COUNT(dists); i++)
+            TEST(strstr(_test_debug_underflow(&underflow, dists[i]), "overwrite before block") != NULL);
+        TEST(debug_allocator_get_allocation(&debug, small) == small_alloc);
+        debug_allocator_test_allocation(debug.alloc, small);
+    }
+
+    //Pointers we did not give out are reported without reading the memory before them. 
+    // The page right before foreign is inaccessible so reading a header there would crash.
+    {
+        uint8_t* pages = NULL;
+        TEST(platform_virtual_reallocate((void**) &pages, NULL, 2*page_size, PLATFORM_VIRTUAL_ALLOC_RESERVE | PLATFORM_VIRTUAL_ALLOC_COMMIT, PLATFORM_MEMORY_PROT_READ_WRITE) == 0);
+        platform_virtual_reallocate(NULL, pages, page_size, PLATFORM_VIRTUAL_ALLOC_COMMIT, PLATFORM_MEMORY_PROT_NO_ACCESS);
+        uint64_t on_stack[4] = {0};
+
+        uint8_t* foreign[] = {pages + page_size, (uint8_t*) (void*) on_stack, small + 8, small + 64};
+        for(isize i = 0; i < ARRAY_COUNT(foreign); i++) {
+            _Test_Debug_Underflow invalid = {&debug, foreign[i], 24};
+            TEST(strstr(_test_debug_panicking_free(&invalid), "invalid pointer") != NULL);
+        }
+        TEST(debug.alive_count == 1);
+        platform_virtual_reallocate(NULL, pages, 2*page_size, PLATFORM_VIRTUAL_ALLOC_RELEASE, PLATFORM_MEMORY_PROT_NO_ACCESS);
+    }
+
+    //Large allocations end right at the guard page
+    isize large_size = debug.options.guard_page_min_size + 3*8;
+    uint8_t* large = (uint8_t*) allocator_allocate(debug.alloc, large_size, 8);
+    TEST((uintptr_t) (large + large_size) % page_size == 0);
+    memset(large, 0x11, large_size);
+    debug_allocator_test_allocation(debug.alloc, large);
+
+    //Unaligned sizes leave less than align bytes of dead zone before the guard page
+    isize odd_size = debug.options.guard_page_min_size + 13;
+    uint8_t* odd = (uint8_t*) allocator_allocate(debug.alloc, odd_size, 16);
+    TEST((uintptr_t) odd % 16 == 0);
+    TEST(page_size - (isize) ((uintptr_t) (odd + odd_size) % page_size) < 16);
+    debug_allocator_test_all_allocations(debug.alloc);
+
+    uint8_t* grown = (uint8_t*) allocator_reallocate(debug.alloc, 2*large_size, large, large_size, 8);
+    TEST(grown[0] == 0x11 && grown[large_size - 1] == 0x11);
+    TEST(debug.alive_count == 3 && debug.bytes_allocated == 24 + odd_size + 2*large_size);
+
+    allocator_deallocate(debug.alloc, small, 24, 4);
+    allocator_deallocate(debug.alloc, odd, odd_size, 16);
+    allocator_deallocate(debug.alloc, grown, 2*large_size, 8);
+    TEST(debug.alive_count == 0 && debug.bytes_allocated == 0);
+    debug_allocator_deinit(&debug);
+}
+
+INTERNAL void test_debug_allocator(double time)
+{
+    test_debug_allocator_header_tracking();
+
+    //Odd sizes and small aligns leave the post dead zone unaligned and even empty
+    uint64_t no_dead_zone_flags[] = {DEBUG_ALLOC_NO_DEAD_ZONE, DEBUG_ALLOC_NO_DEAD_ZONE | DEBUG_ALLOC_CHEAP};
+    for(isize i = 0; i < ARRAY_COUNT(no_dead_zone_flags); i++) {
+        Debug_Allocator debug = debug_allocator_make(allocator_get_default(), no_dead_zone_flags[i] | DEBUG_ALLOC_LEAK_CHECK);
+        uint8_t* ptr = (uint8_t*) allocator_allocate(debug.alloc, 1, 2);
+        ptr = (uint8_t*) allocator_reallocate(debug.alloc, 13, ptr, 1, 2);
+        debug_allocator_test_all_allocations(debug.alloc);
+        allocator_deallocate(debug.alloc, ptr, 13, 2);
+        debug_allocator_deinit(&debug);
+    }
+
+    Debug_Allocator_Options options = {0};
+    options.pre_dead_zone_size = 8;
+    options.post_dead_zone_size = 16;
+    test_debug_allocator_options(time/5, options);
+
+    options.do_header_tracking = true;
+    options.full_check_every = 1;
+    test_debug_allocator_options(time/5, options);
+
+    //Guard most of the allocations
+    options.guard_page_min_size = 256;
+    options.capture_stack_frames_count = 4;
+    test_debug_allocator_options(time/5, options);
+
+    //No dead zones at all
+    Debug_Allocator_Options no_dead_zone = {0};
+    test_debug_allocator_options(time/5, no_dead_zone);
+    no_dead_zone.do_header_tracking = true;
+    no_dead_zone.full_check_every = 1;
+    test_debug_allocator_options(time/5, no_dead_zone);
+}
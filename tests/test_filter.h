@@ -0,0 +1,229 @@
+#pragma once
+
+#include "../filter.h"
+#include "../hash.h"
+#include "../hash_func.h"
+#include "../allocator_debug.h"
+#include "../random.h"
+#include "../time.h"
+#include "../log.h"
+#include "bench.h"
+
+//Keys [0, count) are inserted, keys from [count, count + probes) are used to measure false positives.
+INTERNAL uint64_t _test_filter_hash(isize key)
+{
+    return hash64_bijective((uint64_t) key + 0x1234567);
+}
+
+INTERNAL void test_bloom_filter(isize count, isize bits_per_key, f64 max_fpr)
+{
+    Debug_Allocator debug = debug_allocator_make(allocator_get_default(), DEBUG_ALLOC_LEAK_CHECK);
+    {
+        Bloom_Filter filter = {0};
+        TEST(bloom_filter_contains(&filter, _test_filter_hash(0)) == false);
+
+        bloom_filter_init(&filter, debug.alloc, count, bits_per_key);
+        for(isize i = 0; i < count; i++)
+            bloom_filter_insert(&filter, _test_filter_hash(i));
+        for(isize i = 0; i < count; i++)
+            TEST(bloom_filter_contains(&filter, _test_filter_hash(i)));
+
+        isize false_positives = 0;
+        for(isize i = count; i < count + 100000; i++)
+            false_positives += bloom_filter_contains(&filter, _test_filter_hash(i));
+        TEST(false_positives <= 100000*max_fpr);
+        TEST(count == 0 || fabs(bloom_filter_bits_per_key(&filter) - bits_per_key) < 1);
+
+        bloom_filter_clear(&filter);
+        TEST(count == 0 || bloom_filter_contains(&filter, _test_filter_hash(0)) == false);
+        bloom_filter_deinit(&filter);
+    }
+    debug_allocator_deinit(&debug);
+}
+
+INTERNAL void test_cuckoo_filter(isize count)
+{
+    Debug_Allocator debug = debug_allocator_make(allocator_get_default(), DEBUG_ALLOC_LEAK_CHECK);
+    {
+        Cuckoo_Filter filter = {0};
+        cuckoo_filter_init(&filter, debug.alloc, count);
+        for(isize i = 0; i < count; i++)
+            TEST(cuckoo_filter_insert(&filter, _test_filter_hash(i)));
+        TEST(filter.count == count);
+        for(isize i = 0; i < count; i++)
+            TEST(cuckoo_filter_contains(&filter, _test_filter_hash(i)));
+
+        isize false_positives = 0;
+        for(isize i = count; i < count + 100000; i++)
+            false_positives += cuckoo_filter_contains(&filter, _test_filter_hash(i));
+        TEST(false_positives <= 100000*0.001);
+
+        //Remove every odd key. Even keys must stay.
+        for(isize i = 1; i < count; i += 2)
+            TEST(cuckoo_filter_remove(&filter, _test_filter_hash(i)));
+        TEST(filter.count == (count + 1)/2);
+        for(isize i = 0; i < count; i += 2)
+            TEST(cuckoo_filter_contains(&filter, _test_filter_hash(i)));
+
+        //Duplicate insertions need the same number of removals
+        cuckoo_filter_clear(&filter);
+        for(isize i = 0; i < 3; i++)
+            TEST(cuckoo_filter_insert(&filter, _test_filter_hash(-1)));
+        for(isize i = 0; i < 3; i++) {
+            TEST(cuckoo_filter_contains(&filter, _test_filter_hash(-1)));
+            TEST(cuckoo_filter_remove(&filter, _test_filter_hash(-1)));
+        }
+        TEST(cuckoo_filter_contains(&filter, _test_filter_hash(-1)) == false);
+        TEST(cuckoo_filter_remove(&filter, _test_filter_hash(-1)) == false);
+        TEST(filter.count == 0);
+
+        //Fill until full. Everything inserted so far must still be found (including the victim)
+        // and removing makes space again.
+        isize inserted = 0;
+        while(cuckoo_filter_insert(&filter, _test_filter_hash(inserted)))
+            inserted += 1;
+        TEST(inserted >= filter.bucket_count*CUCKOO_FILTER_BUCKET_SIZE*8/10);
+        TEST(filter.victim != 0 && filter.count == inserted);
+        for(isize i = 0; i < inserted; i++)
+            TEST(cuckoo_filter_contains(&filter, _test_filter_hash(i)));
+
+        for(isize i = 0; i < inserted; i += 4)
+            TEST(cuckoo_filter_remove(&filter, _test_filter_hash(i)));
+        for(isize i = 0; i < inserted; i++)
+            if(i % 4 != 0)
+                TEST(cuckoo_filter_contains(&filter, _test_filter_hash(i)));
+        TEST(filter.victim == 0);
+        TEST(cuckoo_filter_insert(&filter, _test_filter_hash(0)));
+
+        cuckoo_filter_deinit(&filter);
+    }
+    debug_allocator_deinit(&debug);
+}
+
+INTERNAL void test_fuse_filter(isize count, isize duplicate_every)
+{
+    Debug_Allocator debug = debug_allocator_make(allocator_get_default(), DEBUG_ALLOC_LEAK_CHECK);
+    {
+        uint64_t* hashes = (uint64_t*) allocator_allocate(debug.alloc, count*sizeof(uint64_t), 8);
+        for(isize i = 0; i < count; i++)
+            hashes[i] = _test_filter_hash(duplicate_every > 0 && i % duplicate_every == 0 ? 0 : i);
+
+        Fuse_Filter filter = {0};
+        TEST(fuse_filter_build(&filter, debug.alloc, hashes, count));
+        for(isize i = 0; i < count; i++)
+            TEST(fuse_filter_contains(&filter, hashes[i]));
+
+        isize false_positives = 0;
+        for(isize i = count; i < count + 100000; i++)
+            false_positives += fuse_filter_contains(&filter, _test_filter_hash(i));
+        TEST(false_positives <= 100000*0.01);
+        if(count >= 100000)
+            TEST(fuse_filter_bits_per_key(&filter) < 10);
+
+        fuse_filter_deinit(&filter);
+        allocator_deallocate(debug.alloc, hashes, count*sizeof(uint64_t), 8);
+    }
+    debug_allocator_deinit(&debug);
+}
+
+INTERNAL void test_filter()
+{
+    test_bloom_filter(0, 10, 0);
+    test_bloom_filter(1000, 10, 0.03);
+    test_bloom_filter(100000, 10, 0.02);
+    test_bloom_filter(100000, 16, 0.003);
+
+    test_cuckoo_filter(1);
+    test_cuckoo_filter(1000);
+    test_cuckoo_filter(100000);
+
+    test_fuse_filter(0, 0);
+    test_fuse_filter(1, 0);
+    test_fuse_filter(2, 0);
+    test_fuse_filter(100, 0);
+    test_fuse_filter(1000, 7);
+    test_fuse_filter(100000, 0);
+}
+
+//Lookups into a Hash much bigger than cache where most keys are not present, with and without consulting a filter first.
+// Also reports the measured false positive rate and bits/key of each filter. Not part of the regular tests.
+INTERNAL void bench_filter(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {COUNT = 1 << 22, LOOKUPS = 1 << 22, HIT_PERCENT = 10};
+    Allocator* alloc = allocator_get_default();
+
+    uint64_t* keys = (uint64_t*) allocator_allocate(alloc, COUNT*sizeof(uint64_t), 8);
+    uint64_t* lookups = (uint64_t*) allocator_allocate(alloc, LOOKUPS*sizeof(uint64_t), 8);
+    Hash table = {0};
+    hash_init(&table, alloc, 0);
+    hash_reserve(&table, COUNT);
+    for(isize i = 0; i < COUNT; i++) {
+        keys[i] = _test_filter_hash(i);
+        hash_insert(&table, keys[i], (uint64_t) i + 2);
+    }
+    for(isize i = 0; i < LOOKUPS; i++)
+        lookups[i] = random_range(0, 100) < HIT_PERCENT ? keys[random_range(0, COUNT)] : _test_filter_hash(COUNT + i);
+
+    Bloom_Filter bloom = {0};
+    bloom_filter_init(&bloom, alloc, COUNT, 10);
+    for(isize i = 0; i < COUNT; i++)
+        bloom_filter_insert(&bloom, keys[i]);
+
+    Cuckoo_Filter cuckoo = {0};
+    cuckoo_filter_init(&cuckoo, alloc, COUNT);
+    for(isize i = 0; i < COUNT; i++)
+        cuckoo_filter_insert(&cuckoo, keys[i]);
+
+    Fuse_Filter fuse = {0};
+    Bench_Time fuse_build_time = {0};
+    for(isize r = 0; r < BENCH_REPEATS; r++) {
+        bench_time_start(&fuse_build_time);
+        fuse_filter_build(&fuse, alloc, keys, COUNT);
+        bench_time_stop(&fuse_build_time);
+    }
+    bench_report(&fuse_build_time, "filter.fuse_build", COUNT, 1, COUNT, 0);
+
+    const char* names[] = {"filter.lookup_none", "filter.lookup_bloom", "filter.lookup_cuckoo", "filter.lookup_fuse"};
+    for(isize filter_i = 0; filter_i < 4; filter_i++) {
+        isize found = 0;
+        isize passed = 0;
+        Bench_Time time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++) {
+            found = 0;
+            passed = 0;
+            bench_time_start(&time);
+            for(isize i = 0; i < LOOKUPS; i++) {
+                bool maybe = true;
+                switch(filter_i) {
+                    case 1: maybe = bloom_filter_contains(&bloom, lookups[i]); break;
+                    case 2: maybe = cuckoo_filter_contains(&cuckoo, lookups[i]); break;
+                    case 3: maybe = fuse_filter_contains(&fuse, lookups[i]); break;
+                }
+                if(maybe) {
+                    passed += 1;
+                    found += hash_find(&table, lookups[i], NULL);
+                }
+            }
+            bench_time_stop(&time);
+        }
+        bench_report(&time, names[filter_i], COUNT, 1, LOOKUPS, 0);
+
+        f64 bits_per_key = 0;
+        switch(filter_i) {
+            case 1: bits_per_key = bloom_filter_bits_per_key(&bloom); break;
+            case 2: bits_per_key = cuckoo_filter_bits_per_key(&cuckoo); break;
+            case 3: bits_per_key = fuse_filter_bits_per_key(&fuse); break;
+        }
+        isize misses = LOOKUPS - found;
+        f64 fpr = filter_i == 0 ? 1 : (f64) (passed - found) / (f64) misses;
+        LOG_INFO("BENCH", "%-20s %i%% hits: fpr %7.4lf%% bits/key %5.2lf", names[filter_i], HIT_PERCENT, fpr*100, bits_per_key);
+    }
+
+    fuse_filter_deinit(&fuse);
+    cuckoo_filter_deinit(&cuckoo);
+    bloom_filter_deinit(&bloom);
+    hash_deinit(&table);
+    allocator_deallocate(alloc, lookups, LOOKUPS*sizeof(uint64_t), 8);
+    allocator_deallocate(alloc, keys, COUNT*sizeof(uint64_t), 8);
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#include "../frozen.h"
+#include "../array.h"
+#include "../random.h"
+
+#define FROZEN_TEST_PATH "__frozen_test__.bin"
+
+typedef struct Test_Frozen_Item {
+    uint64_t key;
+    uint32_t value;
+    uint32_t _;
+} Test_Frozen_Item;
+
+INTERNAL Platform_String _frozen_test_path()
+{
+    Platform_String out = {FROZEN_TEST_PATH, sizeof(FROZEN_TEST_PATH) - 1};
+    return out;
+}
+
+INTERNAL void _test_frozen_matches_stable(const Frozen* frozen, const Stable* stable)
+{
+    TEST(frozen->kind == FROZEN_KIND_STABLE);
+    TEST(frozen->count == stable->count && frozen->capacity == stable_capacity(stable));
+
+    isize alive = 0;
+    FROZEN_FOR(frozen, i) {
+        const Test_Frozen_Item* item = (const Test_Frozen_Item*) frozen_at(frozen, i);
+        const Test_Frozen_Item* original = (const Test_Frozen_Item*) stable_at(stable, i);
+        TEST(memcmp(item, original, sizeof *item) == 0);
+        alive += 1;
+    }
+    TEST(alive == stable->count);
+
+    for(isize i = -1; i <= frozen->capacity; i++) {
+        Test_Frozen_Item dummy = {0};
+        const void* original = stable_at_or(stable, i, &dummy);
+        TEST(frozen_is_alive(frozen, i) == (original != &dummy));
+    }
+}
+
+//Overwrites the header of the frozen file at path in place with a correctly hashed header so that only
+// the validation of the fields themselves can reject it.
+INTERNAL Frozen_Error _test_frozen_open_with_header(Platform_String path, Frozen_Header header)
+{
+    header.header_hash = _frozen_header_hash(&header);
+    Platform_File file = {0};
+    TEST(platform_file_open(&file, path, PLATFORM_FILE_OPEN_WRITE) == 0);
+    TEST(platform_file_write(&file, &header, sizeof header, 0) == 0);
+    platform_file_close(&file);
+
+    Frozen frozen = {0};
+    Frozen_Error out = frozen_open(&frozen, path, NULL);
+    frozen_close(&frozen);
+    return out;
+}
+
+INTERNAL void test_frozen_stable(isize count)
+{
+    Stable stable = {0};
+    stable_init(&stable, allocator_get_default(), sizeof(Test_Frozen_Item));
+    for(isize i = 0; i < count; i++) {
+        Test_Frozen_Item item = {(uint64_t) i*31, (uint32_t) i};
+        stable_insert_value(&stable, &item);
+    }
+    //Remove a random third and some whole blocks so that the masks have holes
+    for(isize i = 0; i < count; i++)
+        if(random_range(0, 3) == 0 || (i / STABLE_BLOCK_SIZE) % 7 == 3)
+            stable_remove(&stable, i);
+
+    Frozen frozen = {0};
+    TEST(frozen_from_stable(&frozen, &stable, SINIT(Platform_String){0}, NULL) == FROZEN_OK);
+    TEST(frozen.is_file == false);
+    _test_frozen_matches_stable(&frozen, &stable);
+    frozen_close(&frozen);
+
+    Platform_String path = _frozen_test_path();
+    TEST(frozen_from_stable(&frozen, &stable, path, NULL) == FROZEN_OK);
+    TEST(frozen.is_file);
+    _test_frozen_matches_stable(&frozen, &stable);
+    frozen_close(&frozen);
+
+    Frozen opened = {0};
+    TEST(frozen_open(&opened, path, NULL) == FROZEN_OK);
+    _test_frozen_matches_stable(&opened, &stable);
+    frozen_close(&opened);
+
+    //Masks missing, overlapping the header or the items are rejected
+    if(count > 0) {
+        Frozen_Header header = {0};
+        platform_file_read_entire(path, &header, sizeof header);
+        TEST(_test_frozen_open_with_header(path, header) == FROZEN_OK);
+
+        Frozen_Header bad = header;
+        bad.masks_offset = 0;
+        TEST(_test_frozen_open_with_header(path, bad) == FROZEN_ERROR_INVALID);
+        bad.masks_offset = sizeof(Frozen_Header) - 8;
+        TEST(_test_frozen_open_with_header(path, bad) == FROZEN_ERROR_INVALID);
+        bad.masks_offset = header.items_offset - 8;
+        TEST(_test_frozen_open_with_header(path, bad) == FROZEN_ERROR_INVALID);
+        bad.masks_offset = header.masks_offset + 4;
+        TEST(_test_frozen_open_with_header(path, bad) == FROZEN_ERROR_INVALID);
+        TEST(_test_frozen_open_with_header(path, header) == FROZEN_OK);
+    }
+
+    platform_file_remove(path, false);
+    stable_deinit(&stable);
+}
+
+INTERNAL void test_frozen_array()
+{
+    u64_Array array = {allocator_get_default()};
+    for(isize i = 0; i < 10000; i++)
+        array_push(&array, (uint64_t) i*i);
+
+    Platform_String path = _frozen_test_path();
+    Platform_String paths[2] = {{0}, path};
+    for(isize p = 0; p < 2; p++)
+    {
+        Frozen frozen = {0};
+        TEST(FROZEN_FROM_ARRAY(&frozen, &array, paths[p], NULL) == FROZEN_OK);
+        TEST(frozen.kind == FROZEN_KIND_ARRAY && frozen.count == array.count && frozen.masks == NULL);
+        TEST(memcmp(FROZEN_DATA(&frozen, uint64_t), array.data, (size_t) array.count*sizeof *array.data) == 0);
+        TEST((size_t) frozen.items % 64 == 0);
+
+        isize iterated = 0;
+        FROZEN_FOR(&frozen, i)
+            iterated += *(const uint64_t*) frozen_at(&frozen, i) == (uint64_t) i*i;
+        TEST(iterated == array.count);
+        TEST(frozen_at_or(&frozen, array.count, NULL) == NULL);
+        frozen_close(&frozen);
+    }
+
+    //Empty array
+    {
+        u64_Array empty = {0};
+        Frozen frozen = {0};
+        TEST(FROZEN_FROM_ARRAY(&frozen, &empty, path, NULL) == FROZEN_OK);
+        TEST(frozen.count == 0 && frozen_next_alive(&frozen, 0) == 0);
+        frozen_close(&frozen);
+        TEST(frozen_open(&frozen, path, NULL) == FROZEN_OK && frozen.count == 0);
+        frozen_close(&frozen);
+    }
+
+    //Corrupted files are rejected
+    {
+        Frozen frozen = {0};
+        TEST(FROZEN_FROM_ARRAY(&frozen, &array, path, NULL) == FROZEN_OK);
+        frozen_close(&frozen);
+
+        Frozen_Header header = {0};
+        platform_file_read_entire(path, &header, sizeof header);
+        header.count += 1;
+        platform_file_write_entire(path, &header, sizeof header, false);
+        TEST(frozen_open(&frozen, path, NULL) == FROZEN_ERROR_INVALID);
+
+        //Valid hash but masks on an array or a size that overflows into a small region_size
+        TEST(FROZEN_FROM_ARRAY(&frozen, &array, path, NULL) == FROZEN_OK);
+        frozen_close(&frozen);
+        platform_file_read_entire(path, &header, sizeof header);
+        TEST(_test_frozen_open_with_header(path, header) == FROZEN_OK);
+
+        Frozen_Header bad = header;
+        bad.masks_offset = sizeof(Frozen_Header);
+        TEST(_test_frozen_open_with_header(path, bad) == FROZEN_ERROR_INVALID);
+        bad = header;
+        bad.count = bad.capacity = (uint64_t) 1 << 61;
+        bad.region_size = bad.items_offset;
+        TEST(_test_frozen_open_with_header(path, bad) == FROZEN_ERROR_INVALID);
+
+        platform_file_resize(path, 16);
+        TEST(frozen_open(&frozen, path, NULL) == FROZEN_ERROR_INVALID);
+        platform_file_remove(path, false);
+        TEST(frozen_open(&frozen, path, NULL) == FROZEN_ERROR_IO);
+        TEST(frozen.region == NULL);
+    }
+
+    array_deinit(&array);
+}
+
+INTERNAL void test_frozen()
+{
+    test_frozen_array();
+    test_frozen_stable(0);
+    test_frozen_stable(1);
+    test_frozen_stable(5000);
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "../hash_parallel.h"
+#include "../hash_func.h"
+#include "../allocator_debug.h"
+#include "../random.h"
+#include "../time.h"
+#include "../log.h"
+
+//Builds the table in parallel and checks it contains exactly the given entries
+INTERNAL void test_hash_parallel_build(isize count, isize thread_count, uint64_t empty_value, isize duplicate_every)
+{
+    Debug_Allocator debug = debug_allocator_make(allocator_get_default(), DEBUG_ALLOC_LEAK_CHECK);
+    {
+        Hash_Entry* entries = (Hash_Entry*) allocator_allocate(debug.alloc, count*sizeof(Hash_Entry), 8);
+        for(isize i = 0; i < count; i++) {
+            //every duplicate_every-th entry repeats the hash of the previous one to test multi entries
+            uint64_t key = duplicate_every > 0 && i > 0 && i % duplicate_every == 0 ? (uint64_t) i - 1 : (uint64_t) i;
+            entries[i].hash = hash64_bijective(key);
+            entries[i].value = empty_value + 2 + (uint64_t) i;
+        }
+
+        Hash table = {0};
+        hash_init(&table, debug.alloc, empty_value);
+        hash_insert_parallel(&table, entries, count, thread_count);
+        TEST(table.count == count);
+        hash_test_consistency(&table, true);
+
+        //Every entry must be findable. Together with the count this means the table holds exactly the input.
+        // (hash_iterate is avoided as it checks consistency of the whole table each call when slow asserts are on)
+        for(isize i = 0; i < count; i++)
+            TEST(hash_find_with_value(&table, entries[i].hash, entries[i].value, NULL));
+
+        //The table is usable as usual afterwards
+        hash_insert(&table, hash64_bijective((uint64_t) count), empty_value + 2);
+        TEST(hash_find(&table, hash64_bijective((uint64_t) count), NULL));
+
+        hash_deinit(&table);
+        allocator_deallocate(debug.alloc, entries, count*sizeof(Hash_Entry), 8);
+    }
+    debug_allocator_deinit(&debug);
+}
+
+INTERNAL void test_hash_parallel()
+{
+    test_hash_parallel_build(0, 4, 0, 0);
+    test_hash_parallel_build(1000, 4, 0, 0);
+    test_hash_parallel_build(1000, 1, 0, 0);
+    //Large enough to go parallel. Note that the serial fallback would be very slow here since with slow asserts
+    // each hash_insert checks the entire table.
+    test_hash_parallel_build(HASH_PARALLEL_MIN_COUNT*4, 3, 0, 0);
+    test_hash_parallel_build(HASH_PARALLEL_MIN_COUNT*4, 8, (uint64_t) -2, 3);
+    test_hash_parallel_build(HASH_PARALLEL_MIN_COUNT*2 + 7, 5, 1000, 0);
+}
+
+//Measures hash_insert_parallel against plain hash_insert loop at 1 to 64 threads. Not part of the regular tests.
+INTERNAL void bench_hash_parallel(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {COUNT = 1 << 24};
+    Hash_Entry* entries = (Hash_Entry*) allocator_allocate(allocator_get_default(), COUNT*sizeof(Hash_Entry), 8);
+    for(isize i = 0; i < COUNT; i++) {
+        entries[i].hash = hash64_bijective((uint64_t) i);
+        entries[i].value = (uint64_t) i + 2;
+    }
+
+    f64 serial_time = 0;
+    {
+        Hash table = {0};
+        hash_init(&table, allocator_get_default(), 0);
+        f64 start = clock_sec();
+        hash_reserve(&table, COUNT);
+        for(isize i = 0; i < COUNT; i++)
+            hash_insert(&table, entries[i].hash, entries[i].value);
+        serial_time = clock_sec() - start;
+        hash_deinit(&table);
+        LOG_INFO("BENCH", "hash_insert loop      %i entries: %8.2lfms", COUNT, serial_time*1000);
+    }
+
+    for(isize threads = 1; threads <= 64; threads *= 2)
+    {
+        Hash table = {0};
+        hash_init(&table, allocator_get_default(), 0);
+        f64 start = clock_sec();
+        hash_insert_parallel(&table, entries, COUNT, threads);
+        f64 time = clock_sec() - start;
+        TEST(table.count == COUNT);
+        hash_deinit(&table);
+        LOG_INFO("BENCH", "hash_insert_parallel %2lli threads: %8.2lfms (%.2lfx)", (long long) threads, time*1000, serial_time/time);
+    }
+    allocator_deallocate(allocator_get_default(), entries, COUNT*sizeof(Hash_Entry), 8);
+}
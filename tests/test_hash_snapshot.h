@@ -0,0 +1,212 @@
+#pragma once
+
+#include "../hash_snapshot.h"
+#include "../hash_func.h"
+#include "../allocator_debug.h"
+#include "../random.h"
+#include "../time.h"
+#include "../log.h"
+#include "bench.h"
+
+#define HASH_SNAPSHOT_TEST_PATH "__hash_snapshot_test__.bin"
+
+INTERNAL Platform_String _hash_snapshot_test_path()
+{
+    Platform_String out = {HASH_SNAPSHOT_TEST_PATH, sizeof(HASH_SNAPSHOT_TEST_PATH) - 1};
+    return out;
+}
+
+typedef struct Test_Snapshot_Entry {
+    uint64_t hash;
+    uint64_t key;
+    uint64_t value;
+} Test_Snapshot_Entry;
+
+#define TEST_SNAPSHOT_MAP_INFO SINIT(Map_Info) {    \
+        sizeof(Test_Snapshot_Entry),                \
+        __alignof(Test_Snapshot_Entry),             \
+        offsetof(Test_Snapshot_Entry, key),         \
+        offsetof(Test_Snapshot_Entry, hash),        \
+        NULL                                        \
+    }                                               \
+
+INTERNAL void test_hash_snapshot_hash(isize count)
+{
+    Debug_Allocator debug = debug_allocator_make(allocator_get_default(), DEBUG_ALLOC_LEAK_CHECK);
+    {
+        Platform_String path = _hash_snapshot_test_path();
+        Hash hash = {0};
+        hash_init(&hash, debug.alloc, 0);
+        for(isize i = 0; i < count; i++)
+            hash_insert(&hash, hash64_bijective((uint64_t) i), (uint64_t) i + 2);
+        //leave some gravestones in to make sure they survive the round trip
+        for(isize i = 0; i < count; i += 7)
+            hash_remove_with_hash(&hash, hash64_bijective((uint64_t) i));
+
+        TEST(hash_snapshot_write_hash(&hash, path, NULL) == HASH_SNAPSHOT_OK);
+
+        //Read only
+        {
+            Hash_Snapshot snapshot = {0};
+            TEST(hash_snapshot_open_hash(&snapshot, path, HASH_SNAPSHOT_OPEN_READ_ONLY, debug.alloc, NULL) == HASH_SNAPSHOT_OK);
+            TEST(snapshot.hash.count == hash.count);
+            TEST(snapshot.hash.gravestone_count == hash.gravestone_count);
+            hash_test_consistency(&snapshot.hash, true);
+            for(isize i = 0; i < count; i++) {
+                isize found = 0;
+                bool was_found = hash_find(&snapshot.hash, hash64_bijective((uint64_t) i), &found);
+                TEST(was_found == (i % 7 != 0));
+                if(was_found)
+                    TEST(snapshot.hash.entries[found].value == (uint64_t) i + 2);
+            }
+            hash_snapshot_close(&snapshot);
+        }
+
+        //Copy on write. Modify the table in place and then grow it out of the mapping
+        {
+            Hash_Snapshot snapshot = {0};
+            TEST(hash_snapshot_open_hash(&snapshot, path, HASH_SNAPSHOT_OPEN_COPY_ON_WRITE, debug.alloc, NULL) == HASH_SNAPSHOT_OK);
+            //writes to the mapped pages (1 is only present when count > 1)
+            hash_remove_with_hash(&snapshot.hash, hash64_bijective(1));
+            for(isize i = count; i < count*3; i++)
+                hash_insert(&snapshot.hash, hash64_bijective((uint64_t) i), (uint64_t) i + 2);
+            hash_test_consistency(&snapshot.hash, true);
+
+            for(isize i = 0; i < count*3; i++) {
+                bool expected = i >= count || (i % 7 != 0 && i != 1);
+                TEST(hash_find(&snapshot.hash, hash64_bijective((uint64_t) i), NULL) == expected);
+            }
+            hash_snapshot_close(&snapshot);
+        }
+
+        //The file must be unchanged
+        {
+            Hash_Snapshot snapshot = {0};
+            TEST(hash_snapshot_open_hash(&snapshot, path, HASH_SNAPSHOT_OPEN_READ_ONLY, NULL, NULL) == HASH_SNAPSHOT_OK);
+            TEST(snapshot.hash.count == hash.count);
+            TEST(hash_find(&snapshot.hash, hash64_bijective(1), NULL) || count <= 1);
+            TEST(hash_find(&snapshot.hash, hash64_bijective((uint64_t) count), NULL) == false);
+            hash_snapshot_close(&snapshot);
+        }
+
+        hash_deinit(&hash);
+        platform_file_remove(path, false);
+    }
+    debug_allocator_deinit(&debug);
+}
+
+INTERNAL void test_hash_snapshot_map()
+{
+    Debug_Allocator debug = debug_allocator_make(allocator_get_default(), DEBUG_ALLOC_LEAK_CHECK);
+    {
+        Platform_String path = _hash_snapshot_test_path();
+        Map_Info info = TEST_SNAPSHOT_MAP_INFO;
+        Map map = {debug.alloc};
+        for(uint64_t i = 0; i < 1000; i++) {
+            Test_Snapshot_Entry entry = {map_hash_escape(hash64_bijective(i)), i, i*3};
+            map_insert(&map, info, &entry);
+        }
+        TEST(hash_snapshot_write_map(&map, info, path, NULL) == HASH_SNAPSHOT_OK);
+
+        //Wrong kinds and layouts are rejected
+        {
+            Hash_Snapshot snapshot = {0};
+            Map_Info other_info = info;
+            other_info.entry_size += 8;
+            TEST(hash_snapshot_open_hash(&snapshot, path, 0, NULL, NULL) == HASH_SNAPSHOT_ERROR_MISMATCH);
+            TEST(hash_snapshot_open_map(&snapshot, other_info, path, 0, NULL, NULL) == HASH_SNAPSHOT_ERROR_MISMATCH);
+            TEST(snapshot.mapped == NULL);
+        }
+
+        {
+            Hash_Snapshot snapshot = {0};
+            TEST(hash_snapshot_open_map(&snapshot, info, path, HASH_SNAPSHOT_OPEN_COPY_ON_WRITE, debug.alloc, NULL) == HASH_SNAPSHOT_OK);
+            map_test_consistency(&snapshot.map, info, MAP_TEST_INVARIANTS_ALL);
+            for(uint64_t i = 0; i < 1000; i++) {
+                Test_Snapshot_Entry* found = (Test_Snapshot_Entry*) map_get_or(&snapshot.map, info, &i, map_hash_escape(hash64_bijective(i)), NULL);
+                TEST(found && found->value == i*3);
+            }
+
+            for(uint64_t i = 1000; i < 5000; i++) {
+                Test_Snapshot_Entry entry = {map_hash_escape(hash64_bijective(i)), i, i*3};
+                map_insert(&snapshot.map, info, &entry);
+            }
+            TEST(snapshot.map.count == 5000);
+            map_test_consistency(&snapshot.map, info, MAP_TEST_INVARIANTS_ALL);
+            hash_snapshot_close(&snapshot);
+        }
+
+        //Corrupted header and truncated files are rejected
+        {
+            Hash_Snapshot snapshot = {0};
+            Hash_Snapshot_Header header = {0};
+            platform_file_read_entire(path, &header, sizeof header);
+            header.count += 1;
+            platform_file_write_entire(path, &header, sizeof header, false);
+            TEST(hash_snapshot_open_map(&snapshot, info, path, 0, NULL, NULL) == HASH_SNAPSHOT_ERROR_INVALID);
+            TEST(snapshot.mapped == NULL);
+        }
+
+        map_deinit(&map, info);
+        platform_file_remove(path, false);
+    }
+    debug_allocator_deinit(&debug);
+}
+
+//Compares rebuilding a hash from source data against writing it once and then opening the snapshot.
+// Opening cost does not depend on the size, the lookups then pay for the page faults. Not part of the regular tests.
+INTERNAL void bench_hash_snapshot(f64 max_seconds)
+{
+    (void) max_seconds;
+    Platform_String path = _hash_snapshot_test_path();
+    enum {LOOKUPS = 1000};
+    for(isize count = 1 << 16; count <= 1 << 22; count *= 4)
+    {
+        Bench_Time rebuild_time = {0};
+        Bench_Time write_time = {0};
+        Bench_Time open_time = {0};
+        Bench_Time lookup_time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++)
+        {
+            bench_time_start(&rebuild_time);
+            Hash hash = {0};
+            hash_init(&hash, allocator_get_default(), 0);
+            for(isize i = 0; i < count; i++)
+                hash_insert(&hash, hash64_bijective((uint64_t) i), (uint64_t) i + 2);
+            bench_time_stop(&rebuild_time);
+
+            bench_time_start(&write_time);
+            TEST(hash_snapshot_write_hash(&hash, path, NULL) == HASH_SNAPSHOT_OK);
+            bench_time_stop(&write_time);
+
+            Hash_Snapshot snapshot = {0};
+            bench_time_start(&open_time);
+            TEST(hash_snapshot_open_hash(&snapshot, path, HASH_SNAPSHOT_OPEN_READ_ONLY, NULL, NULL) == HASH_SNAPSHOT_OK);
+            bench_time_stop(&open_time);
+
+            isize hits = 0;
+            bench_time_start(&lookup_time);
+            for(isize i = 0; i < LOOKUPS; i++)
+                hits += hash_find(&snapshot.hash, hash64_bijective((uint64_t) random_range(0, count)), NULL);
+            bench_time_stop(&lookup_time);
+            TEST(hits == LOOKUPS);
+
+            hash_snapshot_close(&snapshot);
+            hash_deinit(&hash);
+        }
+
+        bench_report(&rebuild_time, "hash_snapshot.rebuild", count, 1, count, 0);
+        bench_report(&write_time, "hash_snapshot.write", count, 1, count, 0);
+        bench_report(&open_time, "hash_snapshot.open", count, 1, 1, 0);
+        bench_report(&lookup_time, "hash_snapshot.first_lookups", count, 1, LOOKUPS, 0);
+    }
+    platform_file_remove(path, false);
+}
+
+INTERNAL void test_hash_snapshot()
+{
+    test_hash_snapshot_hash(0);
+    test_hash_snapshot_hash(1);
+    test_hash_snapshot_hash(1000);
+    test_hash_snapshot_map();
+}
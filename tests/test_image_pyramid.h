@@ -0,0 +1,336 @@
+#pragma once
+
+#include "../image_pyramid.h"
+#include "../random.h"
+#include "../allocator_debug.h"
+
+static const Pixel_Type _test_pyramid_types[] = {
+    PIXEL_TYPE_U8, PIXEL_TYPE_U16, PIXEL_TYPE_U24, PIXEL_TYPE_U32, PIXEL_TYPE_U64,
+    PIXEL_TYPE_I8, PIXEL_TYPE_I16, PIXEL_TYPE_I24, PIXEL_TYPE_I32, PIXEL_TYPE_I64,
+    PIXEL_TYPE_F16, PIXEL_TYPE_F32, PIXEL_TYPE_F64,
+};
+
+INTERNAL bool _test_pyramid_is_float(Pixel_Type type)
+{
+    return type == PIXEL_TYPE_F16 || type == PIXEL_TYPE_F32 || type == PIXEL_TYPE_F64;
+}
+
+INTERNAL int64_t _test_pyramid_get_int(Subimage image, isize x, isize y, isize c)
+{
+    uint8_t* at = (uint8_t*) subimage_at(image, x, y) + c*pixel_type_size(image.type);
+    switch(image.type) {
+        case PIXEL_TYPE_U8:  return *(uint8_t*) at;
+        case PIXEL_TYPE_U16: return *(uint16_t*) (void*) at;
+        case PIXEL_TYPE_U24: return (int64_t) at[0] | (int64_t) at[1] << 8 | (int64_t) at[2] << 16;
+        case PIXEL_TYPE_U32: return *(uint32_t*) (void*) at;
+        case PIXEL_TYPE_U64: return (int64_t) *(uint64_t*) (void*) at;
+        case PIXEL_TYPE_I8:  return *(int8_t*) at;
+        case PIXEL_TYPE_I16: return *(int16_t*) (void*) at;
+        case PIXEL_TYPE_I24: return (((int64_t) at[0] | (int64_t) at[1] << 8 | (int64_t) at[2] << 16) ^ 0x800000) - 0x800000;
+        case PIXEL_TYPE_I32: return *(int32_t*) (void*) at;
+        case PIXEL_TYPE_I64: return *(int64_t*) (void*) at;
+        default: UNREACHABLE(); return 0;
+    }
+}
+
+INTERNAL f64 _test_pyramid_get_float(Subimage image, isize x, isize y, isize c)
+{
+    uint8_t* at = (uint8_t*) subimage_at(image, x, y) + c*pixel_type_size(image.type);
+    switch(image.type) {
+        case PIXEL_TYPE_F16: return _image_f16_to_f32(*(uint16_t*) (void*) at);
+        case PIXEL_TYPE_F32: return *(float*) (void*) at;
+        case PIXEL_TYPE_F64: return *(f64*) (void*) at;
+        default: UNREACHABLE(); return 0;
+    }
+}
+
+//Fills with random values. 64 bit integers stay below 2^60 so that the reference can sum them in int64.
+INTERNAL void _test_pyramid_fill(Subimage image)
+{
+    isize channels = subimage_channel_count(image);
+    isize value_size = pixel_type_size(image.type);
+    for(isize y = 0; y < image.height; y++)
+        for(isize x = 0; x < image.width; x++)
+            for(isize c = 0; c < channels; c++) {
+                uint8_t* at = (uint8_t*) subimage_at(image, x, y) + c*value_size;
+                switch(image.type) {
+                    case PIXEL_TYPE_F16: *(uint16_t*) (void*) at = _image_f32_to_f16(random_range_f32(-1000, 1000)); break;
+                    case PIXEL_TYPE_F32: *(float*) (void*) at = random_range_f32(-1000, 1000); break;
+                    case PIXEL_TYPE_F64: *(f64*) (void*) at = random_range_f64(-1000, 1000); break;
+                    case PIXEL_TYPE_U64: *(uint64_t*) (void*) at = random_u64() >> 4; break;
+                    case PIXEL_TYPE_I64: *(int64_t*) (void*) at = random_i64() >> 4; break;
+                    default: random_bytes(at, value_size); break;
+                }
+            }
+}
+
+INTERNAL int64_t _test_pyramid_floor_div4(int64_t value)
+{
+    return value >= 0 ? value/4 : -((-value + 3)/4);
+}
+
+//Checks to against the box filter of from computed directly
+INTERNAL void _test_pyramid_check_box(Subimage to, Subimage from)
+{
+    isize channels = subimage_channel_count(from);
+    for(isize y = 0; y < to.height; y++)
+        for(isize x = 0; x < to.width; x++) {
+            isize x0 = MIN(2*x, from.width - 1), x1 = MIN(2*x + 1, from.width - 1);
+            isize y0 = MIN(2*y, from.height - 1), y1 = MIN(2*y + 1, from.height - 1);
+            for(isize c = 0; c < channels; c++) {
+                if(_test_pyramid_is_float(from.type)) {
+                    f64 a = _test_pyramid_get_float(from, x0, y0, c), b = _test_pyramid_get_float(from, x1, y0, c);
+                    f64 d = _test_pyramid_get_float(from, x0, y1, c), e = _test_pyramid_get_float(from, x1, y1, c);
+                    f64 expected = ((a + b) + (d + e))*0.25;
+                    f64 got = _test_pyramid_get_float(to, x, y, c);
+                    //Rounding of the sums in the narrower types is relative to the magnitude of the inputs
+                    f64 magnitude = fabs(a) + fabs(b) + fabs(d) + fabs(e);
+                    f64 tolerance = from.type == PIXEL_TYPE_F16 ? magnitude/1024 : from.type == PIXEL_TYPE_F32 ? magnitude*1e-6 : 0;
+                    TEST(fabs(got - expected) <= tolerance, "%lf != %lf", got, expected);
+                }
+                else {
+                    int64_t sum = _test_pyramid_get_int(from, x0, y0, c) + _test_pyramid_get_int(from, x1, y0, c)
+                                + _test_pyramid_get_int(from, x0, y1, c) + _test_pyramid_get_int(from, x1, y1, c);
+                    TEST(_test_pyramid_get_int(to, x, y, c) == _test_pyramid_floor_div4(sum + 2));
+                }
+            }
+        }
+}
+
+INTERNAL bool _test_pyramid_equal(Subimage a, Subimage b)
+{
+    if(a.width != b.width || a.height != b.height || subimage_is_same_format(a, b) == false)
+        return false;
+    for(isize y = 0; y < a.height; y++)
+        if(memcmp(subimage_at(a, 0, y), subimage_at(b, 0, y), (size_t) (a.width*a.pixel_size)) != 0)
+            return false;
+    return true;
+}
+
+INTERNAL void _test_pyramid_check_layout(const Image_Pyramid* pyramid, Subimage source, isize max_levels)
+{
+    isize expected_levels = image_pyramid_level_count(source.width, source.height);
+    if(max_levels > 0)
+        expected_levels = MIN(expected_levels, max_levels);
+    TEST(pyramid->level_count == expected_levels);
+    TEST(_test_pyramid_equal(pyramid->levels[0], source));
+
+    uint8_t* end = pyramid->pixels;
+    for(isize i = 0; i < pyramid->level_count; i++) {
+        Subimage level = pyramid->levels[i];
+        if(i > 0) {
+            TEST(level.width == MAX(pyramid->levels[i - 1].width/2, 1));
+            TEST(level.height == MAX(pyramid->levels[i - 1].height/2, 1));
+        }
+        TEST(level.width == level.containing_width && level.from_x == 0 && level.from_y == 0);
+        TEST((uint8_t*) level.pixels >= end && ((uintptr_t) level.pixels % IMAGE_ALIGN) == 0);
+        end = (uint8_t*) level.pixels + subimage_byte_size(level);
+        TEST(end <= pyramid->pixels + pyramid->capacity);
+    }
+    if(max_levels == 0)
+        TEST(pyramid->levels[pyramid->level_count - 1].width == 1 && pyramid->levels[pyramid->level_count - 1].height == 1);
+}
+
+INTERNAL void test_image_pyramid_box(Allocator* alloc)
+{
+    isize sizes[][2] = {{1, 1}, {1, 7}, {9, 1}, {33, 17}, {64, 64}, {100, 37}};
+    isize channel_counts[] = {1, 3, 4};
+    isize thread_counts[] = {1, 3};
+
+    Image_Pyramid pyramid = {0};
+    image_pyramid_init(&pyramid, alloc);
+    for(isize t = 0; t < ARRAY_COUNT(_test_pyramid_types); t++)
+        for(isize c = 0; c < ARRAY_COUNT(channel_counts); c++)
+            for(isize s = 0; s < ARRAY_COUNT(sizes); s++)
+                for(isize th = 0; th < ARRAY_COUNT(thread_counts); th++) {
+                    Pixel_Type type = _test_pyramid_types[t];
+                    isize pixel_size = pixel_type_size(type)*channel_counts[c];
+
+                    //Builds from a portion of a bigger image to exercise strides
+                    Image image = {0};
+                    image_init_sized(&image, alloc, sizes[s][0] + 5, sizes[s][1] + 3, pixel_size, type, NULL);
+                    Subimage source = image_portion(image, 3, 2, sizes[s][0], sizes[s][1]);
+                    _test_pyramid_fill(subimage_of(image));
+
+                    image_pyramid_build(&pyramid, source, IMAGE_FILTER_BOX, 0, thread_counts[th]);
+                    _test_pyramid_check_layout(&pyramid, source, 0);
+                    for(isize i = 1; i < pyramid.level_count; i++)
+                        _test_pyramid_check_box(pyramid.levels[i], pyramid.levels[i - 1]);
+
+                    image_pyramid_build(&pyramid, source, IMAGE_FILTER_BOX, 2, thread_counts[th]);
+                    _test_pyramid_check_layout(&pyramid, source, 2);
+
+                    image_deinit(&image);
+                }
+
+    //64 bit averages must not overflow
+    {
+        uint64_t u[4] = {UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX - 1};
+        int64_t i[4] = {INT64_MIN, INT64_MIN, INT64_MIN + 1, INT64_MIN};
+        int64_t j[4] = {INT64_MAX, INT64_MAX, INT64_MAX, INT64_MAX};
+
+        image_pyramid_build(&pyramid, subimage_make(u, 2, 2, 8, PIXEL_TYPE_U64), IMAGE_FILTER_BOX, 0, 1);
+        TEST(*(uint64_t*) pyramid.levels[1].pixels == UINT64_MAX);
+        image_pyramid_build(&pyramid, subimage_make(i, 2, 2, 8, PIXEL_TYPE_I64), IMAGE_FILTER_BOX, 0, 1);
+        TEST(*(int64_t*) pyramid.levels[1].pixels == INT64_MIN);
+        image_pyramid_build(&pyramid, subimage_make(j, 2, 2, 8, PIXEL_TYPE_I64), IMAGE_FILTER_BOX, 0, 1);
+        TEST(*(int64_t*) pyramid.levels[1].pixels == INT64_MAX);
+    }
+    image_pyramid_deinit(&pyramid);
+}
+
+INTERNAL void test_image_pyramid_kaiser(Allocator* alloc)
+{
+    Image_Pyramid single = {0};
+    Image_Pyramid multi = {0};
+    image_pyramid_init(&single, alloc);
+    image_pyramid_init(&multi, alloc);
+
+    for(isize t = 0; t < ARRAY_COUNT(_test_pyramid_types); t++) {
+        Pixel_Type type = _test_pyramid_types[t];
+        bool is_float = _test_pyramid_is_float(type);
+        isize channels = t % 3 == 0 ? 1 : t % 3 == 1 ? 4 : 3;
+        Image image = {0};
+        image_init_sized(&image, alloc, 75, 41, pixel_type_size(type)*channels, type, NULL);
+
+        //Constant images stay constant (the weights sum to one)
+        {
+            Subimage source = subimage_of(image);
+            for(isize y = 0; y < source.height; y++)
+                for(isize x = 0; x < source.width; x++) {
+                    f64 value = 100;
+                    _image_row_store_f64((uint8_t*) subimage_at(source, x, y), (f64[4]){value, value, value, value}, channels, type);
+                }
+
+            image_pyramid_build(&single, source, IMAGE_FILTER_KAISER, 0, 1);
+            _test_pyramid_check_layout(&single, source, 0);
+            for(isize i = 1; i < single.level_count; i++)
+                for(isize y = 0; y < single.levels[i].height; y++)
+                    for(isize x = 0; x < single.levels[i].width; x++)
+                        for(isize c = 0; c < channels; c++) {
+                            if(is_float)
+                                TEST(fabs(_test_pyramid_get_float(single.levels[i], x, y, c) - 100) < 1e-3);
+                            else
+                                TEST(_test_pyramid_get_int(single.levels[i], x, y, c) == 100);
+                        }
+        }
+
+        //The filter is symmetric so linear ramps stay linear: output x is centered at input 2x + 0.5.
+        //Away from the clamped borders the result can only differ by rounding.
+        {
+            Subimage source = subimage_of(image);
+            for(isize y = 0; y < source.height; y++)
+                for(isize x = 0; x < source.width; x++) {
+                    f64 values[4] = {(f64) x, (f64) y, (f64) (x + y), 7};
+                    _image_row_store_f64((uint8_t*) subimage_at(source, x, y), values, channels, type);
+                }
+
+            image_pyramid_build(&single, source, IMAGE_FILTER_KAISER, 2, 1);
+            Subimage level = single.levels[1];
+            for(isize y = 2; y < level.height - 2; y++)
+                for(isize x = 2; x < level.width - 2; x++) {
+                    f64 expected[4] = {2*x + 0.5, 2*y + 0.5, 2*x + 2*y + 1, 7};
+                    for(isize c = 0; c < channels; c++) {
+                        f64 got = is_float ? _test_pyramid_get_float(level, x, y, c) : (f64) _test_pyramid_get_int(level, x, y, c);
+                        TEST(fabs(got - expected[c]) <= (is_float ? 0.05 : 0.5 + 1e-3));
+                    }
+                }
+        }
+
+        //Noise gives the same result on any number of threads
+        {
+            _test_pyramid_fill(subimage_of(image));
+            image_pyramid_build(&single, subimage_of(image), IMAGE_FILTER_KAISER, 0, 1);
+            image_pyramid_build(&multi, subimage_of(image), IMAGE_FILTER_KAISER, 0, 4);
+            TEST(single.level_count == multi.level_count);
+            for(isize i = 0; i < single.level_count; i++)
+                TEST(_test_pyramid_equal(single.levels[i], multi.levels[i]));
+        }
+
+        image_deinit(&image);
+    }
+
+    image_pyramid_deinit(&multi);
+    image_pyramid_deinit(&single);
+}
+
+INTERNAL void test_image_integral(Allocator* alloc)
+{
+    typedef struct {Pixel_Type type; Pixel_Type sum_type; isize channels;} Test_Case;
+    Test_Case cases[] = {
+        {PIXEL_TYPE_U8, PIXEL_TYPE_U64, 3},
+        {PIXEL_TYPE_U8, PIXEL_TYPE_U32, 1},
+        {PIXEL_TYPE_U32, PIXEL_TYPE_U32, 2},
+        {PIXEL_TYPE_U24, PIXEL_TYPE_U64, 1},
+        {PIXEL_TYPE_I16, PIXEL_TYPE_I64, 2},
+        {PIXEL_TYPE_I16, PIXEL_TYPE_I32, 1},
+        {PIXEL_TYPE_I64, PIXEL_TYPE_I64, 1},
+        {PIXEL_TYPE_F32, PIXEL_TYPE_F64, 2},
+        {PIXEL_TYPE_F16, PIXEL_TYPE_F32, 1},
+        {PIXEL_TYPE_F64, PIXEL_TYPE_F64, 4},
+    };
+    isize sizes[][2] = {{0, 0}, {1, 1}, {1, 9}, {13, 1}, {57, 31}};
+
+    Image integral = {0};
+    image_init_unshaped(&integral, alloc);
+    for(isize t = 0; t < ARRAY_COUNT(cases); t++)
+        for(isize s = 0; s < ARRAY_COUNT(sizes); s++) {
+            Test_Case test = cases[t];
+            Image image = {0};
+            image_init_sized(&image, alloc, sizes[s][0] + 4, sizes[s][1] + 2, pixel_type_size(test.type)*test.channels, test.type, NULL);
+            Subimage source = image_portion(image, 1, 2, sizes[s][0], sizes[s][1]);
+            _test_pyramid_fill(subimage_of(image));
+
+            image_integral_build(&integral, source, test.sum_type);
+            TEST(integral.width == source.width + 1 && integral.height == source.height + 1);
+            TEST(integral.type == test.sum_type && image_channel_count(integral) == test.channels);
+
+            for(isize q = 0; q < 200; q++) {
+                isize from_x = random_range(0, source.width + 1), to_x = random_range(from_x, source.width + 1);
+                isize from_y = random_range(0, source.height + 1), to_y = random_range(from_y, source.height + 1);
+                if(q == 0) {
+                    from_x = 0; from_y = 0;
+                    to_x = source.width; to_y = source.height;
+                }
+
+                uint8_t sums[8*4] = {0};
+                image_integral_sum(integral, from_x, from_y, to_x, to_y, sums);
+                for(isize c = 0; c < test.channels; c++) {
+                    int64_t int_sum = 0;
+                    f64 float_sum = 0;
+                    for(isize y = from_y; y < to_y; y++)
+                        for(isize x = from_x; x < to_x; x++) {
+                            if(_test_pyramid_is_float(test.type))
+                                float_sum += _test_pyramid_get_float(source, x, y, c);
+                            else
+                                int_sum = (int64_t) ((uint64_t) int_sum + (uint64_t) _test_pyramid_get_int(source, x, y, c));
+                        }
+
+                    f64 got_f64 = image_integral_sum_f64(integral, from_x, from_y, to_x, to_y, c);
+                    switch(test.sum_type) {
+                        case PIXEL_TYPE_U64: TEST(((uint64_t*) (void*) sums)[c] == (uint64_t) int_sum); TEST(got_f64 == (f64) (uint64_t) int_sum); break;
+                        case PIXEL_TYPE_I64: TEST(((int64_t*) (void*) sums)[c] == int_sum); TEST(got_f64 == (f64) int_sum); break;
+                        //The 32 bit tables are exact modulo 2^32
+                        case PIXEL_TYPE_U32: TEST(((uint32_t*) (void*) sums)[c] == (uint32_t) int_sum); TEST(got_f64 == (f64) (uint32_t) int_sum); break;
+                        case PIXEL_TYPE_I32: TEST(((int32_t*) (void*) sums)[c] == (int32_t) (uint32_t) int_sum); break;
+                        case PIXEL_TYPE_F64: TEST(fabs(((f64*) (void*) sums)[c] - float_sum) < 1e-6); TEST(fabs(got_f64 - float_sum) < 1e-6); break;
+                        case PIXEL_TYPE_F32: TEST(fabs(((float*) (void*) sums)[c] - float_sum) < 2); TEST(fabs(got_f64 - float_sum) < 2); break;
+                        default: UNREACHABLE();
+                    }
+                }
+            }
+            image_deinit(&image);
+        }
+    image_deinit(&integral);
+}
+
+INTERNAL void test_image_pyramid()
+{
+    Debug_Allocator debug = debug_allocator_make(allocator_get_default(), DEBUG_ALLOC_LEAK_CHECK);
+    {
+        test_image_pyramid_box(debug.alloc);
+        test_image_pyramid_kaiser(debug.alloc);
+        test_image_integral(debug.alloc);
+    }
+    debug_allocator_deinit(&debug);
+}
@@ -0,0 +1,390 @@
+#pragma once
+
+#include "../assert.h"
+#include "../map_robin.h"
+#include "../hash_func.h"
+#include "../random.h"
+#include "../allocator_debug.h"
+#include "../array.h"
+#include "../time.h"
+#include "bench.h"
+
+//Simple u64 -> u64 multimap used to test the robin hood map.
+// Keys are hashed with hash64_bijective so different keys always have different hashes
+// (up to the escaping) except for the degenerate hash used for testing long probe sequences.
+typedef struct Test_Robin_Entry {
+    uint64_t hash;
+    uint64_t key;
+    uint64_t value;
+} Test_Robin_Entry;
+
+typedef union Test_Robin_Map {
+    Robin_Map generic;
+    struct {
+        Allocator* alloc;
+        Test_Robin_Entry* entries;
+        uint32_t count;
+        uint32_t capacity;
+    };
+} Test_Robin_Map;
+
+static bool _test_robin_key_equals(const void* stored, const void* key)
+{
+    return *(const uint64_t*) stored == *(const uint64_t*) key;
+}
+
+#define TEST_ROBIN_MAP_INFO SINIT(Map_Info) {   \
+        sizeof(Test_Robin_Entry),               \
+        __alignof(Test_Robin_Entry),            \
+        offsetof(Test_Robin_Entry, key),        \
+        offsetof(Test_Robin_Entry, hash),       \
+        (void*) _test_robin_key_equals          \
+    }                                           \
+
+INTERNAL uint64_t _test_robin_hash(uint64_t key)
+{
+    return map_hash_escape(hash64_bijective(key));
+}
+
+INTERNAL isize _test_robin_count_key(const Test_Robin_Map* map, uint64_t key, uint64_t hash, uint64_t* sum_values)
+{
+    isize count = 0;
+    uint32_t index = 0;
+    uint32_t dist = 0;
+    robin_map_find_next_make(&map->generic, hash, &index, &dist);
+    while(robin_map_find_next(&map->generic, TEST_ROBIN_MAP_INFO, &key, hash, &index, &dist)) {
+        TEST(map->entries[index].key == key);
+        if(sum_values)
+            *sum_values += map->entries[index].value;
+        count += 1;
+    }
+    return count;
+}
+
+INTERNAL isize _test_robin_remove_key(Test_Robin_Map* map, uint64_t key, uint64_t hash)
+{
+    //After removal the following entries shift back so we simply keep finding from the start.
+    isize removed = 0;
+    for(isize found = 0; robin_map_find(&map->generic, TEST_ROBIN_MAP_INFO, &key, hash, &found); removed++)
+        robin_map_remove(&map->generic, TEST_ROBIN_MAP_INFO, found);
+    return removed;
+}
+
+INTERNAL void test_map_robin_unit()
+{
+    Debug_Allocator debug = debug_allocator_make(allocator_get_default(), DEBUG_ALLOC_LEAK_CHECK);
+    {
+        Map_Info info = TEST_ROBIN_MAP_INFO;
+        Test_Robin_Map map = {0};
+        robin_map_init(&map.generic, info, debug.alloc);
+
+        //Basic get/set
+        for(uint64_t i = 0; i < 1000; i++) {
+            Test_Robin_Entry entry = {_test_robin_hash(i), i, i*10};
+            robin_map_set(&map.generic, info, &entry);
+        }
+        TEST(map.count == 1000);
+        robin_map_test_consistency(&map.generic, info, MAP_TEST_INVARIANTS_ALL);
+
+        for(uint64_t i = 0; i < 2000; i++) {
+            Test_Robin_Entry* found = (Test_Robin_Entry*) robin_map_get_or(&map.generic, info, &i, _test_robin_hash(i), NULL);
+            if(i < 1000)
+                TEST(found && found->key == i && found->value == i*10);
+            else
+                TEST(found == NULL);
+        }
+
+        //Overwrite
+        for(uint64_t i = 0; i < 1000; i += 2) {
+            Test_Robin_Entry entry = {_test_robin_hash(i), i, i*100};
+            robin_map_set(&map.generic, info, &entry);
+        }
+        TEST(map.count == 1000);
+        for(uint64_t i = 0; i < 1000; i++) {
+            Test_Robin_Entry* found = (Test_Robin_Entry*) robin_map_get_or(&map.generic, info, &i, _test_robin_hash(i), NULL);
+            TEST(found && found->value == (i % 2 == 0 ? i*100 : i*10));
+        }
+
+        //Remove every third. No gravestones means the map looks exactly like
+        // it only ever contained the remaining entries.
+        for(uint64_t i = 0; i < 1000; i += 3)
+            TEST(_test_robin_remove_key(&map, i, _test_robin_hash(i)) == 1);
+        robin_map_test_consistency(&map.generic, info, MAP_TEST_INVARIANTS_ALL);
+        for(uint64_t i = 0; i < 1000; i++) {
+            void* found = robin_map_get_or(&map.generic, info, &i, _test_robin_hash(i), NULL);
+            TEST((found == NULL) == (i % 3 == 0));
+        }
+
+        //MAP_FOR sees exactly the live entries
+        isize iterated = 0;
+        MAP_FOR(map, Test_Robin_Entry, entry) {
+            TEST(entry->key % 3 != 0);
+            iterated += 1;
+        }
+        TEST(iterated == map.count);
+
+        robin_map_clear(&map.generic, info);
+        TEST(map.count == 0);
+        robin_map_test_consistency(&map.generic, info, MAP_TEST_INVARIANTS_ALL);
+
+        //Many entries with the same hash. Forces probe distances past the byte saturation
+        // (the map is not grown for these since they are below half load).
+        {
+            enum {DUPLICATES = 300};
+            uint64_t key = 7;
+            uint64_t hash = 0xABCDEF;
+            for(uint64_t i = 0; i < DUPLICATES; i++) {
+                Test_Robin_Entry entry = {hash, key, i};
+                robin_map_insert(&map.generic, info, &entry);
+                Test_Robin_Entry other = {_test_robin_hash(i + 100), i + 100, i};
+                robin_map_insert(&map.generic, info, &other);
+            }
+            robin_map_test_consistency(&map.generic, info, MAP_TEST_INVARIANTS_ALL);
+            TEST(map.generic.max_probe >= ROBIN_MAP_PROBE_SATURATED);
+
+            uint64_t sum = 0;
+            TEST(_test_robin_count_key(&map, key, hash, &sum) == DUPLICATES);
+            TEST(sum == DUPLICATES*(DUPLICATES - 1)/2);
+
+            TEST(_test_robin_remove_key(&map, key, hash) == DUPLICATES);
+            TEST(map.count == DUPLICATES);
+            robin_map_test_consistency(&map.generic, info, MAP_TEST_INVARIANTS_ALL);
+        }
+
+        robin_map_deinit(&map.generic, info);
+    }
+    debug_allocator_deinit(&debug);
+}
+
+INTERNAL void test_map_robin_stress(f64 max_seconds)
+{
+    Debug_Allocator debug = debug_allocator_make(allocator_get_default(), DEBUG_ALLOC_LEAK_CHECK);
+    {
+        typedef enum {
+            INIT,
+            CLEAR,
+            INSERT,
+            INSERT_DUPLICIT,
+            SET,
+            REMOVE,
+            REHASH,
+        } Action;
+
+        Discrete_Distribution dist[] = {
+            {INIT,              1},
+            {CLEAR,             1},
+            {INSERT,            1200},
+            {INSERT_DUPLICIT,   200},
+            {SET,               400},
+            {REMOVE,            900},
+            {REHASH,            10},
+        };
+        random_discrete_make(dist, ARRAY_COUNT(dist));
+
+        enum {
+            MAX_ITERS = 10*1000*1000,
+            MIN_ITERS = 50,
+            KEY_RANGE = 1 << 12,
+            FULL_CHECK_EVERY = 64,
+        };
+
+        Map_Info info = TEST_ROBIN_MAP_INFO;
+        Test_Robin_Map map = {0};
+        robin_map_init(&map.generic, info, debug.alloc);
+
+        u64_Array truth_keys = {debug.alloc};
+        u64_Array truth_vals = {debug.alloc};
+
+        uint64_t seed = random_seed();
+        *random_state() = random_state_make(seed);
+
+        f64 start = clock_sec();
+        for(isize i = 0; i < MAX_ITERS; i++)
+        {
+            if(clock_sec() - start >= max_seconds && i >= MIN_ITERS)
+                break;
+
+            Action action = (Action) random_discrete(dist, ARRAY_COUNT(dist));
+            uint64_t key = (uint64_t) random_range(0, KEY_RANGE);
+            uint64_t val = random_u64();
+            if((action == INSERT_DUPLICIT || action == REMOVE) && truth_keys.count > 0)
+                key = truth_keys.data[random_range(0, truth_keys.count)];
+            uint64_t hash = _test_robin_hash(key);
+
+            switch(action)
+            {
+                case INIT: {
+                    robin_map_init(&map.generic, info, debug.alloc);
+                    array_clear(&truth_keys);
+                    array_clear(&truth_vals);
+                } break;
+
+                case CLEAR: {
+                    robin_map_clear(&map.generic, info);
+                    array_clear(&truth_keys);
+                    array_clear(&truth_vals);
+                } break;
+
+                case INSERT:
+                case INSERT_DUPLICIT: {
+                    Test_Robin_Entry entry = {hash, key, val};
+                    robin_map_insert(&map.generic, info, &entry);
+                    array_push(&truth_keys, key);
+                    array_push(&truth_vals, val);
+                } break;
+
+                case SET: {
+                    //Set overrides one arbitrary entry of the key so we only
+                    // use it on keys which are not multi entries.
+                    if(_test_robin_count_key(&map, key, hash, NULL) <= 1) {
+                        Test_Robin_Entry entry = {hash, key, val};
+                        robin_map_set(&map.generic, info, &entry);
+
+                        isize j = 0;
+                        for(; j < truth_keys.count; j++)
+                            if(truth_keys.data[j] == key)
+                                break;
+
+                        if(j == truth_keys.count) {
+                            array_push(&truth_keys, key);
+                            array_push(&truth_vals, val);
+                        }
+                        else
+                            truth_vals.data[j] = val;
+                    }
+                } break;
+
+                case REMOVE: {
+                    isize removed_truth = 0;
+                    for(isize j = 0; j < truth_keys.count; j++)
+                        if(truth_keys.data[j] == key) {
+                            SWAP(&truth_keys.data[j], array_last(truth_keys));
+                            SWAP(&truth_vals.data[j], array_last(truth_vals));
+                            array_pop(&truth_keys);
+                            array_pop(&truth_vals);
+                            j -= 1;
+                            removed_truth += 1;
+                        }
+
+                    TEST(_test_robin_remove_key(&map, key, hash) == removed_truth);
+                    TEST(robin_map_get_or(&map.generic, info, &key, hash, NULL) == NULL);
+                } break;
+
+                case REHASH: {
+                    robin_map_rehash(&map.generic, info, 0);
+                } break;
+            }
+
+            TEST(map.count == truth_keys.count);
+            if(i % FULL_CHECK_EVERY == 0) {
+                robin_map_test_consistency(&map.generic, info, MAP_TEST_INVARIANTS_ALL);
+                for(isize j = 0; j < truth_keys.count; j++) {
+                    uint64_t truth_sum = 0;
+                    isize truth_count = 0;
+                    for(isize k = 0; k < truth_keys.count; k++)
+                        if(truth_keys.data[k] == truth_keys.data[j]) {
+                            truth_sum += truth_vals.data[k];
+                            truth_count += 1;
+                        }
+
+                    uint64_t sum = 0;
+                    TEST(_test_robin_count_key(&map, truth_keys.data[j], _test_robin_hash(truth_keys.data[j]), &sum) == truth_count);
+                    TEST(sum == truth_sum);
+                }
+            }
+        }
+
+        robin_map_deinit(&map.generic, info);
+        array_deinit(&truth_keys);
+        array_deinit(&truth_vals);
+    }
+    debug_allocator_deinit(&debug);
+}
+
+//Compares Map against Robin_Map under constant churn (half inserts half removals at steady size)
+// which is the workload where gravestones hurt the most. Not part of the regular tests.
+INTERNAL void bench_map_robin(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {SIZE = 1 << 16, OPS = 1 << 16};
+    Map_Info info = TEST_ROBIN_MAP_INFO;
+    const char* names[2][2] = {
+        {"map_robin.churn_map", "map_robin.lookup_map"},
+        {"map_robin.churn_robin", "map_robin.lookup_robin"},
+    };
+
+    for(int variant = 0; variant < 2; variant++)
+    {
+        Map quadratic = {allocator_get_default()};
+        Robin_Map robin = {allocator_get_default()};
+
+        uint64_t next_key = 0;
+        for(; next_key < SIZE; next_key++) {
+            Test_Robin_Entry entry = {_test_robin_hash(next_key), next_key, next_key};
+            if(variant == 0)
+                map_insert(&quadratic, info, &entry);
+            else
+                robin_map_insert(&robin, info, &entry);
+        }
+
+        //Half hits half misses. Generated up front so that random_range is not measured.
+        uint64_t* lookups = (uint64_t*) malloc(OPS*sizeof(uint64_t));
+        isize hits = 0;
+        Bench_Time churn_time = {0};
+        Bench_Time lookup_time = {0};
+        for(isize r = 0; r < BENCH_REPEATS; r++)
+        {
+            //churn: remove the oldest key and add a new one
+            bench_time_start(&churn_time);
+            for(isize k = 0; k < OPS; k++, next_key++) {
+                uint64_t old = next_key - SIZE;
+                uint64_t old_hash = _test_robin_hash(old);
+                Test_Robin_Entry entry = {_test_robin_hash(next_key), next_key, next_key};
+                isize found = 0;
+                if(variant == 0) {
+                    if(map_find(&quadratic, info, &old, old_hash, &found))
+                        map_remove(&quadratic, info, found);
+                    map_insert(&quadratic, info, &entry);
+                }
+                else {
+                    if(robin_map_find(&robin, info, &old, old_hash, &found))
+                        robin_map_remove(&robin, info, found);
+                    robin_map_insert(&robin, info, &entry);
+                }
+            }
+            bench_time_stop(&churn_time);
+
+            for(isize k = 0; k < OPS; k++)
+                lookups[k] = next_key - (uint64_t) random_range(0, 2*SIZE);
+
+            bench_time_start(&lookup_time);
+            for(isize k = 0; k < OPS; k++) {
+                uint64_t key = lookups[k];
+                uint64_t hash = _test_robin_hash(key);
+                void* found = variant == 0
+                    ? map_get_or(&quadratic, info, &key, hash, NULL)
+                    : robin_map_get_or(&robin, info, &key, hash, NULL);
+                hits += found != NULL;
+            }
+            bench_time_stop(&lookup_time);
+        }
+
+        bench_report(&churn_time, names[variant][0], SIZE, 1, OPS, 0);
+        bench_report(&lookup_time, names[variant][1], SIZE, 1, OPS, 0);
+        LOG_INFO("BENCH", "%s: hits %.2lf%% capacity %u",
+            variant == 0 ? "Map      " : "Robin_Map", 100.0*hits/(OPS*BENCH_REPEATS),
+            variant == 0 ? quadratic.capacity : robin.capacity);
+        if(variant == 1)
+            LOG_INFO("BENCH", "Robin_Map: longest probe %u rehashes %u", robin.max_probe, robin.rehashes);
+
+        free(lookups);
+        map_deinit(&quadratic, info);
+        robin_map_deinit(&robin, info);
+    }
+}
+
+INTERNAL void test_map_robin(f64 max_seconds)
+{
+    test_map_robin_unit();
+    test_map_robin_stress(max_seconds);
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "../parallel.h"
+#include "../random.h"
+
+typedef struct _Test_Parallel {
+    PLATFORM_ATOMIC(uint32_t)* visits;
+    isize thread_count;
+    PLATFORM_ATOMIC(uint32_t) calls;
+    PLATFORM_ATOMIC(uint32_t) bad_ranges;
+    PLATFORM_ATOMIC(uint64_t) seen_threads;
+} _Test_Parallel;
+
+INTERNAL void _test_parallel_for_func(void* context, isize from, isize to, isize thread_index)
+{
+    _Test_Parallel* test = (_Test_Parallel*) context;
+    if(from >= to || thread_index < 0 || thread_index >= test->thread_count)
+        atomic_fetch_add(&test->bad_ranges, 1);
+    for(isize i = from; i < to; i++)
+        atomic_fetch_add(&test->visits[i], 1);
+    atomic_fetch_add(&test->calls, 1);
+}
+
+INTERNAL void _test_parallel_run_func(void* context, isize thread_index)
+{
+    _Test_Parallel* test = (_Test_Parallel*) context;
+    if(thread_index < 0 || thread_index >= test->thread_count)
+        atomic_fetch_add(&test->bad_ranges, 1);
+    else
+        atomic_fetch_or(&test->seen_threads, (uint64_t) 1 << thread_index);
+    atomic_fetch_add(&test->calls, 1);
+}
+
+INTERNAL void test_parallel_for_single(isize count, isize chunk, isize thread_count_or_zero)
+{
+    _Test_Parallel test = {0};
+    test.visits = (PLATFORM_ATOMIC(uint32_t)*) calloc(count + 1, sizeof *test.visits);
+    isize threads = parallel_thread_count(thread_count_or_zero, count);
+    isize used_chunk = chunk > 0 ? chunk : MAX((count + threads - 1)/threads, 1);
+    test.thread_count = parallel_thread_count(thread_count_or_zero, (count + used_chunk - 1)/used_chunk);
+
+    parallel_for(count, chunk, thread_count_or_zero, _test_parallel_for_func, &test, "parallel test");
+    for(isize i = 0; i < count; i++)
+        TEST(atomic_load(&test.visits[i]) == 1);
+    TEST(atomic_load(&test.bad_ranges) == 0);
+    if(test.thread_count > 1)
+        TEST(atomic_load(&test.calls) == (count + used_chunk - 1)/used_chunk);
+    else
+        TEST(atomic_load(&test.calls) == (count > 0 ? 1 : 0));
+
+    free((void*) test.visits);
+}
+
+INTERNAL void test_parallel()
+{
+    //Thread count clamping
+    TEST(parallel_thread_count(4, 100) == 4);
+    TEST(parallel_thread_count(4, 3) == 3);
+    TEST(parallel_thread_count(4, 0) == 1);
+    TEST(parallel_thread_count(-1, 0) == 1);
+    TEST(parallel_thread_count(100000, 100000) == PARALLEL_MAX_THREADS);
+    TEST(parallel_thread_count(0, 100000) == MIN(MAX(platform_thread_get_processor_count(), 1), PARALLEL_MAX_THREADS));
+
+    //Run gives each thread a distinct index
+    for(isize thread_count = 1; thread_count <= 16; thread_count++) {
+        _Test_Parallel test = {0};
+        test.thread_count = thread_count;
+        parallel_run(thread_count, _test_parallel_run_func, &test, "parallel test");
+        TEST(atomic_load(&test.bad_ranges) == 0);
+        TEST(atomic_load(&test.calls) == thread_count);
+        TEST(atomic_load(&test.seen_threads) == ((uint64_t) 1 << thread_count) - 1);
+    }
+
+    //Groups living on the stack are reused right after each join. Threads must not outlive their group.
+    for(isize i = 0; i < 1000; i++) {
+        _Test_Parallel test = {0};
+        test.thread_count = 4;
+        parallel_run(4, _test_parallel_run_func, &test, "parallel test");
+        TEST(atomic_load(&test.calls) == 4);
+    }
+
+    //Launch/join leaves the calling thread free. Indices start at first_index
+    {
+        _Test_Parallel test = {0};
+        test.thread_count = 8;
+        Parallel_Group group = {0};
+        parallel_launch(&group, 3, 5, _test_parallel_run_func, &test, "parallel test");
+        parallel_join(&group);
+        TEST(atomic_load(&test.calls) == 5);
+        TEST(atomic_load(&test.seen_threads) == 0xF8);
+
+        parallel_launch(&group, 0, 0, _test_parallel_run_func, &test, "parallel test");
+        parallel_join(&group);
+        TEST(atomic_load(&test.calls) == 5);
+    }
+
+    //For covers every index exactly once
+    test_parallel_for_single(0, 16, 4);
+    test_parallel_for_single(1, 16, 4);
+    test_parallel_for_single(100, 1, 1);
+    test_parallel_for_single(100, 1, 0);
+    test_parallel_for_single(1000, 7, 8);
+    test_parallel_for_single(1000, 1000, 8);
+    test_parallel_for_single(1000, 5000, 8);
+    test_parallel_for_single(1000, 0, 8);
+    test_parallel_for_single(1000, -3, 0);
+    test_parallel_for_single(0, 0, 4);
+    for(isize i = 0; i < 50; i++)
+        test_parallel_for_single(random_range(0, 10000), random_range(0, 500), random_range(0, 17));
+}
@@ -0,0 +1,217 @@
+#pragma once
+
+#include "../path_store.h"
+#include "../random.h"
+#include "../assert.h"
+
+//Paths starting with three or more slashes are left out since path_parse does not handle them.
+INTERNAL isize _test_path_store_random_path(char* out, isize capacity, bool with_root)
+{
+    const char* roots[] = {"", "", "", "/", "C:/", "d:\\", "C:", "//server/share/", "\\\\server\\share\\", "\\\\?\\C:\\", "\\\\.\\pipe\\"};
+    const char* segments[] = {"a", "b", "src", "include", "very_long_directory_name", ".", "..", "..", ""};
+
+    isize size = 0;
+    if(with_root)
+        size += snprintf(out + size, (size_t) (capacity - size), "%s", roots[random_range(0, ARRAY_COUNT(roots))]);
+    isize segment_count = random_range(0, 7);
+    for(isize i = 0; i < segment_count; i++)
+    {
+        if(i > 0 || with_root == false)
+            out[size++] = random_bool() ? '/' : '\\';
+        //The first segment is never empty so that the root is not followed by a separator
+        isize segment = random_range(0, ARRAY_COUNT(segments) - (i == 0));
+        size += snprintf(out + size, (size_t) (capacity - size), "%s", segments[segment]);
+    }
+    if(segment_count > 0 && random_range(0, 4) == 0)
+        out[size++] = '/';
+    out[size] = '\0';
+    TEST(size < capacity);
+    return size;
+}
+
+INTERNAL bool _test_path_store_text_is(const Path_Store* store, Path_Id id, String expected)
+{
+    String_Builder text = builder_make(allocator_get_default(), 0);
+    path_store_append_into(store, id, &text);
+    bool out = string_is_equal(text.string, expected) && path_store_text_size(store, id) == expected.count;
+    builder_deinit(&text);
+    return out;
+}
+
+INTERNAL bool _test_path_store_is_normalized(const Path_Store* store, Path_Id id, String path)
+{
+    Path_Builder normalized = path_normalize(allocator_get_default(), path_parse(path), 0);
+    bool out = _test_path_store_text_is(store, id, normalized.string);
+    path_builder_deinit(&normalized);
+    return out;
+}
+
+INTERNAL void test_path_store_fuzz(isize count)
+{
+    Path_Store store = {0};
+    path_store_init(&store, NULL);
+
+    enum {MAX_PATHS = 256, CAPACITY = 256};
+    char texts[MAX_PATHS][CAPACITY] = {0};
+    String paths[MAX_PATHS] = {0};
+    Path_Id ids[MAX_PATHS] = {0};
+    Path_Id many_ids[MAX_PATHS] = {0};
+    String_Builder joined = builder_make(allocator_get_default(), 0);
+
+    for(isize i = 0; i < count; i++)
+    {
+        for(isize k = 0; k < MAX_PATHS; k++)
+        {
+            //Make consecutive paths share prefixes so that intern_many can resume
+            if(k > 0 && random_range(0, 3) == 0)
+            {
+                //Cutting into the root could form a path with three leading slashes
+                isize keep = random_range(0, paths[k - 1].count + 1);
+                if(keep < 16)
+                    keep = paths[k - 1].count;
+                memcpy(texts[k], texts[k - 1], (size_t) keep);
+                isize added = _test_path_store_random_path(texts[k] + keep, CAPACITY - keep, false);
+                paths[k] = string_make(texts[k], keep + added);
+            }
+            else
+                paths[k] = string_make(texts[k], _test_path_store_random_path(texts[k], CAPACITY, true));
+
+            ids[k] = path_store_intern_string(&store, paths[k]);
+            TEST(_test_path_store_is_normalized(&store, ids[k], paths[k]));
+        }
+
+        path_store_intern_many(&store, paths, MAX_PATHS, many_ids);
+        for(isize k = 0; k < MAX_PATHS; k++)
+            TEST(many_ids[k] == ids[k]);
+
+        for(isize k = 0; k < MAX_PATHS; k++)
+        {
+            Path_Id id = ids[k];
+
+            //Interning the normalized text gives the same id
+            builder_clear(&joined);
+            path_store_append_into(&store, id, &joined);
+            TEST(path_store_intern_string(&store, joined.string) == id);
+
+            //parent is the same as appending ".."
+            if(id != PATH_ID_EMPTY && path_store_depth(&store, id) > 0)
+            {
+                builder_append(&joined, STRING("/.."));
+                TEST(_test_path_store_is_normalized(&store, path_store_parent(&store, id), joined.string));
+            }
+
+            //concat matches path_concat of the normalized texts. path_concat lets ".." of b remove the "." of
+            // "./" or "\\.\./" so these are left out
+            Path_Id next = ids[(k + 1) % MAX_PATHS];
+            builder_clear(&joined);
+            path_store_append_into(&store, id, &joined);
+            if(id != PATH_ID_EMPTY && string_has_substring_at(joined.string, STRING("./"), joined.count - 2) == false && next != PATH_ID_EMPTY)
+            {
+                String_Builder next_text = builder_make(allocator_get_default(), 0);
+                path_store_append_into(&store, next, &next_text);
+
+                Path_Builder concated = path_concat(allocator_get_default(), path_parse(joined.string), path_parse(next_text.string));
+                Path_Id concat_id = path_store_concat(&store, id, next);
+                TEST(_test_path_store_is_normalized(&store, concat_id, concated.string));
+                TEST(path_store_concat(&store, id, next) == concat_id);
+                path_builder_deinit(&concated);
+                builder_deinit(&next_text);
+            }
+
+            Path_Id child = path_store_child(&store, path_store_to_directory(id), STRING("child"));
+            TEST(path_store_parent(&store, child) == path_store_to_directory(id) || path_store_depth(&store, id) == 0);
+            TEST(path_store_is_within(&store, path_store_to_directory(id), child));
+            TEST(string_is_equal(path_store_segment(&store, child), STRING("child")));
+        }
+    }
+
+    builder_deinit(&joined);
+    path_store_deinit(&store);
+}
+
+INTERNAL void test_path_store_basic()
+{
+    Path_Store store = {0};
+    path_store_init(&store, NULL);
+
+    #define INTERN(text) path_store_intern_string(&store, STRING(text))
+    #define TEXT_IS(id, text) TEST(_test_path_store_text_is(&store, id, STRING(text)))
+
+    //Equivalent spellings are the same id
+    TEST(INTERN("") == PATH_ID_EMPTY);
+    TEST(INTERN(".") == PATH_ID_CURRENT);
+    TEST(INTERN("a/..") == PATH_ID_CURRENT);
+    TEST(INTERN("src/main.c") == INTERN("src\\.\\lib\\..\\main.c"));
+    TEST(INTERN("/usr/include/") == INTERN("/usr//include/"));
+    TEST(INTERN("/usr/include/") != INTERN("/usr/include"));
+    TEST(INTERN("C:\\Windows") == INTERN("c:/Windows"));
+    TEST(INTERN("C:/a") != INTERN("C:a"));
+    TEST(INTERN("a") != INTERN("/a"));
+    TEXT_IS(INTERN("\\\\?\\C:\\x\\.."), "\\\\?\\C:/");
+    TEXT_IS(INTERN("../../a/b/../c"), "../../a/c");
+    TEXT_IS(INTERN("/../a"), "/a");
+
+    //Relations
+    Path_Id file = INTERN("/home/user/project/src/main.c");
+    Path_Id src = INTERN("/home/user/project/src/");
+    TEST(path_store_parent(&store, file) == src);
+    TEST(path_store_parent(&store, INTERN("/")) == INTERN("/"));
+    TEST(path_store_parent(&store, INTERN("a")) == PATH_ID_CURRENT);
+    TEST(path_store_parent(&store, PATH_ID_CURRENT) == INTERN("../"));
+    TEST(path_store_parent(&store, INTERN("../")) == INTERN("../../"));
+    TEST(path_store_child(&store, src, STRING("main.c")) == file);
+    TEST(path_store_child(&store, file, STRING("..")) == src);
+    TEST(path_store_child(&store, src, STRING(".")) == src);
+    TEST(path_store_concat(&store, INTERN("/home/user"), INTERN("project/src/main.c")) == file);
+    TEST(path_store_concat(&store, INTERN("/home/user/x/"), INTERN("../project/src/main.c")) == file);
+    TEST(path_store_concat(&store, file, PATH_ID_EMPTY) == file);
+    TEST(path_store_concat(&store, PATH_ID_EMPTY, file) == file);
+    TEST(path_store_concat(&store, INTERN("a"), INTERN("../../b/")) == INTERN("../b/"));
+    TEST(path_store_concat(&store, INTERN("/a"), INTERN("../../b/")) == INTERN("/b/"));
+    TEST(path_store_depth(&store, file) == 5);
+    TEST(path_store_depth(&store, INTERN("C:/")) == 0);
+    TEST(path_store_root(&store, file) == INTERN("/"));
+    TEST(path_store_root(&store, INTERN("a/b")) == PATH_ID_EMPTY);
+    TEST(path_store_is_absolute(&store, file));
+    TEST(path_store_is_absolute(&store, INTERN("C:a")) == false);
+    TEST(path_store_is_directory(src));
+    TEST(path_store_to_file(&store, src) == INTERN("/home/user/project/src"));
+    TEST(path_store_to_file(&store, INTERN("/")) == INTERN("/"));
+    TEST(path_store_to_file(&store, INTERN("../")) == INTERN("../"));
+    TEST(path_store_to_directory(file) == INTERN("/home/user/project/src/main.c/"));
+    TEST(string_is_equal(path_store_segment(&store, file), STRING("main.c")));
+    TEST(string_is_equal(path_store_segment(&store, INTERN("//server/share")), STRING("share")));
+
+    TEST(path_store_is_within(&store, src, file));
+    TEST(path_store_is_within(&store, INTERN("/home/"), file));
+    TEST(path_store_is_within(&store, INTERN("/"), file));
+    TEST(path_store_is_within(&store, file, file));
+    TEST(path_store_is_within(&store, file, src) == false);
+    TEST(path_store_is_within(&store, INTERN("/home/usr/"), file) == false);
+    TEST(path_store_is_within(&store, PATH_ID_CURRENT, INTERN("a/b")));
+    TEST(path_store_is_within(&store, PATH_ID_CURRENT, INTERN("../b")) == false);
+    TEST(path_store_is_within(&store, INTERN("../"), INTERN("../b")));
+    TEST(path_store_is_within(&store, INTERN("../"), INTERN("../../b")) == false);
+    TEST(path_store_is_within(&store, PATH_ID_CURRENT, file) == false);
+
+    //relative_to is a directory if it has trailing slash, otherwise its containing directory is used
+    TEST(path_store_make_relative(&store, src, file) == INTERN("main.c"));
+    TEST(path_store_make_relative(&store, file, file) == INTERN("main.c"));
+    TEST(path_store_make_relative(&store, src, src) == PATH_ID_CURRENT);
+    TEST(path_store_make_relative(&store, INTERN("/home/user/other/x.c"), file) == INTERN("../project/src/main.c"));
+    TEST(path_store_make_relative(&store, INTERN("/home/user/other/"), src) == INTERN("../project/src/"));
+    TEST(path_store_make_relative(&store, INTERN("/etc/a/b/"), file) == INTERN("../../../home/user/project/src/main.c"));
+    TEST(path_store_make_relative(&store, INTERN("a/"), INTERN("../x")) == INTERN("../../x"));
+    TEST(path_store_make_relative(&store, INTERN("C:/a/"), file) == file);
+    TEST(path_store_make_relative(&store, INTERN("../a/"), INTERN("b")) == INTERN("b"));
+
+    #undef INTERN
+    #undef TEXT_IS
+    path_store_deinit(&store);
+}
+
+INTERNAL void test_path_store()
+{
+    test_path_store_basic();
+    test_path_store_fuzz(6);
+}
@@ -88,6 +88,25 @@ static void platform_test_file_io()
         PTEST(true, platform_file_resize(move_file_path, PUGLY_STRING.count));
         platform_test_file_content_equality(move_file_path, PUGLY_STRING);
 
+        //Map the file. Copy on write changes must not reach the file
+        {
+            Platform_File map_file = {0};
+            PTEST(true, platform_file_open(&map_file, move_file_path, PLATFORM_FILE_OPEN_READ));
+
+            void* mapped = NULL;
+            PTEST(true, platform_file_map(&mapped, &map_file, 0, PUGLY_STRING.count, PLATFORM_FILE_MAP_READ));
+            PTEST(true, platform_file_close(&map_file));
+            TEST(mapped && memcmp(mapped, PUGLY_STRING.data, PUGLY_STRING.count) == 0);
+            PTEST(true, platform_file_unmap(mapped, PUGLY_STRING.count));
+
+            PTEST(true, platform_file_open(&map_file, move_file_path, PLATFORM_FILE_OPEN_READ));
+            PTEST(true, platform_file_map(&mapped, &map_file, 0, PUGLY_STRING.count, PLATFORM_FILE_MAP_READ | PLATFORM_FILE_MAP_COPY_ON_WRITE));
+            memset(mapped, 'x', PUGLY_STRING.count);
+            PTEST(true, platform_file_unmap(mapped, PUGLY_STRING.count));
+            PTEST(true, platform_file_close(&map_file));
+            platform_test_file_content_equality(move_file_path, PUGLY_STRING);
+        }
+
         //Cleanup the directory so it can be deleted.
         PTEST(true, platform_file_remove(write_file_path, false)); //Just in case
         PTEST(true, platform_file_remove(read_file_path, true));
@@ -40,7 +40,6 @@ void ser_f32v3(Ser_Writer* w, const float vals[3]) {
         data[i++] = SER_F32; memcpy(data + i, vals + c++, sizeof(float)); i += sizeof(float);
         data[i++] = SER_F32; memcpy(data + i, vals + c++, sizeof(float)); i += sizeof(float);
         data[i++] = SER_F32; memcpy(data + i, vals + c++, sizeof(float)); i += sizeof(float);
-        data[i++] = SER_F32; memcpy(data + i, vals + c++, sizeof(float)); i += sizeof(float);
     data[i++] = SER_ARRAY_END;
     ser_writer_write(w, data, i);
 }
@@ -236,6 +235,287 @@ void test_ser_conversion(Test_Ser_Gen from, Test_Ser_Gen expected, bool success)
         TEST(res.mu64 == expected.mu64);
 }
 
+typedef struct Test_Ser_Particle {
+    uint64_t id;
+    int32_t charge;
+    uint8_t flags;
+    int16_t group;
+    bool alive;
+    float mass;
+    double energy;
+    Vec3 pos;
+    String name;
+    String payload;
+    Tex_Info texture;
+} Test_Ser_Particle;
+
+//The old version had fewer, narrower fields and named the energy differently
+typedef struct Test_Ser_Particle_Old {
+    uint32_t id;
+    int8_t charge;
+    float energy;
+    String name;
+} Test_Ser_Particle_Old;
+
+bool _test_ser_read_vec3(Ser_Value val, void* field) { return deser_f32v3(&val, ((Vec3*) field)->floats); }
+void _test_ser_write_vec3(Ser_Writer* w, const void* field) { ser_f32v3(w, ((const Vec3*) field)->floats); }
+bool _test_ser_read_tex_info(Ser_Value val, void* field) { return deser_map_info(val, (Tex_Info*) field); }
+void _test_ser_write_tex_info(Ser_Writer* w, const void* field) { ser_map_info(w, *(const Tex_Info*) field); }
+
+typedef struct Test_Ser_Inner {
+    int32_t a;
+    String s;
+} Test_Ser_Inner;
+
+typedef struct Test_Ser_Outer {
+    Test_Ser_Inner first;
+    uint16_t between;
+    Test_Ser_Inner second;
+} Test_Ser_Outer;
+
+typedef struct Test_Ser_Chunks {
+    Ser_Writer data;
+    isize ends[256];
+    isize count;
+    isize next;
+} Test_Ser_Chunks;
+
+void _test_ser_flush_into(void* context, const uint8_t* data, isize size)
+{
+    Test_Ser_Chunks* chunks = (Test_Ser_Chunks*) context;
+    ser_writer_write(&chunks->data, data, size);
+    TEST(chunks->count < ARRAY_COUNT(chunks->ends));
+    chunks->ends[chunks->count++] = chunks->data.offset;
+}
+
+//Gives out the chunks exactly as they were flushed
+bool _test_ser_refill_from(void* context, Ser_Reader* r)
+{
+    Test_Ser_Chunks* chunks = (Test_Ser_Chunks*) context;
+    if(chunks->next >= chunks->count)
+        return false;
+
+    isize from = chunks->next > 0 ? chunks->ends[chunks->next - 1] : 0;
+    r->data = chunks->data.data + from;
+    r->offset = 0;
+    r->capacity = chunks->ends[chunks->next] - from;
+    chunks->next += 1;
+    return true;
+}
+
+void test_ser_schema()
+{
+    Ser_Schema_Field particle_fields[] = {
+        SER_SCHEMA_FIELD(Test_Ser_Particle, id, SER_U64),
+        SER_SCHEMA_FIELD(Test_Ser_Particle, charge, SER_I32),
+        SER_SCHEMA_FIELD(Test_Ser_Particle, flags, SER_U8),
+        SER_SCHEMA_FIELD(Test_Ser_Particle, group, SER_I16),
+        SER_SCHEMA_FIELD(Test_Ser_Particle, alive, SER_BOOL),
+        SER_SCHEMA_FIELD(Test_Ser_Particle, mass, SER_F32),
+        SER_SCHEMA_FIELD_NAMED(Test_Ser_Particle, energy, "energy_joules", SER_F64),
+        SER_SCHEMA_FIELD_CUSTOM(Test_Ser_Particle, pos, _test_ser_read_vec3, _test_ser_write_vec3),
+        SER_SCHEMA_FIELD(Test_Ser_Particle, name, SER_STRING),
+        SER_SCHEMA_FIELD(Test_Ser_Particle, payload, SER_BINARY),
+        SER_SCHEMA_FIELD_CUSTOM(Test_Ser_Particle, texture, _test_ser_read_tex_info, _test_ser_write_tex_info),
+    };
+    Ser_Schema_Field old_fields[] = {
+        SER_SCHEMA_FIELD(Test_Ser_Particle_Old, id, SER_U32),
+        SER_SCHEMA_FIELD(Test_Ser_Particle_Old, charge, SER_I8),
+        SER_SCHEMA_FIELD_NAMED(Test_Ser_Particle_Old, energy, "energy_joules", SER_F32),
+        SER_SCHEMA_FIELD(Test_Ser_Particle_Old, name, SER_STRING),
+    };
+
+    Ser_Schema particle_schema = {0};
+    Ser_Schema old_schema = {0};
+    TEST(ser_schema_init(&particle_schema, particle_fields, ARRAY_COUNT(particle_fields), "Particle"));
+    TEST(ser_schema_init(&old_schema, old_fields, ARRAY_COUNT(old_fields), NULL));
+
+    Test_Ser_Particle particle = {0};
+    particle.id = 1ull << 40;
+    particle.charge = -3;
+    particle.flags = 0xA5;
+    particle.group = -300;
+    particle.alive = true;
+    particle.mass = 1.5f;
+    particle.energy = 0.1;
+    particle.pos = vec3(1, 2, 3);
+    particle.name = STRING("electron");
+    particle.payload = STRING("\0\1\2 binary");
+    particle.texture = SINIT(Tex_Info){STRING("tex"), vec3(4, 5, 6), 2, {1, 2, 0, 0}, MAP_SCALE_FILTER_NEAREST, MAP_REPEAT_REPEAT};
+
+    //Roundtrip including through a flushing writer with chunks smaller than the object read back chunk by chunk
+    for(int flushing = 0; flushing < 2; flushing++)
+    {
+        Test_Ser_Chunks chunks = {0};
+        Ser_Writer writer = {0};
+        if(flushing)
+            ser_writer_init_flushing(&writer, 16, _test_ser_flush_into, &chunks, NULL);
+        for(int i = 0; i < 3; i++)
+            ser_schema_write(&writer, &particle_schema, &particle);
+        ser_writer_flush(&writer);
+
+        Ser_Reader reader = ser_reader_make(writer.data, writer.offset);
+        if(flushing) {
+            reader = ser_reader_make(NULL, 0);
+            reader.refill = _test_ser_refill_from;
+            reader.refill_context = &chunks;
+        }
+        for(int i = 0; i < 3; i++)
+        {
+            Test_Ser_Particle read = {0};
+            uint64_t found = 0;
+            Ser_Value value = {0};
+            TEST(deser_value(&reader, &value) && value.type == SER_RECOVERY_OBJECT);
+            TEST(deser_schema(value, &particle_schema, &read, &found));
+            TEST(found == (1ull << ARRAY_COUNT(particle_fields)) - 1);
+            TEST(read.id == particle.id && read.charge == particle.charge && read.flags == particle.flags && read.group == particle.group);
+            TEST(read.alive && read.mass == particle.mass && read.energy == particle.energy);
+            TEST(vec3_is_equal(read.pos, particle.pos));
+            TEST(string_is_equal(read.name, particle.name) && string_is_equal(read.payload, particle.payload));
+            TEST(string_is_equal(read.texture.name, particle.texture.name) && read.texture.indices[1] == 2 && read.texture.filter == MAP_SCALE_FILTER_NEAREST);
+        }
+
+        ser_writer_deinit(&writer);
+        ser_writer_deinit(&chunks.data);
+    }
+
+    //Old data read by the new schema: missing fields stay untouched, narrower types are widened
+    {
+        Test_Ser_Particle_Old old = {7, -2, 0.5f, STRING("old")};
+        Ser_Writer writer = {0};
+        ser_schema_write(&writer, &old_schema, &old);
+
+        Test_Ser_Particle read = {0};
+        read.mass = 42;
+        uint64_t found = 0;
+        Ser_Reader reader = ser_reader_make(writer.data, writer.offset);
+        Ser_Value value = {0};
+        TEST(deser_value(&reader, &value) && value.type == SER_OBJECT);
+        TEST(deser_schema(value, &particle_schema, &read, &found));
+        TEST(found == (1 << 0 | 1 << 1 | 1 << 6 | 1 << 8));
+        TEST(read.id == 7 && read.charge == -2 && read.energy == 0.5 && read.mass == 42 && string_is_equal(read.name, STRING("old")));
+        ser_writer_deinit(&writer);
+    }
+
+    //New data read by the old schema: unknown fields (including nested ones) are skipped, values which do not fit fail
+    {
+        Ser_Writer writer = {0};
+        ser_schema_write(&writer, &particle_schema, &particle);
+        particle.id = 9;
+        particle.energy = 0.25;
+        ser_schema_write(&writer, &particle_schema, &particle);
+
+        Test_Ser_Particle_Old read = {0};
+        uint64_t found = 0;
+        Ser_Reader reader = ser_reader_make(writer.data, writer.offset);
+        Ser_Value value = {0};
+        TEST(deser_value(&reader, &value));
+        TEST(deser_schema(value, &old_schema, &read, &found) == false);
+        TEST(found == (1 << 1 | 1 << 3) && read.charge == -3 && string_is_equal(read.name, STRING("electron")));
+
+        TEST(deser_value(&reader, &value));
+        TEST(deser_schema(value, &old_schema, &read, &found));
+        TEST(found == 15 && read.id == 9 && read.energy == 0.25f);
+        ser_writer_deinit(&writer);
+    }
+
+    //Hand written object with non string keys, unknown keys that collide in the table and a non object value
+    {
+        Ser_Writer writer = {0};
+        ser_object_begin(&writer);
+            ser_i32(&writer, 5);                ser_i32(&writer, 6);
+            ser_cstring(&writer, "namf");       ser_cstring(&writer, "not a name");
+            ser_cstring(&writer, "name_long");  ser_cstring(&writer, "not a name");
+            ser_cstring(&writer, "charge");     ser_f64(&writer, -1);
+            ser_cstring(&writer, "");           ser_null(&writer);
+            ser_cstring(&writer, "name");       ser_cstring(&writer, "hand");
+        ser_object_end(&writer);
+        ser_u8(&writer, 1);
+
+        Test_Ser_Particle_Old read = {0};
+        uint64_t found = 0;
+        Ser_Reader reader = ser_reader_make(writer.data, writer.offset);
+        Ser_Value value = {0};
+        TEST(deser_value(&reader, &value));
+        TEST(deser_schema(value, &old_schema, &read, &found));
+        TEST(found == (1 << 1 | 1 << 3) && read.charge == -1 && string_is_equal(read.name, STRING("hand")));
+        TEST(deser_value(&reader, &value));
+        TEST(deser_schema(value, &old_schema, &read, &found) == false);
+        ser_writer_deinit(&writer);
+    }
+
+    //Nested schemas
+    {
+        Ser_Schema_Field inner_fields[] = {
+            SER_SCHEMA_FIELD(Test_Ser_Inner, a, SER_I32),
+            SER_SCHEMA_FIELD(Test_Ser_Inner, s, SER_STRING),
+        };
+        Ser_Schema inner_schema = {0};
+        TEST(ser_schema_init(&inner_schema, inner_fields, ARRAY_COUNT(inner_fields), NULL));
+        Ser_Schema_Field outer_fields[] = {
+            SER_SCHEMA_FIELD_OBJECT(Test_Ser_Outer, first, &inner_schema),
+            SER_SCHEMA_FIELD(Test_Ser_Outer, between, SER_U16),
+            SER_SCHEMA_FIELD_OBJECT(Test_Ser_Outer, second, &inner_schema),
+        };
+        Ser_Schema outer_schema = {0};
+        TEST(ser_schema_init(&outer_schema, outer_fields, ARRAY_COUNT(outer_fields), "Outer"));
+
+        Test_Ser_Outer outer = {{1, STRING("one")}, 2, {3, STRING("three")}};
+        Test_Ser_Outer read = {0};
+        Ser_Writer writer = {0};
+        ser_schema_write(&writer, &outer_schema, &outer);
+        Ser_Reader reader = ser_reader_make(writer.data, writer.offset);
+        Ser_Value value = {0};
+        TEST(deser_value(&reader, &value));
+        TEST(deser_schema(value, &outer_schema, &read, NULL));
+        TEST(read.first.a == 1 && read.between == 2 && read.second.a == 3);
+        TEST(string_is_equal(read.first.s, STRING("one")) && string_is_equal(read.second.s, STRING("three")));
+        ser_writer_deinit(&writer);
+    }
+
+    //Invalid schemas
+    {
+        Ser_Schema schema = {0};
+        Ser_Schema_Field duplicate[] = {SER_SCHEMA_FIELD(Test_Ser_Inner, a, SER_I32), SER_SCHEMA_FIELD_NAMED(Test_Ser_Inner, s, "a", SER_STRING)};
+        Ser_Schema_Field mismatched[] = {SER_SCHEMA_FIELD(Test_Ser_Inner, a, SER_I64)};
+        Ser_Schema_Field unnamed[] = {SER_SCHEMA_FIELD_NAMED(Test_Ser_Inner, a, "", SER_I32)};
+        Ser_Schema_Field no_schema[] = {SER_SCHEMA_FIELD_OBJECT(Test_Ser_Outer, first, NULL)};
+        TEST(ser_schema_init(&schema, duplicate, ARRAY_COUNT(duplicate), NULL) == false);
+        TEST(ser_schema_init(&schema, mismatched, ARRAY_COUNT(mismatched), NULL) == false);
+        TEST(ser_schema_init(&schema, unnamed, ARRAY_COUNT(unnamed), NULL) == false);
+        TEST(ser_schema_init(&schema, no_schema, ARRAY_COUNT(no_schema), NULL) == false);
+    }
+
+    //The maximum number of fields still gets a perfect hash and every one of them is found
+    {
+        uint8_t values[SER_SCHEMA_MAX_FIELDS] = {0};
+        uint8_t read[SER_SCHEMA_MAX_FIELDS] = {0};
+        char names[SER_SCHEMA_MAX_FIELDS][16] = {0};
+        Ser_Schema_Field fields[SER_SCHEMA_MAX_FIELDS] = {0};
+        for(int i = 0; i < SER_SCHEMA_MAX_FIELDS; i++) {
+            snprintf(names[i], sizeof names[i], "field_%i", i);
+            Ser_Schema_Field field = {names[i], i, 1, SER_U8};
+            fields[i] = field;
+            values[i] = (uint8_t) (i*7 + 1);
+        }
+
+        Ser_Schema schema = {0};
+        TEST(ser_schema_init(&schema, fields, SER_SCHEMA_MAX_FIELDS, NULL));
+        TEST(ser_schema_init(&schema, fields, SER_SCHEMA_MAX_FIELDS + 1, NULL) == false);
+        TEST(ser_schema_init(&schema, fields, SER_SCHEMA_MAX_FIELDS, NULL));
+
+        Ser_Writer writer = {0};
+        ser_schema_write(&writer, &schema, values);
+        Ser_Reader reader = ser_reader_make(writer.data, writer.offset);
+        Ser_Value value = {0};
+        uint64_t found = 0;
+        TEST(deser_value(&reader, &value));
+        TEST(deser_schema(value, &schema, read, &found));
+        TEST(found == UINT64_MAX && memcmp(values, read, sizeof values) == 0);
+        ser_writer_deinit(&writer);
+    }
+}
+
 //TODO: test recovery, forwards/backwards comaptibility through skipping fields of objects etc.
 void test_serialize()
 {
@@ -316,4 +596,6 @@ void test_serialize()
     test_ser_conversion(_test_ser_f32(0.5), _test_ser_i16(0), false);
     test_ser_conversion(_test_ser_f32(INT16_MIN), _test_ser_i16(INT16_MIN), true);
     test_ser_conversion(_test_ser_f32(INT32_MIN), _test_ser_i16(0), false);
+
+    test_ser_schema();
 }
\ No newline at end of file
@@ -0,0 +1,252 @@
+#pragma once
+
+#include "../serialize_stream.h"
+#include "../allocator_debug.h"
+
+#define SER_STREAM_TEST_PATH "__ser_stream_test__.bin"
+
+INTERNAL Platform_String _ser_stream_test_path()
+{
+    Platform_String out = {SER_STREAM_TEST_PATH, sizeof(SER_STREAM_TEST_PATH) - 1};
+    return out;
+}
+
+INTERNAL void _ser_stream_test_fill(uint8_t* into, isize size, isize seed)
+{
+    for(isize i = 0; i < size; i++)
+        into[i] = (uint8_t) "serialize stream "[(i + seed) % 17] + (uint8_t) (i/1000 % 3);
+}
+
+//Writes {"name": ..., "items": [{"id", "name", "value", "blob"}...], "big": binary bigger than a chunk}
+INTERNAL void _ser_stream_test_write(Ser_Writer* w, isize item_count, isize big_size)
+{
+    char name[64] = {0};
+    uint8_t blob[128] = {0};
+    ser_object_begin(w);
+        ser_cstring(w, "name");
+        ser_cstring(w, "streamed document");
+        ser_cstring(w, "items");
+        ser_recovery_array_begin(w, "items");
+        for(isize i = 0; i < item_count; i++)
+        {
+            snprintf(name, sizeof name, "item_%lli", (long long) i);
+            _ser_stream_test_fill(blob, i % 97, i);
+            ser_object_begin(w);
+                ser_cstring(w, "id");       ser_u64(w, (uint64_t) i);
+                ser_cstring(w, "name");     ser_cstring(w, name);
+                ser_cstring(w, "value");    ser_f64(w, (f64) i/4);
+                ser_cstring(w, "blob");     ser_binary(w, blob, i % 97);
+            ser_object_end(w);
+        }
+        ser_recovery_array_end(w, "items");
+
+        uint8_t* big = (uint8_t*) allocator_allocate(allocator_get_default(), big_size + 1, 8);
+        _ser_stream_test_fill(big, big_size, 0);
+        ser_cstring(w, "big");
+        ser_binary(w, big, big_size);
+        allocator_deallocate(allocator_get_default(), big, big_size + 1, 8);
+    ser_object_end(w);
+}
+
+INTERNAL void _ser_stream_test_read(Ser_Reader* r, isize item_count, isize big_size)
+{
+    char name[64] = {0};
+    uint8_t blob[128] = {0};
+    isize items_read = 0;
+    bool big_read = false;
+
+    Ser_Value root = {0};
+    TEST(deser_value(r, &root));
+    for(Ser_Value key = {0}, val = {0}; deser_iterate_object(&root, &key, &val); )
+    {
+        if(ser_cstring_eq(key, "name"))
+            TEST(ser_cstring_eq(val, "streamed document"));
+        else if(ser_cstring_eq(key, "items"))
+        {
+            for(Ser_Value item = {0}; deser_iterate_array(&val, &item); items_read++)
+            {
+                isize i = items_read;
+                snprintf(name, sizeof name, "item_%lli", (long long) i);
+                _ser_stream_test_fill(blob, i % 97, i);
+
+                int fields = 0;
+                for(Ser_Value field = {0}, field_val = {0}; deser_iterate_object(&item, &field, &field_val); fields++)
+                {
+                    uint64_t id = 0; f64 value = 0; Ser_String string = {0};
+                         if(ser_cstring_eq(field, "id"))    TEST(deser_u64(field_val, &id) && id == (uint64_t) i);
+                    else if(ser_cstring_eq(field, "name"))  TEST(ser_cstring_eq(field_val, name));
+                    else if(ser_cstring_eq(field, "value")) TEST(deser_f64(field_val, &value) && value == (f64) i/4);
+                    else if(ser_cstring_eq(field, "blob"))  TEST(deser_binary(field_val, &string) && string.count == i % 97 && memcmp(string.data, blob, i % 97) == 0);
+                    else TEST(false);
+                }
+                TEST(fields == 4);
+            }
+        }
+        else if(ser_cstring_eq(key, "big"))
+        {
+            Ser_String string = {0};
+            TEST(deser_binary(val, &string) && string.count == big_size);
+            for(isize i = 0; i < big_size; i += 997) {
+                uint8_t expected = 0;
+                _ser_stream_test_fill(&expected, 1, i);
+                TEST((uint8_t) string.data[i] == (uint8_t) (expected + (uint8_t) (i/1000 % 3)));
+            }
+            big_read = true;
+        }
+        else
+            TEST(false);
+    }
+
+    TEST(items_read == item_count);
+    TEST(big_read);
+
+    //Nothing after the document
+    Ser_Value after = {0};
+    TEST(deser_value(r, &after) == false);
+}
+
+INTERNAL void test_ser_stream_file(isize item_count, isize chunk_size, bool compress)
+{
+    Debug_Allocator debug = debug_allocator_make(allocator_get_default(), DEBUG_ALLOC_LEAK_CHECK);
+    {
+        isize big_size = (chunk_size > 0 ? chunk_size : SER_STREAM_DEFAULT_CHUNK)*3 + 7;
+        Ser_Stream_Options options = {0};
+        options.allocator_or_null = debug.alloc;
+        options.chunk_size = chunk_size;
+        options.compress = compress;
+
+        Ser_Stream_Writer writer = {0};
+        TEST(ser_stream_writer_init_file(&writer, _ser_stream_test_path(), &options) == SER_STREAM_OK);
+        _ser_stream_test_write(&writer.w, item_count, big_size);
+
+        //Only the single item bigger than a chunk made the buffer grow
+        TEST(writer.w.capacity <= big_size + 16);
+        if(item_count > 1000 && chunk_size > 0)
+            TEST(writer.chunk_count > item_count*20/chunk_size);
+        if(compress && item_count > 1000)
+            TEST(writer.stored_bytes < writer.raw_bytes/2);
+        TEST(ser_stream_writer_deinit(&writer) == SER_STREAM_OK);
+
+        Ser_Stream_Reader reader = {0};
+        TEST(ser_stream_reader_init_file(&reader, _ser_stream_test_path(), debug.alloc) == SER_STREAM_OK);
+        _ser_stream_test_read(&reader.r, item_count, big_size);
+        TEST(reader.ended);
+        TEST(reader.capacities[0] <= big_size + 16 && reader.capacities[1] <= big_size + 16);
+        TEST(ser_stream_reader_deinit(&reader) == SER_STREAM_OK);
+    }
+    debug_allocator_deinit(&debug);
+}
+
+typedef struct _Ser_Stream_Test_Producer {
+    Channel* channel;
+    Ser_Stream_Options options;
+    isize item_count;
+    isize big_size;
+    PLATFORM_ATOMIC(uint32_t) done;
+} _Ser_Stream_Test_Producer;
+
+INTERNAL void _ser_stream_test_producer(void* context)
+{
+    _Ser_Stream_Test_Producer* producer = (_Ser_Stream_Test_Producer*) context;
+    Ser_Stream_Writer writer = {0};
+    ser_stream_writer_init_channel(&writer, producer->channel, &producer->options);
+    _ser_stream_test_write(&writer.w, producer->item_count, producer->big_size);
+    TEST(ser_stream_writer_deinit(&writer) == SER_STREAM_OK);
+
+    atomic_store(&producer->done, 1);
+    platform_futex_wake_all(&producer->done);
+}
+
+INTERNAL void test_ser_stream_channel(isize item_count, isize chunk_size, bool compress)
+{
+    //The channel is small so the writer regularly waits on the reader
+    _Ser_Stream_Test_Producer producer = {0};
+    producer.channel = channel_malloc(4, SER_STREAM_CHANNEL_INFO);
+    producer.options.chunk_size = chunk_size;
+    producer.options.compress = compress;
+    producer.item_count = item_count;
+    producer.big_size = chunk_size*2 + 3;
+    TEST(platform_thread_launch(0, _ser_stream_test_producer, &producer, "ser stream producer") == 0);
+
+    Ser_Stream_Reader reader = {0};
+    ser_stream_reader_init_channel(&reader, producer.channel, NULL);
+    _ser_stream_test_read(&reader.r, item_count, producer.big_size);
+    TEST(ser_stream_reader_deinit(&reader) == SER_STREAM_OK);
+
+    while(atomic_load(&producer.done) == 0)
+        platform_futex_wait(&producer.done, 0, -1);
+    channel_deinit(producer.channel);
+}
+
+INTERNAL void test_ser_stream_corrupted()
+{
+    Ser_Stream_Options options = {0};
+    options.chunk_size = 1024;
+    options.compress = true;
+
+    Ser_Stream_Writer writer = {0};
+    TEST(ser_stream_writer_init_file(&writer, _ser_stream_test_path(), &options) == SER_STREAM_OK);
+    _ser_stream_test_write(&writer.w, 1000, 2000);
+    TEST(ser_stream_writer_deinit(&writer) == SER_STREAM_OK);
+
+    isize size = 0;
+    Platform_File file = {0};
+    TEST(platform_file_open(&file, _ser_stream_test_path(), PLATFORM_FILE_OPEN_READ_WRITE) == 0);
+    TEST(platform_file_size(&file, &size) == 0);
+    uint8_t* data = (uint8_t*) allocator_allocate(allocator_get_default(), size, 8);
+    TEST(platform_file_read(&file, data, size, 0, NULL) == 0);
+    platform_file_close(&file);
+
+    //Without the end frame
+    TEST(platform_file_open(&file, _ser_stream_test_path(), PLATFORM_FILE_OPEN_WRITE | PLATFORM_FILE_OPEN_REMOVE_CONTENT) == 0);
+    TEST(platform_file_write(&file, data, size - 16, 0) == 0);
+    platform_file_close(&file);
+
+    Ser_Stream_Reader reader = {0};
+    Ser_Value value = {0};
+    TEST(ser_stream_reader_init_file(&reader, _ser_stream_test_path(), NULL) == SER_STREAM_OK);
+    while(deser_value(&reader.r, &value));
+    TEST(ser_stream_reader_deinit(&reader) == SER_STREAM_ERROR_TRUNCATED);
+
+    //Wrong magic
+    data[0] ^= 1;
+    TEST(platform_file_open(&file, _ser_stream_test_path(), PLATFORM_FILE_OPEN_WRITE | PLATFORM_FILE_OPEN_REMOVE_CONTENT) == 0);
+    TEST(platform_file_write(&file, data, size, 0) == 0);
+    platform_file_close(&file);
+    TEST(ser_stream_reader_init_file(&reader, _ser_stream_test_path(), NULL) == SER_STREAM_ERROR_CORRUPTED);
+    TEST(deser_value(&reader.r, &value) == false);
+    TEST(ser_stream_reader_deinit(&reader) == SER_STREAM_ERROR_CORRUPTED);
+    data[0] ^= 1;
+
+    //Frame claiming more data than there is
+    uint64_t huge = (uint64_t) 1 << 40;
+    memcpy(data + 8 + 8, &huge, sizeof huge);
+    TEST(platform_file_open(&file, _ser_stream_test_path(), PLATFORM_FILE_OPEN_WRITE | PLATFORM_FILE_OPEN_REMOVE_CONTENT) == 0);
+    TEST(platform_file_write(&file, data, size, 0) == 0);
+    platform_file_close(&file);
+    TEST(ser_stream_reader_init_file(&reader, _ser_stream_test_path(), NULL) == SER_STREAM_OK);
+    TEST(deser_value(&reader.r, &value) == false);
+    TEST(ser_stream_reader_deinit(&reader) == SER_STREAM_ERROR_TRUNCATED);
+
+    //Missing file
+    Platform_String missing = {"__ser_stream_test_missing__.bin", sizeof("__ser_stream_test_missing__.bin") - 1};
+    TEST(ser_stream_reader_init_file(&reader, missing, NULL) == SER_STREAM_ERROR_IO);
+    TEST(reader.platform_error != 0);
+    ser_stream_reader_deinit(&reader);
+
+    allocator_deallocate(allocator_get_default(), data, size, 8);
+    platform_file_remove(_ser_stream_test_path(), false);
+}
+
+INTERNAL void test_serialize_stream()
+{
+    for(isize compress = 0; compress < 2; compress++) {
+        test_ser_stream_file(0, 64, compress != 0);
+        test_ser_stream_file(10, 64, compress != 0);
+        test_ser_stream_file(20000, 4096, compress != 0);
+        test_ser_stream_file(20000, 0, compress != 0);
+        test_ser_stream_channel(20000, 4096, compress != 0);
+    }
+    test_ser_stream_corrupted();
+    platform_file_remove(_ser_stream_test_path(), false);
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "../slz4_parallel.h"
+#include "../random.h"
+
+typedef struct _Test_SLZ4_Parallel_Stream {
+    const uint8_t* expected;
+    isize next_offset;
+    isize stop_after;       //stops once this many bytes were received. -1 for never
+} _Test_SLZ4_Parallel_Stream;
+
+INTERNAL bool _test_slz4_parallel_consumer(void* context, const void* data, isize size, isize offset)
+{
+    _Test_SLZ4_Parallel_Stream* stream = (_Test_SLZ4_Parallel_Stream*) context;
+    TEST(offset == stream->next_offset);
+    TEST(memcmp(stream->expected + offset, data, size) == 0);
+    stream->next_offset += size;
+    return stream->stop_after < 0 || stream->next_offset < stream->stop_after;
+}
+
+INTERNAL void test_slz4_parallel_single(isize size, isize block_size, isize thread_count, bool compressible)
+{
+    Allocator* alloc = allocator_get_default();
+    uint8_t* input = (uint8_t*) allocator_allocate(alloc, size + 1, 8);
+    uint8_t* output = (uint8_t*) allocator_allocate(alloc, size + 1, 8);
+    for(isize i = 0; i < size; i++)
+        input[i] = compressible ? (uint8_t) "abcabdabe"[(i/3 + i/101) % 9] : (uint8_t) random_u64();
+
+    isize bound = slz4_parallel_compressed_size_upper_bound(size, block_size);
+    uint8_t* compressed = (uint8_t*) allocator_allocate(alloc, bound, 8);
+    isize compressed_size = slz4_parallel_compress(compressed, bound, input, size, block_size, thread_count);
+    TEST(0 < compressed_size && compressed_size <= bound);
+    if(compressible && size > 1000)
+        TEST(compressed_size < size/2);
+
+    //Compressing into a buffer that only fits the result takes the other path but must produce the same thing
+    uint8_t* exact = (uint8_t*) allocator_allocate(alloc, compressed_size, 8);
+    TEST(slz4_parallel_compress(exact, compressed_size, input, size, block_size, thread_count) == compressed_size);
+    TEST(memcmp(exact, compressed, compressed_size) == 0);
+    if(compressed_size > 40)
+        TEST(slz4_parallel_compress(exact, compressed_size - 1, input, size, block_size, thread_count) == SLZ4_ERROR_OUTPUT_TOO_SMALL);
+
+    SLZ4_Parallel_Header header = {0};
+    TEST(slz4_parallel_decompressed_size(compressed, compressed_size, &header) == size);
+    TEST(header.block_count == (size + header.block_size - 1)/header.block_size);
+
+    memset(output, 0, size);
+    TEST(slz4_parallel_decompress(output, size, compressed, compressed_size, thread_count) == size);
+    TEST(memcmp(input, output, size) == 0);
+    if(size > 0)
+        TEST(slz4_parallel_decompress(output, size - 1, compressed, compressed_size, thread_count) == SLZ4_ERROR_OUTPUT_TOO_SMALL);
+
+    _Test_SLZ4_Parallel_Stream stream = {input, 0, -1};
+    TEST(slz4_parallel_decompress_stream(compressed, compressed_size, _test_slz4_parallel_consumer, &stream, thread_count) == size);
+    TEST(stream.next_offset == size);
+
+    //Stopping early
+    if(size > (isize) header.block_size) {
+        _Test_SLZ4_Parallel_Stream stopped = {input, 0, header.block_size};
+        TEST(slz4_parallel_decompress_stream(compressed, compressed_size, _test_slz4_parallel_consumer, &stopped, thread_count) == header.block_size);
+    }
+
+    //Random ranges including empty ones, ones within a block and ones on the edges
+    for(isize i = 0; i < 50 && size > 0; i++) {
+        isize from = random_range(0, size + 1);
+        isize to = random_range(from, size + 1);
+        if(i == 0) from = 0, to = size;
+        if(i == 1) from = to;
+
+        memset(output, 0, size);
+        TEST(slz4_parallel_decompress_range(output, from, to - from, compressed, compressed_size) == to - from);
+        TEST(memcmp(input + from, output, to - from) == 0);
+    }
+    TEST(slz4_parallel_decompress_range(output, 0, size + 1, compressed, compressed_size) == SLZ4_ERROR_INVALID_PARAMS);
+
+    //Corruption is detected and does not crash
+    if(size > 0) {
+        TEST(slz4_parallel_decompressed_size(compressed, compressed_size - 1, NULL) == SLZ4_ERROR_INVALID_PARAMS);
+        TEST(slz4_parallel_decompress(output, size, compressed, sizeof(SLZ4_Parallel_Header) - 1, thread_count) == SLZ4_ERROR_INVALID_PARAMS);
+
+        memcpy(exact, compressed, compressed_size);
+        exact[0] ^= 1;
+        TEST(slz4_parallel_decompress(output, size, exact, compressed_size, thread_count) == SLZ4_ERROR_INVALID_PARAMS);
+
+        //Blocks larger than the compressor ever writes are rejected before anything is sized from them
+        memcpy(exact, compressed, compressed_size);
+        SLZ4_Parallel_Header huge = header;
+        huge.block_size = SLZ4_MAX_SIZE/2 + 1;
+        memcpy(exact, &huge, sizeof huge);
+        TEST(slz4_parallel_decompressed_size(exact, compressed_size, NULL) == SLZ4_ERROR_INVALID_PARAMS);
+        TEST(slz4_parallel_decompress(output, size, exact, compressed_size, thread_count) == SLZ4_ERROR_INVALID_PARAMS);
+
+        //Point the last block outside of the container
+        memcpy(exact, compressed, compressed_size);
+        uint64_t bad_offset = (uint64_t) compressed_size;
+        memcpy(exact + compressed_size - sizeof(SLZ4_Parallel_Block), &bad_offset, sizeof bad_offset);
+        TEST(slz4_parallel_decompress(output, size, exact, compressed_size, thread_count) == SLZ4_ERROR_INVALID_PARAMS);
+        _Test_SLZ4_Parallel_Stream corrupted = {input, 0, -1};
+        TEST(slz4_parallel_decompress_stream(exact, compressed_size, _test_slz4_parallel_consumer, &corrupted, thread_count) == SLZ4_ERROR_INVALID_PARAMS);
+    }
+
+    allocator_deallocate(alloc, exact, compressed_size, 8);
+    allocator_deallocate(alloc, compressed, bound, 8);
+    allocator_deallocate(alloc, output, size + 1, 8);
+    allocator_deallocate(alloc, input, size + 1, 8);
+}
+
+//Stops the stream after a few blocks while many more are in flight. Workers waiting for a ring slot must
+// still notice the stop and exit so that this does not hang.
+INTERNAL void test_slz4_parallel_stop_early(isize repeats)
+{
+    enum {SIZE = 1 << 20, BLOCK = 4096};
+    Allocator* alloc = allocator_get_default();
+    uint8_t* input = (uint8_t*) allocator_allocate(alloc, SIZE, 8);
+    for(isize i = 0; i < SIZE; i++)
+        input[i] = (uint8_t) "abcabdabe"[(i/3 + i/101) % 9];
+
+    isize bound = slz4_parallel_compressed_size_upper_bound(SIZE, BLOCK);
+    uint8_t* compressed = (uint8_t*) allocator_allocate(alloc, bound, 8);
+    isize compressed_size = slz4_parallel_compress(compressed, bound, input, SIZE, BLOCK, 0);
+    TEST(compressed_size > 0);
+
+    for(isize r = 0; r < repeats; r++) {
+        isize thread_count = 2 + r % 7;
+        isize stop_blocks = 1 + r % 5;
+        _Test_SLZ4_Parallel_Stream stopped = {input, 0, stop_blocks*BLOCK};
+        TEST(slz4_parallel_decompress_stream(compressed, compressed_size, _test_slz4_parallel_consumer, &stopped, thread_count) == stop_blocks*BLOCK);
+        TEST(stopped.next_offset == stop_blocks*BLOCK);
+    }
+
+    allocator_deallocate(alloc, compressed, bound, 8);
+    allocator_deallocate(alloc, input, SIZE, 8);
+}
+
+INTERNAL void test_slz4_parallel()
+{
+    test_slz4_parallel_stop_early(500);
+
+    isize sizes[] = {0, 1, 100, 4096, 4097, 3*4096 - 7, 100000, 1 << 20};
+    isize thread_counts[] = {1, 3, 8};
+    for(isize s = 0; s < ARRAY_COUNT(sizes); s++)
+        for(isize t = 0; t < ARRAY_COUNT(thread_counts); t++) {
+            test_slz4_parallel_single(sizes[s], 4096, thread_counts[t], true);
+            test_slz4_parallel_single(sizes[s], 4096, thread_counts[t], false);
+        }
+
+    test_slz4_parallel_single(3 << 20, 0, 0, true);
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "../sort_external.h"
+#include "../allocator_debug.h"
+#include "../random.h"
+
+#define SORT_EXTERNAL_TEST_INPUT  "__sort_external_test_input__.bin"
+#define SORT_EXTERNAL_TEST_OUTPUT "__sort_external_test_output__.bin"
+
+typedef struct _Sort_External_Test_Item {
+    uint64_t key;
+    uint64_t index;
+} _Sort_External_Test_Item;
+
+INTERNAL bool _sort_external_test_item_less(const void* a, const void* b, void* context)
+{
+    (void) context;
+    return ((const _Sort_External_Test_Item*) a)->key < ((const _Sort_External_Test_Item*) b)->key;
+}
+
+INTERNAL Platform_String _sort_external_test_string(const char* path)
+{
+    Platform_String out = {path, (isize) strlen(path)};
+    return out;
+}
+
+//Writes count items to the input file, sorts it with the given options and checks that the output
+// is sorted and contains every item exactly once.
+INTERNAL void test_sort_external_file(isize count, isize key_range, External_Sort_Options options)
+{
+    Debug_Allocator debug = debug_allocator_make(allocator_get_default(), DEBUG_ALLOC_LEAK_CHECK);
+    {
+        Platform_String input_path = _sort_external_test_string(SORT_EXTERNAL_TEST_INPUT);
+        Platform_String output_path = _sort_external_test_string(SORT_EXTERNAL_TEST_OUTPUT);
+        isize size = count*(isize) sizeof(_Sort_External_Test_Item);
+        _Sort_External_Test_Item* items = (_Sort_External_Test_Item*) allocator_allocate(debug.alloc, size + 1, 8);
+        uint8_t* seen = (uint8_t*) allocator_allocate(debug.alloc, count + 1, 1);
+        memset(seen, 0, count + 1);
+        for(isize i = 0; i < count; i++) {
+            items[i].key = random_u64() % (uint64_t) key_range;
+            items[i].index = (uint64_t) i;
+        }
+
+        Platform_File file = {0};
+        TEST(platform_file_open(&file, input_path, PLATFORM_FILE_OPEN_WRITE | PLATFORM_FILE_OPEN_CREATE | PLATFORM_FILE_OPEN_REMOVE_CONTENT) == 0);
+        TEST(platform_file_write(&file, items, size, 0) == 0);
+        platform_file_close(&file);
+
+        options.allocator_or_null = debug.alloc;
+        External_Sort_Stats stats = {0};
+        External_Sort_Error error = external_sort_file(output_path, input_path, sizeof(_Sort_External_Test_Item), _sort_external_test_item_less, NULL, &options, &stats, NULL);
+        TEST(error == EXTERNAL_SORT_OK, "%s", external_sort_error_to_string(error));
+        TEST(stats.item_count == count);
+
+        isize output_size = -1;
+        memset(items, 0, size);
+        TEST(platform_file_open(&file, output_path, PLATFORM_FILE_OPEN_READ) == 0);
+        TEST(platform_file_size(&file, &output_size) == 0);
+        TEST(output_size == size);
+        TEST(platform_file_read(&file, items, size, 0, NULL) == 0);
+        platform_file_close(&file);
+
+        for(isize i = 0; i < count; i++) {
+            if(i > 0)
+                TEST(items[i - 1].key <= items[i].key);
+            TEST(items[i].index < (uint64_t) count);
+            TEST(seen[items[i].index] == 0);
+            seen[items[i].index] = 1;
+        }
+
+        platform_file_remove(input_path, false);
+        platform_file_remove(output_path, false);
+        allocator_deallocate(debug.alloc, seen, count + 1, 1);
+        allocator_deallocate(debug.alloc, items, size + 1, 8);
+    }
+    debug_allocator_deinit(&debug);
+}
+
+INTERNAL void test_sort_external()
+{
+    //Small budget and blocks so that there are many runs and several merge passes
+    External_Sort_Options small = {0};
+    small.memory_budget = 64 << 10;
+    small.block_size = 4 << 10;
+
+    isize io_threads[] = {-1, 0, 3};
+    for(isize t = 0; t < ARRAY_COUNT(io_threads); t++)
+        for(isize compress = 0; compress < 2; compress++) {
+            External_Sort_Options options = small;
+            options.io_threads = io_threads[t];
+            options.compress_runs = compress != 0;
+            test_sort_external_file(0, 10, options);
+            test_sort_external_file(1, 10, options);
+            test_sort_external_file(1000, 10, options);
+            test_sort_external_file(200000, 1000, options);
+            test_sort_external_file(200000, 1ll << 62, options);
+        }
+
+    //Everything in a single run
+    External_Sort_Options single = {0};
+    single.memory_budget = 16 << 20;
+    test_sort_external_file(10000, 1 << 20, single);
+
+    //Errors
+    {
+        Platform_String input_path = _sort_external_test_string(SORT_EXTERNAL_TEST_INPUT);
+        Platform_String output_path = _sort_external_test_string(SORT_EXTERNAL_TEST_OUTPUT);
+        Platform_String missing_path = _sort_external_test_string("__sort_external_test_missing__.bin");
+        Platform_Error platform_error = 0;
+        TEST(external_sort_file(output_path, missing_path, 16, _sort_external_test_item_less, NULL, NULL, NULL, &platform_error) == EXTERNAL_SORT_ERROR_IO);
+        TEST(platform_error != 0);
+
+        Platform_File file = {0};
+        TEST(platform_file_open(&file, input_path, PLATFORM_FILE_OPEN_WRITE | PLATFORM_FILE_OPEN_CREATE | PLATFORM_FILE_OPEN_REMOVE_CONTENT) == 0);
+        TEST(platform_file_write(&file, "0123456789", 10, 0) == 0);
+        platform_file_close(&file);
+        TEST(external_sort_file(output_path, input_path, 16, _sort_external_test_item_less, NULL, NULL, NULL, NULL) == EXTERNAL_SORT_ERROR_INVALID);
+
+        External_Sort_Options tiny = {0};
+        tiny.memory_budget = 1024;
+        tiny.block_size = 1024;
+        TEST(external_sort_file(output_path, input_path, 5, _sort_external_test_item_less, NULL, &tiny, NULL, NULL) == EXTERNAL_SORT_ERROR_INVALID);
+
+        platform_file_remove(input_path, false);
+        platform_file_remove(output_path, false);
+    }
+}
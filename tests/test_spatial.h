@@ -0,0 +1,311 @@
+#pragma once
+
+#include "../spatial.h"
+#include "../random.h"
+#include "../allocator_debug.h"
+
+typedef struct _Test_Spatial_Found {
+    isize* counts;          //number of items found per query
+    uint64_t* sums;         //order independent checksum of the found items per query
+    isize stop_after;       //-1 for never
+} _Test_Spatial_Found;
+
+INTERNAL uint64_t _test_spatial_item_hash(isize index)
+{
+    return ((uint64_t) index + 1)*0x9E3779B97F4A7C15ull;
+}
+
+INTERNAL bool _test_spatial_found(void* context, isize query, isize index)
+{
+    _Test_Spatial_Found* found = (_Test_Spatial_Found*) context;
+    found->counts[query] += 1;
+    found->sums[query] += _test_spatial_item_hash(index);
+    return found->stop_after < 0 || found->counts[query] < found->stop_after;
+}
+
+INTERNAL float _test_spatial_dist_sq(Vec3 a, Vec3 b)
+{
+    Vec3 d = vec3_sub(a, b);
+    return d.x*d.x + d.y*d.y + d.z*d.z;
+}
+
+//Points in clusters of various density so that both the sparse and the dense parts get exercised
+INTERNAL Vec3* _test_spatial_points(isize count, bool identical)
+{
+    Vec3* points = (Vec3*) allocator_allocate(allocator_get_default(), (count + 1)*sizeof(Vec3), 4);
+    for(isize i = 0; i < count; i++) {
+        if(identical)
+            points[i] = vec3(0.5f, -2, 3);
+        else if(i % 3 == 0)
+            points[i] = vec3(random_range_f32(-10, 10), random_range_f32(-10, 10), random_range_f32(-10, 10));
+        else
+            points[i] = vec3(random_range_f32(0, 0.5f), random_range_f32(0, 2), random_range_f32(-1, 0));
+    }
+    return points;
+}
+
+typedef struct _Test_Spatial_Spheres {
+    const Vec3* centers;
+    float radius;
+} _Test_Spatial_Spheres;
+
+INTERNAL float _test_spatial_hit_sphere(void* context, isize index, Spatial_Ray ray)
+{
+    _Test_Spatial_Spheres* spheres = (_Test_Spatial_Spheres*) context;
+    Vec3 oc = vec3_sub(ray.origin, spheres->centers[index]);
+    float a = vec3_dot(ray.dir, ray.dir);
+    float b = vec3_dot(oc, ray.dir);
+    float c = vec3_dot(oc, oc) - spheres->radius*spheres->radius;
+    float disc = b*b - a*c;
+    if(disc < 0)
+        return INFINITY;
+    float t = (-b - sqrtf(disc))/a;
+    if(t < 0)
+        t = (-b + sqrtf(disc))/a;
+    return t;
+}
+
+INTERNAL void test_spatial_bvh(isize count, isize thread_count, bool identical)
+{
+    Debug_Allocator debug = debug_allocator_make(allocator_get_default(), DEBUG_ALLOC_LEAK_CHECK);
+    {
+        enum {QUERIES = 200};
+        Vec3* centers = _test_spatial_points(count, identical);
+        _Test_Spatial_Spheres spheres = {centers, 0.05f};
+        Aabb* boxes = (Aabb*) allocator_allocate(allocator_get_default(), (count + 1)*sizeof(Aabb), 4);
+        for(isize i = 0; i < count; i++)
+            boxes[i] = aabb_from_sphere(centers[i], spheres.radius);
+
+        Spatial_BVH bvh = {0};
+        spatial_bvh_build(&bvh, debug.alloc, boxes, count, thread_count);
+        TEST(bvh.count == count);
+
+        //Every item is in exactly one leaf and every child box contains the boxes under it
+        isize* seen = (isize*) allocator_allocate(allocator_get_default(), (count + 1)*sizeof(isize), 8);
+        memset(seen, 0, (count + 1)*sizeof(isize));
+        for(isize n = 0; n < bvh.node_count; n++)
+            for(isize c = 0; c < 4; c++) {
+                int32_t child = bvh.nodes[n].children[c];
+                if(child >= 0) {
+                    TEST(child > n && child < bvh.node_count);
+                    continue;
+                }
+                uint32_t leaf = ~(uint32_t) child;
+                for(isize i = leaf >> 4; i < (isize) (leaf >> 4) + (isize) (leaf & 15); i++) {
+                    seen[bvh.indices[i]] += 1;
+                    TEST(bvh.nodes[n].min_x[c] <= bvh.boxes[i].min.x && bvh.boxes[i].max.z <= bvh.nodes[n].max_z[c]);
+                }
+            }
+        for(isize i = 0; i < count; i++)
+            TEST(seen[i] == 1);
+
+        //Raycasts against brute force
+        Spatial_Ray rays[QUERIES];
+        Spatial_Hit hits[QUERIES];
+        for(isize q = 0; q < QUERIES; q++) {
+            rays[q].origin = vec3(random_range_f32(-12, 12), random_range_f32(-12, 12), random_range_f32(-12, 12));
+            rays[q].dir = vec3(random_range_f32(-1, 1), random_range_f32(-1, 1), random_range_f32(-1, 1));
+            rays[q].t_max = q % 4 == 0 ? 5.0f : INFINITY;
+            //Some rays aimed straight at an item, some along an axis
+            if(q % 7 == 0)
+                rays[q].dir = vec3(0, 0, 1);
+            else if(q % 2 == 0 && count > 0)
+                rays[q].dir = vec3_sub(centers[random_range(0, count)], rays[q].origin);
+        }
+        spatial_bvh_raycast_batch(&bvh, rays, QUERIES, _test_spatial_hit_sphere, &spheres, hits, thread_count);
+        for(isize q = 0; q < QUERIES; q++) {
+            Spatial_Hit expected = {-1, rays[q].t_max};
+            for(isize i = 0; i < count; i++) {
+                float t = _test_spatial_hit_sphere(&spheres, i, rays[q]);
+                if(t >= 0 && t < expected.t)
+                    expected.t = t, expected.index = i;
+            }
+            Spatial_Hit single = spatial_bvh_raycast(&bvh, rays[q], _test_spatial_hit_sphere, &spheres);
+            TEST(single.t == expected.t && (single.index == expected.index || expected.index >= 0));
+            TEST(hits[q].t == single.t && hits[q].index == single.index);
+            if(q % 7 != 0 && q % 2 == 0 && count > 0 && rays[q].t_max == INFINITY)
+                TEST(hits[q].index >= 0);
+        }
+
+        //Box queries against brute force
+        Aabb queries[QUERIES];
+        isize counts[QUERIES] = {0};
+        uint64_t sums[QUERIES] = {0};
+        for(isize q = 0; q < QUERIES; q++) {
+            Vec3 center = q % 2 == 0 && count > 0 ? centers[random_range(0, count)] : vec3(random_range_f32(-10, 10), random_range_f32(-10, 10), random_range_f32(-10, 10));
+            queries[q] = aabb_from_sphere(center, q % 3 == 0 ? 2.0f : 0.1f);
+        }
+        _Test_Spatial_Found found = {counts, sums, -1};
+        spatial_bvh_query_aabb_batch(&bvh, queries, QUERIES, _test_spatial_found, &found, thread_count);
+        for(isize q = 0; q < QUERIES; q++) {
+            isize expected_count = 0;
+            uint64_t expected_sum = 0;
+            for(isize i = 0; i < count; i++)
+                if(aabb_overlaps(boxes[i], queries[q]))
+                    expected_count += 1, expected_sum += _test_spatial_item_hash(i);
+            TEST(counts[q] == expected_count && sums[q] == expected_sum);
+
+            //Stopping after the first item
+            counts[q] = 0;
+            _Test_Spatial_Found first = {counts, sums, 1};
+            TEST(spatial_bvh_query_aabb(&bvh, queries[q], _test_spatial_found, &first) == (expected_count == 0));
+        }
+
+        spatial_bvh_deinit(&bvh);
+        allocator_deallocate(allocator_get_default(), seen, (count + 1)*sizeof(isize), 8);
+        allocator_deallocate(allocator_get_default(), boxes, (count + 1)*sizeof(Aabb), 4);
+        allocator_deallocate(allocator_get_default(), centers, (count + 1)*sizeof(Vec3), 4);
+    }
+    debug_allocator_deinit(&debug);
+}
+
+INTERNAL void _test_spatial_radius_expected(const Vec3* points, isize count, Vec3 center, float radius, isize* expected_count, uint64_t* expected_sum)
+{
+    *expected_count = 0;
+    *expected_sum = 0;
+    for(isize i = 0; i < count; i++)
+        if(_test_spatial_dist_sq(points[i], center) <= radius*radius)
+            *expected_count += 1, *expected_sum += _test_spatial_item_hash(i);
+}
+
+INTERNAL void test_spatial_grid(isize count, isize thread_count, float cell_size, bool identical)
+{
+    Debug_Allocator debug = debug_allocator_make(allocator_get_default(), DEBUG_ALLOC_LEAK_CHECK);
+    {
+        enum {QUERIES = 200};
+        Vec3* points = _test_spatial_points(count, identical);
+        Spatial_Grid grid = {0};
+        spatial_grid_init(&grid, debug.alloc, cell_size);
+
+        //Rebuilding after the points move must give the same results as a fresh grid
+        for(isize step = 0; step < 3; step++)
+        {
+            if(step > 0)
+                for(isize i = 0; i < count; i++)
+                    points[i] = vec3_add(points[i], vec3(random_range_f32(-0.5f, 0.5f), random_range_f32(-0.5f, 0.5f), 0.1f));
+            spatial_grid_build(&grid, points, step == 2 ? count/2 : count);
+            isize built = grid.count;
+
+            Vec3 centers[QUERIES];
+            float radius = step == 1 ? 3.0f : 0.2f;
+            isize counts[QUERIES] = {0};
+            uint64_t sums[QUERIES] = {0};
+            for(isize q = 0; q < QUERIES; q++)
+                centers[q] = q % 2 == 0 && built > 0 ? points[random_range(0, built)] : vec3(random_range_f32(-10, 10), random_range_f32(-10, 10), random_range_f32(-10, 10));
+            _Test_Spatial_Found found = {counts, sums, -1};
+            spatial_grid_query_radius_batch(&grid, centers, QUERIES, radius, _test_spatial_found, &found, thread_count);
+
+            for(isize q = 0; q < QUERIES; q++) {
+                isize expected_count = 0;
+                uint64_t expected_sum = 0;
+                _test_spatial_radius_expected(points, built, centers[q], radius, &expected_count, &expected_sum);
+                TEST(counts[q] == expected_count && sums[q] == expected_sum);
+
+                counts[q] = 0;
+                _Test_Spatial_Found first = {counts, sums, 1};
+                TEST(spatial_grid_query_radius(&grid, centers[q], radius, _test_spatial_found, &first) == (expected_count == 0));
+            }
+        }
+
+        spatial_grid_deinit(&grid);
+        allocator_deallocate(allocator_get_default(), points, (count + 1)*sizeof(Vec3), 4);
+    }
+    debug_allocator_deinit(&debug);
+}
+
+INTERNAL void test_spatial_kd_tree(isize count, isize thread_count, bool identical)
+{
+    Debug_Allocator debug = debug_allocator_make(allocator_get_default(), DEBUG_ALLOC_LEAK_CHECK);
+    {
+        enum {QUERIES = 100, K = 20};
+        Vec3* points = _test_spatial_points(count, identical);
+        float* dists = (float*) allocator_allocate(allocator_get_default(), (count + 1)*sizeof(float), 4);
+
+        Spatial_KD_Tree tree = {0};
+        spatial_kd_tree_build(&tree, debug.alloc, points, count, thread_count);
+        TEST(tree.count == count);
+
+        Vec3 queries[QUERIES];
+        for(isize q = 0; q < QUERIES; q++)
+            queries[q] = q % 2 == 0 && count > 0 ? points[random_range(0, count)] : vec3(random_range_f32(-12, 12), random_range_f32(-12, 12), random_range_f32(-12, 12));
+
+        isize ks[] = {1, 3, K};
+        for(isize ki = 0; ki < ARRAY_COUNT(ks); ki++) {
+            isize k = ks[ki];
+            Spatial_Neighbor neighbors[QUERIES*K];
+            spatial_kd_tree_knn_batch(&tree, queries, QUERIES, k, neighbors, thread_count);
+            for(isize q = 0; q < QUERIES; q++) {
+                //The k smallest distances by brute force
+                for(isize i = 0; i < count; i++)
+                    dists[i] = _test_spatial_dist_sq(points[i], queries[q]);
+                isize expected_found = MIN(k, count);
+                for(isize j = 0; j < expected_found; j++) {
+                    isize best = j;
+                    for(isize i = j + 1; i < count; i++)
+                        if(dists[i] < dists[best])
+                            best = i;
+                    float temp = dists[j]; dists[j] = dists[best]; dists[best] = temp;
+                }
+
+                Spatial_Neighbor single[K];
+                TEST(spatial_kd_tree_knn(&tree, queries[q], k, single) == expected_found);
+                for(isize j = 0; j < k; j++) {
+                    Spatial_Neighbor got = neighbors[q*k + j];
+                    if(j >= expected_found) {
+                        TEST(got.index == -1);
+                        continue;
+                    }
+                    TEST(got.dist_sq == dists[j]);
+                    TEST(got.dist_sq == _test_spatial_dist_sq(points[got.index], queries[q]));
+                    TEST(single[j].dist_sq == got.dist_sq);
+                    for(isize l = 0; l < j; l++)
+                        TEST(neighbors[q*k + l].index != got.index);
+                }
+            }
+        }
+
+        for(isize q = 0; q < QUERIES; q++) {
+            float radius = q % 3 == 0 ? 4.0f : 0.3f;
+            isize counts[1] = {0};
+            uint64_t sums[1] = {0};
+            _Test_Spatial_Found found = {counts, sums, -1};
+            TEST(spatial_kd_tree_query_radius(&tree, queries[q], radius, _test_spatial_found, &found));
+
+            isize expected_count = 0;
+            uint64_t expected_sum = 0;
+            _test_spatial_radius_expected(points, count, queries[q], radius, &expected_count, &expected_sum);
+            TEST(counts[0] == expected_count && sums[0] == expected_sum);
+
+            counts[0] = 0;
+            _Test_Spatial_Found first = {counts, sums, 1};
+            TEST(spatial_kd_tree_query_radius(&tree, queries[q], radius, _test_spatial_found, &first) == (expected_count == 0));
+        }
+
+        spatial_kd_tree_deinit(&tree);
+        allocator_deallocate(allocator_get_default(), dists, (count + 1)*sizeof(float), 4);
+        allocator_deallocate(allocator_get_default(), points, (count + 1)*sizeof(Vec3), 4);
+    }
+    debug_allocator_deinit(&debug);
+}
+
+INTERNAL void test_spatial()
+{
+    isize counts[] = {0, 1, 4, 5, 17, 1000, 20000};
+    isize thread_counts[] = {1, 4};
+    for(isize c = 0; c < ARRAY_COUNT(counts); c++)
+        for(isize t = 0; t < ARRAY_COUNT(thread_counts); t++) {
+            test_spatial_bvh(counts[c], thread_counts[t], false);
+            test_spatial_grid(counts[c], thread_counts[t], 0.25f, false);
+            test_spatial_kd_tree(counts[c], thread_counts[t], false);
+        }
+
+    //Only ranges of at least 1 << 16 items are binned by multiple threads
+    test_spatial_bvh(70000, 4, false);
+
+    //Degenerate inputs: all points in one place, cells much smaller and much bigger than the queries
+    test_spatial_bvh(1000, 4, true);
+    test_spatial_grid(1000, 4, 0.25f, true);
+    test_spatial_kd_tree(1000, 4, true);
+    test_spatial_grid(5000, 1, 0.001f, false);
+    test_spatial_grid(5000, 1, 50.0f, false);
+}
@@ -301,5 +301,6 @@ static int test_spmc_isize_comp_func(const void* a, const void* b)
         int error = pthread_create(&handle, &attr, test_spmc_launch_caster, func_and_context);
         pthread_attr_destroy(&attr);
         assert(error == 0);
+        (void) error;
     }
 #endif
\ No newline at end of file
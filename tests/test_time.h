@@ -0,0 +1,87 @@
+#pragma once
+
+#include "../time.h"
+#include "../platform.h"
+#include "../log.h"
+#include "bench.h"
+
+//Measures the difference between clock_ns and the OS clock (platform_perf_counter) as precisely as we can.
+INTERNAL int64_t _test_clock_offset()
+{
+    int64_t best_offset = 0;
+    int64_t best_window = INT64_MAX;
+    for(isize i = 0; i < 16; i++) {
+        int64_t before = platform_perf_counter();
+        int64_t clock = clock_ns();
+        int64_t after = platform_perf_counter();
+        if(after - before < best_window) {
+            best_window = after - before;
+            best_offset = clock - (before + (after - before)/2);
+        }
+    }
+    return best_offset;
+}
+
+INTERNAL void test_time(f64 max_seconds)
+{
+    (void) max_seconds;
+    //Monotonic within a single thread
+    int64_t prev = clock_ns();
+    for(isize i = 0; i < 1000000; i++) {
+        int64_t now = clock_ns();
+        TEST(now >= prev);
+        prev = now;
+    }
+
+    //Does not drift away from the OS clock. We sleep past CLOCK_TSC_RESYNC_NS so the resync is exercised as well.
+    int64_t max_drift = 200*1000;
+    int64_t start_offset = _test_clock_offset();
+    for(isize i = 0; i < 7; i++) {
+        platform_thread_sleep(0.1);
+        int64_t drift = _test_clock_offset() - start_offset;
+        TEST(-max_drift < drift && drift < max_drift, "clock_ns drifted by %lli ns (tsc frequency %lli)", (long long) drift, (long long) clock_tsc_frequency());
+    }
+
+    //A caller that comes back only after several resync intervals must not get the correction applied over the whole gap
+    {
+        int64_t before = clock_ns();
+        platform_thread_sleep(1.3);
+        TEST(clock_ns() >= before);
+        int64_t drift = _test_clock_offset() - start_offset;
+        TEST(-max_drift < drift && drift < max_drift, "clock_ns drifted by %lli ns after a sparse call (tsc frequency %lli)", (long long) drift, (long long) clock_tsc_frequency());
+    }
+
+    //clock_sec is built on top of clock_ticks so must agree with clock_ns
+    f64 sec_before = clock_sec();
+    int64_t ns_before = clock_ns();
+    platform_thread_sleep(0.01);
+    f64 sec_delta = clock_sec() - sec_before;
+    f64 ns_delta = (f64) (clock_ns() - ns_before)/1e9;
+    TEST(fabs(sec_delta - ns_delta) < 0.001);
+}
+
+//Cost of a single clock_ns call against the OS clock. Not part of the regular tests.
+INTERNAL void bench_time(f64 max_seconds)
+{
+    (void) max_seconds;
+    enum {CALLS = 10000000};
+    int64_t checksum = 0;
+
+    Bench_Time clock_time = {0};
+    Bench_Time os_time = {0};
+    for(isize r = 0; r < BENCH_REPEATS; r++) {
+        bench_time_start(&clock_time);
+        for(isize i = 0; i < CALLS; i++)
+            checksum += clock_ns();
+        bench_time_stop(&clock_time);
+
+        bench_time_start(&os_time);
+        for(isize i = 0; i < CALLS; i++)
+            checksum += platform_perf_counter();
+        bench_time_stop(&os_time);
+    }
+
+    bench_report(&clock_time, "time.clock_ns", 0, 1, CALLS, 0);
+    bench_report(&os_time, "time.os_clock", 0, 1, CALLS, 0);
+    LOG_INFO("BENCH", "tsc frequency %lli (%llx)", (long long) clock_tsc_frequency(), (long long) checksum);
+}
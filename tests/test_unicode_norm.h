@@ -0,0 +1,306 @@
+#pragma once
+
+#include "../unicode_norm.h"
+#include "../random.h"
+#include "../assert.h"
+
+typedef isize (*_Test_Unicode_Norm_Func)(void* output, isize output_size, const void* input, isize input_size);
+
+INTERNAL bool _test_unicode_norm_is(_Test_Unicode_Norm_Func func, const char* input, isize input_size, const char* expected)
+{
+    char output[256] = {0};
+    isize size = func(output, sizeof output, input, input_size);
+    return size == (isize) strlen(expected) && memcmp(output, expected, (size_t) size) == 0;
+}
+
+//Checks properties of a single input which must hold for every string: the outputs are in the form the quick checks
+// accept, NFC and NFD can be converted into each other, truncated outputs are prefixes of the full one and nothing
+// grows more than UNICODE_NORM_MAX_GROWTH times.
+INTERNAL void _test_unicode_norm_consistency(const char* input, isize input_size)
+{
+    enum {MAX = 512};
+    char nfc[MAX], nfd[MAX], folded[MAX], nfc_of_nfd[MAX], nfd_of_nfc[MAX], again[MAX], truncated[MAX];
+    ASSERT(input_size*UNICODE_NORM_MAX_GROWTH <= MAX);
+    isize nfc_size = unicode_nfc(nfc, MAX, input, input_size);
+    isize nfd_size = unicode_nfd(nfd, MAX, input, input_size);
+    isize folded_size = unicode_casefold(folded, MAX, input, input_size);
+    TEST(nfc_size <= input_size*UNICODE_NORM_MAX_GROWTH);
+    TEST(nfd_size <= input_size*UNICODE_NORM_MAX_GROWTH);
+    TEST(folded_size <= input_size*UNICODE_NORM_MAX_GROWTH);
+
+    TEST(unicode_nfc_quick_check(input, input_size) < input_size || (nfc_size == input_size && memcmp(nfc, input, (size_t) nfc_size) == 0));
+    TEST(unicode_nfd_quick_check(input, input_size) < input_size || (nfd_size == input_size && memcmp(nfd, input, (size_t) nfd_size) == 0));
+    TEST(unicode_casefold_quick_check(input, input_size) < input_size || (folded_size == input_size && memcmp(folded, input, (size_t) folded_size) == 0));
+    TEST(unicode_nfd_quick_check(nfd, nfd_size) == nfd_size);
+
+    TEST(unicode_nfc(nfc_of_nfd, MAX, nfd, nfd_size) == nfc_size && memcmp(nfc_of_nfd, nfc, (size_t) nfc_size) == 0);
+    TEST(unicode_nfd(nfd_of_nfc, MAX, nfc, nfc_size) == nfd_size && memcmp(nfd_of_nfc, nfd, (size_t) nfd_size) == 0);
+    TEST(unicode_nfc(again, MAX, nfc, nfc_size) == nfc_size && memcmp(again, nfc, (size_t) nfc_size) == 0);
+    TEST(unicode_nfd(again, MAX, nfd, nfd_size) == nfd_size && memcmp(again, nfd, (size_t) nfd_size) == 0);
+
+    if(nfc_size > 0) {
+        isize cut = random_range(0, nfc_size);
+        memset(truncated, 0x55, MAX);
+        TEST(unicode_nfc(truncated, cut, input, input_size) == nfc_size);
+        TEST(memcmp(truncated, nfc, (size_t) cut) == 0 && truncated[cut] == 0x55);
+    }
+    if(folded_size > 0) {
+        isize cut = random_range(0, folded_size);
+        memset(truncated, 0x55, MAX);
+        TEST(unicode_casefold(truncated, cut, input, input_size) == folded_size);
+        TEST(memcmp(truncated, folded, (size_t) cut) == 0 && truncated[cut] == 0x55);
+    }
+}
+
+INTERNAL void test_unicode_norm()
+{
+    //Generated by Python's unicodedata (Unicode 14.0) from random strings of interesting code points:
+    // input, NFC, NFD, full case folding
+    const char* vectors[][4] = {
+        {"\xd6\x91\xf0\x91\x82\xba\xe1\x85\xa1\xc3\x9f\x73\xe1\x85\xa1\xc3\x85\xe2\x84\xa6", "\xf0\x91\x82\xba\xd6\x91\xe1\x85\xa1\xc3\x9f\x73\xe1\x85\xa1\xc3\x85\xce\xa9", "\xf0\x91\x82\xba\xd6\x91\xe1\x85\xa1\xc3\x9f\x73\xe1\x85\xa1\x41\xcc\x8a\xce\xa9", "\xd6\x91\xf0\x91\x82\xba\xe1\x85\xa1\x73\x73\x73\xe1\x85\xa1\xc3\xa5\xcf\x89"},
+        {"\xc3\x9f\xe0\xbd\xb4\xe2\x84\xab\xe0\xad\x87\x6f\xe0\xad\x97\xd6\xb7", "\xc3\x9f\xe0\xbd\xb4\xc3\x85\xe0\xad\x87\x6f\xe0\xad\x97\xd6\xb7", "\xc3\x9f\xe0\xbd\xb4\x41\xcc\x8a\xe0\xad\x87\x6f\xe0\xad\x97\xd6\xb7", "\x73\x73\xe0\xbd\xb4\xc3\xa5\xe0\xad\x87\x6f\xe0\xad\x97\xd6\xb7"},
+        {"\xe3\x82\x9a\xe0\xad\x97", "\xe3\x82\x9a\xe0\xad\x97", "\xe3\x82\x9a\xe0\xad\x97", "\xe3\x82\x9a\xe0\xad\x97"},
+        {"\xea\xb0\x81\xc3\x9f\xe3\x81\x8b\x53\xe0\xbd\xb2\xe3\x81\x8b", "\xea\xb0\x81\xc3\x9f\xe3\x81\x8b\x53\xe0\xbd\xb2\xe3\x81\x8b", "\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8\xc3\x9f\xe3\x81\x8b\x53\xe0\xbd\xb2\xe3\x81\x8b", "\xea\xb0\x81\x73\x73\xe3\x81\x8b\x73\xe0\xbd\xb2\xe3\x81\x8b"},
+        {"\xe0\xbd\xb1\xcc\xa7\xe3\x81\x8b\xe1\xba\x9e", "\xe0\xbd\xb1\xcc\xa7\xe3\x81\x8b\xe1\xba\x9e", "\xe0\xbd\xb1\xcc\xa7\xe3\x81\x8b\xe1\xba\x9e", "\xe0\xbd\xb1\xcc\xa7\xe3\x81\x8b\x73\x73"},
+        {"\xe0\xad\x87\xcd\x84\xe0\xac\xbe", "\xe0\xad\x87\xcc\x88\xcc\x81\xe0\xac\xbe", "\xe0\xad\x87\xcc\x88\xcc\x81\xe0\xac\xbe", "\xe0\xad\x87\xcd\x84\xe0\xac\xbe"},
+        {"\xe1\x84\x80\xcc\x80\xe0\xbd\xb2\xe1\xba\x9e\x53", "\xe1\x84\x80\xe0\xbd\xb2\xcc\x80\xe1\xba\x9e\x53", "\xe1\x84\x80\xe0\xbd\xb2\xcc\x80\xe1\xba\x9e\x53", "\xe1\x84\x80\xcc\x80\xe0\xbd\xb2\x73\x73\x73"},
+        {"\x41\xe2\x84\xab", "\x41\xc3\x85", "\x41\x41\xcc\x8a", "\x61\xc3\xa5"},
+        {"\x73\x73", "\x73\x73", "\x73\x73", "\x73\x73"},
+        {"\xe2\x80\x80\x61\xcc\x80\xd6\x91\xe0\xbd\xb2", "\xe2\x80\x82\xc3\xa0\xe0\xbd\xb2\xd6\x91", "\xe2\x80\x82\x61\xe0\xbd\xb2\xd6\x91\xcc\x80", "\xe2\x80\x80\x61\xcc\x80\xd6\x91\xe0\xbd\xb2"},
+        {"\xd6\x91\xea\xb0\x80\xc3\x85\xe0\xa4\xbc", "\xd6\x91\xea\xb0\x80\xc3\x85\xe0\xa4\xbc", "\xd6\x91\xe1\x84\x80\xe1\x85\xa1\x41\xe0\xa4\xbc\xcc\x8a", "\xd6\x91\xea\xb0\x80\xc3\xa5\xe0\xa4\xbc"},
+        {"\x20\xe0\xbd\xb3\x73\xef\xac\x81\xea\xb0\x81\xe2\x84\xab\xf0\x9d\x85\x9e\xf0\x9d\x85\x9e", "\x20\xe0\xbd\xb1\xe0\xbd\xb2\x73\xef\xac\x81\xea\xb0\x81\xc3\x85\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\xf0\x9d\x85\x97\xf0\x9d\x85\xa5", "\x20\xe0\xbd\xb1\xe0\xbd\xb2\x73\xef\xac\x81\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8\x41\xcc\x8a\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\xf0\x9d\x85\x97\xf0\x9d\x85\xa5", "\x20\xe0\xbd\xb3\x73\x66\x69\xea\xb0\x81\xc3\xa5\xf0\x9d\x85\x9e\xf0\x9d\x85\x9e"},
+        {"\xe3\x81\x8b\xd6\xb0\xe3\x83\x8f", "\xe3\x81\x8b\xd6\xb0\xe3\x83\x8f", "\xe3\x81\x8b\xd6\xb0\xe3\x83\x8f", "\xe3\x81\x8b\xd6\xb0\xe3\x83\x8f"},
+        {"\xf0\x91\x82\xba\xcc\x88", "\xf0\x91\x82\xba\xcc\x88", "\xf0\x91\x82\xba\xcc\x88", "\xf0\x91\x82\xba\xcc\x88"},
+        {"\xe0\xad\x97\x73\xe1\xbe\x80\x61\xe0\xa5\x98\xd6\xb7", "\xe0\xad\x97\x73\xe1\xbe\x80\x61\xe0\xa4\x95\xe0\xa4\xbc\xd6\xb7", "\xe0\xad\x97\x73\xce\xb1\xcc\x93\xcd\x85\x61\xe0\xa4\x95\xe0\xa4\xbc\xd6\xb7", "\xe0\xad\x97\x73\xe1\xbc\x80\xce\xb9\x61\xe0\xa5\x98\xd6\xb7"},
+        {"\xce\xa3", "\xce\xa3", "\xce\xa3", "\xcf\x83"},
+        {"\x65", "\x65", "\x65", "\x65"},
+        {"\x61\x61\xe1\xbe\x80\xce\xa3\xc3\xa9\xe1\xbe\x80\xe0\xa5\x98\xc3\x87", "\x61\x61\xe1\xbe\x80\xce\xa3\xc3\xa9\xe1\xbe\x80\xe0\xa4\x95\xe0\xa4\xbc\xc3\x87", "\x61\x61\xce\xb1\xcc\x93\xcd\x85\xce\xa3\x65\xcc\x81\xce\xb1\xcc\x93\xcd\x85\xe0\xa4\x95\xe0\xa4\xbc\x43\xcc\xa7", "\x61\x61\xe1\xbc\x80\xce\xb9\xcf\x83\xc3\xa9\xe1\xbc\x80\xce\xb9\xe0\xa5\x98\xc3\xa7"},
+        {"\xcc\x9b\xe3\x82\x99\xcc\xa7", "\xe3\x82\x99\xcc\xa7\xcc\x9b", "\xe3\x82\x99\xcc\xa7\xcc\x9b", "\xcc\x9b\xe3\x82\x99\xcc\xa7"},
+        {"\xe1\x85\xa1", "\xe1\x85\xa1", "\xe1\x85\xa1", "\xe1\x85\xa1"},
+        {"\xe2\x84\xab", "\xc3\x85", "\x41\xcc\x8a", "\xc3\xa5"},
+        {"\xe3\x82\x9a\xe0\xa4\xbc", "\xe0\xa4\xbc\xe3\x82\x9a", "\xe0\xa4\xbc\xe3\x82\x9a", "\xe3\x82\x9a\xe0\xa4\xbc"},
+        {"\xe1\xba\x9e\x41\xd6\xb0\xe1\x85\xa1", "\xe1\xba\x9e\x41\xd6\xb0\xe1\x85\xa1", "\xe1\xba\x9e\x41\xd6\xb0\xe1\x85\xa1", "\x73\x73\x61\xd6\xb0\xe1\x85\xa1"},
+        {"\xf0\x9d\x85\x9e\xe2\x84\xa6\xcf\x83\xe1\x84\x80\xe0\xad\x87", "\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\xce\xa9\xcf\x83\xe1\x84\x80\xe0\xad\x87", "\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\xce\xa9\xcf\x83\xe1\x84\x80\xe0\xad\x87", "\xf0\x9d\x85\x9e\xcf\x89\xcf\x83\xe1\x84\x80\xe0\xad\x87"},
+        {"\xcd\x84\xc3\xa9\x61\xcc\x9b\x6f\xe3\x83\x8f\xea\xb0\x80", "\xcc\x88\xcc\x81\xc3\xa9\x61\xcc\x9b\x6f\xe3\x83\x8f\xea\xb0\x80", "\xcc\x88\xcc\x81\x65\xcc\x81\x61\xcc\x9b\x6f\xe3\x83\x8f\xe1\x84\x80\xe1\x85\xa1", "\xcd\x84\xc3\xa9\x61\xcc\x9b\x6f\xe3\x83\x8f\xea\xb0\x80"},
+        {"\xe2\x84\xab", "\xc3\x85", "\x41\xcc\x8a", "\xc3\xa5"},
+        {"\xe1\xba\x9e\x65\xe1\x84\x80\xe1\xbe\x80\xd6\x91\xe1\x85\xa1", "\xe1\xba\x9e\x65\xe1\x84\x80\xe1\xbe\x80\xd6\x91\xe1\x85\xa1", "\xe1\xba\x9e\x65\xe1\x84\x80\xce\xb1\xd6\x91\xcc\x93\xcd\x85\xe1\x85\xa1", "\x73\x73\x65\xe1\x84\x80\xe1\xbc\x80\xce\xb9\xd6\x91\xe1\x85\xa1"},
+        {"\x61", "\x61", "\x61", "\x61"},
+        {"\xe0\xa5\x98\x4b", "\xe0\xa4\x95\xe0\xa4\xbc\x4b", "\xe0\xa4\x95\xe0\xa4\xbc\x4b", "\xe0\xa5\x98\x6b"},
+        {"\xcd\x84", "\xcc\x88\xcc\x81", "\xcc\x88\xcc\x81", "\xcd\x84"},
+        {"\xc3\x85\xf0\x91\x82\xa5", "\xc3\x85\xf0\x91\x82\xa5", "\x41\xcc\x8a\xf0\x91\x82\xa5", "\xc3\xa5\xf0\x91\x82\xa5"},
+        {"\xd6\xb0\xe2\x80\x80\x53\xef\xac\x81\xef\xac\x81\xe3\x82\x99\xcf\x83\xe2\x84\xa6", "\xd6\xb0\xe2\x80\x82\x53\xef\xac\x81\xef\xac\x81\xe3\x82\x99\xcf\x83\xce\xa9", "\xd6\xb0\xe2\x80\x82\x53\xef\xac\x81\xef\xac\x81\xe3\x82\x99\xcf\x83\xce\xa9", "\xd6\xb0\xe2\x80\x80\x73\x66\x69\x66\x69\xe3\x82\x99\xcf\x83\xcf\x89"},
+        {"\xe0\xad\x97\xc3\x85\xcf\x83\xf0\x91\x82\xba", "\xe0\xad\x97\xc3\x85\xcf\x83\xf0\x91\x82\xba", "\xe0\xad\x97\x41\xcc\x8a\xcf\x83\xf0\x91\x82\xba", "\xe0\xad\x97\xc3\xa5\xcf\x83\xf0\x91\x82\xba"},
+        {"\xcc\xa7\xc4\xb0\x41", "\xcc\xa7\xc4\xb0\x41", "\xcc\xa7\x49\xcc\x87\x41", "\xcc\xa7\x69\xcc\x87\x61"},
+        {"\x7a\xce\xa3\xe2\x84\xa6\xe0\xa5\x98\xe3\x82\x9a\xea\xb0\x80\xe1\xba\x9e\xcc\x81", "\x7a\xce\xa3\xce\xa9\xe0\xa4\x95\xe0\xa4\xbc\xe3\x82\x9a\xea\xb0\x80\xe1\xba\x9e\xcc\x81", "\x7a\xce\xa3\xce\xa9\xe0\xa4\x95\xe0\xa4\xbc\xe3\x82\x9a\xe1\x84\x80\xe1\x85\xa1\xe1\xba\x9e\xcc\x81", "\x7a\xcf\x83\xcf\x89\xe0\xa5\x98\xe3\x82\x9a\xea\xb0\x80\x73\x73\xcc\x81"},
+        {"\xce\x99\xf0\x9d\x85\x9e\xe0\xbd\xb4\xcf\x83\x53\xe1\xba\x9e\x7a", "\xce\x99\xf0\x9d\x85\x97\xe0\xbd\xb4\xf0\x9d\x85\xa5\xcf\x83\x53\xe1\xba\x9e\x7a", "\xce\x99\xf0\x9d\x85\x97\xe0\xbd\xb4\xf0\x9d\x85\xa5\xcf\x83\x53\xe1\xba\x9e\x7a", "\xce\xb9\xf0\x9d\x85\x9e\xe0\xbd\xb4\xcf\x83\x73\x73\x73\x7a"},
+        {"\x41\xe0\xbd\xb2\xcf\x83\xcc\xa3\xe0\xad\x97\x61\xe3\x82\x99", "\x41\xe0\xbd\xb2\xcf\x83\xcc\xa3\xe0\xad\x97\x61\xe3\x82\x99", "\x41\xe0\xbd\xb2\xcf\x83\xcc\xa3\xe0\xad\x97\x61\xe3\x82\x99", "\x61\xe0\xbd\xb2\xcf\x83\xcc\xa3\xe0\xad\x97\x61\xe3\x82\x99"},
+        {"\xe1\x85\xa1\xc3\x9f\x6f\x4b\xe0\xac\xbe\xcc\x81", "\xe1\x85\xa1\xc3\x9f\x6f\x4b\xe0\xac\xbe\xcc\x81", "\xe1\x85\xa1\xc3\x9f\x6f\x4b\xe0\xac\xbe\xcc\x81", "\xe1\x85\xa1\x73\x73\x6f\x6b\xe0\xac\xbe\xcc\x81"},
+        {"\xcc\x80\xe0\xbd\xb3\xd6\x91\xcc\x81\xe2\x84\xa6\xe0\xa4\xbc", "\xe0\xbd\xb1\xe0\xbd\xb2\xd6\x91\xcc\x80\xcc\x81\xce\xa9\xe0\xa4\xbc", "\xe0\xbd\xb1\xe0\xbd\xb2\xd6\x91\xcc\x80\xcc\x81\xce\xa9\xe0\xa4\xbc", "\xcc\x80\xe0\xbd\xb3\xd6\x91\xcc\x81\xcf\x89\xe0\xa4\xbc"},
+        {"\xcc\xa7\xe0\xa5\x98\xe3\x82\x9a\xcd\x85\xcc\xa3", "\xcc\xa7\xe0\xa4\x95\xe0\xa4\xbc\xe3\x82\x9a\xcc\xa3\xcd\x85", "\xcc\xa7\xe0\xa4\x95\xe0\xa4\xbc\xe3\x82\x9a\xcc\xa3\xcd\x85", "\xcc\xa7\xe0\xa5\x98\xe3\x82\x9a\xce\xb9\xcc\xa3"},
+        {"\xe2\x84\xa6\x53\xe1\x85\xa1\xc3\x85\xe2\x84\xa6\x41\xe3\x82\x9a", "\xce\xa9\x53\xe1\x85\xa1\xc3\x85\xce\xa9\x41\xe3\x82\x9a", "\xce\xa9\x53\xe1\x85\xa1\x41\xcc\x8a\xce\xa9\x41\xe3\x82\x9a", "\xcf\x89\x73\xe1\x85\xa1\xc3\xa5\xcf\x89\x61\xe3\x82\x9a"},
+        {"\xe3\x81\x8b\xe3\x83\x8f\x73\xc3\x85", "\xe3\x81\x8b\xe3\x83\x8f\x73\xc3\x85", "\xe3\x81\x8b\xe3\x83\x8f\x73\x41\xcc\x8a", "\xe3\x81\x8b\xe3\x83\x8f\x73\xc3\xa5"},
+        {"\xe2\x80\x80\xcc\x9b\xe0\xac\xbe\xe3\x83\x8f", "\xe2\x80\x82\xcc\x9b\xe0\xac\xbe\xe3\x83\x8f", "\xe2\x80\x82\xcc\x9b\xe0\xac\xbe\xe3\x83\x8f", "\xe2\x80\x80\xcc\x9b\xe0\xac\xbe\xe3\x83\x8f"},
+        {"\xe3\x81\x8b\xcc\xa3\xcc\x9b\xc3\xa9\xf0\x9d\x85\x9e\xcc\x80\xd6\x91", "\xe3\x81\x8b\xcc\x9b\xcc\xa3\xc3\xa9\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\xd6\x91\xcc\x80", "\xe3\x81\x8b\xcc\x9b\xcc\xa3\x65\xcc\x81\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\xd6\x91\xcc\x80", "\xe3\x81\x8b\xcc\xa3\xcc\x9b\xc3\xa9\xf0\x9d\x85\x9e\xcc\x80\xd6\x91"},
+        {"\xe3\x81\x8b\xe0\xa4\xbc\xcd\x84\xe0\xbd\xb3\xce\x99", "\xe3\x81\x8b\xe0\xa4\xbc\xe0\xbd\xb1\xe0\xbd\xb2\xcc\x88\xcc\x81\xce\x99", "\xe3\x81\x8b\xe0\xa4\xbc\xe0\xbd\xb1\xe0\xbd\xb2\xcc\x88\xcc\x81\xce\x99", "\xe3\x81\x8b\xe0\xa4\xbc\xcd\x84\xe0\xbd\xb3\xce\xb9"},
+        {"\x65\xe0\xbd\xb1\xe1\x86\xa8\xf0\x9d\x85\x9e\xe1\x85\xa1", "\x65\xe0\xbd\xb1\xe1\x86\xa8\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\xe1\x85\xa1", "\x65\xe0\xbd\xb1\xe1\x86\xa8\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\xe1\x85\xa1", "\x65\xe0\xbd\xb1\xe1\x86\xa8\xf0\x9d\x85\x9e\xe1\x85\xa1"},
+        {"\xe1\x86\xa8\x4b\xe3\x81\x8b", "\xe1\x86\xa8\x4b\xe3\x81\x8b", "\xe1\x86\xa8\x4b\xe3\x81\x8b", "\xe1\x86\xa8\x6b\xe3\x81\x8b"},
+        {"\xe3\x83\x8f\xe1\xbe\x80\x7a\xcc\xa3\xe0\xbd\xb4\xd6\xb0", "\xe3\x83\x8f\xe1\xbe\x80\xe1\xba\x93\xd6\xb0\xe0\xbd\xb4", "\xe3\x83\x8f\xce\xb1\xcc\x93\xcd\x85\x7a\xd6\xb0\xe0\xbd\xb4\xcc\xa3", "\xe3\x83\x8f\xe1\xbc\x80\xce\xb9\x7a\xcc\xa3\xe0\xbd\xb4\xd6\xb0"},
+        {"\xe2\x80\x80\x7a\xe0\xbd\xb3", "\xe2\x80\x82\x7a\xe0\xbd\xb1\xe0\xbd\xb2", "\xe2\x80\x82\x7a\xe0\xbd\xb1\xe0\xbd\xb2", "\xe2\x80\x80\x7a\xe0\xbd\xb3"},
+        {"\x7a\xe2\x84\xa6\xe0\xbd\xb4", "\x7a\xce\xa9\xe0\xbd\xb4", "\x7a\xce\xa9\xe0\xbd\xb4", "\x7a\xcf\x89\xe0\xbd\xb4"},
+        {"\x53\x6f\xc3\x87\xe3\x81\x8b", "\x53\x6f\xc3\x87\xe3\x81\x8b", "\x53\x6f\x43\xcc\xa7\xe3\x81\x8b", "\x73\x6f\xc3\xa7\xe3\x81\x8b"},
+        {"\x4b\xd6\x91\xe1\xba\x9e", "\x4b\xd6\x91\xe1\xba\x9e", "\x4b\xd6\x91\xe1\xba\x9e", "\x6b\xd6\x91\x73\x73"},
+        {"\xe0\xad\x87", "\xe0\xad\x87", "\xe0\xad\x87", "\xe0\xad\x87"},
+        {"\xe0\xbd\xb3\xf0\x91\x82\xba\xc3\x87\xe2\x84\xa6\xe0\xbd\xb3", "\xf0\x91\x82\xba\xe0\xbd\xb1\xe0\xbd\xb2\xc3\x87\xce\xa9\xe0\xbd\xb1\xe0\xbd\xb2", "\xf0\x91\x82\xba\xe0\xbd\xb1\xe0\xbd\xb2\x43\xcc\xa7\xce\xa9\xe0\xbd\xb1\xe0\xbd\xb2", "\xe0\xbd\xb3\xf0\x91\x82\xba\xc3\xa7\xcf\x89\xe0\xbd\xb3"},
+        {"\xc3\xa9\xe0\xac\xbe", "\xc3\xa9\xe0\xac\xbe", "\x65\xcc\x81\xe0\xac\xbe", "\xc3\xa9\xe0\xac\xbe"},
+        {"\xcf\x83\x53\xef\xac\x81\x7a", "\xcf\x83\x53\xef\xac\x81\x7a", "\xcf\x83\x53\xef\xac\x81\x7a", "\xcf\x83\x73\x66\x69\x7a"},
+        {"\xe0\xac\xbe\xe1\x85\xa1\xcc\x9b\xe0\xac\xbe\x65\xc3\xa9\x41", "\xe0\xac\xbe\xe1\x85\xa1\xcc\x9b\xe0\xac\xbe\x65\xc3\xa9\x41", "\xe0\xac\xbe\xe1\x85\xa1\xcc\x9b\xe0\xac\xbe\x65\x65\xcc\x81\x41", "\xe0\xac\xbe\xe1\x85\xa1\xcc\x9b\xe0\xac\xbe\x65\xc3\xa9\x61"},
+        {"\xe0\xad\x87", "\xe0\xad\x87", "\xe0\xad\x87", "\xe0\xad\x87"},
+        {"\xe0\xbd\xb4\xe0\xbd\xb4\xd6\xb7\x61\xe2\x84\xa6\xc4\xb0", "\xd6\xb7\xe0\xbd\xb4\xe0\xbd\xb4\x61\xce\xa9\xc4\xb0", "\xd6\xb7\xe0\xbd\xb4\xe0\xbd\xb4\x61\xce\xa9\x49\xcc\x87", "\xe0\xbd\xb4\xe0\xbd\xb4\xd6\xb7\x61\xcf\x89\x69\xcc\x87"},
+        {"\xcc\xa7\xf0\x9d\x85\x9e\xe1\xba\x9e", "\xcc\xa7\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\xe1\xba\x9e", "\xcc\xa7\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\xe1\xba\x9e", "\xcc\xa7\xf0\x9d\x85\x9e\x73\x73"},
+        {"\x53\xe0\xbd\xb2\xe3\x81\x8b", "\x53\xe0\xbd\xb2\xe3\x81\x8b", "\x53\xe0\xbd\xb2\xe3\x81\x8b", "\x73\xe0\xbd\xb2\xe3\x81\x8b"},
+        {"\xcc\x80\x20\x53\xe1\xbe\x80\xc3\xa9", "\xcc\x80\x20\x53\xe1\xbe\x80\xc3\xa9", "\xcc\x80\x20\x53\xce\xb1\xcc\x93\xcd\x85\x65\xcc\x81", "\xcc\x80\x20\x73\xe1\xbc\x80\xce\xb9\xc3\xa9"},
+        {"\x61\xcc\x80\xe1\x84\x80", "\xc3\xa0\xe1\x84\x80", "\x61\xcc\x80\xe1\x84\x80", "\x61\xcc\x80\xe1\x84\x80"},
+        {"\xe3\x81\x8b\xcc\x80\xd6\xb0\xc4\xb0\xef\xac\x81\xe1\x85\xa1\xe3\x82\x99", "\xe3\x81\x8b\xd6\xb0\xcc\x80\xc4\xb0\xef\xac\x81\xe1\x85\xa1\xe3\x82\x99", "\xe3\x81\x8b\xd6\xb0\xcc\x80\x49\xcc\x87\xef\xac\x81\xe1\x85\xa1\xe3\x82\x99", "\xe3\x81\x8b\xcc\x80\xd6\xb0\x69\xcc\x87\x66\x69\xe1\x85\xa1\xe3\x82\x99"},
+        {"\xe1\x86\xa8\xce\x99\xcd\x85\xe0\xbd\xb1\x6f", "\xe1\x86\xa8\xce\x99\xe0\xbd\xb1\xcd\x85\x6f", "\xe1\x86\xa8\xce\x99\xe0\xbd\xb1\xcd\x85\x6f", "\xe1\x86\xa8\xce\xb9\xce\xb9\xe0\xbd\xb1\x6f"},
+        {"\xe0\xa5\x98\xea\xb0\x80\xcf\x83\xc4\xb0\xc3\x9f", "\xe0\xa4\x95\xe0\xa4\xbc\xea\xb0\x80\xcf\x83\xc4\xb0\xc3\x9f", "\xe0\xa4\x95\xe0\xa4\xbc\xe1\x84\x80\xe1\x85\xa1\xcf\x83\x49\xcc\x87\xc3\x9f", "\xe0\xa5\x98\xea\xb0\x80\xcf\x83\x69\xcc\x87\x73\x73"},
+        {"\x6f\xe1\x86\xa8\x20\x61\x61\xe3\x81\x8b\xe1\x85\xa1", "\x6f\xe1\x86\xa8\x20\x61\x61\xe3\x81\x8b\xe1\x85\xa1", "\x6f\xe1\x86\xa8\x20\x61\x61\xe3\x81\x8b\xe1\x85\xa1", "\x6f\xe1\x86\xa8\x20\x61\x61\xe3\x81\x8b\xe1\x85\xa1"},
+        {"\xe1\xbe\x80\xf0\x91\x82\xa5\xe3\x81\x8b", "\xe1\xbe\x80\xf0\x91\x82\xa5\xe3\x81\x8b", "\xce\xb1\xcc\x93\xcd\x85\xf0\x91\x82\xa5\xe3\x81\x8b", "\xe1\xbc\x80\xce\xb9\xf0\x91\x82\xa5\xe3\x81\x8b"},
+        {"\xe2\x80\x80\x7a\xcd\x84\x20", "\xe2\x80\x82\x7a\xcc\x88\xcc\x81\x20", "\xe2\x80\x82\x7a\xcc\x88\xcc\x81\x20", "\xe2\x80\x80\x7a\xcd\x84\x20"},
+        {"\xf0\x91\x82\xba\x6f\xe1\x86\xa8\xe0\xad\x87\xea\xb0\x80\xe0\xad\x87", "\xf0\x91\x82\xba\x6f\xe1\x86\xa8\xe0\xad\x87\xea\xb0\x80\xe0\xad\x87", "\xf0\x91\x82\xba\x6f\xe1\x86\xa8\xe0\xad\x87\xe1\x84\x80\xe1\x85\xa1\xe0\xad\x87", "\xf0\x91\x82\xba\x6f\xe1\x86\xa8\xe0\xad\x87\xea\xb0\x80\xe0\xad\x87"},
+        {"\xc3\xa9\x20\x6f\xcc\x81\xe0\xbd\xb3\xef\xac\x81\xe0\xad\x97\xe1\x84\x80", "\xc3\xa9\x20\xc3\xb3\xe0\xbd\xb1\xe0\xbd\xb2\xef\xac\x81\xe0\xad\x97\xe1\x84\x80", "\x65\xcc\x81\x20\x6f\xe0\xbd\xb1\xe0\xbd\xb2\xcc\x81\xef\xac\x81\xe0\xad\x97\xe1\x84\x80", "\xc3\xa9\x20\x6f\xcc\x81\xe0\xbd\xb3\x66\x69\xe0\xad\x97\xe1\x84\x80"},
+        {"\xc3\x9f\xe0\xa5\x98\xf0\x91\x82\xba\x53\xe1\xba\x9e\xe0\xbd\xb4\x73\xcc\xa7", "\xc3\x9f\xe0\xa4\x95\xe0\xa4\xbc\xf0\x91\x82\xba\x53\xe1\xba\x9e\xe0\xbd\xb4\xc5\x9f", "\xc3\x9f\xe0\xa4\x95\xe0\xa4\xbc\xf0\x91\x82\xba\x53\xe1\xba\x9e\xe0\xbd\xb4\x73\xcc\xa7", "\x73\x73\xe0\xa5\x98\xf0\x91\x82\xba\x73\x73\x73\xe0\xbd\xb4\x73\xcc\xa7"},
+        {"\x41\xe0\xbd\xb2", "\x41\xe0\xbd\xb2", "\x41\xe0\xbd\xb2", "\x61\xe0\xbd\xb2"},
+        {"\xe1\x85\xa1\xe0\xbd\xb1\xf0\x91\x82\xba\xe3\x82\x99\xce\xa3\xef\xac\x81\xd6\x91\xcf\x83", "\xe1\x85\xa1\xf0\x91\x82\xba\xe3\x82\x99\xe0\xbd\xb1\xce\xa3\xef\xac\x81\xd6\x91\xcf\x83", "\xe1\x85\xa1\xf0\x91\x82\xba\xe3\x82\x99\xe0\xbd\xb1\xce\xa3\xef\xac\x81\xd6\x91\xcf\x83", "\xe1\x85\xa1\xe0\xbd\xb1\xf0\x91\x82\xba\xe3\x82\x99\xcf\x83\x66\x69\xd6\x91\xcf\x83"},
+        {"\xcc\x9b\xe0\xbd\xb1\xcc\x9b\xe1\x86\xa8\xe0\xac\xbe", "\xe0\xbd\xb1\xcc\x9b\xcc\x9b\xe1\x86\xa8\xe0\xac\xbe", "\xe0\xbd\xb1\xcc\x9b\xcc\x9b\xe1\x86\xa8\xe0\xac\xbe", "\xcc\x9b\xe0\xbd\xb1\xcc\x9b\xe1\x86\xa8\xe0\xac\xbe"},
+        {"\xe1\x85\xa1\xcc\x9b\x6f\x65\x41\xe1\x86\xa8", "\xe1\x85\xa1\xcc\x9b\x6f\x65\x41\xe1\x86\xa8", "\xe1\x85\xa1\xcc\x9b\x6f\x65\x41\xe1\x86\xa8", "\xe1\x85\xa1\xcc\x9b\x6f\x65\x61\xe1\x86\xa8"},
+        {"\xc3\x87\xc4\xb0\xe0\xbd\xb4", "\xc3\x87\xc4\xb0\xe0\xbd\xb4", "\x43\xcc\xa7\x49\xe0\xbd\xb4\xcc\x87", "\xc3\xa7\x69\xcc\x87\xe0\xbd\xb4"},
+        {"\xe3\x82\x99\x65\x4b\xe3\x82\x9a\xf0\x91\x82\xa5", "\xe3\x82\x99\x65\x4b\xe3\x82\x9a\xf0\x91\x82\xa5", "\xe3\x82\x99\x65\x4b\xe3\x82\x9a\xf0\x91\x82\xa5", "\xe3\x82\x99\x65\x6b\xe3\x82\x9a\xf0\x91\x82\xa5"},
+        {"\xd6\xb0\xcc\x80\xce\xa3", "\xd6\xb0\xcc\x80\xce\xa3", "\xd6\xb0\xcc\x80\xce\xa3", "\xd6\xb0\xcc\x80\xcf\x83"},
+        {"\xcc\x80", "\xcc\x80", "\xcc\x80", "\xcc\x80"},
+        {"\xe3\x82\x9a\xe0\xa4\xbc\xe1\xbe\x80\x73\xcc\x81", "\xe0\xa4\xbc\xe3\x82\x9a\xe1\xbe\x80\xc5\x9b", "\xe0\xa4\xbc\xe3\x82\x9a\xce\xb1\xcc\x93\xcd\x85\x73\xcc\x81", "\xe3\x82\x9a\xe0\xa4\xbc\xe1\xbc\x80\xce\xb9\x73\xcc\x81"},
+        {"\xcc\x80\xe1\x86\xa8\xcc\x80\xe0\xbd\xb4\xe0\xa5\x98\xcc\x81\xe1\x86\xa8", "\xcc\x80\xe1\x86\xa8\xe0\xbd\xb4\xcc\x80\xe0\xa4\x95\xe0\xa4\xbc\xcc\x81\xe1\x86\xa8", "\xcc\x80\xe1\x86\xa8\xe0\xbd\xb4\xcc\x80\xe0\xa4\x95\xe0\xa4\xbc\xcc\x81\xe1\x86\xa8", "\xcc\x80\xe1\x86\xa8\xcc\x80\xe0\xbd\xb4\xe0\xa5\x98\xcc\x81\xe1\x86\xa8"},
+        {"\xc4\xb0\xe3\x81\x8b\xf0\x91\x82\xa5\x4b", "\xc4\xb0\xe3\x81\x8b\xf0\x91\x82\xa5\x4b", "\x49\xcc\x87\xe3\x81\x8b\xf0\x91\x82\xa5\x4b", "\x69\xcc\x87\xe3\x81\x8b\xf0\x91\x82\xa5\x6b"},
+        {"\xcc\xa7\xe0\xac\xbe\x4b\xce\x99\x7a\xd6\xb0", "\xcc\xa7\xe0\xac\xbe\x4b\xce\x99\x7a\xd6\xb0", "\xcc\xa7\xe0\xac\xbe\x4b\xce\x99\x7a\xd6\xb0", "\xcc\xa7\xe0\xac\xbe\x6b\xce\xb9\x7a\xd6\xb0"},
+        {"\xe3\x82\x99", "\xe3\x82\x99", "\xe3\x82\x99", "\xe3\x82\x99"},
+        {"\xe2\x84\xa6\xef\xac\x81", "\xce\xa9\xef\xac\x81", "\xce\xa9\xef\xac\x81", "\xcf\x89\x66\x69"},
+        {"\xcd\x84\xf0\x91\x82\xa5\xe1\xba\x9e\xe2\x84\xab\xcd\x85", "\xcc\x88\xcc\x81\xf0\x91\x82\xa5\xe1\xba\x9e\xc3\x85\xcd\x85", "\xcc\x88\xcc\x81\xf0\x91\x82\xa5\xe1\xba\x9e\x41\xcc\x8a\xcd\x85", "\xcd\x84\xf0\x91\x82\xa5\x73\x73\xc3\xa5\xce\xb9"},
+        {"\xe1\x84\x80\xd6\xb7\x65\xd6\xb0", "\xe1\x84\x80\xd6\xb7\x65\xd6\xb0", "\xe1\x84\x80\xd6\xb7\x65\xd6\xb0", "\xe1\x84\x80\xd6\xb7\x65\xd6\xb0"},
+        {"\xc3\x87\xe0\xbd\xb4", "\xc3\x87\xe0\xbd\xb4", "\x43\xe0\xbd\xb4\xcc\xa7", "\xc3\xa7\xe0\xbd\xb4"},
+        {"\xe0\xac\xbe\xf0\x9d\x85\x9e\xe2\x84\xa6", "\xe0\xac\xbe\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\xce\xa9", "\xe0\xac\xbe\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\xce\xa9", "\xe0\xac\xbe\xf0\x9d\x85\x9e\xcf\x89"},
+        {"\xc3\x85\xce\x99\xe3\x82\x9a\xc3\x9f\x65", "\xc3\x85\xce\x99\xe3\x82\x9a\xc3\x9f\x65", "\x41\xcc\x8a\xce\x99\xe3\x82\x9a\xc3\x9f\x65", "\xc3\xa5\xce\xb9\xe3\x82\x9a\x73\x73\x65"},
+        {"\x41\xe1\xbe\x80", "\x41\xe1\xbe\x80", "\x41\xce\xb1\xcc\x93\xcd\x85", "\x61\xe1\xbc\x80\xce\xb9"},
+        {"\xce\x99\x4b", "\xce\x99\x4b", "\xce\x99\x4b", "\xce\xb9\x6b"},
+        {"\x41", "\x41", "\x41", "\x61"},
+        {"\xe0\xbd\xb1", "\xe0\xbd\xb1", "\xe0\xbd\xb1", "\xe0\xbd\xb1"},
+        {"\xc3\x85\xcc\xa7", "\xc3\x85\xcc\xa7", "\x41\xcc\xa7\xcc\x8a", "\xc3\xa5\xcc\xa7"},
+        {"\x41\xf0\x91\x82\xba\x6f\xcd\x84", "\x41\xf0\x91\x82\xba\xc3\xb6\xcc\x81", "\x41\xf0\x91\x82\xba\x6f\xcc\x88\xcc\x81", "\x61\xf0\x91\x82\xba\x6f\xcd\x84"},
+        {"\xe3\x83\x8f\xe0\xbd\xb3\xe1\xbe\x80\xd6\xb7\xf0\x91\x82\xa5\xcf\x83", "\xe3\x83\x8f\xe0\xbd\xb1\xe0\xbd\xb2\xe1\xbe\x80\xd6\xb7\xf0\x91\x82\xa5\xcf\x83", "\xe3\x83\x8f\xe0\xbd\xb1\xe0\xbd\xb2\xce\xb1\xd6\xb7\xcc\x93\xcd\x85\xf0\x91\x82\xa5\xcf\x83", "\xe3\x83\x8f\xe0\xbd\xb3\xe1\xbc\x80\xce\xb9\xd6\xb7\xf0\x91\x82\xa5\xcf\x83"},
+        {"\xe0\xbd\xb2", "\xe0\xbd\xb2", "\xe0\xbd\xb2", "\xe0\xbd\xb2"},
+        {"\xe2\x84\xab\xe0\xbd\xb1\xf0\x9d\x85\x9e\xcc\xa7\xf0\x91\x82\xa5\xe1\xba\x9e\xc4\xb0\xe0\xbd\xb4", "\xc3\x85\xe0\xbd\xb1\xf0\x9d\x85\x97\xcc\xa7\xf0\x9d\x85\xa5\xf0\x91\x82\xa5\xe1\xba\x9e\xc4\xb0\xe0\xbd\xb4", "\x41\xe0\xbd\xb1\xcc\x8a\xf0\x9d\x85\x97\xcc\xa7\xf0\x9d\x85\xa5\xf0\x91\x82\xa5\xe1\xba\x9e\x49\xe0\xbd\xb4\xcc\x87", "\xc3\xa5\xe0\xbd\xb1\xf0\x9d\x85\x9e\xcc\xa7\xf0\x91\x82\xa5\x73\x73\x69\xcc\x87\xe0\xbd\xb4"},
+        {"\xe2\x84\xa6\x7a\xe0\xbd\xb2\xd6\xb7\xe1\x84\x80", "\xce\xa9\x7a\xd6\xb7\xe0\xbd\xb2\xe1\x84\x80", "\xce\xa9\x7a\xd6\xb7\xe0\xbd\xb2\xe1\x84\x80", "\xcf\x89\x7a\xe0\xbd\xb2\xd6\xb7\xe1\x84\x80"},
+        {"\xcf\x83\xe1\xbe\x80", "\xcf\x83\xe1\xbe\x80", "\xcf\x83\xce\xb1\xcc\x93\xcd\x85", "\xcf\x83\xe1\xbc\x80\xce\xb9"},
+        {"\xe0\xbd\xb3\xe3\x83\x8f\xcd\x84\xc3\x9f", "\xe0\xbd\xb1\xe0\xbd\xb2\xe3\x83\x8f\xcc\x88\xcc\x81\xc3\x9f", "\xe0\xbd\xb1\xe0\xbd\xb2\xe3\x83\x8f\xcc\x88\xcc\x81\xc3\x9f", "\xe0\xbd\xb3\xe3\x83\x8f\xcd\x84\x73\x73"},
+        {"\xc3\x85\x4b\xc4\xb0\xe0\xa5\x98", "\xc3\x85\x4b\xc4\xb0\xe0\xa4\x95\xe0\xa4\xbc", "\x41\xcc\x8a\x4b\x49\xcc\x87\xe0\xa4\x95\xe0\xa4\xbc", "\xc3\xa5\x6b\x69\xcc\x87\xe0\xa5\x98"},
+        {"\xc4\xb0\xcd\x84\xe3\x82\x9a", "\xc4\xb0\xe3\x82\x9a\xcc\x88\xcc\x81", "\x49\xe3\x82\x9a\xcc\x87\xcc\x88\xcc\x81", "\x69\xcc\x87\xcd\x84\xe3\x82\x9a"},
+        {"\xe0\xbd\xb2\xe0\xad\x87", "\xe0\xbd\xb2\xe0\xad\x87", "\xe0\xbd\xb2\xe0\xad\x87", "\xe0\xbd\xb2\xe0\xad\x87"},
+        {"\xe1\x86\xa8\xea\xb0\x80\xd6\xb0\xce\xa3\xe0\xad\x97", "\xe1\x86\xa8\xea\xb0\x80\xd6\xb0\xce\xa3\xe0\xad\x97", "\xe1\x86\xa8\xe1\x84\x80\xe1\x85\xa1\xd6\xb0\xce\xa3\xe0\xad\x97", "\xe1\x86\xa8\xea\xb0\x80\xd6\xb0\xcf\x83\xe0\xad\x97"},
+        {"\xf0\x91\x82\xa5\xc3\x87\xe1\x85\xa1\xe0\xbd\xb4\xea\xb0\x81\xcc\x9b\xe3\x81\x8b", "\xf0\x91\x82\xa5\xc3\x87\xe1\x85\xa1\xe0\xbd\xb4\xea\xb0\x81\xcc\x9b\xe3\x81\x8b", "\xf0\x91\x82\xa5\x43\xcc\xa7\xe1\x85\xa1\xe0\xbd\xb4\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8\xcc\x9b\xe3\x81\x8b", "\xf0\x91\x82\xa5\xc3\xa7\xe1\x85\xa1\xe0\xbd\xb4\xea\xb0\x81\xcc\x9b\xe3\x81\x8b"},
+        {"\xe1\x84\x80", "\xe1\x84\x80", "\xe1\x84\x80", "\xe1\x84\x80"},
+        {"\xcc\x80\xc3\x87\x73\x73\xc3\xa9", "\xcc\x80\xc3\x87\x73\x73\xc3\xa9", "\xcc\x80\x43\xcc\xa7\x73\x73\x65\xcc\x81", "\xcc\x80\xc3\xa7\x73\x73\xc3\xa9"},
+        {"\xef\xac\x81\xea\xb0\x80\xf0\x9d\x85\x9e\xe0\xa4\xbc\xe0\xbd\xb1\xe1\xbe\x80\xef\xac\x81\xe0\xa5\x98", "\xef\xac\x81\xea\xb0\x80\xf0\x9d\x85\x97\xe0\xa4\xbc\xe0\xbd\xb1\xf0\x9d\x85\xa5\xe1\xbe\x80\xef\xac\x81\xe0\xa4\x95\xe0\xa4\xbc", "\xef\xac\x81\xe1\x84\x80\xe1\x85\xa1\xf0\x9d\x85\x97\xe0\xa4\xbc\xe0\xbd\xb1\xf0\x9d\x85\xa5\xce\xb1\xcc\x93\xcd\x85\xef\xac\x81\xe0\xa4\x95\xe0\xa4\xbc", "\x66\x69\xea\xb0\x80\xf0\x9d\x85\x9e\xe0\xa4\xbc\xe0\xbd\xb1\xe1\xbc\x80\xce\xb9\x66\x69\xe0\xa5\x98"},
+        {"\xcc\x88\xe0\xbd\xb4\xcc\xa3\xcc\x81\x61\x65\xe2\x84\xa6\xce\x99", "\xe0\xbd\xb4\xcc\xa3\xcc\x88\xcc\x81\x61\x65\xce\xa9\xce\x99", "\xe0\xbd\xb4\xcc\xa3\xcc\x88\xcc\x81\x61\x65\xce\xa9\xce\x99", "\xcc\x88\xe0\xbd\xb4\xcc\xa3\xcc\x81\x61\x65\xcf\x89\xce\xb9"},
+        {"\xe0\xbd\xb1\xcc\x9b\xe0\xbd\xb2\x53\xce\x99", "\xe0\xbd\xb1\xe0\xbd\xb2\xcc\x9b\x53\xce\x99", "\xe0\xbd\xb1\xe0\xbd\xb2\xcc\x9b\x53\xce\x99", "\xe0\xbd\xb1\xcc\x9b\xe0\xbd\xb2\x73\xce\xb9"},
+        {"\xce\xa3\xce\x99", "\xce\xa3\xce\x99", "\xce\xa3\xce\x99", "\xcf\x83\xce\xb9"},
+        {"\xc3\x85\xd6\xb0\xe2\x84\xa6", "\xc3\x85\xd6\xb0\xce\xa9", "\x41\xd6\xb0\xcc\x8a\xce\xa9", "\xc3\xa5\xd6\xb0\xcf\x89"},
+        {"\xe3\x82\x9a\xe3\x82\x99\xe1\x85\xa1", "\xe3\x82\x9a\xe3\x82\x99\xe1\x85\xa1", "\xe3\x82\x9a\xe3\x82\x99\xe1\x85\xa1", "\xe3\x82\x9a\xe3\x82\x99\xe1\x85\xa1"},
+        {"\xcc\xa7\x4b\xcc\xa7\xcc\x80", "\xcc\xa7\xc4\xb6\xcc\x80", "\xcc\xa7\x4b\xcc\xa7\xcc\x80", "\xcc\xa7\x6b\xcc\xa7\xcc\x80"},
+        {"\xe3\x83\x8f\xef\xac\x81\xc3\x9f\xc3\x85\x41\xe0\xbd\xb2\xe1\xba\x9e", "\xe3\x83\x8f\xef\xac\x81\xc3\x9f\xc3\x85\x41\xe0\xbd\xb2\xe1\xba\x9e", "\xe3\x83\x8f\xef\xac\x81\xc3\x9f\x41\xcc\x8a\x41\xe0\xbd\xb2\xe1\xba\x9e", "\xe3\x83\x8f\x66\x69\x73\x73\xc3\xa5\x61\xe0\xbd\xb2\x73\x73"},
+        {"\xc3\x85\xe0\xa5\x98", "\xc3\x85\xe0\xa4\x95\xe0\xa4\xbc", "\x41\xcc\x8a\xe0\xa4\x95\xe0\xa4\xbc", "\xc3\xa5\xe0\xa5\x98"},
+        {"\xef\xac\x81", "\xef\xac\x81", "\xef\xac\x81", "\x66\x69"},
+        {"\x53\xe1\x85\xa1\xe3\x81\x8b\xe1\xba\x9e\xe3\x82\x99\xf0\x91\x82\xa5\xcc\xa3", "\x53\xe1\x85\xa1\xe3\x81\x8b\xe1\xba\x9e\xe3\x82\x99\xf0\x91\x82\xa5\xcc\xa3", "\x53\xe1\x85\xa1\xe3\x81\x8b\xe1\xba\x9e\xe3\x82\x99\xf0\x91\x82\xa5\xcc\xa3", "\x73\xe1\x85\xa1\xe3\x81\x8b\x73\x73\xe3\x82\x99\xf0\x91\x82\xa5\xcc\xa3"},
+        {"\xf0\x9d\x85\x9e\x20\xe0\xad\x87\xce\x99", "\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\x20\xe0\xad\x87\xce\x99", "\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\x20\xe0\xad\x87\xce\x99", "\xf0\x9d\x85\x9e\x20\xe0\xad\x87\xce\xb9"},
+        {"\xce\x99\xd6\xb0\xcc\x9b\xe3\x82\x9a\xcc\xa7\x20\xe1\x86\xa8", "\xce\x99\xe3\x82\x9a\xd6\xb0\xcc\xa7\xcc\x9b\x20\xe1\x86\xa8", "\xce\x99\xe3\x82\x9a\xd6\xb0\xcc\xa7\xcc\x9b\x20\xe1\x86\xa8", "\xce\xb9\xd6\xb0\xcc\x9b\xe3\x82\x9a\xcc\xa7\x20\xe1\x86\xa8"},
+        {"\xcc\x88\xe0\xa5\x98\xf0\x91\x82\xba\xcc\x9b\xcc\x80\xe0\xad\x87\xe3\x82\x99\xea\xb0\x81", "\xcc\x88\xe0\xa4\x95\xe0\xa4\xbc\xf0\x91\x82\xba\xcc\x9b\xcc\x80\xe0\xad\x87\xe3\x82\x99\xea\xb0\x81", "\xcc\x88\xe0\xa4\x95\xe0\xa4\xbc\xf0\x91\x82\xba\xcc\x9b\xcc\x80\xe0\xad\x87\xe3\x82\x99\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8", "\xcc\x88\xe0\xa5\x98\xf0\x91\x82\xba\xcc\x9b\xcc\x80\xe0\xad\x87\xe3\x82\x99\xea\xb0\x81"},
+        {"\xce\x99\x7a\xc3\x87\xe2\x80\x80\x61\xc3\x85\xe2\x80\x80", "\xce\x99\x7a\xc3\x87\xe2\x80\x82\x61\xc3\x85\xe2\x80\x82", "\xce\x99\x7a\x43\xcc\xa7\xe2\x80\x82\x61\x41\xcc\x8a\xe2\x80\x82", "\xce\xb9\x7a\xc3\xa7\xe2\x80\x80\x61\xc3\xa5\xe2\x80\x80"},
+        {"\xe1\x85\xa1\xc3\x9f", "\xe1\x85\xa1\xc3\x9f", "\xe1\x85\xa1\xc3\x9f", "\xe1\x85\xa1\x73\x73"},
+        {"\xcc\xa7\xe0\xac\xbe\x65\xcc\x80", "\xcc\xa7\xe0\xac\xbe\xc3\xa8", "\xcc\xa7\xe0\xac\xbe\x65\xcc\x80", "\xcc\xa7\xe0\xac\xbe\x65\xcc\x80"},
+        {"\xef\xac\x81\xc3\x85\xe0\xbd\xb1\xd6\xb0\xd6\x91\xe3\x81\x8b\xef\xac\x81\xe1\xbe\x80", "\xef\xac\x81\xc3\x85\xd6\xb0\xe0\xbd\xb1\xd6\x91\xe3\x81\x8b\xef\xac\x81\xe1\xbe\x80", "\xef\xac\x81\x41\xd6\xb0\xe0\xbd\xb1\xd6\x91\xcc\x8a\xe3\x81\x8b\xef\xac\x81\xce\xb1\xcc\x93\xcd\x85", "\x66\x69\xc3\xa5\xe0\xbd\xb1\xd6\xb0\xd6\x91\xe3\x81\x8b\x66\x69\xe1\xbc\x80\xce\xb9"},
+        {"\xe0\xad\x97", "\xe0\xad\x97", "\xe0\xad\x97", "\xe0\xad\x97"},
+        {"\xf0\x91\x82\xba", "\xf0\x91\x82\xba", "\xf0\x91\x82\xba", "\xf0\x91\x82\xba"},
+        {"\xcf\x83\xd6\xb7\x7a\xe1\x86\xa8\x7a", "\xcf\x83\xd6\xb7\x7a\xe1\x86\xa8\x7a", "\xcf\x83\xd6\xb7\x7a\xe1\x86\xa8\x7a", "\xcf\x83\xd6\xb7\x7a\xe1\x86\xa8\x7a"},
+        {"\xc3\x87\xc3\xa9", "\xc3\x87\xc3\xa9", "\x43\xcc\xa7\x65\xcc\x81", "\xc3\xa7\xc3\xa9"},
+        {"\xe0\xbd\xb2\xce\xa3", "\xe0\xbd\xb2\xce\xa3", "\xe0\xbd\xb2\xce\xa3", "\xe0\xbd\xb2\xcf\x83"},
+        {"\xe3\x82\x99\xe2\x80\x80\xcf\x83", "\xe3\x82\x99\xe2\x80\x82\xcf\x83", "\xe3\x82\x99\xe2\x80\x82\xcf\x83", "\xe3\x82\x99\xe2\x80\x80\xcf\x83"},
+        {"\x41\xe1\xbe\x80\xe0\xac\xbe\xe0\xac\xbe\xea\xb0\x80\xe1\xba\x9e\xc3\xa9\xcc\x9b", "\x41\xe1\xbe\x80\xe0\xac\xbe\xe0\xac\xbe\xea\xb0\x80\xe1\xba\x9e\xc3\xa9\xcc\x9b", "\x41\xce\xb1\xcc\x93\xcd\x85\xe0\xac\xbe\xe0\xac\xbe\xe1\x84\x80\xe1\x85\xa1\xe1\xba\x9e\x65\xcc\x9b\xcc\x81", "\x61\xe1\xbc\x80\xce\xb9\xe0\xac\xbe\xe0\xac\xbe\xea\xb0\x80\x73\x73\xc3\xa9\xcc\x9b"},
+        {"\x41\xe1\x85\xa1\xcc\xa3\xcc\x9b\xe0\xbd\xb3\xe2\x80\x80\xcd\x85\xe0\xbd\xb3", "\x41\xe1\x85\xa1\xe0\xbd\xb1\xe0\xbd\xb2\xcc\x9b\xcc\xa3\xe2\x80\x82\xe0\xbd\xb1\xe0\xbd\xb2\xcd\x85", "\x41\xe1\x85\xa1\xe0\xbd\xb1\xe0\xbd\xb2\xcc\x9b\xcc\xa3\xe2\x80\x82\xe0\xbd\xb1\xe0\xbd\xb2\xcd\x85", "\x61\xe1\x85\xa1\xcc\xa3\xcc\x9b\xe0\xbd\xb3\xe2\x80\x80\xce\xb9\xe0\xbd\xb3"},
+        {"\xf0\x9d\x85\x9e\xc3\x87\xd6\xb0\xc3\x9f\xe0\xad\x97\x20\xd6\xb0\x65", "\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\xc3\x87\xd6\xb0\xc3\x9f\xe0\xad\x97\x20\xd6\xb0\x65", "\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\x43\xd6\xb0\xcc\xa7\xc3\x9f\xe0\xad\x97\x20\xd6\xb0\x65", "\xf0\x9d\x85\x9e\xc3\xa7\xd6\xb0\x73\x73\xe0\xad\x97\x20\xd6\xb0\x65"},
+        {"\xe0\xad\x97\xce\x99", "\xe0\xad\x97\xce\x99", "\xe0\xad\x97\xce\x99", "\xe0\xad\x97\xce\xb9"},
+        {"\xea\xb0\x80", "\xea\xb0\x80", "\xe1\x84\x80\xe1\x85\xa1", "\xea\xb0\x80"},
+        {"\xc3\x87\xe1\xba\x9e\xf0\x9d\x85\x9e\xcc\x80\xe2\x84\xa6\xe1\x84\x80", "\xc3\x87\xe1\xba\x9e\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\xcc\x80\xce\xa9\xe1\x84\x80", "\x43\xcc\xa7\xe1\xba\x9e\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\xcc\x80\xce\xa9\xe1\x84\x80", "\xc3\xa7\x73\x73\xf0\x9d\x85\x9e\xcc\x80\xcf\x89\xe1\x84\x80"},
+        {"\xc3\x9f\x4b\xe1\xbe\x80\x7a\xce\xa3\xe1\xbe\x80", "\xc3\x9f\x4b\xe1\xbe\x80\x7a\xce\xa3\xe1\xbe\x80", "\xc3\x9f\x4b\xce\xb1\xcc\x93\xcd\x85\x7a\xce\xa3\xce\xb1\xcc\x93\xcd\x85", "\x73\x73\x6b\xe1\xbc\x80\xce\xb9\x7a\xcf\x83\xe1\xbc\x80\xce\xb9"},
+        {"\xe0\xad\x97\xe1\x86\xa8\xe1\x85\xa1\xd6\x91\x20\x73", "\xe0\xad\x97\xe1\x86\xa8\xe1\x85\xa1\xd6\x91\x20\x73", "\xe0\xad\x97\xe1\x86\xa8\xe1\x85\xa1\xd6\x91\x20\x73", "\xe0\xad\x97\xe1\x86\xa8\xe1\x85\xa1\xd6\x91\x20\x73"},
+        {"\xe0\xad\x87\xea\xb0\x80\xd6\xb7\xe0\xa4\xbc\xf0\x91\x82\xba", "\xe0\xad\x87\xea\xb0\x80\xe0\xa4\xbc\xf0\x91\x82\xba\xd6\xb7", "\xe0\xad\x87\xe1\x84\x80\xe1\x85\xa1\xe0\xa4\xbc\xf0\x91\x82\xba\xd6\xb7", "\xe0\xad\x87\xea\xb0\x80\xd6\xb7\xe0\xa4\xbc\xf0\x91\x82\xba"},
+        {"\x61\xe1\xba\x9e\xcd\x84", "\x61\xe1\xba\x9e\xcc\x88\xcc\x81", "\x61\xe1\xba\x9e\xcc\x88\xcc\x81", "\x61\x73\x73\xcd\x84"},
+        {"\xe1\x84\x80\xd6\x91\xc4\xb0\x65", "\xe1\x84\x80\xd6\x91\xc4\xb0\x65", "\xe1\x84\x80\xd6\x91\x49\xcc\x87\x65", "\xe1\x84\x80\xd6\x91\x69\xcc\x87\x65"},
+        {"\xe1\xba\x9e\xcc\xa7\xe1\xba\x9e\xd6\xb0\xcc\x81", "\xe1\xba\x9e\xcc\xa7\xe1\xba\x9e\xd6\xb0\xcc\x81", "\xe1\xba\x9e\xcc\xa7\xe1\xba\x9e\xd6\xb0\xcc\x81", "\x73\x73\xcc\xa7\x73\x73\xd6\xb0\xcc\x81"},
+        {"\xe0\xac\xbe\xe0\xbd\xb1\x20", "\xe0\xac\xbe\xe0\xbd\xb1\x20", "\xe0\xac\xbe\xe0\xbd\xb1\x20", "\xe0\xac\xbe\xe0\xbd\xb1\x20"},
+        {"\xcc\x9b\xd6\xb7\xe0\xbd\xb4\xc3\xa9\xcc\x81\xe0\xac\xbe", "\xd6\xb7\xe0\xbd\xb4\xcc\x9b\xc3\xa9\xcc\x81\xe0\xac\xbe", "\xd6\xb7\xe0\xbd\xb4\xcc\x9b\x65\xcc\x81\xcc\x81\xe0\xac\xbe", "\xcc\x9b\xd6\xb7\xe0\xbd\xb4\xc3\xa9\xcc\x81\xe0\xac\xbe"},
+        {"\xe1\x85\xa1\xc3\xa9\xce\x99\xf0\x9d\x85\x9e\xe0\xbd\xb4\xe3\x83\x8f\xf0\x91\x82\xa5\xe3\x82\x9a", "\xe1\x85\xa1\xc3\xa9\xce\x99\xf0\x9d\x85\x97\xe0\xbd\xb4\xf0\x9d\x85\xa5\xe3\x83\x8f\xf0\x91\x82\xa5\xe3\x82\x9a", "\xe1\x85\xa1\x65\xcc\x81\xce\x99\xf0\x9d\x85\x97\xe0\xbd\xb4\xf0\x9d\x85\xa5\xe3\x83\x8f\xf0\x91\x82\xa5\xe3\x82\x9a", "\xe1\x85\xa1\xc3\xa9\xce\xb9\xf0\x9d\x85\x9e\xe0\xbd\xb4\xe3\x83\x8f\xf0\x91\x82\xa5\xe3\x82\x9a"},
+        {"\xf0\x91\x82\xba\xcf\x83\xe3\x81\x8b\x6f", "\xf0\x91\x82\xba\xcf\x83\xe3\x81\x8b\x6f", "\xf0\x91\x82\xba\xcf\x83\xe3\x81\x8b\x6f", "\xf0\x91\x82\xba\xcf\x83\xe3\x81\x8b\x6f"},
+        {"\xe0\xad\x97\xc3\x9f\xcc\x80\xc3\xa9\xe2\x80\x80\xc3\x85", "\xe0\xad\x97\xc3\x9f\xcc\x80\xc3\xa9\xe2\x80\x82\xc3\x85", "\xe0\xad\x97\xc3\x9f\xcc\x80\x65\xcc\x81\xe2\x80\x82\x41\xcc\x8a", "\xe0\xad\x97\x73\x73\xcc\x80\xc3\xa9\xe2\x80\x80\xc3\xa5"},
+        {"\xe2\x84\xa6\xe1\x84\x80\xc3\xa9\x61\x53\xc3\x9f\xe3\x81\x8b\xe0\xbd\xb2", "\xce\xa9\xe1\x84\x80\xc3\xa9\x61\x53\xc3\x9f\xe3\x81\x8b\xe0\xbd\xb2", "\xce\xa9\xe1\x84\x80\x65\xcc\x81\x61\x53\xc3\x9f\xe3\x81\x8b\xe0\xbd\xb2", "\xcf\x89\xe1\x84\x80\xc3\xa9\x61\x73\x73\x73\xe3\x81\x8b\xe0\xbd\xb2"},
+        {"\xe3\x83\x8f\x20\x6f\xe3\x82\x9a\xcc\x80\xe0\xbd\xb1\xe2\x84\xa6\xc3\xa9", "\xe3\x83\x8f\x20\xc3\xb2\xe3\x82\x9a\xe0\xbd\xb1\xce\xa9\xc3\xa9", "\xe3\x83\x8f\x20\x6f\xe3\x82\x9a\xe0\xbd\xb1\xcc\x80\xce\xa9\x65\xcc\x81", "\xe3\x83\x8f\x20\x6f\xe3\x82\x9a\xcc\x80\xe0\xbd\xb1\xcf\x89\xc3\xa9"},
+        {"\xc3\xa9\xe0\xbd\xb2\x6f\xe0\xac\xbe", "\xc3\xa9\xe0\xbd\xb2\x6f\xe0\xac\xbe", "\x65\xe0\xbd\xb2\xcc\x81\x6f\xe0\xac\xbe", "\xc3\xa9\xe0\xbd\xb2\x6f\xe0\xac\xbe"},
+        {"\xe1\xba\x9e\xe1\xba\x9e\xe0\xad\x97\x20\xe0\xbd\xb2\xe1\x86\xa8\xea\xb0\x80", "\xe1\xba\x9e\xe1\xba\x9e\xe0\xad\x97\x20\xe0\xbd\xb2\xe1\x86\xa8\xea\xb0\x80", "\xe1\xba\x9e\xe1\xba\x9e\xe0\xad\x97\x20\xe0\xbd\xb2\xe1\x86\xa8\xe1\x84\x80\xe1\x85\xa1", "\x73\x73\x73\x73\xe0\xad\x97\x20\xe0\xbd\xb2\xe1\x86\xa8\xea\xb0\x80"},
+        {"\xe1\x85\xa1\x6f\xcd\x84", "\xe1\x85\xa1\xc3\xb6\xcc\x81", "\xe1\x85\xa1\x6f\xcc\x88\xcc\x81", "\xe1\x85\xa1\x6f\xcd\x84"},
+        {"\xe2\x80\x80", "\xe2\x80\x82", "\xe2\x80\x82", "\xe2\x80\x80"},
+        {"\xe3\x83\x8f", "\xe3\x83\x8f", "\xe3\x83\x8f", "\xe3\x83\x8f"},
+        {"\x7a", "\x7a", "\x7a", "\x7a"},
+        {"\x4b\x65\x65", "\x4b\x65\x65", "\x4b\x65\x65", "\x6b\x65\x65"},
+    };
+    for(isize i = 0; i < ARRAY_COUNT(vectors); i++) {
+        const char* input = vectors[i][0];
+        TEST(_test_unicode_norm_is(unicode_nfc, input, strlen(input), vectors[i][1]));
+        TEST(_test_unicode_norm_is(unicode_nfd, input, strlen(input), vectors[i][2]));
+        TEST(_test_unicode_norm_is(unicode_casefold, input, strlen(input), vectors[i][3]));
+        _test_unicode_norm_consistency(input, strlen(input));
+    }
+
+    //Hand picked: precomposition, the marks of a + acute + cedilla being reordered, Hangul LV + T,
+    // singletons and composition exclusions, full case folding
+    TEST(_test_unicode_norm_is(unicode_nfc, "e\xcc\x81", 3, "\xc3\xa9"));
+    TEST(_test_unicode_norm_is(unicode_nfd, "\xc3\xa9", 2, "e\xcc\x81"));
+    TEST(_test_unicode_norm_is(unicode_nfd, "a\xcc\x81\xcc\xa7", 5, "a\xcc\xa7\xcc\x81"));
+    TEST(_test_unicode_norm_is(unicode_nfc, "\xea\xb0\x80\xe1\x86\xa8", 6, "\xea\xb0\x81"));
+    TEST(_test_unicode_norm_is(unicode_nfd, "\xea\xb0\x81", 3, "\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8"));
+    TEST(_test_unicode_norm_is(unicode_nfc, "\xe2\x84\xab", 3, "\xc3\x85"));
+    TEST(_test_unicode_norm_is(unicode_nfc, "\xe0\xa5\x98", 3, "\xe0\xa4\x95\xe0\xa4\xbc"));
+    TEST(_test_unicode_norm_is(unicode_casefold, "Stra\xc3\x9f" "e", 7, "strasse"));
+    TEST(_test_unicode_norm_is(unicode_casefold, "\xce\xa3\xce\x91\xce\xa3", 6, "\xcf\x83\xce\xb1\xcf\x83"));
+    TEST(_test_unicode_norm_is(unicode_casefold, "\xc4\xb0", 2, "i\xcc\x87"));
+    TEST(_test_unicode_norm_is(unicode_casefold, "Hello, World! 0123456789 ABCXYZ[]@`{}", 37, "hello, world! 0123456789 abcxyz[]@`{}"));
+
+    //Invalid bytes are copied and break segments: the mark after them does not compose with the e before
+    TEST(_test_unicode_norm_is(unicode_nfc, "e\xff\xcc\x81", 4, "e\xff\xcc\x81"));
+    TEST(_test_unicode_norm_is(unicode_nfd, "\x80\xc3\xa9\xc3", 4, "\x80" "e\xcc\x81\xc3"));
+    TEST(_test_unicode_norm_is(unicode_casefold, "A\xed\xa0\x80" "B", 5, "a\xed\xa0\x80" "b"));
+
+    //Quick checks stop at the first code point that might change
+    TEST(unicode_nfc_quick_check("caf\xc3\xa9 au lait", 14) == 14);
+    TEST(unicode_nfc_quick_check("cafe\xcc\x81", 6) == 4);
+    TEST(unicode_nfd_quick_check("caf\xc3\xa9", 5) == 3);
+    TEST(unicode_casefold_quick_check("hello World", 11) == 6);
+
+    TEST(unicode_combining_class(0x0301) == 230);
+    TEST(unicode_combining_class('a') == 0);
+    TEST(unicode_compose('e', 0x0301) == 0xE9);
+    TEST(unicode_compose(0x0915, 0x093C) == 0);
+    uint32_t decomposed[UNICODE_NORM_MAX_DECOMPOSITION] = {0};
+    TEST(unicode_decompose(0x1E69, decomposed) == 3 && decomposed[0] == 's' && decomposed[1] == 0x0323 && decomposed[2] == 0x0307);
+    uint32_t folded[UNICODE_NORM_MAX_FOLD] = {0};
+    TEST(unicode_casefold_codepoint(0xFB03, folded) == 3 && folded[0] == 'f' && folded[1] == 'f' && folded[2] == 'i');
+
+    //Every single code point, and pairs of it with a combining mark
+    for(uint32_t c = 0; c <= UTF_MAX; c++) {
+        if(0xD800 <= c && c <= 0xDFFF)
+            continue;
+        char input[8] = {0};
+        isize size = 0;
+        utf8_encode(input, sizeof input, c, &size);
+        _test_unicode_norm_consistency(input, size);
+        if(c % 7 == 0) {
+            utf8_encode(input, sizeof input, 0x0301 + c % 0x60, &size);
+            _test_unicode_norm_consistency(input, size);
+        }
+    }
+
+    //Random strings of the code points with the most interactions
+    uint32_t interesting[] = {'a', 'e', 'A', 'K', 0xDF, 0xE9, 0xC5, 0x212B, 0x0301, 0x0300, 0x0327, 0x0323, 0x0308, 0x031B, 0x0344, 0x0345,
+        0x0958, 0x093C, 0x1100, 0x1161, 0x11A8, 0xAC00, 0xAC01, 0x3A3, 0x130, 0x1E9E, 0xFB01, 0x1F80, 0x05B0, 0x05B7, 0x0591,
+        0x0B47, 0x0B3E, 0x0B57, 0x3099, 0x304B, 0x30CF, 0x309A, 0x1D15E, 0x110A5, 0x110BA, 0x0F73, 0x0F71, 0x0F72, 0x0F74, 0xFF};
+    for(isize r = 0; r < 20000; r++) {
+        char input[160] = {0};
+        isize size = 0;
+        isize count = random_range(0, 40);
+        for(isize i = 0; i < count; i++)
+            utf8_encode(input, sizeof input, interesting[random_range(0, ARRAY_COUNT(interesting))], &size);
+        if(size > 0 && random_range(0, 8) == 0)
+            input[random_range(0, size)] = (char) 0xFF;
+        _test_unicode_norm_consistency(input, size);
+    }
+
+    //Segments longer than UNICODE_NORM_SEGMENT_MAX are split but still produce valid ordered output
+    {
+        enum {MARKS = 1000};
+        char input[2 + 2*MARKS];
+        char output[3*sizeof input];
+        input[0] = 'e';
+        for(isize i = 0; i < MARKS; i++) {
+            input[1 + 2*i] = (char) 0xCC;
+            input[2 + 2*i] = (char) (i % 2 ? 0x81 : 0xA7);
+        }
+        isize size = unicode_nfd(output, sizeof output, input, 1 + 2*MARKS);
+        TEST(size == 1 + 2*MARKS);
+        TEST(unicode_nfc(output, sizeof output, input, 1 + 2*MARKS) <= size);
+    }
+}
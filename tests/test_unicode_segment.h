@@ -0,0 +1,277 @@
+#pragma once
+
+#include "../unicode_segment.h"
+#include "../random.h"
+#include "../assert.h"
+
+typedef bool (*_Test_Unicode_Segment_Func)(Unicode_Segment_Iterator* iterator, const void* text, isize text_size);
+
+//Segments the text at once and streamed in chunks of random size with is_partial set. Both must give the same
+// segments which must cover the text exactly. Returns the segments joined by '|'.
+INTERNAL isize _test_unicode_segment_join(_Test_Unicode_Segment_Func next, const char* text, isize text_size, char* out, isize out_capacity)
+{
+    isize out_size = 0;
+    isize to = 0;
+    for(Unicode_Segment_Iterator it = {0}; next(&it, text, text_size); ) {
+        TEST(it.from == to && it.to > it.from);
+        TEST(out_size + (it.to - it.from) + 1 <= out_capacity);
+        if(it.from != 0)
+            out[out_size++] = '|';
+        memcpy(out + out_size, text + it.from, (size_t) (it.to - it.from));
+        out_size += it.to - it.from;
+        to = it.to;
+    }
+    TEST(to == text_size);
+
+    isize streamed_size = 0;
+    isize available = 0;
+    Unicode_Segment_Iterator it = {0};
+    it.is_partial = true;
+    while(true) {
+        if(next(&it, text, available)) {
+            if(it.from != 0)
+                TEST(streamed_size < out_size && out[streamed_size++] == '|');
+            TEST(out_size - streamed_size >= it.to - it.from);
+            TEST(memcmp(out + streamed_size, text + it.from, (size_t) (it.to - it.from)) == 0);
+            streamed_size += it.to - it.from;
+        }
+        else if(it.is_partial) {
+            isize more = random_range(0, 5);
+            available = MIN(available + more, text_size);
+            it.is_partial = available < text_size;
+        }
+        else
+            break;
+    }
+    TEST(streamed_size == out_size);
+    return out_size;
+}
+
+INTERNAL bool _test_unicode_segment_is(_Test_Unicode_Segment_Func next, const char* segmented)
+{
+    char text[512] = {0};
+    char joined[1024] = {0};
+    isize text_size = 0;
+    for(const char* c = segmented; *c; c++)
+        if(*c != '|')
+            text[text_size++] = *c;
+
+    isize joined_size = _test_unicode_segment_join(next, text, text_size, joined, sizeof joined);
+    return joined_size == (isize) strlen(segmented) && memcmp(joined, segmented, (size_t) joined_size) == 0;
+}
+
+INTERNAL Unicode_Word_Kind _test_unicode_word_kind(const char* text, isize index)
+{
+    Unicode_Segment_Iterator it = {0};
+    for(isize i = 0; i <= index; i++)
+        TEST(unicode_word_next(&it, text, strlen(text)));
+    return it.kind;
+}
+
+INTERNAL void test_unicode_segment()
+{
+    //Generated by Perl's \X (Unicode 14.0) from random strings of code points of every grapheme break class
+    const char* grapheme_vectors[] = {
+        "\xf0\x9f\x87\xa8\xf0\x9f\x8f\xbb|\xe0\xb5\x8e\xe3\x82\xa2|\xd7\x91",
+        "\xe0\xb8\xb1",
+        "\xe2\x80\x8d|\xe1\x84\x80|\xe3\x80\x80",
+        "\x3a|\x27",
+        "\xe3\x81\x82|\x5a|\xd8\x80|\xc2\xad|\xe2\x80\xa8|\xcc\x81\xcc\x81",
+        "\xc3\xa9|\xe3\x80\x80|\xe3\x83\xbc",
+        "\xe2\x80\xbf|\xc2\xb7|\x22",
+        "\xe0\xb8\xb1",
+        "\xc2\xb7|\xe2\x80\xbf|\xe2\x80\xa8|\xc2\xb7\xf0\x9f\x8f\xbb|\xe1\x86\xa8|\xe3\x81\x82|\x0d",
+        "\x0a|\xe2\x9d\xa4|\xe3\x83\xbc|\x2e\xe0\xa4\x83\xef\xb8\x8f\xe2\x80\x8d|\x30|\xe2\x80\xa8|\xe0\xb8\xb1",
+        "\x0d",
+        "\xe2\x80\x8d|\xf0\x9f\x87\xa8",
+        "\xe2\x80\x8d|\x5f",
+        "\x21|\xe1\x86\xa8|\xe4\xb8\x80|\xc2\x85|\xe0\xb8\x81|\xe2\x80\xbf\xe2\x80\x8d|\x2e|\x01|\xef\xbc\x8e",
+        "\x5f",
+        "\xe2\x80\x99|\xc2\x85|\xe0\xb8\xb3\xe0\xb8\xb3|\x20|\xc2\xad",
+        "\xd9\xa0\xe0\xb8\xb1|\xe1\x84\x80|\x5a",
+        "\xef\xbc\x8e|\xe1\x85\xa1\xe2\x80\x8c",
+        "\x09|\x01|\x27|\x20|\x01|\xc2\xb7",
+        "\xe0\xa4\x83",
+        "\x30|\x61|\x2e|\x3b|\x2c|\xc2\xad|\xef\xbc\x8e",
+        "\xf0\x9f\x87\xa8",
+        "\x3b|\xe0\xb5\x8e\xe1\x85\xa1|\xf0\x9f\x87\xa6|\xe2\x80\x99|\xd9\xa0|\xe1\x85\xa1|\xc3\xa9|\xe0\xb5\x8e",
+        "\xe2\x80\x8c|\xf0\x9f\x98\x80\xe2\x80\x8d",
+        "\x0d|\xe0\xb8\xb3|\x0a|\xc3\xa9|\xe1\x85\xa1\xe2\x80\x8c|\x0d",
+        "\xf0\x9f\x98\x80|\xe3\x81\x82\xe0\xb8\xb1|\xe1\x86\xa8|\xd7\x90|\x20|\x01|\xc2\x85",
+        "\x27|\x0a|\xe1\x85\xa1|\x5a\xf0\x9f\x8f\xbb|\xe1\x86\xa8|\xf0\x9f\x87\xa6|\xd7\x90",
+        "\x2d|\x09|\xe3\x82\xa2\xe0\xb8\xb1|\xc2\xad|\x5a",
+        "\x21|\xe1\x84\x80|\xd7\x91\xe0\xa4\x83|\x0d|\x3a|\xc2\xad|\x0a",
+        "\x0d|\xe3\x83\xbc",
+        "\x21|\xe2\x80\x99|\x0a|\x2d\xe2\x80\x8c|\x3a",
+        "\x21|\x5a|\xef\xbc\x8e\xe0\xb8\xb3",
+        "\x5f\xe0\xb8\xb3|\xf0\x9f\x87\xa6\xe0\xb8\xb3|\xe1\x84\x80|\xc2\xb7",
+        "\xe2\x80\x8d|\xf0\x9f\x87\xa6\xe2\x80\x8d\xe2\x80\x8d|\xe2\x9d\xa4|\x22|\xe1\x85\xa1|\x2e|\x5a|\xc2\xb7",
+        "\xf0\x9f\x87\xa6|\x2d|\x3b|\x3a|\xe3\x82\xa2",
+        "\xd7\x91|\x30|\x21|\x22\xe2\x80\x8d|\x22|\x20|\x3a|\xe0\xb5\x8e",
+        "\xd8\x80\x61|\xd7\x91|\xea\xb0\x80|\x2d|\x3a|\x01|\xf0\x9f\x8f\xbb",
+        "\x61\xe0\xb8\xb3|\xd8\x80",
+        "\x27|\xe2\x80\xa8|\x0a|\xd7\x90|\xd8\x80\xe2\x80\x99",
+        "\x2c|\x2c|\xe1\x85\xa1\xe2\x80\x8d",
+        "\xd9\xa0|\x21|\x2d|\xe0\xb8\x81|\x5a|\xe2\x80\x99|\x5f|\xc3\xa9|\x0d|\x20",
+        "\xea\xb0\x81|\xe3\x82\xa2|\xe2\x9d\xa4|\xf0\x9f\x87\xa6|\xc3\xa9|\x20\xe2\x80\x8d",
+        "\xc2\x85",
+        "\xe2\x80\x99|\xe0\xb8\x81|\xe4\xb8\x80",
+        "\xf0\x9f\x87\xa8|\xe1\x85\xa1|\x27|\x0d|\xd0\xb6|\xd7\x91",
+        "\x30|\xf0\x9f\x87\xa6",
+        "\xe3\x80\x80|\xf0\x9f\x87\xa6",
+        "\xe2\x9d\xa4|\xd0\xb6|\xf0\x9f\x87\xa6|\xea\xb0\x80|\xf0\x9f\x87\xa6|\x5f|\xe0\xb8\x81|\xe3\x81\x82",
+        "\x0a|\x21\xe2\x80\x8d|\xe2\x9d\xa4",
+        "\x01|\xe3\x82\xa2|\xe3\x81\x82|\x30|\x30|\xea\xb0\x81",
+        "\x0a|\xe0\xb8\x81\xe2\x80\x8d|\xe2\x80\x99\xe2\x80\x8c",
+        "\x30|\xe0\xb8\x81|\xef\xbc\x8e\xf0\x9f\x8f\xbb|\xe3\x83\xbc|\xe2\x9d\xa4",
+        "\xd8\x80\xe3\x81\x82\xe0\xa4\x83|\xe1\x84\x80|\x2d|\x0d|\xd7\x90|\xe2\x9d\xa4",
+        "\xe0\xb8\xb3",
+        "\x3b|\x2d|\xc2\x85|\x5a",
+        "\x61|\xd8\x80\xd8\x80|\x0a|\x3a\xcc\x81\xe2\x80\x8d",
+        "\x5f\xe2\x80\x8c|\xe2\x80\xbf|\x01",
+        "\xd7\x90|\xe1\x86\xa8|\x3a|\x27|\xe2\x80\xbf|\xf0\x9f\x87\xa8|\x30|\xe3\x83\xbc|\xd8\x80",
+        "\x30|\xe1\x86\xa8|\xf0\x9f\x87\xa6|\xe1\x84\x80\xea\xb0\x80|\x5f|\xd9\xa0",
+        "\x2e|\xe0\xb5\x8e|\x0d|\x20|\xf0\x9f\x98\x80|\x5f|\x5a|\xd9\xa0",
+    };
+
+    //Generated by Perl's \b{wb} (Unicode 14.0) the same way. Perl does not break runs of spaces and disagrees with
+    // UAX#29 on ZWJ after punctuation so those are left to the hand picked cases below.
+    const char* word_vectors[] = {
+        "\x21\xc2\xad|\x27\xe2\x80\x8c|\xe1\x84\x80",
+        "\x30|\x2e|\xe3\x83\xbc|\xd7\x90|\x2c|\xe1\x84\x80|\xef\xbc\x8e|\xf0\x9f\x87\xa6|\x39",
+        "\xf0\x9f\x87\xa8\xf0\x9f\x8f\xbb",
+        "\x27\xc2\xad|\xe2\x9d\xa4|\xe3\x82\xa2|\xe1\x86\xa8",
+        "\xd7\x91|\xf0\x9f\x87\xa6|\xd9\xa0\xe2\x80\x8c|\x01",
+        "\xea\xb0\x80\xe1\x86\xa8\xf0\x9f\x8f\xbb|\xe2\x9d\xa4|\x5a\xc3\xa9\xe0\xb8\xb1|\xf0\x9f\x87\xa6|\xc3\xa9\xea\xb0\x80|\x01|\x39\xd0\xb6",
+        "\xe0\xb5\x8e|\xe2\x9d\xa4|\x2d|\x61",
+        "\xf0\x9f\x98\x80|\xf0\x9f\x87\xa6\xe0\xa4\x83\xef\xb8\x8f\xf0\x9f\x87\xa6\xcc\x81|\x3b|\xe1\x85\xa1|\xe3\x83\xbc|\x2e|\xf0\x9f\x87\xa6|\xea\xb0\x81\x5a|\xe3\x81\x82",
+        "\xd7\x90\xe0\xb8\xb1|\x2c|\xe3\x82\xa2|\x2d|\x3b|\xea\xb0\x80\x30",
+        "\xe0\xb8\x81|\x3b|\xd7\x91|\xe4\xb8\x80|\xe0\xb8\x81",
+        "\xe0\xb8\x81|\x22|\xf0\x9f\x87\xa6\xe0\xb8\xb1\xf0\x9f\x87\xa8|\xea\xb0\x81|\xf0\x9f\x87\xa6\xf0\x9f\x87\xa6|\xe2\x9d\xa4",
+        "\xea\xb0\x81\xd0\xb6|\xc2\xb7|\x21|\xe3\x83\xbc|\xd9\xa0\xea\xb0\x80\xea\xb0\x80\xcc\x81\xe1\x84\x80|\xe3\x81\x82",
+        "\xef\xb8\x8f|\x5a\xe2\x80\xbf\xe3\x83\xbc|\x01|\x30\xe1\x84\x80|\xf0\x9f\x87\xa6|\x3a\xc2\xad\xe0\xb8\xb1",
+        "\xe0\xb8\xb1|\xea\xb0\x80|\xe2\x80\x99|\x22|\xf0\x9f\x87\xa6|\xea\xb0\x81",
+        "\x61|\xf0\x9f\x87\xa6|\xea\xb0\x81\xe2\x80\x99\x5a|\xe2\x80\x99\xe0\xb8\xb1|\xe2\x80\xbf",
+        "\x39\xe2\x80\x8c|\x3a\xe0\xb8\xb1|\xf0\x9f\x87\xa8|\x2c|\xe2\x80\xbf\xe3\x83\xbc|\xef\xbc\x8e\xd8\x80",
+        "\xe0\xb8\xb3\xef\xb8\x8f|\x2c\xcc\x81|\xe1\x84\x80\xe1\x85\xa1\x30|\xc2\xb7",
+        "\xe1\x84\x80\x2e\xd7\x90\xea\xb0\x81",
+        "\x22|\xe3\x82\xa2|\xe0\xb8\xb3|\x21|\xe0\xb8\xb3|\xf0\x9f\x87\xa6|\xd7\x91|\xf0\x9f\x87\xa6|\xd7\x90|\x01|\xf0\x9f\x87\xa6",
+        "\xe0\xa4\x83|\xe0\xb8\xb3|\x21|\x2c|\x39\xe1\x84\x80\xd7\x91\xef\xb8\x8f|\x2e|\x3a|\x30\xd9\xa0\xe1\x84\x80",
+        "\xef\xb8\x8f|\xe2\x80\x99|\xe1\x84\x80|\x2d|\xe1\x84\x80\xc2\xad\xea\xb0\x80|\xf0\x9f\x87\xa8|\xc3\xa9|\xe4\xb8\x80|\xd7\x91|\xef\xbc\x8e",
+        "\xe0\xa4\x83|\xd7\x91|\xf0\x9f\x87\xa6|\xe0\xb8\x81|\xe2\x80\x99\xd8\x80|\x2d",
+        "\xd0\xb6\xe0\xb8\xb1|\xf0\x9f\x87\xa6|\x01|\xe0\xb5\x8e\xef\xb8\x8f",
+        "\xe3\x83\xbc|\x3a|\xef\xbc\x8e|\x21|\xe3\x81\x82|\xe3\x81\x82",
+        "\xf0\x9f\x98\x80|\xd9\xa0\xea\xb0\x80",
+        "\xcc\x81|\x27\xe2\x80\x8c",
+        "\xd7\x91|\x3a|\xc2\xb7|\xf0\x9f\x87\xa6|\x61\xe1\x86\xa8\xe2\x80\x8c\xe0\xa4\x83|\x2c|\x21|\xf0\x9f\x87\xa6",
+        "\x5f|\xe2\x9d\xa4",
+        "\xc2\xad\xcc\x81|\xf0\x9f\x98\x80\xe2\x80\x8c|\xd0\xb6\xd8\x80",
+        "\xd8\x80|\xf0\x9f\x87\xa6",
+        "\xd7\x90",
+        "\x2d|\x01|\xe3\x81\x82|\xe4\xb8\x80|\x21|\x22|\xe2\x80\xbf\xd7\x90|\xe2\x80\x99|\xf0\x9f\x98\x80\xf0\x9f\x8f\xbb|\xe3\x83\xbc",
+        "\x01|\xea\xb0\x80|\x3b|\xf0\x9f\x87\xa6|\xea\xb0\x80|\xe0\xb8\xb3|\x01|\x61\xe0\xb5\x8e\xe1\x86\xa8\xd8\x80|\xf0\x9f\x87\xa8",
+        "\xd0\xb6|\xc2\xb7|\xf0\x9f\x87\xa6\xf0\x9f\x8f\xbb|\xf0\x9f\x98\x80\xf0\x9f\x8f\xbb|\xea\xb0\x80\xe0\xa4\x83|\xe2\x80\x99|\xe3\x81\x82",
+        "\xe0\xb5\x8e\xe2\x80\xbf\xe0\xa4\x83\xea\xb0\x80\xea\xb0\x80|\x01|\xea\xb0\x81|\xc2\xb7",
+        "\x21|\xe3\x81\x82|\xea\xb0\x81\xef\xb8\x8f\xe0\xb8\xb1|\xf0\x9f\x87\xa6",
+        "\xe3\x82\xa2|\xe1\x85\xa1\xd7\x90\xe1\x84\x80",
+        "\xef\xb8\x8f|\xf0\x9f\x87\xa6|\x21\xe0\xb8\xb1|\xd9\xa0\xe1\x84\x80|\x2c\xe0\xa4\x83|\xe2\x80\xbf\xe2\x80\x8c\xe2\x80\xbf\xf0\x9f\x8f\xbb\xe0\xa4\x83",
+        "\x01|\xf0\x9f\x87\xa6\xd8\x80",
+        "\xe1\x86\xa8|\xf0\x9f\x98\x80|\xf0\x9f\x98\x80|\x3b|\xe3\x81\x82|\xea\xb0\x80|\xef\xbc\x8e|\xe4\xb8\x80\xe0\xb8\xb1|\xd7\x90\xe1\x85\xa1|\xf0\x9f\x98\x80|\x3b",
+        "\xea\xb0\x81\xe2\x80\xbf",
+        "\xe0\xb5\x8e|\x2d|\xd7\x91|\xe0\xb8\xb3|\xf0\x9f\x87\xa6|\xe3\x81\x82|\xe2\x80\x99|\xea\xb0\x80|\x2d",
+        "\xd7\x90|\x2d|\xe2\x9d\xa4|\xea\xb0\x81|\xef\xbc\x8e|\xe2\x80\x99|\x22|\xc3\xa9|\x2c",
+        "\xef\xb8\x8f|\xf0\x9f\x87\xa6|\xd7\x90",
+        "\xe0\xb8\xb1|\xea\xb0\x81\xe2\x80\x8c\xd7\x90",
+        "\xc3\xa9|\x2c|\xea\xb0\x81|\x01\xf0\x9f\x8f\xbb|\xd9\xa0|\xe2\x80\x99\xe0\xb8\xb1|\xe1\x86\xa8",
+        "\xe3\x82\xa2|\x27\xc2\xad|\xe3\x82\xa2\xe0\xa4\x83\xe2\x80\xbf\xe1\x86\xa8\xe1\x84\x80\xc3\xa9|\xe4\xb8\x80|\x22|\x2c|\x27|\x21",
+        "\xc3\xa9\xcc\x81\x3a\xcc\x81\xea\xb0\x81\xe2\x80\xbf\xe0\xb8\xb1",
+        "\x21",
+        "\xd7\x90",
+        "\xe0\xb8\x81|\x3b|\xe2\x9d\xa4|\xe1\x85\xa1\xd9\xa0|\xe2\x80\x99|\xf0\x9f\x87\xa6|\xd0\xb6\x27\xc3\xa9|\xf0\x9f\x87\xa8|\x61|\xf0\x9f\x87\xa6",
+        "\xe0\xb5\x8e\xe0\xb5\x8e|\x01|\xea\xb0\x80\x5a\xe2\x80\xbf\xcc\x81|\x2d|\xe2\x9d\xa4\xf0\x9f\x8f\xbb\xef\xb8\x8f|\xef\xbc\x8e|\xe3\x83\xbc\xcc\x81",
+        "\xd0\xb6",
+        "\xe2\x80\xbf\x5a\xef\xb8\x8f",
+        "\xe2\x80\x8c|\xe1\x86\xa8|\xf0\x9f\x87\xa6\xcc\x81|\x27|\xe3\x82\xa2|\xe1\x85\xa1\xd9\xa0|\xf0\x9f\x87\xa8|\xe4\xb8\x80|\xf0\x9f\x98\x80|\x61\xc2\xad\x5f",
+        "\xe2\x80\x8c",
+        "\xe2\x80\x99\xe2\x80\x8c|\x2c|\x01|\xd0\xb6|\x2e",
+        "\xe2\x80\xbf\xe1\x84\x80\xe1\x85\xa1|\x3a\xe2\x80\x8c\xef\xb8\x8f",
+        "\xf0\x9f\x87\xa6\xef\xb8\x8f|\x01|\xf0\x9f\x87\xa6\xe0\xa4\x83",
+        "\xe0\xa4\x83|\xd7\x90|\xe4\xb8\x80\xe0\xa4\x83|\x5a\xea\xb0\x80|\xe3\x82\xa2\xe3\x83\xbc",
+    };
+    for(isize i = 0; i < ARRAY_COUNT(grapheme_vectors); i++)
+        TEST(_test_unicode_segment_is(unicode_grapheme_next, grapheme_vectors[i]));
+    for(isize i = 0; i < ARRAY_COUNT(word_vectors); i++)
+        TEST(_test_unicode_segment_is(unicode_word_next, word_vectors[i]));
+
+    //Hand picked graphemes: CR LF, e + acute, Hangul L V T, flags in pairs, emoji ZWJ sequences with modifiers
+    TEST(_test_unicode_segment_is(unicode_grapheme_next, "a|b|\r\n|\n|\r|c"));
+    TEST(_test_unicode_segment_is(unicode_grapheme_next, "e\xcc\x81|x|\xc3\xa9"));
+    TEST(_test_unicode_segment_is(unicode_grapheme_next, "\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8|\xea\xb0\x80\xe1\x86\xa8|\xe1\x84\x80"));
+    TEST(_test_unicode_segment_is(unicode_grapheme_next, "\xf0\x9f\x87\xa8\xf0\x9f\x87\xbf|\xf0\x9f\x87\xa9\xf0\x9f\x87\xaa|\xf0\x9f\x87\xa6"));
+    TEST(_test_unicode_segment_is(unicode_grapheme_next, "\xf0\x9f\x91\xa9\xf0\x9f\x8f\xbd\xe2\x80\x8d\xf0\x9f\x92\xbb|!"));
+    TEST(_test_unicode_segment_is(unicode_grapheme_next, "a\xe2\x80\x8d|\xf0\x9f\x98\x80"));
+    TEST(_test_unicode_segment_is(unicode_grapheme_next, "\xe0\xa4\x95\xe0\xa4\xbf|\xe0\xa4\xb8"));
+
+    //Hand picked words: punctuation inside words and numbers, Hebrew quotes, Katakana, ideographs one by one,
+    // spaces, ZWJ and marks being ignored, ZWJ before an emoji and letters which are also pictographic
+    TEST(_test_unicode_segment_is(unicode_word_next, "Hello|,| |world|!"));
+    TEST(_test_unicode_segment_is(unicode_word_next, "can't| |e.g|.| |3.14,159|,| |a_b"));
+    TEST(_test_unicode_segment_is(unicode_word_next, "The| |quick| |(|\"|brown|\"|)| |fox|  |can't| |jump| |32.3| |feet|,| |right|?"));
+    TEST(_test_unicode_segment_is(unicode_word_next, "\xd7\xa6\xd7\x94\"\xd7\x9c| |\xd7\x90'|\""));
+    TEST(_test_unicode_segment_is(unicode_word_next, "\xe3\x82\xab\xe3\x82\xbf\xe3\x82\xab\xe3\x83\x8a|\xe6\x97\xa5|\xe6\x9c\xac|\xe3\x81\xaf"));
+    TEST(_test_unicode_segment_is(unicode_word_next, "a|  |\t|b|\r\n|\n|c"));
+    TEST(_test_unicode_segment_is(unicode_word_next, "a\xcc\x81\xe2\x80\x8d" "b|."));
+    TEST(_test_unicode_segment_is(unicode_word_next, "a.\xe2\x80\x8d" "b| |1.\xcc\x81" "2"));
+    TEST(_test_unicode_segment_is(unicode_word_next, "a|.\xe2\x80\x8d\xf0\x9f\x98\x80| |\xf0\x9f\x98\x80|\xf0\x9f\x98\x80"));
+    TEST(_test_unicode_segment_is(unicode_word_next, "a\xe2\x93\x82" "b| |\xf0\x9f\x87\xa8\xf0\x9f\x87\xbf|\xf0\x9f\x87\xa6"));
+
+    //ASCII words longer than a 16 byte block
+    TEST(_test_unicode_segment_is(unicode_word_next, "abcdefghijklmnopqrstuvwxyz_0123456789z's| |x.y.z|.|0123456789abcdefghijk|.|.|x"));
+    TEST(_test_unicode_segment_is(unicode_word_next, "3.14159265358979323846,2643383279|  |aaaaaaaaaaaaaaaaaaaaaaa\xcc\x81" "b|\xf0\x9f\x98\x80"));
+
+    TEST(_test_unicode_word_kind("hello 123 a1 ...", 0) == UNICODE_WORD_LETTER);
+    TEST(_test_unicode_word_kind("hello 123 a1 ...", 1) == UNICODE_WORD_NONE);
+    TEST(_test_unicode_word_kind("hello 123 a1 ...", 2) == UNICODE_WORD_NUMBER);
+    TEST(_test_unicode_word_kind("hello 123 a1 ...", 4) == UNICODE_WORD_LETTER);
+    TEST(_test_unicode_word_kind("hello 123 a1 ...", 6) == UNICODE_WORD_NONE);
+    TEST(_test_unicode_word_kind("\xe6\x97\xa5", 0) == UNICODE_WORD_LETTER);
+    TEST(_test_unicode_word_kind("abcdefghijklmnopqrstuvwxyz0123456789 x", 0) == UNICODE_WORD_LETTER);
+    TEST(_test_unicode_word_kind("0123456789012345678.9e ", 0) == UNICODE_WORD_LETTER);
+    TEST(_test_unicode_word_kind("01234567890123456789.5 ", 0) == UNICODE_WORD_NUMBER);
+
+    //Invalid bytes are segmented on their own
+    TEST(_test_unicode_segment_is(unicode_grapheme_next, "\xff|\xfe|a|\xc3|\xc3"));
+    TEST(_test_unicode_segment_is(unicode_word_next, "ab|\xff|cd|\xed|\xa0|\x80"));
+
+    TEST(unicode_grapheme_break('\r') == UNICODE_GRAPHEME_CR);
+    TEST(unicode_grapheme_break(0x0301) == UNICODE_GRAPHEME_EXTEND);
+    TEST(unicode_grapheme_break(0xAC00) == UNICODE_GRAPHEME_LV);
+    TEST(unicode_grapheme_break(0x1F600) == UNICODE_GRAPHEME_EXTENDED_PICTOGRAPHIC);
+    TEST(unicode_grapheme_break(0x110000) == UNICODE_GRAPHEME_OTHER);
+    TEST(unicode_word_break('a') == UNICODE_WORD_BREAK_ALETTER);
+    TEST(unicode_word_break('.') == UNICODE_WORD_BREAK_MID_NUM_LET);
+    TEST(unicode_word_break(0x05D0) == UNICODE_WORD_BREAK_HEBREW_LETTER);
+    TEST(unicode_word_break(0x4E00) == UNICODE_WORD_BREAK_OTHER_LETTER);
+    TEST(unicode_word_break(0x24C2) == UNICODE_WORD_BREAK_ALETTER_PICTOGRAPHIC);
+    for(uint32_t c = 0; c < 128; c++) {
+        TEST(unicode_grapheme_break(c) == UNICODE_GRAPHEME_ASCII[c]);
+        TEST(unicode_word_break(c) == UNICODE_WORD_ASCII[c]);
+    }
+
+    //Random bytes and random code points of all planes just need to be covered exactly, streamed or not
+    for(isize r = 0; r < 2000; r++) {
+        char text[128] = {0};
+        char joined[256] = {0};
+        isize size = random_range(0, 64);
+        if(r % 2)
+            random_bytes(text, size);
+        else {
+            isize written = 0;
+            while(written < size - 4)
+                utf8_encode(text, sizeof text, (uint32_t) random_range(0, UTF_MAX + 1), &written);
+            size = written;
+        }
+        _test_unicode_segment_join(unicode_grapheme_next, text, size, joined, sizeof joined);
+        _test_unicode_segment_join(unicode_word_next, text, size, joined, sizeof joined);
+    }
+}
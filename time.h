@@ -23,6 +23,7 @@ EXTERNAL int64_t clock_ns();         //returns time in nanoseconds since since u
 EXTERNAL double clock_sec();         //returns time in seconds since last call to clock_sec_set(x) plus x
 EXTERNAL float  clock_secf();        //returns time in seconds since last call to clock_sec_set(x) plus x as float
 EXTERNAL double clock_sec_set(double to_time); //sets the base for clock_sec and return the previous time 
+EXTERNAL int64_t clock_tsc_frequency(); //returns the calibrated frequency of the TSC backing clock_ns or 0 if clock_ns uses the OS clock
 
 //@NOTE: 
 //For clock_sec we might be scared that the int64_t to double conversion will cost us precision for sufficiently large 
@@ -31,6 +32,20 @@ EXTERNAL double clock_sec_set(double to_time); //sets the base for clock_sec and
 // integer precision, that is around 9e15. Thus it is able to represent numbers up to ~1e9 with precision of 1e-7 seconds.
 // This means that we will start to lose precision after 1e9 seconds = 31 years. If you dont run your program for 31 
 // years you should be fine.   
+//
+//On linux clock_gettime costs 20-60ns (more in some VMs) which adds up when clock_ns is called tens of millions of
+// times per second (tracing, rate limiters). When the CPU has an invariant TSC (checked through CPUID) we instead 
+// calculate the time from the TSC: 
+// 1. On first use we measure the TSC frequency against CLOCK_MONOTONIC_RAW over CLOCK_TSC_CALIBRATION_NS.
+// 2. clock_ns is then base_ns + (rdtsc() - base_tsc)*mult in fixed point - a few ns.
+// 3. Every CLOCK_TSC_RESYNC_NS we take a new (tsc, ns) pair, recalculate the frequency from all time elapsed since
+//    calibration (so it keeps getting more precise) and adjust mult so that any accumulated error is smoothed out over
+//    the next interval instead of jumping. The first resyncs come sooner (starting at 8x the calibration time and 
+//    doubling) so that the short initial calibration is refined quickly. The smoothing rate applies to one interval 
+//    only, past it the plain frequency is used so that sparse callers do not overcorrect. Only falling behind by more 
+//    than CLOCK_TSC_MAX_SLEW_NS (suspend, migration) jumps forward. The clock never goes backwards.
+// The parameters are guarded by a seqlock so readers never block and never see a half updated state. 
+// Define CLOCK_NO_TSC to always use clock_gettime.
 #endif // !MODULE_TIME
 
 #if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_TIME)) && !defined(MODULE_HAS_IMPL_TIME)
@@ -102,16 +117,244 @@ EXTERNAL double clock_sec_set(double to_time); //sets the base for clock_sec and
             return clock_ticks()*100;
         }
 
+        EXTERNAL int64_t clock_tsc_frequency() { return 0; }
+
     #elif defined(__linux__) || (defined(__APPLE__) && defined(__MACH__))
         #include <time.h>
-        EXTERNAL int64_t clock_ticks()
+        static int64_t _clock_ns_os()
         {
             struct timespec ts = {0};
             (void) clock_gettime(CLOCK_MONOTONIC_RAW , &ts);
             return (int64_t) ts.tv_nsec + ts.tv_sec * 1000000000LL;
         }
+
+        #if defined(__linux__) && (defined(__x86_64__) || defined(__i386__)) && !defined(CLOCK_NO_TSC)
+            #include <x86intrin.h>
+            #include <cpuid.h>
+
+            #ifndef CLOCK_TSC_CALIBRATION_NS
+                #define CLOCK_TSC_CALIBRATION_NS 5000000    //5ms
+            #endif
+            #ifndef CLOCK_TSC_RESYNC_NS
+                #define CLOCK_TSC_RESYNC_NS      500000000  //0.5s
+            #endif
+            #ifndef CLOCK_TSC_MAX_SLEW_NS
+                #define CLOCK_TSC_MAX_SLEW_NS    1000000    //1ms
+            #endif
+
+            enum {
+                _CLOCK_TSC_UNINIT = 0,
+                _CLOCK_TSC_INITIALIZING = 1,
+                _CLOCK_TSC_READY = 2,
+                _CLOCK_TSC_UNSUPPORTED = 3,
+            };
+
+            typedef struct _Clock_Tsc {
+                uint32_t state;
+                uint32_t version;       //seqlock. Odd while the fields below are being updated
+                uint64_t base_tsc;
+                int64_t  base_ns;
+                uint64_t mult;          //ns per tick in 32.32 fixed point used until base_tsc + resync_ticks. Includes the smoothing of the last error.
+                uint64_t rate;          //ns per tick in 32.32 fixed point as measured, without smoothing
+                uint64_t resync_ticks;
+                int64_t  resync_ns;     //the current resync interval. Grows up to CLOCK_TSC_RESYNC_NS
+                int64_t  sync_ns;       //the OS time at base_tsc
+                uint64_t first_tsc;     //the calibration point. Used to calculate the frequency over as long period as possible.
+                int64_t  first_ns;
+            } _Clock_Tsc;
+
+            _Clock_Tsc g_clock_tsc = {0};
+
+            //Reads the TSC and OS clock as close together as possible. Keeps the narrowest of a few tries since
+            // a single preemption between the reads would otherwise skew the calibrated frequency by hundreds of ppm.
+            static void _clock_tsc_sample(uint64_t* tsc, int64_t* ns)
+            {
+                uint64_t best_window = UINT64_MAX;
+                for(int i = 0; i < 5; i++) {
+                    uint64_t before = __rdtsc();
+                    int64_t os_ns = _clock_ns_os();
+                    uint64_t after = __rdtsc();
+                    if(after - before < best_window) {
+                        best_window = after - before;
+                        *ns = os_ns;
+                        *tsc = before + (after - before)/2;
+                    }
+                }
+            }
+
+            static uint64_t _clock_tsc_mult(int64_t ns, uint64_t ticks)
+            {
+                return (uint64_t) (((__uint128_t) (uint64_t) ns << 32) / ticks);
+            }
+
+            //The TSC must be going forward at a plausible rate (100MHz to 20GHz)
+            static bool _clock_tsc_is_plausible(int64_t ns, uint64_t ticks)
+            {
+                return ns > 0 && ticks > 0 && ticks/100 >= (uint64_t) ns / 1000 && ticks/20 <= (uint64_t) ns;
+            }
+
+            __attribute__((noinline)) static void _clock_tsc_init()
+            {
+                uint32_t expected = _CLOCK_TSC_UNINIT;
+                if(__atomic_compare_exchange_n(&g_clock_tsc.state, &expected, _CLOCK_TSC_INITIALIZING, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) == 0)
+                    return;
+
+                //Invariant TSC runs at constant rate regardless of power states: CPUID.80000007H:EDX[8]
+                unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+                int invariant = __get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) && eax >= 0x80000007
+                    && __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) && (edx & (1u << 8));
+
+                uint32_t state = _CLOCK_TSC_UNSUPPORTED;
+                if(invariant) {
+                    uint64_t tsc0 = 0, tsc1 = 0;
+                    int64_t ns0 = 0, ns1 = 0;
+                    _clock_tsc_sample(&tsc0, &ns0);
+                    do _clock_tsc_sample(&tsc1, &ns1);
+                    while(ns1 - ns0 < CLOCK_TSC_CALIBRATION_NS);
+
+                    if(tsc1 > tsc0 && _clock_tsc_is_plausible(ns1 - ns0, tsc1 - tsc0)) {
+                        g_clock_tsc.first_tsc = tsc0;
+                        g_clock_tsc.first_ns = ns0;
+                        g_clock_tsc.base_tsc = tsc1;
+                        g_clock_tsc.base_ns = ns1;
+                        g_clock_tsc.sync_ns = ns1;
+                        g_clock_tsc.rate = _clock_tsc_mult(ns1 - ns0, tsc1 - tsc0);
+                        g_clock_tsc.mult = g_clock_tsc.rate;
+                        g_clock_tsc.resync_ns = CLOCK_TSC_CALIBRATION_NS*8 < CLOCK_TSC_RESYNC_NS ? CLOCK_TSC_CALIBRATION_NS*8 : CLOCK_TSC_RESYNC_NS;
+                        g_clock_tsc.resync_ticks = ((uint64_t) g_clock_tsc.resync_ns << 32) / g_clock_tsc.rate;
+                        state = _CLOCK_TSC_READY;
+                    }
+                }
+                __atomic_store_n(&g_clock_tsc.state, state, __ATOMIC_RELEASE);
+            }
+
+            //Called when the last sync point is older than the resync interval. Returns -1 if another thread is already
+            // resyncing in which case the caller retries once it is done.
+            __attribute__((noinline)) static int64_t _clock_tsc_resync()
+            {
+                uint32_t version = __atomic_load_n(&g_clock_tsc.version, __ATOMIC_RELAXED);
+                if((version & 1) || __atomic_compare_exchange_n(&g_clock_tsc.version, &version, version + 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) == 0)
+                    return -1;
+                __atomic_thread_fence(__ATOMIC_RELEASE);
+
+                uint64_t tsc = 0;
+                int64_t ns = 0;
+                _clock_tsc_sample(&tsc, &ns);
+
+                //The largest value the fast path could have returned since the last sync. We must not go below it.
+                _Clock_Tsc* clock = &g_clock_tsc;
+                int64_t returned_max = clock->base_ns + (int64_t) ((clock->resync_ticks * clock->mult) >> 32);
+                int64_t out = 0;
+                if(tsc <= clock->base_tsc) {
+                    //The TSC went backwards (reset, different socket). Continue from the OS time but never backwards.
+                    out = ns > returned_max ? ns : returned_max;
+                    clock->first_tsc = tsc;
+                    clock->first_ns = ns;
+                }
+                else {
+                    //The smoothed mult covers only the first resync_ticks. Past that we advance with the measured rate.
+                    uint64_t delta = tsc - clock->base_tsc;
+                    int64_t predicted = returned_max;
+                    if(delta > clock->resync_ticks)
+                        predicted += (int64_t) (((__uint128_t) (delta - clock->resync_ticks) * clock->rate) >> 32);
+                    else
+                        predicted = clock->base_ns + (int64_t) (((__uint128_t) delta * clock->mult) >> 32);
+
+                    int64_t error = predicted - ns;
+                    if(error < -CLOCK_TSC_MAX_SLEW_NS) {
+                        //Fell far behind (suspend, migration). Jump forward to the OS time and start measuring the 
+                        // frequency anew from the last interval.
+                        if(_clock_tsc_is_plausible(ns - clock->sync_ns, delta))
+                            clock->rate = _clock_tsc_mult(ns - clock->sync_ns, delta);
+                        clock->first_tsc = tsc;
+                        clock->first_ns = ns;
+                        out = ns;
+                    }
+                    else {
+                        uint64_t ticks = tsc - clock->first_tsc;
+                        if(tsc > clock->first_tsc && _clock_tsc_is_plausible(ns - clock->first_ns, ticks))
+                            clock->rate = _clock_tsc_mult(ns - clock->first_ns, ticks);
+                        out = predicted;
+                    }
+                }
+
+                if(clock->resync_ns < CLOCK_TSC_RESYNC_NS)
+                    clock->resync_ns = clock->resync_ns*2 < CLOCK_TSC_RESYNC_NS ? clock->resync_ns*2 : CLOCK_TSC_RESYNC_NS;
+
+                //Continue from out so there is no jump. Correct the rate so that the error is gone by the next resync: 
+                // over resync_ns we want to advance by resync_ns - error. At most half of the interval is corrected at once
+                // so that a clock far ahead of the OS slows down instead of stopping or going backwards.
+                int64_t error = out - ns;
+                int64_t max_correction = clock->resync_ns/2;
+                if(error > max_correction)
+                    error = max_correction;
+                if(error < -max_correction)
+                    error = -max_correction;
+
+                clock->base_tsc = tsc;
+                clock->base_ns = out;
+                clock->sync_ns = ns;
+                clock->mult = (uint64_t) ((__uint128_t) clock->rate * (uint64_t) (clock->resync_ns - error) / (uint64_t) clock->resync_ns);
+                clock->resync_ticks = ((uint64_t) clock->resync_ns << 32) / clock->rate;
+
+                __atomic_store_n(&g_clock_tsc.version, version + 2, __ATOMIC_RELEASE);
+                return out;
+            }
+
+            EXTERNAL int64_t clock_ns()
+            {
+                for(;;) {
+                    uint32_t version = __atomic_load_n(&g_clock_tsc.version, __ATOMIC_ACQUIRE);
+                    uint32_t state = __atomic_load_n(&g_clock_tsc.state, __ATOMIC_ACQUIRE);
+                    if(state != _CLOCK_TSC_READY) {
+                        if(state == _CLOCK_TSC_UNINIT) {
+                            _clock_tsc_init();
+                            continue;
+                        }
+                        return _clock_ns_os();
+                    }
+
+                    uint64_t base_tsc = __atomic_load_n(&g_clock_tsc.base_tsc, __ATOMIC_RELAXED);
+                    int64_t base_ns = __atomic_load_n(&g_clock_tsc.base_ns, __ATOMIC_RELAXED);
+                    uint64_t mult = __atomic_load_n(&g_clock_tsc.mult, __ATOMIC_RELAXED);
+                    uint64_t resync_ticks = __atomic_load_n(&g_clock_tsc.resync_ticks, __ATOMIC_RELAXED);
+                    uint64_t delta = __rdtsc() - base_tsc;
+
+                    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+                    if((version & 1) || __atomic_load_n(&g_clock_tsc.version, __ATOMIC_RELAXED) != version)
+                        continue;
+
+                    //Also catches tsc behind base_tsc (read on different core) since delta wraps around
+                    if(delta >= resync_ticks) {
+                        //Read on a core whose TSC is slightly behind. Not worth a resync.
+                        if((int64_t) delta < 0 && (uint64_t) -(int64_t) delta < resync_ticks)
+                            return base_ns;
+
+                        int64_t out = _clock_tsc_resync();
+                        if(out < 0)
+                            continue;
+                        return out;
+                    }
+
+                    //delta*mult fits into 64 bits since delta < resync_ticks ~ CLOCK_TSC_RESYNC_NS/mult
+                    return base_ns + (int64_t) ((delta * mult) >> 32);
+                }
+            }
+
+            EXTERNAL int64_t clock_tsc_frequency()
+            {
+                clock_ns();
+                if(__atomic_load_n(&g_clock_tsc.state, __ATOMIC_ACQUIRE) != _CLOCK_TSC_READY)
+                    return 0;
+                return (int64_t) (((__uint128_t) 1000000000 << 32) / __atomic_load_n(&g_clock_tsc.rate, __ATOMIC_RELAXED));
+            }
+        #else
+            EXTERNAL int64_t clock_ns()             { return _clock_ns_os(); }
+            EXTERNAL int64_t clock_tsc_frequency()  { return 0; }
+        #endif
+
+        EXTERNAL int64_t clock_ticks()           { return clock_ns(); }
         EXTERNAL int64_t clock_ticks_frequency() { return (int64_t) 1000000000LL; }
-        EXTERNAL int64_t clock_ns()         { return clock_ticks(); }
         EXTERNAL int64_t epoch_time()       
         { 
             struct timespec ts = {0};
@@ -0,0 +1,2904 @@
+#ifndef MODULE_UNICODE_NORM
+#define MODULE_UNICODE_NORM
+
+//Unicode case folding and canonical normalization (NFD and NFC) working directly on UTF-8 buffers.
+//
+//All lookups go through a single two stage table indexed by the code point which gives its combining class,
+// quick check flags and where to find its full canonical decomposition, full case folding and the compositions
+// it starts. Hangul syllables are decomposed and composed algorithmically.
+//
+//Most text is already normalized so the normalizers first run the quick check (UAX#15): they skip over code points
+// which certainly do not change and copy them in bulk, and only the segments around the ones which might change
+// (a starter and its combining marks) are decoded, decomposed, reordered and composed. Code points below U+0300
+// (for NFC) and U+00C0 (for NFD) cannot change at all and are skipped 16 bytes at a time, as is ASCII when case folding.
+// Case folding is the full folding of CaseFolding.txt (statuses C and F) so for example "Straße" folds to "strasse".
+// Its result is not necessarily normalized, normalize after folding if both are needed.
+//
+//The functions writing UTF-8 follow snprintf: they return the size of the whole result but write only the
+// part which fits into output_size. The result is never more than UNICODE_NORM_MAX_GROWTH times the input.
+// Bytes which are not valid UTF-8 are copied unchanged and break segments.
+//Segments longer than UNICODE_NORM_SEGMENT_MAX code points (more than ten times the 30 combining marks allowed by
+// the Stream-Safe Text Format) are normalized in pieces.
+//
+//The second half of the file is generated by unicode_norm_format_tables_file from UnicodeData.txt, CaseFolding.txt
+// and CompositionExclusions.txt (https://www.unicode.org/Public/UCD/latest/ucd/).
+//The tables are still of Unicode 14.0 while unicode.h is of 16.0. Code points assigned since then have combining
+// class 0, no decomposition and no folding here, so they are copied unchanged. Regenerate the tables from the 16.0
+// files (https://www.unicode.org/Public/16.0.0/ucd/) to bring the two in line.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "utf.h"
+
+#ifndef EXTERNAL
+    #define EXTERNAL
+#endif
+
+#define UNICODE_NORM_MAX_GROWTH         3   //the output of any function here is at most this many times bigger than input
+#define UNICODE_NORM_MAX_DECOMPOSITION  4   //the longest full canonical decomposition of a single code point
+#define UNICODE_NORM_MAX_FOLD           3   //the longest full case folding of a single code point
+#define UNICODE_NORM_SEGMENT_MAX        320 //code points
+
+#define UNICODE_NORM_BLOCK_SHIFT        7
+
+typedef enum Unicode_Norm_Flags {
+    UNICODE_NORM_NFD_NO     = 1, //has a canonical decomposition
+    UNICODE_NORM_NFC_NO     = 2, //has a canonical decomposition but never appears in NFC
+    UNICODE_NORM_NFC_MAYBE  = 4, //can compose with a preceding code point
+} Unicode_Norm_Flags;
+
+typedef struct Unicode_Norm_Info {
+    uint8_t combining_class;
+    uint8_t flags;
+    uint8_t decomposition_count;
+    uint8_t fold_count;
+    uint16_t decomposition_index;   //into UNICODE_NORM_CODEPOINTS
+    uint16_t fold_index;            //into UNICODE_NORM_CODEPOINTS
+    uint16_t compose_index;         //into UNICODE_NORM_COMPOSITIONS, the ones this code point is the first of
+    uint16_t compose_count;
+} Unicode_Norm_Info;
+
+typedef struct Unicode_Norm_Composition {
+    uint32_t second;
+    uint32_t composite;
+} Unicode_Norm_Composition;
+
+extern const uint16_t UNICODE_NORM_BLOCKS[];            //code point >> UNICODE_NORM_BLOCK_SHIFT -> block
+extern const uint16_t UNICODE_NORM_INDICES[];           //block << UNICODE_NORM_BLOCK_SHIFT | low bits -> info
+extern const Unicode_Norm_Info UNICODE_NORM_INFOS[];
+extern const uint32_t UNICODE_NORM_CODEPOINTS[];
+extern const Unicode_Norm_Composition UNICODE_NORM_COMPOSITIONS[];
+
+//Returns the normalization properties of codepoint. Code points without any have all fields 0.
+EXTERNAL const Unicode_Norm_Info* unicode_norm_info(uint32_t codepoint);
+EXTERNAL uint8_t unicode_combining_class(uint32_t codepoint);
+//Writes the full canonical decomposition of codepoint (or just codepoint if it has none) into out and returns its length.
+EXTERNAL int32_t unicode_decompose(uint32_t codepoint, uint32_t out[UNICODE_NORM_MAX_DECOMPOSITION]);
+//Returns the primary composite of first followed by second or 0 if there is none.
+EXTERNAL uint32_t unicode_compose(uint32_t first, uint32_t second);
+//Writes the full case folding of codepoint (or just codepoint if it has none) into out and returns its length.
+EXTERNAL int32_t unicode_casefold_codepoint(uint32_t codepoint, uint32_t out[UNICODE_NORM_MAX_FOLD]);
+
+//Return input_size if input is certainly in the given form, else the offset of the first code point which might not be.
+EXTERNAL isize unicode_nfc_quick_check(const void* input, isize input_size);
+EXTERNAL isize unicode_nfd_quick_check(const void* input, isize input_size);
+EXTERNAL isize unicode_casefold_quick_check(const void* input, isize input_size);
+
+//Write the normalized/case folded input into output and return the size of the result (see above). output and input must not overlap.
+EXTERNAL isize unicode_nfc(void* output, isize output_size, const void* input, isize input_size);
+EXTERNAL isize unicode_nfd(void* output, isize output_size, const void* input, isize input_size);
+EXTERNAL isize unicode_casefold(void* output, isize output_size, const void* input, isize input_size);
+
+//Making the generated section of this file
+EXTERNAL bool unicode_norm_format_tables_file(const char* unicode_data, const char* case_folding, const char* composition_exclusions, const char* out);
+#endif
+
+#if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_UNICODE_NORM)) && !defined(MODULE_HAS_IMPL_UNICODE_NORM)
+#define MODULE_HAS_IMPL_UNICODE_NORM
+
+#ifndef ASSERT
+    #include <assert.h>
+    #define ASSERT(x, ...) assert(x)
+#endif
+
+#ifndef INTERNAL
+    #define INTERNAL static
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define _UNICODE_NORM_SSE
+#endif
+
+#define _UNICODE_NORM_INVALID 0xFFFFFFFF
+#define _UNICODE_NORM_NFC_SAFE_BELOW 0xCC //lead byte of U+0300, the first code point which is not a NFC stable starter
+#define _UNICODE_NORM_NFD_SAFE_BELOW 0xC3 //lead byte of U+00C0, the first code point which is not a NFD stable starter
+
+#define _UNICODE_HANGUL_S_BASE  0xAC00
+#define _UNICODE_HANGUL_L_BASE  0x1100
+#define _UNICODE_HANGUL_V_BASE  0x1161
+#define _UNICODE_HANGUL_T_BASE  0x11A7
+#define _UNICODE_HANGUL_L_COUNT 19
+#define _UNICODE_HANGUL_V_COUNT 21
+#define _UNICODE_HANGUL_T_COUNT 28
+#define _UNICODE_HANGUL_N_COUNT (_UNICODE_HANGUL_V_COUNT*_UNICODE_HANGUL_T_COUNT)
+#define _UNICODE_HANGUL_S_COUNT (_UNICODE_HANGUL_L_COUNT*_UNICODE_HANGUL_N_COUNT)
+
+EXTERNAL const Unicode_Norm_Info* unicode_norm_info(uint32_t codepoint)
+{
+    if(codepoint > UTF_MAX)
+        return &UNICODE_NORM_INFOS[0];
+    uint32_t block = UNICODE_NORM_BLOCKS[codepoint >> UNICODE_NORM_BLOCK_SHIFT];
+    uint32_t low = codepoint & ((1u << UNICODE_NORM_BLOCK_SHIFT) - 1);
+    return &UNICODE_NORM_INFOS[UNICODE_NORM_INDICES[block << UNICODE_NORM_BLOCK_SHIFT | low]];
+}
+
+EXTERNAL uint8_t unicode_combining_class(uint32_t codepoint)
+{
+    return unicode_norm_info(codepoint)->combining_class;
+}
+
+EXTERNAL int32_t unicode_decompose(uint32_t codepoint, uint32_t out[UNICODE_NORM_MAX_DECOMPOSITION])
+{
+    uint32_t s = codepoint - _UNICODE_HANGUL_S_BASE;
+    if(s < _UNICODE_HANGUL_S_COUNT) {
+        out[0] = _UNICODE_HANGUL_L_BASE + s/_UNICODE_HANGUL_N_COUNT;
+        out[1] = _UNICODE_HANGUL_V_BASE + s%_UNICODE_HANGUL_N_COUNT/_UNICODE_HANGUL_T_COUNT;
+        out[2] = _UNICODE_HANGUL_T_BASE + s%_UNICODE_HANGUL_T_COUNT;
+        return out[2] == _UNICODE_HANGUL_T_BASE ? 2 : 3;
+    }
+
+    const Unicode_Norm_Info* info = unicode_norm_info(codepoint);
+    if(info->decomposition_count == 0) {
+        out[0] = codepoint;
+        return 1;
+    }
+    for(int32_t i = 0; i < info->decomposition_count; i++)
+        out[i] = UNICODE_NORM_CODEPOINTS[info->decomposition_index + i];
+    return info->decomposition_count;
+}
+
+EXTERNAL uint32_t unicode_compose(uint32_t first, uint32_t second)
+{
+    //Hangul L + V and LV + T
+    uint32_t l = first - _UNICODE_HANGUL_L_BASE;
+    uint32_t v = second - _UNICODE_HANGUL_V_BASE;
+    if(l < _UNICODE_HANGUL_L_COUNT && v < _UNICODE_HANGUL_V_COUNT)
+        return _UNICODE_HANGUL_S_BASE + (l*_UNICODE_HANGUL_V_COUNT + v)*_UNICODE_HANGUL_T_COUNT;
+
+    uint32_t s = first - _UNICODE_HANGUL_S_BASE;
+    uint32_t t = second - _UNICODE_HANGUL_T_BASE;
+    if(s < _UNICODE_HANGUL_S_COUNT && s % _UNICODE_HANGUL_T_COUNT == 0 && 0 < t && t < _UNICODE_HANGUL_T_COUNT)
+        return first + t;
+
+    //The compositions of a single code point are few (at most a few dozen for latin vowels) so a linear scan is enough
+    const Unicode_Norm_Info* info = unicode_norm_info(first);
+    const Unicode_Norm_Composition* compositions = UNICODE_NORM_COMPOSITIONS + info->compose_index;
+    for(uint32_t i = 0; i < info->compose_count; i++)
+        if(compositions[i].second == second)
+            return compositions[i].composite;
+    return 0;
+}
+
+EXTERNAL int32_t unicode_casefold_codepoint(uint32_t codepoint, uint32_t out[UNICODE_NORM_MAX_FOLD])
+{
+    const Unicode_Norm_Info* info = unicode_norm_info(codepoint);
+    if(info->fold_count == 0) {
+        out[0] = codepoint;
+        return 1;
+    }
+    for(int32_t i = 0; i < info->fold_count; i++)
+        out[i] = UNICODE_NORM_CODEPOINTS[info->fold_index + i];
+    return info->fold_count;
+}
+
+//Decodes the code point at *index. Invalid bytes decode one at a time as _UNICODE_NORM_INVALID.
+INTERNAL uint32_t _unicode_norm_decode(const uint8_t* in, isize size, isize* index)
+{
+    uint8_t first = in[*index];
+    if(first < 0x80) {
+        *index += 1;
+        return first;
+    }
+
+    //Two byte sequences cover all of latin, greek, cyrillic, hebrew and arabic so they skip the general decoder
+    if(first - 0xC2u <= 0xDF - 0xC2 && *index + 1 < size && (in[*index + 1] & 0xC0) == 0x80) {
+        uint32_t codepoint = (uint32_t) (first & 0x1F) << 6 | (in[*index + 1] & 0x3F);
+        *index += 2;
+        return codepoint;
+    }
+
+    uint32_t codepoint = 0;
+    if(utf8_decode(in, size, &codepoint, index))
+        return codepoint;
+    *index += 1;
+    return _UNICODE_NORM_INVALID;
+}
+
+INTERNAL void _unicode_norm_put_bytes(uint8_t* out, isize out_size, isize* at, const uint8_t* data, isize size)
+{
+    //Single code points are copied bytewise, calling memcpy for them is slower
+    if(size <= 4 && *at + size <= out_size)
+        for(isize i = 0; i < size; i++)
+            out[*at + i] = data[i];
+    else if(*at < out_size)
+        memcpy(out + *at, data, (size_t) (size < out_size - *at ? size : out_size - *at));
+    *at += size;
+}
+
+INTERNAL void _unicode_norm_put(uint8_t* out, isize out_size, isize* at, uint32_t codepoint)
+{
+    uint8_t encoded[4];
+    isize size = 0;
+    utf8_encode(encoded, sizeof encoded, codepoint, &size);
+    _unicode_norm_put_bytes(out, out_size, at, encoded, size);
+}
+
+//Returns the first index from from on with in[index] >= limit.
+INTERNAL isize _unicode_norm_skip_below(const uint8_t* in, isize from, isize size, uint8_t limit)
+{
+    isize i = from;
+    #ifdef _UNICODE_NORM_SSE
+        //There is no unsigned byte compare so both sides are shifted into the signed range
+        __m128i flip = _mm_set1_epi8((char) 0x80);
+        __m128i bound = _mm_set1_epi8((char) (limit ^ 0x80));
+        for(; i + 16 <= size; i += 16) {
+            __m128i bytes = _mm_xor_si128(_mm_loadu_si128((const __m128i*) (const void*) (in + i)), flip);
+            if(_mm_movemask_epi8(_mm_cmplt_epi8(bytes, bound)) != 0xFFFF)
+                break;
+        }
+    #endif
+    for(; i < size && in[i] < limit; i++);
+    return i;
+}
+
+//Returns where the segment containing the code point at at begins: the last starter before it
+// not before from, or at itself when an invalid byte comes first.
+INTERNAL isize _unicode_norm_segment_start(const uint8_t* in, isize from, isize at)
+{
+    isize i = at;
+    while(i > from) {
+        isize prev = i - 1;
+        for(isize k = 0; k < 3 && prev > from && (in[prev] & 0xC0) == 0x80; k++)
+            prev--;
+
+        isize decoded_to = prev;
+        uint32_t codepoint = _unicode_norm_decode(in, at, &decoded_to);
+        if(codepoint == _UNICODE_NORM_INVALID || decoded_to != i)
+            return i;
+        if(unicode_combining_class(codepoint) == 0)
+            return prev;
+        i = prev;
+    }
+    return from;
+}
+
+//Scans from from for the first code point which might not be in NFC (compose) or NFD and returns its index.
+// Also sets *segment_from to where its segment begins. Only the combining class of the previous code point
+// is tracked, the segment start is searched for backwards since it is rarely needed.
+INTERNAL isize _unicode_norm_scan(const uint8_t* in, isize from, isize size, bool compose, isize* segment_from)
+{
+    uint8_t safe_below = compose ? _UNICODE_NORM_NFC_SAFE_BELOW : _UNICODE_NORM_NFD_SAFE_BELOW;
+    uint8_t unsafe_flags = compose ? UNICODE_NORM_NFC_NO | UNICODE_NORM_NFC_MAYBE : UNICODE_NORM_NFD_NO;
+    uint8_t last_class = 0;
+    for(isize i = from; i < size; ) {
+        //All code points encoded with lead bytes below safe_below are stable starters
+        if(in[i] < safe_below) {
+            i = _unicode_norm_skip_below(in, i, size, safe_below);
+            last_class = 0;
+            continue;
+        }
+
+        isize at = i;
+        uint32_t codepoint = _unicode_norm_decode(in, size, &i);
+        if(codepoint == _UNICODE_NORM_INVALID) {
+            last_class = 0;
+            continue;
+        }
+
+        const Unicode_Norm_Info* info = unicode_norm_info(codepoint);
+        if((info->flags & unsafe_flags) || (info->combining_class != 0 && info->combining_class < last_class)) {
+            //For NFD nothing before a starter decomposing into a starter can change, so the segment can begin at it
+            bool starts_segment = compose == false && info->combining_class == 0
+                && (info->decomposition_count == 0 || unicode_combining_class(UNICODE_NORM_CODEPOINTS[info->decomposition_index]) == 0);
+            *segment_from = starts_segment ? at : _unicode_norm_segment_start(in, from, at);
+            return at;
+        }
+        last_class = info->combining_class;
+    }
+    *segment_from = size;
+    return size;
+}
+
+//Returns the end of the segment containing the code point at from: the next stable starter or invalid byte.
+INTERNAL isize _unicode_norm_segment_end(const uint8_t* in, isize from, isize size, bool compose)
+{
+    uint8_t unsafe_flags = compose ? UNICODE_NORM_NFC_NO | UNICODE_NORM_NFC_MAYBE : UNICODE_NORM_NFD_NO;
+    isize i = from;
+    _unicode_norm_decode(in, size, &i);
+    while(i < size) {
+        isize at = i;
+        uint32_t codepoint = _unicode_norm_decode(in, size, &i);
+        if(codepoint == _UNICODE_NORM_INVALID)
+            return at;
+        const Unicode_Norm_Info* info = unicode_norm_info(codepoint);
+        if(info->combining_class == 0 && (info->flags & unsafe_flags) == 0)
+            return at;
+    }
+    return size;
+}
+
+//Decomposes, reorders and (if compose) composes the segment [from, to) into out. Returns where it stopped,
+// which is before to only if the segment did not fit into UNICODE_NORM_SEGMENT_MAX code points.
+INTERNAL isize _unicode_norm_segment(uint8_t* out, isize out_size, isize* out_at, const uint8_t* in, isize from, isize to, bool compose)
+{
+    uint32_t codepoints[UNICODE_NORM_SEGMENT_MAX];
+    uint8_t classes[UNICODE_NORM_SEGMENT_MAX];
+    int32_t count = 0;
+    isize i = from;
+    while(i < to && count + UNICODE_NORM_MAX_DECOMPOSITION <= UNICODE_NORM_SEGMENT_MAX) {
+        uint32_t codepoint = _unicode_norm_decode(in, to, &i);
+        count += unicode_decompose(codepoint, codepoints + count);
+    }
+
+    //Canonical ordering: a stable insertion sort of the combining marks between starters
+    for(int32_t k = 0; k < count; k++) {
+        uint32_t codepoint = codepoints[k];
+        uint8_t combining_class = unicode_combining_class(codepoint);
+        int32_t j = k;
+        for(; combining_class != 0 && j > 0 && classes[j - 1] > combining_class; j--) {
+            codepoints[j] = codepoints[j - 1];
+            classes[j] = classes[j - 1];
+        }
+        codepoints[j] = codepoint;
+        classes[j] = combining_class;
+    }
+
+    //Canonical composition: each mark composes with the last starter unless blocked by a mark of the same or higher class
+    if(compose && count > 0) {
+        int32_t starter = classes[0] == 0 ? 0 : -1;
+        int32_t kept = 1;
+        for(int32_t k = 1; k < count; k++) {
+            //Since the marks are ordered the last kept one has the highest class since the starter
+            bool is_adjacent = starter == kept - 1;
+            if(starter >= 0 && (is_adjacent || classes[kept - 1] < classes[k])) {
+                uint32_t composite = unicode_compose(codepoints[starter], codepoints[k]);
+                if(composite != 0) {
+                    codepoints[starter] = composite;
+                    continue;
+                }
+            }
+            if(classes[k] == 0)
+                starter = kept;
+            codepoints[kept] = codepoints[k];
+            classes[kept] = classes[k];
+            kept++;
+        }
+        count = kept;
+    }
+
+    for(int32_t k = 0; k < count; k++)
+        _unicode_norm_put(out, out_size, out_at, codepoints[k]);
+    return i;
+}
+
+INTERNAL isize _unicode_normalize(void* output, isize output_size, const void* input, isize input_size, bool compose)
+{
+    const uint8_t* in = (const uint8_t*) input;
+    uint8_t* out = (uint8_t*) output;
+
+    //Everything from verbatim_from up to the next segment needing work is copied as is
+    isize out_at = 0;
+    isize verbatim_from = 0;
+    while(verbatim_from < input_size) {
+        isize segment_from = 0;
+        isize unsafe = _unicode_norm_scan(in, verbatim_from, input_size, compose, &segment_from);
+        if(unsafe >= input_size) {
+            _unicode_norm_put_bytes(out, output_size, &out_at, in + verbatim_from, input_size - verbatim_from);
+            break;
+        }
+
+        _unicode_norm_put_bytes(out, output_size, &out_at, in + verbatim_from, segment_from - verbatim_from);
+        isize segment_to = _unicode_norm_segment_end(in, unsafe, input_size, compose);
+        verbatim_from = _unicode_norm_segment(out, output_size, &out_at, in, segment_from, segment_to, compose);
+    }
+    return out_at;
+}
+
+EXTERNAL isize unicode_nfc(void* output, isize output_size, const void* input, isize input_size)
+{
+    return _unicode_normalize(output, output_size, input, input_size, true);
+}
+
+EXTERNAL isize unicode_nfd(void* output, isize output_size, const void* input, isize input_size)
+{
+    return _unicode_normalize(output, output_size, input, input_size, false);
+}
+
+EXTERNAL isize unicode_nfc_quick_check(const void* input, isize input_size)
+{
+    isize segment_from = 0;
+    return _unicode_norm_scan((const uint8_t*) input, 0, input_size, true, &segment_from);
+}
+
+EXTERNAL isize unicode_nfd_quick_check(const void* input, isize input_size)
+{
+    isize segment_from = 0;
+    return _unicode_norm_scan((const uint8_t*) input, 0, input_size, false, &segment_from);
+}
+
+EXTERNAL isize unicode_casefold_quick_check(const void* input, isize input_size)
+{
+    const uint8_t* in = (const uint8_t*) input;
+    for(isize i = 0; i < input_size; ) {
+        isize at = i;
+        uint32_t codepoint = _unicode_norm_decode(in, input_size, &i);
+        if(codepoint == _UNICODE_NORM_INVALID)
+            continue;
+        if(codepoint < 0x80 ? codepoint - 'A' <= 'Z' - 'A' : unicode_norm_info(codepoint)->fold_count != 0)
+            return at;
+    }
+    return input_size;
+}
+
+EXTERNAL isize unicode_casefold(void* output, isize output_size, const void* input, isize input_size)
+{
+    const uint8_t* in = (const uint8_t*) input;
+    uint8_t* out = (uint8_t*) output;
+    isize out_at = 0;
+    for(isize i = 0; i < input_size; ) {
+        //Lowercases ASCII runs 16 bytes at a time
+        if(in[i] < 0x80) {
+            #ifdef _UNICODE_NORM_SSE
+                __m128i before_a = _mm_set1_epi8('A' - 1);
+                __m128i after_z = _mm_set1_epi8('Z' + 1);
+                __m128i case_bit = _mm_set1_epi8(0x20);
+                for(; i + 16 <= input_size && out_at + 16 <= output_size; i += 16, out_at += 16) {
+                    __m128i bytes = _mm_loadu_si128((const __m128i*) (const void*) (in + i));
+                    if(_mm_movemask_epi8(bytes) != 0)
+                        break;
+                    __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(bytes, before_a), _mm_cmplt_epi8(bytes, after_z));
+                    _mm_storeu_si128((__m128i*) (void*) (out + out_at), _mm_add_epi8(bytes, _mm_and_si128(upper, case_bit)));
+                }
+            #endif
+            for(; i < input_size && in[i] < 0x80; i++, out_at++)
+                if(out_at < output_size)
+                    out[out_at] = (uint8_t) ((unsigned) (in[i] - 'A') <= 'Z' - 'A' ? in[i] + 0x20 : in[i]);
+            continue;
+        }
+
+        isize at = i;
+        uint32_t codepoint = _unicode_norm_decode(in, input_size, &i);
+        const Unicode_Norm_Info* info = codepoint == _UNICODE_NORM_INVALID ? &UNICODE_NORM_INFOS[0] : unicode_norm_info(codepoint);
+        if(info->fold_count == 0)
+            _unicode_norm_put_bytes(out, output_size, &out_at, in + at, i - at);
+        else
+            for(int32_t k = 0; k < info->fold_count; k++)
+                _unicode_norm_put(out, output_size, &out_at, UNICODE_NORM_CODEPOINTS[info->fold_index + k]);
+    }
+    return out_at;
+}
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+
+INTERNAL char* _unicode_norm_read_entire_file(const char* path, size_t* size)
+{
+    char* data = NULL;
+    FILE* file = fopen(path, "rb");
+    if(file == NULL)
+        fprintf(stderr, "unicode_norm_format_tables_file: error couldn't open file '%s' error: %s\n", path, strerror(errno));
+    else {
+        fseek(file, 0, SEEK_END);
+        long file_size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+        data = (char*) malloc((size_t) (file_size > 0 ? file_size : 0) + 1);
+        if(data == NULL || fread(data, 1, (size_t) file_size, file) != (size_t) file_size) {
+            fprintf(stderr, "unicode_norm_format_tables_file: error couldn't read file '%s' error: %s\n", path, strerror(errno));
+            free(data);
+            data = NULL;
+        }
+        else {
+            data[file_size] = '\0';
+            *size = (size_t) file_size;
+        }
+        fclose(file);
+    }
+    return data;
+}
+
+//Parses up to max space separated hex numbers from str, stopping at any of the stop characters or the end of line
+INTERNAL int32_t _unicode_norm_parse_hex_list(const char* str, uint32_t* out, int32_t max, const char* stop)
+{
+    int32_t count = 0;
+    while(count < max) {
+        for(; *str == ' '; str++);
+        if(*str == '\0' || *str == '\n' || strchr(stop, *str))
+            break;
+        char* end = NULL;
+        unsigned long value = strtoul(str, &end, 16);
+        if(end == str)
+            break;
+        out[count++] = (uint32_t) value;
+        str = end;
+    }
+    return count;
+}
+
+typedef struct _Unicode_Norm_Pair {
+    uint32_t first;
+    uint32_t second;
+    uint32_t composite;
+} _Unicode_Norm_Pair;
+
+INTERNAL int _unicode_norm_pair_compare(const void* a, const void* b)
+{
+    const _Unicode_Norm_Pair* x = (const _Unicode_Norm_Pair*) a;
+    const _Unicode_Norm_Pair* y = (const _Unicode_Norm_Pair*) b;
+    if(x->first != y->first)
+        return x->first < y->first ? -1 : 1;
+    return (x->second > y->second) - (x->second < y->second);
+}
+
+INTERNAL int32_t _unicode_norm_full_decomposition(uint32_t codepoint, uint32_t (*raw)[2], const uint8_t* raw_count, uint32_t* out)
+{
+    if(raw_count[codepoint] == 0) {
+        out[0] = codepoint;
+        return 1;
+    }
+    int32_t count = 0;
+    for(int32_t i = 0; i < raw_count[codepoint]; i++)
+        count += _unicode_norm_full_decomposition(raw[codepoint][i], raw, raw_count, out + count);
+    return count;
+}
+
+EXTERNAL bool unicode_norm_format_tables_file(const char* unicode_data, const char* case_folding, const char* composition_exclusions, const char* out)
+{
+    enum {CODEPOINTS = UTF_MAX + 1, BLOCK = 1 << UNICODE_NORM_BLOCK_SHIFT, MAX_INFOS = 1 << 16};
+    size_t data_size = 0, folding_size = 0, exclusions_size = 0;
+    char* data = _unicode_norm_read_entire_file(unicode_data, &data_size);
+    char* folding = _unicode_norm_read_entire_file(case_folding, &folding_size);
+    char* exclusions = _unicode_norm_read_entire_file(composition_exclusions, &exclusions_size);
+    FILE* file = data && folding && exclusions ? fopen(out, "wb") : NULL;
+    if(file == NULL) {
+        free(data); free(folding); free(exclusions);
+        return false;
+    }
+
+    uint8_t* classes = (uint8_t*) calloc(CODEPOINTS, 1);
+    uint8_t* raw_count = (uint8_t*) calloc(CODEPOINTS, 1);
+    uint32_t (*raw)[2] = (uint32_t (*)[2]) calloc(CODEPOINTS, sizeof *raw);
+    uint8_t* fold_count = (uint8_t*) calloc(CODEPOINTS, 1);
+    uint32_t (*fold)[UNICODE_NORM_MAX_FOLD] = (uint32_t (*)[UNICODE_NORM_MAX_FOLD]) calloc(CODEPOINTS, sizeof *fold);
+    uint8_t* excluded = (uint8_t*) calloc(CODEPOINTS, 1);
+    uint8_t* is_second = (uint8_t*) calloc(CODEPOINTS, 1);
+    uint16_t* info_of = (uint16_t*) calloc(CODEPOINTS, sizeof(uint16_t));
+    Unicode_Norm_Info* infos = (Unicode_Norm_Info*) calloc(MAX_INFOS, sizeof *infos);
+    uint32_t* pool = (uint32_t*) calloc(1 << 16, sizeof *pool);
+    _Unicode_Norm_Pair* pairs = (_Unicode_Norm_Pair*) calloc(1 << 16, sizeof *pairs);
+    uint16_t* blocks = (uint16_t*) calloc(CODEPOINTS/BLOCK, sizeof(uint16_t));
+    uint16_t* indices = (uint16_t*) calloc(CODEPOINTS, sizeof(uint16_t));
+
+    //UnicodeData.txt: code;name;category;combining class;bidi;decomposition;... Compatibility decompositions start with <tag>.
+    for(char* line = data; line && *line; ) {
+        char* next = strchr(line, '\n');
+        char* fields[6] = {line};
+        int32_t field_count = 1;
+        for(char* c = line; *c && *c != '\n' && field_count < 6; c++)
+            if(*c == ';')
+                fields[field_count++] = c + 1;
+
+        if(field_count == 6 && *line != '#') {
+            uint32_t codepoint = (uint32_t) strtoul(fields[0], NULL, 16);
+            if(codepoint < CODEPOINTS) {
+                classes[codepoint] = (uint8_t) strtoul(fields[3], NULL, 10);
+                if(*fields[5] != '<')
+                    raw_count[codepoint] = (uint8_t) _unicode_norm_parse_hex_list(fields[5], raw[codepoint], 2, ";");
+            }
+        }
+        line = next ? next + 1 : NULL;
+    }
+
+    //CaseFolding.txt: code; status; mapping; # name. The full folding consists of the C and F entries.
+    for(char* line = folding; line && *line; ) {
+        char* next = strchr(line, '\n');
+        if(*line != '#' && *line != '\n') {
+            uint32_t codepoint = (uint32_t) strtoul(line, NULL, 16);
+            char* status = strchr(line, ';');
+            if(status && codepoint < CODEPOINTS && (status[2] == 'C' || status[2] == 'F') && status[3] == ';')
+                fold_count[codepoint] = (uint8_t) _unicode_norm_parse_hex_list(status + 4, fold[codepoint], UNICODE_NORM_MAX_FOLD, ";#");
+        }
+        line = next ? next + 1 : NULL;
+    }
+
+    //CompositionExclusions.txt: code # name
+    for(char* line = exclusions; line && *line; ) {
+        char* next = strchr(line, '\n');
+        if(*line != '#' && *line != '\n') {
+            uint32_t codepoint = (uint32_t) strtoul(line, NULL, 16);
+            if(codepoint < CODEPOINTS)
+                excluded[codepoint] = 1;
+        }
+        line = next ? next + 1 : NULL;
+    }
+
+    //Primary composites are the canonical pairs of starters which are not excluded. Singletons and
+    // decompositions starting with a non starter are excluded implicitly.
+    int32_t pair_count = 0;
+    for(uint32_t c = 0; c < CODEPOINTS; c++)
+        if(raw_count[c] == 2 && excluded[c] == 0 && classes[c] == 0 && classes[raw[c][0]] == 0) {
+            _Unicode_Norm_Pair pair = {raw[c][0], raw[c][1], c};
+            pairs[pair_count++] = pair;
+            is_second[raw[c][1]] = 1;
+        }
+    qsort(pairs, (size_t) pair_count, sizeof *pairs, _unicode_norm_pair_compare);
+
+    //Deduplicate the infos through a small open addressing hash table of their indices
+    enum {HASH_SLOTS = 1 << 17};
+    uint32_t* slots = (uint32_t*) calloc(HASH_SLOTS, sizeof(uint32_t));
+    int32_t info_count = 1;
+    int32_t pool_count = 0;
+    int32_t pair_at = 0;
+    int32_t max_decomposition = 0;
+    for(uint32_t c = 0; c < CODEPOINTS; c++) {
+        Unicode_Norm_Info info = {0};
+        info.combining_class = classes[c];
+        if(raw_count[c] > 0) {
+            uint32_t full[32] = {0};
+            int32_t count = _unicode_norm_full_decomposition(c, raw, raw_count, full);
+            max_decomposition = count > max_decomposition ? count : max_decomposition;
+            ASSERT(count <= UNICODE_NORM_MAX_DECOMPOSITION);
+            info.flags |= UNICODE_NORM_NFD_NO;
+            info.decomposition_count = (uint8_t) count;
+            info.decomposition_index = (uint16_t) pool_count;
+            for(int32_t i = 0; i < count; i++)
+                pool[pool_count++] = full[i];
+
+            bool is_primary = raw_count[c] == 2 && excluded[c] == 0 && classes[c] == 0 && classes[raw[c][0]] == 0;
+            if(is_primary == false)
+                info.flags |= UNICODE_NORM_NFC_NO;
+        }
+
+        bool is_hangul_syllable = c - _UNICODE_HANGUL_S_BASE < _UNICODE_HANGUL_S_COUNT;
+        bool is_hangul_vowel = c - _UNICODE_HANGUL_V_BASE < _UNICODE_HANGUL_V_COUNT;
+        bool is_hangul_trailing = c - _UNICODE_HANGUL_T_BASE - 1 < _UNICODE_HANGUL_T_COUNT - 1;
+        if(is_hangul_syllable)
+            info.flags |= UNICODE_NORM_NFD_NO;
+        if(is_second[c] || is_hangul_vowel || is_hangul_trailing)
+            info.flags |= UNICODE_NORM_NFC_MAYBE;
+
+        if(fold_count[c] > 0) {
+            info.fold_count = fold_count[c];
+            info.fold_index = (uint16_t) pool_count;
+            for(int32_t i = 0; i < fold_count[c]; i++)
+                pool[pool_count++] = fold[c][i];
+        }
+
+        if(pair_at < pair_count && pairs[pair_at].first == c) {
+            info.compose_index = (uint16_t) pair_at;
+            for(; pair_at < pair_count && pairs[pair_at].first == c; pair_at++)
+                info.compose_count++;
+        }
+        ASSERT(pool_count < (1 << 16));
+
+        //Find or insert
+        uint32_t hash = 2166136261u;
+        for(size_t i = 0; i < sizeof info; i++)
+            hash = (hash ^ ((uint8_t*) &info)[i])*16777619u;
+        uint32_t slot = hash & (HASH_SLOTS - 1);
+        for(;;) {
+            if(slots[slot] == 0) {
+                if(memcmp(&info, &infos[0], sizeof info) == 0) {
+                    info_of[c] = 0;
+                    break;
+                }
+                ASSERT(info_count < MAX_INFOS);
+                infos[info_count] = info;
+                slots[slot] = (uint32_t) info_count;
+                info_of[c] = (uint16_t) info_count++;
+                break;
+            }
+            if(memcmp(&infos[slots[slot]], &info, sizeof info) == 0) {
+                info_of[c] = (uint16_t) slots[slot];
+                break;
+            }
+            slot = (slot + 1) & (HASH_SLOTS - 1);
+        }
+    }
+    free(slots);
+
+    //Two stage table: identical blocks are stored once
+    int32_t block_count = 0;
+    for(int32_t b = 0; b < CODEPOINTS/BLOCK; b++) {
+        const uint16_t* block = info_of + b*BLOCK;
+        int32_t found = 0;
+        for(; found < block_count; found++)
+            if(memcmp(indices + found*BLOCK, block, BLOCK*sizeof(uint16_t)) == 0)
+                break;
+        if(found == block_count)
+            memcpy(indices + block_count++*BLOCK, block, BLOCK*sizeof(uint16_t));
+        blocks[b] = (uint16_t) found;
+    }
+
+    printf("unicode_norm_format_tables_file: %i infos, %i blocks, %i pooled codepoints, %i compositions, longest decomposition %i\n",
+        info_count, block_count, pool_count, pair_count, max_decomposition);
+
+    fprintf(file, "const uint16_t UNICODE_NORM_BLOCKS[%i] = {\n", CODEPOINTS/BLOCK);
+    for(int32_t i = 0; i < CODEPOINTS/BLOCK; i++)
+        fprintf(file, "%s%i,%s", i % 32 == 0 ? "    " : "", blocks[i], i % 32 == 31 ? "\n" : "");
+    fprintf(file, "};\n\n");
+
+    fprintf(file, "const uint16_t UNICODE_NORM_INDICES[%i] = {\n", block_count*BLOCK);
+    for(int32_t i = 0; i < block_count*BLOCK; i++)
+        fprintf(file, "%s%i,%s", i % 32 == 0 ? "    " : "", indices[i], i % 32 == 31 ? "\n" : "");
+    fprintf(file, "};\n\n");
+
+    fprintf(file, "const Unicode_Norm_Info UNICODE_NORM_INFOS[%i] = { //class, flags, decomposition count, fold count, decomposition index, fold index, compose index, compose count\n", info_count);
+    for(int32_t i = 0; i < info_count; i++) {
+        Unicode_Norm_Info in = infos[i];
+        fprintf(file, "%s{%i,%i,%i,%i,%i,%i,%i,%i},%s", i % 4 == 0 ? "    " : " ", in.combining_class, in.flags, in.decomposition_count, in.fold_count,
+            in.decomposition_index, in.fold_index, in.compose_index, in.compose_count, i % 4 == 3 ? "\n" : "");
+    }
+    fprintf(file, "\n};\n\n");
+
+    fprintf(file, "const uint32_t UNICODE_NORM_CODEPOINTS[%i] = {\n", pool_count);
+    for(int32_t i = 0; i < pool_count; i++)
+        fprintf(file, "%s0x%04x,%s", i % 16 == 0 ? "    " : "", pool[i], i % 16 == 15 ? "\n" : "");
+    fprintf(file, "\n};\n\n");
+
+    fprintf(file, "const Unicode_Norm_Composition UNICODE_NORM_COMPOSITIONS[%i] = { //second, composite\n", pair_count);
+    for(int32_t i = 0; i < pair_count; i++)
+        fprintf(file, "%s{0x%04x,0x%04x},%s", i % 8 == 0 ? "    " : " ", pairs[i].second, pairs[i].composite, i % 8 == 7 ? "\n" : "");
+    fprintf(file, "\n};\n");
+
+    fclose(file);
+    free(classes); free(raw_count); free(raw); free(fold_count); free(fold); free(excluded); free(is_second);
+    free(info_of); free(infos); free(pool); free(pairs); free(blocks); free(indices);
+    free(data); free(folding); free(exclusions);
+    return true;
+}
+
+//=========================================================================
+//The reminder of the file is generated by the script above from the Unicode 14.0 data (see the top of the file).
+//You should probably not be modifying it
+//=========================================================================
+const uint16_t UNICODE_NORM_BLOCKS[8704] = {
+    0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+    32,33,34,35,36,36,37,38,36,36,36,36,36,36,39,40,36,41,42,36,43,44,45,46,47,48,36,49,50,51,52,53,
+    54,55,56,57,58,59,60,36,36,61,36,36,36,36,36,36,36,36,36,36,36,62,36,36,63,64,65,66,36,36,36,36,
+    67,68,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,69,70,71,72,73,74,75,76,36,77,78,79,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,81,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,82,83,84,85,86,36,36,36,36,36,87,36,88,36,
+    36,36,36,89,36,90,91,36,92,93,94,95,36,36,36,36,36,36,36,36,96,97,36,36,36,98,99,36,36,100,101,102,
+    103,104,105,106,107,108,109,36,110,111,36,112,113,114,115,36,116,117,118,119,120,121,36,36,113,36,122,123,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,124,125,36,36,36,36,36,126,36,36,127,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,128,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,129,130,131,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    132,36,125,36,36,133,36,36,36,36,36,36,36,36,36,36,36,134,135,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,136,137,138,139,140,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+};
+
+const uint16_t UNICODE_NORM_INDICES[18048] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,3,0,
+    0,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,0,0,0,0,0,
+    0,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,0,46,47,48,49,50,51,52,53,54,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,
+    57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,0,80,81,82,83,84,85,86,87,
+    88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,0,104,105,106,107,108,109,0,110,111,112,113,114,115,0,116,
+    117,118,119,120,121,122,123,124,125,126,127,128,129,130,131,132,133,0,134,135,136,137,138,139,140,141,142,143,144,145,146,147,
+    148,149,150,151,152,153,154,0,155,156,157,158,159,160,161,162,163,0,164,0,165,166,167,168,0,169,170,171,172,173,174,175,
+    0,176,0,177,178,179,180,181,182,183,184,0,185,186,187,188,189,190,191,0,192,193,194,195,196,197,198,199,200,201,202,203,
+    204,205,206,207,208,209,210,0,211,212,213,214,215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,
+    0,235,236,0,237,0,238,239,0,240,241,242,0,0,243,244,245,246,0,247,248,0,249,250,251,0,0,0,252,253,0,254,
+    255,256,257,0,258,0,259,260,0,261,0,0,262,0,263,264,265,266,267,268,0,269,0,270,271,0,0,0,272,0,0,0,
+    0,0,0,0,273,274,0,275,276,0,277,278,0,279,280,281,282,283,284,285,286,287,288,289,290,291,292,293,294,0,295,296,
+    297,298,299,300,301,0,302,303,304,305,306,307,308,309,310,311,312,313,314,0,315,316,317,318,319,320,321,322,323,324,325,326,
+    327,328,329,330,331,332,333,334,335,336,337,338,339,340,341,342,343,344,345,346,347,348,349,350,351,352,353,354,355,0,356,357,
+    358,0,359,0,360,0,361,362,363,364,365,366,367,368,369,370,371,372,373,374,0,0,0,0,0,0,375,376,0,377,378,0,
+    0,379,0,380,381,382,383,0,384,0,385,0,386,0,387,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,388,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    389,389,389,389,389,390,389,389,389,389,389,389,389,390,390,389,390,389,390,389,389,391,392,392,392,392,391,393,392,392,392,392,
+    392,394,394,395,395,395,395,396,396,392,392,392,392,395,395,392,395,395,392,392,397,397,397,397,398,392,392,392,392,390,390,390,
+    399,400,389,401,402,403,390,392,392,392,390,390,390,392,392,0,390,390,390,392,392,392,392,390,391,392,392,390,404,405,405,404,
+    405,405,404,390,390,390,390,390,390,390,390,390,390,390,390,390,406,0,407,0,408,0,409,0,0,0,0,0,0,0,410,411,
+    0,0,0,0,0,412,413,414,415,416,417,0,418,0,419,420,421,422,423,424,425,426,427,428,429,430,431,432,433,434,435,436,
+    437,438,0,439,440,441,442,443,444,445,446,447,448,449,450,451,452,453,0,0,0,454,0,455,0,456,0,0,0,0,0,457,
+    0,458,459,0,0,460,0,0,0,461,462,463,464,465,466,467,468,469,470,471,472,473,474,0,475,0,476,0,477,0,478,0,
+    479,0,480,0,481,0,482,0,483,0,484,0,485,0,486,0,487,488,0,0,489,490,0,491,0,492,493,0,0,494,495,496,
+    497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,527,528,
+    529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,544,545,0,0,546,0,547,548,549,550,551,552,0,0,0,553,0,
+    0,0,0,554,0,0,0,555,0,0,0,556,0,557,0,0,558,559,0,560,0,0,561,562,0,0,0,0,563,564,565,0,
+    566,0,567,0,568,0,569,0,570,0,571,0,572,0,573,0,574,0,575,0,576,577,578,579,580,0,581,0,582,0,583,0,
+    584,0,0,390,390,390,390,390,0,0,585,0,586,0,587,0,588,0,589,0,590,0,591,0,592,0,593,0,594,0,595,0,
+    596,0,597,0,598,0,599,0,600,0,601,0,602,0,603,0,604,0,605,0,606,0,607,0,608,0,609,0,610,0,611,0,
+    612,613,614,615,0,616,0,617,0,618,0,619,0,620,0,0,621,622,623,624,625,0,626,627,628,629,630,631,632,633,634,635,
+    636,0,637,638,639,640,641,642,643,644,645,646,647,648,649,650,651,652,653,654,655,656,657,0,658,659,660,0,661,0,662,0,
+    663,0,664,0,665,0,666,0,667,0,668,0,669,0,670,0,671,0,672,0,673,0,674,0,675,0,676,0,677,0,678,0,
+    679,0,680,0,681,0,682,0,683,0,684,0,685,0,686,0,0,687,688,689,690,691,692,693,694,695,696,697,698,699,700,701,
+    702,703,704,705,706,707,708,709,710,711,712,713,714,715,716,717,718,719,720,721,722,723,724,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,725,0,0,0,0,0,0,0,0,0,392,390,390,390,390,392,390,390,390,726,392,390,390,390,390,
+    390,390,392,392,392,392,392,392,390,390,392,390,390,726,727,390,728,729,730,731,732,733,734,735,736,737,737,738,739,740,0,741,
+    0,742,743,0,390,392,0,736,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,390,390,390,390,390,390,390,744,745,746,0,0,0,0,0,
+    0,0,747,748,749,750,751,752,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,753,0,754,755,756,757,744,745,746,758,759,389,389,395,392,390,390,390,390,390,392,390,390,392,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,760,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    761,762,763,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,764,765,0,766,390,390,390,390,390,390,390,0,0,390,
+    390,390,390,392,390,0,0,390,390,0,392,390,390,392,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,767,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,392,390,390,392,390,390,392,392,392,390,392,392,390,392,390,
+    390,390,392,390,392,390,392,390,392,390,390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,390,390,390,390,390,390,390,392,390,0,0,0,0,0,0,0,0,0,392,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,390,390,390,0,390,390,390,390,390,
+    390,390,390,390,0,390,390,390,0,390,390,390,390,390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,392,392,392,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,392,392,392,390,390,390,390,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,390,390,390,390,390,392,392,392,392,392,390,390,390,390,390,390,390,390,390,390,390,390,
+    390,390,0,392,390,390,392,390,390,392,390,390,390,392,392,392,755,756,757,390,390,390,392,390,390,392,392,390,390,390,390,390,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,768,769,0,0,0,0,0,0,770,771,0,772,773,0,0,0,0,0,0,0,774,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,775,0,0,0,390,392,390,390,0,0,0,776,777,778,779,780,781,782,783,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,784,0,785,0,
+    0,0,0,0,0,0,0,786,0,0,0,787,788,775,0,0,0,0,0,0,0,0,0,785,0,0,0,0,789,790,0,791,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,792,0,0,793,0,0,0,0,0,784,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,775,0,0,0,0,0,0,0,0,0,0,0,794,795,796,0,0,797,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,784,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,775,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,784,0,785,0,
+    0,0,0,0,0,0,0,798,799,0,0,800,801,775,0,0,0,0,0,0,0,0,785,785,0,0,0,0,802,803,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,804,0,805,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,785,0,
+    0,0,0,0,0,0,806,807,0,0,808,809,810,775,0,0,0,0,0,0,0,0,0,785,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,784,0,0,0,
+    0,0,0,0,0,0,811,0,812,0,0,0,0,775,0,0,0,0,0,0,0,813,814,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,784,0,0,815,
+    816,0,785,0,0,0,817,818,819,0,820,821,0,775,0,0,0,0,0,0,0,785,785,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,775,775,0,785,0,
+    0,0,0,0,0,0,822,823,0,0,824,825,826,775,0,0,0,0,0,0,0,0,0,785,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,827,0,0,0,0,785,0,0,0,0,0,0,0,0,0,828,829,0,830,831,832,785,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,833,833,775,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,834,834,834,834,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,835,835,775,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,836,836,836,836,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,392,392,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,392,0,392,0,837,0,0,0,0,0,0,
+    0,0,0,838,0,0,0,0,0,0,0,0,0,839,0,0,0,0,840,0,0,0,0,841,0,0,0,0,842,0,0,0,
+    0,0,0,0,0,0,0,0,0,843,0,0,0,0,0,0,0,844,845,846,847,848,849,0,850,0,845,845,845,845,0,0,
+    845,851,390,390,775,0,390,390,0,0,0,0,0,0,0,0,0,0,0,852,0,0,0,0,0,0,0,0,0,853,0,0,
+    0,0,854,0,0,0,0,855,0,0,0,0,856,0,0,0,0,0,0,0,0,0,0,0,0,857,0,0,0,0,0,0,
+    0,0,0,0,0,0,392,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,858,859,0,0,0,0,0,0,0,785,0,0,0,0,0,0,0,0,784,0,775,775,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,392,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    860,861,862,863,864,865,866,867,868,869,870,871,872,873,874,875,876,877,878,879,880,881,882,883,884,885,886,887,888,889,890,891,
+    892,893,894,895,896,897,0,898,0,0,0,0,0,899,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,
+    785,785,785,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,390,390,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,900,901,902,903,904,905,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,775,775,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,775,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,775,0,0,0,0,0,0,0,0,0,0,390,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,727,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,726,390,392,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,392,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    775,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,390,390,390,390,390,390,390,0,0,392,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,390,390,390,390,392,392,392,392,392,392,390,390,392,0,392,
+    392,390,390,392,392,390,390,390,390,390,392,390,390,390,390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,906,907,908,909,910,911,912,913,914,915,0,0,916,917,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,784,785,0,0,0,0,918,919,920,921,922,923,
+    924,925,926,927,775,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,390,392,390,390,390,390,390,390,390,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,775,775,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,784,0,0,0,0,0,0,0,0,0,0,0,775,775,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,784,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    928,929,930,931,932,933,934,935,936,0,0,0,0,0,0,0,937,938,939,940,941,942,943,944,945,946,947,948,949,950,951,952,
+    953,954,955,956,957,958,959,960,961,962,963,964,965,966,967,968,969,970,971,972,973,974,975,976,977,978,979,0,0,980,981,982,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,390,390,0,397,392,392,392,392,392,390,390,392,392,392,392,
+    390,0,397,397,397,397,397,397,397,0,0,0,0,392,0,0,0,0,0,0,390,0,0,0,390,390,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    390,390,392,390,390,390,390,390,390,390,392,390,390,405,983,392,394,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,
+    390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,391,727,727,392,984,390,404,392,390,392,
+    985,986,987,988,989,990,991,992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1012,1013,1014,1015,1016,
+    1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1028,1029,1030,1031,1032,1033,1034,1035,1036,1037,1038,1039,1040,1041,1042,1043,1044,1045,1046,1047,1048,
+    1049,1050,1051,1052,1053,1054,1055,1056,1057,1058,1059,1060,1061,1062,1063,1064,1065,1066,1067,1068,1069,1070,1071,1072,1073,1074,1075,1076,1077,1078,1079,1080,
+    1081,1082,1083,1084,1085,1086,1087,1088,1089,1090,1091,1092,1093,1094,1095,1096,1097,1098,1099,1100,1101,1102,1103,1104,1105,1106,1107,1108,1109,1110,1111,1112,
+    1113,1114,1115,1116,1117,1118,1119,1120,1121,1122,1123,1124,1125,1126,1127,1128,1129,1130,1131,1132,1133,1134,1135,1136,1137,1138,1139,1140,0,0,1141,0,
+    1142,1143,1144,1145,1146,1147,1148,1149,1150,1151,1152,1153,1154,1155,1156,1157,1158,1159,1160,1161,1162,1163,1164,1165,1166,1167,1168,1169,1170,1171,1172,1173,
+    1174,1175,1176,1177,1178,1179,1180,1181,1182,1183,1184,1185,1186,1187,1188,1189,1190,1191,1192,1193,1194,1195,1196,1197,1198,1199,1200,1201,1202,1203,1204,1205,
+    1206,1207,1208,1209,1210,1211,1212,1213,1214,1215,1216,1217,1218,1219,1220,1221,1222,1223,1224,1225,1226,1227,1228,1229,1230,1231,1232,0,1233,0,1234,0,
+    1235,1236,1237,1238,1239,1240,1241,1242,1243,1244,1245,1246,1247,1248,1249,1250,1251,1252,1253,1254,1255,1256,0,0,1257,1258,1259,1260,1261,1262,0,0,
+    1263,1264,1265,1266,1267,1268,1269,1270,1271,1272,1273,1274,1275,1276,1277,1278,1279,1280,1281,1282,1283,1284,1285,1286,1287,1288,1289,1290,1291,1292,1293,1294,
+    1295,1296,1297,1298,1299,1300,0,0,1301,1302,1303,1304,1305,1306,0,0,1307,1308,1309,1310,1311,1312,1313,1314,0,1315,0,1316,0,1317,0,1318,
+    1319,1320,1321,1322,1323,1324,1325,1326,1327,1328,1329,1330,1331,1332,1333,1334,1335,1336,1337,1338,1339,1340,1341,1342,1343,1344,1345,1346,1347,1348,0,0,
+    1349,1350,1351,1352,1353,1354,1355,1356,1357,1358,1359,1360,1361,1362,1363,1364,1365,1366,1367,1368,1369,1370,1371,1372,1373,1374,1375,1376,1377,1378,1379,1380,
+    1381,1382,1383,1384,1385,1386,1387,1388,1389,1390,1391,1392,1393,1394,1395,1396,1397,1398,1399,1400,1401,0,1402,1403,1404,1405,1406,1407,1408,0,1409,1410,
+    0,1411,1412,1413,1414,0,1415,1416,1417,1418,1419,1420,1421,1422,1423,1424,1425,1426,1427,1428,0,0,1429,1430,1431,1432,1433,1434,0,1435,1436,1437,
+    1438,1439,1440,1441,1442,1443,1444,1445,1446,1447,1448,1449,1450,1451,1452,1453,0,0,1454,1455,1456,0,1457,1458,1459,1460,1461,1462,1463,1464,1465,0,
+    1466,1467,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,390,397,397,390,390,390,390,397,397,397,390,390,0,0,0,
+    0,390,0,0,0,397,397,390,392,390,397,397,392,392,392,392,390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,1468,0,0,0,1469,1470,0,0,0,0,0,0,1471,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1472,1473,1474,1475,1476,1477,1478,1479,1480,1481,1482,1483,1484,1485,1486,1487,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1488,0,0,0,0,0,0,0,0,0,0,0,0,1489,0,1490,0,1491,0,0,0,0,0,1492,1493,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,1494,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,1495,1496,1497,1498,0,1499,0,1500,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1501,1502,0,0,0,1503,1504,0,1505,1506,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1507,1508,1509,1510,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1511,0,0,0,
+    0,1512,0,1513,1514,1515,0,1516,1517,1518,0,0,0,1519,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1520,1521,1522,0,1523,1524,0,0,0,0,0,0,0,1525,1526,1527,1528,1529,1530,1531,1532,1533,1534,1535,1536,1537,1538,1539,1540,1541,0,0,
+    1542,1543,1544,1545,1546,1547,1548,1549,1550,1551,0,0,0,0,0,0,0,1552,1553,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,1554,0,0,0,0,0,1555,1556,0,1557,1558,1559,1560,1561,0,0,1562,1563,1564,1565,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1566,1567,1568,1569,0,0,0,0,0,0,1570,1571,1572,1573,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,1574,1575,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1576,1577,1578,1579,1580,1581,1582,1583,1584,1585,
+    1586,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1600,1601,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1602,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1603,1604,1605,1606,1607,1608,1609,1610,1611,1612,1613,1614,1615,1616,1617,1618,1619,1620,1621,1622,1623,1624,1625,1626,1627,1628,1629,1630,1631,1632,1633,1634,
+    1635,1636,1637,1638,1639,1640,1641,1642,1643,1644,1645,1646,1647,1648,1649,1650,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1651,0,1652,1653,1654,0,0,1655,0,1656,0,1657,0,1658,1659,1660,1661,0,1662,0,0,1663,0,0,0,0,0,0,0,0,1664,1665,
+    1666,0,1667,0,1668,0,1669,0,1670,0,1671,0,1672,0,1673,0,1674,0,1675,0,1676,0,1677,0,1678,0,1679,0,1680,0,1681,0,
+    1682,0,1683,0,1684,0,1685,0,1686,0,1687,0,1688,0,1689,0,1690,0,1691,0,1692,0,1693,0,1694,0,1695,0,1696,0,1697,0,
+    1698,0,1699,0,1700,0,1701,0,1702,0,1703,0,1704,0,1705,0,1706,0,1707,0,1708,0,1709,0,1710,0,1711,0,1712,0,1713,0,
+    1714,0,1715,0,0,0,0,0,0,0,0,1716,0,1717,0,390,390,390,1718,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,775,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,984,727,391,726,1719,1719,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,1720,0,0,0,0,1721,1722,1723,1724,1725,1726,1727,1728,1729,1730,1731,1732,1733,1734,1735,1736,1737,1738,1739,1740,1741,
+    1742,1743,1744,0,1745,1746,1747,1748,1749,1750,0,0,0,0,0,1751,1752,1753,1754,1755,1756,1757,1758,1759,1760,1761,1762,1763,1764,1765,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1766,0,0,0,0,1767,1767,0,0,1768,1769,0,
+    0,0,0,0,0,0,1770,0,0,0,0,1771,1772,1773,1774,1775,1776,1777,1778,1779,1780,1781,1782,1783,1784,1785,1786,1787,1788,1789,1790,1791,
+    1792,1793,1794,0,1795,1796,1797,1798,1799,1800,0,0,0,0,0,1801,1802,1803,1804,1805,1806,1807,1808,1809,1810,1811,1812,1813,1814,1815,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1816,1817,1818,1819,0,1820,0,0,1821,1822,1823,1824,0,0,1825,1826,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1827,0,1828,0,1829,0,1830,0,1831,0,1832,0,1833,0,1834,0,1835,0,1836,0,1837,0,1838,0,1839,0,1840,0,1841,0,1842,0,
+    1843,0,1844,0,1845,0,1846,0,1847,0,1848,0,1849,0,0,390,0,0,0,0,390,390,390,390,390,390,390,390,390,390,0,0,
+    1850,0,1851,0,1852,0,1853,0,1854,0,1855,0,1856,0,1857,0,1858,0,1859,0,1860,0,1861,0,1862,0,1863,0,0,0,390,390,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,1864,0,1865,0,1866,0,1867,0,1868,0,1869,0,1870,0,0,0,1871,0,1872,0,1873,0,1874,0,1875,0,1876,0,1877,0,
+    1878,0,1879,0,1880,0,1881,0,1882,0,1883,0,1884,0,1885,0,1886,0,1887,0,1888,0,1889,0,1890,0,1891,0,1892,0,1893,0,
+    1894,0,1895,0,1896,0,1897,0,1898,0,1899,0,1900,0,1901,0,0,0,0,0,0,0,0,0,0,1902,0,1903,0,1904,1905,0,
+    1906,0,1907,0,1908,0,1909,0,0,0,0,1910,0,1911,0,0,1912,0,1913,0,0,0,1914,0,1915,0,1916,0,1917,0,1918,0,
+    1919,0,1920,0,1921,0,1922,0,1923,0,1924,1925,1926,1927,1928,0,1929,1930,1931,1932,1933,0,1934,0,1935,0,1936,0,1937,0,1938,0,
+    1939,0,1940,0,1941,1942,1943,1944,0,1945,0,0,0,0,0,0,1946,0,0,0,0,0,1947,0,1948,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1949,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,775,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,775,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,775,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,392,392,392,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,775,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,784,0,0,0,0,0,0,0,0,0,0,0,0,
+    775,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,0,390,390,392,0,0,390,390,0,0,0,0,0,390,390,
+    0,390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,775,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1950,1951,1952,1953,1954,1955,1956,1957,1958,1959,1960,1961,1962,1963,1964,1965,
+    1966,1967,1968,1969,1970,1971,1972,1973,1974,1975,1976,1977,1978,1979,1980,1981,1982,1983,1984,1985,1986,1987,1988,1989,1990,1991,1992,1993,1994,1995,1996,1997,
+    1998,1999,2000,2001,2002,2003,2004,2005,2006,2007,2008,2009,2010,2011,2012,2013,2014,2015,2016,2017,2018,2019,2020,2021,2022,2023,2024,2025,2026,2027,2028,2029,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,775,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,
+    2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,
+    2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,
+    2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,
+    2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,
+    2030,2030,2030,2030,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2031,2032,2033,2034,2035,2036,2037,2038,2039,2040,2041,2042,2043,2044,2045,2046,2047,2048,2049,2050,2051,2052,2053,2054,2055,2056,2057,2058,2059,2060,2061,2062,
+    2063,2064,2065,2066,2067,2068,2069,2070,2071,2072,2073,2074,2075,2076,2077,2078,2079,2080,2081,2082,2083,2084,2085,2086,2087,2088,2089,2090,2091,2092,2093,2094,
+    2095,2096,2097,2098,2099,2100,2101,2102,2103,2104,2105,2106,2107,2108,2109,2110,2111,2112,2113,2114,2115,2116,2117,2118,2119,2120,2121,2122,2123,2124,2125,2126,
+    2127,2128,2129,2130,2131,2132,2133,2134,2135,2136,2137,2138,2139,2140,2141,2142,2143,2144,2145,2146,2147,2148,2149,2150,2151,2152,2153,2154,2155,2156,2157,2158,
+    2159,2160,2161,2162,2163,2164,2165,2166,2167,2168,2169,2170,2171,2172,2173,2174,2175,2176,2177,2178,2179,2180,2181,2182,2183,2184,2185,2186,2187,2188,2189,2190,
+    2191,2192,2193,2194,2195,2196,2197,2198,2199,2200,2201,2202,2203,2204,2205,2206,2207,2208,2209,2210,2211,2212,2213,2214,2215,2216,2217,2218,2219,2220,2221,2222,
+    2223,2224,2225,2226,2227,2228,2229,2230,2231,2232,2233,2234,2235,2236,2237,2238,2239,2240,2241,2242,2243,2244,2245,2246,2247,2248,2249,2250,2251,2252,2253,2254,
+    2255,2256,2257,2258,2259,2260,2261,2262,2263,2264,2265,2266,2267,2268,2269,2270,2271,2272,2273,2274,2275,2276,2277,2278,2279,2280,2281,2282,2283,2284,2285,2286,
+    2287,2288,2289,2290,2291,2292,2293,2294,2295,2296,2297,2298,2299,2300,0,0,2301,0,2302,0,0,2303,2304,2305,2306,2307,2308,2309,2310,2311,2312,0,
+    2313,0,2314,0,0,2315,2316,0,0,0,2317,2318,2319,2320,2321,2322,2323,2324,2325,2326,2327,2328,2329,2330,2331,2332,2333,2334,2335,2336,2337,2338,
+    2339,2340,2341,2342,2343,2344,2345,2346,2347,2348,2349,2350,2351,2352,2353,2354,2355,2356,2357,2358,2359,2360,2361,2362,2363,2364,2365,2366,2367,2368,2369,2370,
+    2371,2372,2373,2374,2375,2376,2377,2378,2379,2380,2381,2382,2383,2384,0,0,2385,2386,2387,2388,2389,2390,2391,2392,2393,2394,2395,2396,2397,2398,2399,2400,
+    2401,2402,2403,2404,2405,2406,2407,2408,2409,2410,2411,2412,2413,2414,2415,2416,2417,2418,2419,2420,2421,2422,2423,2424,2425,2426,2427,2428,2429,2430,2431,2432,
+    2433,2434,2435,2436,2437,2438,2439,2440,2441,2442,2443,2444,2445,2446,2447,2448,2449,2450,2451,2452,2453,2454,2455,2456,2457,2458,2459,2460,2461,2462,2463,2464,
+    2465,2466,2467,2468,2469,2470,2471,2472,2473,2474,2475,2476,2477,2478,2479,2480,2481,2482,2483,2484,2485,2486,2487,2488,2489,2490,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2491,2492,2493,2494,2495,2496,2497,0,0,0,0,0,0,0,0,0,0,0,0,2498,2499,2500,2501,2502,0,0,0,0,0,2503,2504,2505,
+    0,0,0,0,0,0,0,0,0,0,2506,2507,2508,2509,2510,2511,2512,2513,2514,2515,2516,2517,2518,0,2519,2520,2521,2522,2523,0,2524,0,
+    2525,2526,0,2527,2528,0,2529,2530,2531,2532,2533,2534,2535,2536,2537,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    390,390,390,390,390,390,390,392,392,392,392,392,392,392,390,390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,2538,2539,2540,2541,2542,2543,2544,2545,2546,2547,2548,2549,2550,2551,2552,2553,2554,2555,2556,2557,2558,2559,2560,2561,2562,2563,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,392,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    392,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,390,390,390,390,0,0,0,0,0,
+    2564,2565,2566,2567,2568,2569,2570,2571,2572,2573,2574,2575,2576,2577,2578,2579,2580,2581,2582,2583,2584,2585,2586,2587,2588,2589,2590,2591,2592,2593,2594,2595,
+    2596,2597,2598,2599,2600,2601,2602,2603,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2604,2605,2606,2607,2608,2609,2610,2611,2612,2613,2614,2615,2616,2617,2618,2619,
+    2620,2621,2622,2623,2624,2625,2626,2627,2628,2629,2630,2631,2632,2633,2634,2635,2636,2637,2638,2639,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2640,2641,2642,2643,2644,2645,2646,2647,2648,2649,2650,0,2651,2652,2653,2654,
+    2655,2656,2657,2658,2659,2660,2661,2662,2663,2664,2665,0,2666,2667,2668,2669,2670,2671,2672,0,2673,2674,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,392,0,390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,397,392,0,0,0,0,775,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,390,392,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2675,2676,2677,2678,2679,2680,2681,2682,2683,2684,2685,2686,2687,2688,2689,2690,2691,2692,2693,2694,2695,2696,2697,2698,2699,2700,2701,2702,2703,2704,2705,2706,
+    2707,2708,2709,2710,2711,2712,2713,2714,2715,2716,2717,2718,2719,2720,2721,2722,2723,2724,2725,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,390,390,390,390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,390,390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,392,392,390,390,390,392,390,392,392,392,392,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,390,392,390,392,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,775,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,775,0,0,0,0,0,0,0,0,0,0,0,0,0,0,775,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2726,2727,2728,2729,0,0,0,
+    0,0,0,0,0,2730,0,0,0,0,0,2731,0,0,0,0,0,0,0,0,0,0,0,0,0,775,774,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    390,390,390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,785,0,0,0,0,0,0,2732,2733,0,2734,2735,775,775,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,784,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    775,0,0,0,0,0,0,0,0,0,784,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,775,784,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,784,775,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,784,784,0,785,0,
+    0,0,0,0,0,0,0,2736,0,0,0,2737,2738,775,0,0,0,0,0,0,0,0,0,785,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,390,390,390,390,390,390,390,0,0,0,390,390,390,390,390,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,775,0,0,0,784,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,785,0,0,0,0,0,0,0,0,2739,785,2740,2741,785,2742,0,
+    0,0,775,784,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,785,0,0,0,0,0,0,0,0,2743,2744,2745,2746,0,0,0,775,
+    784,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,775,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,775,784,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,775,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,775,784,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2747,2748,2749,2750,2751,2752,2753,2754,2755,2756,2757,2758,2759,2760,2761,2762,2763,2764,2765,2766,2767,2768,2769,2770,2771,2772,2773,2774,2775,2776,2777,2778,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,785,0,0,0,0,2779,0,0,2780,0,0,0,0,775,775,0,
+    0,0,0,784,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    775,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,775,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,775,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,775,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,784,0,775,775,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,775,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,397,397,397,397,397,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,390,390,390,390,390,390,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2781,2782,2783,2784,2785,2786,2787,2788,2789,2790,2791,2792,2793,2794,2795,2796,2797,2798,2799,2800,2801,2802,2803,2804,2805,2806,2807,2808,2809,2810,2811,2812,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2813,2813,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,397,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2814,2815,
+    2816,2817,2818,2819,2820,837,837,397,397,397,0,0,0,2821,837,837,837,837,837,0,0,0,0,0,0,0,0,392,392,392,392,392,
+    392,392,392,0,0,390,390,390,390,390,392,392,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,390,390,390,390,0,0,0,0,0,0,0,0,0,0,0,0,0,2822,2823,2824,2825,2826,
+    2827,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,390,390,390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    390,390,390,390,390,390,390,0,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,0,0,390,390,390,390,390,
+    390,390,0,390,390,0,390,390,390,390,390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,390,390,390,390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,392,392,392,392,392,392,392,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2828,2829,2830,2831,2832,2833,2834,2835,2836,2837,2838,2839,2840,2841,2842,2843,2844,2845,2846,2847,2848,2849,2850,2851,2852,2853,2854,2855,2856,2857,2858,2859,
+    2860,2861,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,390,390,390,390,390,390,784,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2862,2863,2864,2865,2866,2867,2868,2869,2870,2871,2872,2873,2874,2875,2876,2877,2878,2879,2880,2881,2882,2883,2884,2885,2886,2887,2888,2889,2890,2891,2892,2893,
+    2894,2895,2896,2897,2898,2899,2900,2901,2902,2903,2904,2905,2906,2907,2908,2909,2910,2911,2912,2913,2914,2915,2916,2917,2918,2919,2920,2921,2922,2923,2924,2925,
+    2926,2927,2928,2929,2930,2931,2932,2933,2934,2935,2936,2937,2938,2939,2940,2941,2942,2943,2944,2945,2946,2947,2948,2949,2950,2951,2952,2953,2954,2955,2956,2957,
+    2958,2959,2960,2961,2962,2963,2964,2965,2966,2967,2968,2969,2970,2971,2972,2973,2974,2975,2976,2977,2978,2979,2980,2981,2982,2983,2984,2985,2986,2987,2988,2989,
+    2990,2991,2992,2993,2994,2995,2996,2997,2998,2999,3000,3001,3002,3003,3004,3005,3006,3007,3008,3009,3010,3011,3012,3013,3014,3015,3016,3017,3018,3019,3020,3021,
+    3022,3023,3024,3025,3026,3027,3028,3029,3030,3031,3032,3033,3034,3035,3036,3037,3038,3039,3040,3041,3042,3043,3044,3045,3046,3047,3048,3049,3050,3051,3052,3053,
+    3054,3055,3056,3057,3058,3059,3060,3061,3062,3063,3064,3065,3066,3067,3068,3069,3070,3071,3072,3073,3074,3075,3076,3077,3078,3079,3080,3081,3082,3083,3084,3085,
+    3086,3087,3088,3089,3090,3091,3092,3093,3094,3095,3096,3097,3098,3099,3100,3101,3102,3103,3104,3105,3106,3107,3108,3109,3110,3111,3112,3113,3114,3115,3116,3117,
+    3118,3119,3120,3121,3122,3123,3124,3125,3126,3127,3128,3129,3130,3131,3132,3133,3134,3135,3136,3137,3138,3139,3140,3141,3142,3143,3144,3145,3146,3147,3148,3149,
+    3150,3151,3152,3153,3154,3155,3156,3157,3158,3159,3160,3161,3162,3163,3164,3165,3166,3167,3168,3169,3170,3171,3172,3173,3174,3175,3176,3177,3178,3179,3180,3181,
+    3182,3183,3184,3185,3186,3187,3188,3189,3190,3191,3192,3193,3194,3195,3196,3197,3198,3199,3200,3201,3202,3203,3204,3205,3206,3207,3208,3209,3210,3211,3212,3213,
+    3214,3215,3216,3217,3218,3219,3220,3221,3222,3223,3224,3225,3226,3227,3228,3229,3230,3231,3232,3233,3234,3235,3236,3237,3238,3239,3240,3241,3242,3243,3244,3245,
+    3246,3247,3248,3249,3250,3251,3252,3253,3254,3255,3256,3257,3258,3259,3260,3261,3262,3263,3264,3265,3266,3267,3268,3269,3270,3271,3272,3273,3274,3275,3276,3277,
+    3278,3279,3280,3281,3282,3283,3284,3285,3286,3287,3288,3289,3290,3291,3292,3293,3294,3295,3296,3297,3298,3299,3300,3301,3302,3303,3304,3305,3306,3307,3308,3309,
+    3310,3311,3312,3313,3314,3315,3316,3317,3318,3319,3320,3321,3322,3323,3324,3325,3326,3327,3328,3329,3330,3331,3332,3333,3334,3335,3336,3337,3338,3339,3340,3341,
+    3342,3343,3344,3345,3346,3347,3348,3349,3350,3351,3352,3353,3354,3355,3356,3357,3358,3359,3360,3361,3362,3363,3364,3365,3366,3367,3368,3369,3370,3371,3372,3373,
+    3374,3375,3376,3377,3378,3379,3380,3381,3382,3383,3384,3385,3386,3387,3388,3389,3390,3391,3392,3393,3394,3395,3396,3397,3398,3399,3400,3401,3402,3403,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+const Unicode_Norm_Info UNICODE_NORM_INFOS[3404] = { //class, flags, decomposition count, fold count, decomposition index, fold index, compose index, compose count
+    {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,1}, {0,0,0,0,0,0,1,1}, {0,0,0,0,0,0,2,1},
+    {0,0,0,1,0,0,3,16}, {0,0,0,1,0,1,19,3}, {0,0,0,1,0,2,22,5}, {0,0,0,1,0,3,27,6},
+    {0,0,0,1,0,4,33,17}, {0,0,0,1,0,5,50,1}, {0,0,0,1,0,6,51,7}, {0,0,0,1,0,7,58,7},
+    {0,0,0,1,0,8,65,15}, {0,0,0,1,0,9,80,1}, {0,0,0,1,0,10,81,5}, {0,0,0,1,0,11,86,6},
+    {0,0,0,1,0,12,92,3}, {0,0,0,1,0,13,95,9}, {0,0,0,1,0,14,104,16}, {0,0,0,1,0,15,120,2},
+    {0,0,0,1,0,16,0,0}, {0,0,0,1,0,17,122,8}, {0,0,0,1,0,18,130,7}, {0,0,0,1,0,19,137,7},
+    {0,0,0,1,0,20,144,19}, {0,0,0,1,0,21,163,2}, {0,0,0,1,0,22,165,6}, {0,0,0,1,0,23,171,2},
+    {0,0,0,1,0,24,173,9}, {0,0,0,1,0,25,182,6}, {0,0,0,0,0,0,188,16}, {0,0,0,0,0,0,204,3},
+    {0,0,0,0,0,0,207,5}, {0,0,0,0,0,0,212,6}, {0,0,0,0,0,0,218,17}, {0,0,0,0,0,0,235,1},
+    {0,0,0,0,0,0,236,7}, {0,0,0,0,0,0,243,8}, {0,0,0,0,0,0,251,14}, {0,0,0,0,0,0,265,2},
+    {0,0,0,0,0,0,267,5}, {0,0,0,0,0,0,272,6}, {0,0,0,0,0,0,278,3}, {0,0,0,0,0,0,281,9},
+    {0,0,0,0,0,0,290,16}, {0,0,0,0,0,0,306,2}, {0,0,0,0,0,0,308,8}, {0,0,0,0,0,0,316,7},
+    {0,0,0,0,0,0,323,8}, {0,0,0,0,0,0,331,19}, {0,0,0,0,0,0,350,2}, {0,0,0,0,0,0,352,7},
+    {0,0,0,0,0,0,359,2}, {0,0,0,0,0,0,361,10}, {0,0,0,0,0,0,371,6}, {0,0,0,0,0,0,377,3},
+    {0,0,0,1,0,26,0,0}, {0,1,2,1,27,29,0,0}, {0,1,2,1,30,32,0,0}, {0,1,2,1,33,35,380,4},
+    {0,1,2,1,36,38,0,0}, {0,1,2,1,39,41,384,1}, {0,1,2,1,42,44,385,1}, {0,0,0,1,0,45,386,2},
+    {0,1,2,1,46,48,388,1}, {0,1,2,1,49,51,0,0}, {0,1,2,1,52,54,0,0}, {0,1,2,1,55,57,389,4},
+    {0,1,2,1,58,60,0,0}, {0,1,2,1,61,63,0,0}, {0,1,2,1,64,66,0,0}, {0,1,2,1,67,69,0,0},
+    {0,1,2,1,70,72,393,1}, {0,0,0,1,0,73,0,0}, {0,1,2,1,74,76,0,0}, {0,1,2,1,77,79,0,0},
+    {0,1,2,1,80,82,0,0}, {0,1,2,1,83,85,394,4}, {0,1,2,1,86,88,398,3}, {0,1,2,1,89,91,401,1},
+    {0,0,0,1,0,92,402,1}, {0,1,2,1,93,95,0,0}, {0,1,2,1,96,98,0,0}, {0,1,2,1,99,101,0,0},
+    {0,1,2,1,102,104,403,4}, {0,1,2,1,105,107,0,0}, {0,0,0,1,0,108,0,0}, {0,0,0,2,0,109,0,0},
+    {0,1,2,0,111,0,0,0}, {0,1,2,0,113,0,0,0}, {0,1,2,0,115,0,407,4}, {0,1,2,0,117,0,0,0},
+    {0,1,2,0,119,0,411,1}, {0,1,2,0,121,0,412,1}, {0,0,0,0,0,0,413,2}, {0,1,2,0,123,0,415,1},
+    {0,1,2,0,125,0,0,0}, {0,1,2,0,127,0,0,0}, {0,1,2,0,129,0,416,4}, {0,1,2,0,131,0,0,0},
+    {0,1,2,0,133,0,0,0}, {0,1,2,0,135,0,0,0}, {0,1,2,0,137,0,0,0}, {0,1,2,0,139,0,420,1},
+    {0,1,2,0,141,0,0,0}, {0,1,2,0,143,0,0,0}, {0,1,2,0,145,0,0,0}, {0,1,2,0,147,0,421,4},
+    {0,1,2,0,149,0,425,3}, {0,1,2,0,151,0,428,1}, {0,0,0,0,0,0,429,1}, {0,1,2,0,153,0,0,0},
+    {0,1,2,0,155,0,0,0}, {0,1,2,0,157,0,0,0}, {0,1,2,0,159,0,430,4}, {0,1,2,0,161,0,0,0},
+    {0,1,2,0,163,0,0,0}, {0,1,2,1,165,167,0,0}, {0,1,2,0,168,0,0,0}, {0,1,2,1,170,172,434,4},
+    {0,1,2,0,173,0,438,4}, {0,1,2,1,175,177,0,0}, {0,1,2,0,178,0,0,0}, {0,1,2,1,180,182,0,0},
+    {0,1,2,0,183,0,0,0}, {0,1,2,1,185,187,0,0}, {0,1,2,0,188,0,0,0}, {0,1,2,1,190,192,0,0},
+    {0,1,2,0,193,0,0,0}, {0,1,2,1,195,197,0,0}, {0,1,2,0,198,0,0,0}, {0,1,2,1,200,202,0,0},
+    {0,1,2,0,203,0,0,0}, {0,0,0,1,0,205,0,0}, {0,1,2,1,206,208,442,2}, {0,1,2,0,209,0,444,2},
+    {0,1,2,1,211,213,0,0}, {0,1,2,0,214,0,0,0}, {0,1,2,1,216,218,0,0}, {0,1,2,0,219,0,0,0},
+    {0,1,2,1,221,223,0,0}, {0,1,2,0,224,0,0,0}, {0,1,2,1,226,228,0,0}, {0,1,2,0,229,0,0,0},
+    {0,1,2,1,231,233,0,0}, {0,1,2,0,234,0,0,0}, {0,1,2,1,236,238,0,0}, {0,1,2,0,239,0,0,0},
+    {0,1,2,1,241,243,0,0}, {0,1,2,0,244,0,0,0}, {0,1,2,1,246,248,0,0}, {0,1,2,0,249,0,0,0},
+    {0,1,2,1,251,253,0,0}, {0,1,2,0,254,0,0,0}, {0,0,0,1,0,256,0,0}, {0,1,2,1,257,259,0,0},
+    {0,1,2,0,260,0,0,0}, {0,1,2,1,262,264,0,0}, {0,1,2,0,265,0,0,0}, {0,1,2,1,267,269,0,0},
+    {0,1,2,0,270,0,0,0}, {0,1,2,1,272,274,0,0}, {0,1,2,0,275,0,0,0}, {0,1,2,2,277,279,0,0},
+    {0,0,0,1,0,281,0,0}, {0,1,2,1,282,284,0,0}, {0,1,2,0,285,0,0,0}, {0,1,2,1,287,289,0,0},
+    {0,1,2,0,290,0,0,0}, {0,1,2,1,292,294,0,0}, {0,1,2,0,295,0,0,0}, {0,1,2,1,297,299,0,0},
+    {0,1,2,0,300,0,0,0}, {0,1,2,1,302,304,0,0}, {0,1,2,0,305,0,0,0}, {0,0,0,1,0,307,0,0},
+    {0,0,0,1,0,308,0,0}, {0,1,2,1,309,311,0,0}, {0,1,2,0,312,0,0,0}, {0,1,2,1,314,316,0,0},
+    {0,1,2,0,317,0,0,0}, {0,1,2,1,319,321,0,0}, {0,1,2,0,322,0,0,0}, {0,0,0,2,0,324,0,0},
+    {0,0,0,1,0,326,0,0}, {0,1,2,1,327,329,446,2}, {0,1,2,0,330,0,448,2}, {0,1,2,1,332,334,0,0},
+    {0,1,2,0,335,0,0,0}, {0,1,2,1,337,339,0,0}, {0,1,2,0,340,0,0,0}, {0,0,0,1,0,342,0,0},
+    {0,1,2,1,343,345,0,0}, {0,1,2,0,346,0,0,0}, {0,1,2,1,348,350,0,0}, {0,1,2,0,351,0,0,0},
+    {0,1,2,1,353,355,0,0}, {0,1,2,0,356,0,0,0}, {0,1,2,1,358,360,450,1}, {0,1,2,0,361,0,451,1},
+    {0,1,2,1,363,365,0,0}, {0,1,2,0,366,0,0,0}, {0,1,2,1,368,370,0,0}, {0,1,2,0,371,0,0,0},
+    {0,1,2,1,373,375,452,1}, {0,1,2,0,376,0,453,1}, {0,1,2,1,378,380,0,0}, {0,1,2,0,381,0,0,0},
+    {0,1,2,1,383,385,0,0}, {0,1,2,0,386,0,0,0}, {0,0,0,1,0,388,0,0}, {0,1,2,1,389,391,454,1},
+    {0,1,2,0,392,0,455,1}, {0,1,2,1,394,396,456,1}, {0,1,2,0,397,0,457,1}, {0,1,2,1,399,401,0,0},
+    {0,1,2,0,402,0,0,0}, {0,1,2,1,404,406,0,0}, {0,1,2,0,407,0,0,0}, {0,1,2,1,409,411,0,0},
+    {0,1,2,0,412,0,0,0}, {0,1,2,1,414,416,0,0}, {0,1,2,0,417,0,0,0}, {0,1,2,1,419,421,0,0},
+    {0,1,2,0,422,0,0,0}, {0,1,2,1,424,426,0,0}, {0,1,2,0,427,0,0,0}, {0,1,2,1,429,431,0,0},
+    {0,1,2,1,432,434,0,0}, {0,1,2,0,435,0,0,0}, {0,1,2,1,437,439,0,0}, {0,1,2,0,440,0,0,0},
+    {0,1,2,1,442,444,0,0}, {0,1,2,0,445,0,0,0}, {0,0,0,1,0,447,458,1}, {0,0,0,1,0,448,0,0},
+    {0,0,0,1,0,449,0,0}, {0,0,0,1,0,450,0,0}, {0,0,0,1,0,451,0,0}, {0,0,0,1,0,452,0,0},
+    {0,0,0,1,0,453,0,0}, {0,0,0,1,0,454,0,0}, {0,0,0,1,0,455,0,0}, {0,0,0,1,0,456,0,0},
+    {0,0,0,1,0,457,0,0}, {0,0,0,1,0,458,0,0}, {0,0,0,1,0,459,0,0}, {0,0,0,1,0,460,0,0},
+    {0,0,0,1,0,461,0,0}, {0,0,0,1,0,462,0,0}, {0,0,0,1,0,463,0,0}, {0,0,0,1,0,464,0,0},
+    {0,0,0,1,0,465,0,0}, {0,0,0,1,0,466,0,0}, {0,0,0,1,0,467,0,0}, {0,1,2,1,468,470,459,5},
+    {0,1,2,0,471,0,464,5}, {0,0,0,1,0,473,0,0}, {0,0,0,1,0,474,0,0}, {0,0,0,1,0,475,0,0},
+    {0,0,0,1,0,476,0,0}, {0,0,0,1,0,477,0,0}, {0,0,0,1,0,478,0,0}, {0,0,0,1,0,479,0,0},
+    {0,1,2,1,480,482,469,5}, {0,1,2,0,483,0,474,5}, {0,0,0,1,0,485,0,0}, {0,0,0,1,0,486,0,0},
+    {0,0,0,1,0,487,0,0}, {0,0,0,1,0,488,0,0}, {0,0,0,1,0,489,479,1}, {0,0,0,1,0,490,0,0},
+    {0,0,0,1,0,491,0,0}, {0,0,0,1,0,492,0,0}, {0,0,0,1,0,493,0,0}, {0,0,0,1,0,494,0,0},
+    {0,0,0,1,0,495,0,0}, {0,0,0,1,0,496,0,0}, {0,0,0,1,0,497,0,0}, {0,1,2,1,498,500,0,0},
+    {0,1,2,0,501,0,0,0}, {0,1,2,1,503,505,0,0}, {0,1,2,0,506,0,0,0}, {0,1,2,1,508,510,0,0},
+    {0,1,2,0,511,0,0,0}, {0,1,2,1,513,515,0,0}, {0,1,2,0,516,0,0,0}, {0,1,3,1,518,521,0,0},
+    {0,1,3,0,522,0,0,0}, {0,1,3,1,525,528,0,0}, {0,1,3,0,529,0,0,0}, {0,1,3,1,532,535,0,0},
+    {0,1,3,0,536,0,0,0}, {0,1,3,1,539,542,0,0}, {0,1,3,0,543,0,0,0}, {0,1,3,1,546,549,0,0},
+    {0,1,3,0,550,0,0,0}, {0,1,3,1,553,556,0,0}, {0,1,3,0,557,0,0,0}, {0,1,2,1,560,562,0,0},
+    {0,1,2,0,563,0,0,0}, {0,0,0,1,0,565,0,0}, {0,1,2,1,566,568,0,0}, {0,1,2,0,569,0,0,0},
+    {0,1,2,1,571,573,0,0}, {0,1,2,0,574,0,0,0}, {0,1,2,1,576,578,480,1}, {0,1,2,0,579,0,481,1},
+    {0,1,3,1,581,584,0,0}, {0,1,3,0,585,0,0,0}, {0,1,2,1,588,590,0,0}, {0,1,2,0,591,0,0,0},
+    {0,1,2,2,593,595,0,0}, {0,0,0,1,0,597,0,0}, {0,0,0,1,0,598,0,0}, {0,1,2,1,599,601,0,0},
+    {0,1,2,0,602,0,0,0}, {0,0,0,1,0,604,0,0}, {0,0,0,1,0,605,0,0}, {0,1,2,1,606,608,0,0},
+    {0,1,2,0,609,0,0,0}, {0,1,3,1,611,614,0,0}, {0,1,3,0,615,0,0,0}, {0,1,2,1,618,620,0,0},
+    {0,1,2,0,621,0,0,0}, {0,1,2,1,623,625,0,0}, {0,1,2,0,626,0,0,0}, {0,1,2,1,628,630,0,0},
+    {0,1,2,0,631,0,0,0}, {0,1,2,1,633,635,0,0}, {0,1,2,0,636,0,0,0}, {0,1,2,1,638,640,0,0},
+    {0,1,2,0,641,0,0,0}, {0,1,2,1,643,645,0,0}, {0,1,2,0,646,0,0,0}, {0,1,2,1,648,650,0,0},
+    {0,1,2,0,651,0,0,0}, {0,1,2,1,653,655,0,0}, {0,1,2,0,656,0,0,0}, {0,1,2,1,658,660,0,0},
+    {0,1,2,0,661,0,0,0}, {0,1,2,1,663,665,0,0}, {0,1,2,0,666,0,0,0}, {0,1,2,1,668,670,0,0},
+    {0,1,2,0,671,0,0,0}, {0,1,2,1,673,675,0,0}, {0,1,2,0,676,0,0,0}, {0,1,2,1,678,680,0,0},
+    {0,1,2,0,681,0,0,0}, {0,1,2,1,683,685,0,0}, {0,1,2,0,686,0,0,0}, {0,1,2,1,688,690,0,0},
+    {0,1,2,0,691,0,0,0}, {0,1,2,1,693,695,0,0}, {0,1,2,0,696,0,0,0}, {0,0,0,1,0,698,0,0},
+    {0,1,2,1,699,701,0,0}, {0,1,2,0,702,0,0,0}, {0,0,0,1,0,704,0,0}, {0,0,0,1,0,705,0,0},
+    {0,0,0,1,0,706,0,0}, {0,1,2,1,707,709,482,1}, {0,1,2,0,710,0,483,1}, {0,1,2,1,712,714,484,1},
+    {0,1,2,0,715,0,485,1}, {0,1,3,1,717,720,0,0}, {0,1,3,0,721,0,0,0}, {0,1,3,1,724,727,0,0},
+    {0,1,3,0,728,0,0,0}, {0,1,2,1,731,733,486,1}, {0,1,2,0,734,0,487,1}, {0,1,3,1,736,739,0,0},
+    {0,1,3,0,740,0,0,0}, {0,1,2,1,743,745,0,0}, {0,1,2,0,746,0,0,0}, {0,0,0,1,0,748,0,0},
+    {0,0,0,1,0,749,0,0}, {0,0,0,1,0,750,0,0}, {0,0,0,1,0,751,0,0}, {0,0,0,1,0,752,0,0},
+    {0,0,0,1,0,753,0,0}, {0,0,0,1,0,754,0,0}, {0,0,0,1,0,755,0,0}, {0,0,0,1,0,756,0,0},
+    {0,0,0,1,0,757,0,0}, {0,0,0,1,0,758,0,0}, {0,0,0,1,0,759,0,0}, {0,0,0,1,0,760,0,0},
+    {0,0,0,0,0,0,488,1}, {230,4,0,0,0,0,0,0}, {230,0,0,0,0,0,0,0}, {232,0,0,0,0,0,0,0},
+    {220,0,0,0,0,0,0,0}, {216,4,0,0,0,0,0,0}, {202,0,0,0,0,0,0,0}, {220,4,0,0,0,0,0,0},
+    {202,4,0,0,0,0,0,0}, {1,0,0,0,0,0,0,0}, {1,4,0,0,0,0,0,0}, {230,3,1,0,761,0,0,0},
+    {230,3,1,0,762,0,0,0}, {230,3,1,0,763,0,0,0}, {230,3,2,0,764,0,0,0}, {240,4,0,1,0,766,0,0},
+    {233,0,0,0,0,0,0,0}, {234,0,0,0,0,0,0,0}, {0,0,0,1,0,767,0,0}, {0,0,0,1,0,768,0,0},
+    {0,3,1,0,769,0,0,0}, {0,0,0,1,0,770,0,0}, {0,3,1,0,771,0,0,0}, {0,0,0,1,0,772,0,0},
+    {0,1,2,0,773,0,0,0}, {0,1,2,1,775,777,0,0}, {0,3,1,0,778,0,0,0}, {0,1,2,1,779,781,0,0},
+    {0,1,2,1,782,784,0,0}, {0,1,2,1,785,787,0,0}, {0,1,2,1,788,790,0,0}, {0,1,2,1,791,793,0,0},
+    {0,1,2,1,794,796,0,0}, {0,1,3,3,797,800,0,0}, {0,0,0,1,0,803,489,7}, {0,0,0,1,0,804,0,0},
+    {0,0,0,1,0,805,0,0}, {0,0,0,1,0,806,0,0}, {0,0,0,1,0,807,496,4}, {0,0,0,1,0,808,0,0},
+    {0,0,0,1,0,809,500,5}, {0,0,0,1,0,810,0,0}, {0,0,0,1,0,811,505,7}, {0,0,0,1,0,812,0,0},
+    {0,0,0,1,0,813,0,0}, {0,0,0,1,0,814,0,0}, {0,0,0,1,0,815,0,0}, {0,0,0,1,0,816,0,0},
+    {0,0,0,1,0,817,512,4}, {0,0,0,1,0,818,0,0}, {0,0,0,1,0,819,516,1}, {0,0,0,1,0,820,0,0},
+    {0,0,0,1,0,821,0,0}, {0,0,0,1,0,822,517,6}, {0,0,0,1,0,823,0,0}, {0,0,0,1,0,824,0,0},
+    {0,0,0,1,0,825,0,0}, {0,0,0,1,0,826,523,5}, {0,1,2,1,827,829,0,0}, {0,1,2,1,830,832,0,0},
+    {0,1,2,0,833,0,528,1}, {0,1,2,0,835,0,0,0}, {0,1,2,0,837,0,529,1}, {0,1,2,0,839,0,0,0},
+    {0,1,3,3,841,844,0,0}, {0,0,0,0,0,0,530,8}, {0,0,0,0,0,0,538,4}, {0,0,0,0,0,0,542,6},
+    {0,0,0,0,0,0,548,8}, {0,0,0,0,0,0,556,4}, {0,0,0,0,0,0,560,2}, {0,0,0,1,0,847,0,0},
+    {0,0,0,0,0,0,562,8}, {0,0,0,0,0,0,570,6}, {0,1,2,0,848,0,576,3}, {0,1,2,0,850,0,579,3},
+    {0,1,2,0,852,0,0,0}, {0,1,2,0,854,0,0,0}, {0,1,2,0,856,0,582,1}, {0,0,0,1,0,858,0,0},
+    {0,0,0,1,0,859,0,0}, {0,0,0,1,0,860,0,0}, {0,0,0,0,0,0,583,2}, {0,1,2,0,861,0,0,0},
+    {0,1,2,0,863,0,0,0}, {0,0,0,1,0,865,0,0}, {0,0,0,1,0,866,0,0}, {0,0,0,1,0,867,0,0},
+    {0,0,0,1,0,868,0,0}, {0,0,0,1,0,869,0,0}, {0,0,0,1,0,870,0,0}, {0,0,0,1,0,871,0,0},
+    {0,0,0,1,0,872,0,0}, {0,0,0,1,0,873,0,0}, {0,0,0,1,0,874,0,0}, {0,0,0,1,0,875,0,0},
+    {0,0,0,1,0,876,0,0}, {0,0,0,1,0,877,0,0}, {0,0,0,1,0,878,0,0}, {0,0,0,1,0,879,0,0},
+    {0,0,0,1,0,880,0,0}, {0,0,0,1,0,881,0,0}, {0,0,0,1,0,882,0,0}, {0,0,0,1,0,883,0,0},
+    {0,0,0,1,0,884,0,0}, {0,0,0,1,0,885,0,0}, {0,0,0,1,0,886,0,0}, {0,0,0,1,0,887,0,0},
+    {0,0,0,1,0,888,0,0}, {0,1,2,1,889,891,0,0}, {0,1,2,1,892,894,0,0}, {0,0,0,1,0,895,0,0},
+    {0,1,2,1,896,898,0,0}, {0,0,0,1,0,899,0,0}, {0,0,0,1,0,900,0,0}, {0,0,0,1,0,901,585,1},
+    {0,1,2,1,902,904,0,0}, {0,0,0,1,0,905,0,0}, {0,0,0,1,0,906,0,0}, {0,0,0,1,0,907,0,0},
+    {0,0,0,1,0,908,0,0}, {0,1,2,1,909,911,0,0}, {0,1,2,1,912,914,0,0}, {0,1,2,1,915,917,0,0},
+    {0,0,0,1,0,918,0,0}, {0,0,0,1,0,919,586,2}, {0,0,0,1,0,920,0,0}, {0,0,0,1,0,921,0,0},
+    {0,0,0,1,0,922,588,1}, {0,0,0,1,0,923,0,0}, {0,0,0,1,0,924,589,3}, {0,0,0,1,0,925,592,2},
+    {0,0,0,1,0,926,594,1}, {0,0,0,1,0,927,595,4}, {0,1,2,1,928,930,0,0}, {0,0,0,1,0,931,599,1},
+    {0,0,0,1,0,932,0,0}, {0,0,0,1,0,933,0,0}, {0,0,0,1,0,934,0,0}, {0,0,0,1,0,935,600,1},
+    {0,0,0,1,0,936,0,0}, {0,0,0,1,0,937,0,0}, {0,0,0,1,0,938,0,0}, {0,0,0,1,0,939,0,0},
+    {0,0,0,1,0,940,601,4}, {0,0,0,1,0,941,0,0}, {0,0,0,1,0,942,0,0}, {0,0,0,1,0,943,0,0},
+    {0,0,0,1,0,944,605,1}, {0,0,0,1,0,945,0,0}, {0,0,0,1,0,946,0,0}, {0,0,0,1,0,947,0,0},
+    {0,0,0,1,0,948,606,1}, {0,0,0,1,0,949,0,0}, {0,0,0,1,0,950,607,1}, {0,0,0,1,0,951,0,0},
+    {0,0,0,1,0,952,0,0}, {0,0,0,0,0,0,608,2}, {0,0,0,0,0,0,610,1}, {0,0,0,0,0,0,611,3},
+    {0,0,0,0,0,0,614,2}, {0,0,0,0,0,0,616,1}, {0,0,0,0,0,0,617,4}, {0,1,2,0,953,0,0,0},
+    {0,0,0,0,0,0,621,1}, {0,0,0,0,0,0,622,1}, {0,0,0,0,0,0,623,4}, {0,0,0,0,0,0,627,1},
+    {0,0,0,0,0,0,628,1}, {0,0,0,0,0,0,629,1}, {0,1,2,0,955,0,0,0}, {0,1,2,0,957,0,0,0},
+    {0,1,2,0,959,0,0,0}, {0,0,0,0,0,0,630,1}, {0,1,2,0,961,0,0,0}, {0,1,2,0,963,0,0,0},
+    {0,1,2,0,965,0,0,0}, {0,1,2,0,967,0,0,0}, {0,0,0,1,0,969,0,0}, {0,0,0,1,0,970,0,0},
+    {0,0,0,1,0,971,0,0}, {0,0,0,1,0,972,0,0}, {0,0,0,1,0,973,0,0}, {0,0,0,1,0,974,0,0},
+    {0,0,0,1,0,975,0,0}, {0,0,0,1,0,976,0,0}, {0,0,0,1,0,977,0,0}, {0,0,0,1,0,978,0,0},
+    {0,0,0,1,0,979,631,1}, {0,0,0,0,0,0,632,1}, {0,1,2,1,980,982,0,0}, {0,1,2,0,983,0,0,0},
+    {0,0,0,1,0,985,0,0}, {0,0,0,1,0,986,0,0}, {0,0,0,1,0,987,0,0}, {0,0,0,1,0,988,0,0},
+    {0,0,0,1,0,989,0,0}, {0,0,0,1,0,990,0,0}, {0,0,0,1,0,991,0,0}, {0,0,0,1,0,992,0,0},
+    {0,0,0,1,0,993,0,0}, {0,0,0,1,0,994,0,0}, {0,0,0,1,0,995,0,0}, {0,0,0,1,0,996,0,0},
+    {0,0,0,1,0,997,0,0}, {0,0,0,1,0,998,0,0}, {0,0,0,1,0,999,0,0}, {0,0,0,1,0,1000,0,0},
+    {0,0,0,1,0,1001,0,0}, {0,0,0,1,0,1002,0,0}, {0,0,0,1,0,1003,0,0}, {0,0,0,1,0,1004,0,0},
+    {0,0,0,1,0,1005,0,0}, {0,0,0,1,0,1006,0,0}, {0,0,0,1,0,1007,0,0}, {0,0,0,1,0,1008,0,0},
+    {0,0,0,1,0,1009,0,0}, {0,0,0,1,0,1010,0,0}, {0,0,0,1,0,1011,0,0}, {0,0,0,1,0,1012,0,0},
+    {0,0,0,1,0,1013,0,0}, {0,0,0,1,0,1014,0,0}, {0,0,0,1,0,1015,0,0}, {0,0,0,1,0,1016,0,0},
+    {0,0,0,1,0,1017,0,0}, {0,1,2,1,1018,1020,0,0}, {0,1,2,0,1021,0,0,0}, {0,0,0,1,0,1023,0,0},
+    {0,0,0,1,0,1024,0,0}, {0,0,0,1,0,1025,0,0}, {0,0,0,1,0,1026,0,0}, {0,0,0,1,0,1027,0,0},
+    {0,0,0,1,0,1028,0,0}, {0,1,2,1,1029,1031,0,0}, {0,1,2,0,1032,0,0,0}, {0,1,2,1,1034,1036,0,0},
+    {0,1,2,0,1037,0,0,0}, {0,0,0,1,0,1039,0,0}, {0,1,2,1,1040,1042,0,0}, {0,1,2,0,1043,0,0,0},
+    {0,0,0,1,0,1045,633,1}, {0,0,0,0,0,0,634,1}, {0,1,2,1,1046,1048,0,0}, {0,1,2,0,1049,0,0,0},
+    {0,1,2,1,1051,1053,0,0}, {0,1,2,0,1054,0,0,0}, {0,1,2,1,1056,1058,0,0}, {0,1,2,0,1059,0,0,0},
+    {0,0,0,1,0,1061,0,0}, {0,1,2,1,1062,1064,0,0}, {0,1,2,0,1065,0,0,0}, {0,1,2,1,1067,1069,0,0},
+    {0,1,2,0,1070,0,0,0}, {0,1,2,1,1072,1074,0,0}, {0,1,2,0,1075,0,0,0}, {0,0,0,1,0,1077,635,1},
+    {0,0,0,0,0,0,636,1}, {0,1,2,1,1078,1080,0,0}, {0,1,2,0,1081,0,0,0}, {0,1,2,1,1083,1085,0,0},
+    {0,1,2,0,1086,0,0,0}, {0,1,2,1,1088,1090,0,0}, {0,1,2,0,1091,0,0,0}, {0,1,2,1,1093,1095,0,0},
+    {0,1,2,0,1096,0,0,0}, {0,1,2,1,1098,1100,0,0}, {0,1,2,0,1101,0,0,0}, {0,1,2,1,1103,1105,0,0},
+    {0,1,2,0,1106,0,0,0}, {0,0,0,1,0,1108,0,0}, {0,1,2,1,1109,1111,0,0}, {0,1,2,0,1112,0,0,0},
+    {0,0,0,1,0,1114,0,0}, {0,0,0,1,0,1115,0,0}, {0,0,0,1,0,1116,0,0}, {0,0,0,1,0,1117,0,0},
+    {0,0,0,1,0,1118,0,0}, {0,0,0,1,0,1119,0,0}, {0,0,0,1,0,1120,0,0}, {0,0,0,1,0,1121,0,0},
+    {0,0,0,1,0,1122,0,0}, {0,0,0,1,0,1123,0,0}, {0,0,0,1,0,1124,0,0}, {0,0,0,1,0,1125,0,0},
+    {0,0,0,1,0,1126,0,0}, {0,0,0,1,0,1127,0,0}, {0,0,0,1,0,1128,0,0}, {0,0,0,1,0,1129,0,0},
+    {0,0,0,1,0,1130,0,0}, {0,0,0,1,0,1131,0,0}, {0,0,0,1,0,1132,0,0}, {0,0,0,1,0,1133,0,0},
+    {0,0,0,1,0,1134,0,0}, {0,0,0,1,0,1135,0,0}, {0,0,0,1,0,1136,0,0}, {0,0,0,1,0,1137,0,0},
+    {0,0,0,1,0,1138,0,0}, {0,0,0,1,0,1139,0,0}, {0,0,0,1,0,1140,0,0}, {0,0,0,1,0,1141,0,0},
+    {0,0,0,1,0,1142,0,0}, {0,0,0,1,0,1143,0,0}, {0,0,0,1,0,1144,0,0}, {0,0,0,1,0,1145,0,0},
+    {0,0,0,1,0,1146,0,0}, {0,0,0,1,0,1147,0,0}, {0,0,0,1,0,1148,0,0}, {0,0,0,1,0,1149,0,0},
+    {0,0,0,1,0,1150,0,0}, {0,0,0,1,0,1151,0,0}, {0,0,0,1,0,1152,0,0}, {0,0,0,1,0,1153,0,0},
+    {0,0,0,1,0,1154,0,0}, {0,0,0,1,0,1155,0,0}, {0,0,0,1,0,1156,0,0}, {0,0,0,1,0,1157,0,0},
+    {0,0,0,1,0,1158,0,0}, {0,0,0,1,0,1159,0,0}, {0,0,0,1,0,1160,0,0}, {0,0,0,1,0,1161,0,0},
+    {0,0,0,1,0,1162,0,0}, {0,0,0,1,0,1163,0,0}, {0,0,0,1,0,1164,0,0}, {0,0,0,1,0,1165,0,0},
+    {0,0,0,1,0,1166,0,0}, {0,0,0,1,0,1167,0,0}, {0,0,0,1,0,1168,0,0}, {0,0,0,1,0,1169,0,0},
+    {0,0,0,1,0,1170,0,0}, {0,0,0,1,0,1171,0,0}, {0,0,0,1,0,1172,0,0}, {0,0,0,1,0,1173,0,0},
+    {0,0,0,1,0,1174,0,0}, {0,0,0,1,0,1175,0,0}, {0,0,0,1,0,1176,0,0}, {0,0,0,1,0,1177,0,0},
+    {0,0,0,1,0,1178,0,0}, {0,0,0,2,0,1179,0,0}, {222,0,0,0,0,0,0,0}, {228,0,0,0,0,0,0,0},
+    {10,0,0,0,0,0,0,0}, {11,0,0,0,0,0,0,0}, {12,0,0,0,0,0,0,0}, {13,0,0,0,0,0,0,0},
+    {14,0,0,0,0,0,0,0}, {15,0,0,0,0,0,0,0}, {16,0,0,0,0,0,0,0}, {17,0,0,0,0,0,0,0},
+    {18,0,0,0,0,0,0,0}, {19,0,0,0,0,0,0,0}, {20,0,0,0,0,0,0,0}, {21,0,0,0,0,0,0,0},
+    {22,0,0,0,0,0,0,0}, {23,0,0,0,0,0,0,0}, {24,0,0,0,0,0,0,0}, {25,0,0,0,0,0,0,0},
+    {30,0,0,0,0,0,0,0}, {31,0,0,0,0,0,0,0}, {32,0,0,0,0,0,0,0}, {0,1,2,0,1181,0,0,0},
+    {0,1,2,0,1183,0,0,0}, {0,1,2,0,1185,0,0,0}, {0,1,2,0,1187,0,0,0}, {0,1,2,0,1189,0,0,0},
+    {0,0,0,0,0,0,637,3}, {0,0,0,0,0,0,640,1}, {0,0,0,0,0,0,641,1}, {27,0,0,0,0,0,0,0},
+    {28,0,0,0,0,0,0,0}, {29,0,0,0,0,0,0,0}, {33,0,0,0,0,0,0,0}, {34,0,0,0,0,0,0,0},
+    {35,0,0,0,0,0,0,0}, {0,1,2,0,1191,0,0,0}, {0,0,0,0,0,0,642,1}, {0,1,2,0,1193,0,0,0},
+    {0,0,0,0,0,0,643,1}, {0,1,2,0,1195,0,0,0}, {0,0,0,0,0,0,644,1}, {36,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,645,1}, {0,1,2,0,1197,0,0,0}, {0,0,0,0,0,0,646,1}, {0,1,2,0,1199,0,0,0},
+    {0,0,0,0,0,0,647,1}, {0,1,2,0,1201,0,0,0}, {7,4,0,0,0,0,0,0}, {9,0,0,0,0,0,0,0},
+    {0,3,2,0,1203,0,0,0}, {0,3,2,0,1205,0,0,0}, {0,3,2,0,1207,0,0,0}, {0,3,2,0,1209,0,0,0},
+    {0,3,2,0,1211,0,0,0}, {0,3,2,0,1213,0,0,0}, {0,3,2,0,1215,0,0,0}, {0,3,2,0,1217,0,0,0},
+    {7,0,0,0,0,0,0,0}, {0,4,0,0,0,0,0,0}, {0,0,0,0,0,0,648,2}, {0,1,2,0,1219,0,0,0},
+    {0,1,2,0,1221,0,0,0}, {0,3,2,0,1223,0,0,0}, {0,3,2,0,1225,0,0,0}, {0,3,2,0,1227,0,0,0},
+    {0,3,2,0,1229,0,0,0}, {0,3,2,0,1231,0,0,0}, {0,3,2,0,1233,0,0,0}, {0,3,2,0,1235,0,0,0},
+    {0,3,2,0,1237,0,0,0}, {0,3,2,0,1239,0,0,0}, {0,0,0,0,0,0,650,3}, {0,1,2,0,1241,0,0,0},
+    {0,1,2,0,1243,0,0,0}, {0,1,2,0,1245,0,0,0}, {0,3,2,0,1247,0,0,0}, {0,3,2,0,1249,0,0,0},
+    {0,0,0,0,0,0,653,1}, {0,1,2,0,1251,0,0,0}, {0,0,0,0,0,0,654,2}, {0,0,0,0,0,0,656,1},
+    {0,1,2,0,1253,0,0,0}, {0,1,2,0,1255,0,0,0}, {0,1,2,0,1257,0,0,0}, {0,0,0,0,0,0,657,1},
+    {0,1,2,0,1259,0,0,0}, {84,0,0,0,0,0,0,0}, {91,4,0,0,0,0,0,0}, {0,0,0,0,0,0,658,1},
+    {0,1,2,0,1261,0,0,0}, {0,0,0,0,0,0,659,3}, {0,1,2,0,1263,0,0,0}, {0,1,2,0,1265,0,0,0},
+    {0,1,2,0,1267,0,662,1}, {0,1,3,0,1269,0,0,0}, {0,0,0,0,0,0,663,2}, {0,0,0,0,0,0,665,1},
+    {0,1,2,0,1272,0,0,0}, {0,1,2,0,1274,0,0,0}, {0,1,2,0,1276,0,0,0}, {9,4,0,0,0,0,0,0},
+    {0,0,0,0,0,0,666,3}, {0,1,2,0,1278,0,0,0}, {0,1,2,0,1280,0,669,1}, {0,1,3,0,1282,0,0,0},
+    {0,1,2,0,1285,0,0,0}, {103,0,0,0,0,0,0,0}, {107,0,0,0,0,0,0,0}, {118,0,0,0,0,0,0,0},
+    {122,0,0,0,0,0,0,0}, {216,0,0,0,0,0,0,0}, {0,3,2,0,1287,0,0,0}, {0,3,2,0,1289,0,0,0},
+    {0,3,2,0,1291,0,0,0}, {0,3,2,0,1293,0,0,0}, {0,3,2,0,1295,0,0,0}, {0,3,2,0,1297,0,0,0},
+    {129,0,0,0,0,0,0,0}, {130,0,0,0,0,0,0,0}, {0,3,2,0,1299,0,0,0}, {132,0,0,0,0,0,0,0},
+    {0,3,2,0,1301,0,0,0}, {0,3,2,0,1303,0,0,0}, {0,3,2,0,1305,0,0,0}, {0,3,2,0,1307,0,0,0},
+    {0,3,2,0,1309,0,0,0}, {0,3,2,0,1311,0,0,0}, {0,3,2,0,1313,0,0,0}, {0,3,2,0,1315,0,0,0},
+    {0,3,2,0,1317,0,0,0}, {0,3,2,0,1319,0,0,0}, {0,0,0,0,0,0,670,1}, {0,1,2,0,1321,0,0,0},
+    {0,0,0,1,0,1323,0,0}, {0,0,0,1,0,1324,0,0}, {0,0,0,1,0,1325,0,0}, {0,0,0,1,0,1326,0,0},
+    {0,0,0,1,0,1327,0,0}, {0,0,0,1,0,1328,0,0}, {0,0,0,1,0,1329,0,0}, {0,0,0,1,0,1330,0,0},
+    {0,0,0,1,0,1331,0,0}, {0,0,0,1,0,1332,0,0}, {0,0,0,1,0,1333,0,0}, {0,0,0,1,0,1334,0,0},
+    {0,0,0,1,0,1335,0,0}, {0,0,0,1,0,1336,0,0}, {0,0,0,1,0,1337,0,0}, {0,0,0,1,0,1338,0,0},
+    {0,0,0,1,0,1339,0,0}, {0,0,0,1,0,1340,0,0}, {0,0,0,1,0,1341,0,0}, {0,0,0,1,0,1342,0,0},
+    {0,0,0,1,0,1343,0,0}, {0,0,0,1,0,1344,0,0}, {0,0,0,1,0,1345,0,0}, {0,0,0,1,0,1346,0,0},
+    {0,0,0,1,0,1347,0,0}, {0,0,0,1,0,1348,0,0}, {0,0,0,1,0,1349,0,0}, {0,0,0,1,0,1350,0,0},
+    {0,0,0,1,0,1351,0,0}, {0,0,0,1,0,1352,0,0}, {0,0,0,1,0,1353,0,0}, {0,0,0,1,0,1354,0,0},
+    {0,0,0,1,0,1355,0,0}, {0,0,0,1,0,1356,0,0}, {0,0,0,1,0,1357,0,0}, {0,0,0,1,0,1358,0,0},
+    {0,0,0,1,0,1359,0,0}, {0,0,0,1,0,1360,0,0}, {0,0,0,1,0,1361,0,0}, {0,0,0,1,0,1362,0,0},
+    {0,0,0,1,0,1363,0,0}, {0,0,0,1,0,1364,0,0}, {0,0,0,1,0,1365,0,0}, {0,0,0,1,0,1366,0,0},
+    {0,0,0,1,0,1367,0,0}, {0,0,0,1,0,1368,0,0}, {0,0,0,0,0,0,671,1}, {0,1,2,0,1369,0,0,0},
+    {0,0,0,0,0,0,672,1}, {0,1,2,0,1371,0,0,0}, {0,0,0,0,0,0,673,1}, {0,1,2,0,1373,0,0,0},
+    {0,0,0,0,0,0,674,1}, {0,1,2,0,1375,0,0,0}, {0,0,0,0,0,0,675,1}, {0,1,2,0,1377,0,0,0},
+    {0,0,0,0,0,0,676,1}, {0,1,2,0,1379,0,0,0}, {0,0,0,0,0,0,677,1}, {0,1,2,0,1381,0,0,0},
+    {0,0,0,0,0,0,678,1}, {0,1,2,0,1383,0,0,0}, {0,0,0,0,0,0,679,1}, {0,0,0,0,0,0,680,1},
+    {0,1,2,0,1385,0,0,0}, {0,1,2,0,1387,0,0,0}, {0,0,0,0,0,0,681,1}, {0,1,2,0,1389,0,0,0},
+    {0,0,0,1,0,1391,0,0}, {0,0,0,1,0,1392,0,0}, {0,0,0,1,0,1393,0,0}, {0,0,0,1,0,1394,0,0},
+    {0,0,0,1,0,1395,0,0}, {0,0,0,1,0,1396,0,0}, {0,0,0,1,0,1397,0,0}, {0,0,0,1,0,1398,0,0},
+    {0,0,0,1,0,1399,0,0}, {0,0,0,1,0,1400,0,0}, {0,0,0,1,0,1401,0,0}, {0,0,0,1,0,1402,0,0},
+    {0,0,0,1,0,1403,0,0}, {0,0,0,1,0,1404,0,0}, {0,0,0,1,0,1405,0,0}, {0,0,0,1,0,1406,0,0},
+    {0,0,0,1,0,1407,0,0}, {0,0,0,1,0,1408,0,0}, {0,0,0,1,0,1409,0,0}, {0,0,0,1,0,1410,0,0},
+    {0,0,0,1,0,1411,0,0}, {0,0,0,1,0,1412,0,0}, {0,0,0,1,0,1413,0,0}, {0,0,0,1,0,1414,0,0},
+    {0,0,0,1,0,1415,0,0}, {0,0,0,1,0,1416,0,0}, {0,0,0,1,0,1417,0,0}, {0,0,0,1,0,1418,0,0},
+    {0,0,0,1,0,1419,0,0}, {0,0,0,1,0,1420,0,0}, {0,0,0,1,0,1421,0,0}, {0,0,0,1,0,1422,0,0},
+    {0,0,0,1,0,1423,0,0}, {0,0,0,1,0,1424,0,0}, {0,0,0,1,0,1425,0,0}, {0,0,0,1,0,1426,0,0},
+    {0,0,0,1,0,1427,0,0}, {0,0,0,1,0,1428,0,0}, {0,0,0,1,0,1429,0,0}, {0,0,0,1,0,1430,0,0},
+    {0,0,0,1,0,1431,0,0}, {0,0,0,1,0,1432,0,0}, {0,0,0,1,0,1433,0,0}, {0,0,0,1,0,1434,0,0},
+    {0,0,0,1,0,1435,0,0}, {0,0,0,1,0,1436,0,0}, {0,0,0,1,0,1437,0,0}, {0,0,0,1,0,1438,0,0},
+    {0,0,0,1,0,1439,0,0}, {0,0,0,1,0,1440,0,0}, {0,0,0,1,0,1441,0,0}, {0,0,0,1,0,1442,0,0},
+    {0,0,0,1,0,1443,0,0}, {0,0,0,1,0,1444,0,0}, {0,0,0,1,0,1445,0,0}, {214,0,0,0,0,0,0,0},
+    {218,0,0,0,0,0,0,0}, {0,1,2,1,1446,1448,0,0}, {0,1,2,0,1449,0,0,0}, {0,1,2,1,1451,1453,0,0},
+    {0,1,2,0,1454,0,0,0}, {0,1,2,1,1456,1458,0,0}, {0,1,2,0,1459,0,0,0}, {0,1,2,1,1461,1463,0,0},
+    {0,1,2,0,1464,0,0,0}, {0,1,3,1,1466,1469,0,0}, {0,1,3,0,1470,0,0,0}, {0,1,2,1,1473,1475,0,0},
+    {0,1,2,0,1476,0,0,0}, {0,1,2,1,1478,1480,0,0}, {0,1,2,0,1481,0,0,0}, {0,1,2,1,1483,1485,0,0},
+    {0,1,2,0,1486,0,0,0}, {0,1,2,1,1488,1490,0,0}, {0,1,2,0,1491,0,0,0}, {0,1,2,1,1493,1495,0,0},
+    {0,1,2,0,1496,0,0,0}, {0,1,3,1,1498,1501,0,0}, {0,1,3,0,1502,0,0,0}, {0,1,3,1,1505,1508,0,0},
+    {0,1,3,0,1509,0,0,0}, {0,1,2,1,1512,1514,0,0}, {0,1,2,0,1515,0,0,0}, {0,1,2,1,1517,1519,0,0},
+    {0,1,2,0,1520,0,0,0}, {0,1,3,1,1522,1525,0,0}, {0,1,3,0,1526,0,0,0}, {0,1,2,1,1529,1531,0,0},
+    {0,1,2,0,1532,0,0,0}, {0,1,2,1,1534,1536,0,0}, {0,1,2,0,1537,0,0,0}, {0,1,2,1,1539,1541,0,0},
+    {0,1,2,0,1542,0,0,0}, {0,1,2,1,1544,1546,0,0}, {0,1,2,0,1547,0,0,0}, {0,1,2,1,1549,1551,0,0},
+    {0,1,2,0,1552,0,0,0}, {0,1,2,1,1554,1556,0,0}, {0,1,2,0,1557,0,0,0}, {0,1,2,1,1559,1561,0,0},
+    {0,1,2,0,1562,0,0,0}, {0,1,2,1,1564,1566,0,0}, {0,1,2,0,1567,0,0,0}, {0,1,3,1,1569,1572,0,0},
+    {0,1,3,0,1573,0,0,0}, {0,1,2,1,1576,1578,0,0}, {0,1,2,0,1579,0,0,0}, {0,1,2,1,1581,1583,0,0},
+    {0,1,2,0,1584,0,0,0}, {0,1,2,1,1586,1588,0,0}, {0,1,2,0,1589,0,0,0}, {0,1,2,1,1591,1593,682,1},
+    {0,1,2,0,1594,0,683,1}, {0,1,3,1,1596,1599,0,0}, {0,1,3,0,1600,0,0,0}, {0,1,2,1,1603,1605,0,0},
+    {0,1,2,0,1606,0,0,0}, {0,1,2,1,1608,1610,0,0}, {0,1,2,0,1611,0,0,0}, {0,1,2,1,1613,1615,0,0},
+    {0,1,2,0,1616,0,0,0}, {0,1,2,1,1618,1620,0,0}, {0,1,2,0,1621,0,0,0}, {0,1,2,1,1623,1625,0,0},
+    {0,1,2,0,1626,0,0,0}, {0,1,2,1,1628,1630,0,0}, {0,1,2,0,1631,0,0,0}, {0,1,2,1,1633,1635,0,0},
+    {0,1,2,0,1636,0,0,0}, {0,1,2,1,1638,1640,0,0}, {0,1,2,0,1641,0,0,0}, {0,1,2,1,1643,1645,0,0},
+    {0,1,2,0,1646,0,0,0}, {0,1,3,1,1648,1651,0,0}, {0,1,3,0,1652,0,0,0}, {0,1,3,1,1655,1658,0,0},
+    {0,1,3,0,1659,0,0,0}, {0,1,3,1,1662,1665,0,0}, {0,1,3,0,1666,0,0,0}, {0,1,3,1,1669,1672,0,0},
+    {0,1,3,0,1673,0,0,0}, {0,1,2,1,1676,1678,0,0}, {0,1,2,0,1679,0,0,0}, {0,1,2,1,1681,1683,0,0},
+    {0,1,2,0,1684,0,0,0}, {0,1,2,1,1686,1688,0,0}, {0,1,2,0,1689,0,0,0}, {0,1,2,1,1691,1693,684,1},
+    {0,1,2,0,1694,0,685,1}, {0,1,3,1,1696,1699,0,0}, {0,1,3,0,1700,0,0,0}, {0,1,2,1,1703,1705,0,0},
+    {0,1,2,0,1706,0,0,0}, {0,1,2,1,1708,1710,0,0}, {0,1,2,0,1711,0,0,0}, {0,1,2,1,1713,1715,686,1},
+    {0,1,2,0,1716,0,687,1}, {0,1,3,1,1718,1721,0,0}, {0,1,3,0,1722,0,0,0}, {0,1,3,1,1725,1728,0,0},
+    {0,1,3,0,1729,0,0,0}, {0,1,3,1,1732,1735,0,0}, {0,1,3,0,1736,0,0,0}, {0,1,2,1,1739,1741,0,0},
+    {0,1,2,0,1742,0,0,0}, {0,1,2,1,1744,1746,0,0}, {0,1,2,0,1747,0,0,0}, {0,1,2,1,1749,1751,0,0},
+    {0,1,2,0,1752,0,0,0}, {0,1,2,1,1754,1756,0,0}, {0,1,2,0,1757,0,0,0}, {0,1,2,1,1759,1761,0,0},
+    {0,1,2,0,1762,0,0,0}, {0,1,2,1,1764,1766,0,0}, {0,1,2,0,1767,0,0,0}, {0,1,2,1,1769,1771,0,0},
+    {0,1,2,0,1772,0,0,0}, {0,1,3,1,1774,1777,0,0}, {0,1,3,0,1778,0,0,0}, {0,1,3,1,1781,1784,0,0},
+    {0,1,3,0,1785,0,0,0}, {0,1,2,1,1788,1790,0,0}, {0,1,2,0,1791,0,0,0}, {0,1,2,1,1793,1795,0,0},
+    {0,1,2,0,1796,0,0,0}, {0,1,2,1,1798,1800,0,0}, {0,1,2,0,1801,0,0,0}, {0,1,2,1,1803,1805,0,0},
+    {0,1,2,0,1806,0,0,0}, {0,1,2,1,1808,1810,0,0}, {0,1,2,0,1811,0,0,0}, {0,1,2,1,1813,1815,0,0},
+    {0,1,2,0,1816,0,0,0}, {0,1,2,1,1818,1820,0,0}, {0,1,2,0,1821,0,0,0}, {0,1,2,1,1823,1825,0,0},
+    {0,1,2,0,1826,0,0,0}, {0,1,2,1,1828,1830,0,0}, {0,1,2,0,1831,0,0,0}, {0,1,2,1,1833,1835,0,0},
+    {0,1,2,0,1836,0,0,0}, {0,1,2,1,1838,1840,0,0}, {0,1,2,0,1841,0,0,0}, {0,1,2,1,1843,1845,0,0},
+    {0,1,2,0,1846,0,0,0}, {0,1,2,1,1848,1850,0,0}, {0,1,2,0,1851,0,0,0}, {0,1,2,2,1853,1855,0,0},
+    {0,1,2,2,1857,1859,0,0}, {0,1,2,2,1861,1863,0,0}, {0,1,2,2,1865,1867,0,0}, {0,0,0,2,0,1869,0,0},
+    {0,1,2,1,1871,1873,0,0}, {0,0,0,2,0,1874,0,0}, {0,1,2,1,1876,1878,688,2}, {0,1,2,0,1879,0,690,2},
+    {0,1,2,1,1881,1883,0,0}, {0,1,2,0,1884,0,0,0}, {0,1,3,1,1886,1889,0,0}, {0,1,3,0,1890,0,0,0},
+    {0,1,3,1,1893,1896,0,0}, {0,1,3,0,1897,0,0,0}, {0,1,3,1,1900,1903,0,0}, {0,1,3,0,1904,0,0,0},
+    {0,1,3,1,1907,1910,0,0}, {0,1,3,0,1911,0,0,0}, {0,1,3,1,1914,1917,0,0}, {0,1,3,0,1918,0,0,0},
+    {0,1,3,1,1921,1924,0,0}, {0,1,3,0,1925,0,0,0}, {0,1,3,1,1928,1931,0,0}, {0,1,3,0,1932,0,0,0},
+    {0,1,3,1,1935,1938,0,0}, {0,1,3,0,1939,0,0,0}, {0,1,3,1,1942,1945,0,0}, {0,1,3,0,1946,0,0,0},
+    {0,1,3,1,1949,1952,0,0}, {0,1,3,0,1953,0,0,0}, {0,1,2,1,1956,1958,692,1}, {0,1,2,0,1959,0,693,1},
+    {0,1,2,1,1961,1963,0,0}, {0,1,2,0,1964,0,0,0}, {0,1,2,1,1966,1968,0,0}, {0,1,2,0,1969,0,0,0},
+    {0,1,3,1,1971,1974,0,0}, {0,1,3,0,1975,0,0,0}, {0,1,3,1,1978,1981,0,0}, {0,1,3,0,1982,0,0,0},
+    {0,1,3,1,1985,1988,0,0}, {0,1,3,0,1989,0,0,0}, {0,1,3,1,1992,1995,0,0}, {0,1,3,0,1996,0,0,0},
+    {0,1,3,1,1999,2002,0,0}, {0,1,3,0,2003,0,0,0}, {0,1,2,1,2006,2008,0,0}, {0,1,2,0,2009,0,0,0},
+    {0,1,2,1,2011,2013,0,0}, {0,1,2,0,2014,0,0,0}, {0,1,2,1,2016,2018,694,1}, {0,1,2,0,2019,0,695,1},
+    {0,1,2,1,2021,2023,0,0}, {0,1,2,0,2024,0,0,0}, {0,1,3,1,2026,2029,0,0}, {0,1,3,0,2030,0,0,0},
+    {0,1,3,1,2033,2036,0,0}, {0,1,3,0,2037,0,0,0}, {0,1,3,1,2040,2043,0,0}, {0,1,3,0,2044,0,0,0},
+    {0,1,3,1,2047,2050,0,0}, {0,1,3,0,2051,0,0,0}, {0,1,3,1,2054,2057,0,0}, {0,1,3,0,2058,0,0,0},
+    {0,1,3,1,2061,2064,0,0}, {0,1,3,0,2065,0,0,0}, {0,1,3,1,2068,2071,0,0}, {0,1,3,0,2072,0,0,0},
+    {0,1,3,1,2075,2078,0,0}, {0,1,3,0,2079,0,0,0}, {0,1,3,1,2082,2085,0,0}, {0,1,3,0,2086,0,0,0},
+    {0,1,3,1,2089,2092,0,0}, {0,1,3,0,2093,0,0,0}, {0,1,2,1,2096,2098,0,0}, {0,1,2,0,2099,0,0,0},
+    {0,1,2,1,2101,2103,0,0}, {0,1,2,0,2104,0,0,0}, {0,1,3,1,2106,2109,0,0}, {0,1,3,0,2110,0,0,0},
+    {0,1,3,1,2113,2116,0,0}, {0,1,3,0,2117,0,0,0}, {0,1,3,1,2120,2123,0,0}, {0,1,3,0,2124,0,0,0},
+    {0,1,3,1,2127,2130,0,0}, {0,1,3,0,2131,0,0,0}, {0,1,3,1,2134,2137,0,0}, {0,1,3,0,2138,0,0,0},
+    {0,1,2,1,2141,2143,0,0}, {0,1,2,0,2144,0,0,0}, {0,1,2,1,2146,2148,0,0}, {0,1,2,0,2149,0,0,0},
+    {0,1,2,1,2151,2153,0,0}, {0,1,2,0,2154,0,0,0}, {0,1,2,1,2156,2158,0,0}, {0,1,2,0,2159,0,0,0},
+    {0,0,0,1,0,2161,0,0}, {0,0,0,1,0,2162,0,0}, {0,0,0,1,0,2163,0,0}, {0,1,2,0,2164,0,696,4},
+    {0,1,2,0,2166,0,700,4}, {0,1,3,0,2168,0,704,1}, {0,1,3,0,2171,0,705,1}, {0,1,3,0,2174,0,706,1},
+    {0,1,3,0,2177,0,707,1}, {0,1,3,0,2180,0,708,1}, {0,1,3,0,2183,0,709,1}, {0,1,2,1,2186,2188,710,4},
+    {0,1,2,1,2189,2191,714,4}, {0,1,3,1,2192,2195,718,1}, {0,1,3,1,2196,2199,719,1}, {0,1,3,1,2200,2203,720,1},
+    {0,1,3,1,2204,2207,721,1}, {0,1,3,1,2208,2211,722,1}, {0,1,3,1,2212,2215,723,1}, {0,1,2,0,2216,0,724,2},
+    {0,1,2,0,2218,0,726,2}, {0,1,3,0,2220,0,0,0}, {0,1,3,0,2223,0,0,0}, {0,1,3,0,2226,0,0,0},
+    {0,1,3,0,2229,0,0,0}, {0,1,2,1,2232,2234,728,2}, {0,1,2,1,2235,2237,730,2}, {0,1,3,1,2238,2241,0,0},
+    {0,1,3,1,2242,2245,0,0}, {0,1,3,1,2246,2249,0,0}, {0,1,3,1,2250,2253,0,0}, {0,1,2,0,2254,0,732,4},
+    {0,1,2,0,2256,0,736,4}, {0,1,3,0,2258,0,740,1}, {0,1,3,0,2261,0,741,1}, {0,1,3,0,2264,0,742,1},
+    {0,1,3,0,2267,0,743,1}, {0,1,3,0,2270,0,744,1}, {0,1,3,0,2273,0,745,1}, {0,1,2,1,2276,2278,746,4},
+    {0,1,2,1,2279,2281,750,4}, {0,1,3,1,2282,2285,754,1}, {0,1,3,1,2286,2289,755,1}, {0,1,3,1,2290,2293,756,1},
+    {0,1,3,1,2294,2297,757,1}, {0,1,3,1,2298,2301,758,1}, {0,1,3,1,2302,2305,759,1}, {0,1,2,0,2306,0,760,3},
+    {0,1,2,0,2308,0,763,3}, {0,1,3,0,2310,0,0,0}, {0,1,3,0,2313,0,0,0}, {0,1,3,0,2316,0,0,0},
+    {0,1,3,0,2319,0,0,0}, {0,1,3,0,2322,0,0,0}, {0,1,3,0,2325,0,0,0}, {0,1,2,1,2328,2330,766,3},
+    {0,1,2,1,2331,2333,769,3}, {0,1,3,1,2334,2337,0,0}, {0,1,3,1,2338,2341,0,0}, {0,1,3,1,2342,2345,0,0},
+    {0,1,3,1,2346,2349,0,0}, {0,1,3,1,2350,2353,0,0}, {0,1,3,1,2354,2357,0,0}, {0,1,2,0,2358,0,772,2},
+    {0,1,2,0,2360,0,774,2}, {0,1,3,0,2362,0,0,0}, {0,1,3,0,2365,0,0,0}, {0,1,3,0,2368,0,0,0},
+    {0,1,3,0,2371,0,0,0}, {0,1,2,1,2374,2376,776,2}, {0,1,2,1,2377,2379,778,2}, {0,1,3,1,2380,2383,0,0},
+    {0,1,3,1,2384,2387,0,0}, {0,1,3,1,2388,2391,0,0}, {0,1,3,1,2392,2395,0,0}, {0,1,2,2,2396,2398,780,3},
+    {0,1,2,0,2400,0,783,3}, {0,1,3,3,2402,2405,0,0}, {0,1,3,0,2408,0,0,0}, {0,1,3,3,2411,2414,0,0},
+    {0,1,3,0,2417,0,0,0}, {0,1,3,3,2420,2423,0,0}, {0,1,3,0,2426,0,0,0}, {0,1,2,1,2429,2431,786,3},
+    {0,1,3,1,2432,2435,0,0}, {0,1,3,1,2436,2439,0,0}, {0,1,3,1,2440,2443,0,0}, {0,1,2,0,2444,0,789,4},
+    {0,1,2,0,2446,0,793,4}, {0,1,3,0,2448,0,797,1}, {0,1,3,0,2451,0,798,1}, {0,1,3,0,2454,0,799,1},
+    {0,1,3,0,2457,0,800,1}, {0,1,3,0,2460,0,801,1}, {0,1,3,0,2463,0,802,1}, {0,1,2,1,2466,2468,803,4},
+    {0,1,2,1,2469,2471,807,4}, {0,1,3,1,2472,2475,811,1}, {0,1,3,1,2476,2479,812,1}, {0,1,3,1,2480,2483,813,1},
+    {0,1,3,1,2484,2487,814,1}, {0,1,3,1,2488,2491,815,1}, {0,1,3,1,2492,2495,816,1}, {0,1,2,0,2496,0,817,1},
+    {0,3,2,0,2498,0,0,0}, {0,1,2,0,2500,0,0,0}, {0,3,2,0,2502,0,0,0}, {0,1,2,0,2504,0,818,1},
+    {0,3,2,0,2506,0,0,0}, {0,1,2,0,2508,0,0,0}, {0,3,2,0,2510,0,0,0}, {0,1,2,0,2512,0,0,0},
+    {0,3,2,0,2514,0,0,0}, {0,1,2,0,2516,0,0,0}, {0,3,2,0,2518,0,0,0}, {0,1,2,0,2520,0,819,1},
+    {0,3,2,0,2522,0,0,0}, {0,1,3,2,2524,2527,0,0}, {0,1,3,2,2529,2532,0,0}, {0,1,4,2,2534,2538,0,0},
+    {0,1,4,2,2540,2544,0,0}, {0,1,4,2,2546,2550,0,0}, {0,1,4,2,2552,2556,0,0}, {0,1,4,2,2558,2562,0,0},
+    {0,1,4,2,2564,2568,0,0}, {0,1,3,2,2570,2573,0,0}, {0,1,3,2,2575,2578,0,0}, {0,1,4,2,2580,2584,0,0},
+    {0,1,4,2,2586,2590,0,0}, {0,1,4,2,2592,2596,0,0}, {0,1,4,2,2598,2602,0,0}, {0,1,4,2,2604,2608,0,0},
+    {0,1,4,2,2610,2614,0,0}, {0,1,3,2,2616,2619,0,0}, {0,1,3,2,2621,2624,0,0}, {0,1,4,2,2626,2630,0,0},
+    {0,1,4,2,2632,2636,0,0}, {0,1,4,2,2638,2642,0,0}, {0,1,4,2,2644,2648,0,0}, {0,1,4,2,2650,2654,0,0},
+    {0,1,4,2,2656,2660,0,0}, {0,1,3,2,2662,2665,0,0}, {0,1,3,2,2667,2670,0,0}, {0,1,4,2,2672,2676,0,0},
+    {0,1,4,2,2678,2682,0,0}, {0,1,4,2,2684,2688,0,0}, {0,1,4,2,2690,2694,0,0}, {0,1,4,2,2696,2700,0,0},
+    {0,1,4,2,2702,2706,0,0}, {0,1,3,2,2708,2711,0,0}, {0,1,3,2,2713,2716,0,0}, {0,1,4,2,2718,2722,0,0},
+    {0,1,4,2,2724,2728,0,0}, {0,1,4,2,2730,2734,0,0}, {0,1,4,2,2736,2740,0,0}, {0,1,4,2,2742,2746,0,0},
+    {0,1,4,2,2748,2752,0,0}, {0,1,3,2,2754,2757,0,0}, {0,1,3,2,2759,2762,0,0}, {0,1,4,2,2764,2768,0,0},
+    {0,1,4,2,2770,2774,0,0}, {0,1,4,2,2776,2780,0,0}, {0,1,4,2,2782,2786,0,0}, {0,1,4,2,2788,2792,0,0},
+    {0,1,4,2,2794,2798,0,0}, {0,1,2,0,2800,0,0,0}, {0,1,2,0,2802,0,0,0}, {0,1,3,2,2804,2807,0,0},
+    {0,1,2,2,2809,2811,0,0}, {0,1,3,2,2813,2816,0,0}, {0,1,2,2,2818,2820,820,1}, {0,1,3,3,2822,2825,0,0},
+    {0,1,2,1,2828,2830,0,0}, {0,1,2,1,2831,2833,0,0}, {0,1,2,1,2834,2836,0,0}, {0,3,2,1,2837,2839,0,0},
+    {0,1,2,2,2840,2842,0,0}, {0,3,1,1,2844,2845,0,0}, {0,0,0,0,0,0,821,3}, {0,1,2,0,2846,0,0,0},
+    {0,1,3,2,2848,2851,0,0}, {0,1,2,2,2853,2855,0,0}, {0,1,3,2,2857,2860,0,0}, {0,1,2,2,2862,2864,824,1},
+    {0,1,3,3,2866,2869,0,0}, {0,1,2,1,2872,2874,0,0}, {0,3,2,1,2875,2877,0,0}, {0,1,2,1,2878,2880,0,0},
+    {0,3,2,1,2881,2883,0,0}, {0,1,2,2,2884,2886,0,0}, {0,1,2,0,2888,0,0,0}, {0,1,2,0,2890,0,0,0},
+    {0,1,2,0,2892,0,0,0}, {0,1,2,0,2894,0,0,0}, {0,1,2,0,2896,0,0,0}, {0,1,3,3,2898,2901,0,0},
+    {0,3,3,3,2904,2907,0,0}, {0,1,2,2,2910,2912,0,0}, {0,1,3,3,2914,2917,0,0}, {0,1,2,1,2920,2922,0,0},
+    {0,1,2,1,2923,2925,0,0}, {0,1,2,1,2926,2928,0,0}, {0,3,2,1,2929,2931,0,0}, {0,1,2,0,2932,0,0,0},
+    {0,1,2,0,2934,0,0,0}, {0,1,2,0,2936,0,0,0}, {0,1,2,0,2938,0,0,0}, {0,1,2,0,2940,0,0,0},
+    {0,1,3,3,2942,2945,0,0}, {0,3,3,3,2948,2951,0,0}, {0,1,2,2,2954,2956,0,0}, {0,1,2,0,2958,0,0,0},
+    {0,1,2,2,2960,2962,0,0}, {0,1,3,3,2964,2967,0,0}, {0,1,2,1,2970,2972,0,0}, {0,1,2,1,2973,2975,0,0},
+    {0,1,2,1,2976,2978,0,0}, {0,3,2,1,2979,2981,0,0}, {0,1,2,1,2982,2984,0,0}, {0,1,2,0,2985,0,0,0},
+    {0,3,2,0,2987,0,0,0}, {0,3,1,0,2989,0,0,0}, {0,1,3,2,2990,2993,0,0}, {0,1,2,2,2995,2997,0,0},
+    {0,1,3,2,2999,3002,0,0}, {0,1,2,2,3004,3006,825,1}, {0,1,3,3,3008,3011,0,0}, {0,1,2,1,3014,3016,0,0},
+    {0,3,2,1,3017,3019,0,0}, {0,1,2,1,3020,3022,0,0}, {0,3,2,1,3023,3025,0,0}, {0,1,2,2,3026,3028,0,0},
+    {0,3,1,0,3030,0,0,0}, {0,0,0,0,0,0,826,3}, {0,3,1,0,3031,0,0,0}, {0,3,1,0,3032,0,0,0},
+    {0,3,1,1,3033,3034,0,0}, {0,3,1,1,3035,3036,0,0}, {0,3,2,1,3037,3039,0,0}, {0,0,0,1,0,3040,0,0},
+    {0,0,0,1,0,3041,0,0}, {0,0,0,1,0,3042,0,0}, {0,0,0,1,0,3043,0,0}, {0,0,0,1,0,3044,0,0},
+    {0,0,0,1,0,3045,0,0}, {0,0,0,1,0,3046,0,0}, {0,0,0,1,0,3047,0,0}, {0,0,0,1,0,3048,0,0},
+    {0,0,0,1,0,3049,0,0}, {0,0,0,1,0,3050,0,0}, {0,0,0,1,0,3051,0,0}, {0,0,0,1,0,3052,0,0},
+    {0,0,0,1,0,3053,0,0}, {0,0,0,1,0,3054,0,0}, {0,0,0,1,0,3055,0,0}, {0,0,0,1,0,3056,0,0},
+    {0,0,0,1,0,3057,0,0}, {0,0,0,0,0,0,829,1}, {0,0,0,0,0,0,830,1}, {0,0,0,0,0,0,831,1},
+    {0,1,2,0,3058,0,0,0}, {0,1,2,0,3060,0,0,0}, {0,1,2,0,3062,0,0,0}, {0,1,2,0,3064,0,0,0},
+    {0,1,2,0,3066,0,0,0}, {0,1,2,0,3068,0,0,0}, {0,0,0,0,0,0,832,1}, {0,0,0,0,0,0,833,1},
+    {0,0,0,0,0,0,834,1}, {0,0,0,0,0,0,835,1}, {0,1,2,0,3070,0,0,0}, {0,0,0,0,0,0,836,1},
+    {0,1,2,0,3072,0,0,0}, {0,0,0,0,0,0,837,1}, {0,1,2,0,3074,0,0,0}, {0,0,0,0,0,0,838,1},
+    {0,1,2,0,3076,0,0,0}, {0,0,0,0,0,0,839,1}, {0,1,2,0,3078,0,0,0}, {0,0,0,0,0,0,840,1},
+    {0,1,2,0,3080,0,0,0}, {0,0,0,0,0,0,841,1}, {0,1,2,0,3082,0,0,0}, {0,0,0,0,0,0,842,1},
+    {0,1,2,0,3084,0,0,0}, {0,0,0,0,0,0,843,1}, {0,1,2,0,3086,0,0,0}, {0,0,0,0,0,0,844,1},
+    {0,1,2,0,3088,0,0,0}, {0,0,0,0,0,0,845,1}, {0,1,2,0,3090,0,0,0}, {0,0,0,0,0,0,846,1},
+    {0,0,0,0,0,0,847,1}, {0,1,2,0,3092,0,0,0}, {0,1,2,0,3094,0,0,0}, {0,1,2,0,3096,0,0,0},
+    {0,1,2,0,3098,0,0,0}, {0,1,2,0,3100,0,0,0}, {0,0,0,0,0,0,848,1}, {0,0,0,0,0,0,849,1},
+    {0,1,2,0,3102,0,0,0}, {0,1,2,0,3104,0,0,0}, {0,0,0,0,0,0,850,1}, {0,0,0,0,0,0,851,1},
+    {0,1,2,0,3106,0,0,0}, {0,1,2,0,3108,0,0,0}, {0,0,0,0,0,0,852,1}, {0,0,0,0,0,0,853,1},
+    {0,0,0,0,0,0,854,1}, {0,0,0,0,0,0,855,1}, {0,1,2,0,3110,0,0,0}, {0,1,2,0,3112,0,0,0},
+    {0,0,0,0,0,0,856,1}, {0,0,0,0,0,0,857,1}, {0,1,2,0,3114,0,0,0}, {0,1,2,0,3116,0,0,0},
+    {0,0,0,0,0,0,858,1}, {0,0,0,0,0,0,859,1}, {0,1,2,0,3118,0,0,0}, {0,1,2,0,3120,0,0,0},
+    {0,0,0,0,0,0,860,1}, {0,0,0,0,0,0,861,1}, {0,0,0,0,0,0,862,1}, {0,0,0,0,0,0,863,1},
+    {0,0,0,0,0,0,864,1}, {0,0,0,0,0,0,865,1}, {0,1,2,0,3122,0,0,0}, {0,1,2,0,3124,0,0,0},
+    {0,1,2,0,3126,0,0,0}, {0,1,2,0,3128,0,0,0}, {0,0,0,0,0,0,866,1}, {0,0,0,0,0,0,867,1},
+    {0,0,0,0,0,0,868,1}, {0,0,0,0,0,0,869,1}, {0,1,2,0,3130,0,0,0}, {0,1,2,0,3132,0,0,0},
+    {0,1,2,0,3134,0,0,0}, {0,1,2,0,3136,0,0,0}, {0,1,2,0,3138,0,0,0}, {0,1,2,0,3140,0,0,0},
+    {0,1,2,0,3142,0,0,0}, {0,1,2,0,3144,0,0,0}, {0,3,1,0,3146,0,0,0}, {0,3,1,0,3147,0,0,0},
+    {0,0,0,1,0,3148,0,0}, {0,0,0,1,0,3149,0,0}, {0,0,0,1,0,3150,0,0}, {0,0,0,1,0,3151,0,0},
+    {0,0,0,1,0,3152,0,0}, {0,0,0,1,0,3153,0,0}, {0,0,0,1,0,3154,0,0}, {0,0,0,1,0,3155,0,0},
+    {0,0,0,1,0,3156,0,0}, {0,0,0,1,0,3157,0,0}, {0,0,0,1,0,3158,0,0}, {0,0,0,1,0,3159,0,0},
+    {0,0,0,1,0,3160,0,0}, {0,0,0,1,0,3161,0,0}, {0,0,0,1,0,3162,0,0}, {0,0,0,1,0,3163,0,0},
+    {0,0,0,1,0,3164,0,0}, {0,0,0,1,0,3165,0,0}, {0,0,0,1,0,3166,0,0}, {0,0,0,1,0,3167,0,0},
+    {0,0,0,1,0,3168,0,0}, {0,0,0,1,0,3169,0,0}, {0,0,0,1,0,3170,0,0}, {0,0,0,1,0,3171,0,0},
+    {0,0,0,1,0,3172,0,0}, {0,0,0,1,0,3173,0,0}, {0,3,2,0,3174,0,0,0}, {0,0,0,1,0,3176,0,0},
+    {0,0,0,1,0,3177,0,0}, {0,0,0,1,0,3178,0,0}, {0,0,0,1,0,3179,0,0}, {0,0,0,1,0,3180,0,0},
+    {0,0,0,1,0,3181,0,0}, {0,0,0,1,0,3182,0,0}, {0,0,0,1,0,3183,0,0}, {0,0,0,1,0,3184,0,0},
+    {0,0,0,1,0,3185,0,0}, {0,0,0,1,0,3186,0,0}, {0,0,0,1,0,3187,0,0}, {0,0,0,1,0,3188,0,0},
+    {0,0,0,1,0,3189,0,0}, {0,0,0,1,0,3190,0,0}, {0,0,0,1,0,3191,0,0}, {0,0,0,1,0,3192,0,0},
+    {0,0,0,1,0,3193,0,0}, {0,0,0,1,0,3194,0,0}, {0,0,0,1,0,3195,0,0}, {0,0,0,1,0,3196,0,0},
+    {0,0,0,1,0,3197,0,0}, {0,0,0,1,0,3198,0,0}, {0,0,0,1,0,3199,0,0}, {0,0,0,1,0,3200,0,0},
+    {0,0,0,1,0,3201,0,0}, {0,0,0,1,0,3202,0,0}, {0,0,0,1,0,3203,0,0}, {0,0,0,1,0,3204,0,0},
+    {0,0,0,1,0,3205,0,0}, {0,0,0,1,0,3206,0,0}, {0,0,0,1,0,3207,0,0}, {0,0,0,1,0,3208,0,0},
+    {0,0,0,1,0,3209,0,0}, {0,0,0,1,0,3210,0,0}, {0,0,0,1,0,3211,0,0}, {0,0,0,1,0,3212,0,0},
+    {0,0,0,1,0,3213,0,0}, {0,0,0,1,0,3214,0,0}, {0,0,0,1,0,3215,0,0}, {0,0,0,1,0,3216,0,0},
+    {0,0,0,1,0,3217,0,0}, {0,0,0,1,0,3218,0,0}, {0,0,0,1,0,3219,0,0}, {0,0,0,1,0,3220,0,0},
+    {0,0,0,1,0,3221,0,0}, {0,0,0,1,0,3222,0,0}, {0,0,0,1,0,3223,0,0}, {0,0,0,1,0,3224,0,0},
+    {0,0,0,1,0,3225,0,0}, {0,0,0,1,0,3226,0,0}, {0,0,0,1,0,3227,0,0}, {0,0,0,1,0,3228,0,0},
+    {0,0,0,1,0,3229,0,0}, {0,0,0,1,0,3230,0,0}, {0,0,0,1,0,3231,0,0}, {0,0,0,1,0,3232,0,0},
+    {0,0,0,1,0,3233,0,0}, {0,0,0,1,0,3234,0,0}, {0,0,0,1,0,3235,0,0}, {0,0,0,1,0,3236,0,0},
+    {0,0,0,1,0,3237,0,0}, {0,0,0,1,0,3238,0,0}, {0,0,0,1,0,3239,0,0}, {0,0,0,1,0,3240,0,0},
+    {0,0,0,1,0,3241,0,0}, {0,0,0,1,0,3242,0,0}, {0,0,0,1,0,3243,0,0}, {0,0,0,1,0,3244,0,0},
+    {0,0,0,1,0,3245,0,0}, {0,0,0,1,0,3246,0,0}, {0,0,0,1,0,3247,0,0}, {0,0,0,1,0,3248,0,0},
+    {0,0,0,1,0,3249,0,0}, {0,0,0,1,0,3250,0,0}, {0,0,0,1,0,3251,0,0}, {0,0,0,1,0,3252,0,0},
+    {0,0,0,1,0,3253,0,0}, {0,0,0,1,0,3254,0,0}, {0,0,0,1,0,3255,0,0}, {0,0,0,1,0,3256,0,0},
+    {0,0,0,1,0,3257,0,0}, {0,0,0,1,0,3258,0,0}, {0,0,0,1,0,3259,0,0}, {0,0,0,1,0,3260,0,0},
+    {0,0,0,1,0,3261,0,0}, {0,0,0,1,0,3262,0,0}, {0,0,0,1,0,3263,0,0}, {0,0,0,1,0,3264,0,0},
+    {0,0,0,1,0,3265,0,0}, {0,0,0,1,0,3266,0,0}, {0,0,0,1,0,3267,0,0}, {0,0,0,1,0,3268,0,0},
+    {0,0,0,1,0,3269,0,0}, {0,0,0,1,0,3270,0,0}, {0,0,0,1,0,3271,0,0}, {0,0,0,1,0,3272,0,0},
+    {0,0,0,1,0,3273,0,0}, {0,0,0,1,0,3274,0,0}, {0,0,0,1,0,3275,0,0}, {0,0,0,1,0,3276,0,0},
+    {0,0,0,1,0,3277,0,0}, {0,0,0,1,0,3278,0,0}, {0,0,0,1,0,3279,0,0}, {0,0,0,1,0,3280,0,0},
+    {0,0,0,1,0,3281,0,0}, {0,0,0,1,0,3282,0,0}, {0,0,0,1,0,3283,0,0}, {0,0,0,1,0,3284,0,0},
+    {0,0,0,1,0,3285,0,0}, {0,0,0,1,0,3286,0,0}, {0,0,0,1,0,3287,0,0}, {0,0,0,1,0,3288,0,0},
+    {0,0,0,1,0,3289,0,0}, {0,0,0,1,0,3290,0,0}, {0,0,0,1,0,3291,0,0}, {224,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,870,1}, {0,0,0,0,0,0,871,1}, {0,1,2,0,3292,0,0,0}, {0,0,0,0,0,0,872,1},
+    {0,1,2,0,3294,0,0,0}, {0,0,0,0,0,0,873,1}, {0,1,2,0,3296,0,0,0}, {0,0,0,0,0,0,874,1},
+    {0,1,2,0,3298,0,0,0}, {0,0,0,0,0,0,875,1}, {0,1,2,0,3300,0,0,0}, {0,0,0,0,0,0,876,1},
+    {0,1,2,0,3302,0,0,0}, {0,0,0,0,0,0,877,1}, {0,1,2,0,3304,0,0,0}, {0,0,0,0,0,0,878,1},
+    {0,1,2,0,3306,0,0,0}, {0,0,0,0,0,0,879,1}, {0,1,2,0,3308,0,0,0}, {0,0,0,0,0,0,880,1},
+    {0,1,2,0,3310,0,0,0}, {0,0,0,0,0,0,881,1}, {0,1,2,0,3312,0,0,0}, {0,0,0,0,0,0,882,1},
+    {0,1,2,0,3314,0,0,0}, {0,0,0,0,0,0,883,1}, {0,1,2,0,3316,0,0,0}, {0,0,0,0,0,0,884,1},
+    {0,1,2,0,3318,0,0,0}, {0,0,0,0,0,0,885,1}, {0,1,2,0,3320,0,0,0}, {0,0,0,0,0,0,886,2},
+    {0,1,2,0,3322,0,0,0}, {0,1,2,0,3324,0,0,0}, {0,0,0,0,0,0,888,2}, {0,1,2,0,3326,0,0,0},
+    {0,1,2,0,3328,0,0,0}, {0,0,0,0,0,0,890,2}, {0,1,2,0,3330,0,0,0}, {0,1,2,0,3332,0,0,0},
+    {0,0,0,0,0,0,892,2}, {0,1,2,0,3334,0,0,0}, {0,1,2,0,3336,0,0,0}, {0,0,0,0,0,0,894,2},
+    {0,1,2,0,3338,0,0,0}, {0,1,2,0,3340,0,0,0}, {0,1,2,0,3342,0,0,0}, {8,4,0,0,0,0,0,0},
+    {0,0,0,0,0,0,896,1}, {0,1,2,0,3344,0,0,0}, {0,0,0,0,0,0,897,1}, {0,0,0,0,0,0,898,1},
+    {0,1,2,0,3346,0,0,0}, {0,0,0,0,0,0,899,1}, {0,1,2,0,3348,0,0,0}, {0,0,0,0,0,0,900,1},
+    {0,1,2,0,3350,0,0,0}, {0,0,0,0,0,0,901,1}, {0,1,2,0,3352,0,0,0}, {0,0,0,0,0,0,902,1},
+    {0,1,2,0,3354,0,0,0}, {0,0,0,0,0,0,903,1}, {0,1,2,0,3356,0,0,0}, {0,0,0,0,0,0,904,1},
+    {0,1,2,0,3358,0,0,0}, {0,0,0,0,0,0,905,1}, {0,1,2,0,3360,0,0,0}, {0,0,0,0,0,0,906,1},
+    {0,1,2,0,3362,0,0,0}, {0,0,0,0,0,0,907,1}, {0,1,2,0,3364,0,0,0}, {0,0,0,0,0,0,908,1},
+    {0,1,2,0,3366,0,0,0}, {0,0,0,0,0,0,909,1}, {0,1,2,0,3368,0,0,0}, {0,0,0,0,0,0,910,1},
+    {0,1,2,0,3370,0,0,0}, {0,0,0,0,0,0,911,1}, {0,1,2,0,3372,0,0,0}, {0,0,0,0,0,0,912,1},
+    {0,1,2,0,3374,0,0,0}, {0,0,0,0,0,0,913,2}, {0,1,2,0,3376,0,0,0}, {0,1,2,0,3378,0,0,0},
+    {0,0,0,0,0,0,915,2}, {0,1,2,0,3380,0,0,0}, {0,1,2,0,3382,0,0,0}, {0,0,0,0,0,0,917,2},
+    {0,1,2,0,3384,0,0,0}, {0,1,2,0,3386,0,0,0}, {0,0,0,0,0,0,919,2}, {0,1,2,0,3388,0,0,0},
+    {0,1,2,0,3390,0,0,0}, {0,0,0,0,0,0,921,2}, {0,1,2,0,3392,0,0,0}, {0,1,2,0,3394,0,0,0},
+    {0,0,0,0,0,0,923,1}, {0,0,0,0,0,0,924,1}, {0,0,0,0,0,0,925,1}, {0,0,0,0,0,0,926,1},
+    {0,1,2,0,3396,0,0,0}, {0,1,2,0,3398,0,0,0}, {0,1,2,0,3400,0,0,0}, {0,1,2,0,3402,0,0,0},
+    {0,1,2,0,3404,0,0,0}, {0,0,0,0,0,0,927,1}, {0,1,2,0,3406,0,0,0}, {0,0,0,1,0,3408,0,0},
+    {0,0,0,1,0,3409,0,0}, {0,0,0,1,0,3410,0,0}, {0,0,0,1,0,3411,0,0}, {0,0,0,1,0,3412,0,0},
+    {0,0,0,1,0,3413,0,0}, {0,0,0,1,0,3414,0,0}, {0,0,0,1,0,3415,0,0}, {0,0,0,1,0,3416,0,0},
+    {0,0,0,1,0,3417,0,0}, {0,0,0,1,0,3418,0,0}, {0,0,0,1,0,3419,0,0}, {0,0,0,1,0,3420,0,0},
+    {0,0,0,1,0,3421,0,0}, {0,0,0,1,0,3422,0,0}, {0,0,0,1,0,3423,0,0}, {0,0,0,1,0,3424,0,0},
+    {0,0,0,1,0,3425,0,0}, {0,0,0,1,0,3426,0,0}, {0,0,0,1,0,3427,0,0}, {0,0,0,1,0,3428,0,0},
+    {0,0,0,1,0,3429,0,0}, {0,0,0,1,0,3430,0,0}, {0,0,0,1,0,3431,0,0}, {0,0,0,1,0,3432,0,0},
+    {0,0,0,1,0,3433,0,0}, {0,0,0,1,0,3434,0,0}, {0,0,0,1,0,3435,0,0}, {0,0,0,1,0,3436,0,0},
+    {0,0,0,1,0,3437,0,0}, {0,0,0,1,0,3438,0,0}, {0,0,0,1,0,3439,0,0}, {0,0,0,1,0,3440,0,0},
+    {0,0,0,1,0,3441,0,0}, {0,0,0,1,0,3442,0,0}, {0,0,0,1,0,3443,0,0}, {0,0,0,1,0,3444,0,0},
+    {0,0,0,1,0,3445,0,0}, {0,0,0,1,0,3446,0,0}, {0,0,0,1,0,3447,0,0}, {0,0,0,1,0,3448,0,0},
+    {0,0,0,1,0,3449,0,0}, {0,0,0,1,0,3450,0,0}, {0,0,0,1,0,3451,0,0}, {0,0,0,1,0,3452,0,0},
+    {0,0,0,1,0,3453,0,0}, {0,0,0,1,0,3454,0,0}, {0,0,0,1,0,3455,0,0}, {0,0,0,1,0,3456,0,0},
+    {0,0,0,1,0,3457,0,0}, {0,0,0,1,0,3458,0,0}, {0,0,0,1,0,3459,0,0}, {0,0,0,1,0,3460,0,0},
+    {0,0,0,1,0,3461,0,0}, {0,0,0,1,0,3462,0,0}, {0,0,0,1,0,3463,0,0}, {0,0,0,1,0,3464,0,0},
+    {0,0,0,1,0,3465,0,0}, {0,0,0,1,0,3466,0,0}, {0,0,0,1,0,3467,0,0}, {0,0,0,1,0,3468,0,0},
+    {0,0,0,1,0,3469,0,0}, {0,0,0,1,0,3470,0,0}, {0,0,0,1,0,3471,0,0}, {0,0,0,1,0,3472,0,0},
+    {0,0,0,1,0,3473,0,0}, {0,0,0,1,0,3474,0,0}, {0,0,0,1,0,3475,0,0}, {0,0,0,1,0,3476,0,0},
+    {0,0,0,1,0,3477,0,0}, {0,0,0,1,0,3478,0,0}, {0,0,0,1,0,3479,0,0}, {0,0,0,1,0,3480,0,0},
+    {0,0,0,1,0,3481,0,0}, {0,0,0,1,0,3482,0,0}, {0,0,0,1,0,3483,0,0}, {0,0,0,1,0,3484,0,0},
+    {0,0,0,1,0,3485,0,0}, {0,0,0,1,0,3486,0,0}, {0,0,0,1,0,3487,0,0}, {0,0,0,1,0,3488,0,0},
+    {0,0,0,1,0,3489,0,0}, {0,0,0,1,0,3490,0,0}, {0,0,0,1,0,3491,0,0}, {0,0,0,1,0,3492,0,0},
+    {0,0,0,1,0,3493,0,0}, {0,0,0,1,0,3494,0,0}, {0,0,0,1,0,3495,0,0}, {0,0,0,1,0,3496,0,0},
+    {0,0,0,1,0,3497,0,0}, {0,0,0,1,0,3498,0,0}, {0,0,0,1,0,3499,0,0}, {0,0,0,1,0,3500,0,0},
+    {0,0,0,1,0,3501,0,0}, {0,0,0,1,0,3502,0,0}, {0,0,0,1,0,3503,0,0}, {0,0,0,1,0,3504,0,0},
+    {0,0,0,1,0,3505,0,0}, {0,0,0,1,0,3506,0,0}, {0,0,0,1,0,3507,0,0}, {0,0,0,1,0,3508,0,0},
+    {0,0,0,1,0,3509,0,0}, {0,0,0,1,0,3510,0,0}, {0,0,0,1,0,3511,0,0}, {0,0,0,1,0,3512,0,0},
+    {0,0,0,1,0,3513,0,0}, {0,0,0,1,0,3514,0,0}, {0,0,0,1,0,3515,0,0}, {0,0,0,1,0,3516,0,0},
+    {0,0,0,1,0,3517,0,0}, {0,0,0,1,0,3518,0,0}, {0,0,0,1,0,3519,0,0}, {0,0,0,1,0,3520,0,0},
+    {0,0,0,1,0,3521,0,0}, {0,0,0,1,0,3522,0,0}, {0,0,0,1,0,3523,0,0}, {0,0,0,1,0,3524,0,0},
+    {0,0,0,1,0,3525,0,0}, {0,0,0,1,0,3526,0,0}, {0,0,0,1,0,3527,0,0}, {0,0,0,1,0,3528,0,0},
+    {0,0,0,1,0,3529,0,0}, {0,0,0,1,0,3530,0,0}, {0,0,0,1,0,3531,0,0}, {0,0,0,1,0,3532,0,0},
+    {0,0,0,1,0,3533,0,0}, {0,0,0,1,0,3534,0,0}, {0,0,0,1,0,3535,0,0}, {0,0,0,1,0,3536,0,0},
+    {0,0,0,1,0,3537,0,0}, {0,0,0,1,0,3538,0,0}, {0,0,0,1,0,3539,0,0}, {0,0,0,1,0,3540,0,0},
+    {0,0,0,1,0,3541,0,0}, {0,0,0,1,0,3542,0,0}, {0,0,0,1,0,3543,0,0}, {0,0,0,1,0,3544,0,0},
+    {0,0,0,1,0,3545,0,0}, {0,0,0,1,0,3546,0,0}, {0,0,0,1,0,3547,0,0}, {0,0,0,1,0,3548,0,0},
+    {0,0,0,1,0,3549,0,0}, {0,0,0,1,0,3550,0,0}, {0,0,0,1,0,3551,0,0}, {0,0,0,1,0,3552,0,0},
+    {0,0,0,1,0,3553,0,0}, {0,0,0,1,0,3554,0,0}, {0,0,0,1,0,3555,0,0}, {0,0,0,1,0,3556,0,0},
+    {0,0,0,1,0,3557,0,0}, {0,0,0,1,0,3558,0,0}, {0,0,0,1,0,3559,0,0}, {0,0,0,1,0,3560,0,0},
+    {0,0,0,1,0,3561,0,0}, {0,0,0,1,0,3562,0,0}, {0,0,0,1,0,3563,0,0}, {0,0,0,1,0,3564,0,0},
+    {0,0,0,1,0,3565,0,0}, {0,0,0,1,0,3566,0,0}, {0,0,0,1,0,3567,0,0}, {0,0,0,1,0,3568,0,0},
+    {0,0,0,1,0,3569,0,0}, {0,0,0,1,0,3570,0,0}, {0,0,0,1,0,3571,0,0}, {0,0,0,1,0,3572,0,0},
+    {0,0,0,1,0,3573,0,0}, {0,0,0,1,0,3574,0,0}, {0,0,0,1,0,3575,0,0}, {0,0,0,1,0,3576,0,0},
+    {0,0,0,1,0,3577,0,0}, {0,0,0,1,0,3578,0,0}, {0,0,0,1,0,3579,0,0}, {0,0,0,1,0,3580,0,0},
+    {0,0,0,1,0,3581,0,0}, {0,0,0,1,0,3582,0,0}, {0,0,0,1,0,3583,0,0}, {0,0,0,1,0,3584,0,0},
+    {0,0,0,1,0,3585,0,0}, {0,0,0,1,0,3586,0,0}, {0,0,0,1,0,3587,0,0}, {0,0,0,1,0,3588,0,0},
+    {0,0,0,1,0,3589,0,0}, {0,0,0,1,0,3590,0,0}, {0,0,0,1,0,3591,0,0}, {0,0,0,1,0,3592,0,0},
+    {0,0,0,1,0,3593,0,0}, {0,0,0,1,0,3594,0,0}, {0,0,0,1,0,3595,0,0}, {0,0,0,1,0,3596,0,0},
+    {0,0,0,1,0,3597,0,0}, {0,0,0,1,0,3598,0,0}, {0,0,0,1,0,3599,0,0}, {0,0,0,1,0,3600,0,0},
+    {0,0,0,1,0,3601,0,0}, {0,0,0,1,0,3602,0,0}, {0,0,0,1,0,3603,0,0}, {0,0,0,1,0,3604,0,0},
+    {0,0,0,1,0,3605,0,0}, {0,0,0,1,0,3606,0,0}, {0,0,0,1,0,3607,0,0}, {0,0,0,1,0,3608,0,0},
+    {0,0,0,1,0,3609,0,0}, {0,0,0,1,0,3610,0,0}, {0,1,0,0,0,0,0,0}, {0,3,1,0,3611,0,0,0},
+    {0,3,1,0,3612,0,0,0}, {0,3,1,0,3613,0,0,0}, {0,3,1,0,3614,0,0,0}, {0,3,1,0,3615,0,0,0},
+    {0,3,1,0,3616,0,0,0}, {0,3,1,0,3617,0,0,0}, {0,3,1,0,3618,0,0,0}, {0,3,1,0,3619,0,0,0},
+    {0,3,1,0,3620,0,0,0}, {0,3,1,0,3621,0,0,0}, {0,3,1,0,3622,0,0,0}, {0,3,1,0,3623,0,0,0},
+    {0,3,1,0,3624,0,0,0}, {0,3,1,0,3625,0,0,0}, {0,3,1,0,3626,0,0,0}, {0,3,1,0,3627,0,0,0},
+    {0,3,1,0,3628,0,0,0}, {0,3,1,0,3629,0,0,0}, {0,3,1,0,3630,0,0,0}, {0,3,1,0,3631,0,0,0},
+    {0,3,1,0,3632,0,0,0}, {0,3,1,0,3633,0,0,0}, {0,3,1,0,3634,0,0,0}, {0,3,1,0,3635,0,0,0},
+    {0,3,1,0,3636,0,0,0}, {0,3,1,0,3637,0,0,0}, {0,3,1,0,3638,0,0,0}, {0,3,1,0,3639,0,0,0},
+    {0,3,1,0,3640,0,0,0}, {0,3,1,0,3641,0,0,0}, {0,3,1,0,3642,0,0,0}, {0,3,1,0,3643,0,0,0},
+    {0,3,1,0,3644,0,0,0}, {0,3,1,0,3645,0,0,0}, {0,3,1,0,3646,0,0,0}, {0,3,1,0,3647,0,0,0},
+    {0,3,1,0,3648,0,0,0}, {0,3,1,0,3649,0,0,0}, {0,3,1,0,3650,0,0,0}, {0,3,1,0,3651,0,0,0},
+    {0,3,1,0,3652,0,0,0}, {0,3,1,0,3653,0,0,0}, {0,3,1,0,3654,0,0,0}, {0,3,1,0,3655,0,0,0},
+    {0,3,1,0,3656,0,0,0}, {0,3,1,0,3657,0,0,0}, {0,3,1,0,3658,0,0,0}, {0,3,1,0,3659,0,0,0},
+    {0,3,1,0,3660,0,0,0}, {0,3,1,0,3661,0,0,0}, {0,3,1,0,3662,0,0,0}, {0,3,1,0,3663,0,0,0},
+    {0,3,1,0,3664,0,0,0}, {0,3,1,0,3665,0,0,0}, {0,3,1,0,3666,0,0,0}, {0,3,1,0,3667,0,0,0},
+    {0,3,1,0,3668,0,0,0}, {0,3,1,0,3669,0,0,0}, {0,3,1,0,3670,0,0,0}, {0,3,1,0,3671,0,0,0},
+    {0,3,1,0,3672,0,0,0}, {0,3,1,0,3673,0,0,0}, {0,3,1,0,3674,0,0,0}, {0,3,1,0,3675,0,0,0},
+    {0,3,1,0,3676,0,0,0}, {0,3,1,0,3677,0,0,0}, {0,3,1,0,3678,0,0,0}, {0,3,1,0,3679,0,0,0},
+    {0,3,1,0,3680,0,0,0}, {0,3,1,0,3681,0,0,0}, {0,3,1,0,3682,0,0,0}, {0,3,1,0,3683,0,0,0},
+    {0,3,1,0,3684,0,0,0}, {0,3,1,0,3685,0,0,0}, {0,3,1,0,3686,0,0,0}, {0,3,1,0,3687,0,0,0},
+    {0,3,1,0,3688,0,0,0}, {0,3,1,0,3689,0,0,0}, {0,3,1,0,3690,0,0,0}, {0,3,1,0,3691,0,0,0},
+    {0,3,1,0,3692,0,0,0}, {0,3,1,0,3693,0,0,0}, {0,3,1,0,3694,0,0,0}, {0,3,1,0,3695,0,0,0},
+    {0,3,1,0,3696,0,0,0}, {0,3,1,0,3697,0,0,0}, {0,3,1,0,3698,0,0,0}, {0,3,1,0,3699,0,0,0},
+    {0,3,1,0,3700,0,0,0}, {0,3,1,0,3701,0,0,0}, {0,3,1,0,3702,0,0,0}, {0,3,1,0,3703,0,0,0},
+    {0,3,1,0,3704,0,0,0}, {0,3,1,0,3705,0,0,0}, {0,3,1,0,3706,0,0,0}, {0,3,1,0,3707,0,0,0},
+    {0,3,1,0,3708,0,0,0}, {0,3,1,0,3709,0,0,0}, {0,3,1,0,3710,0,0,0}, {0,3,1,0,3711,0,0,0},
+    {0,3,1,0,3712,0,0,0}, {0,3,1,0,3713,0,0,0}, {0,3,1,0,3714,0,0,0}, {0,3,1,0,3715,0,0,0},
+    {0,3,1,0,3716,0,0,0}, {0,3,1,0,3717,0,0,0}, {0,3,1,0,3718,0,0,0}, {0,3,1,0,3719,0,0,0},
+    {0,3,1,0,3720,0,0,0}, {0,3,1,0,3721,0,0,0}, {0,3,1,0,3722,0,0,0}, {0,3,1,0,3723,0,0,0},
+    {0,3,1,0,3724,0,0,0}, {0,3,1,0,3725,0,0,0}, {0,3,1,0,3726,0,0,0}, {0,3,1,0,3727,0,0,0},
+    {0,3,1,0,3728,0,0,0}, {0,3,1,0,3729,0,0,0}, {0,3,1,0,3730,0,0,0}, {0,3,1,0,3731,0,0,0},
+    {0,3,1,0,3732,0,0,0}, {0,3,1,0,3733,0,0,0}, {0,3,1,0,3734,0,0,0}, {0,3,1,0,3735,0,0,0},
+    {0,3,1,0,3736,0,0,0}, {0,3,1,0,3737,0,0,0}, {0,3,1,0,3738,0,0,0}, {0,3,1,0,3739,0,0,0},
+    {0,3,1,0,3740,0,0,0}, {0,3,1,0,3741,0,0,0}, {0,3,1,0,3742,0,0,0}, {0,3,1,0,3743,0,0,0},
+    {0,3,1,0,3744,0,0,0}, {0,3,1,0,3745,0,0,0}, {0,3,1,0,3746,0,0,0}, {0,3,1,0,3747,0,0,0},
+    {0,3,1,0,3748,0,0,0}, {0,3,1,0,3749,0,0,0}, {0,3,1,0,3750,0,0,0}, {0,3,1,0,3751,0,0,0},
+    {0,3,1,0,3752,0,0,0}, {0,3,1,0,3753,0,0,0}, {0,3,1,0,3754,0,0,0}, {0,3,1,0,3755,0,0,0},
+    {0,3,1,0,3756,0,0,0}, {0,3,1,0,3757,0,0,0}, {0,3,1,0,3758,0,0,0}, {0,3,1,0,3759,0,0,0},
+    {0,3,1,0,3760,0,0,0}, {0,3,1,0,3761,0,0,0}, {0,3,1,0,3762,0,0,0}, {0,3,1,0,3763,0,0,0},
+    {0,3,1,0,3764,0,0,0}, {0,3,1,0,3765,0,0,0}, {0,3,1,0,3766,0,0,0}, {0,3,1,0,3767,0,0,0},
+    {0,3,1,0,3768,0,0,0}, {0,3,1,0,3769,0,0,0}, {0,3,1,0,3770,0,0,0}, {0,3,1,0,3771,0,0,0},
+    {0,3,1,0,3772,0,0,0}, {0,3,1,0,3773,0,0,0}, {0,3,1,0,3774,0,0,0}, {0,3,1,0,3775,0,0,0},
+    {0,3,1,0,3776,0,0,0}, {0,3,1,0,3777,0,0,0}, {0,3,1,0,3778,0,0,0}, {0,3,1,0,3779,0,0,0},
+    {0,3,1,0,3780,0,0,0}, {0,3,1,0,3781,0,0,0}, {0,3,1,0,3782,0,0,0}, {0,3,1,0,3783,0,0,0},
+    {0,3,1,0,3784,0,0,0}, {0,3,1,0,3785,0,0,0}, {0,3,1,0,3786,0,0,0}, {0,3,1,0,3787,0,0,0},
+    {0,3,1,0,3788,0,0,0}, {0,3,1,0,3789,0,0,0}, {0,3,1,0,3790,0,0,0}, {0,3,1,0,3791,0,0,0},
+    {0,3,1,0,3792,0,0,0}, {0,3,1,0,3793,0,0,0}, {0,3,1,0,3794,0,0,0}, {0,3,1,0,3795,0,0,0},
+    {0,3,1,0,3796,0,0,0}, {0,3,1,0,3797,0,0,0}, {0,3,1,0,3798,0,0,0}, {0,3,1,0,3799,0,0,0},
+    {0,3,1,0,3800,0,0,0}, {0,3,1,0,3801,0,0,0}, {0,3,1,0,3802,0,0,0}, {0,3,1,0,3803,0,0,0},
+    {0,3,1,0,3804,0,0,0}, {0,3,1,0,3805,0,0,0}, {0,3,1,0,3806,0,0,0}, {0,3,1,0,3807,0,0,0},
+    {0,3,1,0,3808,0,0,0}, {0,3,1,0,3809,0,0,0}, {0,3,1,0,3810,0,0,0}, {0,3,1,0,3811,0,0,0},
+    {0,3,1,0,3812,0,0,0}, {0,3,1,0,3813,0,0,0}, {0,3,1,0,3814,0,0,0}, {0,3,1,0,3815,0,0,0},
+    {0,3,1,0,3816,0,0,0}, {0,3,1,0,3817,0,0,0}, {0,3,1,0,3818,0,0,0}, {0,3,1,0,3819,0,0,0},
+    {0,3,1,0,3820,0,0,0}, {0,3,1,0,3821,0,0,0}, {0,3,1,0,3822,0,0,0}, {0,3,1,0,3823,0,0,0},
+    {0,3,1,0,3824,0,0,0}, {0,3,1,0,3825,0,0,0}, {0,3,1,0,3826,0,0,0}, {0,3,1,0,3827,0,0,0},
+    {0,3,1,0,3828,0,0,0}, {0,3,1,0,3829,0,0,0}, {0,3,1,0,3830,0,0,0}, {0,3,1,0,3831,0,0,0},
+    {0,3,1,0,3832,0,0,0}, {0,3,1,0,3833,0,0,0}, {0,3,1,0,3834,0,0,0}, {0,3,1,0,3835,0,0,0},
+    {0,3,1,0,3836,0,0,0}, {0,3,1,0,3837,0,0,0}, {0,3,1,0,3838,0,0,0}, {0,3,1,0,3839,0,0,0},
+    {0,3,1,0,3840,0,0,0}, {0,3,1,0,3841,0,0,0}, {0,3,1,0,3842,0,0,0}, {0,3,1,0,3843,0,0,0},
+    {0,3,1,0,3844,0,0,0}, {0,3,1,0,3845,0,0,0}, {0,3,1,0,3846,0,0,0}, {0,3,1,0,3847,0,0,0},
+    {0,3,1,0,3848,0,0,0}, {0,3,1,0,3849,0,0,0}, {0,3,1,0,3850,0,0,0}, {0,3,1,0,3851,0,0,0},
+    {0,3,1,0,3852,0,0,0}, {0,3,1,0,3853,0,0,0}, {0,3,1,0,3854,0,0,0}, {0,3,1,0,3855,0,0,0},
+    {0,3,1,0,3856,0,0,0}, {0,3,1,0,3857,0,0,0}, {0,3,1,0,3858,0,0,0}, {0,3,1,0,3859,0,0,0},
+    {0,3,1,0,3860,0,0,0}, {0,3,1,0,3861,0,0,0}, {0,3,1,0,3862,0,0,0}, {0,3,1,0,3863,0,0,0},
+    {0,3,1,0,3864,0,0,0}, {0,3,1,0,3865,0,0,0}, {0,3,1,0,3866,0,0,0}, {0,3,1,0,3867,0,0,0},
+    {0,3,1,0,3868,0,0,0}, {0,3,1,0,3869,0,0,0}, {0,3,1,0,3870,0,0,0}, {0,3,1,0,3871,0,0,0},
+    {0,3,1,0,3872,0,0,0}, {0,3,1,0,3873,0,0,0}, {0,3,1,0,3874,0,0,0}, {0,3,1,0,3875,0,0,0},
+    {0,3,1,0,3876,0,0,0}, {0,3,1,0,3877,0,0,0}, {0,3,1,0,3878,0,0,0}, {0,3,1,0,3879,0,0,0},
+    {0,3,1,0,3880,0,0,0}, {0,3,1,0,3881,0,0,0}, {0,3,1,0,3882,0,0,0}, {0,3,1,0,3883,0,0,0},
+    {0,3,1,0,3884,0,0,0}, {0,3,1,0,3885,0,0,0}, {0,3,1,0,3886,0,0,0}, {0,3,1,0,3887,0,0,0},
+    {0,3,1,0,3888,0,0,0}, {0,3,1,0,3889,0,0,0}, {0,3,1,0,3890,0,0,0}, {0,3,1,0,3891,0,0,0},
+    {0,3,1,0,3892,0,0,0}, {0,3,1,0,3893,0,0,0}, {0,3,1,0,3894,0,0,0}, {0,3,1,0,3895,0,0,0},
+    {0,3,1,0,3896,0,0,0}, {0,3,1,0,3897,0,0,0}, {0,3,1,0,3898,0,0,0}, {0,3,1,0,3899,0,0,0},
+    {0,3,1,0,3900,0,0,0}, {0,3,1,0,3901,0,0,0}, {0,3,1,0,3902,0,0,0}, {0,3,1,0,3903,0,0,0},
+    {0,3,1,0,3904,0,0,0}, {0,3,1,0,3905,0,0,0}, {0,3,1,0,3906,0,0,0}, {0,3,1,0,3907,0,0,0},
+    {0,3,1,0,3908,0,0,0}, {0,3,1,0,3909,0,0,0}, {0,3,1,0,3910,0,0,0}, {0,3,1,0,3911,0,0,0},
+    {0,3,1,0,3912,0,0,0}, {0,3,1,0,3913,0,0,0}, {0,3,1,0,3914,0,0,0}, {0,3,1,0,3915,0,0,0},
+    {0,3,1,0,3916,0,0,0}, {0,3,1,0,3917,0,0,0}, {0,3,1,0,3918,0,0,0}, {0,3,1,0,3919,0,0,0},
+    {0,3,1,0,3920,0,0,0}, {0,3,1,0,3921,0,0,0}, {0,3,1,0,3922,0,0,0}, {0,3,1,0,3923,0,0,0},
+    {0,3,1,0,3924,0,0,0}, {0,3,1,0,3925,0,0,0}, {0,3,1,0,3926,0,0,0}, {0,3,1,0,3927,0,0,0},
+    {0,3,1,0,3928,0,0,0}, {0,3,1,0,3929,0,0,0}, {0,3,1,0,3930,0,0,0}, {0,3,1,0,3931,0,0,0},
+    {0,3,1,0,3932,0,0,0}, {0,3,1,0,3933,0,0,0}, {0,3,1,0,3934,0,0,0}, {0,3,1,0,3935,0,0,0},
+    {0,3,1,0,3936,0,0,0}, {0,3,1,0,3937,0,0,0}, {0,3,1,0,3938,0,0,0}, {0,3,1,0,3939,0,0,0},
+    {0,3,1,0,3940,0,0,0}, {0,3,1,0,3941,0,0,0}, {0,3,1,0,3942,0,0,0}, {0,3,1,0,3943,0,0,0},
+    {0,3,1,0,3944,0,0,0}, {0,3,1,0,3945,0,0,0}, {0,3,1,0,3946,0,0,0}, {0,3,1,0,3947,0,0,0},
+    {0,3,1,0,3948,0,0,0}, {0,3,1,0,3949,0,0,0}, {0,3,1,0,3950,0,0,0}, {0,3,1,0,3951,0,0,0},
+    {0,3,1,0,3952,0,0,0}, {0,3,1,0,3953,0,0,0}, {0,3,1,0,3954,0,0,0}, {0,3,1,0,3955,0,0,0},
+    {0,3,1,0,3956,0,0,0}, {0,3,1,0,3957,0,0,0}, {0,3,1,0,3958,0,0,0}, {0,3,1,0,3959,0,0,0},
+    {0,3,1,0,3960,0,0,0}, {0,3,1,0,3961,0,0,0}, {0,3,1,0,3962,0,0,0}, {0,3,1,0,3963,0,0,0},
+    {0,3,1,0,3964,0,0,0}, {0,3,1,0,3965,0,0,0}, {0,3,1,0,3966,0,0,0}, {0,3,1,0,3967,0,0,0},
+    {0,3,1,0,3968,0,0,0}, {0,3,1,0,3969,0,0,0}, {0,3,1,0,3970,0,0,0}, {0,3,1,0,3971,0,0,0},
+    {0,3,1,0,3972,0,0,0}, {0,3,1,0,3973,0,0,0}, {0,3,1,0,3974,0,0,0}, {0,3,1,0,3975,0,0,0},
+    {0,3,1,0,3976,0,0,0}, {0,3,1,0,3977,0,0,0}, {0,3,1,0,3978,0,0,0}, {0,3,1,0,3979,0,0,0},
+    {0,3,1,0,3980,0,0,0}, {0,3,1,0,3981,0,0,0}, {0,3,1,0,3982,0,0,0}, {0,3,1,0,3983,0,0,0},
+    {0,3,1,0,3984,0,0,0}, {0,3,1,0,3985,0,0,0}, {0,3,1,0,3986,0,0,0}, {0,3,1,0,3987,0,0,0},
+    {0,3,1,0,3988,0,0,0}, {0,3,1,0,3989,0,0,0}, {0,3,1,0,3990,0,0,0}, {0,3,1,0,3991,0,0,0},
+    {0,3,1,0,3992,0,0,0}, {0,3,1,0,3993,0,0,0}, {0,3,1,0,3994,0,0,0}, {0,3,1,0,3995,0,0,0},
+    {0,3,1,0,3996,0,0,0}, {0,3,1,0,3997,0,0,0}, {0,3,1,0,3998,0,0,0}, {0,3,1,0,3999,0,0,0},
+    {0,3,1,0,4000,0,0,0}, {0,3,1,0,4001,0,0,0}, {0,3,1,0,4002,0,0,0}, {0,3,1,0,4003,0,0,0},
+    {0,3,1,0,4004,0,0,0}, {0,3,1,0,4005,0,0,0}, {0,3,1,0,4006,0,0,0}, {0,3,1,0,4007,0,0,0},
+    {0,3,1,0,4008,0,0,0}, {0,3,1,0,4009,0,0,0}, {0,3,1,0,4010,0,0,0}, {0,3,1,0,4011,0,0,0},
+    {0,3,1,0,4012,0,0,0}, {0,3,1,0,4013,0,0,0}, {0,3,1,0,4014,0,0,0}, {0,3,1,0,4015,0,0,0},
+    {0,3,1,0,4016,0,0,0}, {0,3,1,0,4017,0,0,0}, {0,3,1,0,4018,0,0,0}, {0,3,1,0,4019,0,0,0},
+    {0,3,1,0,4020,0,0,0}, {0,3,1,0,4021,0,0,0}, {0,3,1,0,4022,0,0,0}, {0,3,1,0,4023,0,0,0},
+    {0,3,1,0,4024,0,0,0}, {0,3,1,0,4025,0,0,0}, {0,3,1,0,4026,0,0,0}, {0,3,1,0,4027,0,0,0},
+    {0,3,1,0,4028,0,0,0}, {0,3,1,0,4029,0,0,0}, {0,3,1,0,4030,0,0,0}, {0,3,1,0,4031,0,0,0},
+    {0,3,1,0,4032,0,0,0}, {0,3,1,0,4033,0,0,0}, {0,3,1,0,4034,0,0,0}, {0,3,1,0,4035,0,0,0},
+    {0,3,1,0,4036,0,0,0}, {0,3,1,0,4037,0,0,0}, {0,3,1,0,4038,0,0,0}, {0,3,1,0,4039,0,0,0},
+    {0,3,1,0,4040,0,0,0}, {0,3,1,0,4041,0,0,0}, {0,3,1,0,4042,0,0,0}, {0,3,1,0,4043,0,0,0},
+    {0,3,1,0,4044,0,0,0}, {0,3,1,0,4045,0,0,0}, {0,3,1,0,4046,0,0,0}, {0,3,1,0,4047,0,0,0},
+    {0,3,1,0,4048,0,0,0}, {0,3,1,0,4049,0,0,0}, {0,3,1,0,4050,0,0,0}, {0,3,1,0,4051,0,0,0},
+    {0,3,1,0,4052,0,0,0}, {0,3,1,0,4053,0,0,0}, {0,3,1,0,4054,0,0,0}, {0,3,1,0,4055,0,0,0},
+    {0,3,1,0,4056,0,0,0}, {0,3,1,0,4057,0,0,0}, {0,3,1,0,4058,0,0,0}, {0,3,1,0,4059,0,0,0},
+    {0,3,1,0,4060,0,0,0}, {0,3,1,0,4061,0,0,0}, {0,3,1,0,4062,0,0,0}, {0,3,1,0,4063,0,0,0},
+    {0,3,1,0,4064,0,0,0}, {0,3,1,0,4065,0,0,0}, {0,3,1,0,4066,0,0,0}, {0,3,1,0,4067,0,0,0},
+    {0,3,1,0,4068,0,0,0}, {0,3,1,0,4069,0,0,0}, {0,3,1,0,4070,0,0,0}, {0,0,0,2,0,4071,0,0},
+    {0,0,0,2,0,4073,0,0}, {0,0,0,2,0,4075,0,0}, {0,0,0,3,0,4077,0,0}, {0,0,0,3,0,4080,0,0},
+    {0,0,0,2,0,4083,0,0}, {0,0,0,2,0,4085,0,0}, {0,0,0,2,0,4087,0,0}, {0,0,0,2,0,4089,0,0},
+    {0,0,0,2,0,4091,0,0}, {0,0,0,2,0,4093,0,0}, {0,0,0,2,0,4095,0,0}, {0,3,2,0,4097,0,0,0},
+    {26,0,0,0,0,0,0,0}, {0,3,2,0,4099,0,0,0}, {0,3,2,0,4101,0,0,0}, {0,3,2,0,4103,0,0,0},
+    {0,3,3,0,4105,0,0,0}, {0,3,3,0,4108,0,0,0}, {0,3,2,0,4111,0,0,0}, {0,3,2,0,4113,0,0,0},
+    {0,3,2,0,4115,0,0,0}, {0,3,2,0,4117,0,0,0}, {0,3,2,0,4119,0,0,0}, {0,3,2,0,4121,0,0,0},
+    {0,3,2,0,4123,0,0,0}, {0,3,2,0,4125,0,0,0}, {0,3,2,0,4127,0,0,0}, {0,3,2,0,4129,0,0,0},
+    {0,3,2,0,4131,0,0,0}, {0,3,2,0,4133,0,0,0}, {0,3,2,0,4135,0,0,0}, {0,3,2,0,4137,0,0,0},
+    {0,3,2,0,4139,0,0,0}, {0,3,2,0,4141,0,0,0}, {0,3,2,0,4143,0,0,0}, {0,3,2,0,4145,0,0,0},
+    {0,3,2,0,4147,0,0,0}, {0,3,2,0,4149,0,0,0}, {0,3,2,0,4151,0,0,0}, {0,3,2,0,4153,0,0,0},
+    {0,3,2,0,4155,0,0,0}, {0,3,2,0,4157,0,0,0}, {0,3,2,0,4159,0,0,0}, {0,3,2,0,4161,0,0,0},
+    {0,3,2,0,4163,0,0,0}, {0,3,2,0,4165,0,0,0}, {0,0,0,1,0,4167,0,0}, {0,0,0,1,0,4168,0,0},
+    {0,0,0,1,0,4169,0,0}, {0,0,0,1,0,4170,0,0}, {0,0,0,1,0,4171,0,0}, {0,0,0,1,0,4172,0,0},
+    {0,0,0,1,0,4173,0,0}, {0,0,0,1,0,4174,0,0}, {0,0,0,1,0,4175,0,0}, {0,0,0,1,0,4176,0,0},
+    {0,0,0,1,0,4177,0,0}, {0,0,0,1,0,4178,0,0}, {0,0,0,1,0,4179,0,0}, {0,0,0,1,0,4180,0,0},
+    {0,0,0,1,0,4181,0,0}, {0,0,0,1,0,4182,0,0}, {0,0,0,1,0,4183,0,0}, {0,0,0,1,0,4184,0,0},
+    {0,0,0,1,0,4185,0,0}, {0,0,0,1,0,4186,0,0}, {0,0,0,1,0,4187,0,0}, {0,0,0,1,0,4188,0,0},
+    {0,0,0,1,0,4189,0,0}, {0,0,0,1,0,4190,0,0}, {0,0,0,1,0,4191,0,0}, {0,0,0,1,0,4192,0,0},
+    {0,0,0,1,0,4193,0,0}, {0,0,0,1,0,4194,0,0}, {0,0,0,1,0,4195,0,0}, {0,0,0,1,0,4196,0,0},
+    {0,0,0,1,0,4197,0,0}, {0,0,0,1,0,4198,0,0}, {0,0,0,1,0,4199,0,0}, {0,0,0,1,0,4200,0,0},
+    {0,0,0,1,0,4201,0,0}, {0,0,0,1,0,4202,0,0}, {0,0,0,1,0,4203,0,0}, {0,0,0,1,0,4204,0,0},
+    {0,0,0,1,0,4205,0,0}, {0,0,0,1,0,4206,0,0}, {0,0,0,1,0,4207,0,0}, {0,0,0,1,0,4208,0,0},
+    {0,0,0,1,0,4209,0,0}, {0,0,0,1,0,4210,0,0}, {0,0,0,1,0,4211,0,0}, {0,0,0,1,0,4212,0,0},
+    {0,0,0,1,0,4213,0,0}, {0,0,0,1,0,4214,0,0}, {0,0,0,1,0,4215,0,0}, {0,0,0,1,0,4216,0,0},
+    {0,0,0,1,0,4217,0,0}, {0,0,0,1,0,4218,0,0}, {0,0,0,1,0,4219,0,0}, {0,0,0,1,0,4220,0,0},
+    {0,0,0,1,0,4221,0,0}, {0,0,0,1,0,4222,0,0}, {0,0,0,1,0,4223,0,0}, {0,0,0,1,0,4224,0,0},
+    {0,0,0,1,0,4225,0,0}, {0,0,0,1,0,4226,0,0}, {0,0,0,1,0,4227,0,0}, {0,0,0,1,0,4228,0,0},
+    {0,0,0,1,0,4229,0,0}, {0,0,0,1,0,4230,0,0}, {0,0,0,1,0,4231,0,0}, {0,0,0,1,0,4232,0,0},
+    {0,0,0,1,0,4233,0,0}, {0,0,0,1,0,4234,0,0}, {0,0,0,1,0,4235,0,0}, {0,0,0,1,0,4236,0,0},
+    {0,0,0,1,0,4237,0,0}, {0,0,0,1,0,4238,0,0}, {0,0,0,1,0,4239,0,0}, {0,0,0,1,0,4240,0,0},
+    {0,0,0,1,0,4241,0,0}, {0,0,0,1,0,4242,0,0}, {0,0,0,1,0,4243,0,0}, {0,0,0,1,0,4244,0,0},
+    {0,0,0,1,0,4245,0,0}, {0,0,0,1,0,4246,0,0}, {0,0,0,1,0,4247,0,0}, {0,0,0,1,0,4248,0,0},
+    {0,0,0,1,0,4249,0,0}, {0,0,0,1,0,4250,0,0}, {0,0,0,1,0,4251,0,0}, {0,0,0,1,0,4252,0,0},
+    {0,0,0,1,0,4253,0,0}, {0,0,0,1,0,4254,0,0}, {0,0,0,1,0,4255,0,0}, {0,0,0,1,0,4256,0,0},
+    {0,0,0,1,0,4257,0,0}, {0,0,0,1,0,4258,0,0}, {0,0,0,1,0,4259,0,0}, {0,0,0,1,0,4260,0,0},
+    {0,0,0,1,0,4261,0,0}, {0,0,0,1,0,4262,0,0}, {0,0,0,1,0,4263,0,0}, {0,0,0,1,0,4264,0,0},
+    {0,0,0,1,0,4265,0,0}, {0,0,0,1,0,4266,0,0}, {0,0,0,1,0,4267,0,0}, {0,0,0,1,0,4268,0,0},
+    {0,0,0,1,0,4269,0,0}, {0,0,0,1,0,4270,0,0}, {0,0,0,1,0,4271,0,0}, {0,0,0,1,0,4272,0,0},
+    {0,0,0,1,0,4273,0,0}, {0,0,0,1,0,4274,0,0}, {0,0,0,1,0,4275,0,0}, {0,0,0,1,0,4276,0,0},
+    {0,0,0,1,0,4277,0,0}, {0,0,0,1,0,4278,0,0}, {0,0,0,1,0,4279,0,0}, {0,0,0,1,0,4280,0,0},
+    {0,0,0,1,0,4281,0,0}, {0,0,0,1,0,4282,0,0}, {0,0,0,1,0,4283,0,0}, {0,0,0,1,0,4284,0,0},
+    {0,0,0,1,0,4285,0,0}, {0,0,0,1,0,4286,0,0}, {0,0,0,1,0,4287,0,0}, {0,0,0,1,0,4288,0,0},
+    {0,0,0,1,0,4289,0,0}, {0,0,0,1,0,4290,0,0}, {0,0,0,1,0,4291,0,0}, {0,0,0,1,0,4292,0,0},
+    {0,0,0,1,0,4293,0,0}, {0,0,0,1,0,4294,0,0}, {0,0,0,1,0,4295,0,0}, {0,0,0,1,0,4296,0,0},
+    {0,0,0,1,0,4297,0,0}, {0,0,0,1,0,4298,0,0}, {0,0,0,1,0,4299,0,0}, {0,0,0,1,0,4300,0,0},
+    {0,0,0,1,0,4301,0,0}, {0,0,0,1,0,4302,0,0}, {0,0,0,1,0,4303,0,0}, {0,0,0,1,0,4304,0,0},
+    {0,0,0,1,0,4305,0,0}, {0,0,0,1,0,4306,0,0}, {0,0,0,1,0,4307,0,0}, {0,0,0,1,0,4308,0,0},
+    {0,0,0,1,0,4309,0,0}, {0,0,0,1,0,4310,0,0}, {0,0,0,1,0,4311,0,0}, {0,0,0,1,0,4312,0,0},
+    {0,0,0,1,0,4313,0,0}, {0,0,0,1,0,4314,0,0}, {0,0,0,1,0,4315,0,0}, {0,0,0,1,0,4316,0,0},
+    {0,0,0,1,0,4317,0,0}, {0,0,0,1,0,4318,0,0}, {0,0,0,1,0,4319,0,0}, {0,0,0,1,0,4320,0,0},
+    {0,0,0,1,0,4321,0,0}, {0,0,0,1,0,4322,0,0}, {0,0,0,1,0,4323,0,0}, {0,0,0,1,0,4324,0,0},
+    {0,0,0,1,0,4325,0,0}, {0,0,0,1,0,4326,0,0}, {0,0,0,1,0,4327,0,0}, {0,0,0,1,0,4328,0,0},
+    {0,0,0,1,0,4329,0,0}, {0,0,0,1,0,4330,0,0}, {0,0,0,1,0,4331,0,0}, {0,0,0,1,0,4332,0,0},
+    {0,0,0,1,0,4333,0,0}, {0,0,0,1,0,4334,0,0}, {0,0,0,1,0,4335,0,0}, {0,0,0,1,0,4336,0,0},
+    {0,0,0,1,0,4337,0,0}, {0,0,0,1,0,4338,0,0}, {0,0,0,1,0,4339,0,0}, {0,0,0,1,0,4340,0,0},
+    {0,0,0,1,0,4341,0,0}, {0,0,0,1,0,4342,0,0}, {0,0,0,1,0,4343,0,0}, {0,0,0,1,0,4344,0,0},
+    {0,0,0,1,0,4345,0,0}, {0,0,0,1,0,4346,0,0}, {0,0,0,1,0,4347,0,0}, {0,0,0,1,0,4348,0,0},
+    {0,0,0,1,0,4349,0,0}, {0,0,0,1,0,4350,0,0}, {0,0,0,1,0,4351,0,0}, {0,0,0,1,0,4352,0,0},
+    {0,0,0,1,0,4353,0,0}, {0,0,0,1,0,4354,0,0}, {0,0,0,0,0,0,928,1}, {0,1,2,0,4355,0,0,0},
+    {0,0,0,0,0,0,929,1}, {0,1,2,0,4357,0,0,0}, {0,0,0,0,0,0,930,1}, {0,1,2,0,4359,0,0,0},
+    {0,1,2,0,4361,0,0,0}, {0,1,2,0,4363,0,0,0}, {0,0,0,0,0,0,931,1}, {0,0,0,0,0,0,932,1},
+    {0,0,0,0,0,0,933,2}, {0,1,2,0,4365,0,0,0}, {0,1,2,0,4367,0,0,0}, {0,0,0,0,0,0,935,3},
+    {0,1,2,0,4369,0,0,0}, {0,1,2,0,4371,0,0,0}, {0,1,2,0,4373,0,0,0}, {0,0,0,0,0,0,938,1},
+    {0,0,0,0,0,0,939,1}, {0,1,2,0,4375,0,0,0}, {0,1,2,0,4377,0,0,0}, {0,0,0,1,0,4379,0,0},
+    {0,0,0,1,0,4380,0,0}, {0,0,0,1,0,4381,0,0}, {0,0,0,1,0,4382,0,0}, {0,0,0,1,0,4383,0,0},
+    {0,0,0,1,0,4384,0,0}, {0,0,0,1,0,4385,0,0}, {0,0,0,1,0,4386,0,0}, {0,0,0,1,0,4387,0,0},
+    {0,0,0,1,0,4388,0,0}, {0,0,0,1,0,4389,0,0}, {0,0,0,1,0,4390,0,0}, {0,0,0,1,0,4391,0,0},
+    {0,0,0,1,0,4392,0,0}, {0,0,0,1,0,4393,0,0}, {0,0,0,1,0,4394,0,0}, {0,0,0,1,0,4395,0,0},
+    {0,0,0,1,0,4396,0,0}, {0,0,0,1,0,4397,0,0}, {0,0,0,1,0,4398,0,0}, {0,0,0,1,0,4399,0,0},
+    {0,0,0,1,0,4400,0,0}, {0,0,0,1,0,4401,0,0}, {0,0,0,1,0,4402,0,0}, {0,0,0,1,0,4403,0,0},
+    {0,0,0,1,0,4404,0,0}, {0,0,0,1,0,4405,0,0}, {0,0,0,1,0,4406,0,0}, {0,0,0,1,0,4407,0,0},
+    {0,0,0,1,0,4408,0,0}, {0,0,0,1,0,4409,0,0}, {0,0,0,1,0,4410,0,0}, {0,0,0,0,0,0,940,1},
+    {0,1,2,0,4411,0,0,0}, {0,0,0,1,0,4413,0,0}, {0,0,0,1,0,4414,0,0}, {0,0,0,1,0,4415,0,0},
+    {0,0,0,1,0,4416,0,0}, {0,0,0,1,0,4417,0,0}, {0,0,0,1,0,4418,0,0}, {0,0,0,1,0,4419,0,0},
+    {0,0,0,1,0,4420,0,0}, {0,0,0,1,0,4421,0,0}, {0,0,0,1,0,4422,0,0}, {0,0,0,1,0,4423,0,0},
+    {0,0,0,1,0,4424,0,0}, {0,0,0,1,0,4425,0,0}, {0,0,0,1,0,4426,0,0}, {0,0,0,1,0,4427,0,0},
+    {0,0,0,1,0,4428,0,0}, {0,0,0,1,0,4429,0,0}, {0,0,0,1,0,4430,0,0}, {0,0,0,1,0,4431,0,0},
+    {0,0,0,1,0,4432,0,0}, {0,0,0,1,0,4433,0,0}, {0,0,0,1,0,4434,0,0}, {0,0,0,1,0,4435,0,0},
+    {0,0,0,1,0,4436,0,0}, {0,0,0,1,0,4437,0,0}, {0,0,0,1,0,4438,0,0}, {0,0,0,1,0,4439,0,0},
+    {0,0,0,1,0,4440,0,0}, {0,0,0,1,0,4441,0,0}, {0,0,0,1,0,4442,0,0}, {0,0,0,1,0,4443,0,0},
+    {0,0,0,1,0,4444,0,0}, {6,0,0,0,0,0,0,0}, {0,3,2,0,4445,0,0,0}, {0,3,2,0,4447,0,0,0},
+    {0,3,3,0,4449,0,0,0}, {0,3,3,0,4452,0,0,0}, {0,3,3,0,4455,0,0,0}, {0,3,3,0,4458,0,0,0},
+    {0,3,3,0,4461,0,0,0}, {226,0,0,0,0,0,0,0}, {0,3,2,0,4464,0,0,0}, {0,3,2,0,4466,0,0,0},
+    {0,3,3,0,4468,0,0,0}, {0,3,3,0,4471,0,0,0}, {0,3,3,0,4474,0,0,0}, {0,3,3,0,4477,0,0,0},
+    {0,0,0,1,0,4480,0,0}, {0,0,0,1,0,4481,0,0}, {0,0,0,1,0,4482,0,0}, {0,0,0,1,0,4483,0,0},
+    {0,0,0,1,0,4484,0,0}, {0,0,0,1,0,4485,0,0}, {0,0,0,1,0,4486,0,0}, {0,0,0,1,0,4487,0,0},
+    {0,0,0,1,0,4488,0,0}, {0,0,0,1,0,4489,0,0}, {0,0,0,1,0,4490,0,0}, {0,0,0,1,0,4491,0,0},
+    {0,0,0,1,0,4492,0,0}, {0,0,0,1,0,4493,0,0}, {0,0,0,1,0,4494,0,0}, {0,0,0,1,0,4495,0,0},
+    {0,0,0,1,0,4496,0,0}, {0,0,0,1,0,4497,0,0}, {0,0,0,1,0,4498,0,0}, {0,0,0,1,0,4499,0,0},
+    {0,0,0,1,0,4500,0,0}, {0,0,0,1,0,4501,0,0}, {0,0,0,1,0,4502,0,0}, {0,0,0,1,0,4503,0,0},
+    {0,0,0,1,0,4504,0,0}, {0,0,0,1,0,4505,0,0}, {0,0,0,1,0,4506,0,0}, {0,0,0,1,0,4507,0,0},
+    {0,0,0,1,0,4508,0,0}, {0,0,0,1,0,4509,0,0}, {0,0,0,1,0,4510,0,0}, {0,0,0,1,0,4511,0,0},
+    {0,0,0,1,0,4512,0,0}, {0,0,0,1,0,4513,0,0}, {0,3,1,0,4514,0,0,0}, {0,3,1,0,4515,0,0,0},
+    {0,3,1,0,4516,0,0,0}, {0,3,1,0,4517,0,0,0}, {0,3,1,0,4518,0,0,0}, {0,3,1,0,4519,0,0,0},
+    {0,3,1,0,4520,0,0,0}, {0,3,1,0,4521,0,0,0}, {0,3,1,0,4522,0,0,0}, {0,3,1,0,4523,0,0,0},
+    {0,3,1,0,4524,0,0,0}, {0,3,1,0,4525,0,0,0}, {0,3,1,0,4526,0,0,0}, {0,3,1,0,4527,0,0,0},
+    {0,3,1,0,4528,0,0,0}, {0,3,1,0,4529,0,0,0}, {0,3,1,0,4530,0,0,0}, {0,3,1,0,4531,0,0,0},
+    {0,3,1,0,4532,0,0,0}, {0,3,1,0,4533,0,0,0}, {0,3,1,0,4534,0,0,0}, {0,3,1,0,4535,0,0,0},
+    {0,3,1,0,4536,0,0,0}, {0,3,1,0,4537,0,0,0}, {0,3,1,0,4538,0,0,0}, {0,3,1,0,4539,0,0,0},
+    {0,3,1,0,4540,0,0,0}, {0,3,1,0,4541,0,0,0}, {0,3,1,0,4542,0,0,0}, {0,3,1,0,4543,0,0,0},
+    {0,3,1,0,4544,0,0,0}, {0,3,1,0,4545,0,0,0}, {0,3,1,0,4546,0,0,0}, {0,3,1,0,4547,0,0,0},
+    {0,3,1,0,4548,0,0,0}, {0,3,1,0,4549,0,0,0}, {0,3,1,0,4550,0,0,0}, {0,3,1,0,4551,0,0,0},
+    {0,3,1,0,4552,0,0,0}, {0,3,1,0,4553,0,0,0}, {0,3,1,0,4554,0,0,0}, {0,3,1,0,4555,0,0,0},
+    {0,3,1,0,4556,0,0,0}, {0,3,1,0,4557,0,0,0}, {0,3,1,0,4558,0,0,0}, {0,3,1,0,4559,0,0,0},
+    {0,3,1,0,4560,0,0,0}, {0,3,1,0,4561,0,0,0}, {0,3,1,0,4562,0,0,0}, {0,3,1,0,4563,0,0,0},
+    {0,3,1,0,4564,0,0,0}, {0,3,1,0,4565,0,0,0}, {0,3,1,0,4566,0,0,0}, {0,3,1,0,4567,0,0,0},
+    {0,3,1,0,4568,0,0,0}, {0,3,1,0,4569,0,0,0}, {0,3,1,0,4570,0,0,0}, {0,3,1,0,4571,0,0,0},
+    {0,3,1,0,4572,0,0,0}, {0,3,1,0,4573,0,0,0}, {0,3,1,0,4574,0,0,0}, {0,3,1,0,4575,0,0,0},
+    {0,3,1,0,4576,0,0,0}, {0,3,1,0,4577,0,0,0}, {0,3,1,0,4578,0,0,0}, {0,3,1,0,4579,0,0,0},
+    {0,3,1,0,4580,0,0,0}, {0,3,1,0,4581,0,0,0}, {0,3,1,0,4582,0,0,0}, {0,3,1,0,4583,0,0,0},
+    {0,3,1,0,4584,0,0,0}, {0,3,1,0,4585,0,0,0}, {0,3,1,0,4586,0,0,0}, {0,3,1,0,4587,0,0,0},
+    {0,3,1,0,4588,0,0,0}, {0,3,1,0,4589,0,0,0}, {0,3,1,0,4590,0,0,0}, {0,3,1,0,4591,0,0,0},
+    {0,3,1,0,4592,0,0,0}, {0,3,1,0,4593,0,0,0}, {0,3,1,0,4594,0,0,0}, {0,3,1,0,4595,0,0,0},
+    {0,3,1,0,4596,0,0,0}, {0,3,1,0,4597,0,0,0}, {0,3,1,0,4598,0,0,0}, {0,3,1,0,4599,0,0,0},
+    {0,3,1,0,4600,0,0,0}, {0,3,1,0,4601,0,0,0}, {0,3,1,0,4602,0,0,0}, {0,3,1,0,4603,0,0,0},
+    {0,3,1,0,4604,0,0,0}, {0,3,1,0,4605,0,0,0}, {0,3,1,0,4606,0,0,0}, {0,3,1,0,4607,0,0,0},
+    {0,3,1,0,4608,0,0,0}, {0,3,1,0,4609,0,0,0}, {0,3,1,0,4610,0,0,0}, {0,3,1,0,4611,0,0,0},
+    {0,3,1,0,4612,0,0,0}, {0,3,1,0,4613,0,0,0}, {0,3,1,0,4614,0,0,0}, {0,3,1,0,4615,0,0,0},
+    {0,3,1,0,4616,0,0,0}, {0,3,1,0,4617,0,0,0}, {0,3,1,0,4618,0,0,0}, {0,3,1,0,4619,0,0,0},
+    {0,3,1,0,4620,0,0,0}, {0,3,1,0,4621,0,0,0}, {0,3,1,0,4622,0,0,0}, {0,3,1,0,4623,0,0,0},
+    {0,3,1,0,4624,0,0,0}, {0,3,1,0,4625,0,0,0}, {0,3,1,0,4626,0,0,0}, {0,3,1,0,4627,0,0,0},
+    {0,3,1,0,4628,0,0,0}, {0,3,1,0,4629,0,0,0}, {0,3,1,0,4630,0,0,0}, {0,3,1,0,4631,0,0,0},
+    {0,3,1,0,4632,0,0,0}, {0,3,1,0,4633,0,0,0}, {0,3,1,0,4634,0,0,0}, {0,3,1,0,4635,0,0,0},
+    {0,3,1,0,4636,0,0,0}, {0,3,1,0,4637,0,0,0}, {0,3,1,0,4638,0,0,0}, {0,3,1,0,4639,0,0,0},
+    {0,3,1,0,4640,0,0,0}, {0,3,1,0,4641,0,0,0}, {0,3,1,0,4642,0,0,0}, {0,3,1,0,4643,0,0,0},
+    {0,3,1,0,4644,0,0,0}, {0,3,1,0,4645,0,0,0}, {0,3,1,0,4646,0,0,0}, {0,3,1,0,4647,0,0,0},
+    {0,3,1,0,4648,0,0,0}, {0,3,1,0,4649,0,0,0}, {0,3,1,0,4650,0,0,0}, {0,3,1,0,4651,0,0,0},
+    {0,3,1,0,4652,0,0,0}, {0,3,1,0,4653,0,0,0}, {0,3,1,0,4654,0,0,0}, {0,3,1,0,4655,0,0,0},
+    {0,3,1,0,4656,0,0,0}, {0,3,1,0,4657,0,0,0}, {0,3,1,0,4658,0,0,0}, {0,3,1,0,4659,0,0,0},
+    {0,3,1,0,4660,0,0,0}, {0,3,1,0,4661,0,0,0}, {0,3,1,0,4662,0,0,0}, {0,3,1,0,4663,0,0,0},
+    {0,3,1,0,4664,0,0,0}, {0,3,1,0,4665,0,0,0}, {0,3,1,0,4666,0,0,0}, {0,3,1,0,4667,0,0,0},
+    {0,3,1,0,4668,0,0,0}, {0,3,1,0,4669,0,0,0}, {0,3,1,0,4670,0,0,0}, {0,3,1,0,4671,0,0,0},
+    {0,3,1,0,4672,0,0,0}, {0,3,1,0,4673,0,0,0}, {0,3,1,0,4674,0,0,0}, {0,3,1,0,4675,0,0,0},
+    {0,3,1,0,4676,0,0,0}, {0,3,1,0,4677,0,0,0}, {0,3,1,0,4678,0,0,0}, {0,3,1,0,4679,0,0,0},
+    {0,3,1,0,4680,0,0,0}, {0,3,1,0,4681,0,0,0}, {0,3,1,0,4682,0,0,0}, {0,3,1,0,4683,0,0,0},
+    {0,3,1,0,4684,0,0,0}, {0,3,1,0,4685,0,0,0}, {0,3,1,0,4686,0,0,0}, {0,3,1,0,4687,0,0,0},
+    {0,3,1,0,4688,0,0,0}, {0,3,1,0,4689,0,0,0}, {0,3,1,0,4690,0,0,0}, {0,3,1,0,4691,0,0,0},
+    {0,3,1,0,4692,0,0,0}, {0,3,1,0,4693,0,0,0}, {0,3,1,0,4694,0,0,0}, {0,3,1,0,4695,0,0,0},
+    {0,3,1,0,4696,0,0,0}, {0,3,1,0,4697,0,0,0}, {0,3,1,0,4698,0,0,0}, {0,3,1,0,4699,0,0,0},
+    {0,3,1,0,4700,0,0,0}, {0,3,1,0,4701,0,0,0}, {0,3,1,0,4702,0,0,0}, {0,3,1,0,4703,0,0,0},
+    {0,3,1,0,4704,0,0,0}, {0,3,1,0,4705,0,0,0}, {0,3,1,0,4706,0,0,0}, {0,3,1,0,4707,0,0,0},
+    {0,3,1,0,4708,0,0,0}, {0,3,1,0,4709,0,0,0}, {0,3,1,0,4710,0,0,0}, {0,3,1,0,4711,0,0,0},
+    {0,3,1,0,4712,0,0,0}, {0,3,1,0,4713,0,0,0}, {0,3,1,0,4714,0,0,0}, {0,3,1,0,4715,0,0,0},
+    {0,3,1,0,4716,0,0,0}, {0,3,1,0,4717,0,0,0}, {0,3,1,0,4718,0,0,0}, {0,3,1,0,4719,0,0,0},
+    {0,3,1,0,4720,0,0,0}, {0,3,1,0,4721,0,0,0}, {0,3,1,0,4722,0,0,0}, {0,3,1,0,4723,0,0,0},
+    {0,3,1,0,4724,0,0,0}, {0,3,1,0,4725,0,0,0}, {0,3,1,0,4726,0,0,0}, {0,3,1,0,4727,0,0,0},
+    {0,3,1,0,4728,0,0,0}, {0,3,1,0,4729,0,0,0}, {0,3,1,0,4730,0,0,0}, {0,3,1,0,4731,0,0,0},
+    {0,3,1,0,4732,0,0,0}, {0,3,1,0,4733,0,0,0}, {0,3,1,0,4734,0,0,0}, {0,3,1,0,4735,0,0,0},
+    {0,3,1,0,4736,0,0,0}, {0,3,1,0,4737,0,0,0}, {0,3,1,0,4738,0,0,0}, {0,3,1,0,4739,0,0,0},
+    {0,3,1,0,4740,0,0,0}, {0,3,1,0,4741,0,0,0}, {0,3,1,0,4742,0,0,0}, {0,3,1,0,4743,0,0,0},
+    {0,3,1,0,4744,0,0,0}, {0,3,1,0,4745,0,0,0}, {0,3,1,0,4746,0,0,0}, {0,3,1,0,4747,0,0,0},
+    {0,3,1,0,4748,0,0,0}, {0,3,1,0,4749,0,0,0}, {0,3,1,0,4750,0,0,0}, {0,3,1,0,4751,0,0,0},
+    {0,3,1,0,4752,0,0,0}, {0,3,1,0,4753,0,0,0}, {0,3,1,0,4754,0,0,0}, {0,3,1,0,4755,0,0,0},
+    {0,3,1,0,4756,0,0,0}, {0,3,1,0,4757,0,0,0}, {0,3,1,0,4758,0,0,0}, {0,3,1,0,4759,0,0,0},
+    {0,3,1,0,4760,0,0,0}, {0,3,1,0,4761,0,0,0}, {0,3,1,0,4762,0,0,0}, {0,3,1,0,4763,0,0,0},
+    {0,3,1,0,4764,0,0,0}, {0,3,1,0,4765,0,0,0}, {0,3,1,0,4766,0,0,0}, {0,3,1,0,4767,0,0,0},
+    {0,3,1,0,4768,0,0,0}, {0,3,1,0,4769,0,0,0}, {0,3,1,0,4770,0,0,0}, {0,3,1,0,4771,0,0,0},
+    {0,3,1,0,4772,0,0,0}, {0,3,1,0,4773,0,0,0}, {0,3,1,0,4774,0,0,0}, {0,3,1,0,4775,0,0,0},
+    {0,3,1,0,4776,0,0,0}, {0,3,1,0,4777,0,0,0}, {0,3,1,0,4778,0,0,0}, {0,3,1,0,4779,0,0,0},
+    {0,3,1,0,4780,0,0,0}, {0,3,1,0,4781,0,0,0}, {0,3,1,0,4782,0,0,0}, {0,3,1,0,4783,0,0,0},
+    {0,3,1,0,4784,0,0,0}, {0,3,1,0,4785,0,0,0}, {0,3,1,0,4786,0,0,0}, {0,3,1,0,4787,0,0,0},
+    {0,3,1,0,4788,0,0,0}, {0,3,1,0,4789,0,0,0}, {0,3,1,0,4790,0,0,0}, {0,3,1,0,4791,0,0,0},
+    {0,3,1,0,4792,0,0,0}, {0,3,1,0,4793,0,0,0}, {0,3,1,0,4794,0,0,0}, {0,3,1,0,4795,0,0,0},
+    {0,3,1,0,4796,0,0,0}, {0,3,1,0,4797,0,0,0}, {0,3,1,0,4798,0,0,0}, {0,3,1,0,4799,0,0,0},
+    {0,3,1,0,4800,0,0,0}, {0,3,1,0,4801,0,0,0}, {0,3,1,0,4802,0,0,0}, {0,3,1,0,4803,0,0,0},
+    {0,3,1,0,4804,0,0,0}, {0,3,1,0,4805,0,0,0}, {0,3,1,0,4806,0,0,0}, {0,3,1,0,4807,0,0,0},
+    {0,3,1,0,4808,0,0,0}, {0,3,1,0,4809,0,0,0}, {0,3,1,0,4810,0,0,0}, {0,3,1,0,4811,0,0,0},
+    {0,3,1,0,4812,0,0,0}, {0,3,1,0,4813,0,0,0}, {0,3,1,0,4814,0,0,0}, {0,3,1,0,4815,0,0,0},
+    {0,3,1,0,4816,0,0,0}, {0,3,1,0,4817,0,0,0}, {0,3,1,0,4818,0,0,0}, {0,3,1,0,4819,0,0,0},
+    {0,3,1,0,4820,0,0,0}, {0,3,1,0,4821,0,0,0}, {0,3,1,0,4822,0,0,0}, {0,3,1,0,4823,0,0,0},
+    {0,3,1,0,4824,0,0,0}, {0,3,1,0,4825,0,0,0}, {0,3,1,0,4826,0,0,0}, {0,3,1,0,4827,0,0,0},
+    {0,3,1,0,4828,0,0,0}, {0,3,1,0,4829,0,0,0}, {0,3,1,0,4830,0,0,0}, {0,3,1,0,4831,0,0,0},
+    {0,3,1,0,4832,0,0,0}, {0,3,1,0,4833,0,0,0}, {0,3,1,0,4834,0,0,0}, {0,3,1,0,4835,0,0,0},
+    {0,3,1,0,4836,0,0,0}, {0,3,1,0,4837,0,0,0}, {0,3,1,0,4838,0,0,0}, {0,3,1,0,4839,0,0,0},
+    {0,3,1,0,4840,0,0,0}, {0,3,1,0,4841,0,0,0}, {0,3,1,0,4842,0,0,0}, {0,3,1,0,4843,0,0,0},
+    {0,3,1,0,4844,0,0,0}, {0,3,1,0,4845,0,0,0}, {0,3,1,0,4846,0,0,0}, {0,3,1,0,4847,0,0,0},
+    {0,3,1,0,4848,0,0,0}, {0,3,1,0,4849,0,0,0}, {0,3,1,0,4850,0,0,0}, {0,3,1,0,4851,0,0,0},
+    {0,3,1,0,4852,0,0,0}, {0,3,1,0,4853,0,0,0}, {0,3,1,0,4854,0,0,0}, {0,3,1,0,4855,0,0,0},
+    {0,3,1,0,4856,0,0,0}, {0,3,1,0,4857,0,0,0}, {0,3,1,0,4858,0,0,0}, {0,3,1,0,4859,0,0,0},
+    {0,3,1,0,4860,0,0,0}, {0,3,1,0,4861,0,0,0}, {0,3,1,0,4862,0,0,0}, {0,3,1,0,4863,0,0,0},
+    {0,3,1,0,4864,0,0,0}, {0,3,1,0,4865,0,0,0}, {0,3,1,0,4866,0,0,0}, {0,3,1,0,4867,0,0,0},
+    {0,3,1,0,4868,0,0,0}, {0,3,1,0,4869,0,0,0}, {0,3,1,0,4870,0,0,0}, {0,3,1,0,4871,0,0,0},
+    {0,3,1,0,4872,0,0,0}, {0,3,1,0,4873,0,0,0}, {0,3,1,0,4874,0,0,0}, {0,3,1,0,4875,0,0,0},
+    {0,3,1,0,4876,0,0,0}, {0,3,1,0,4877,0,0,0}, {0,3,1,0,4878,0,0,0}, {0,3,1,0,4879,0,0,0},
+    {0,3,1,0,4880,0,0,0}, {0,3,1,0,4881,0,0,0}, {0,3,1,0,4882,0,0,0}, {0,3,1,0,4883,0,0,0},
+    {0,3,1,0,4884,0,0,0}, {0,3,1,0,4885,0,0,0}, {0,3,1,0,4886,0,0,0}, {0,3,1,0,4887,0,0,0},
+    {0,3,1,0,4888,0,0,0}, {0,3,1,0,4889,0,0,0}, {0,3,1,0,4890,0,0,0}, {0,3,1,0,4891,0,0,0},
+    {0,3,1,0,4892,0,0,0}, {0,3,1,0,4893,0,0,0}, {0,3,1,0,4894,0,0,0}, {0,3,1,0,4895,0,0,0},
+    {0,3,1,0,4896,0,0,0}, {0,3,1,0,4897,0,0,0}, {0,3,1,0,4898,0,0,0}, {0,3,1,0,4899,0,0,0},
+    {0,3,1,0,4900,0,0,0}, {0,3,1,0,4901,0,0,0}, {0,3,1,0,4902,0,0,0}, {0,3,1,0,4903,0,0,0},
+    {0,3,1,0,4904,0,0,0}, {0,3,1,0,4905,0,0,0}, {0,3,1,0,4906,0,0,0}, {0,3,1,0,4907,0,0,0},
+    {0,3,1,0,4908,0,0,0}, {0,3,1,0,4909,0,0,0}, {0,3,1,0,4910,0,0,0}, {0,3,1,0,4911,0,0,0},
+    {0,3,1,0,4912,0,0,0}, {0,3,1,0,4913,0,0,0}, {0,3,1,0,4914,0,0,0}, {0,3,1,0,4915,0,0,0},
+    {0,3,1,0,4916,0,0,0}, {0,3,1,0,4917,0,0,0}, {0,3,1,0,4918,0,0,0}, {0,3,1,0,4919,0,0,0},
+    {0,3,1,0,4920,0,0,0}, {0,3,1,0,4921,0,0,0}, {0,3,1,0,4922,0,0,0}, {0,3,1,0,4923,0,0,0},
+    {0,3,1,0,4924,0,0,0}, {0,3,1,0,4925,0,0,0}, {0,3,1,0,4926,0,0,0}, {0,3,1,0,4927,0,0,0},
+    {0,3,1,0,4928,0,0,0}, {0,3,1,0,4929,0,0,0}, {0,3,1,0,4930,0,0,0}, {0,3,1,0,4931,0,0,0},
+    {0,3,1,0,4932,0,0,0}, {0,3,1,0,4933,0,0,0}, {0,3,1,0,4934,0,0,0}, {0,3,1,0,4935,0,0,0},
+    {0,3,1,0,4936,0,0,0}, {0,3,1,0,4937,0,0,0}, {0,3,1,0,4938,0,0,0}, {0,3,1,0,4939,0,0,0},
+    {0,3,1,0,4940,0,0,0}, {0,3,1,0,4941,0,0,0}, {0,3,1,0,4942,0,0,0}, {0,3,1,0,4943,0,0,0},
+    {0,3,1,0,4944,0,0,0}, {0,3,1,0,4945,0,0,0}, {0,3,1,0,4946,0,0,0}, {0,3,1,0,4947,0,0,0},
+    {0,3,1,0,4948,0,0,0}, {0,3,1,0,4949,0,0,0}, {0,3,1,0,4950,0,0,0}, {0,3,1,0,4951,0,0,0},
+    {0,3,1,0,4952,0,0,0}, {0,3,1,0,4953,0,0,0}, {0,3,1,0,4954,0,0,0}, {0,3,1,0,4955,0,0,0},
+    {0,3,1,0,4956,0,0,0}, {0,3,1,0,4957,0,0,0}, {0,3,1,0,4958,0,0,0}, {0,3,1,0,4959,0,0,0},
+    {0,3,1,0,4960,0,0,0}, {0,3,1,0,4961,0,0,0}, {0,3,1,0,4962,0,0,0}, {0,3,1,0,4963,0,0,0},
+    {0,3,1,0,4964,0,0,0}, {0,3,1,0,4965,0,0,0}, {0,3,1,0,4966,0,0,0}, {0,3,1,0,4967,0,0,0},
+    {0,3,1,0,4968,0,0,0}, {0,3,1,0,4969,0,0,0}, {0,3,1,0,4970,0,0,0}, {0,3,1,0,4971,0,0,0},
+    {0,3,1,0,4972,0,0,0}, {0,3,1,0,4973,0,0,0}, {0,3,1,0,4974,0,0,0}, {0,3,1,0,4975,0,0,0},
+    {0,3,1,0,4976,0,0,0}, {0,3,1,0,4977,0,0,0}, {0,3,1,0,4978,0,0,0}, {0,3,1,0,4979,0,0,0},
+    {0,3,1,0,4980,0,0,0}, {0,3,1,0,4981,0,0,0}, {0,3,1,0,4982,0,0,0}, {0,3,1,0,4983,0,0,0},
+    {0,3,1,0,4984,0,0,0}, {0,3,1,0,4985,0,0,0}, {0,3,1,0,4986,0,0,0}, {0,3,1,0,4987,0,0,0},
+    {0,3,1,0,4988,0,0,0}, {0,3,1,0,4989,0,0,0}, {0,3,1,0,4990,0,0,0}, {0,3,1,0,4991,0,0,0},
+    {0,3,1,0,4992,0,0,0}, {0,3,1,0,4993,0,0,0}, {0,3,1,0,4994,0,0,0}, {0,3,1,0,4995,0,0,0},
+    {0,3,1,0,4996,0,0,0}, {0,3,1,0,4997,0,0,0}, {0,3,1,0,4998,0,0,0}, {0,3,1,0,4999,0,0,0},
+    {0,3,1,0,5000,0,0,0}, {0,3,1,0,5001,0,0,0}, {0,3,1,0,5002,0,0,0}, {0,3,1,0,5003,0,0,0},
+    {0,3,1,0,5004,0,0,0}, {0,3,1,0,5005,0,0,0}, {0,3,1,0,5006,0,0,0}, {0,3,1,0,5007,0,0,0},
+    {0,3,1,0,5008,0,0,0}, {0,3,1,0,5009,0,0,0}, {0,3,1,0,5010,0,0,0}, {0,3,1,0,5011,0,0,0},
+    {0,3,1,0,5012,0,0,0}, {0,3,1,0,5013,0,0,0}, {0,3,1,0,5014,0,0,0}, {0,3,1,0,5015,0,0,0},
+    {0,3,1,0,5016,0,0,0}, {0,3,1,0,5017,0,0,0}, {0,3,1,0,5018,0,0,0}, {0,3,1,0,5019,0,0,0},
+    {0,3,1,0,5020,0,0,0}, {0,3,1,0,5021,0,0,0}, {0,3,1,0,5022,0,0,0}, {0,3,1,0,5023,0,0,0},
+    {0,3,1,0,5024,0,0,0}, {0,3,1,0,5025,0,0,0}, {0,3,1,0,5026,0,0,0}, {0,3,1,0,5027,0,0,0},
+    {0,3,1,0,5028,0,0,0}, {0,3,1,0,5029,0,0,0}, {0,3,1,0,5030,0,0,0}, {0,3,1,0,5031,0,0,0},
+    {0,3,1,0,5032,0,0,0}, {0,3,1,0,5033,0,0,0}, {0,3,1,0,5034,0,0,0}, {0,3,1,0,5035,0,0,0},
+    {0,3,1,0,5036,0,0,0}, {0,3,1,0,5037,0,0,0}, {0,3,1,0,5038,0,0,0}, {0,3,1,0,5039,0,0,0},
+    {0,3,1,0,5040,0,0,0}, {0,3,1,0,5041,0,0,0}, {0,3,1,0,5042,0,0,0}, {0,3,1,0,5043,0,0,0},
+    {0,3,1,0,5044,0,0,0}, {0,3,1,0,5045,0,0,0}, {0,3,1,0,5046,0,0,0}, {0,3,1,0,5047,0,0,0},
+    {0,3,1,0,5048,0,0,0}, {0,3,1,0,5049,0,0,0}, {0,3,1,0,5050,0,0,0}, {0,3,1,0,5051,0,0,0},
+    {0,3,1,0,5052,0,0,0}, {0,3,1,0,5053,0,0,0}, {0,3,1,0,5054,0,0,0}, {0,3,1,0,5055,0,0,0},
+
+};
+
+const uint32_t UNICODE_NORM_CODEPOINTS[5056] = {
+    0x0061,0x0062,0x0063,0x0064,0x0065,0x0066,0x0067,0x0068,0x0069,0x006a,0x006b,0x006c,0x006d,0x006e,0x006f,0x0070,
+    0x0071,0x0072,0x0073,0x0074,0x0075,0x0076,0x0077,0x0078,0x0079,0x007a,0x03bc,0x0041,0x0300,0x00e0,0x0041,0x0301,
+    0x00e1,0x0041,0x0302,0x00e2,0x0041,0x0303,0x00e3,0x0041,0x0308,0x00e4,0x0041,0x030a,0x00e5,0x00e6,0x0043,0x0327,
+    0x00e7,0x0045,0x0300,0x00e8,0x0045,0x0301,0x00e9,0x0045,0x0302,0x00ea,0x0045,0x0308,0x00eb,0x0049,0x0300,0x00ec,
+    0x0049,0x0301,0x00ed,0x0049,0x0302,0x00ee,0x0049,0x0308,0x00ef,0x00f0,0x004e,0x0303,0x00f1,0x004f,0x0300,0x00f2,
+    0x004f,0x0301,0x00f3,0x004f,0x0302,0x00f4,0x004f,0x0303,0x00f5,0x004f,0x0308,0x00f6,0x00f8,0x0055,0x0300,0x00f9,
+    0x0055,0x0301,0x00fa,0x0055,0x0302,0x00fb,0x0055,0x0308,0x00fc,0x0059,0x0301,0x00fd,0x00fe,0x0073,0x0073,0x0061,
+    0x0300,0x0061,0x0301,0x0061,0x0302,0x0061,0x0303,0x0061,0x0308,0x0061,0x030a,0x0063,0x0327,0x0065,0x0300,0x0065,
+    0x0301,0x0065,0x0302,0x0065,0x0308,0x0069,0x0300,0x0069,0x0301,0x0069,0x0302,0x0069,0x0308,0x006e,0x0303,0x006f,
+    0x0300,0x006f,0x0301,0x006f,0x0302,0x006f,0x0303,0x006f,0x0308,0x0075,0x0300,0x0075,0x0301,0x0075,0x0302,0x0075,
+    0x0308,0x0079,0x0301,0x0079,0x0308,0x0041,0x0304,0x0101,0x0061,0x0304,0x0041,0x0306,0x0103,0x0061,0x0306,0x0041,
+    0x0328,0x0105,0x0061,0x0328,0x0043,0x0301,0x0107,0x0063,0x0301,0x0043,0x0302,0x0109,0x0063,0x0302,0x0043,0x0307,
+    0x010b,0x0063,0x0307,0x0043,0x030c,0x010d,0x0063,0x030c,0x0044,0x030c,0x010f,0x0064,0x030c,0x0111,0x0045,0x0304,
+    0x0113,0x0065,0x0304,0x0045,0x0306,0x0115,0x0065,0x0306,0x0045,0x0307,0x0117,0x0065,0x0307,0x0045,0x0328,0x0119,
+    0x0065,0x0328,0x0045,0x030c,0x011b,0x0065,0x030c,0x0047,0x0302,0x011d,0x0067,0x0302,0x0047,0x0306,0x011f,0x0067,
+    0x0306,0x0047,0x0307,0x0121,0x0067,0x0307,0x0047,0x0327,0x0123,0x0067,0x0327,0x0048,0x0302,0x0125,0x0068,0x0302,
+    0x0127,0x0049,0x0303,0x0129,0x0069,0x0303,0x0049,0x0304,0x012b,0x0069,0x0304,0x0049,0x0306,0x012d,0x0069,0x0306,
+    0x0049,0x0328,0x012f,0x0069,0x0328,0x0049,0x0307,0x0069,0x0307,0x0133,0x004a,0x0302,0x0135,0x006a,0x0302,0x004b,
+    0x0327,0x0137,0x006b,0x0327,0x004c,0x0301,0x013a,0x006c,0x0301,0x004c,0x0327,0x013c,0x006c,0x0327,0x004c,0x030c,
+    0x013e,0x006c,0x030c,0x0140,0x0142,0x004e,0x0301,0x0144,0x006e,0x0301,0x004e,0x0327,0x0146,0x006e,0x0327,0x004e,
+    0x030c,0x0148,0x006e,0x030c,0x02bc,0x006e,0x014b,0x004f,0x0304,0x014d,0x006f,0x0304,0x004f,0x0306,0x014f,0x006f,
+    0x0306,0x004f,0x030b,0x0151,0x006f,0x030b,0x0153,0x0052,0x0301,0x0155,0x0072,0x0301,0x0052,0x0327,0x0157,0x0072,
+    0x0327,0x0052,0x030c,0x0159,0x0072,0x030c,0x0053,0x0301,0x015b,0x0073,0x0301,0x0053,0x0302,0x015d,0x0073,0x0302,
+    0x0053,0x0327,0x015f,0x0073,0x0327,0x0053,0x030c,0x0161,0x0073,0x030c,0x0054,0x0327,0x0163,0x0074,0x0327,0x0054,
+    0x030c,0x0165,0x0074,0x030c,0x0167,0x0055,0x0303,0x0169,0x0075,0x0303,0x0055,0x0304,0x016b,0x0075,0x0304,0x0055,
+    0x0306,0x016d,0x0075,0x0306,0x0055,0x030a,0x016f,0x0075,0x030a,0x0055,0x030b,0x0171,0x0075,0x030b,0x0055,0x0328,
+    0x0173,0x0075,0x0328,0x0057,0x0302,0x0175,0x0077,0x0302,0x0059,0x0302,0x0177,0x0079,0x0302,0x0059,0x0308,0x00ff,
+    0x005a,0x0301,0x017a,0x007a,0x0301,0x005a,0x0307,0x017c,0x007a,0x0307,0x005a,0x030c,0x017e,0x007a,0x030c,0x0073,
+    0x0253,0x0183,0x0185,0x0254,0x0188,0x0256,0x0257,0x018c,0x01dd,0x0259,0x025b,0x0192,0x0260,0x0263,0x0269,0x0268,
+    0x0199,0x026f,0x0272,0x0275,0x004f,0x031b,0x01a1,0x006f,0x031b,0x01a3,0x01a5,0x0280,0x01a8,0x0283,0x01ad,0x0288,
+    0x0055,0x031b,0x01b0,0x0075,0x031b,0x028a,0x028b,0x01b4,0x01b6,0x0292,0x01b9,0x01bd,0x01c6,0x01c6,0x01c9,0x01c9,
+    0x01cc,0x01cc,0x0041,0x030c,0x01ce,0x0061,0x030c,0x0049,0x030c,0x01d0,0x0069,0x030c,0x004f,0x030c,0x01d2,0x006f,
+    0x030c,0x0055,0x030c,0x01d4,0x0075,0x030c,0x0055,0x0308,0x0304,0x01d6,0x0075,0x0308,0x0304,0x0055,0x0308,0x0301,
+    0x01d8,0x0075,0x0308,0x0301,0x0055,0x0308,0x030c,0x01da,0x0075,0x0308,0x030c,0x0055,0x0308,0x0300,0x01dc,0x0075,
+    0x0308,0x0300,0x0041,0x0308,0x0304,0x01df,0x0061,0x0308,0x0304,0x0041,0x0307,0x0304,0x01e1,0x0061,0x0307,0x0304,
+    0x00c6,0x0304,0x01e3,0x00e6,0x0304,0x01e5,0x0047,0x030c,0x01e7,0x0067,0x030c,0x004b,0x030c,0x01e9,0x006b,0x030c,
+    0x004f,0x0328,0x01eb,0x006f,0x0328,0x004f,0x0328,0x0304,0x01ed,0x006f,0x0328,0x0304,0x01b7,0x030c,0x01ef,0x0292,
+    0x030c,0x006a,0x030c,0x006a,0x030c,0x01f3,0x01f3,0x0047,0x0301,0x01f5,0x0067,0x0301,0x0195,0x01bf,0x004e,0x0300,
+    0x01f9,0x006e,0x0300,0x0041,0x030a,0x0301,0x01fb,0x0061,0x030a,0x0301,0x00c6,0x0301,0x01fd,0x00e6,0x0301,0x00d8,
+    0x0301,0x01ff,0x00f8,0x0301,0x0041,0x030f,0x0201,0x0061,0x030f,0x0041,0x0311,0x0203,0x0061,0x0311,0x0045,0x030f,
+    0x0205,0x0065,0x030f,0x0045,0x0311,0x0207,0x0065,0x0311,0x0049,0x030f,0x0209,0x0069,0x030f,0x0049,0x0311,0x020b,
+    0x0069,0x0311,0x004f,0x030f,0x020d,0x006f,0x030f,0x004f,0x0311,0x020f,0x006f,0x0311,0x0052,0x030f,0x0211,0x0072,
+    0x030f,0x0052,0x0311,0x0213,0x0072,0x0311,0x0055,0x030f,0x0215,0x0075,0x030f,0x0055,0x0311,0x0217,0x0075,0x0311,
+    0x0053,0x0326,0x0219,0x0073,0x0326,0x0054,0x0326,0x021b,0x0074,0x0326,0x021d,0x0048,0x030c,0x021f,0x0068,0x030c,
+    0x019e,0x0223,0x0225,0x0041,0x0307,0x0227,0x0061,0x0307,0x0045,0x0327,0x0229,0x0065,0x0327,0x004f,0x0308,0x0304,
+    0x022b,0x006f,0x0308,0x0304,0x004f,0x0303,0x0304,0x022d,0x006f,0x0303,0x0304,0x004f,0x0307,0x022f,0x006f,0x0307,
+    0x004f,0x0307,0x0304,0x0231,0x006f,0x0307,0x0304,0x0059,0x0304,0x0233,0x0079,0x0304,0x2c65,0x023c,0x019a,0x2c66,
+    0x0242,0x0180,0x0289,0x028c,0x0247,0x0249,0x024b,0x024d,0x024f,0x0300,0x0301,0x0313,0x0308,0x0301,0x03b9,0x0371,
+    0x0373,0x02b9,0x0377,0x003b,0x03f3,0x00a8,0x0301,0x0391,0x0301,0x03ac,0x00b7,0x0395,0x0301,0x03ad,0x0397,0x0301,
+    0x03ae,0x0399,0x0301,0x03af,0x039f,0x0301,0x03cc,0x03a5,0x0301,0x03cd,0x03a9,0x0301,0x03ce,0x03b9,0x0308,0x0301,
+    0x03b9,0x0308,0x0301,0x03b1,0x03b2,0x03b3,0x03b4,0x03b5,0x03b6,0x03b7,0x03b8,0x03b9,0x03ba,0x03bb,0x03bc,0x03bd,
+    0x03be,0x03bf,0x03c0,0x03c1,0x03c3,0x03c4,0x03c5,0x03c6,0x03c7,0x03c8,0x03c9,0x0399,0x0308,0x03ca,0x03a5,0x0308,
+    0x03cb,0x03b1,0x0301,0x03b5,0x0301,0x03b7,0x0301,0x03b9,0x0301,0x03c5,0x0308,0x0301,0x03c5,0x0308,0x0301,0x03c3,
+    0x03b9,0x0308,0x03c5,0x0308,0x03bf,0x0301,0x03c5,0x0301,0x03c9,0x0301,0x03d7,0x03b2,0x03b8,0x03d2,0x0301,0x03d2,
+    0x0308,0x03c6,0x03c0,0x03d9,0x03db,0x03dd,0x03df,0x03e1,0x03e3,0x03e5,0x03e7,0x03e9,0x03eb,0x03ed,0x03ef,0x03ba,
+    0x03c1,0x03b8,0x03b5,0x03f8,0x03f2,0x03fb,0x037b,0x037c,0x037d,0x0415,0x0300,0x0450,0x0415,0x0308,0x0451,0x0452,
+    0x0413,0x0301,0x0453,0x0454,0x0455,0x0456,0x0406,0x0308,0x0457,0x0458,0x0459,0x045a,0x045b,0x041a,0x0301,0x045c,
+    0x0418,0x0300,0x045d,0x0423,0x0306,0x045e,0x045f,0x0430,0x0431,0x0432,0x0433,0x0434,0x0435,0x0436,0x0437,0x0438,
+    0x0418,0x0306,0x0439,0x043a,0x043b,0x043c,0x043d,0x043e,0x043f,0x0440,0x0441,0x0442,0x0443,0x0444,0x0445,0x0446,
+    0x0447,0x0448,0x0449,0x044a,0x044b,0x044c,0x044d,0x044e,0x044f,0x0438,0x0306,0x0435,0x0300,0x0435,0x0308,0x0433,
+    0x0301,0x0456,0x0308,0x043a,0x0301,0x0438,0x0300,0x0443,0x0306,0x0461,0x0463,0x0465,0x0467,0x0469,0x046b,0x046d,
+    0x046f,0x0471,0x0473,0x0475,0x0474,0x030f,0x0477,0x0475,0x030f,0x0479,0x047b,0x047d,0x047f,0x0481,0x048b,0x048d,
+    0x048f,0x0491,0x0493,0x0495,0x0497,0x0499,0x049b,0x049d,0x049f,0x04a1,0x04a3,0x04a5,0x04a7,0x04a9,0x04ab,0x04ad,
+    0x04af,0x04b1,0x04b3,0x04b5,0x04b7,0x04b9,0x04bb,0x04bd,0x04bf,0x04cf,0x0416,0x0306,0x04c2,0x0436,0x0306,0x04c4,
+    0x04c6,0x04c8,0x04ca,0x04cc,0x04ce,0x0410,0x0306,0x04d1,0x0430,0x0306,0x0410,0x0308,0x04d3,0x0430,0x0308,0x04d5,
+    0x0415,0x0306,0x04d7,0x0435,0x0306,0x04d9,0x04d8,0x0308,0x04db,0x04d9,0x0308,0x0416,0x0308,0x04dd,0x0436,0x0308,
+    0x0417,0x0308,0x04df,0x0437,0x0308,0x04e1,0x0418,0x0304,0x04e3,0x0438,0x0304,0x0418,0x0308,0x04e5,0x0438,0x0308,
+    0x041e,0x0308,0x04e7,0x043e,0x0308,0x04e9,0x04e8,0x0308,0x04eb,0x04e9,0x0308,0x042d,0x0308,0x04ed,0x044d,0x0308,
+    0x0423,0x0304,0x04ef,0x0443,0x0304,0x0423,0x0308,0x04f1,0x0443,0x0308,0x0423,0x030b,0x04f3,0x0443,0x030b,0x0427,
+    0x0308,0x04f5,0x0447,0x0308,0x04f7,0x042b,0x0308,0x04f9,0x044b,0x0308,0x04fb,0x04fd,0x04ff,0x0501,0x0503,0x0505,
+    0x0507,0x0509,0x050b,0x050d,0x050f,0x0511,0x0513,0x0515,0x0517,0x0519,0x051b,0x051d,0x051f,0x0521,0x0523,0x0525,
+    0x0527,0x0529,0x052b,0x052d,0x052f,0x0561,0x0562,0x0563,0x0564,0x0565,0x0566,0x0567,0x0568,0x0569,0x056a,0x056b,
+    0x056c,0x056d,0x056e,0x056f,0x0570,0x0571,0x0572,0x0573,0x0574,0x0575,0x0576,0x0577,0x0578,0x0579,0x057a,0x057b,
+    0x057c,0x057d,0x057e,0x057f,0x0580,0x0581,0x0582,0x0583,0x0584,0x0585,0x0586,0x0565,0x0582,0x0627,0x0653,0x0627,
+    0x0654,0x0648,0x0654,0x0627,0x0655,0x064a,0x0654,0x06d5,0x0654,0x06c1,0x0654,0x06d2,0x0654,0x0928,0x093c,0x0930,
+    0x093c,0x0933,0x093c,0x0915,0x093c,0x0916,0x093c,0x0917,0x093c,0x091c,0x093c,0x0921,0x093c,0x0922,0x093c,0x092b,
+    0x093c,0x092f,0x093c,0x09c7,0x09be,0x09c7,0x09d7,0x09a1,0x09bc,0x09a2,0x09bc,0x09af,0x09bc,0x0a32,0x0a3c,0x0a38,
+    0x0a3c,0x0a16,0x0a3c,0x0a17,0x0a3c,0x0a1c,0x0a3c,0x0a2b,0x0a3c,0x0b47,0x0b56,0x0b47,0x0b3e,0x0b47,0x0b57,0x0b21,
+    0x0b3c,0x0b22,0x0b3c,0x0b92,0x0bd7,0x0bc6,0x0bbe,0x0bc7,0x0bbe,0x0bc6,0x0bd7,0x0c46,0x0c56,0x0cbf,0x0cd5,0x0cc6,
+    0x0cd5,0x0cc6,0x0cd6,0x0cc6,0x0cc2,0x0cc6,0x0cc2,0x0cd5,0x0d46,0x0d3e,0x0d47,0x0d3e,0x0d46,0x0d57,0x0dd9,0x0dca,
+    0x0dd9,0x0dcf,0x0dd9,0x0dcf,0x0dca,0x0dd9,0x0ddf,0x0f42,0x0fb7,0x0f4c,0x0fb7,0x0f51,0x0fb7,0x0f56,0x0fb7,0x0f5b,
+    0x0fb7,0x0f40,0x0fb5,0x0f71,0x0f72,0x0f71,0x0f74,0x0fb2,0x0f80,0x0fb3,0x0f80,0x0f71,0x0f80,0x0f92,0x0fb7,0x0f9c,
+    0x0fb7,0x0fa1,0x0fb7,0x0fa6,0x0fb7,0x0fab,0x0fb7,0x0f90,0x0fb5,0x1025,0x102e,0x2d00,0x2d01,0x2d02,0x2d03,0x2d04,
+    0x2d05,0x2d06,0x2d07,0x2d08,0x2d09,0x2d0a,0x2d0b,0x2d0c,0x2d0d,0x2d0e,0x2d0f,0x2d10,0x2d11,0x2d12,0x2d13,0x2d14,
+    0x2d15,0x2d16,0x2d17,0x2d18,0x2d19,0x2d1a,0x2d1b,0x2d1c,0x2d1d,0x2d1e,0x2d1f,0x2d20,0x2d21,0x2d22,0x2d23,0x2d24,
+    0x2d25,0x2d27,0x2d2d,0x13f0,0x13f1,0x13f2,0x13f3,0x13f4,0x13f5,0x1b05,0x1b35,0x1b07,0x1b35,0x1b09,0x1b35,0x1b0b,
+    0x1b35,0x1b0d,0x1b35,0x1b11,0x1b35,0x1b3a,0x1b35,0x1b3c,0x1b35,0x1b3e,0x1b35,0x1b3f,0x1b35,0x1b42,0x1b35,0x0432,
+    0x0434,0x043e,0x0441,0x0442,0x0442,0x044a,0x0463,0xa64b,0x10d0,0x10d1,0x10d2,0x10d3,0x10d4,0x10d5,0x10d6,0x10d7,
+    0x10d8,0x10d9,0x10da,0x10db,0x10dc,0x10dd,0x10de,0x10df,0x10e0,0x10e1,0x10e2,0x10e3,0x10e4,0x10e5,0x10e6,0x10e7,
+    0x10e8,0x10e9,0x10ea,0x10eb,0x10ec,0x10ed,0x10ee,0x10ef,0x10f0,0x10f1,0x10f2,0x10f3,0x10f4,0x10f5,0x10f6,0x10f7,
+    0x10f8,0x10f9,0x10fa,0x10fd,0x10fe,0x10ff,0x0041,0x0325,0x1e01,0x0061,0x0325,0x0042,0x0307,0x1e03,0x0062,0x0307,
+    0x0042,0x0323,0x1e05,0x0062,0x0323,0x0042,0x0331,0x1e07,0x0062,0x0331,0x0043,0x0327,0x0301,0x1e09,0x0063,0x0327,
+    0x0301,0x0044,0x0307,0x1e0b,0x0064,0x0307,0x0044,0x0323,0x1e0d,0x0064,0x0323,0x0044,0x0331,0x1e0f,0x0064,0x0331,
+    0x0044,0x0327,0x1e11,0x0064,0x0327,0x0044,0x032d,0x1e13,0x0064,0x032d,0x0045,0x0304,0x0300,0x1e15,0x0065,0x0304,
+    0x0300,0x0045,0x0304,0x0301,0x1e17,0x0065,0x0304,0x0301,0x0045,0x032d,0x1e19,0x0065,0x032d,0x0045,0x0330,0x1e1b,
+    0x0065,0x0330,0x0045,0x0327,0x0306,0x1e1d,0x0065,0x0327,0x0306,0x0046,0x0307,0x1e1f,0x0066,0x0307,0x0047,0x0304,
+    0x1e21,0x0067,0x0304,0x0048,0x0307,0x1e23,0x0068,0x0307,0x0048,0x0323,0x1e25,0x0068,0x0323,0x0048,0x0308,0x1e27,
+    0x0068,0x0308,0x0048,0x0327,0x1e29,0x0068,0x0327,0x0048,0x032e,0x1e2b,0x0068,0x032e,0x0049,0x0330,0x1e2d,0x0069,
+    0x0330,0x0049,0x0308,0x0301,0x1e2f,0x0069,0x0308,0x0301,0x004b,0x0301,0x1e31,0x006b,0x0301,0x004b,0x0323,0x1e33,
+    0x006b,0x0323,0x004b,0x0331,0x1e35,0x006b,0x0331,0x004c,0x0323,0x1e37,0x006c,0x0323,0x004c,0x0323,0x0304,0x1e39,
+    0x006c,0x0323,0x0304,0x004c,0x0331,0x1e3b,0x006c,0x0331,0x004c,0x032d,0x1e3d,0x006c,0x032d,0x004d,0x0301,0x1e3f,
+    0x006d,0x0301,0x004d,0x0307,0x1e41,0x006d,0x0307,0x004d,0x0323,0x1e43,0x006d,0x0323,0x004e,0x0307,0x1e45,0x006e,
+    0x0307,0x004e,0x0323,0x1e47,0x006e,0x0323,0x004e,0x0331,0x1e49,0x006e,0x0331,0x004e,0x032d,0x1e4b,0x006e,0x032d,
+    0x004f,0x0303,0x0301,0x1e4d,0x006f,0x0303,0x0301,0x004f,0x0303,0x0308,0x1e4f,0x006f,0x0303,0x0308,0x004f,0x0304,
+    0x0300,0x1e51,0x006f,0x0304,0x0300,0x004f,0x0304,0x0301,0x1e53,0x006f,0x0304,0x0301,0x0050,0x0301,0x1e55,0x0070,
+    0x0301,0x0050,0x0307,0x1e57,0x0070,0x0307,0x0052,0x0307,0x1e59,0x0072,0x0307,0x0052,0x0323,0x1e5b,0x0072,0x0323,
+    0x0052,0x0323,0x0304,0x1e5d,0x0072,0x0323,0x0304,0x0052,0x0331,0x1e5f,0x0072,0x0331,0x0053,0x0307,0x1e61,0x0073,
+    0x0307,0x0053,0x0323,0x1e63,0x0073,0x0323,0x0053,0x0301,0x0307,0x1e65,0x0073,0x0301,0x0307,0x0053,0x030c,0x0307,
+    0x1e67,0x0073,0x030c,0x0307,0x0053,0x0323,0x0307,0x1e69,0x0073,0x0323,0x0307,0x0054,0x0307,0x1e6b,0x0074,0x0307,
+    0x0054,0x0323,0x1e6d,0x0074,0x0323,0x0054,0x0331,0x1e6f,0x0074,0x0331,0x0054,0x032d,0x1e71,0x0074,0x032d,0x0055,
+    0x0324,0x1e73,0x0075,0x0324,0x0055,0x0330,0x1e75,0x0075,0x0330,0x0055,0x032d,0x1e77,0x0075,0x032d,0x0055,0x0303,
+    0x0301,0x1e79,0x0075,0x0303,0x0301,0x0055,0x0304,0x0308,0x1e7b,0x0075,0x0304,0x0308,0x0056,0x0303,0x1e7d,0x0076,
+    0x0303,0x0056,0x0323,0x1e7f,0x0076,0x0323,0x0057,0x0300,0x1e81,0x0077,0x0300,0x0057,0x0301,0x1e83,0x0077,0x0301,
+    0x0057,0x0308,0x1e85,0x0077,0x0308,0x0057,0x0307,0x1e87,0x0077,0x0307,0x0057,0x0323,0x1e89,0x0077,0x0323,0x0058,
+    0x0307,0x1e8b,0x0078,0x0307,0x0058,0x0308,0x1e8d,0x0078,0x0308,0x0059,0x0307,0x1e8f,0x0079,0x0307,0x005a,0x0302,
+    0x1e91,0x007a,0x0302,0x005a,0x0323,0x1e93,0x007a,0x0323,0x005a,0x0331,0x1e95,0x007a,0x0331,0x0068,0x0331,0x0068,
+    0x0331,0x0074,0x0308,0x0074,0x0308,0x0077,0x030a,0x0077,0x030a,0x0079,0x030a,0x0079,0x030a,0x0061,0x02be,0x017f,
+    0x0307,0x1e61,0x0073,0x0073,0x0041,0x0323,0x1ea1,0x0061,0x0323,0x0041,0x0309,0x1ea3,0x0061,0x0309,0x0041,0x0302,
+    0x0301,0x1ea5,0x0061,0x0302,0x0301,0x0041,0x0302,0x0300,0x1ea7,0x0061,0x0302,0x0300,0x0041,0x0302,0x0309,0x1ea9,
+    0x0061,0x0302,0x0309,0x0041,0x0302,0x0303,0x1eab,0x0061,0x0302,0x0303,0x0041,0x0323,0x0302,0x1ead,0x0061,0x0323,
+    0x0302,0x0041,0x0306,0x0301,0x1eaf,0x0061,0x0306,0x0301,0x0041,0x0306,0x0300,0x1eb1,0x0061,0x0306,0x0300,0x0041,
+    0x0306,0x0309,0x1eb3,0x0061,0x0306,0x0309,0x0041,0x0306,0x0303,0x1eb5,0x0061,0x0306,0x0303,0x0041,0x0323,0x0306,
+    0x1eb7,0x0061,0x0323,0x0306,0x0045,0x0323,0x1eb9,0x0065,0x0323,0x0045,0x0309,0x1ebb,0x0065,0x0309,0x0045,0x0303,
+    0x1ebd,0x0065,0x0303,0x0045,0x0302,0x0301,0x1ebf,0x0065,0x0302,0x0301,0x0045,0x0302,0x0300,0x1ec1,0x0065,0x0302,
+    0x0300,0x0045,0x0302,0x0309,0x1ec3,0x0065,0x0302,0x0309,0x0045,0x0302,0x0303,0x1ec5,0x0065,0x0302,0x0303,0x0045,
+    0x0323,0x0302,0x1ec7,0x0065,0x0323,0x0302,0x0049,0x0309,0x1ec9,0x0069,0x0309,0x0049,0x0323,0x1ecb,0x0069,0x0323,
+    0x004f,0x0323,0x1ecd,0x006f,0x0323,0x004f,0x0309,0x1ecf,0x006f,0x0309,0x004f,0x0302,0x0301,0x1ed1,0x006f,0x0302,
+    0x0301,0x004f,0x0302,0x0300,0x1ed3,0x006f,0x0302,0x0300,0x004f,0x0302,0x0309,0x1ed5,0x006f,0x0302,0x0309,0x004f,
+    0x0302,0x0303,0x1ed7,0x006f,0x0302,0x0303,0x004f,0x0323,0x0302,0x1ed9,0x006f,0x0323,0x0302,0x004f,0x031b,0x0301,
+    0x1edb,0x006f,0x031b,0x0301,0x004f,0x031b,0x0300,0x1edd,0x006f,0x031b,0x0300,0x004f,0x031b,0x0309,0x1edf,0x006f,
+    0x031b,0x0309,0x004f,0x031b,0x0303,0x1ee1,0x006f,0x031b,0x0303,0x004f,0x031b,0x0323,0x1ee3,0x006f,0x031b,0x0323,
+    0x0055,0x0323,0x1ee5,0x0075,0x0323,0x0055,0x0309,0x1ee7,0x0075,0x0309,0x0055,0x031b,0x0301,0x1ee9,0x0075,0x031b,
+    0x0301,0x0055,0x031b,0x0300,0x1eeb,0x0075,0x031b,0x0300,0x0055,0x031b,0x0309,0x1eed,0x0075,0x031b,0x0309,0x0055,
+    0x031b,0x0303,0x1eef,0x0075,0x031b,0x0303,0x0055,0x031b,0x0323,0x1ef1,0x0075,0x031b,0x0323,0x0059,0x0300,0x1ef3,
+    0x0079,0x0300,0x0059,0x0323,0x1ef5,0x0079,0x0323,0x0059,0x0309,0x1ef7,0x0079,0x0309,0x0059,0x0303,0x1ef9,0x0079,
+    0x0303,0x1efb,0x1efd,0x1eff,0x03b1,0x0313,0x03b1,0x0314,0x03b1,0x0313,0x0300,0x03b1,0x0314,0x0300,0x03b1,0x0313,
+    0x0301,0x03b1,0x0314,0x0301,0x03b1,0x0313,0x0342,0x03b1,0x0314,0x0342,0x0391,0x0313,0x1f00,0x0391,0x0314,0x1f01,
+    0x0391,0x0313,0x0300,0x1f02,0x0391,0x0314,0x0300,0x1f03,0x0391,0x0313,0x0301,0x1f04,0x0391,0x0314,0x0301,0x1f05,
+    0x0391,0x0313,0x0342,0x1f06,0x0391,0x0314,0x0342,0x1f07,0x03b5,0x0313,0x03b5,0x0314,0x03b5,0x0313,0x0300,0x03b5,
+    0x0314,0x0300,0x03b5,0x0313,0x0301,0x03b5,0x0314,0x0301,0x0395,0x0313,0x1f10,0x0395,0x0314,0x1f11,0x0395,0x0313,
+    0x0300,0x1f12,0x0395,0x0314,0x0300,0x1f13,0x0395,0x0313,0x0301,0x1f14,0x0395,0x0314,0x0301,0x1f15,0x03b7,0x0313,
+    0x03b7,0x0314,0x03b7,0x0313,0x0300,0x03b7,0x0314,0x0300,0x03b7,0x0313,0x0301,0x03b7,0x0314,0x0301,0x03b7,0x0313,
+    0x0342,0x03b7,0x0314,0x0342,0x0397,0x0313,0x1f20,0x0397,0x0314,0x1f21,0x0397,0x0313,0x0300,0x1f22,0x0397,0x0314,
+    0x0300,0x1f23,0x0397,0x0313,0x0301,0x1f24,0x0397,0x0314,0x0301,0x1f25,0x0397,0x0313,0x0342,0x1f26,0x0397,0x0314,
+    0x0342,0x1f27,0x03b9,0x0313,0x03b9,0x0314,0x03b9,0x0313,0x0300,0x03b9,0x0314,0x0300,0x03b9,0x0313,0x0301,0x03b9,
+    0x0314,0x0301,0x03b9,0x0313,0x0342,0x03b9,0x0314,0x0342,0x0399,0x0313,0x1f30,0x0399,0x0314,0x1f31,0x0399,0x0313,
+    0x0300,0x1f32,0x0399,0x0314,0x0300,0x1f33,0x0399,0x0313,0x0301,0x1f34,0x0399,0x0314,0x0301,0x1f35,0x0399,0x0313,
+    0x0342,0x1f36,0x0399,0x0314,0x0342,0x1f37,0x03bf,0x0313,0x03bf,0x0314,0x03bf,0x0313,0x0300,0x03bf,0x0314,0x0300,
+    0x03bf,0x0313,0x0301,0x03bf,0x0314,0x0301,0x039f,0x0313,0x1f40,0x039f,0x0314,0x1f41,0x039f,0x0313,0x0300,0x1f42,
+    0x039f,0x0314,0x0300,0x1f43,0x039f,0x0313,0x0301,0x1f44,0x039f,0x0314,0x0301,0x1f45,0x03c5,0x0313,0x03c5,0x0313,
+    0x03c5,0x0314,0x03c5,0x0313,0x0300,0x03c5,0x0313,0x0300,0x03c5,0x0314,0x0300,0x03c5,0x0313,0x0301,0x03c5,0x0313,
+    0x0301,0x03c5,0x0314,0x0301,0x03c5,0x0313,0x0342,0x03c5,0x0313,0x0342,0x03c5,0x0314,0x0342,0x03a5,0x0314,0x1f51,
+    0x03a5,0x0314,0x0300,0x1f53,0x03a5,0x0314,0x0301,0x1f55,0x03a5,0x0314,0x0342,0x1f57,0x03c9,0x0313,0x03c9,0x0314,
+    0x03c9,0x0313,0x0300,0x03c9,0x0314,0x0300,0x03c9,0x0313,0x0301,0x03c9,0x0314,0x0301,0x03c9,0x0313,0x0342,0x03c9,
+    0x0314,0x0342,0x03a9,0x0313,0x1f60,0x03a9,0x0314,0x1f61,0x03a9,0x0313,0x0300,0x1f62,0x03a9,0x0314,0x0300,0x1f63,
+    0x03a9,0x0313,0x0301,0x1f64,0x03a9,0x0314,0x0301,0x1f65,0x03a9,0x0313,0x0342,0x1f66,0x03a9,0x0314,0x0342,0x1f67,
+    0x03b1,0x0300,0x03b1,0x0301,0x03b5,0x0300,0x03b5,0x0301,0x03b7,0x0300,0x03b7,0x0301,0x03b9,0x0300,0x03b9,0x0301,
+    0x03bf,0x0300,0x03bf,0x0301,0x03c5,0x0300,0x03c5,0x0301,0x03c9,0x0300,0x03c9,0x0301,0x03b1,0x0313,0x0345,0x1f00,
+    0x03b9,0x03b1,0x0314,0x0345,0x1f01,0x03b9,0x03b1,0x0313,0x0300,0x0345,0x1f02,0x03b9,0x03b1,0x0314,0x0300,0x0345,
+    0x1f03,0x03b9,0x03b1,0x0313,0x0301,0x0345,0x1f04,0x03b9,0x03b1,0x0314,0x0301,0x0345,0x1f05,0x03b9,0x03b1,0x0313,
+    0x0342,0x0345,0x1f06,0x03b9,0x03b1,0x0314,0x0342,0x0345,0x1f07,0x03b9,0x0391,0x0313,0x0345,0x1f00,0x03b9,0x0391,
+    0x0314,0x0345,0x1f01,0x03b9,0x0391,0x0313,0x0300,0x0345,0x1f02,0x03b9,0x0391,0x0314,0x0300,0x0345,0x1f03,0x03b9,
+    0x0391,0x0313,0x0301,0x0345,0x1f04,0x03b9,0x0391,0x0314,0x0301,0x0345,0x1f05,0x03b9,0x0391,0x0313,0x0342,0x0345,
+    0x1f06,0x03b9,0x0391,0x0314,0x0342,0x0345,0x1f07,0x03b9,0x03b7,0x0313,0x0345,0x1f20,0x03b9,0x03b7,0x0314,0x0345,
+    0x1f21,0x03b9,0x03b7,0x0313,0x0300,0x0345,0x1f22,0x03b9,0x03b7,0x0314,0x0300,0x0345,0x1f23,0x03b9,0x03b7,0x0313,
+    0x0301,0x0345,0x1f24,0x03b9,0x03b7,0x0314,0x0301,0x0345,0x1f25,0x03b9,0x03b7,0x0313,0x0342,0x0345,0x1f26,0x03b9,
+    0x03b7,0x0314,0x0342,0x0345,0x1f27,0x03b9,0x0397,0x0313,0x0345,0x1f20,0x03b9,0x0397,0x0314,0x0345,0x1f21,0x03b9,
+    0x0397,0x0313,0x0300,0x0345,0x1f22,0x03b9,0x0397,0x0314,0x0300,0x0345,0x1f23,0x03b9,0x0397,0x0313,0x0301,0x0345,
+    0x1f24,0x03b9,0x0397,0x0314,0x0301,0x0345,0x1f25,0x03b9,0x0397,0x0313,0x0342,0x0345,0x1f26,0x03b9,0x0397,0x0314,
+    0x0342,0x0345,0x1f27,0x03b9,0x03c9,0x0313,0x0345,0x1f60,0x03b9,0x03c9,0x0314,0x0345,0x1f61,0x03b9,0x03c9,0x0313,
+    0x0300,0x0345,0x1f62,0x03b9,0x03c9,0x0314,0x0300,0x0345,0x1f63,0x03b9,0x03c9,0x0313,0x0301,0x0345,0x1f64,0x03b9,
+    0x03c9,0x0314,0x0301,0x0345,0x1f65,0x03b9,0x03c9,0x0313,0x0342,0x0345,0x1f66,0x03b9,0x03c9,0x0314,0x0342,0x0345,
+    0x1f67,0x03b9,0x03a9,0x0313,0x0345,0x1f60,0x03b9,0x03a9,0x0314,0x0345,0x1f61,0x03b9,0x03a9,0x0313,0x0300,0x0345,
+    0x1f62,0x03b9,0x03a9,0x0314,0x0300,0x0345,0x1f63,0x03b9,0x03a9,0x0313,0x0301,0x0345,0x1f64,0x03b9,0x03a9,0x0314,
+    0x0301,0x0345,0x1f65,0x03b9,0x03a9,0x0313,0x0342,0x0345,0x1f66,0x03b9,0x03a9,0x0314,0x0342,0x0345,0x1f67,0x03b9,
+    0x03b1,0x0306,0x03b1,0x0304,0x03b1,0x0300,0x0345,0x1f70,0x03b9,0x03b1,0x0345,0x03b1,0x03b9,0x03b1,0x0301,0x0345,
+    0x03ac,0x03b9,0x03b1,0x0342,0x03b1,0x0342,0x03b1,0x0342,0x0345,0x03b1,0x0342,0x03b9,0x0391,0x0306,0x1fb0,0x0391,
+    0x0304,0x1fb1,0x0391,0x0300,0x1f70,0x0391,0x0301,0x1f71,0x0391,0x0345,0x03b1,0x03b9,0x03b9,0x03b9,0x00a8,0x0342,
+    0x03b7,0x0300,0x0345,0x1f74,0x03b9,0x03b7,0x0345,0x03b7,0x03b9,0x03b7,0x0301,0x0345,0x03ae,0x03b9,0x03b7,0x0342,
+    0x03b7,0x0342,0x03b7,0x0342,0x0345,0x03b7,0x0342,0x03b9,0x0395,0x0300,0x1f72,0x0395,0x0301,0x1f73,0x0397,0x0300,
+    0x1f74,0x0397,0x0301,0x1f75,0x0397,0x0345,0x03b7,0x03b9,0x1fbf,0x0300,0x1fbf,0x0301,0x1fbf,0x0342,0x03b9,0x0306,
+    0x03b9,0x0304,0x03b9,0x0308,0x0300,0x03b9,0x0308,0x0300,0x03b9,0x0308,0x0301,0x03b9,0x0308,0x0301,0x03b9,0x0342,
+    0x03b9,0x0342,0x03b9,0x0308,0x0342,0x03b9,0x0308,0x0342,0x0399,0x0306,0x1fd0,0x0399,0x0304,0x1fd1,0x0399,0x0300,
+    0x1f76,0x0399,0x0301,0x1f77,0x1ffe,0x0300,0x1ffe,0x0301,0x1ffe,0x0342,0x03c5,0x0306,0x03c5,0x0304,0x03c5,0x0308,
+    0x0300,0x03c5,0x0308,0x0300,0x03c5,0x0308,0x0301,0x03c5,0x0308,0x0301,0x03c1,0x0313,0x03c1,0x0313,0x03c1,0x0314,
+    0x03c5,0x0342,0x03c5,0x0342,0x03c5,0x0308,0x0342,0x03c5,0x0308,0x0342,0x03a5,0x0306,0x1fe0,0x03a5,0x0304,0x1fe1,
+    0x03a5,0x0300,0x1f7a,0x03a5,0x0301,0x1f7b,0x03a1,0x0314,0x1fe5,0x00a8,0x0300,0x00a8,0x0301,0x0060,0x03c9,0x0300,
+    0x0345,0x1f7c,0x03b9,0x03c9,0x0345,0x03c9,0x03b9,0x03c9,0x0301,0x0345,0x03ce,0x03b9,0x03c9,0x0342,0x03c9,0x0342,
+    0x03c9,0x0342,0x0345,0x03c9,0x0342,0x03b9,0x039f,0x0300,0x1f78,0x039f,0x0301,0x1f79,0x03a9,0x0300,0x1f7c,0x03a9,
+    0x0301,0x1f7d,0x03a9,0x0345,0x03c9,0x03b9,0x00b4,0x2002,0x2003,0x03a9,0x03c9,0x004b,0x006b,0x0041,0x030a,0x00e5,
+    0x214e,0x2170,0x2171,0x2172,0x2173,0x2174,0x2175,0x2176,0x2177,0x2178,0x2179,0x217a,0x217b,0x217c,0x217d,0x217e,
+    0x217f,0x2184,0x2190,0x0338,0x2192,0x0338,0x2194,0x0338,0x21d0,0x0338,0x21d4,0x0338,0x21d2,0x0338,0x2203,0x0338,
+    0x2208,0x0338,0x220b,0x0338,0x2223,0x0338,0x2225,0x0338,0x223c,0x0338,0x2243,0x0338,0x2245,0x0338,0x2248,0x0338,
+    0x003d,0x0338,0x2261,0x0338,0x224d,0x0338,0x003c,0x0338,0x003e,0x0338,0x2264,0x0338,0x2265,0x0338,0x2272,0x0338,
+    0x2273,0x0338,0x2276,0x0338,0x2277,0x0338,0x227a,0x0338,0x227b,0x0338,0x2282,0x0338,0x2283,0x0338,0x2286,0x0338,
+    0x2287,0x0338,0x22a2,0x0338,0x22a8,0x0338,0x22a9,0x0338,0x22ab,0x0338,0x227c,0x0338,0x227d,0x0338,0x2291,0x0338,
+    0x2292,0x0338,0x22b2,0x0338,0x22b3,0x0338,0x22b4,0x0338,0x22b5,0x0338,0x3008,0x3009,0x24d0,0x24d1,0x24d2,0x24d3,
+    0x24d4,0x24d5,0x24d6,0x24d7,0x24d8,0x24d9,0x24da,0x24db,0x24dc,0x24dd,0x24de,0x24df,0x24e0,0x24e1,0x24e2,0x24e3,
+    0x24e4,0x24e5,0x24e6,0x24e7,0x24e8,0x24e9,0x2add,0x0338,0x2c30,0x2c31,0x2c32,0x2c33,0x2c34,0x2c35,0x2c36,0x2c37,
+    0x2c38,0x2c39,0x2c3a,0x2c3b,0x2c3c,0x2c3d,0x2c3e,0x2c3f,0x2c40,0x2c41,0x2c42,0x2c43,0x2c44,0x2c45,0x2c46,0x2c47,
+    0x2c48,0x2c49,0x2c4a,0x2c4b,0x2c4c,0x2c4d,0x2c4e,0x2c4f,0x2c50,0x2c51,0x2c52,0x2c53,0x2c54,0x2c55,0x2c56,0x2c57,
+    0x2c58,0x2c59,0x2c5a,0x2c5b,0x2c5c,0x2c5d,0x2c5e,0x2c5f,0x2c61,0x026b,0x1d7d,0x027d,0x2c68,0x2c6a,0x2c6c,0x0251,
+    0x0271,0x0250,0x0252,0x2c73,0x2c76,0x023f,0x0240,0x2c81,0x2c83,0x2c85,0x2c87,0x2c89,0x2c8b,0x2c8d,0x2c8f,0x2c91,
+    0x2c93,0x2c95,0x2c97,0x2c99,0x2c9b,0x2c9d,0x2c9f,0x2ca1,0x2ca3,0x2ca5,0x2ca7,0x2ca9,0x2cab,0x2cad,0x2caf,0x2cb1,
+    0x2cb3,0x2cb5,0x2cb7,0x2cb9,0x2cbb,0x2cbd,0x2cbf,0x2cc1,0x2cc3,0x2cc5,0x2cc7,0x2cc9,0x2ccb,0x2ccd,0x2ccf,0x2cd1,
+    0x2cd3,0x2cd5,0x2cd7,0x2cd9,0x2cdb,0x2cdd,0x2cdf,0x2ce1,0x2ce3,0x2cec,0x2cee,0x2cf3,0x304b,0x3099,0x304d,0x3099,
+    0x304f,0x3099,0x3051,0x3099,0x3053,0x3099,0x3055,0x3099,0x3057,0x3099,0x3059,0x3099,0x305b,0x3099,0x305d,0x3099,
+    0x305f,0x3099,0x3061,0x3099,0x3064,0x3099,0x3066,0x3099,0x3068,0x3099,0x306f,0x3099,0x306f,0x309a,0x3072,0x3099,
+    0x3072,0x309a,0x3075,0x3099,0x3075,0x309a,0x3078,0x3099,0x3078,0x309a,0x307b,0x3099,0x307b,0x309a,0x3046,0x3099,
+    0x309d,0x3099,0x30ab,0x3099,0x30ad,0x3099,0x30af,0x3099,0x30b1,0x3099,0x30b3,0x3099,0x30b5,0x3099,0x30b7,0x3099,
+    0x30b9,0x3099,0x30bb,0x3099,0x30bd,0x3099,0x30bf,0x3099,0x30c1,0x3099,0x30c4,0x3099,0x30c6,0x3099,0x30c8,0x3099,
+    0x30cf,0x3099,0x30cf,0x309a,0x30d2,0x3099,0x30d2,0x309a,0x30d5,0x3099,0x30d5,0x309a,0x30d8,0x3099,0x30d8,0x309a,
+    0x30db,0x3099,0x30db,0x309a,0x30a6,0x3099,0x30ef,0x3099,0x30f0,0x3099,0x30f1,0x3099,0x30f2,0x3099,0x30fd,0x3099,
+    0xa641,0xa643,0xa645,0xa647,0xa649,0xa64b,0xa64d,0xa64f,0xa651,0xa653,0xa655,0xa657,0xa659,0xa65b,0xa65d,0xa65f,
+    0xa661,0xa663,0xa665,0xa667,0xa669,0xa66b,0xa66d,0xa681,0xa683,0xa685,0xa687,0xa689,0xa68b,0xa68d,0xa68f,0xa691,
+    0xa693,0xa695,0xa697,0xa699,0xa69b,0xa723,0xa725,0xa727,0xa729,0xa72b,0xa72d,0xa72f,0xa733,0xa735,0xa737,0xa739,
+    0xa73b,0xa73d,0xa73f,0xa741,0xa743,0xa745,0xa747,0xa749,0xa74b,0xa74d,0xa74f,0xa751,0xa753,0xa755,0xa757,0xa759,
+    0xa75b,0xa75d,0xa75f,0xa761,0xa763,0xa765,0xa767,0xa769,0xa76b,0xa76d,0xa76f,0xa77a,0xa77c,0x1d79,0xa77f,0xa781,
+    0xa783,0xa785,0xa787,0xa78c,0x0265,0xa791,0xa793,0xa797,0xa799,0xa79b,0xa79d,0xa79f,0xa7a1,0xa7a3,0xa7a5,0xa7a7,
+    0xa7a9,0x0266,0x025c,0x0261,0x026c,0x026a,0x029e,0x0287,0x029d,0xab53,0xa7b5,0xa7b7,0xa7b9,0xa7bb,0xa7bd,0xa7bf,
+    0xa7c1,0xa7c3,0xa794,0x0282,0x1d8e,0xa7c8,0xa7ca,0xa7d1,0xa7d7,0xa7d9,0xa7f6,0x13a0,0x13a1,0x13a2,0x13a3,0x13a4,
+    0x13a5,0x13a6,0x13a7,0x13a8,0x13a9,0x13aa,0x13ab,0x13ac,0x13ad,0x13ae,0x13af,0x13b0,0x13b1,0x13b2,0x13b3,0x13b4,
+    0x13b5,0x13b6,0x13b7,0x13b8,0x13b9,0x13ba,0x13bb,0x13bc,0x13bd,0x13be,0x13bf,0x13c0,0x13c1,0x13c2,0x13c3,0x13c4,
+    0x13c5,0x13c6,0x13c7,0x13c8,0x13c9,0x13ca,0x13cb,0x13cc,0x13cd,0x13ce,0x13cf,0x13d0,0x13d1,0x13d2,0x13d3,0x13d4,
+    0x13d5,0x13d6,0x13d7,0x13d8,0x13d9,0x13da,0x13db,0x13dc,0x13dd,0x13de,0x13df,0x13e0,0x13e1,0x13e2,0x13e3,0x13e4,
+    0x13e5,0x13e6,0x13e7,0x13e8,0x13e9,0x13ea,0x13eb,0x13ec,0x13ed,0x13ee,0x13ef,0x8c48,0x66f4,0x8eca,0x8cc8,0x6ed1,
+    0x4e32,0x53e5,0x9f9c,0x9f9c,0x5951,0x91d1,0x5587,0x5948,0x61f6,0x7669,0x7f85,0x863f,0x87ba,0x88f8,0x908f,0x6a02,
+    0x6d1b,0x70d9,0x73de,0x843d,0x916a,0x99f1,0x4e82,0x5375,0x6b04,0x721b,0x862d,0x9e1e,0x5d50,0x6feb,0x85cd,0x8964,
+    0x62c9,0x81d8,0x881f,0x5eca,0x6717,0x6d6a,0x72fc,0x90ce,0x4f86,0x51b7,0x52de,0x64c4,0x6ad3,0x7210,0x76e7,0x8001,
+    0x8606,0x865c,0x8def,0x9732,0x9b6f,0x9dfa,0x788c,0x797f,0x7da0,0x83c9,0x9304,0x9e7f,0x8ad6,0x58df,0x5f04,0x7c60,
+    0x807e,0x7262,0x78ca,0x8cc2,0x96f7,0x58d8,0x5c62,0x6a13,0x6dda,0x6f0f,0x7d2f,0x7e37,0x964b,0x52d2,0x808b,0x51dc,
+    0x51cc,0x7a1c,0x7dbe,0x83f1,0x9675,0x8b80,0x62cf,0x6a02,0x8afe,0x4e39,0x5be7,0x6012,0x7387,0x7570,0x5317,0x78fb,
+    0x4fbf,0x5fa9,0x4e0d,0x6ccc,0x6578,0x7d22,0x53c3,0x585e,0x7701,0x8449,0x8aaa,0x6bba,0x8fb0,0x6c88,0x62fe,0x82e5,
+    0x63a0,0x7565,0x4eae,0x5169,0x51c9,0x6881,0x7ce7,0x826f,0x8ad2,0x91cf,0x52f5,0x5442,0x5973,0x5eec,0x65c5,0x6ffe,
+    0x792a,0x95ad,0x9a6a,0x9e97,0x9ece,0x529b,0x66c6,0x6b77,0x8f62,0x5e74,0x6190,0x6200,0x649a,0x6f23,0x7149,0x7489,
+    0x79ca,0x7df4,0x806f,0x8f26,0x84ee,0x9023,0x934a,0x5217,0x52a3,0x54bd,0x70c8,0x88c2,0x8aaa,0x5ec9,0x5ff5,0x637b,
+    0x6bae,0x7c3e,0x7375,0x4ee4,0x56f9,0x5be7,0x5dba,0x601c,0x73b2,0x7469,0x7f9a,0x8046,0x9234,0x96f6,0x9748,0x9818,
+    0x4f8b,0x79ae,0x91b4,0x96b8,0x60e1,0x4e86,0x50da,0x5bee,0x5c3f,0x6599,0x6a02,0x71ce,0x7642,0x84fc,0x907c,0x9f8d,
+    0x6688,0x962e,0x5289,0x677b,0x67f3,0x6d41,0x6e9c,0x7409,0x7559,0x786b,0x7d10,0x985e,0x516d,0x622e,0x9678,0x502b,
+    0x5d19,0x6dea,0x8f2a,0x5f8b,0x6144,0x6817,0x7387,0x9686,0x5229,0x540f,0x5c65,0x6613,0x674e,0x68a8,0x6ce5,0x7406,
+    0x75e2,0x7f79,0x88cf,0x88e1,0x91cc,0x96e2,0x533f,0x6eba,0x541d,0x71d0,0x7498,0x85fa,0x96a3,0x9c57,0x9e9f,0x6797,
+    0x6dcb,0x81e8,0x7acb,0x7b20,0x7c92,0x72c0,0x7099,0x8b58,0x4ec0,0x8336,0x523a,0x5207,0x5ea6,0x62d3,0x7cd6,0x5b85,
+    0x6d1e,0x66b4,0x8f3b,0x884c,0x964d,0x898b,0x5ed3,0x5140,0x55c0,0x585a,0x6674,0x51de,0x732a,0x76ca,0x793c,0x795e,
+    0x7965,0x798f,0x9756,0x7cbe,0x7fbd,0x8612,0x8af8,0x9038,0x90fd,0x98ef,0x98fc,0x9928,0x9db4,0x90de,0x96b7,0x4fae,
+    0x50e7,0x514d,0x52c9,0x52e4,0x5351,0x559d,0x5606,0x5668,0x5840,0x58a8,0x5c64,0x5c6e,0x6094,0x6168,0x618e,0x61f2,
+    0x654f,0x65e2,0x6691,0x6885,0x6d77,0x6e1a,0x6f22,0x716e,0x722b,0x7422,0x7891,0x793e,0x7949,0x7948,0x7950,0x7956,
+    0x795d,0x798d,0x798e,0x7a40,0x7a81,0x7bc0,0x7df4,0x7e09,0x7e41,0x7f72,0x8005,0x81ed,0x8279,0x8279,0x8457,0x8910,
+    0x8996,0x8b01,0x8b39,0x8cd3,0x8d08,0x8fb6,0x9038,0x96e3,0x97ff,0x983b,0x6075,0x242ee,0x8218,0x4e26,0x51b5,0x5168,
+    0x4f80,0x5145,0x5180,0x52c7,0x52fa,0x559d,0x5555,0x5599,0x55e2,0x585a,0x58b3,0x5944,0x5954,0x5a62,0x5b28,0x5ed2,
+    0x5ed9,0x5f69,0x5fad,0x60d8,0x614e,0x6108,0x618e,0x6160,0x61f2,0x6234,0x63c4,0x641c,0x6452,0x6556,0x6674,0x6717,
+    0x671b,0x6756,0x6b79,0x6bba,0x6d41,0x6edb,0x6ecb,0x6f22,0x701e,0x716e,0x77a7,0x7235,0x72af,0x732a,0x7471,0x7506,
+    0x753b,0x761d,0x761f,0x76ca,0x76db,0x76f4,0x774a,0x7740,0x78cc,0x7ab1,0x7bc0,0x7c7b,0x7d5b,0x7df4,0x7f3e,0x8005,
+    0x8352,0x83ef,0x8779,0x8941,0x8986,0x8996,0x8abf,0x8af8,0x8acb,0x8b01,0x8afe,0x8aed,0x8b39,0x8b8a,0x8d08,0x8f38,
+    0x9072,0x9199,0x9276,0x967c,0x96e3,0x9756,0x97db,0x97ff,0x980b,0x983b,0x9b12,0x9f9c,0x2284a,0x22844,0x233d5,0x3b9d,
+    0x4018,0x4039,0x25249,0x25cd0,0x27ed3,0x9f43,0x9f8e,0x0066,0x0066,0x0066,0x0069,0x0066,0x006c,0x0066,0x0066,0x0069,
+    0x0066,0x0066,0x006c,0x0073,0x0074,0x0073,0x0074,0x0574,0x0576,0x0574,0x0565,0x0574,0x056b,0x057e,0x0576,0x0574,
+    0x056d,0x05d9,0x05b4,0x05f2,0x05b7,0x05e9,0x05c1,0x05e9,0x05c2,0x05e9,0x05bc,0x05c1,0x05e9,0x05bc,0x05c2,0x05d0,
+    0x05b7,0x05d0,0x05b8,0x05d0,0x05bc,0x05d1,0x05bc,0x05d2,0x05bc,0x05d3,0x05bc,0x05d4,0x05bc,0x05d5,0x05bc,0x05d6,
+    0x05bc,0x05d8,0x05bc,0x05d9,0x05bc,0x05da,0x05bc,0x05db,0x05bc,0x05dc,0x05bc,0x05de,0x05bc,0x05e0,0x05bc,0x05e1,
+    0x05bc,0x05e3,0x05bc,0x05e4,0x05bc,0x05e6,0x05bc,0x05e7,0x05bc,0x05e8,0x05bc,0x05e9,0x05bc,0x05ea,0x05bc,0x05d5,
+    0x05b9,0x05d1,0x05bf,0x05db,0x05bf,0x05e4,0x05bf,0xff41,0xff42,0xff43,0xff44,0xff45,0xff46,0xff47,0xff48,0xff49,
+    0xff4a,0xff4b,0xff4c,0xff4d,0xff4e,0xff4f,0xff50,0xff51,0xff52,0xff53,0xff54,0xff55,0xff56,0xff57,0xff58,0xff59,
+    0xff5a,0x10428,0x10429,0x1042a,0x1042b,0x1042c,0x1042d,0x1042e,0x1042f,0x10430,0x10431,0x10432,0x10433,0x10434,0x10435,0x10436,
+    0x10437,0x10438,0x10439,0x1043a,0x1043b,0x1043c,0x1043d,0x1043e,0x1043f,0x10440,0x10441,0x10442,0x10443,0x10444,0x10445,0x10446,
+    0x10447,0x10448,0x10449,0x1044a,0x1044b,0x1044c,0x1044d,0x1044e,0x1044f,0x104d8,0x104d9,0x104da,0x104db,0x104dc,0x104dd,0x104de,
+    0x104df,0x104e0,0x104e1,0x104e2,0x104e3,0x104e4,0x104e5,0x104e6,0x104e7,0x104e8,0x104e9,0x104ea,0x104eb,0x104ec,0x104ed,0x104ee,
+    0x104ef,0x104f0,0x104f1,0x104f2,0x104f3,0x104f4,0x104f5,0x104f6,0x104f7,0x104f8,0x104f9,0x104fa,0x104fb,0x10597,0x10598,0x10599,
+    0x1059a,0x1059b,0x1059c,0x1059d,0x1059e,0x1059f,0x105a0,0x105a1,0x105a3,0x105a4,0x105a5,0x105a6,0x105a7,0x105a8,0x105a9,0x105aa,
+    0x105ab,0x105ac,0x105ad,0x105ae,0x105af,0x105b0,0x105b1,0x105b3,0x105b4,0x105b5,0x105b6,0x105b7,0x105b8,0x105b9,0x105bb,0x105bc,
+    0x10cc0,0x10cc1,0x10cc2,0x10cc3,0x10cc4,0x10cc5,0x10cc6,0x10cc7,0x10cc8,0x10cc9,0x10cca,0x10ccb,0x10ccc,0x10ccd,0x10cce,0x10ccf,
+    0x10cd0,0x10cd1,0x10cd2,0x10cd3,0x10cd4,0x10cd5,0x10cd6,0x10cd7,0x10cd8,0x10cd9,0x10cda,0x10cdb,0x10cdc,0x10cdd,0x10cde,0x10cdf,
+    0x10ce0,0x10ce1,0x10ce2,0x10ce3,0x10ce4,0x10ce5,0x10ce6,0x10ce7,0x10ce8,0x10ce9,0x10cea,0x10ceb,0x10cec,0x10ced,0x10cee,0x10cef,
+    0x10cf0,0x10cf1,0x10cf2,0x11099,0x110ba,0x1109b,0x110ba,0x110a5,0x110ba,0x11131,0x11127,0x11132,0x11127,0x11347,0x1133e,0x11347,
+    0x11357,0x114b9,0x114ba,0x114b9,0x114b0,0x114b9,0x114bd,0x115b8,0x115af,0x115b9,0x115af,0x118c0,0x118c1,0x118c2,0x118c3,0x118c4,
+    0x118c5,0x118c6,0x118c7,0x118c8,0x118c9,0x118ca,0x118cb,0x118cc,0x118cd,0x118ce,0x118cf,0x118d0,0x118d1,0x118d2,0x118d3,0x118d4,
+    0x118d5,0x118d6,0x118d7,0x118d8,0x118d9,0x118da,0x118db,0x118dc,0x118dd,0x118de,0x118df,0x11935,0x11930,0x16e60,0x16e61,0x16e62,
+    0x16e63,0x16e64,0x16e65,0x16e66,0x16e67,0x16e68,0x16e69,0x16e6a,0x16e6b,0x16e6c,0x16e6d,0x16e6e,0x16e6f,0x16e70,0x16e71,0x16e72,
+    0x16e73,0x16e74,0x16e75,0x16e76,0x16e77,0x16e78,0x16e79,0x16e7a,0x16e7b,0x16e7c,0x16e7d,0x16e7e,0x16e7f,0x1d157,0x1d165,0x1d158,
+    0x1d165,0x1d158,0x1d165,0x1d16e,0x1d158,0x1d165,0x1d16f,0x1d158,0x1d165,0x1d170,0x1d158,0x1d165,0x1d171,0x1d158,0x1d165,0x1d172,
+    0x1d1b9,0x1d165,0x1d1ba,0x1d165,0x1d1b9,0x1d165,0x1d16e,0x1d1ba,0x1d165,0x1d16e,0x1d1b9,0x1d165,0x1d16f,0x1d1ba,0x1d165,0x1d16f,
+    0x1e922,0x1e923,0x1e924,0x1e925,0x1e926,0x1e927,0x1e928,0x1e929,0x1e92a,0x1e92b,0x1e92c,0x1e92d,0x1e92e,0x1e92f,0x1e930,0x1e931,
+    0x1e932,0x1e933,0x1e934,0x1e935,0x1e936,0x1e937,0x1e938,0x1e939,0x1e93a,0x1e93b,0x1e93c,0x1e93d,0x1e93e,0x1e93f,0x1e940,0x1e941,
+    0x1e942,0x1e943,0x4e3d,0x4e38,0x4e41,0x20122,0x4f60,0x4fae,0x4fbb,0x5002,0x507a,0x5099,0x50e7,0x50cf,0x349e,0x2063a,
+    0x514d,0x5154,0x5164,0x5177,0x2051c,0x34b9,0x5167,0x518d,0x2054b,0x5197,0x51a4,0x4ecc,0x51ac,0x51b5,0x291df,0x51f5,
+    0x5203,0x34df,0x523b,0x5246,0x5272,0x5277,0x3515,0x52c7,0x52c9,0x52e4,0x52fa,0x5305,0x5306,0x5317,0x5349,0x5351,
+    0x535a,0x5373,0x537d,0x537f,0x537f,0x537f,0x20a2c,0x7070,0x53ca,0x53df,0x20b63,0x53eb,0x53f1,0x5406,0x549e,0x5438,
+    0x5448,0x5468,0x54a2,0x54f6,0x5510,0x5553,0x5563,0x5584,0x5584,0x5599,0x55ab,0x55b3,0x55c2,0x5716,0x5606,0x5717,
+    0x5651,0x5674,0x5207,0x58ee,0x57ce,0x57f4,0x580d,0x578b,0x5832,0x5831,0x58ac,0x214e4,0x58f2,0x58f7,0x5906,0x591a,
+    0x5922,0x5962,0x216a8,0x216ea,0x59ec,0x5a1b,0x5a27,0x59d8,0x5a66,0x36ee,0x36fc,0x5b08,0x5b3e,0x5b3e,0x219c8,0x5bc3,
+    0x5bd8,0x5be7,0x5bf3,0x21b18,0x5bff,0x5c06,0x5f53,0x5c22,0x3781,0x5c60,0x5c6e,0x5cc0,0x5c8d,0x21de4,0x5d43,0x21de6,
+    0x5d6e,0x5d6b,0x5d7c,0x5de1,0x5de2,0x382f,0x5dfd,0x5e28,0x5e3d,0x5e69,0x3862,0x22183,0x387c,0x5eb0,0x5eb3,0x5eb6,
+    0x5eca,0x2a392,0x5efe,0x22331,0x22331,0x8201,0x5f22,0x5f22,0x38c7,0x232b8,0x261da,0x5f62,0x5f6b,0x38e3,0x5f9a,0x5fcd,
+    0x5fd7,0x5ff9,0x6081,0x393a,0x391c,0x6094,0x226d4,0x60c7,0x6148,0x614c,0x614e,0x614c,0x617a,0x618e,0x61b2,0x61a4,
+    0x61af,0x61de,0x61f2,0x61f6,0x6210,0x621b,0x625d,0x62b1,0x62d4,0x6350,0x22b0c,0x633d,0x62fc,0x6368,0x6383,0x63e4,
+    0x22bf1,0x6422,0x63c5,0x63a9,0x3a2e,0x6469,0x647e,0x649d,0x6477,0x3a6c,0x654f,0x656c,0x2300a,0x65e3,0x66f8,0x6649,
+    0x3b19,0x6691,0x3b08,0x3ae4,0x5192,0x5195,0x6700,0x669c,0x80ad,0x43d9,0x6717,0x671b,0x6721,0x675e,0x6753,0x233c3,
+    0x3b49,0x67fa,0x6785,0x6852,0x6885,0x2346d,0x688e,0x681f,0x6914,0x3b9d,0x6942,0x69a3,0x69ea,0x6aa8,0x236a3,0x6adb,
+    0x3c18,0x6b21,0x238a7,0x6b54,0x3c4e,0x6b72,0x6b9f,0x6bba,0x6bbb,0x23a8d,0x21d0b,0x23afa,0x6c4e,0x23cbc,0x6cbf,0x6ccd,
+    0x6c67,0x6d16,0x6d3e,0x6d77,0x6d41,0x6d69,0x6d78,0x6d85,0x23d1e,0x6d34,0x6e2f,0x6e6e,0x3d33,0x6ecb,0x6ec7,0x23ed1,
+    0x6df9,0x6f6e,0x23f5e,0x23f8e,0x6fc6,0x7039,0x701e,0x701b,0x3d96,0x704a,0x707d,0x7077,0x70ad,0x20525,0x7145,0x24263,
+    0x719c,0x243ab,0x7228,0x7235,0x7250,0x24608,0x7280,0x7295,0x24735,0x24814,0x737a,0x738b,0x3eac,0x73a5,0x3eb8,0x3eb8,
+    0x7447,0x745c,0x7471,0x7485,0x74ca,0x3f1b,0x7524,0x24c36,0x753e,0x24c92,0x7570,0x2219f,0x7610,0x24fa1,0x24fb8,0x25044,
+    0x3ffc,0x4008,0x76f4,0x250f3,0x250f2,0x25119,0x25133,0x771e,0x771f,0x771f,0x774a,0x4039,0x778b,0x4046,0x4096,0x2541d,
+    0x784e,0x788c,0x78cc,0x40e3,0x25626,0x7956,0x2569a,0x256c5,0x798f,0x79eb,0x412f,0x7a40,0x7a4a,0x7a4f,0x2597c,0x25aa7,
+    0x25aa7,0x7aee,0x4202,0x25bab,0x7bc6,0x7bc9,0x4227,0x25c80,0x7cd2,0x42a0,0x7ce8,0x7ce3,0x7d00,0x25f86,0x7d63,0x4301,
+    0x7dc7,0x7e02,0x7e45,0x4334,0x26228,0x26247,0x4359,0x262d9,0x7f7a,0x2633e,0x7f95,0x7ffa,0x8005,0x264da,0x26523,0x8060,
+    0x265a8,0x8070,0x2335f,0x43d5,0x80b2,0x8103,0x440b,0x813e,0x5ab5,0x267a7,0x267b5,0x23393,0x2339c,0x8201,0x8204,0x8f9e,
+    0x446b,0x8291,0x828b,0x829d,0x52b3,0x82b1,0x82b3,0x82bd,0x82e6,0x26b3c,0x82e5,0x831d,0x8363,0x83ad,0x8323,0x83bd,
+    0x83e7,0x8457,0x8353,0x83ca,0x83cc,0x83dc,0x26c36,0x26d6b,0x26cd5,0x452b,0x84f1,0x84f3,0x8516,0x273ca,0x8564,0x26f2c,
+    0x455d,0x4561,0x26fb1,0x270d2,0x456b,0x8650,0x865c,0x8667,0x8669,0x86a9,0x8688,0x870e,0x86e2,0x8779,0x8728,0x876b,
+    0x8786,0x45d7,0x87e1,0x8801,0x45f9,0x8860,0x8863,0x27667,0x88d7,0x88de,0x4635,0x88fa,0x34bb,0x278ae,0x27966,0x46be,
+    0x46c7,0x8aa0,0x8aed,0x8b8a,0x8c55,0x27ca8,0x8cab,0x8cc1,0x8d1b,0x8d77,0x27f2f,0x20804,0x8dcb,0x8dbc,0x8df0,0x208de,
+    0x8ed4,0x8f38,0x285d2,0x285ed,0x9094,0x90f1,0x9111,0x2872e,0x911b,0x9238,0x92d7,0x92d8,0x927c,0x93f9,0x9415,0x28bfa,
+    0x958b,0x4995,0x95b7,0x28d77,0x49e6,0x96c3,0x5db2,0x9723,0x29145,0x2921a,0x4a6e,0x4a76,0x97e0,0x2940a,0x4ab2,0x29496,
+    0x980b,0x980b,0x9829,0x295b6,0x98e2,0x4b33,0x9929,0x99a7,0x99c2,0x99fe,0x4bce,0x29b30,0x9b12,0x9c40,0x9cfd,0x4cce,
+    0x4ced,0x9d67,0x2a0ce,0x4cf8,0x2a105,0x2a20e,0x2a291,0x9ebb,0x4d56,0x9ef9,0x9efe,0x9f05,0x9f0f,0x9f16,0x9f3b,0x2a600,
+
+};
+
+const Unicode_Norm_Composition UNICODE_NORM_COMPOSITIONS[941] = { //second, composite
+    {0x0338,0x226e}, {0x0338,0x2260}, {0x0338,0x226f}, {0x0300,0x00c0}, {0x0301,0x00c1}, {0x0302,0x00c2}, {0x0303,0x00c3}, {0x0304,0x0100},
+    {0x0306,0x0102}, {0x0307,0x0226}, {0x0308,0x00c4}, {0x0309,0x1ea2}, {0x030a,0x00c5}, {0x030c,0x01cd}, {0x030f,0x0200}, {0x0311,0x0202},
+    {0x0323,0x1ea0}, {0x0325,0x1e00}, {0x0328,0x0104}, {0x0307,0x1e02}, {0x0323,0x1e04}, {0x0331,0x1e06}, {0x0301,0x0106}, {0x0302,0x0108},
+    {0x0307,0x010a}, {0x030c,0x010c}, {0x0327,0x00c7}, {0x0307,0x1e0a}, {0x030c,0x010e}, {0x0323,0x1e0c}, {0x0327,0x1e10}, {0x032d,0x1e12},
+    {0x0331,0x1e0e}, {0x0300,0x00c8}, {0x0301,0x00c9}, {0x0302,0x00ca}, {0x0303,0x1ebc}, {0x0304,0x0112}, {0x0306,0x0114}, {0x0307,0x0116},
+    {0x0308,0x00cb}, {0x0309,0x1eba}, {0x030c,0x011a}, {0x030f,0x0204}, {0x0311,0x0206}, {0x0323,0x1eb8}, {0x0327,0x0228}, {0x0328,0x0118},
+    {0x032d,0x1e18}, {0x0330,0x1e1a}, {0x0307,0x1e1e}, {0x0301,0x01f4}, {0x0302,0x011c}, {0x0304,0x1e20}, {0x0306,0x011e}, {0x0307,0x0120},
+    {0x030c,0x01e6}, {0x0327,0x0122}, {0x0302,0x0124}, {0x0307,0x1e22}, {0x0308,0x1e26}, {0x030c,0x021e}, {0x0323,0x1e24}, {0x0327,0x1e28},
+    {0x032e,0x1e2a}, {0x0300,0x00cc}, {0x0301,0x00cd}, {0x0302,0x00ce}, {0x0303,0x0128}, {0x0304,0x012a}, {0x0306,0x012c}, {0x0307,0x0130},
+    {0x0308,0x00cf}, {0x0309,0x1ec8}, {0x030c,0x01cf}, {0x030f,0x0208}, {0x0311,0x020a}, {0x0323,0x1eca}, {0x0328,0x012e}, {0x0330,0x1e2c},
+    {0x0302,0x0134}, {0x0301,0x1e30}, {0x030c,0x01e8}, {0x0323,0x1e32}, {0x0327,0x0136}, {0x0331,0x1e34}, {0x0301,0x0139}, {0x030c,0x013d},
+    {0x0323,0x1e36}, {0x0327,0x013b}, {0x032d,0x1e3c}, {0x0331,0x1e3a}, {0x0301,0x1e3e}, {0x0307,0x1e40}, {0x0323,0x1e42}, {0x0300,0x01f8},
+    {0x0301,0x0143}, {0x0303,0x00d1}, {0x0307,0x1e44}, {0x030c,0x0147}, {0x0323,0x1e46}, {0x0327,0x0145}, {0x032d,0x1e4a}, {0x0331,0x1e48},
+    {0x0300,0x00d2}, {0x0301,0x00d3}, {0x0302,0x00d4}, {0x0303,0x00d5}, {0x0304,0x014c}, {0x0306,0x014e}, {0x0307,0x022e}, {0x0308,0x00d6},
+    {0x0309,0x1ece}, {0x030b,0x0150}, {0x030c,0x01d1}, {0x030f,0x020c}, {0x0311,0x020e}, {0x031b,0x01a0}, {0x0323,0x1ecc}, {0x0328,0x01ea},
+    {0x0301,0x1e54}, {0x0307,0x1e56}, {0x0301,0x0154}, {0x0307,0x1e58}, {0x030c,0x0158}, {0x030f,0x0210}, {0x0311,0x0212}, {0x0323,0x1e5a},
+    {0x0327,0x0156}, {0x0331,0x1e5e}, {0x0301,0x015a}, {0x0302,0x015c}, {0x0307,0x1e60}, {0x030c,0x0160}, {0x0323,0x1e62}, {0x0326,0x0218},
+    {0x0327,0x015e}, {0x0307,0x1e6a}, {0x030c,0x0164}, {0x0323,0x1e6c}, {0x0326,0x021a}, {0x0327,0x0162}, {0x032d,0x1e70}, {0x0331,0x1e6e},
+    {0x0300,0x00d9}, {0x0301,0x00da}, {0x0302,0x00db}, {0x0303,0x0168}, {0x0304,0x016a}, {0x0306,0x016c}, {0x0308,0x00dc}, {0x0309,0x1ee6},
+    {0x030a,0x016e}, {0x030b,0x0170}, {0x030c,0x01d3}, {0x030f,0x0214}, {0x0311,0x0216}, {0x031b,0x01af}, {0x0323,0x1ee4}, {0x0324,0x1e72},
+    {0x0328,0x0172}, {0x032d,0x1e76}, {0x0330,0x1e74}, {0x0303,0x1e7c}, {0x0323,0x1e7e}, {0x0300,0x1e80}, {0x0301,0x1e82}, {0x0302,0x0174},
+    {0x0307,0x1e86}, {0x0308,0x1e84}, {0x0323,0x1e88}, {0x0307,0x1e8a}, {0x0308,0x1e8c}, {0x0300,0x1ef2}, {0x0301,0x00dd}, {0x0302,0x0176},
+    {0x0303,0x1ef8}, {0x0304,0x0232}, {0x0307,0x1e8e}, {0x0308,0x0178}, {0x0309,0x1ef6}, {0x0323,0x1ef4}, {0x0301,0x0179}, {0x0302,0x1e90},
+    {0x0307,0x017b}, {0x030c,0x017d}, {0x0323,0x1e92}, {0x0331,0x1e94}, {0x0300,0x00e0}, {0x0301,0x00e1}, {0x0302,0x00e2}, {0x0303,0x00e3},
+    {0x0304,0x0101}, {0x0306,0x0103}, {0x0307,0x0227}, {0x0308,0x00e4}, {0x0309,0x1ea3}, {0x030a,0x00e5}, {0x030c,0x01ce}, {0x030f,0x0201},
+    {0x0311,0x0203}, {0x0323,0x1ea1}, {0x0325,0x1e01}, {0x0328,0x0105}, {0x0307,0x1e03}, {0x0323,0x1e05}, {0x0331,0x1e07}, {0x0301,0x0107},
+    {0x0302,0x0109}, {0x0307,0x010b}, {0x030c,0x010d}, {0x0327,0x00e7}, {0x0307,0x1e0b}, {0x030c,0x010f}, {0x0323,0x1e0d}, {0x0327,0x1e11},
+    {0x032d,0x1e13}, {0x0331,0x1e0f}, {0x0300,0x00e8}, {0x0301,0x00e9}, {0x0302,0x00ea}, {0x0303,0x1ebd}, {0x0304,0x0113}, {0x0306,0x0115},
+    {0x0307,0x0117}, {0x0308,0x00eb}, {0x0309,0x1ebb}, {0x030c,0x011b}, {0x030f,0x0205}, {0x0311,0x0207}, {0x0323,0x1eb9}, {0x0327,0x0229},
+    {0x0328,0x0119}, {0x032d,0x1e19}, {0x0330,0x1e1b}, {0x0307,0x1e1f}, {0x0301,0x01f5}, {0x0302,0x011d}, {0x0304,0x1e21}, {0x0306,0x011f},
+    {0x0307,0x0121}, {0x030c,0x01e7}, {0x0327,0x0123}, {0x0302,0x0125}, {0x0307,0x1e23}, {0x0308,0x1e27}, {0x030c,0x021f}, {0x0323,0x1e25},
+    {0x0327,0x1e29}, {0x032e,0x1e2b}, {0x0331,0x1e96}, {0x0300,0x00ec}, {0x0301,0x00ed}, {0x0302,0x00ee}, {0x0303,0x0129}, {0x0304,0x012b},
+    {0x0306,0x012d}, {0x0308,0x00ef}, {0x0309,0x1ec9}, {0x030c,0x01d0}, {0x030f,0x0209}, {0x0311,0x020b}, {0x0323,0x1ecb}, {0x0328,0x012f},
+    {0x0330,0x1e2d}, {0x0302,0x0135}, {0x030c,0x01f0}, {0x0301,0x1e31}, {0x030c,0x01e9}, {0x0323,0x1e33}, {0x0327,0x0137}, {0x0331,0x1e35},
+    {0x0301,0x013a}, {0x030c,0x013e}, {0x0323,0x1e37}, {0x0327,0x013c}, {0x032d,0x1e3d}, {0x0331,0x1e3b}, {0x0301,0x1e3f}, {0x0307,0x1e41},
+    {0x0323,0x1e43}, {0x0300,0x01f9}, {0x0301,0x0144}, {0x0303,0x00f1}, {0x0307,0x1e45}, {0x030c,0x0148}, {0x0323,0x1e47}, {0x0327,0x0146},
+    {0x032d,0x1e4b}, {0x0331,0x1e49}, {0x0300,0x00f2}, {0x0301,0x00f3}, {0x0302,0x00f4}, {0x0303,0x00f5}, {0x0304,0x014d}, {0x0306,0x014f},
+    {0x0307,0x022f}, {0x0308,0x00f6}, {0x0309,0x1ecf}, {0x030b,0x0151}, {0x030c,0x01d2}, {0x030f,0x020d}, {0x0311,0x020f}, {0x031b,0x01a1},
+    {0x0323,0x1ecd}, {0x0328,0x01eb}, {0x0301,0x1e55}, {0x0307,0x1e57}, {0x0301,0x0155}, {0x0307,0x1e59}, {0x030c,0x0159}, {0x030f,0x0211},
+    {0x0311,0x0213}, {0x0323,0x1e5b}, {0x0327,0x0157}, {0x0331,0x1e5f}, {0x0301,0x015b}, {0x0302,0x015d}, {0x0307,0x1e61}, {0x030c,0x0161},
+    {0x0323,0x1e63}, {0x0326,0x0219}, {0x0327,0x015f}, {0x0307,0x1e6b}, {0x0308,0x1e97}, {0x030c,0x0165}, {0x0323,0x1e6d}, {0x0326,0x021b},
+    {0x0327,0x0163}, {0x032d,0x1e71}, {0x0331,0x1e6f}, {0x0300,0x00f9}, {0x0301,0x00fa}, {0x0302,0x00fb}, {0x0303,0x0169}, {0x0304,0x016b},
+    {0x0306,0x016d}, {0x0308,0x00fc}, {0x0309,0x1ee7}, {0x030a,0x016f}, {0x030b,0x0171}, {0x030c,0x01d4}, {0x030f,0x0215}, {0x0311,0x0217},
+    {0x031b,0x01b0}, {0x0323,0x1ee5}, {0x0324,0x1e73}, {0x0328,0x0173}, {0x032d,0x1e77}, {0x0330,0x1e75}, {0x0303,0x1e7d}, {0x0323,0x1e7f},
+    {0x0300,0x1e81}, {0x0301,0x1e83}, {0x0302,0x0175}, {0x0307,0x1e87}, {0x0308,0x1e85}, {0x030a,0x1e98}, {0x0323,0x1e89}, {0x0307,0x1e8b},
+    {0x0308,0x1e8d}, {0x0300,0x1ef3}, {0x0301,0x00fd}, {0x0302,0x0177}, {0x0303,0x1ef9}, {0x0304,0x0233}, {0x0307,0x1e8f}, {0x0308,0x00ff},
+    {0x0309,0x1ef7}, {0x030a,0x1e99}, {0x0323,0x1ef5}, {0x0301,0x017a}, {0x0302,0x1e91}, {0x0307,0x017c}, {0x030c,0x017e}, {0x0323,0x1e93},
+    {0x0331,0x1e95}, {0x0300,0x1fed}, {0x0301,0x0385}, {0x0342,0x1fc1}, {0x0300,0x1ea6}, {0x0301,0x1ea4}, {0x0303,0x1eaa}, {0x0309,0x1ea8},
+    {0x0304,0x01de}, {0x0301,0x01fa}, {0x0301,0x01fc}, {0x0304,0x01e2}, {0x0301,0x1e08}, {0x0300,0x1ec0}, {0x0301,0x1ebe}, {0x0303,0x1ec4},
+    {0x0309,0x1ec2}, {0x0301,0x1e2e}, {0x0300,0x1ed2}, {0x0301,0x1ed0}, {0x0303,0x1ed6}, {0x0309,0x1ed4}, {0x0301,0x1e4c}, {0x0304,0x022c},
+    {0x0308,0x1e4e}, {0x0304,0x022a}, {0x0301,0x01fe}, {0x0300,0x01db}, {0x0301,0x01d7}, {0x0304,0x01d5}, {0x030c,0x01d9}, {0x0300,0x1ea7},
+    {0x0301,0x1ea5}, {0x0303,0x1eab}, {0x0309,0x1ea9}, {0x0304,0x01df}, {0x0301,0x01fb}, {0x0301,0x01fd}, {0x0304,0x01e3}, {0x0301,0x1e09},
+    {0x0300,0x1ec1}, {0x0301,0x1ebf}, {0x0303,0x1ec5}, {0x0309,0x1ec3}, {0x0301,0x1e2f}, {0x0300,0x1ed3}, {0x0301,0x1ed1}, {0x0303,0x1ed7},
+    {0x0309,0x1ed5}, {0x0301,0x1e4d}, {0x0304,0x022d}, {0x0308,0x1e4f}, {0x0304,0x022b}, {0x0301,0x01ff}, {0x0300,0x01dc}, {0x0301,0x01d8},
+    {0x0304,0x01d6}, {0x030c,0x01da}, {0x0300,0x1eb0}, {0x0301,0x1eae}, {0x0303,0x1eb4}, {0x0309,0x1eb2}, {0x0300,0x1eb1}, {0x0301,0x1eaf},
+    {0x0303,0x1eb5}, {0x0309,0x1eb3}, {0x0300,0x1e14}, {0x0301,0x1e16}, {0x0300,0x1e15}, {0x0301,0x1e17}, {0x0300,0x1e50}, {0x0301,0x1e52},
+    {0x0300,0x1e51}, {0x0301,0x1e53}, {0x0307,0x1e64}, {0x0307,0x1e65}, {0x0307,0x1e66}, {0x0307,0x1e67}, {0x0301,0x1e78}, {0x0301,0x1e79},
+    {0x0308,0x1e7a}, {0x0308,0x1e7b}, {0x0307,0x1e9b}, {0x0300,0x1edc}, {0x0301,0x1eda}, {0x0303,0x1ee0}, {0x0309,0x1ede}, {0x0323,0x1ee2},
+    {0x0300,0x1edd}, {0x0301,0x1edb}, {0x0303,0x1ee1}, {0x0309,0x1edf}, {0x0323,0x1ee3}, {0x0300,0x1eea}, {0x0301,0x1ee8}, {0x0303,0x1eee},
+    {0x0309,0x1eec}, {0x0323,0x1ef0}, {0x0300,0x1eeb}, {0x0301,0x1ee9}, {0x0303,0x1eef}, {0x0309,0x1eed}, {0x0323,0x1ef1}, {0x030c,0x01ee},
+    {0x0304,0x01ec}, {0x0304,0x01ed}, {0x0304,0x01e0}, {0x0304,0x01e1}, {0x0306,0x1e1c}, {0x0306,0x1e1d}, {0x0304,0x0230}, {0x0304,0x0231},
+    {0x030c,0x01ef}, {0x0300,0x1fba}, {0x0301,0x0386}, {0x0304,0x1fb9}, {0x0306,0x1fb8}, {0x0313,0x1f08}, {0x0314,0x1f09}, {0x0345,0x1fbc},
+    {0x0300,0x1fc8}, {0x0301,0x0388}, {0x0313,0x1f18}, {0x0314,0x1f19}, {0x0300,0x1fca}, {0x0301,0x0389}, {0x0313,0x1f28}, {0x0314,0x1f29},
+    {0x0345,0x1fcc}, {0x0300,0x1fda}, {0x0301,0x038a}, {0x0304,0x1fd9}, {0x0306,0x1fd8}, {0x0308,0x03aa}, {0x0313,0x1f38}, {0x0314,0x1f39},
+    {0x0300,0x1ff8}, {0x0301,0x038c}, {0x0313,0x1f48}, {0x0314,0x1f49}, {0x0314,0x1fec}, {0x0300,0x1fea}, {0x0301,0x038e}, {0x0304,0x1fe9},
+    {0x0306,0x1fe8}, {0x0308,0x03ab}, {0x0314,0x1f59}, {0x0300,0x1ffa}, {0x0301,0x038f}, {0x0313,0x1f68}, {0x0314,0x1f69}, {0x0345,0x1ffc},
+    {0x0345,0x1fb4}, {0x0345,0x1fc4}, {0x0300,0x1f70}, {0x0301,0x03ac}, {0x0304,0x1fb1}, {0x0306,0x1fb0}, {0x0313,0x1f00}, {0x0314,0x1f01},
+    {0x0342,0x1fb6}, {0x0345,0x1fb3}, {0x0300,0x1f72}, {0x0301,0x03ad}, {0x0313,0x1f10}, {0x0314,0x1f11}, {0x0300,0x1f74}, {0x0301,0x03ae},
+    {0x0313,0x1f20}, {0x0314,0x1f21}, {0x0342,0x1fc6}, {0x0345,0x1fc3}, {0x0300,0x1f76}, {0x0301,0x03af}, {0x0304,0x1fd1}, {0x0306,0x1fd0},
+    {0x0308,0x03ca}, {0x0313,0x1f30}, {0x0314,0x1f31}, {0x0342,0x1fd6}, {0x0300,0x1f78}, {0x0301,0x03cc}, {0x0313,0x1f40}, {0x0314,0x1f41},
+    {0x0313,0x1fe4}, {0x0314,0x1fe5}, {0x0300,0x1f7a}, {0x0301,0x03cd}, {0x0304,0x1fe1}, {0x0306,0x1fe0}, {0x0308,0x03cb}, {0x0313,0x1f50},
+    {0x0314,0x1f51}, {0x0342,0x1fe6}, {0x0300,0x1f7c}, {0x0301,0x03ce}, {0x0313,0x1f60}, {0x0314,0x1f61}, {0x0342,0x1ff6}, {0x0345,0x1ff3},
+    {0x0300,0x1fd2}, {0x0301,0x0390}, {0x0342,0x1fd7}, {0x0300,0x1fe2}, {0x0301,0x03b0}, {0x0342,0x1fe7}, {0x0345,0x1ff4}, {0x0301,0x03d3},
+    {0x0308,0x03d4}, {0x0308,0x0407}, {0x0306,0x04d0}, {0x0308,0x04d2}, {0x0301,0x0403}, {0x0300,0x0400}, {0x0306,0x04d6}, {0x0308,0x0401},
+    {0x0306,0x04c1}, {0x0308,0x04dc}, {0x0308,0x04de}, {0x0300,0x040d}, {0x0304,0x04e2}, {0x0306,0x0419}, {0x0308,0x04e4}, {0x0301,0x040c},
+    {0x0308,0x04e6}, {0x0304,0x04ee}, {0x0306,0x040e}, {0x0308,0x04f0}, {0x030b,0x04f2}, {0x0308,0x04f4}, {0x0308,0x04f8}, {0x0308,0x04ec},
+    {0x0306,0x04d1}, {0x0308,0x04d3}, {0x0301,0x0453}, {0x0300,0x0450}, {0x0306,0x04d7}, {0x0308,0x0451}, {0x0306,0x04c2}, {0x0308,0x04dd},
+    {0x0308,0x04df}, {0x0300,0x045d}, {0x0304,0x04e3}, {0x0306,0x0439}, {0x0308,0x04e5}, {0x0301,0x045c}, {0x0308,0x04e7}, {0x0304,0x04ef},
+    {0x0306,0x045e}, {0x0308,0x04f1}, {0x030b,0x04f3}, {0x0308,0x04f5}, {0x0308,0x04f9}, {0x0308,0x04ed}, {0x0308,0x0457}, {0x030f,0x0476},
+    {0x030f,0x0477}, {0x0308,0x04da}, {0x0308,0x04db}, {0x0308,0x04ea}, {0x0308,0x04eb}, {0x0653,0x0622}, {0x0654,0x0623}, {0x0655,0x0625},
+    {0x0654,0x0624}, {0x0654,0x0626}, {0x0654,0x06c2}, {0x0654,0x06d3}, {0x0654,0x06c0}, {0x093c,0x0929}, {0x093c,0x0931}, {0x093c,0x0934},
+    {0x09be,0x09cb}, {0x09d7,0x09cc}, {0x0b3e,0x0b4b}, {0x0b56,0x0b48}, {0x0b57,0x0b4c}, {0x0bd7,0x0b94}, {0x0bbe,0x0bca}, {0x0bd7,0x0bcc},
+    {0x0bbe,0x0bcb}, {0x0c56,0x0c48}, {0x0cd5,0x0cc0}, {0x0cc2,0x0cca}, {0x0cd5,0x0cc7}, {0x0cd6,0x0cc8}, {0x0cd5,0x0ccb}, {0x0d3e,0x0d4a},
+    {0x0d57,0x0d4c}, {0x0d3e,0x0d4b}, {0x0dca,0x0dda}, {0x0dcf,0x0ddc}, {0x0ddf,0x0dde}, {0x0dca,0x0ddd}, {0x102e,0x1026}, {0x1b35,0x1b06},
+    {0x1b35,0x1b08}, {0x1b35,0x1b0a}, {0x1b35,0x1b0c}, {0x1b35,0x1b0e}, {0x1b35,0x1b12}, {0x1b35,0x1b3b}, {0x1b35,0x1b3d}, {0x1b35,0x1b40},
+    {0x1b35,0x1b41}, {0x1b35,0x1b43}, {0x0304,0x1e38}, {0x0304,0x1e39}, {0x0304,0x1e5c}, {0x0304,0x1e5d}, {0x0307,0x1e68}, {0x0307,0x1e69},
+    {0x0302,0x1eac}, {0x0306,0x1eb6}, {0x0302,0x1ead}, {0x0306,0x1eb7}, {0x0302,0x1ec6}, {0x0302,0x1ec7}, {0x0302,0x1ed8}, {0x0302,0x1ed9},
+    {0x0300,0x1f02}, {0x0301,0x1f04}, {0x0342,0x1f06}, {0x0345,0x1f80}, {0x0300,0x1f03}, {0x0301,0x1f05}, {0x0342,0x1f07}, {0x0345,0x1f81},
+    {0x0345,0x1f82}, {0x0345,0x1f83}, {0x0345,0x1f84}, {0x0345,0x1f85}, {0x0345,0x1f86}, {0x0345,0x1f87}, {0x0300,0x1f0a}, {0x0301,0x1f0c},
+    {0x0342,0x1f0e}, {0x0345,0x1f88}, {0x0300,0x1f0b}, {0x0301,0x1f0d}, {0x0342,0x1f0f}, {0x0345,0x1f89}, {0x0345,0x1f8a}, {0x0345,0x1f8b},
+    {0x0345,0x1f8c}, {0x0345,0x1f8d}, {0x0345,0x1f8e}, {0x0345,0x1f8f}, {0x0300,0x1f12}, {0x0301,0x1f14}, {0x0300,0x1f13}, {0x0301,0x1f15},
+    {0x0300,0x1f1a}, {0x0301,0x1f1c}, {0x0300,0x1f1b}, {0x0301,0x1f1d}, {0x0300,0x1f22}, {0x0301,0x1f24}, {0x0342,0x1f26}, {0x0345,0x1f90},
+    {0x0300,0x1f23}, {0x0301,0x1f25}, {0x0342,0x1f27}, {0x0345,0x1f91}, {0x0345,0x1f92}, {0x0345,0x1f93}, {0x0345,0x1f94}, {0x0345,0x1f95},
+    {0x0345,0x1f96}, {0x0345,0x1f97}, {0x0300,0x1f2a}, {0x0301,0x1f2c}, {0x0342,0x1f2e}, {0x0345,0x1f98}, {0x0300,0x1f2b}, {0x0301,0x1f2d},
+    {0x0342,0x1f2f}, {0x0345,0x1f99}, {0x0345,0x1f9a}, {0x0345,0x1f9b}, {0x0345,0x1f9c}, {0x0345,0x1f9d}, {0x0345,0x1f9e}, {0x0345,0x1f9f},
+    {0x0300,0x1f32}, {0x0301,0x1f34}, {0x0342,0x1f36}, {0x0300,0x1f33}, {0x0301,0x1f35}, {0x0342,0x1f37}, {0x0300,0x1f3a}, {0x0301,0x1f3c},
+    {0x0342,0x1f3e}, {0x0300,0x1f3b}, {0x0301,0x1f3d}, {0x0342,0x1f3f}, {0x0300,0x1f42}, {0x0301,0x1f44}, {0x0300,0x1f43}, {0x0301,0x1f45},
+    {0x0300,0x1f4a}, {0x0301,0x1f4c}, {0x0300,0x1f4b}, {0x0301,0x1f4d}, {0x0300,0x1f52}, {0x0301,0x1f54}, {0x0342,0x1f56}, {0x0300,0x1f53},
+    {0x0301,0x1f55}, {0x0342,0x1f57}, {0x0300,0x1f5b}, {0x0301,0x1f5d}, {0x0342,0x1f5f}, {0x0300,0x1f62}, {0x0301,0x1f64}, {0x0342,0x1f66},
+    {0x0345,0x1fa0}, {0x0300,0x1f63}, {0x0301,0x1f65}, {0x0342,0x1f67}, {0x0345,0x1fa1}, {0x0345,0x1fa2}, {0x0345,0x1fa3}, {0x0345,0x1fa4},
+    {0x0345,0x1fa5}, {0x0345,0x1fa6}, {0x0345,0x1fa7}, {0x0300,0x1f6a}, {0x0301,0x1f6c}, {0x0342,0x1f6e}, {0x0345,0x1fa8}, {0x0300,0x1f6b},
+    {0x0301,0x1f6d}, {0x0342,0x1f6f}, {0x0345,0x1fa9}, {0x0345,0x1faa}, {0x0345,0x1fab}, {0x0345,0x1fac}, {0x0345,0x1fad}, {0x0345,0x1fae},
+    {0x0345,0x1faf}, {0x0345,0x1fb2}, {0x0345,0x1fc2}, {0x0345,0x1ff2}, {0x0345,0x1fb7}, {0x0300,0x1fcd}, {0x0301,0x1fce}, {0x0342,0x1fcf},
+    {0x0345,0x1fc7}, {0x0345,0x1ff7}, {0x0300,0x1fdd}, {0x0301,0x1fde}, {0x0342,0x1fdf}, {0x0338,0x219a}, {0x0338,0x219b}, {0x0338,0x21ae},
+    {0x0338,0x21cd}, {0x0338,0x21cf}, {0x0338,0x21ce}, {0x0338,0x2204}, {0x0338,0x2209}, {0x0338,0x220c}, {0x0338,0x2224}, {0x0338,0x2226},
+    {0x0338,0x2241}, {0x0338,0x2244}, {0x0338,0x2247}, {0x0338,0x2249}, {0x0338,0x226d}, {0x0338,0x2262}, {0x0338,0x2270}, {0x0338,0x2271},
+    {0x0338,0x2274}, {0x0338,0x2275}, {0x0338,0x2278}, {0x0338,0x2279}, {0x0338,0x2280}, {0x0338,0x2281}, {0x0338,0x22e0}, {0x0338,0x22e1},
+    {0x0338,0x2284}, {0x0338,0x2285}, {0x0338,0x2288}, {0x0338,0x2289}, {0x0338,0x22e2}, {0x0338,0x22e3}, {0x0338,0x22ac}, {0x0338,0x22ad},
+    {0x0338,0x22ae}, {0x0338,0x22af}, {0x0338,0x22ea}, {0x0338,0x22eb}, {0x0338,0x22ec}, {0x0338,0x22ed}, {0x3099,0x3094}, {0x3099,0x304c},
+    {0x3099,0x304e}, {0x3099,0x3050}, {0x3099,0x3052}, {0x3099,0x3054}, {0x3099,0x3056}, {0x3099,0x3058}, {0x3099,0x305a}, {0x3099,0x305c},
+    {0x3099,0x305e}, {0x3099,0x3060}, {0x3099,0x3062}, {0x3099,0x3065}, {0x3099,0x3067}, {0x3099,0x3069}, {0x3099,0x3070}, {0x309a,0x3071},
+    {0x3099,0x3073}, {0x309a,0x3074}, {0x3099,0x3076}, {0x309a,0x3077}, {0x3099,0x3079}, {0x309a,0x307a}, {0x3099,0x307c}, {0x309a,0x307d},
+    {0x3099,0x309e}, {0x3099,0x30f4}, {0x3099,0x30ac}, {0x3099,0x30ae}, {0x3099,0x30b0}, {0x3099,0x30b2}, {0x3099,0x30b4}, {0x3099,0x30b6},
+    {0x3099,0x30b8}, {0x3099,0x30ba}, {0x3099,0x30bc}, {0x3099,0x30be}, {0x3099,0x30c0}, {0x3099,0x30c2}, {0x3099,0x30c5}, {0x3099,0x30c7},
+    {0x3099,0x30c9}, {0x3099,0x30d0}, {0x309a,0x30d1}, {0x3099,0x30d3}, {0x309a,0x30d4}, {0x3099,0x30d6}, {0x309a,0x30d7}, {0x3099,0x30d9},
+    {0x309a,0x30da}, {0x3099,0x30dc}, {0x309a,0x30dd}, {0x3099,0x30f7}, {0x3099,0x30f8}, {0x3099,0x30f9}, {0x3099,0x30fa}, {0x3099,0x30fe},
+    {0x110ba,0x1109a}, {0x110ba,0x1109c}, {0x110ba,0x110ab}, {0x11127,0x1112e}, {0x11127,0x1112f}, {0x1133e,0x1134b}, {0x11357,0x1134c}, {0x114b0,0x114bc},
+    {0x114ba,0x114bb}, {0x114bd,0x114be}, {0x115af,0x115ba}, {0x115af,0x115bb}, {0x11930,0x11938},
+};
+#endif
@@ -0,0 +1,2079 @@
+#ifndef MODULE_UNICODE_SEGMENT
+#define MODULE_UNICODE_SEGMENT
+
+//Grapheme cluster and word boundaries of UTF-8 text as defined by UAX#29 (https://www.unicode.org/reports/tr29/).
+//
+//Every code point is assigned a grapheme and a word break class through a two stage table. The rules are
+// compiled into two state machines indexed by [state][class] which tell whether there is a boundary before
+// the next code point and what the state after it is. ASCII skips the table lookup and decoding completely.
+//All of the word rules but three look at the code points before the boundary only. The remaining ones
+// (WB6, WB7b and WB12: "a.b", "3.14") need to know what comes after a punctuation character. For those the
+// machine enters a pending state remembering the position of the punctuation and resolves it once the next
+// code point arrives. Either way each segment can be found from its start alone, without any carried state.
+//
+//The iterators are used like Line_Iterator:
+//   for(Unicode_Segment_Iterator it = {0}; unicode_word_next(&it, text, size); )
+//       if(it.kind == UNICODE_WORD_LETTER) {...text + it.from, it.to - it.from...}
+//
+//Text can also be segmented as it streams in by setting is_partial while more input will follow.
+// The iterator then only returns segments which cannot change by appending more text. Once it returns false
+// append more input to the text and call it again. Clear is_partial for the final call. Positions are offsets into
+// text so when dropping the already returned part of it subtract its size from it.to.
+//
+//Invalid UTF-8 bytes are segmented one by one as if they were U+FFFD.
+//The second half of the file is generated by unicode_segment_format_tables_file from GraphemeBreakProperty.txt,
+// WordBreakProperty.txt, emoji-data.txt and UnicodeData.txt (https://www.unicode.org/Public/UCD/latest/ucd/).
+//The rules are the ones of the data version. Thus GB9c (Indic conjuncts, added in Unicode 15.1) is not implemented.
+//The tables are still of Unicode 14.0 while unicode.h is of 16.0. Code points assigned since then are Other here
+// so they break like symbols and make UNICODE_WORD_NONE words even where unicode_is_alpha holds for them.
+// Regenerate the tables from the 16.0 files (https://www.unicode.org/Public/16.0.0/ucd/) together with the rules
+// added since (GB9c, the Indic_Conjunct_Break property) to bring the two in line.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "utf.h"
+
+#ifndef EXTERNAL
+    #define EXTERNAL
+#endif
+
+#define UNICODE_SEGMENT_BLOCK_SHIFT 7
+
+typedef enum Unicode_Grapheme_Break {
+    UNICODE_GRAPHEME_OTHER = 0,
+    UNICODE_GRAPHEME_CR,
+    UNICODE_GRAPHEME_LF,
+    UNICODE_GRAPHEME_CONTROL,
+    UNICODE_GRAPHEME_EXTEND,
+    UNICODE_GRAPHEME_ZWJ,
+    UNICODE_GRAPHEME_REGIONAL_INDICATOR,
+    UNICODE_GRAPHEME_PREPEND,
+    UNICODE_GRAPHEME_SPACING_MARK,
+    UNICODE_GRAPHEME_L,
+    UNICODE_GRAPHEME_V,
+    UNICODE_GRAPHEME_T,
+    UNICODE_GRAPHEME_LV,
+    UNICODE_GRAPHEME_LVT,
+    UNICODE_GRAPHEME_EXTENDED_PICTOGRAPHIC,
+    UNICODE_GRAPHEME_BREAK_COUNT,
+} Unicode_Grapheme_Break;
+
+typedef enum Unicode_Word_Break {
+    UNICODE_WORD_BREAK_OTHER = 0,
+    UNICODE_WORD_BREAK_CR,
+    UNICODE_WORD_BREAK_LF,
+    UNICODE_WORD_BREAK_NEWLINE,
+    UNICODE_WORD_BREAK_EXTEND,
+    UNICODE_WORD_BREAK_ZWJ,
+    UNICODE_WORD_BREAK_REGIONAL_INDICATOR,
+    UNICODE_WORD_BREAK_FORMAT,
+    UNICODE_WORD_BREAK_KATAKANA,
+    UNICODE_WORD_BREAK_HEBREW_LETTER,
+    UNICODE_WORD_BREAK_ALETTER,
+    UNICODE_WORD_BREAK_SINGLE_QUOTE,
+    UNICODE_WORD_BREAK_DOUBLE_QUOTE,
+    UNICODE_WORD_BREAK_MID_NUM_LET,
+    UNICODE_WORD_BREAK_MID_LETTER,
+    UNICODE_WORD_BREAK_MID_NUM,
+    UNICODE_WORD_BREAK_NUMERIC,
+    UNICODE_WORD_BREAK_EXTEND_NUM_LET,
+    UNICODE_WORD_BREAK_WSEG_SPACE,
+    UNICODE_WORD_BREAK_EXTENDED_PICTOGRAPHIC,   //Other which is Extended_Pictographic
+    UNICODE_WORD_BREAK_ALETTER_PICTOGRAPHIC,    //ALetter which is Extended_Pictographic
+    UNICODE_WORD_BREAK_OTHER_LETTER,            //Other which is a letter, mostly ideographs and scripts without spaces
+    UNICODE_WORD_BREAK_COUNT,
+} Unicode_Word_Break;
+
+typedef enum Unicode_Word_Kind {
+    UNICODE_WORD_NONE = 0,  //spaces, punctuation, symbols, emoji
+    UNICODE_WORD_NUMBER,    //contains a number but no letter
+    UNICODE_WORD_LETTER,    //contains a letter
+} Unicode_Word_Kind;
+
+typedef struct Unicode_Segment_Iterator {
+    isize from;             //the current segment is [from, to)
+    isize to;
+    Unicode_Word_Kind kind; //only set by unicode_word_next
+    bool is_partial;        //set while the text is only a prefix of the whole input
+} Unicode_Segment_Iterator;
+
+//Move the iterator to the next grapheme cluster/word. Return false if there is none (or it is not yet known).
+EXTERNAL bool unicode_grapheme_next(Unicode_Segment_Iterator* iterator, const void* text, isize text_size);
+EXTERNAL bool unicode_word_next(Unicode_Segment_Iterator* iterator, const void* text, isize text_size);
+
+EXTERNAL Unicode_Grapheme_Break unicode_grapheme_break(uint32_t codepoint);
+EXTERNAL Unicode_Word_Break unicode_word_break(uint32_t codepoint);
+
+typedef struct Unicode_Segment_Property {
+    uint8_t grapheme;
+    uint8_t word;
+} Unicode_Segment_Property;
+
+extern const uint8_t UNICODE_SEGMENT_BLOCKS[];                  //code point >> UNICODE_SEGMENT_BLOCK_SHIFT -> block
+extern const uint8_t UNICODE_SEGMENT_INDICES[];                 //block << UNICODE_SEGMENT_BLOCK_SHIFT | low bits -> property
+extern const Unicode_Segment_Property UNICODE_SEGMENT_PROPERTIES[];
+extern const uint8_t UNICODE_GRAPHEME_ASCII[128];
+extern const uint8_t UNICODE_WORD_ASCII[128];
+extern const uint8_t UNICODE_GRAPHEME_DFA[][UNICODE_GRAPHEME_BREAK_COUNT]; //[state][class] -> next state | UNICODE_SEGMENT_BREAK
+extern const uint8_t UNICODE_WORD_DFA[][UNICODE_WORD_BREAK_COUNT];         //[state][class] -> next state | action << 6
+
+//Making the generated section of this file
+EXTERNAL bool unicode_segment_format_tables_file(const char* grapheme_break, const char* word_break, const char* emoji_data, const char* unicode_data, const char* out);
+#endif
+
+#if (defined(MODULE_IMPL_ALL) || defined(MODULE_IMPL_UNICODE_SEGMENT)) && !defined(MODULE_HAS_IMPL_UNICODE_SEGMENT)
+#define MODULE_HAS_IMPL_UNICODE_SEGMENT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifndef ASSERT
+    #include <assert.h>
+    #define ASSERT(x, ...) assert(x)
+#endif
+
+#ifndef INTERNAL
+    #define INTERNAL static
+#endif
+
+#ifndef ATTRIBUTE_INLINE_NEVER
+    #if defined(_MSC_VER)
+        #define ATTRIBUTE_INLINE_NEVER __declspec(noinline)
+    #elif defined(__GNUC__) || defined(__clang__)
+        #define ATTRIBUTE_INLINE_NEVER __attribute__((noinline))
+    #else
+        #define ATTRIBUTE_INLINE_NEVER
+    #endif
+#endif
+
+#define UNICODE_SEGMENT_BREAK 0x80
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define _UNICODE_SEGMENT_SSE
+#endif
+
+enum {
+    _UNICODE_WORD_CONTINUE = 0, //no boundary before the code point
+    _UNICODE_WORD_BREAK = 1,    //boundary before the code point
+    _UNICODE_WORD_PENDING = 2,  //no boundary before the code point for now, but there is one if the pending state does not continue
+    _UNICODE_WORD_RESOLVE = 3,  //the pending state did not continue, the boundary is at the remembered position
+};
+
+//States of the word machine. The ones from _UNICODE_WORD_LETTER_MID on are pending.
+//_UNICODE_WORD_ZWJ is or-ed in when the last code point was ZWJ (for WB3c).
+enum {
+    _UNICODE_WORD_SOT,
+    _UNICODE_WORD_CR,
+    _UNICODE_WORD_LF,               //LF or Newline
+    _UNICODE_WORD_OTHER,
+    _UNICODE_WORD_ALETTER,
+    _UNICODE_WORD_HEBREW,
+    _UNICODE_WORD_NUMERIC,
+    _UNICODE_WORD_KATAKANA,
+    _UNICODE_WORD_EXTEND_NUM_LET,
+    _UNICODE_WORD_REGIONAL,         //odd number of regional indicators
+    _UNICODE_WORD_WSEG,             //WSegSpace not followed by anything ignorable
+    _UNICODE_WORD_HEBREW_QUOTE,     //Hebrew_Letter Single_Quote
+    _UNICODE_WORD_LETTER_MID,       //AHLetter (MidLetter | MidNumLetQ)
+    _UNICODE_WORD_HEBREW_DQ,        //Hebrew_Letter Double_Quote
+    _UNICODE_WORD_NUMERIC_MID,      //Numeric (MidNum | MidNumLetQ)
+    _UNICODE_WORD_ZWJ = 16,
+    _UNICODE_WORD_STATE_COUNT = 32,
+};
+
+enum {
+    _UNICODE_GRAPHEME_SOT,
+    _UNICODE_GRAPHEME_CR,
+    _UNICODE_GRAPHEME_CONTROL,      //LF or Control
+    _UNICODE_GRAPHEME_OTHER,
+    _UNICODE_GRAPHEME_L,
+    _UNICODE_GRAPHEME_V,            //V or LV
+    _UNICODE_GRAPHEME_T,            //T or LVT
+    _UNICODE_GRAPHEME_PREPEND,
+    _UNICODE_GRAPHEME_REGIONAL,     //odd number of regional indicators
+    _UNICODE_GRAPHEME_PICTOGRAPHIC, //Extended_Pictographic Extend*
+    _UNICODE_GRAPHEME_PICTOGRAPHIC_ZWJ,
+    _UNICODE_GRAPHEME_STATE_COUNT,
+};
+
+INTERNAL const Unicode_Segment_Property* _unicode_segment_property(uint32_t codepoint)
+{
+    uint32_t block = UNICODE_SEGMENT_BLOCKS[codepoint >> UNICODE_SEGMENT_BLOCK_SHIFT];
+    uint32_t low = codepoint & ((1u << UNICODE_SEGMENT_BLOCK_SHIFT) - 1);
+    return &UNICODE_SEGMENT_PROPERTIES[UNICODE_SEGMENT_INDICES[block << UNICODE_SEGMENT_BLOCK_SHIFT | low]];
+}
+
+EXTERNAL Unicode_Grapheme_Break unicode_grapheme_break(uint32_t codepoint)
+{
+    if(codepoint > UTF_MAX)
+        return UNICODE_GRAPHEME_OTHER;
+    return (Unicode_Grapheme_Break) _unicode_segment_property(codepoint)->grapheme;
+}
+
+EXTERNAL Unicode_Word_Break unicode_word_break(uint32_t codepoint)
+{
+    if(codepoint > UTF_MAX)
+        return UNICODE_WORD_BREAK_OTHER;
+    return (Unicode_Word_Break) _unicode_segment_property(codepoint)->word;
+}
+
+//Decodes the code point at index and returns its properties and size in *size. Invalid bytes have the properties
+// of U+FFFD and size 1. Returns NULL if is_partial and the code point might not be whole yet.
+INTERNAL const Unicode_Segment_Property* _unicode_segment_decode(const uint8_t* text, isize size, isize index, bool is_partial, isize* codepoint_size)
+{
+    uint32_t codepoint = 0;
+    isize next = index;
+    if(utf8_decode(text, size, &codepoint, &next) == false) {
+        if(is_partial && size - index < 4)
+            return NULL;
+        codepoint = UTF_REPLACEMENT;
+        next = index + 1;
+    }
+    *codepoint_size = next - index;
+    return _unicode_segment_property(codepoint);
+}
+
+EXTERNAL bool unicode_grapheme_next(Unicode_Segment_Iterator* iterator, const void* text, isize text_size)
+{
+    const uint8_t* in = (const uint8_t*) text;
+    isize from = iterator->to;
+    if(from >= text_size)
+        return false;
+
+    //An ASCII character followed by another is a cluster on its own, except for CR LF
+    uint8_t first = in[from];
+    if(first < 0x80 && from + 1 < text_size && in[from + 1] < 0x80) {
+        iterator->from = from;
+        iterator->to = from + 1 + (first == '\r' && in[from + 1] == '\n');
+        iterator->kind = UNICODE_WORD_NONE;
+        return true;
+    }
+
+    uint32_t state = _UNICODE_GRAPHEME_SOT;
+    isize i = from;
+    for(; i < text_size; ) {
+        uint32_t grapheme = 0;
+        isize size = 1;
+        if(in[i] < 0x80)
+            grapheme = UNICODE_GRAPHEME_ASCII[in[i]];
+        else {
+            const Unicode_Segment_Property* property = _unicode_segment_decode(in, text_size, i, iterator->is_partial, &size);
+            if(property == NULL)
+                return false;
+            grapheme = property->grapheme;
+        }
+
+        uint32_t transition = UNICODE_GRAPHEME_DFA[state][grapheme];
+        if(transition & UNICODE_SEGMENT_BREAK)
+            break;
+        state = transition;
+        i += size;
+    }
+
+    if(i >= text_size && iterator->is_partial)
+        return false;
+    iterator->from = from;
+    iterator->to = i;
+    iterator->kind = UNICODE_WORD_NONE;
+    return true;
+}
+
+//Runs the word state machine over the segment starting at from. The code points before i were already consumed
+// leaving it in state with the segment being of kind so far. Kept out of line so that the ASCII path of 
+// unicode_word_next does not pay for its registers.
+static ATTRIBUTE_INLINE_NEVER bool _unicode_word_next_machine(Unicode_Segment_Iterator* iterator, const uint8_t* in, isize text_size, isize from, isize i, uint32_t state, uint32_t kind)
+{
+    //Kind of word each class makes, in the order of Unicode_Word_Break
+    static const uint8_t kinds[UNICODE_WORD_BREAK_COUNT] = {
+        0, 0, 0, 0, 0, 0, 0, 0, UNICODE_WORD_LETTER, UNICODE_WORD_LETTER, UNICODE_WORD_LETTER,
+        0, 0, 0, 0, 0, UNICODE_WORD_NUMBER, 0, 0, 0, UNICODE_WORD_LETTER, UNICODE_WORD_LETTER,
+    };
+
+    isize pending = from;
+    isize to = text_size;
+    for(; i < text_size; ) {
+        uint32_t word = 0;
+        isize size = 1;
+        if(in[i] < 0x80)
+            word = UNICODE_WORD_ASCII[in[i]];
+        else {
+            const Unicode_Segment_Property* property = _unicode_segment_decode(in, text_size, i, iterator->is_partial, &size);
+            if(property == NULL)
+                return false;
+            word = property->word;
+        }
+
+        uint32_t transition = UNICODE_WORD_DFA[state][word];
+        uint32_t action = transition >> 6;
+        if(action == _UNICODE_WORD_BREAK) {
+            to = i;
+            goto found;
+        }
+        if(action == _UNICODE_WORD_RESOLVE) {
+            to = pending;
+            goto found;
+        }
+        if(action == _UNICODE_WORD_PENDING)
+            pending = i;
+
+        kind = kind > kinds[word] ? kind : kinds[word];
+        state = transition & 0x3F;
+        i += size;
+
+        //ASCII letters and digits after a letter or digit never break and only switch between the two states
+        if(state == _UNICODE_WORD_ALETTER || state == _UNICODE_WORD_NUMERIC) {
+            for(; i < text_size && in[i] < 0x80; i++) {
+                uint32_t next = UNICODE_WORD_ASCII[in[i]];
+                if(next == UNICODE_WORD_BREAK_ALETTER) {
+                    state = _UNICODE_WORD_ALETTER;
+                    kind = UNICODE_WORD_LETTER;
+                }
+                else if(next == UNICODE_WORD_BREAK_NUMERIC)
+                    state = _UNICODE_WORD_NUMERIC;
+                else
+                    break;
+            }
+        }
+    }
+
+    //The end of input resolves pending states the same way as any code point which does not continue them
+    if(iterator->is_partial)
+        return false;
+    if((state & ~_UNICODE_WORD_ZWJ) >= _UNICODE_WORD_LETTER_MID)
+        to = pending;
+
+    found:
+    iterator->from = from;
+    iterator->to = to;
+    iterator->kind = (Unicode_Word_Kind) kind;
+    return true;
+}
+
+#if defined(_UNICODE_SEGMENT_SSE)
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        INTERNAL int32_t _unicode_segment_find_first_set_bit32(uint32_t num)
+        {
+            unsigned long out = 0;
+            _BitScanForward(&out, (unsigned long) num);
+            return (int32_t) out;
+        }
+    #else
+        INTERNAL int32_t _unicode_segment_find_first_set_bit32(uint32_t num)
+        {
+            return __builtin_ffs((int) num) - 1;
+        }
+    #endif
+#endif
+
+EXTERNAL bool unicode_word_next(Unicode_Segment_Iterator* iterator, const void* text, isize text_size)
+{
+    const uint8_t* in = (const uint8_t*) text;
+    isize from = iterator->to;
+    if(from >= text_size)
+        return false;
+
+    //ASCII followed by more ASCII is resolved here without the state machine. None of the ignored classes (WB4) 
+    // are ASCII so the bytes after a run decide the boundary on their own. Only A-Z, a-z are ALetter, 0-9 Numeric, 
+    // '_' ExtendNumLet and space WSegSpace in ASCII. Runs of letters, digits and '_' (WB5, WB8 - WB10, WB13a, WB13b) 
+    // are consumed as a whole, 16 bytes at a time when possible, including the punctuation between letters or digits 
+    // (WB6, WB7, WB11, WB12). Runs of spaces (WB3d) are consumed as a whole and anything else but CR LF is a segment 
+    // of its own. The rest continues through the state machine from where we got.
+    isize i = from;
+    uint32_t state = _UNICODE_WORD_SOT;
+    uint32_t kind = UNICODE_WORD_NONE;
+    uint8_t first = in[from];
+    if(first < 0x80 && from + 1 < text_size && in[from + 1] < 0x80) {
+        uint32_t word = UNICODE_WORD_ASCII[first];
+        if(word == UNICODE_WORD_BREAK_WSEG_SPACE) {
+            for(i = from + 1; i < text_size && in[i] == ' '; i++);
+            state = _UNICODE_WORD_WSEG;
+            if(i < text_size && in[i] < 0x80)
+                goto found;
+        }
+        else if(word == UNICODE_WORD_BREAK_ALETTER || word == UNICODE_WORD_BREAK_NUMERIC || word == UNICODE_WORD_BREAK_EXTEND_NUM_LET) {
+            for(;;) {
+                #if defined(_UNICODE_SEGMENT_SSE)
+                    //There is no unsigned byte compare so the ranges are moved to start at -128 and compared signed
+                    for(; i + 16 <= text_size; i += 16) {
+                        __m128i bytes = _mm_loadu_si128((const __m128i*) (const void*) (in + i));
+                        __m128i lower = _mm_or_si128(bytes, _mm_set1_epi8(0x20));
+                        __m128i letters = _mm_cmplt_epi8(_mm_add_epi8(lower, _mm_set1_epi8((char) (-128 - 'a'))), _mm_set1_epi8((char) (-128 + 26)));
+                        __m128i digits = _mm_cmplt_epi8(_mm_add_epi8(bytes, _mm_set1_epi8((char) (-128 - '0'))), _mm_set1_epi8((char) (-128 + 10)));
+                        __m128i underscores = _mm_cmpeq_epi8(bytes, _mm_set1_epi8('_'));
+                        uint32_t run = (uint32_t) _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(letters, digits), underscores));
+                        uint32_t length = (uint32_t) _unicode_segment_find_first_set_bit32(~run);
+                        uint32_t in_run = ((uint32_t) 1 << length) - 1;
+                        if((uint32_t) _mm_movemask_epi8(letters) & in_run)
+                            kind = UNICODE_WORD_LETTER;
+                        else if((uint32_t) _mm_movemask_epi8(digits) & in_run)
+                            kind = kind > UNICODE_WORD_NUMBER ? kind : UNICODE_WORD_NUMBER;
+                        if(length < 16) {
+                            i += length;
+                            goto run_end;
+                        }
+                    }
+                #endif
+                for(; i < text_size && in[i] < 0x80; i++) {
+                    uint32_t next = UNICODE_WORD_ASCII[in[i]];
+                    if(next == UNICODE_WORD_BREAK_ALETTER)
+                        kind = UNICODE_WORD_LETTER;
+                    else if(next == UNICODE_WORD_BREAK_NUMERIC)
+                        kind = kind > UNICODE_WORD_NUMBER ? kind : UNICODE_WORD_NUMBER;
+                    else if(next != UNICODE_WORD_BREAK_EXTEND_NUM_LET)
+                        break;
+                }
+
+                run_end:
+                state = UNICODE_WORD_DFA[_UNICODE_WORD_SOT][UNICODE_WORD_ASCII[in[i - 1]]] & 0x3F;
+                if(i + 1 >= text_size || in[i] >= 0x80 || in[i + 1] >= 0x80)
+                    break;
+
+                uint32_t transition = UNICODE_WORD_DFA[state][UNICODE_WORD_ASCII[in[i]]];
+                if(transition >> 6 == _UNICODE_WORD_BREAK)
+                    goto found;
+                if(transition >> 6 != _UNICODE_WORD_PENDING)
+                    break;
+
+                //"a.b", "3.14" continue only when the punctuation is followed by the same kind of character
+                if(UNICODE_WORD_DFA[transition & 0x3F][UNICODE_WORD_ASCII[in[i + 1]]] >> 6 != _UNICODE_WORD_CONTINUE)
+                    goto found;
+                i += 1;
+            }
+        }
+        else if(first != '\r') {
+            i = from + 1;
+            goto found;
+        }
+    }
+    return _unicode_word_next_machine(iterator, in, text_size, from, i, state, kind);
+
+    found:
+    iterator->from = from;
+    iterator->to = i;
+    iterator->kind = (Unicode_Word_Kind) kind;
+    return true;
+}
+
+//The rules of UAX#29 from which the state machines are generated
+INTERNAL uint8_t _unicode_grapheme_transition(uint32_t state, uint32_t grapheme)
+{
+    bool is_break = true;
+    if(state == _UNICODE_GRAPHEME_SOT)
+        is_break = false;
+    else if(state == _UNICODE_GRAPHEME_CR && grapheme == UNICODE_GRAPHEME_LF) //GB3
+        is_break = false;
+    else if(state == _UNICODE_GRAPHEME_CR || state == _UNICODE_GRAPHEME_CONTROL) //GB4
+        is_break = true;
+    else if(grapheme == UNICODE_GRAPHEME_CR || grapheme == UNICODE_GRAPHEME_LF || grapheme == UNICODE_GRAPHEME_CONTROL) //GB5
+        is_break = true;
+    else if(state == _UNICODE_GRAPHEME_L && (grapheme == UNICODE_GRAPHEME_L || grapheme == UNICODE_GRAPHEME_V
+        || grapheme == UNICODE_GRAPHEME_LV || grapheme == UNICODE_GRAPHEME_LVT)) //GB6
+        is_break = false;
+    else if(state == _UNICODE_GRAPHEME_V && (grapheme == UNICODE_GRAPHEME_V || grapheme == UNICODE_GRAPHEME_T)) //GB7
+        is_break = false;
+    else if(state == _UNICODE_GRAPHEME_T && grapheme == UNICODE_GRAPHEME_T) //GB8
+        is_break = false;
+    else if(grapheme == UNICODE_GRAPHEME_EXTEND || grapheme == UNICODE_GRAPHEME_ZWJ || grapheme == UNICODE_GRAPHEME_SPACING_MARK) //GB9, GB9a
+        is_break = false;
+    else if(state == _UNICODE_GRAPHEME_PREPEND) //GB9b
+        is_break = false;
+    else if(state == _UNICODE_GRAPHEME_PICTOGRAPHIC_ZWJ && grapheme == UNICODE_GRAPHEME_EXTENDED_PICTOGRAPHIC) //GB11
+        is_break = false;
+    else if(state == _UNICODE_GRAPHEME_REGIONAL && grapheme == UNICODE_GRAPHEME_REGIONAL_INDICATOR) //GB12, GB13
+        is_break = false;
+
+    uint32_t next = _UNICODE_GRAPHEME_OTHER;
+    switch(grapheme) {
+        case UNICODE_GRAPHEME_CR:      next = _UNICODE_GRAPHEME_CR; break;
+        case UNICODE_GRAPHEME_LF:
+        case UNICODE_GRAPHEME_CONTROL: next = _UNICODE_GRAPHEME_CONTROL; break;
+        case UNICODE_GRAPHEME_L:       next = _UNICODE_GRAPHEME_L; break;
+        case UNICODE_GRAPHEME_V:
+        case UNICODE_GRAPHEME_LV:      next = _UNICODE_GRAPHEME_V; break;
+        case UNICODE_GRAPHEME_T:
+        case UNICODE_GRAPHEME_LVT:     next = _UNICODE_GRAPHEME_T; break;
+        case UNICODE_GRAPHEME_PREPEND: next = _UNICODE_GRAPHEME_PREPEND; break;
+        case UNICODE_GRAPHEME_EXTENDED_PICTOGRAPHIC: next = _UNICODE_GRAPHEME_PICTOGRAPHIC; break;
+        case UNICODE_GRAPHEME_REGIONAL_INDICATOR:
+            next = state == _UNICODE_GRAPHEME_REGIONAL && is_break == false ? _UNICODE_GRAPHEME_OTHER : _UNICODE_GRAPHEME_REGIONAL; break;
+        case UNICODE_GRAPHEME_EXTEND:
+            next = state == _UNICODE_GRAPHEME_PICTOGRAPHIC ? _UNICODE_GRAPHEME_PICTOGRAPHIC : _UNICODE_GRAPHEME_OTHER; break;
+        case UNICODE_GRAPHEME_ZWJ:
+            next = state == _UNICODE_GRAPHEME_PICTOGRAPHIC ? _UNICODE_GRAPHEME_PICTOGRAPHIC_ZWJ : _UNICODE_GRAPHEME_OTHER; break;
+        default: break;
+    }
+    return (uint8_t) (next | (is_break ? UNICODE_SEGMENT_BREAK : 0));
+}
+
+INTERNAL uint32_t _unicode_word_start_state(uint32_t word)
+{
+    switch(word) {
+        case UNICODE_WORD_BREAK_CR:                  return _UNICODE_WORD_CR;
+        case UNICODE_WORD_BREAK_LF:
+        case UNICODE_WORD_BREAK_NEWLINE:             return _UNICODE_WORD_LF;
+        case UNICODE_WORD_BREAK_ALETTER:
+        case UNICODE_WORD_BREAK_ALETTER_PICTOGRAPHIC:return _UNICODE_WORD_ALETTER;
+        case UNICODE_WORD_BREAK_HEBREW_LETTER:       return _UNICODE_WORD_HEBREW;
+        case UNICODE_WORD_BREAK_NUMERIC:             return _UNICODE_WORD_NUMERIC;
+        case UNICODE_WORD_BREAK_KATAKANA:            return _UNICODE_WORD_KATAKANA;
+        case UNICODE_WORD_BREAK_EXTEND_NUM_LET:      return _UNICODE_WORD_EXTEND_NUM_LET;
+        case UNICODE_WORD_BREAK_REGIONAL_INDICATOR:  return _UNICODE_WORD_REGIONAL;
+        case UNICODE_WORD_BREAK_WSEG_SPACE:          return _UNICODE_WORD_WSEG;
+        case UNICODE_WORD_BREAK_ZWJ:                 return _UNICODE_WORD_OTHER | _UNICODE_WORD_ZWJ;
+        default:                                     return _UNICODE_WORD_OTHER;
+    }
+}
+
+INTERNAL uint8_t _unicode_word_transition(uint32_t state, uint32_t word)
+{
+    #define _UNICODE_WORD_TO(next, action) return (uint8_t) ((next) | (action) << 6)
+    uint32_t base = state & ~_UNICODE_WORD_ZWJ;
+    bool after_zwj = (state & _UNICODE_WORD_ZWJ) != 0;
+    bool is_ignored = word == UNICODE_WORD_BREAK_EXTEND || word == UNICODE_WORD_BREAK_FORMAT || word == UNICODE_WORD_BREAK_ZWJ;
+    bool is_ahletter = word == UNICODE_WORD_BREAK_ALETTER || word == UNICODE_WORD_BREAK_ALETTER_PICTOGRAPHIC || word == UNICODE_WORD_BREAK_HEBREW_LETTER;
+    bool was_ahletter = base == _UNICODE_WORD_ALETTER || base == _UNICODE_WORD_HEBREW;
+    bool is_mid_letter = word == UNICODE_WORD_BREAK_MID_LETTER || word == UNICODE_WORD_BREAK_MID_NUM_LET || word == UNICODE_WORD_BREAK_SINGLE_QUOTE;
+    bool is_mid_num = word == UNICODE_WORD_BREAK_MID_NUM || word == UNICODE_WORD_BREAK_MID_NUM_LET || word == UNICODE_WORD_BREAK_SINGLE_QUOTE;
+    uint32_t zwj = word == UNICODE_WORD_BREAK_ZWJ ? _UNICODE_WORD_ZWJ : 0;
+    uint32_t start = _unicode_word_start_state(word);
+
+    //Pending states wait for the code point after the punctuation (skipping ignored ones as per WB4)
+    if(base >= _UNICODE_WORD_LETTER_MID) {
+        bool continues = false;
+        if(base == _UNICODE_WORD_LETTER_MID)  continues = is_ahletter;                            //WB7
+        if(base == _UNICODE_WORD_HEBREW_DQ)   continues = word == UNICODE_WORD_BREAK_HEBREW_LETTER; //WB7c
+        if(base == _UNICODE_WORD_NUMERIC_MID) continues = word == UNICODE_WORD_BREAK_NUMERIC;        //WB11
+        if(is_ignored)
+            _UNICODE_WORD_TO(base | zwj, _UNICODE_WORD_CONTINUE);
+        if(continues)
+            _UNICODE_WORD_TO(start, _UNICODE_WORD_CONTINUE);
+        _UNICODE_WORD_TO(_UNICODE_WORD_SOT, _UNICODE_WORD_RESOLVE);
+    }
+
+    if(base == _UNICODE_WORD_SOT)                                               //WB1
+        _UNICODE_WORD_TO(start, _UNICODE_WORD_CONTINUE);
+    if(base == _UNICODE_WORD_CR && word == UNICODE_WORD_BREAK_LF)               //WB3
+        _UNICODE_WORD_TO(start, _UNICODE_WORD_CONTINUE);
+    if(base == _UNICODE_WORD_CR || base == _UNICODE_WORD_LF)                    //WB3a
+        _UNICODE_WORD_TO(start, _UNICODE_WORD_BREAK);
+    if(word == UNICODE_WORD_BREAK_CR || word == UNICODE_WORD_BREAK_LF || word == UNICODE_WORD_BREAK_NEWLINE) //WB3b
+        _UNICODE_WORD_TO(start, _UNICODE_WORD_BREAK);
+    if(after_zwj && (word == UNICODE_WORD_BREAK_EXTENDED_PICTOGRAPHIC || word == UNICODE_WORD_BREAK_ALETTER_PICTOGRAPHIC)) //WB3c
+        _UNICODE_WORD_TO(start, _UNICODE_WORD_CONTINUE);
+    if(base == _UNICODE_WORD_WSEG && word == UNICODE_WORD_BREAK_WSEG_SPACE)     //WB3d
+        _UNICODE_WORD_TO(start, _UNICODE_WORD_CONTINUE);
+    if(is_ignored)                                                              //WB4
+        _UNICODE_WORD_TO((base == _UNICODE_WORD_WSEG ? (uint32_t) _UNICODE_WORD_OTHER : base) | zwj, _UNICODE_WORD_CONTINUE);
+
+    if(was_ahletter && is_ahletter)                                             //WB5
+        _UNICODE_WORD_TO(start, _UNICODE_WORD_CONTINUE);
+    if(base == _UNICODE_WORD_HEBREW && word == UNICODE_WORD_BREAK_SINGLE_QUOTE) //WB7a
+        _UNICODE_WORD_TO(_UNICODE_WORD_HEBREW_QUOTE, _UNICODE_WORD_CONTINUE);
+    if(was_ahletter && is_mid_letter)                                           //WB6
+        _UNICODE_WORD_TO(_UNICODE_WORD_LETTER_MID, _UNICODE_WORD_PENDING);
+    if(base == _UNICODE_WORD_HEBREW_QUOTE && is_ahletter)                       //WB7
+        _UNICODE_WORD_TO(start, _UNICODE_WORD_CONTINUE);
+    if(base == _UNICODE_WORD_HEBREW && word == UNICODE_WORD_BREAK_DOUBLE_QUOTE) //WB7b
+        _UNICODE_WORD_TO(_UNICODE_WORD_HEBREW_DQ, _UNICODE_WORD_PENDING);
+    if(base == _UNICODE_WORD_NUMERIC && word == UNICODE_WORD_BREAK_NUMERIC)     //WB8
+        _UNICODE_WORD_TO(start, _UNICODE_WORD_CONTINUE);
+    if(was_ahletter && word == UNICODE_WORD_BREAK_NUMERIC)                      //WB9
+        _UNICODE_WORD_TO(start, _UNICODE_WORD_CONTINUE);
+    if(base == _UNICODE_WORD_NUMERIC && is_ahletter)                            //WB10
+        _UNICODE_WORD_TO(start, _UNICODE_WORD_CONTINUE);
+    if(base == _UNICODE_WORD_NUMERIC && is_mid_num)                             //WB12
+        _UNICODE_WORD_TO(_UNICODE_WORD_NUMERIC_MID, _UNICODE_WORD_PENDING);
+    if(base == _UNICODE_WORD_KATAKANA && word == UNICODE_WORD_BREAK_KATAKANA)   //WB13
+        _UNICODE_WORD_TO(start, _UNICODE_WORD_CONTINUE);
+    if((was_ahletter || base == _UNICODE_WORD_NUMERIC || base == _UNICODE_WORD_KATAKANA || base == _UNICODE_WORD_EXTEND_NUM_LET)
+        && word == UNICODE_WORD_BREAK_EXTEND_NUM_LET)                           //WB13a
+        _UNICODE_WORD_TO(start, _UNICODE_WORD_CONTINUE);
+    if(base == _UNICODE_WORD_EXTEND_NUM_LET && (is_ahletter || word == UNICODE_WORD_BREAK_NUMERIC || word == UNICODE_WORD_BREAK_KATAKANA)) //WB13b
+        _UNICODE_WORD_TO(start, _UNICODE_WORD_CONTINUE);
+    if(base == _UNICODE_WORD_REGIONAL && word == UNICODE_WORD_BREAK_REGIONAL_INDICATOR) //WB15, WB16
+        _UNICODE_WORD_TO(_UNICODE_WORD_OTHER, _UNICODE_WORD_CONTINUE);
+    _UNICODE_WORD_TO(start, _UNICODE_WORD_BREAK);                             //WB999
+    #undef _UNICODE_WORD_TO
+}
+
+INTERNAL char* _unicode_segment_read_entire_file(const char* path)
+{
+    char* data = NULL;
+    FILE* file = fopen(path, "rb");
+    if(file == NULL)
+        fprintf(stderr, "unicode_segment_format_tables_file: error couldn't open file '%s' error: %s\n", path, strerror(errno));
+    else {
+        fseek(file, 0, SEEK_END);
+        long file_size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+        data = (char*) malloc((size_t) (file_size > 0 ? file_size : 0) + 1);
+        if(data == NULL || fread(data, 1, (size_t) file_size, file) != (size_t) file_size) {
+            fprintf(stderr, "unicode_segment_format_tables_file: error couldn't read file '%s' error: %s\n", path, strerror(errno));
+            free(data);
+            data = NULL;
+        }
+        else
+            data[file_size] = '\0';
+        fclose(file);
+    }
+    return data;
+}
+
+//Calls found for every code point of every 'from..to ; Value # comment' line of data whose value is one of values.
+// The index of the value is passed along.
+INTERNAL void _unicode_segment_parse_property(const char* data, const char* const* values, int32_t value_count, uint8_t* out, uint8_t out_offset)
+{
+    for(const char* line = data; line && *line; ) {
+        const char* next = strchr(line, '\n');
+        const char* semicolon = strchr(line, ';');
+        if(*line != '#' && *line != '\n' && semicolon && (next == NULL || semicolon < next)) {
+            char* end = NULL;
+            unsigned long from = strtoul(line, &end, 16);
+            unsigned long to = end[0] == '.' && end[1] == '.' ? strtoul(end + 2, NULL, 16) : from;
+
+            const char* value = semicolon + 1;
+            for(; *value == ' '; value++);
+            size_t value_size = 0;
+            for(; value[value_size] && strchr(" #;\r\n", value[value_size]) == NULL; value_size++);
+
+            for(int32_t v = 0; v < value_count; v++)
+                if(values[v] && strlen(values[v]) == value_size && memcmp(values[v], value, value_size) == 0)
+                    for(unsigned long c = from; c <= to && c <= UTF_MAX; c++)
+                        out[c] = (uint8_t) (v + out_offset);
+        }
+        line = next ? next + 1 : NULL;
+    }
+}
+
+INTERNAL void _unicode_segment_print_bytes(FILE* file, const char* declaration, const uint8_t* bytes, int32_t count)
+{
+    fprintf(file, "%s = {\n", declaration);
+    for(int32_t i = 0; i < count; i++)
+        fprintf(file, "%s%i,%s", i % 32 == 0 ? "    " : "", bytes[i], i % 32 == 31 || i == count - 1 ? "\n" : "");
+    fprintf(file, "};\n\n");
+}
+
+EXTERNAL bool unicode_segment_format_tables_file(const char* grapheme_break, const char* word_break, const char* emoji_data, const char* unicode_data, const char* out)
+{
+    static const char* const grapheme_names[UNICODE_GRAPHEME_BREAK_COUNT] = {
+        "Other", "CR", "LF", "Control", "Extend", "ZWJ", "Regional_Indicator", "Prepend", "SpacingMark", "L", "V", "T", "LV", "LVT",
+    };
+    static const char* const word_names[UNICODE_WORD_BREAK_COUNT] = {
+        "Other", "CR", "LF", "Newline", "Extend", "ZWJ", "Regional_Indicator", "Format", "Katakana", "Hebrew_Letter", "ALetter",
+        "Single_Quote", "Double_Quote", "MidNumLet", "MidLetter", "MidNum", "Numeric", "ExtendNumLet", "WSegSpace",
+    };
+    static const char* const pictographic_names[1] = {"Extended_Pictographic"};
+    enum {CODEPOINTS = UTF_MAX + 1, BLOCK = 1 << UNICODE_SEGMENT_BLOCK_SHIFT, BLOCK_COUNT = CODEPOINTS/BLOCK};
+
+    char* grapheme_data = _unicode_segment_read_entire_file(grapheme_break);
+    char* word_data = _unicode_segment_read_entire_file(word_break);
+    char* emoji = _unicode_segment_read_entire_file(emoji_data);
+    char* unicode = _unicode_segment_read_entire_file(unicode_data);
+    FILE* file = grapheme_data && word_data && emoji && unicode ? fopen(out, "wb") : NULL;
+    if(file == NULL) {
+        free(grapheme_data); free(word_data); free(emoji); free(unicode);
+        return false;
+    }
+
+    uint8_t* graphemes = (uint8_t*) calloc(CODEPOINTS, 1);
+    uint8_t* words = (uint8_t*) calloc(CODEPOINTS, 1);
+    uint8_t* pictographic = (uint8_t*) calloc(CODEPOINTS, 1);
+    uint8_t* property_of = (uint8_t*) calloc(CODEPOINTS, 1);
+    uint8_t* indices = (uint8_t*) calloc(CODEPOINTS, 1);
+    uint8_t* blocks = (uint8_t*) calloc(BLOCK_COUNT, 1);
+    _unicode_segment_parse_property(grapheme_data, grapheme_names, UNICODE_GRAPHEME_BREAK_COUNT, graphemes, 0);
+    _unicode_segment_parse_property(word_data, word_names, UNICODE_WORD_BREAK_COUNT, words, 0);
+    _unicode_segment_parse_property(emoji, pictographic_names, 1, pictographic, 1);
+
+    //UnicodeData.txt: code;name;category;... Ranges are given by a pair of lines with names ending in First> and Last>.
+    uint32_t range_from = 0;
+    for(char* line = unicode; line && *line; ) {
+        char* next = strchr(line, '\n');
+        char* name = strchr(line, ';');
+        char* category = name ? strchr(name + 1, ';') : NULL;
+        if(category && (next == NULL || category < next)) {
+            uint32_t codepoint = (uint32_t) strtoul(line, NULL, 16);
+            bool is_first = category - name > 7 && memcmp(category - 7, "First>", 6) == 0;
+            uint32_t from = category - name > 6 && memcmp(category - 6, "Last>", 5) == 0 ? range_from : codepoint;
+            range_from = codepoint;
+            if(category[1] == 'L' && is_first == false)
+                for(uint32_t c = from; c <= codepoint && c <= UTF_MAX; c++)
+                    if(words[c] == UNICODE_WORD_BREAK_OTHER)
+                        words[c] = UNICODE_WORD_BREAK_OTHER_LETTER;
+        }
+        line = next ? next + 1 : NULL;
+    }
+
+    //Extended_Pictographic is only ever Other or ALetter (of the classes that matter)
+    int32_t property_count = 0;
+    Unicode_Segment_Property properties[256] = {0};
+    for(uint32_t c = 0; c < CODEPOINTS; c++) {
+        if(pictographic[c]) {
+            ASSERT(graphemes[c] == UNICODE_GRAPHEME_OTHER);
+            graphemes[c] = UNICODE_GRAPHEME_EXTENDED_PICTOGRAPHIC;
+            if(words[c] == UNICODE_WORD_BREAK_ALETTER)
+                words[c] = UNICODE_WORD_BREAK_ALETTER_PICTOGRAPHIC;
+            else if(words[c] == UNICODE_WORD_BREAK_OTHER || words[c] == UNICODE_WORD_BREAK_OTHER_LETTER)
+                words[c] = UNICODE_WORD_BREAK_EXTENDED_PICTOGRAPHIC;
+            else
+                ASSERT(false);
+        }
+
+        Unicode_Segment_Property property = {graphemes[c], words[c]};
+        int32_t found = 0;
+        for(; found < property_count; found++)
+            if(properties[found].grapheme == property.grapheme && properties[found].word == property.word)
+                break;
+        if(found == property_count) {
+            ASSERT(property_count < 256);
+            properties[property_count++] = property;
+        }
+        property_of[c] = (uint8_t) found;
+    }
+
+    //Two stage table: identical blocks are stored once
+    int32_t block_count = 0;
+    for(int32_t b = 0; b < BLOCK_COUNT; b++) {
+        const uint8_t* block = property_of + b*BLOCK;
+        int32_t found = 0;
+        for(; found < block_count; found++)
+            if(memcmp(indices + found*BLOCK, block, BLOCK) == 0)
+                break;
+        if(found == block_count)
+            memcpy(indices + block_count++*BLOCK, block, BLOCK);
+        ASSERT(found < 256);
+        blocks[b] = (uint8_t) found;
+    }
+
+    uint8_t grapheme_ascii[128] = {0};
+    uint8_t word_ascii[128] = {0};
+    for(int32_t c = 0; c < 128; c++) {
+        grapheme_ascii[c] = graphemes[c];
+        word_ascii[c] = words[c];
+    }
+
+    printf("unicode_segment_format_tables_file: %i properties, %i blocks\n", property_count, block_count);
+
+    char declaration[256] = {0};
+    snprintf(declaration, sizeof declaration, "const uint8_t UNICODE_SEGMENT_BLOCKS[%i]", BLOCK_COUNT);
+    _unicode_segment_print_bytes(file, declaration, blocks, BLOCK_COUNT);
+    snprintf(declaration, sizeof declaration, "const uint8_t UNICODE_SEGMENT_INDICES[%i]", block_count*BLOCK);
+    _unicode_segment_print_bytes(file, declaration, indices, block_count*BLOCK);
+
+    fprintf(file, "const Unicode_Segment_Property UNICODE_SEGMENT_PROPERTIES[%i] = { //grapheme, word\n", property_count);
+    for(int32_t i = 0; i < property_count; i++)
+        fprintf(file, "%s{%i,%i},%s", i % 8 == 0 ? "    " : " ", properties[i].grapheme, properties[i].word, i % 8 == 7 || i == property_count - 1 ? "\n" : "");
+    fprintf(file, "};\n\n");
+
+    _unicode_segment_print_bytes(file, "const uint8_t UNICODE_GRAPHEME_ASCII[128]", grapheme_ascii, 128);
+    _unicode_segment_print_bytes(file, "const uint8_t UNICODE_WORD_ASCII[128]", word_ascii, 128);
+
+    fprintf(file, "const uint8_t UNICODE_GRAPHEME_DFA[%i][UNICODE_GRAPHEME_BREAK_COUNT] = {\n", _UNICODE_GRAPHEME_STATE_COUNT);
+    for(uint32_t state = 0; state < _UNICODE_GRAPHEME_STATE_COUNT; state++) {
+        fprintf(file, "    {");
+        for(uint32_t grapheme = 0; grapheme < UNICODE_GRAPHEME_BREAK_COUNT; grapheme++)
+            fprintf(file, "%i,", _unicode_grapheme_transition(state, grapheme));
+        fprintf(file, "},\n");
+    }
+    fprintf(file, "};\n\n");
+
+    fprintf(file, "const uint8_t UNICODE_WORD_DFA[%i][UNICODE_WORD_BREAK_COUNT] = {\n", _UNICODE_WORD_STATE_COUNT);
+    for(uint32_t state = 0; state < _UNICODE_WORD_STATE_COUNT; state++) {
+        fprintf(file, "    {");
+        for(uint32_t word = 0; word < UNICODE_WORD_BREAK_COUNT; word++)
+            fprintf(file, "%i,", _unicode_word_transition(state, word));
+        fprintf(file, "},\n");
+    }
+    fprintf(file, "};\n");
+
+    fclose(file);
+    free(graphemes); free(words); free(pictographic); free(property_of); free(indices); free(blocks);
+    free(grapheme_data); free(word_data); free(emoji); free(unicode);
+    return true;
+}
+
+//=========================================================================
+//The reminder of the file is generated by the script above from the Unicode 14.0 data (see the top of the file).
+//You should probably not be modifying it
+//=========================================================================
+const uint8_t UNICODE_SEGMENT_BLOCKS[8704] = {
+    0,1,2,2,2,3,4,5,2,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,
+    29,30,31,32,33,34,35,36,37,2,2,2,38,39,40,41,42,43,44,45,46,47,48,49,50,51,2,52,2,2,53,54,
+    55,56,57,58,59,59,60,61,59,62,59,63,64,65,66,67,59,59,68,59,59,59,69,59,2,70,71,72,73,59,59,59,
+    74,75,76,77,59,78,79,59,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,81,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    2,2,2,2,2,2,2,2,2,82,2,2,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,95,
+    96,97,98,99,100,101,95,96,97,98,99,100,101,95,96,97,98,99,100,101,95,96,97,98,99,100,101,95,96,97,98,99,
+    100,101,95,96,97,98,99,100,101,95,96,97,98,99,100,101,95,96,97,98,99,100,101,95,96,97,98,99,100,101,95,96,
+    97,98,99,100,101,95,96,97,98,99,100,101,95,96,97,102,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,80,80,103,104,105,106,2,2,107,108,109,110,111,112,
+    113,114,115,116,59,117,118,119,2,120,121,122,2,2,123,124,125,126,127,128,129,130,131,132,133,134,135,59,59,136,137,138,
+    139,140,141,142,143,144,145,59,146,147,59,148,149,150,151,59,152,153,154,155,156,157,59,59,158,159,160,161,59,162,59,163,
+    2,2,2,2,2,2,2,164,165,2,166,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,167,
+    2,2,2,2,2,2,2,2,168,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,2,2,2,2,169,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,2,2,2,2,170,171,172,173,59,59,59,59,174,59,175,176,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,177,80,80,80,80,80,80,80,80,80,178,179,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,180,
+    181,80,182,80,80,183,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,184,185,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,186,59,
+    59,59,187,188,189,59,59,59,190,191,192,2,2,193,194,195,59,59,59,59,196,197,59,59,59,59,59,59,59,59,198,59,
+    199,59,200,59,59,201,59,59,59,59,59,59,59,59,59,202,2,203,204,59,59,59,59,59,59,59,59,59,205,206,59,59,
+    207,207,208,209,210,207,207,211,207,207,212,207,213,207,214,215,216,217,218,207,207,207,59,219,207,207,207,207,207,207,207,220,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,221,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,222,80,223,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,224,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,225,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,80,80,80,80,226,59,59,59,59,59,59,59,59,59,59,59,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    80,80,80,80,80,80,227,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    228,229,230,231,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+    59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+};
+
+const uint8_t UNICODE_SEGMENT_INDICES[29696] = {
+    0,0,0,0,0,0,0,0,0,0,1,2,2,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    4,5,6,5,5,5,5,7,5,5,5,5,8,5,9,5,10,10,10,10,10,10,10,10,10,10,11,8,5,5,5,5,
+    5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,13,
+    5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,0,
+    0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    5,5,5,5,5,5,5,5,5,14,12,5,5,15,14,5,5,5,5,5,5,12,5,11,5,5,12,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,12,12,12,12,12,5,12,12,5,5,12,12,12,12,8,12,
+    5,5,5,5,5,5,12,11,12,12,12,5,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,
+    12,12,5,16,16,16,16,16,16,16,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,12,12,12,12,5,12,11,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,8,12,5,5,5,5,5,5,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,5,16,
+    5,16,16,5,16,16,5,16,5,5,5,5,5,5,5,5,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+    17,17,17,17,17,17,17,17,17,17,17,5,5,5,5,17,17,17,17,12,11,5,5,5,5,5,5,5,5,5,5,5,
+    18,18,18,18,18,18,5,5,5,5,5,5,8,8,5,5,16,16,16,16,16,16,16,16,16,16,16,5,15,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    10,10,10,10,10,10,10,10,10,10,5,10,8,5,12,12,16,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,16,16,16,16,16,16,16,18,5,16,
+    16,16,16,16,16,12,12,16,16,5,16,16,16,16,12,12,10,10,10,10,10,10,10,10,10,10,12,12,12,5,5,12,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,18,12,16,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,16,16,16,16,16,16,16,16,16,16,16,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    10,10,10,10,10,10,10,10,10,10,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,16,16,16,16,16,16,16,16,16,12,12,5,5,8,5,12,5,5,16,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,16,16,12,16,16,16,16,16,
+    16,16,16,16,12,16,16,16,12,16,16,16,16,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,16,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,5,18,18,5,5,5,5,5,5,16,16,16,16,16,16,16,16,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,18,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,19,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,19,16,12,19,19,
+    19,16,16,16,16,16,16,16,16,19,19,19,19,16,19,19,12,16,16,16,16,16,16,16,12,12,12,12,12,12,12,12,
+    12,12,16,16,5,5,10,10,10,10,10,10,10,10,10,10,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,16,19,19,5,12,12,12,12,12,12,12,12,5,5,12,12,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,5,12,5,5,5,12,12,12,12,5,5,16,12,16,19,
+    19,16,16,16,16,5,5,19,19,5,5,19,19,16,12,5,5,5,5,5,5,5,5,16,5,5,5,5,12,12,5,12,
+    12,12,16,16,5,5,10,10,10,10,10,10,10,10,10,10,12,12,5,5,5,5,5,5,5,5,5,5,12,5,16,5,
+    5,16,16,19,5,12,12,12,12,12,12,5,5,5,5,12,12,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,5,12,12,5,12,12,5,12,12,5,5,16,5,19,19,
+    19,16,16,5,5,5,5,16,16,5,5,16,16,16,5,5,5,16,5,5,5,5,5,5,5,12,12,12,12,5,12,5,
+    5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,16,16,12,12,12,16,5,5,5,5,5,5,5,5,5,5,
+    5,16,16,19,5,12,12,12,12,12,12,12,12,12,5,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,5,12,12,5,12,12,12,12,12,5,5,16,12,19,19,
+    19,16,16,16,16,16,5,16,16,19,5,19,19,16,5,5,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,16,16,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,5,5,5,12,16,16,16,16,16,16,
+    5,16,19,19,5,12,12,12,12,12,12,12,12,5,5,12,12,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,5,12,12,5,12,12,12,12,12,5,5,16,12,16,16,
+    19,16,16,16,16,5,5,19,19,5,5,19,19,16,5,5,5,5,5,5,5,16,16,16,5,5,5,5,12,12,5,12,
+    12,12,16,16,5,5,10,10,10,10,10,10,10,10,10,10,5,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,16,12,5,12,12,12,12,12,12,5,5,5,12,12,12,5,12,12,12,12,5,5,5,12,12,5,12,5,12,12,
+    5,5,5,12,12,5,5,5,12,12,12,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,16,19,
+    16,19,19,5,5,5,19,19,19,5,19,19,19,16,5,5,12,5,5,5,5,5,5,16,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    16,19,19,19,16,12,12,12,12,12,12,12,12,5,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,16,12,16,16,
+    16,19,19,19,19,5,16,16,16,5,16,16,16,16,5,5,5,5,5,5,5,16,16,5,12,12,12,5,5,12,5,5,
+    12,12,16,16,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,16,19,19,5,12,12,12,12,12,12,12,12,5,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,5,5,16,12,19,16,
+    19,19,16,19,19,5,16,19,19,5,19,19,16,16,5,5,5,5,5,5,5,16,16,5,5,5,5,5,5,12,12,5,
+    12,12,16,16,5,5,10,10,10,10,10,10,10,10,10,10,5,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    16,16,19,19,12,12,12,12,12,12,12,12,12,5,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,12,16,19,
+    19,16,16,16,16,5,19,19,19,5,19,19,19,16,20,5,5,5,5,5,12,12,12,16,5,5,5,5,5,5,5,12,
+    12,12,16,16,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,
+    5,16,19,19,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,5,12,5,5,
+    12,12,12,12,12,12,12,5,5,5,16,5,5,5,5,16,19,19,16,16,16,5,16,5,19,19,19,19,19,19,19,16,
+    5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,19,19,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,16,21,22,16,16,16,16,16,16,16,5,5,5,5,5,
+    21,21,21,21,21,21,21,16,16,16,16,16,16,16,16,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,21,21,5,21,5,21,21,21,21,21,5,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,5,21,5,21,21,21,21,21,21,21,21,21,21,16,21,22,16,16,16,16,16,16,16,16,16,21,5,5,
+    21,21,21,21,21,5,21,5,16,16,16,16,16,16,5,5,10,10,10,10,10,10,10,10,10,10,5,5,21,21,21,21,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,16,16,5,5,5,5,5,5,
+    10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,5,5,5,5,5,16,5,16,5,16,5,5,5,5,19,19,
+    12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,16,16,16,16,16,16,16,16,16,16,16,16,16,16,19,
+    16,16,16,16,16,5,16,16,12,12,12,12,12,16,16,16,16,16,16,16,16,16,16,16,5,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,5,5,5,
+    5,5,5,5,5,5,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,23,23,16,16,16,16,19,16,16,16,16,16,16,23,16,16,19,19,16,16,21,
+    10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,21,21,21,21,21,21,19,19,16,16,21,21,21,21,16,16,
+    16,21,23,23,23,21,21,23,23,23,23,23,23,23,21,21,21,16,16,16,16,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,16,23,19,16,16,23,23,23,23,23,23,16,21,23,10,10,10,10,10,10,10,10,10,10,23,23,23,16,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,5,12,5,5,5,5,5,12,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+    25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+    25,25,25,25,25,25,25,25,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,5,12,12,12,12,5,5,12,12,12,12,12,12,12,5,12,5,12,12,12,12,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,5,12,12,12,12,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,5,5,12,12,12,12,12,12,12,5,
+    12,5,12,12,12,12,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,5,5,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,16,16,16,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,12,12,12,12,12,12,5,5,
+    5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    4,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,5,5,5,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,16,19,5,5,5,5,5,5,5,5,5,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,19,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,5,16,16,5,5,5,5,5,5,5,5,5,5,5,5,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,16,16,19,16,16,16,16,16,16,16,19,19,
+    19,19,19,19,19,19,16,19,19,16,16,16,16,16,16,16,16,16,16,16,5,5,5,21,5,5,5,5,21,16,5,5,
+    10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,16,16,16,15,16,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,
+    12,12,12,12,12,16,16,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,16,12,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,
+    16,16,16,19,19,19,19,16,16,19,19,19,5,5,5,5,19,19,16,19,19,19,19,19,19,16,16,16,5,5,5,5,
+    5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,5,5,21,21,21,21,21,5,5,5,5,5,5,5,5,5,5,5,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,5,5,5,5,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,19,19,16,5,5,5,5,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,19,16,19,16,16,16,16,16,16,16,5,
+    16,23,16,23,23,16,16,16,16,16,16,16,16,19,19,19,19,19,19,16,16,16,16,16,16,16,16,16,16,5,5,16,
+    10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,21,5,5,5,5,5,5,5,5,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    16,16,16,16,19,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,16,16,16,16,16,19,16,19,19,19,
+    19,19,16,19,19,12,12,12,12,12,12,12,12,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,16,16,16,16,16,16,16,16,16,5,5,5,5,5,5,5,5,5,5,5,5,
+    16,16,19,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,19,16,16,16,16,19,19,16,16,19,16,16,16,12,12,10,10,10,10,10,10,10,10,10,10,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,16,19,16,16,19,19,19,16,19,16,16,16,19,19,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,19,19,19,19,19,19,19,19,16,16,16,16,16,16,16,16,19,19,16,16,5,5,5,5,5,5,5,5,
+    10,10,10,10,10,10,10,10,10,10,5,5,5,12,12,12,10,10,10,10,10,10,10,10,10,10,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,
+    12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,12,12,12,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,16,16,16,5,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,19,16,16,16,16,16,16,16,12,12,12,12,16,12,12,12,12,12,12,16,12,12,19,16,16,12,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,12,12,12,12,12,12,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,5,5,12,12,12,12,12,12,5,5,12,12,12,12,12,12,12,12,5,12,5,12,5,12,5,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,5,12,5,
+    5,5,12,12,12,5,12,12,12,12,12,12,12,5,5,5,12,12,12,12,5,5,12,12,12,12,12,12,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,12,12,12,5,12,12,12,12,12,12,12,5,5,5,
+    4,4,4,4,4,4,4,5,4,4,4,0,16,27,15,15,5,5,5,5,5,5,5,5,9,9,5,5,5,5,5,5,
+    5,5,5,5,9,5,5,11,2,2,15,15,15,15,15,13,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,13,
+    13,5,5,5,8,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,13,5,5,5,5,5,5,5,5,5,5,4,
+    15,15,15,15,15,0,15,15,15,15,15,15,15,15,15,15,5,12,5,5,5,5,5,5,5,5,5,5,5,5,5,12,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,12,5,5,5,5,12,5,5,12,12,12,12,12,12,12,12,12,12,5,12,5,5,5,12,12,12,12,12,5,5,
+    5,5,14,5,12,5,12,5,12,5,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,28,5,5,12,12,12,12,
+    5,5,5,5,5,12,12,12,12,12,5,5,5,5,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,14,14,14,14,14,14,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,14,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,5,5,5,5,
+    5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,14,14,14,14,14,14,14,14,14,14,14,5,5,5,5,14,14,14,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,
+    12,12,28,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,14,14,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,
+    14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,14,14,5,
+    14,14,14,14,14,14,5,14,14,14,14,14,14,14,14,14,14,14,14,5,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,5,5,5,5,5,5,5,5,5,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,5,5,14,14,14,14,14,14,14,14,14,14,14,5,14,5,14,5,5,5,5,5,5,14,5,5,
+    5,14,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,14,14,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,14,5,5,14,5,5,5,5,14,5,14,5,5,5,5,14,14,14,5,14,5,5,5,5,5,5,5,5,
+    5,5,5,14,14,14,14,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,14,5,5,5,5,5,5,5,5,
+    5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,14,14,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,5,5,5,5,5,5,12,12,12,12,16,16,16,12,12,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,5,12,5,5,5,5,5,12,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,16,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,5,
+    12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,5,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    4,5,5,5,5,12,21,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,16,16,16,16,16,16,14,29,29,29,29,29,5,5,5,5,5,12,12,14,5,5,
+    5,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,5,5,16,16,29,29,21,21,21,
+    29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+    29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+    29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,5,29,29,29,29,
+    5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,14,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+    29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,5,
+    29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+    29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+    29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    10,10,10,10,10,10,10,10,10,10,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,16,16,5,16,16,16,16,16,16,16,16,16,16,5,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,12,12,5,12,5,12,12,12,12,12,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,16,12,12,12,16,12,12,12,12,16,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,19,19,16,16,19,5,5,5,5,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,
+    19,19,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,19,19,19,19,19,19,19,19,19,19,19,19,
+    19,19,19,19,16,16,5,5,5,5,5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,12,12,12,12,12,12,5,5,5,12,5,12,12,16,
+    10,10,10,10,10,10,10,10,10,10,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,16,16,16,16,16,16,16,16,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,16,16,16,16,16,16,16,16,16,16,16,19,19,5,5,5,5,5,5,5,5,5,5,5,5,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,5,5,5,
+    16,16,16,19,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,19,19,16,16,16,16,19,19,16,16,19,19,
+    19,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    21,21,21,21,21,16,21,21,21,21,21,21,21,21,21,21,10,10,10,10,10,10,10,10,10,10,21,21,21,21,21,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,16,16,16,16,16,16,19,19,16,16,19,19,16,16,5,5,5,5,5,5,5,5,5,
+    12,12,12,16,12,12,12,12,12,12,12,12,16,19,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,5,5,5,21,23,16,23,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,16,21,16,16,16,21,21,16,16,21,21,21,21,21,16,16,
+    21,16,21,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,21,21,21,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,19,16,16,19,19,5,5,12,12,12,19,16,5,5,5,5,5,5,5,5,5,
+    5,12,12,12,12,12,12,5,5,12,12,12,12,12,12,5,5,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,19,19,16,19,19,16,19,19,5,19,16,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,
+    31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,
+    31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,
+    31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,
+    31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,
+    31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,
+    31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,
+    31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,
+    31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,31,31,31,31,30,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    31,31,31,31,5,5,5,5,5,5,5,5,5,5,5,5,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+    25,25,25,25,25,25,25,5,5,5,5,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,5,5,5,5,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,5,5,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,5,5,5,5,5,17,16,17,
+    17,17,17,17,17,17,17,17,17,5,17,17,17,17,17,17,17,17,17,17,17,17,17,5,17,17,17,17,17,5,17,5,
+    17,17,5,17,17,5,17,17,17,17,17,17,17,17,17,17,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,8,5,5,11,8,5,5,5,5,5,5,5,5,5,5,5,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,5,5,5,13,13,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,13,8,5,9,5,8,11,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,15,
+    5,5,5,5,5,5,5,9,5,5,5,5,8,5,9,5,10,10,10,10,10,10,10,10,10,10,11,8,5,5,5,5,
+    5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,13,
+    5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,
+    5,5,5,5,5,5,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+    29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,16,16,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,
+    5,5,12,12,12,12,12,12,5,5,12,12,12,12,12,12,5,5,12,12,12,12,12,12,5,5,12,12,12,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,15,15,15,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,5,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,16,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,16,16,16,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,5,5,5,5,12,12,12,12,12,12,12,12,5,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,
+    10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,5,12,12,5,12,12,12,12,12,12,12,12,12,
+    12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,5,12,12,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,5,5,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,5,5,5,12,5,5,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,12,12,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,16,16,16,5,16,16,5,5,5,5,5,16,16,16,16,12,12,12,12,5,12,12,12,5,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,16,16,16,5,5,5,5,16,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,16,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,16,16,16,16,5,5,5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,5,16,16,5,5,5,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,
+    5,5,5,5,5,5,5,12,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,16,16,16,16,16,16,16,16,16,16,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,16,16,16,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,
+    19,16,19,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,16,12,12,16,16,12,5,5,5,5,5,5,5,5,5,16,
+    16,16,19,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,19,19,19,16,16,16,16,19,19,16,16,5,5,18,5,5,
+    5,5,16,5,5,5,5,5,5,5,5,5,5,18,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    16,16,16,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,16,16,16,16,16,19,16,16,16,16,16,16,16,16,5,10,10,10,10,10,10,10,10,10,10,
+    5,5,5,5,12,19,19,12,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,5,5,12,5,5,5,5,5,5,5,5,5,
+    16,16,19,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,19,19,19,16,16,16,16,16,16,16,16,16,19,
+    19,12,20,20,12,5,5,5,5,16,16,16,16,5,19,16,10,10,10,10,10,10,10,10,10,10,12,5,12,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,19,19,19,16,16,16,19,19,16,19,16,16,5,5,5,5,5,5,16,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,5,12,5,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,
+    12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,
+    19,19,19,16,16,16,16,16,16,16,16,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    16,16,19,19,5,12,12,12,12,12,12,12,12,5,5,12,12,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,5,12,12,5,12,12,12,12,12,5,16,16,12,16,19,
+    16,19,19,19,19,5,5,19,19,5,5,19,19,19,5,5,12,5,5,5,5,5,5,16,5,5,5,5,5,12,12,12,
+    12,12,19,19,5,5,16,16,16,16,16,16,16,5,5,5,16,16,16,16,16,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,19,19,19,16,16,16,16,16,16,16,16,
+    19,19,16,16,16,19,16,12,12,12,12,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,16,12,
+    12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,19,19,16,16,16,16,16,16,19,16,19,19,16,19,16,
+    16,19,16,16,12,12,5,12,5,5,5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,19,19,16,16,16,16,5,5,19,19,19,19,16,16,19,16,
+    16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,16,16,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,19,19,19,16,16,16,16,16,16,16,16,19,19,16,19,16,
+    16,5,5,5,12,5,5,5,5,5,5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,16,19,16,19,19,16,16,16,16,16,16,19,16,12,5,5,5,5,5,5,5,
+    10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,5,5,16,16,16,
+    23,23,16,16,16,16,19,16,16,16,16,16,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    21,21,21,21,21,21,21,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,19,19,19,16,16,16,16,16,16,16,16,16,19,16,16,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,
+    12,12,12,12,12,12,12,5,5,12,5,5,12,12,12,12,12,12,12,12,5,12,12,5,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,19,19,19,19,19,5,19,19,5,5,16,16,19,16,20,
+    19,20,19,16,5,5,5,5,5,5,5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,19,19,19,16,16,16,16,5,5,16,16,19,19,19,19,
+    16,12,5,12,19,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,16,16,16,16,16,16,16,16,16,16,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,16,16,16,16,19,20,16,16,16,16,5,
+    5,5,5,5,5,5,5,16,5,5,5,5,5,5,5,5,12,16,16,16,16,16,16,19,19,16,16,16,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,20,20,20,20,20,20,16,16,16,16,16,16,16,16,16,16,16,16,16,19,16,16,5,5,5,12,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,19,16,16,16,16,16,16,16,5,16,16,16,16,16,16,19,16,
+    12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,5,19,16,16,16,16,16,16,16,19,16,16,19,16,16,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,5,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,16,16,16,16,5,5,5,16,5,16,16,5,16,
+    16,16,16,16,16,16,20,16,5,5,5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    12,12,12,12,12,12,5,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,19,19,19,19,19,5,16,16,5,19,19,16,19,16,12,5,5,5,5,5,5,5,
+    10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,19,19,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,15,15,15,15,15,15,15,15,15,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,
+    10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,
+    10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,16,16,16,16,16,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16,16,16,16,16,16,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,16,12,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+    19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+    19,19,19,19,19,19,19,19,5,5,5,5,5,5,5,16,16,16,16,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,5,12,16,5,5,5,5,5,5,5,5,5,5,5,19,19,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,5,5,5,5,5,5,5,5,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    21,21,21,21,21,21,21,21,21,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,29,29,29,29,5,29,29,29,29,29,29,29,5,29,29,5,
+    29,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    29,29,29,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,21,21,21,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,29,29,29,29,5,5,5,5,5,5,5,5,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,
+    12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,5,5,5,16,16,5,
+    15,15,15,15,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,5,5,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,16,19,16,16,16,5,5,5,19,16,16,16,16,16,15,15,15,15,15,15,15,15,16,16,16,16,16,
+    16,16,16,5,5,16,16,16,16,16,16,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,16,16,16,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,16,16,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,
+    5,5,12,5,5,12,12,5,5,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,5,12,5,12,12,12,
+    12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,5,12,12,12,12,5,5,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,5,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,5,
+    12,12,12,12,12,5,12,5,5,5,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,5,12,12,12,12,12,12,12,12,5,5,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,5,5,5,5,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,5,5,5,5,5,5,5,5,16,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,16,16,16,16,16,
+    5,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    16,16,16,16,16,16,16,5,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,5,5,16,16,16,16,16,
+    16,16,5,16,16,5,16,16,16,16,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,16,16,16,16,16,16,16,12,12,12,12,12,12,12,5,5,
+    10,10,10,10,10,10,10,10,10,10,5,5,5,5,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,16,16,16,16,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,5,12,12,12,12,5,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,16,16,16,16,16,16,16,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,16,16,16,16,16,16,16,12,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    5,12,12,5,12,5,5,12,5,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,5,12,5,12,5,5,5,5,
+    5,5,12,5,5,5,5,12,5,12,5,12,5,12,12,12,5,12,12,5,12,5,5,12,5,12,5,12,5,12,5,12,
+    5,12,12,5,12,5,5,12,12,12,12,5,12,12,12,12,12,12,12,5,12,12,12,12,5,12,12,12,12,5,12,5,
+    12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,
+    5,12,12,12,5,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,5,5,14,14,14,14,28,28,12,12,12,12,12,12,12,12,12,12,12,12,28,28,
+    12,12,12,12,12,12,12,12,12,12,5,5,5,5,14,5,5,14,14,14,14,14,14,14,14,14,14,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,14,14,14,14,14,14,14,14,14,5,14,14,14,14,
+    5,5,5,5,5,5,5,5,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,16,16,16,16,16,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,5,5,
+    5,5,5,5,5,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,14,14,14,14,14,14,14,14,14,14,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    5,5,5,5,5,5,5,5,5,5,5,5,14,14,14,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,14,14,14,14,14,14,14,14,5,5,5,5,5,5,5,5,5,5,14,14,14,14,14,14,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,14,14,14,14,14,14,14,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    5,5,5,5,5,5,5,5,5,5,5,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,5,14,14,14,14,
+    14,14,14,14,14,14,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,5,5,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,5,5,5,5,5,5,5,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,5,5,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,5,5,5,5,5,5,5,5,5,5,5,5,5,5,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    0,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+const Unicode_Segment_Property UNICODE_SEGMENT_PROPERTIES[33] = { //grapheme, word
+    {3,0}, {2,2}, {3,3}, {1,1}, {0,18}, {0,0}, {0,12}, {0,11},
+    {0,15}, {0,13}, {0,16}, {0,14}, {0,10}, {0,17}, {14,19}, {3,7},
+    {4,4}, {0,9}, {7,7}, {8,4}, {7,10}, {0,21}, {8,21}, {0,4},
+    {9,10}, {10,10}, {11,10}, {5,5}, {14,20}, {0,8}, {12,10}, {13,10},
+    {6,6},
+};
+
+const uint8_t UNICODE_GRAPHEME_ASCII[128] = {
+    3,3,3,3,3,3,3,3,3,3,2,3,3,1,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,
+};
+
+const uint8_t UNICODE_WORD_ASCII[128] = {
+    0,0,0,0,0,0,0,0,0,0,2,3,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    18,0,12,0,0,0,0,11,0,0,0,0,15,0,13,0,16,16,16,16,16,16,16,16,16,16,14,15,0,0,0,0,
+    0,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,0,0,0,0,17,
+    0,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,0,0,0,0,0,
+};
+
+const uint8_t UNICODE_GRAPHEME_DFA[11][UNICODE_GRAPHEME_BREAK_COUNT] = {
+    {3,1,2,2,3,3,8,7,3,4,5,6,5,6,9,},
+    {131,129,2,130,131,131,136,135,131,132,133,134,133,134,137,},
+    {131,129,130,130,131,131,136,135,131,132,133,134,133,134,137,},
+    {131,129,130,130,3,3,136,135,3,132,133,134,133,134,137,},
+    {131,129,130,130,3,3,136,135,3,4,5,134,5,6,137,},
+    {131,129,130,130,3,3,136,135,3,132,5,6,133,134,137,},
+    {131,129,130,130,3,3,136,135,3,132,133,6,133,134,137,},
+    {3,129,130,130,3,3,8,7,3,4,5,6,5,6,9,},
+    {131,129,130,130,3,3,3,135,3,132,133,134,133,134,137,},
+    {131,129,130,130,9,10,136,135,3,132,133,134,133,134,137,},
+    {131,129,130,130,3,3,136,135,3,132,133,134,133,134,9,},
+};
+
+const uint8_t UNICODE_WORD_DFA[32][UNICODE_WORD_BREAK_COUNT] = {
+    {3,1,2,2,3,19,9,3,7,5,4,3,3,3,3,3,6,8,10,3,4,3,},
+    {67,65,2,66,67,83,73,67,71,69,68,67,67,67,67,67,70,72,74,67,68,67,},
+    {67,65,66,66,67,83,73,67,71,69,68,67,67,67,67,67,70,72,74,67,68,67,},
+    {67,65,66,66,3,19,73,3,71,69,68,67,67,67,67,67,70,72,74,67,68,67,},
+    {67,65,66,66,4,20,73,4,71,5,4,140,67,140,140,67,6,8,74,67,4,67,},
+    {67,65,66,66,5,21,73,5,71,5,4,11,141,140,140,67,6,8,74,67,4,67,},
+    {67,65,66,66,6,22,73,6,71,5,4,142,67,142,67,142,6,8,74,67,4,67,},
+    {67,65,66,66,7,23,73,7,7,69,68,67,67,67,67,67,70,8,74,67,68,67,},
+    {67,65,66,66,8,24,73,8,7,5,4,67,67,67,67,67,6,8,74,67,4,67,},
+    {67,65,66,66,9,25,3,9,71,69,68,67,67,67,67,67,70,72,74,67,68,67,},
+    {67,65,66,66,3,19,73,3,71,69,68,67,67,67,67,67,70,72,10,67,68,67,},
+    {67,65,66,66,11,27,73,11,71,5,4,67,67,67,67,67,70,72,74,67,4,67,},
+    {192,192,192,192,12,28,192,12,192,5,4,192,192,192,192,192,192,192,192,192,4,192,},
+    {192,192,192,192,13,29,192,13,192,5,192,192,192,192,192,192,192,192,192,192,192,192,},
+    {192,192,192,192,14,30,192,14,192,192,192,192,192,192,192,192,6,192,192,192,192,192,},
+    {192,192,192,192,15,31,192,15,192,192,192,192,192,192,192,192,192,192,192,192,192,192,},
+    {3,1,2,2,3,19,9,3,7,5,4,3,3,3,3,3,6,8,10,3,4,3,},
+    {67,65,2,66,67,83,73,67,71,69,68,67,67,67,67,67,70,72,74,67,68,67,},
+    {67,65,66,66,67,83,73,67,71,69,68,67,67,67,67,67,70,72,74,67,68,67,},
+    {67,65,66,66,3,19,73,3,71,69,68,67,67,67,67,67,70,72,74,3,4,67,},
+    {67,65,66,66,4,20,73,4,71,5,4,140,67,140,140,67,6,8,74,3,4,67,},
+    {67,65,66,66,5,21,73,5,71,5,4,11,141,140,140,67,6,8,74,3,4,67,},
+    {67,65,66,66,6,22,73,6,71,5,4,142,67,142,67,142,6,8,74,3,4,67,},
+    {67,65,66,66,7,23,73,7,7,69,68,67,67,67,67,67,70,8,74,3,4,67,},
+    {67,65,66,66,8,24,73,8,7,5,4,67,67,67,67,67,6,8,74,3,4,67,},
+    {67,65,66,66,9,25,3,9,71,69,68,67,67,67,67,67,70,72,74,3,4,67,},
+    {67,65,66,66,3,19,73,3,71,69,68,67,67,67,67,67,70,72,10,3,4,67,},
+    {67,65,66,66,11,27,73,11,71,5,4,67,67,67,67,67,70,72,74,3,4,67,},
+    {192,192,192,192,12,28,192,12,192,5,4,192,192,192,192,192,192,192,192,192,4,192,},
+    {192,192,192,192,13,29,192,13,192,5,192,192,192,192,192,192,192,192,192,192,192,192,},
+    {192,192,192,192,14,30,192,14,192,192,192,192,192,192,192,192,6,192,192,192,192,192,},
+    {192,192,192,192,15,31,192,15,192,192,192,192,192,192,192,192,192,192,192,192,192,192,},
+};
+#endif